@@ -148,6 +148,18 @@ public:
      */
     iobuf copy() const;
 
+    /**
+     * Copies every run of consecutive fragments smaller than
+     * small_fragment_size into as few new fragments as possible. Larger
+     * fragments are kept as they are, without a copy. Meant to be called
+     * right before handing a buffer assembled from many small pieces to the
+     * network or disk, so they do not have to go through a long list of tiny
+     * fragments.
+     *
+     * Invalidates placeholders and iterators into this buffer.
+     */
+    void coalesce_small_fragments(size_t small_fragment_size);
+
     /// makes a reservation with the internal storage. adds a layer of
     /// indirection instead of raw byte pointer to allow the
     /// details::io_fragments to internally compact buffers as long as they
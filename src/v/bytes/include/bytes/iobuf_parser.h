@@ -104,6 +104,16 @@ public:
         return iobuf_copy(in, len);
     }
 
+    /// Like consume(), but leaves the parser position unchanged.
+    template<typename Consumer>
+    requires requires(Consumer c, const char* src, size_t max) {
+        { c(src, max) } -> std::same_as<ss::stop_iteration>;
+    }
+    size_t peek_consume(const size_t n, Consumer&& f) const {
+        auto in = _in;
+        return in.consume(n, std::forward<Consumer>(f));
+    }
+
 protected:
     iobuf& ref() { return *std::get<owned_buf>(_buf); }
 
@@ -57,6 +57,51 @@ iobuf iobuf_copy(iobuf::iterator_consumer& in, size_t len) {
     return ret;
 }
 
+void iobuf::coalesce_small_fragments(size_t small_fragment_size) {
+    oncore_debug_verify(_verify_shard);
+    auto is_small = [small_fragment_size](const fragment& f) {
+        return f.size() < small_fragment_size;
+    };
+    container coalesced;
+    while (!_frags.empty()) {
+        // find the run of small fragments at the front
+        size_t run_bytes = 0;
+        size_t run_fragments = 0;
+        for (auto it = _frags.begin(); it != _frags.end() && is_small(*it);
+             ++it) {
+            run_bytes += it->size();
+            ++run_fragments;
+        }
+        if (run_fragments < 2) {
+            auto& f = _frags.front();
+            _frags.pop_front();
+            coalesced.push_back(f);
+            continue;
+        }
+        while (run_bytes > 0) {
+            auto f = std::make_unique<fragment>(
+              details::io_allocation_size::ss_next_allocation_size(run_bytes));
+            while (f->available_bytes() > 0) {
+                auto& src = _frags.front();
+                const auto n = std::min(src.size(), f->available_bytes());
+                f->append(src.get(), n);
+                if (n == src.size()) {
+                    _frags.pop_front_and_dispose(&details::dispose_io_fragment);
+                } else {
+                    src.trim_front(n);
+                }
+            }
+            run_bytes -= f->size();
+            coalesced.push_back(*f.release());
+        }
+        // the run may have ended in empty fragments
+        while (!_frags.empty() && _frags.front().size() == 0) {
+            _frags.pop_front_and_dispose(&details::dispose_io_fragment);
+        }
+    }
+    _frags.swap(coalesced);
+}
+
 iobuf iobuf::share(size_t pos, size_t len) {
     iobuf ret;
     size_t left = len;
@@ -0,0 +1,106 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "random/generators.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+static constexpr size_t inner_iters = 1000;
+
+// builds a buffer out of `count` separate fragments of `size` bytes, the
+// shape produced by serializing many small structures with append_fragments
+static iobuf make_fragmented(size_t count, size_t size) {
+    auto data = random_generators::gen_alphanum_string(size);
+    iobuf buf;
+    for (size_t i = 0; i < count; ++i) {
+        iobuf fragment;
+        fragment.append(data.data(), data.size());
+        buf.append_fragments(std::move(fragment));
+    }
+    return buf;
+}
+
+template<typename F>
+static size_t fragmented_body(size_t count, size_t size, F f) {
+    auto buf = make_fragmented(count, size);
+    perf_tests::start_measuring_time();
+    for (auto i = inner_iters; i--;) {
+        f(buf);
+    }
+    perf_tests::stop_measuring_time();
+    return inner_iters;
+}
+
+static size_t append_body(size_t size) {
+    auto data = random_generators::gen_alphanum_string(size);
+    iobuf buf;
+    perf_tests::start_measuring_time();
+    for (auto i = inner_iters; i--;) {
+        buf.append(data.data(), data.size());
+    }
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+    return inner_iters;
+}
+
+PERF_TEST(iobuf, append_8) { return append_body(8); }
+PERF_TEST(iobuf, append_128) { return append_body(128); }
+PERF_TEST(iobuf, append_4096) { return append_body(4096); }
+
+PERF_TEST(iobuf, share_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        auto s = buf.share(0, buf.size_bytes());
+        perf_tests::do_not_optimize(s);
+    });
+}
+
+PERF_TEST(iobuf, copy_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        auto c = buf.copy();
+        perf_tests::do_not_optimize(c);
+    });
+}
+
+PERF_TEST(iobuf, linearize_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        auto b = iobuf_to_bytes(buf);
+        perf_tests::do_not_optimize(b);
+    });
+}
+
+PERF_TEST(iobuf, coalesce_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        auto c = buf.share(0, buf.size_bytes());
+        c.coalesce_small_fragments(1024);
+        perf_tests::do_not_optimize(c);
+    });
+}
+
+PERF_TEST(iobuf, iterate_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        size_t sum = 0;
+        for (const auto& f : buf) {
+            sum += f.size();
+        }
+        perf_tests::do_not_optimize(sum);
+    });
+}
+
+PERF_TEST(iobuf, iterate_coalesced_1000x16) {
+    return fragmented_body(1000, 16, [](iobuf& buf) {
+        buf.coalesce_small_fragments(1024);
+        size_t sum = 0;
+        for (const auto& f : buf) {
+            sum += f.size();
+        }
+        perf_tests::do_not_optimize(sum);
+    });
+}
@@ -739,6 +739,24 @@ SEASTAR_THREAD_TEST_CASE(iobuf_parser_peek) {
     BOOST_REQUIRE(dst_a == dst_b);
 }
 
+SEASTAR_THREAD_TEST_CASE(iobuf_parser_peek_consume) {
+    const auto a = random_generators::gen_alphanum_string(1024);
+    const auto b = random_generators::gen_alphanum_string(1024);
+    iobuf src;
+    src.append(a.data(), a.size());
+    src.append(b.data(), b.size());
+    iobuf_parser parser(std::move(src));
+    parser.skip(10);
+    ss::sstring peeked;
+    auto n = parser.peek_consume(1500, [&peeked](const char* src, size_t n) {
+        peeked.append(src, n);
+        return ss::stop_iteration::no;
+    });
+    BOOST_REQUIRE_EQUAL(n, 1500);
+    BOOST_REQUIRE_EQUAL(parser.bytes_consumed(), 10);
+    BOOST_REQUIRE_EQUAL(peeked, a.substr(10) + b.substr(0, 510));
+}
+
 SEASTAR_THREAD_TEST_CASE(iobuf_parser_consume_to) {
     auto frag_gen = [](std::span<const uint8_t> in) {
         auto tmp = iobuf{};
@@ -776,3 +794,40 @@ SEASTAR_THREAD_TEST_CASE(iobuf_hexdump) {
   00000000 | 41 65 6e 65 61 6e 20 73  65 64 20 6c 65 6f 20 70  | Aenean sed leo p
   00000010 | 6f 72 74 74 69 74 6f 72  2e                       | orttitor.)");
 }
+
+SEASTAR_THREAD_TEST_CASE(iobuf_coalesce_small_fragments) {
+    auto fragments = [](const iobuf& b) {
+        return std::distance(b.begin(), b.end());
+    };
+    iobuf buf;
+    bytes expected;
+    auto append_fragment = [&](size_t size) {
+        auto data = random_generators::get_bytes(size);
+        iobuf fragment;
+        fragment.append(data.data(), data.size());
+        buf.append_fragments(std::move(fragment));
+        expected.append(data.data(), data.size());
+    };
+    for (int i = 0; i < 100; ++i) {
+        append_fragment(10);
+    }
+    append_fragment(8192);
+    append_fragment(100);
+    append_fragment(8192);
+    for (int i = 0; i < 3000; ++i) {
+        append_fragment(7);
+    }
+    BOOST_REQUIRE_EQUAL(fragments(buf), 3103);
+
+    buf.coalesce_small_fragments(1024);
+
+    // the first run becomes one fragment, the single small fragment between
+    // the large ones is kept and the last run fits in two
+    BOOST_REQUIRE_EQUAL(fragments(buf), 6);
+    BOOST_REQUIRE_EQUAL(buf.size_bytes(), expected.size());
+    BOOST_REQUIRE(iobuf_to_bytes(buf) == expected);
+
+    // appending after coalescing still works
+    append_fragment(3);
+    BOOST_REQUIRE(iobuf_to_bytes(buf) == expected);
+}
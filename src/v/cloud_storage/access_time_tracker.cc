@@ -124,9 +124,9 @@ void access_time_tracker::on_released_table_lock() {
 
     for (const auto& [hash, ts] : _pending_upserts) {
         if (ts.has_value()) {
-            _table[hash] = ts.value();
+            upsert(hash, ts.value());
         } else {
-            _table.erase(hash);
+            erase(hash);
         }
     }
     _pending_upserts.clear();
@@ -136,6 +136,7 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
     _table.clear();
+    _lru.clear();
     _dirty = false;
 
     // Accumulate a serialized table_header in this buffer
@@ -186,8 +187,7 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
             auto path = serde::read_nested<ss::sstring>(parser, 0);
             auto atime = serde::read_nested<uint32_t>(parser, 0);
             auto size = serde::read_nested<uint64_t>(parser, 0);
-            _table.emplace(
-              path, file_metadata{.atime_sec = atime, .size = size});
+            upsert(path, file_metadata{.atime_sec = atime, .size = size});
         }
     }
 
@@ -211,7 +211,7 @@ void access_time_tracker::add(
     auto units = seastar::try_get_units(_table_lock, 1);
     if (units.has_value()) {
         // Got lock, update main table
-        _table[path] = {.atime_sec = seconds, .size = size};
+        upsert(path, {.atime_sec = seconds, .size = size});
         _dirty = true;
     } else {
         // Locked during serialization, defer write
@@ -225,7 +225,7 @@ void access_time_tracker::remove(std::string_view key) noexcept {
         auto units = seastar::try_get_units(_table_lock, 1);
         if (units.has_value()) {
             // Unlocked, update main table
-            _table.erase(k);
+            erase(k);
             _dirty = true;
         } else {
             // Locked during serialization, defer write
@@ -251,10 +251,12 @@ ss::future<> access_time_tracker::sync(
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
     table_t tmp;
+    lru_t tmp_lru;
 
     for (const auto& it : _table) {
         if (paths.contains(it.first)) {
             tmp.insert(it);
+            tmp_lru.emplace(it.second.atime_sec, it.first);
         }
         co_await ss::maybe_yield();
     }
@@ -265,14 +267,13 @@ ss::future<> access_time_tracker::sync(
         };
         for (const auto& entry : existent | std::views::filter(should_add)) {
             _dirty = true;
-            tmp.insert(
-              {entry.path,
-               {static_cast<uint32_t>(
-                  std::chrono::time_point_cast<std::chrono::seconds>(
-                    entry.access_time)
-                    .time_since_epoch()
-                    .count()),
-                entry.size}});
+            auto atime = static_cast<uint32_t>(
+              std::chrono::time_point_cast<std::chrono::seconds>(
+                entry.access_time)
+                .time_since_epoch()
+                .count());
+            tmp.insert({entry.path, {atime, entry.size}});
+            tmp_lru.emplace(atime, entry.path);
         }
     }
 
@@ -281,6 +282,7 @@ ss::future<> access_time_tracker::sync(
         _dirty = true;
     }
     _table = std::move(tmp);
+    _lru = std::move(tmp_lru);
 
     lock_guard.return_all();
     on_released_table_lock();
@@ -299,14 +301,47 @@ bool access_time_tracker::is_dirty() const { return _dirty; }
 fragmented_vector<file_list_item> access_time_tracker::lru_entries() const {
     fragmented_vector<file_list_item> items;
     items.reserve(_table.size());
-    for (const auto& [path, metadata] : _table) {
-        items.emplace_back(metadata.time_point(), path, metadata.size);
-    }
-    std::ranges::sort(
-      items, {}, [](const auto& item) { return item.access_time; });
+    for_each_lru([&items](const file_list_item& item) {
+        items.push_back(item);
+        return ss::stop_iteration::no;
+    });
     return items;
 }
 
+void access_time_tracker::for_each_lru(
+  ss::noncopyable_function<ss::stop_iteration(const file_list_item&)> fn)
+  const {
+    for (const auto& [atime, path] : _lru) {
+        auto it = _table.find(path);
+        vassert(it != _table.end(), "{} is indexed but not tracked", path);
+        if (
+          fn(file_list_item{
+            .access_time = it->second.time_point(),
+            .path = path,
+            .size = it->second.size})
+          == ss::stop_iteration::yes) {
+            return;
+        }
+    }
+}
+
+void access_time_tracker::upsert(
+  const ss::sstring& path, file_metadata metadata) {
+    auto [it, inserted] = _table.try_emplace(path, metadata);
+    if (!inserted) {
+        _lru.erase({it->second.atime_sec, path});
+        it->second = metadata;
+    }
+    _lru.emplace(metadata.atime_sec, path);
+}
+
+void access_time_tracker::erase(const ss::sstring& path) {
+    if (auto it = _table.find(path); it != _table.end()) {
+        _lru.erase({it->second.atime_sec, path});
+        _table.erase(it);
+    }
+}
+
 std::chrono::system_clock::time_point file_metadata::time_point() const {
     return std::chrono::system_clock::time_point{
       std::chrono::seconds{atime_sec}};
@@ -15,12 +15,14 @@
 #include "hashing/xx.h"
 #include "recursive_directory_walker.h"
 #include "seastar/core/iostream.hh"
+#include "seastar/util/noncopyable_function.hh"
 #include "serde/envelope.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/future.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
 
 #include <chrono>
 #include <string_view>
@@ -36,10 +38,12 @@ struct file_metadata {
 };
 
 /// Access time tracker maps cache entry file paths to their last accessed
-/// timestamp and file size.
+/// timestamp and file size. Entries are also indexed by access time so that
+/// trims find the least recently accessed ones without sorting the table.
 class access_time_tracker {
     using timestamp_t = uint32_t;
     using table_t = absl::btree_map<ss::sstring, file_metadata>;
+    using lru_t = absl::btree_set<std::pair<timestamp_t, ss::sstring>>;
 
 public:
     /// Add metadata to the container.
@@ -72,7 +76,18 @@ public:
 
     fragmented_vector<file_list_item> lru_entries() const;
 
+    /// Visit entries from the least recently accessed one until `fn` returns
+    /// stop_iteration::yes. The visit doesn't yield, `fn` must not modify the
+    /// tracker.
+    void for_each_lru(
+      ss::noncopyable_function<ss::stop_iteration(const file_list_item&)> fn)
+      const;
+
 private:
+    /// Update the table and the access time index together
+    void upsert(const ss::sstring& path, file_metadata metadata);
+    void erase(const ss::sstring& path);
+
     /// Returns true if the key's metadata should be tracked.
     /// We do not wish to track index files and transaction manifests
     /// as they are just an appendage to segment/chunk files and are
@@ -83,6 +98,7 @@ private:
     void on_released_table_lock();
 
     table_t _table;
+    lru_t _lru;
 
     // Lock taken during async loops over the table (ser/de and trim())
     // modifications may proceed without the lock if it is not taken.
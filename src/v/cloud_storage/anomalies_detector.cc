@@ -14,9 +14,19 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/partition_manifest_downloader.h"
 #include "cloud_storage/remote.h"
+#include "hashing/xx.h"
 
 namespace cloud_storage {
 
+namespace {
+// Number of keys returned by a LIST request
+constexpr size_t list_page_size = 1000;
+// Every segment also has an index object and may have a tx manifest
+constexpr size_t objects_per_segment = 3;
+// A LIST request costs about as much as ten HEAD requests
+constexpr size_t list_request_cost = 10;
+} // namespace
+
 anomalies_detector::anomalies_detector(
   cloud_storage_clients::bucket_name bucket,
   model::ntp ntp,
@@ -39,6 +49,8 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
   std::optional<model::offset> scrub_from) {
     _result = result{};
     _received_quota = quota_total;
+    _listing_attempted = false;
+    _listed_hashes = std::nullopt;
 
     vlog(_logger.debug, "Downloading partition manifest ...");
 
@@ -61,6 +73,8 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
 
     std::deque<ss::sstring> spill_manifest_paths;
     const auto& spillovers = manifest.get_spillover_map();
+    // Spillover manifests are about as large as the STM manifest
+    _estimated_segments = manifest.size() * (spillovers.size() + 1);
     for (auto iter = spillovers.begin(); iter != spillovers.end(); ++iter) {
         spillover_manifest_path_components comp{
           .base = iter->base_offset,
@@ -236,9 +250,13 @@ anomalies_detector::check_manifest(
 
         const auto segment_path = _remote_path_provider.segment_path(
           manifest, seg_meta);
-        const auto exists_result = co_await _remote.segment_exists(
-          _bucket, remote_segment_path{segment_path}, rtc_node);
-        _result.ops += 1;
+        if (
+          !_listing_attempted
+          && should_list_objects(visitable_tail_segments)) {
+            co_await list_objects(segment_path, rtc_node);
+        }
+        const auto exists_result = co_await segment_exists(
+          segment_path, rtc_node);
         _result.segments_visited += 1;
 
         if (exists_result == download_result::notfound) {
@@ -268,6 +286,88 @@ anomalies_detector::check_manifest(
     co_return stop_detector::no;
 }
 
+bool anomalies_detector::should_list_objects(size_t segments_to_visit) const {
+    const auto pages = (_estimated_segments * objects_per_segment)
+                         / list_page_size
+                       + 1;
+    const auto quota_left = _received_quota.max_num_operations()
+                            - _result.ops;
+    return quota_left > 0 && pages < size_t(quota_left)
+           && pages * list_request_cost < segments_to_visit;
+}
+
+ss::future<> anomalies_detector::list_objects(
+  const ss::sstring& segment_path, retry_chain_node& rtc_node) {
+    _listing_attempted = true;
+    // All objects of the partition share the prefix of the segment path
+    const auto prefix_end = segment_path.find_last_of('/');
+    if (prefix_end == ss::sstring::npos) {
+        co_return;
+    }
+    const auto prefix = std::string_view{segment_path}.substr(
+      0, prefix_end + 1);
+
+    absl::flat_hash_set<uint64_t> hashes;
+    // Only the hashes are collected, the filter rejects every item to avoid
+    // keeping the keys in memory.
+    auto collect_hash = [&hashes](
+                          const cloud_storage_clients::client::list_bucket_item&
+                            item) {
+        hashes.insert(xxhash_64(item.key.data(), item.key.size()));
+        return false;
+    };
+    std::optional<ss::sstring> continuation_token;
+    do {
+        if (
+          _as.abort_requested()
+          || archival::run_quota_t{_result.ops}
+               >= _received_quota.max_num_operations) {
+            vlog(_logger.debug, "Listing of {} abandoned", prefix);
+            co_return;
+        }
+        auto res = co_await _remote.list_objects(
+          _bucket,
+          rtc_node,
+          cloud_storage_clients::object_key{prefix},
+          std::nullopt,
+          collect_hash,
+          list_page_size,
+          continuation_token);
+        ++_result.ops;
+        if (res.has_error()) {
+            vlog(
+              _logger.debug, "Failed to list objects with prefix {}", prefix);
+            co_return;
+        }
+        if (!res.value().is_truncated) {
+            break;
+        }
+        continuation_token = std::move(res.value().next_continuation_token);
+    } while (true);
+
+    vlog(
+      _logger.debug,
+      "Listed {} objects with prefix {}",
+      hashes.size(),
+      prefix);
+    _listed_hashes = std::move(hashes);
+}
+
+ss::future<download_result> anomalies_detector::segment_exists(
+  const ss::sstring& segment_path, retry_chain_node& rtc_node) {
+    // A hash collision could hide a missing segment, it's unlikely enough
+    // with 64 bit hashes.
+    if (
+      _listed_hashes.has_value()
+      && _listed_hashes->contains(
+        xxhash_64(segment_path.data(), segment_path.size()))) {
+        co_return download_result::success;
+    }
+    _result.ops += 1;
+    co_return co_await _remote.segment_exists(
+      _bucket, remote_segment_path{segment_path}, rtc_node);
+}
+
 size_t anomalies_detector::get_visitable_segments() const {
     if (!_result.last_scrubbed_offset.has_value()) {
         // Allow the scrubbing of one segment even if that means
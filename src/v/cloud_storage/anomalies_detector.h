@@ -22,6 +22,8 @@
 
 #include <seastar/core/sstring.hh>
 
+#include <absl/container/flat_hash_set.h>
+
 namespace cloud_storage {
 
 /*
@@ -101,6 +103,21 @@ private:
     /// _result
     size_t get_visitable_segments() const;
 
+    /// The existence of many segments is cheaper to check by listing the
+    /// objects of the partition, one LIST request returns up to 1000 keys,
+    /// than by sending a HEAD request per segment.
+    bool should_list_objects(size_t segments_to_visit) const;
+
+    /// List the objects of the partition and remember the hashes of their
+    /// keys. Segments which are not found in the listing are still checked
+    /// with a HEAD request.
+    ss::future<> list_objects(
+      const ss::sstring& segment_path, retry_chain_node& rtc_node);
+
+    /// Check if the segment exists, using the listing when it's available
+    ss::future<download_result>
+    segment_exists(const ss::sstring& segment_path, retry_chain_node& rtc_node);
+
     cloud_storage_clients::bucket_name _bucket;
     model::ntp _ntp;
     model::initial_revision_id _initial_rev;
@@ -112,6 +129,12 @@ private:
 
     result _result;
     quota_limit _received_quota;
+
+    // Estimated number of segments of the partition, used to estimate the
+    // number of LIST requests needed to list it
+    size_t _estimated_segments{0};
+    bool _listing_attempted{false};
+    std::optional<absl::flat_hash_set<uint64_t>> _listed_hashes;
 };
 
 } // namespace cloud_storage
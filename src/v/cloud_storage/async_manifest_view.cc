@@ -42,6 +42,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/outcome/success_failure.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <iterator>
@@ -410,6 +411,8 @@ async_manifest_view::async_manifest_view(
       config::shard_local_cfg().storage_read_readahead_count.bind())
   , _manifest_meta_ttl(
       config::shard_local_cfg().cloud_storage_manifest_cache_ttl_ms.bind())
+  , _prefetch_count(config::shard_local_cfg()
+                      .cloud_storage_spillover_manifest_prefetch_count.bind())
   , _manifest_cache(
       _remote.local().materialized().get_materialized_manifest_cache()) {}
 
@@ -430,10 +433,19 @@ ss::future<> async_manifest_view::run_bg_loop() {
 
     try {
         while (!_as.abort_requested()) {
-            co_await _cvar.when(
-              [&] { return !_requests.empty() || _as.abort_requested(); });
+            co_await _cvar.when([&] {
+                return !_requests.empty() || !_prefetch_requests.empty()
+                       || _as.abort_requested();
+            });
             _as.check();
             if (_requests.empty()) {
+                // Requests of readers go first, a request for a manifest being
+                // prefetched waits for it and finds it in the cache.
+                if (!_prefetch_requests.empty()) {
+                    auto path = std::move(_prefetch_requests.front());
+                    _prefetch_requests.pop_front();
+                    co_await prefetch_manifest(std::move(path));
+                }
                 continue;
             }
             auto front = std::move(_requests.front());
@@ -516,6 +528,7 @@ ss::future<> async_manifest_view::run_bg_loop() {
                       _manifest_cache.size_bytes());
                     _manifest_cache.put(
                       std::move(u), std::move(m_res.value()), _ctxlog);
+                    schedule_prefetch(front.search_vec);
                     _ts_probe.set_spillover_manifest_bytes(
                       static_cast<int64_t>(_manifest_cache.size_bytes()));
                     _ts_probe.set_spillover_manifest_instances(
@@ -714,6 +727,35 @@ async_manifest_view::get_retention_backlog() noexcept {
     co_return error_outcome::failure;
 }
 
+const async_manifest_view::stm_term_index&
+async_manifest_view::get_stm_term_index() {
+    const auto& stmm = stm_manifest();
+    if (
+      _stm_term_index.has_value()
+      && _stm_term_index->insync_offset == stmm.get_insync_offset()
+      && _stm_term_index->start_offset == stmm.get_start_offset()
+      && _stm_term_index->last_offset == stmm.get_last_offset()
+      && _stm_term_index->segments == stmm.size()) {
+        return *_stm_term_index;
+    }
+    stm_term_index index{
+      .insync_offset = stmm.get_insync_offset(),
+      .start_offset = stmm.get_start_offset(),
+      .last_offset = stmm.get_last_offset(),
+      .segments = stmm.size(),
+    };
+    for (const auto& meta : stmm) {
+        if (
+          index.terms.empty()
+          || index.terms.back().first != meta.segment_term) {
+            index.terms.emplace_back(
+              meta.segment_term, meta.base_kafka_offset());
+        }
+    }
+    _stm_term_index = std::move(index);
+    return *_stm_term_index;
+}
+
 ss::future<result<std::optional<kafka::offset>, error_outcome>>
 async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
     const auto& stmm = stm_manifest();
@@ -736,10 +778,14 @@ async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
         } else {
             // look for first segment in next term, segments are sorted by
             // base_offset and term
-            for (auto const& p : stmm) {
-                if (p.segment_term > term) {
-                    co_return p.base_kafka_offset() - kafka::offset(1);
-                }
+            const auto& terms = get_stm_term_index().terms;
+            auto it = std::upper_bound(
+              terms.begin(),
+              terms.end(),
+              term,
+              [](model::term_id t, const auto& e) { return t < e.first; });
+            if (it != terms.end()) {
+                co_return it->second - kafka::offset(1);
             }
         }
     } else if (stmm.get_archive_start_offset() != model::offset{}) {
@@ -1451,6 +1497,46 @@ async_manifest_view::hydrate_manifest(
     }
 }
 
+void async_manifest_view::schedule_prefetch(const segment_meta& meta) {
+    // Readers move forward through the archive, only the manifests after the
+    // last one they asked for are useful.
+    _prefetch_requests.clear();
+    const auto count = _prefetch_count();
+    const auto& manifests = _stm_manifest.get_spillover_map();
+    for (auto it = manifests.upper_bound(meta.base_offset);
+         it != manifests.end() && _prefetch_requests.size() < count;
+         ++it) {
+        _prefetch_requests.push_back(get_spillover_manifest_path(*it));
+    }
+}
+
+ss::future<> async_manifest_view::prefetch_manifest(
+  remote_manifest_path path) const noexcept {
+    try {
+        auto h = _gate.hold();
+        auto status = co_await _cache.local().is_cached(path());
+        if (status != cache_element_status::not_available) {
+            co_return;
+        }
+        vlog(_ctxlog.debug, "Prefetching spillover manifest {}", path);
+        auto res = co_await hydrate_manifest(path);
+        if (res.has_failure()) {
+            // the manifest is downloaded again when a reader needs it
+            vlog(
+              _ctxlog.debug,
+              "Failed to prefetch spillover manifest {}: {}",
+              path,
+              res.error());
+        }
+    } catch (...) {
+        vlog(
+          _ctxlog.debug,
+          "Failed to prefetch spillover manifest {}: {}",
+          path,
+          std::current_exception());
+    }
+}
+
 std::optional<segment_meta> async_manifest_view::search_spillover_manifests(
   async_view_search_query_t query) const {
     const auto& manifests = _stm_manifest.get_spillover_map();
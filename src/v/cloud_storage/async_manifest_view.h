@@ -36,7 +36,9 @@
 #include <exception>
 #include <map>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
@@ -213,6 +215,13 @@ private:
     ss::future<result<spillover_manifest, error_outcome>>
     materialize_manifest(remote_manifest_path path) const noexcept;
 
+    /// Queue the download of the spillover manifests that follow `meta`
+    /// into the cache, replacing the ones queued before.
+    void schedule_prefetch(const segment_meta& meta);
+
+    /// Download the manifest into the cache unless it's already there
+    ss::future<> prefetch_manifest(remote_manifest_path path) const noexcept;
+
     /// Find index of the spillover manifest
     ///
     /// \param query is a search query, either an offset, a kafka offset or a
@@ -225,6 +234,21 @@ private:
     remote_manifest_path
     get_spillover_manifest_path(const segment_meta& meta) const;
 
+    /// First kafka offset of every term of the STM manifest, in term order
+    struct stm_term_index {
+        model::offset insync_offset;
+        std::optional<model::offset> start_offset;
+        model::offset last_offset;
+        size_t segments{0};
+        std::vector<std::pair<model::term_id, kafka::offset>> terms;
+    };
+
+    /// Returns the term index of the STM manifest, rebuilding it if the
+    /// manifest changed since it was last built. Term lookups come in bursts
+    /// (OffsetForLeaderEpoch after a rebalance) between manifest updates, so
+    /// this turns most of them into a binary search instead of a scan.
+    const stm_term_index& get_stm_term_index();
+
     mutable ss::gate _gate;
     ss::abort_source _as;
     cloud_storage_clients::bucket_name _bucket;
@@ -242,8 +266,10 @@ private:
     config::binding<int16_t> _readahead_size;
 
     config::binding<std::chrono::milliseconds> _manifest_meta_ttl;
+    config::binding<size_t> _prefetch_count;
 
     materialized_manifest_cache& _manifest_cache;
+    std::optional<stm_term_index> _stm_term_index;
 
     // BG loop state
 
@@ -254,6 +280,8 @@ private:
         std::unique_ptr<ts_read_path_probe::hist_t::measurement> _measurement;
     };
     std::deque<materialization_request_t> _requests;
+    /// Manifests to download into the cache while there are no requests
+    std::deque<remote_manifest_path> _prefetch_requests;
     ss::condition_variable _cvar;
 };
 
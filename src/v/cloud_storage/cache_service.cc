@@ -23,6 +23,7 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/io_priority_class.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shard_id.hh>
 #include <seastar/core/smp.hh>
@@ -386,7 +387,28 @@ ss::future<> cache::trim(
         - std::min(
           target_objects, _current_cache_objects + _reserved_cache_objects);
 
-    auto tracker_lru_entries = _access_time_tracker.lru_entries();
+    // Only the least recently accessed entries that reach the target are
+    // candidates, followed by the entries kept as carryover for the next trim.
+    fragmented_vector<file_list_item> tracker_lru_entries;
+    uint64_t candidates_size = 0;
+    ssize_t carryover_bytes
+      = config::shard_local_cfg()
+          .cloud_storage_cache_trim_carryover_bytes.value();
+    _access_time_tracker.for_each_lru([&](const file_list_item& item) {
+        if (
+          candidates_size < size_to_delete
+          || tracker_lru_entries.size() < objects_to_delete) {
+            candidates_size += item.size;
+        } else {
+            carryover_bytes -= static_cast<ssize_t>(
+              sizeof(item) + item.path.size());
+            if (carryover_bytes < 0) {
+                return ss::stop_iteration::yes;
+            }
+        }
+        tracker_lru_entries.push_back(item);
+        return ss::stop_iteration::no;
+    });
     vlog(
       cst_log.debug,
       "in-memory trim: set target_size {}/{}, size {}/{}, reserved {}/{}, "
@@ -1041,6 +1063,10 @@ ss::future<> cache::stop() {
     _block_puts_cond.broken();
     _cleanup_sm.broken();
     _tracker_sync_timer_sem.broken();
+    for (auto& [key, download] : _downloads) {
+        download.set_exception(ss::gate_closed_exception{});
+    }
+    _downloads.clear();
     if (ss::this_shard_id() == 0) {
         co_await save_access_time_tracker().handle_exception([](auto eptr) {
             // NOTE: see issue/11270 if the exception is "filesystem error:
@@ -1233,15 +1259,14 @@ ss::future<> cache::put(
       (++_cnt),
       cache_tmp_file_extension));
 
+    // The directory usually exists already (e.g. it holds the other chunks
+    // of the segment), so it is only created when opening the file fails.
+    // delete_file_and_empty_parents may also delete dir_path before we open
+    // the file, in this case we recreate dir_path and try again.
     ss::file tmp_cache_file;
     while (true) {
+        bool missing_dir = false;
         try {
-            // delete_file_and_empty_parents may delete dir_path before
-            // we open file, in this case we recreate dir_path and try again
-            if (!co_await ss::file_exists(dir_path.string())) {
-                co_await ss::recursive_touch_directory(dir_path.string());
-            }
-
             auto flags = ss::open_flags::wo | ss::open_flags::create
                          | ss::open_flags::exclusive;
 
@@ -1254,10 +1279,14 @@ ss::future<> cache::put(
                   cst_log.debug,
                   "Couldn't open {}, gonna retry",
                   (dir_path / tmp_filename).native());
+                missing_dir = true;
             } else {
                 throw;
             }
         }
+        if (missing_dir) {
+            co_await ss::recursive_touch_directory(dir_path.string());
+        }
     }
 
     ss::file_output_stream_options options{};
@@ -1266,9 +1295,23 @@ ss::future<> cache::put(
     options.io_priority_class = io_priority;
     auto out = co_await ss::make_file_output_stream(tmp_cache_file, options);
 
+    // Count the bytes written rather than stat the file once it's written
+    uint64_t put_size = 0;
     std::exception_ptr disk_full_error;
     try {
-        co_await ss::copy(data, out)
+        co_await ss::repeat([&data, &out, &put_size] {
+            return data.read().then(
+              [&out, &put_size](ss::temporary_buffer<char> buf) {
+                  if (buf.empty()) {
+                      return ss::make_ready_future<ss::stop_iteration>(
+                        ss::stop_iteration::yes);
+                  }
+                  put_size += buf.size();
+                  return out.write(std::move(buf)).then([] {
+                      return ss::stop_iteration::no;
+                  });
+              });
+        })
           .then([&out]() { return out.flush(); })
           .finally([&out]() { return out.close(); });
     } catch (std::filesystem::filesystem_error& e) {
@@ -1299,8 +1342,6 @@ ss::future<> cache::put(
     auto src = (dir_path / tmp_filename).native();
     auto dest = (dir_path / filename).native();
 
-    auto put_size = co_await ss::file_size(src);
-
     co_await ss::rename_file(src, dest);
 
     // We will now update
@@ -1399,6 +1440,56 @@ cache::reserve_space(uint64_t bytes, size_t objects) {
     co_return space_reservation_guard(*this, bytes, objects);
 }
 
+ss::future<> cache::download_once(
+  std::filesystem::path key,
+  ss::noncopyable_function<ss::future<>()> download) {
+    auto guard = _gate.hold();
+    const auto owner = download_owner_shard(key);
+    const bool claimed = co_await container().invoke_on(
+      owner, [key](cache& c) { return c.claim_download(key); });
+    if (!claimed) {
+        if (co_await is_cached(key) == cache_element_status::available) {
+            vlog(
+              cst_log.debug,
+              "{} was put in the cache by another shard",
+              key.native());
+            co_return;
+        }
+        co_return co_await download();
+    }
+
+    std::exception_ptr eptr;
+    try {
+        co_await download();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await container().invoke_on(
+      owner, [key](cache& c) { c.release_download(key); });
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+}
+
+ss::future<bool> cache::claim_download(const std::filesystem::path& key) {
+    if (auto it = _downloads.find(key); it != _downloads.end()) {
+        return it->second.get_shared_future().then([] { return false; });
+    }
+    _downloads.emplace(key, ss::shared_promise<>{});
+    return ss::make_ready_future<bool>(true);
+}
+
+void cache::release_download(const std::filesystem::path& key) {
+    if (auto it = _downloads.find(key); it != _downloads.end()) {
+        it->second.set_value();
+        _downloads.erase(it);
+    }
+}
+
+ss::shard_id cache::download_owner_shard(const std::filesystem::path& key) {
+    return std::hash<std::string_view>{}(key.native()) % ss::smp::count;
+}
+
 void cache::reserve_space_release(
   uint64_t bytes,
   size_t objects,
@@ -24,10 +24,13 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <filesystem>
 #include <iterator>
+#include <map>
 #include <optional>
 #include <set>
 #include <string_view>
@@ -164,6 +167,15 @@ public:
     // and wait until enough free space is available.
     ss::future<space_reservation_guard> reserve_space(uint64_t, size_t);
 
+    /// Run `download`, which puts the object at `key` into the cache, unless
+    /// another shard of this node is already downloading the same object.
+    /// In that case wait for the other shard to finish instead, and only run
+    /// `download` if the object still isn't in the cache afterwards (e.g.
+    /// because the other download failed).
+    ss::future<> download_once(
+      std::filesystem::path key,
+      ss::noncopyable_function<ss::future<>()> download);
+
     // Release capacity acquired via `reserve_space`.  This spawns
     // a background fiber in order to be callable from the guard destructor.
     void reserve_space_release(uint64_t, size_t, uint64_t, size_t);
@@ -283,6 +295,19 @@ private:
     /// (only runs on shard 0)
     ss::future<> do_reserve_space(uint64_t, size_t);
 
+    /// Register a download of the object at `key` by the calling shard.
+    /// Returns true if no other shard is downloading it, otherwise waits
+    /// for the other download to finish and returns false.
+    /// (only runs on the shard returned by download_owner_shard)
+    ss::future<bool> claim_download(const std::filesystem::path& key);
+
+    /// Wake up the shards waiting on the download registered with
+    /// `claim_download`.
+    /// (only runs on the shard returned by download_owner_shard)
+    void release_download(const std::filesystem::path& key);
+
+    static ss::shard_id download_owner_shard(const std::filesystem::path&);
+
     /// Trim cache using results from the previous recursive directory walk
     ss::future<trim_result>
     trim_carryover(uint64_t delete_bytes, uint64_t delete_objects);
@@ -359,6 +384,8 @@ private:
 
     ssx::semaphore _cleanup_sm{1, "cloud/cache"};
     std::set<std::filesystem::path> _files_in_progress;
+    /// Downloads in progress on any shard, for the keys this shard owns.
+    std::map<std::filesystem::path, ss::shared_promise<>> _downloads;
     cache_probe probe;
     access_time_tracker _access_time_tracker;
     ss::timer<ss::lowres_clock> _tracker_timer;
@@ -22,7 +22,9 @@
 #include <seastar/core/file-types.hh>
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
+#include <seastar/core/smp.hh>
 #include <seastar/coroutine/as_future.hh>
 
 #include <re2/re2.h>
@@ -37,6 +39,11 @@ namespace {
 // hash-string/ns/tp/partition_rev/.*
 const RE2 path_expr{"^[[:xdigit:]]+/(.*?)/(.*?)/(\\d+)_\\d+/.*?"};
 
+// The number of buffered rows per shard before the rows are hashed. Hashing
+// smaller batches across shards costs more in cross shard messaging than is
+// gained by parallel processing.
+constexpr size_t rows_per_shard = 4096;
+
 // Holds hashes for a given NTP in memory before they will be flushed to disk.
 // One of these structures is held per NTP in a map keyed by the NTP itself.
 struct flush_entry {
@@ -80,6 +87,7 @@ ss::future<> inventory_consumer::consume(
     co_await parser
       .consume([this](auto&& paths) { return process_paths(std::move(paths)); })
       .finally([&parser] { return parser.stop(); });
+    co_await process_pending_rows();
     co_await flush(write_all_t::yes);
 }
 
@@ -93,36 +101,90 @@ std::vector<ss::sstring> inventory_consumer::parse_row(ss::sstring row) {
 
 ss::future<>
 inventory_consumer::process_paths(fragmented_vector<ss::sstring> paths) {
-    for (const auto& path : paths) {
+    for (auto& path : paths) {
+        _pending_rows.push_back(std::move(path));
+    }
+
+    if (_pending_rows.size() >= rows_per_shard * ss::smp::count) {
+        co_await process_pending_rows();
+    }
+
+    if (_total_size >= _max_hash_size_in_memory) {
+        co_await flush();
+    }
+}
+
+ss::future<> inventory_consumer::process_pending_rows() {
+    auto rows = std::exchange(_pending_rows, {});
+    if (rows.empty()) {
+        co_return;
+    }
+
+    if (ss::smp::count == 1 || rows.size() < rows_per_shard) {
+        add_hashes(hash_paths(rows, 0, rows.size(), _ntps));
+        co_return;
+    }
+
+    // The rows and the NTP set are only read by the other shards while this
+    // shard waits for the results, so they are passed by reference.
+    const auto range_size = (rows.size() + ss::smp::count - 1)
+                            / ss::smp::count;
+    std::vector<ntp_hashes_t> results(ss::smp::count);
+    co_await ss::parallel_for_each(
+      views::iota(0u, ss::smp::count), [&](ss::shard_id shard) {
+          const auto begin = std::min(rows.size(), shard * range_size);
+          const auto end = std::min(rows.size(), begin + range_size);
+          return ss::smp::submit_to(
+                   shard,
+                   [&rows, begin, end, &ntps = _ntps] {
+                       return hash_paths(rows, begin, end, ntps);
+                   })
+            .then([&results, shard](ntp_hashes_t hashes) {
+                results[shard] = std::move(hashes);
+            });
+      });
+
+    for (auto& hashes : results) {
+        add_hashes(std::move(hashes));
+    }
+}
+
+inventory_consumer::ntp_hashes_t inventory_consumer::hash_paths(
+  const fragmented_vector<ss::sstring>& rows,
+  size_t begin,
+  size_t end,
+  const absl::node_hash_set<model::ntp>& ntps) {
+    ntp_hashes_t hashes;
+    for (auto i = begin; i < end; ++i) {
         // The row is expected to be in the form:
         // "bucket","path"
-        auto pieces = parse_row(path);
+        auto pieces = parse_row(rows[i]);
         // If a row is malformed we skip it and do not abort processing.
         // This way the rest of the entries are processed, and if there
         // was a path in this row it will be recorded as missing.
         if (pieces.size() != 2) {
-            vlog(cst_log.warn, "unexpected row in inventory report: {}", path);
+            vlog(
+              cst_log.warn, "unexpected row in inventory report: {}", rows[i]);
+            continue;
         }
-        process_path(pieces[1]);
-    }
 
-    if (_total_size >= _max_hash_size_in_memory) {
-        co_await flush();
+        const auto& path = pieces[1];
+        if (auto maybe_ntp = ntp_from_path(path);
+            maybe_ntp.has_value() && ntps.contains(maybe_ntp.value())) {
+            hashes[maybe_ntp.value()].push_back(
+              xxhash_64(path.data(), path.size()));
+        }
     }
+    return hashes;
 }
 
-void inventory_consumer::process_path(ss::sstring path) {
-    if (auto maybe_ntp = ntp_from_path(path);
-        _ntps.contains(maybe_ntp.value())) {
-        const auto& ntp = maybe_ntp.value();
-        auto hash = xxhash_64(path.data(), path.size());
-
-        if (!_ntp_flush_states.contains(ntp)) {
-            _ntp_flush_states.insert({ntp, flush_state{}});
+void inventory_consumer::add_hashes(ntp_hashes_t hashes) {
+    for (auto& [ntp, ntp_hashes] : hashes) {
+        auto& flush_state = _ntp_flush_states[ntp];
+        for (auto hash : ntp_hashes) {
+            flush_state.hashes.push_back(hash);
         }
-
-        _ntp_flush_states[ntp].hashes.push_back(hash);
-        _total_size += sizeof(hash);
+        _total_size += sizeof(uint64_t) * ntp_hashes.size();
     }
 }
 
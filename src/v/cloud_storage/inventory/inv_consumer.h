@@ -34,6 +34,11 @@ namespace cloud_storage::inventory {
 /// limit, the hashes for the invidividual NTPs are written to disk until the
 /// cumulative memory usage drops below the desired limit. On completion of the
 /// report consumption, all hashes in memory are flushed to disk.
+///
+/// The report is decompressed and split into rows on the shard consuming the
+/// stream. Parsing the rows and hashing the paths is spread across all shards,
+/// and the resulting hashes are collected back on the consuming shard, which
+/// owns the hash files.
 class inventory_consumer {
     using write_all_t = ss::bool_class<struct write_all_tag>;
 
@@ -65,12 +70,29 @@ public:
     ~inventory_consumer() = default;
 
 private:
+    using ntp_hashes_t
+      = absl::node_hash_map<model::ntp, fragmented_vector<uint64_t>>;
+
+    // Buffers the rows until there are enough of them to keep all shards busy,
+    // then hashes the buffered rows. A flush is performed if the hashes held in
+    // memory exceed the prescribed limit.
     ss::future<> process_paths(fragmented_vector<ss::sstring> paths);
 
-    // Checks if the path belongs to one of the NTPs whose leadership belongs to
-    // this node. If so, the path is hashed and added to current NTP flush
-    // states, and will be written to disk on the next flush operation.
-    void process_path(ss::sstring path);
+    // Hashes all buffered rows, splitting them in equal ranges across shards.
+    ss::future<> process_pending_rows();
+
+    // Parses the rows in the range [begin, end) and, for paths which belong to
+    // one of the NTPs whose leadership belongs to this node, computes the path
+    // hash. May be called on any shard, it only reads the arguments.
+    static ntp_hashes_t hash_paths(
+      const fragmented_vector<ss::sstring>& rows,
+      size_t begin,
+      size_t end,
+      const absl::node_hash_set<model::ntp>& ntps);
+
+    // Adds hashes to the current NTP flush states, they will be written to disk
+    // on the next flush operation.
+    void add_hashes(ntp_hashes_t hashes);
 
     // Writes the largest hash vectors to disk. The vectors are written in files
     // named after their NTP. If write_all_entries is true, all hashes are
@@ -108,6 +130,9 @@ private:
     // processed.
     absl::node_hash_map<model::ntp, flush_state> _ntp_flush_states;
 
+    // Rows read from the report which are not yet hashed.
+    fragmented_vector<ss::sstring> _pending_rows;
+
     // Max size of path hashes (8 bytes each) held in memory before a flush is
     // performed to free up memory.
     size_t _max_hash_size_in_memory;
@@ -119,7 +119,9 @@ ss::future<ssx::semaphore_units> materialized_manifest_cache::prepare(
         evicted.push_back(key);
         // Invariant: the materialized_manifest is always linked to either
         // _access_order or _eviction_rollback list.
-        bytes_evicted += evict(cit, _eviction_rollback, ctxlog);
+        auto sz = evict(cit, _eviction_rollback, ctxlog);
+        add_ghost(key, sz);
+        bytes_evicted += sz;
     }
     // Here the least recently used materialized manifests were evicted to
     // free up 'size_bytes' bytes. But these manifests could still be used
@@ -141,6 +143,7 @@ ss::future<ssx::semaphore_units> materialized_manifest_cache::prepare(
           "manifest",
           evicted.size());
         for (auto eso : evicted) {
+            remove_ghost(eso);
             rollback(eso, ctxlog);
         }
         throw;
@@ -210,6 +213,7 @@ void materialized_manifest_cache::put(
         vlog(ctxlog.error, "Manifest with key {} is already present", key);
         return;
     }
+    remove_ghost(key);
     _access_order.push_back(*it->second);
 }
 
@@ -218,6 +222,7 @@ ss::shared_ptr<materialized_manifest> materialized_manifest_cache::get(
     if (auto it = _cache.find(key); it != _cache.end()) {
         if (promote(it->second)) {
             vlog(ctxlog.debug, "Cache GET will return {}", key);
+            ++_hits;
             return it->second;
         } else {
             vlog(
@@ -240,9 +245,14 @@ ss::shared_ptr<materialized_manifest> materialized_manifest_cache::get(
               ctxlog.debug,
               "Cache GET will return {} from eviction rollback",
               key);
+            ++_hits;
             return it->shared_from_this();
         }
     }
+    ++_misses;
+    if (remove_ghost(key)) {
+        ++_ghost_hits;
+    }
     vlog(
       ctxlog.debug,
       "Cache GET will return NULL for offset {}, cache size: {}, rollback "
@@ -396,6 +406,33 @@ void materialized_manifest_cache::rollback(
     vlog(ctxlog.debug, "Successful rollback of the manifest with key {}", key);
 }
 
+void materialized_manifest_cache::add_ghost(
+  const manifest_cache_key& key, size_t size_bytes) {
+    auto& list = _ghosts.get<ghost_list>();
+    auto [it, inserted] = list.push_front(
+      ghost_entry{.key = key, .size_bytes = size_bytes});
+    if (!inserted) {
+        return;
+    }
+    _ghost_bytes += size_bytes;
+    // Twice the capacity in total, together with the cache itself
+    while (_ghost_bytes > _capacity_bytes && !list.empty()) {
+        _ghost_bytes -= list.back().size_bytes;
+        list.pop_back();
+    }
+}
+
+bool materialized_manifest_cache::remove_ghost(const manifest_cache_key& key) {
+    auto& map = _ghosts.get<ghost_map>();
+    auto it = map.find(key);
+    if (it == map.end()) {
+        return false;
+    }
+    _ghost_bytes -= it->size_bytes;
+    map.erase(it);
+    return true;
+}
+
 void materialized_manifest_cache::discard_rollback_manifest(
   const manifest_cache_key& key, retry_chain_logger& ctxlog) {
     auto it = lookup_eviction_rollback_list(key);
@@ -25,6 +25,12 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/timed_out_error.hh>
 
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index/tag.hpp>
+#include <boost/multi_index_container.hpp>
+
 #include <algorithm>
 #include <chrono>
 #include <exception>
@@ -178,10 +184,46 @@ public:
 
     size_t get_capacity() const { return _capacity_bytes; }
 
+    /// Number of lookups that found the manifest in the cache
+    uint64_t hits() const { return _hits; }
+
+    /// Number of lookups that didn't find the manifest in the cache
+    uint64_t misses() const { return _misses; }
+
+    /// Number of misses that a cache twice as large would have served
+    ///
+    /// The keys of manifests evicted to make room for others are
+    /// remembered, up to the capacity of the cache in bytes. A miss on one
+    /// of these keys would have been a hit with that much more memory, so
+    /// comparing this counter with the misses tells whether it's worth
+    /// growing the cache.
+    uint64_t ghost_hits() const { return _ghost_hits; }
+
 private:
     using map_t
       = std::map<manifest_cache_key, ss::shared_ptr<materialized_manifest>>;
 
+    struct ghost_entry {
+        manifest_cache_key key;
+        size_t size_bytes;
+    };
+    struct ghost_list {};
+    struct ghost_map {};
+    using ghosts_t = boost::multi_index::multi_index_container<
+      ghost_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<ghost_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<ghost_map>,
+          boost::multi_index::
+            member<ghost_entry, manifest_cache_key, &ghost_entry::key>>>>;
+
+    /// Remember the key of a manifest evicted to make room for another one
+    void add_ghost(const manifest_cache_key& key, size_t size_bytes);
+
+    /// Forget the key of an evicted manifest, return true if it was known
+    bool remove_ghost(const manifest_cache_key& key);
+
     /// Evict manifest pointed by the iterator
     ///
     /// \param it points to the elements to remove
@@ -221,6 +263,12 @@ private:
     /// which can't be changed without recreating the semaphore and makes
     /// difficult cache resizing.
     ssx::semaphore_units _reserved;
+    /// Keys of recently evicted manifests, most recently evicted first
+    ghosts_t _ghosts;
+    size_t _ghost_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _ghost_hits{0};
 };
 
 } // namespace cloud_storage
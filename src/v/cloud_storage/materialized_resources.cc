@@ -170,6 +170,10 @@ materialized_resources::materialized_resources()
       config::shard_local_cfg().cloud_storage_manifest_cache_size.bind())
   , _manifest_cache(ss::make_shared<materialized_manifest_cache>(
       config::shard_local_cfg().cloud_storage_manifest_cache_size()))
+  , _range_cache(
+      config::shard_local_cfg().cloud_storage_memory_read_cache_size.bind())
+  , _prefetch_scheduler(config::shard_local_cfg()
+                          .cloud_storage_prefetch_max_bytes_in_flight.bind())
   , _throughput_limit(
       // apply shard limit to downloads
       get_hard_throughput_limit().download_shard_throughput_limit,
@@ -323,6 +327,8 @@ ss::future<> materialized_resources::stop() {
 
     _throughput_limit.shutdown();
 
+    co_await _prefetch_scheduler.stop();
+
     co_await _manifest_cache->stop();
 
     _stm_timer.cancel();
@@ -372,6 +378,13 @@ inline ssize_t projected_remote_partition_reader_memory_usage() {
     return static_cast<ssize_t>(sz);
 }
 
+inline ssize_t projected_parked_cursor_memory_usage() {
+    // The cursor doesn't own the manifest it points at, the spillover
+    // manifests are accounted for by the materialized manifest cache.
+    static size_t sz = remote_partition::parked_cursor_mem_use_estimate();
+    return static_cast<ssize_t>(sz);
+}
+
 inline ssize_t projected_remote_segment_memory_usage() {
     // This is an estimate. When the reader is created it's size should be
     // checked and if it's larger units should be acquired. If it's smaller
@@ -508,6 +521,11 @@ materialized_resources::get_partition_reader_units(
     return get_units_abortable(_mem_units, sz, as);
 }
 
+std::optional<ssx::semaphore_units>
+materialized_resources::try_get_parked_cursor_units() {
+    return _mem_units.try_get_units(projected_parked_cursor_memory_usage());
+}
+
 ss::future<ssx::semaphore_units>
 materialized_resources::get_hydration_units(size_t n) {
     auto u = co_await _hydration_units.get_units(n);
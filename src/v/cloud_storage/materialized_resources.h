@@ -12,8 +12,10 @@
 
 #include "base/seastarx.h"
 #include "cloud_storage/materialized_manifest_cache.h"
+#include "cloud_storage/prefetch_scheduler.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote_partition.h"
+#include "cloud_storage/segment_range_cache.h"
 #include "cloud_storage/segment_state.h"
 #include "config/property.h"
 #include "container/intrusive_list_helpers.h"
@@ -70,10 +72,20 @@ public:
 
     ss::future<segment_units> get_segment_units(storage::opt_abort_source_t as);
 
+    /// Units for a manifest cursor parked by a partition reader, only taken
+    /// if they are available right away
+    std::optional<ssx::semaphore_units> try_get_parked_cursor_units();
+
     materialized_manifest_cache& get_materialized_manifest_cache();
 
     ts_read_path_probe& get_read_path_probe();
 
+    /// Byte ranges of segments downloaded into memory by small reads
+    segment_range_cache& get_segment_range_cache() { return _range_cache; }
+
+    /// Hydrations ahead of the consumers of all partitions of the shard
+    prefetch_scheduler& get_prefetch_scheduler() { return _prefetch_scheduler; }
+
     /// Acquire hydration units
     ///
     /// The undrlying semaphore limits number of parallel hydrations
@@ -174,6 +186,8 @@ private:
     uint64_t _segments_delayed{0};
 
     ts_read_path_probe _read_path_probe;
+    segment_range_cache _range_cache;
+    prefetch_scheduler _prefetch_scheduler;
     token_bucket<> _throughput_limit;
     config::binding<std::optional<size_t>> _throughput_shard_limit_config;
     config::binding<std::optional<size_t>> _relative_throughput;
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/prefetch_scheduler.h"
+
+#include "base/vlog.h"
+#include "cloud_storage/logger.h"
+#include "ssx/future-util.h"
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+void read_velocity::record(size_t bytes, clock::time_point now) {
+    _window_bytes += bytes;
+    const auto elapsed = now - _window_start;
+    if (elapsed < window) {
+        return;
+    }
+    const auto window_rate
+      = static_cast<double>(_window_bytes)
+        / std::chrono::duration<double>(elapsed).count();
+    _rate = _rate == 0 ? window_rate : (_rate + window_rate) / 2;
+    _window_start = now;
+    _window_bytes = 0;
+}
+
+bool prefetch_scheduler::later_deadline(const request& a, const request& b) {
+    // the earliest deadline is at the front of the heap
+    return a.deadline > b.deadline;
+}
+
+prefetch_scheduler::prefetch_scheduler(
+  config::binding<size_t> max_bytes_in_flight)
+  : _max_bytes_in_flight(std::move(max_bytes_in_flight)) {
+    _max_bytes_in_flight.watch([this] { dispatch(); });
+}
+
+ss::future<> prefetch_scheduler::stop() {
+    _queue.clear();
+    return _gate.close();
+}
+
+void prefetch_scheduler::schedule(
+  size_t bytes, clock::time_point deadline, prefetch_fn fn) {
+    if (!enabled() || _gate.is_closed()) {
+        return;
+    }
+    if (_queue.size() >= max_queued) {
+        // make room by dropping the prefetch needed last
+        auto last = std::max_element(
+          _queue.begin(), _queue.end(), [](const auto& a, const auto& b) {
+              return a.deadline < b.deadline;
+          });
+        if (last->deadline <= deadline) {
+            ++_dropped;
+            return;
+        }
+        _queue.erase(last);
+        std::make_heap(_queue.begin(), _queue.end(), later_deadline);
+        ++_dropped;
+    }
+    _queue.push_back(
+      request{.bytes = bytes, .deadline = deadline, .fn = std::move(fn)});
+    std::push_heap(_queue.begin(), _queue.end(), later_deadline);
+    dispatch();
+}
+
+void prefetch_scheduler::dispatch() {
+    const auto now = clock::now();
+    while (!_queue.empty() && !_gate.is_closed()) {
+        std::pop_heap(_queue.begin(), _queue.end(), later_deadline);
+        auto& next = _queue.back();
+        if (next.deadline < now) {
+            // the consumer already got there
+            _queue.pop_back();
+            ++_dropped;
+            continue;
+        }
+        if (
+          _bytes_in_flight > 0
+          && _bytes_in_flight + next.bytes > _max_bytes_in_flight()) {
+            std::push_heap(_queue.begin(), _queue.end(), later_deadline);
+            return;
+        }
+        auto req = std::move(next);
+        _queue.pop_back();
+        _bytes_in_flight += req.bytes;
+        ssx::spawn_with_gate(
+          _gate, [this, bytes = req.bytes, fn = std::move(req.fn)]() mutable {
+              return ss::futurize_invoke(fn)
+                .handle_exception([](const std::exception_ptr& e) {
+                    vlog(cst_log.debug, "Prefetch failed: {}", e);
+                })
+                .finally([this, bytes] {
+                    _bytes_in_flight -= bytes;
+                    dispatch();
+                });
+          });
+    }
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <vector>
+
+namespace cloud_storage {
+
+/// Estimates the rate at which a consumer reads, averaged over windows of a
+/// second with an exponential moving average.
+class read_velocity {
+public:
+    using clock = ss::lowres_clock;
+
+    void record(size_t bytes, clock::time_point now = clock::now());
+
+    /// Bytes per second, 0 until a window completed
+    double bytes_per_sec() const { return _rate; }
+
+private:
+    static constexpr auto window = std::chrono::seconds(1);
+
+    clock::time_point _window_start{clock::now()};
+    size_t _window_bytes{0};
+    double _rate{0};
+};
+
+/**
+ * Shard-level scheduler of tiered storage prefetches.
+ *
+ * Readers of remote partitions ask for the next segment they will read to be
+ * hydrated ahead of them, along with an estimate of when they will need it.
+ * The scheduler runs the prefetches whose consumers will run out of data first,
+ * and bounds the bytes of prefetches in flight across all partitions of the
+ * shard. Prefetches whose consumer should already have needed them are dropped,
+ * the consumer then hydrates the data itself.
+ */
+class prefetch_scheduler {
+public:
+    using clock = ss::lowres_clock;
+    using prefetch_fn = ss::noncopyable_function<ss::future<>()>;
+
+    static constexpr size_t max_queued = 1000;
+
+    explicit prefetch_scheduler(config::binding<size_t> max_bytes_in_flight);
+
+    ss::future<> stop();
+
+    bool enabled() const { return _max_bytes_in_flight() > 0; }
+
+    /// Queues a prefetch of about `bytes` needed by its consumer at `deadline`
+    void schedule(size_t bytes, clock::time_point deadline, prefetch_fn);
+
+    size_t queued() const { return _queue.size(); }
+    size_t bytes_in_flight() const { return _bytes_in_flight; }
+    uint64_t dropped() const { return _dropped; }
+
+private:
+    struct request {
+        size_t bytes;
+        clock::time_point deadline;
+        prefetch_fn fn;
+    };
+
+    static bool later_deadline(const request&, const request&);
+
+    /// Starts queued prefetches, earliest deadline first, while they fit in
+    /// the in-flight budget. Always allows one prefetch to run.
+    void dispatch();
+
+    config::binding<size_t> _max_bytes_in_flight;
+    // heap ordered by deadline, see dispatch()
+    std::vector<request> _queue;
+    size_t _bytes_in_flight{0};
+    uint64_t _dropped{0};
+    ss::gate _gate;
+};
+
+} // namespace cloud_storage
@@ -140,6 +140,30 @@ ts_read_path_probe::ts_read_path_probe() {
                 "evicted from the cache)"))
               .aggregate(aggregate_labels),
 
+            sm::make_counter(
+              "chunks_prefetched",
+              [this] { return _chunks_prefetched; },
+              sm::description(
+                "Total number of chunks scheduled for hydration ahead of "
+                "readers"))
+              .aggregate(aggregate_labels),
+
+            sm::make_counter(
+              "chunk_hits",
+              [this] { return _chunk_hits; },
+              sm::description(
+                "Number of chunk requests from readers served by an already "
+                "hydrated chunk"))
+              .aggregate(aggregate_labels),
+
+            sm::make_counter(
+              "chunk_misses",
+              [this] { return _chunk_misses; },
+              sm::description(
+                "Number of chunk requests from readers that had to wait for "
+                "the chunk to be hydrated"))
+              .aggregate(aggregate_labels),
+
             sm::make_histogram(
               "chunk_hydration_latency",
               [this] {
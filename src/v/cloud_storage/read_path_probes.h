@@ -84,6 +84,9 @@ public:
     }
 
     void on_chunks_hydration(size_t num) { _chunks_hydrated += num; }
+    void on_chunks_prefetch(size_t num) { _chunks_prefetched += num; }
+    void on_chunk_hit() { _chunk_hits++; }
+    void on_chunk_miss() { _chunk_misses++; }
 
     auto chunk_hydration_latency() {
         return _chunk_hydration_latency.auto_measure();
@@ -112,6 +115,9 @@ private:
     hist_t _spillover_mat_latency;
 
     size_t _chunks_hydrated = 0;
+    size_t _chunks_prefetched = 0;
+    size_t _chunk_hits = 0;
+    size_t _chunk_misses = 0;
     hist_t _chunk_hydration_latency;
     size_t _downloads_throttled_sum = 0;
     size_t _hydrations_in_progress = 0;
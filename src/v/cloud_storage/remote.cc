@@ -84,6 +84,11 @@ remote::remote(
       *_materialized)
   , _azure_shared_key_binding(
       config::shard_local_cfg().cloud_storage_azure_shared_key.bind())
+  , _background_requests_per_sec(
+      config::shard_local_cfg()
+        .cloud_storage_background_requests_per_sec.bind())
+  , _background_requests(
+      _background_requests_per_sec().value_or(1), "cst_background_requests")
   , _cloud_storage_backend{
       cloud_storage_clients::infer_backend_from_configuration(
         conf, cloud_credentials_source)} {
@@ -133,6 +138,12 @@ remote::remote(
         _pool.local().load_credentials(
           _auth_refresh_bg_op.build_static_credentials());
     });
+
+    _background_requests_per_sec.watch([this] {
+        if (const auto rate = _background_requests_per_sec(); rate) {
+            _background_requests.update_rate(*rate);
+        }
+    });
 }
 
 remote::remote(
@@ -163,6 +174,7 @@ ss::future<> remote::start() {
 ss::future<> remote::stop() {
     cst_log.debug("Stopping remote...");
     _as.request_abort();
+    _background_requests.shutdown();
     co_await _materialized->stop();
     co_await _gate.close();
     co_await _auth_refresh_bg_op.stop();
@@ -171,6 +183,8 @@ ss::future<> remote::stop() {
 
 size_t remote::concurrency() const { return _pool.local().max_size(); }
 
+size_t remote::available_concurrency() const { return _pool.local().size(); }
+
 model::cloud_storage_backend remote::backend() const {
     return _cloud_storage_backend;
 }
@@ -241,7 +255,7 @@ ss::future<download_result> remote::do_download_manifest(
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
     auto path = cloud_storage_clients::object_key(format_key.second().native());
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto retry_permit = fib.retry();
     std::optional<download_result> result;
     vlog(ctxlog.debug, "Download manifest {}", format_key.second());
@@ -347,7 +361,7 @@ ss::future<upload_result> remote::upload_manifest(
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
     auto path = cloud_storage_clients::object_key(key());
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto permit = fib.retry();
     vlog(ctxlog.debug, "Uploading manifest {} to the {}", path, bucket());
     std::optional<upload_result> result;
@@ -433,6 +447,24 @@ ss::future<upload_result> remote::upload_manifest(
     co_return *result;
 }
 
+void remote::add_background_source(const retry_chain_node* source) {
+    _background_sources.insert(source);
+}
+
+void remote::remove_background_source(const retry_chain_node* source) {
+    _background_sources.erase(source);
+}
+
+ss::future<cloud_storage_clients::client_pool::client_lease>
+remote::acquire_client(retry_chain_node& caller) {
+    if (
+      _background_requests_per_sec().has_value()
+      && _background_sources.contains(caller.get_root())) {
+        co_await _background_requests.throttle(1, caller.root_abort_source());
+    }
+    co_return co_await _pool.local().acquire(caller.root_abort_source());
+}
+
 void remote::notify_external_subscribers(
   api_activity_notification event, const retry_chain_node& caller) {
     const auto* caller_root = caller.get_root();
@@ -522,7 +554,7 @@ ss::future<upload_result> remote::upload_stream(
         if (max_retries.has_value()) {
             max_retries = max_retries.value() - 1;
         }
-        auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+        auto lease = co_await acquire_client(fib);
         notify_external_subscribers(
           api_activity_notification{
             .type = event_type, .is_retry = fib.retry_count() > 1},
@@ -621,6 +653,20 @@ ss::future<upload_result> remote::upload_segment(
   retry_chain_node& parent,
   lazy_abort_source& lazy_abort_source,
   std::optional<size_t> max_retries) {
+    // A bounded number of retries is asked for by the callers which retry
+    // the whole upload themselves, they keep using a single request.
+    if (const auto threshold
+        = config::shard_local_cfg().cloud_storage_multipart_upload_threshold();
+        threshold.has_value() && content_length >= *threshold
+        && !max_retries.has_value()) {
+        return upload_segment_in_parts(
+          bucket,
+          segment_path,
+          content_length,
+          reset_str,
+          parent,
+          lazy_abort_source);
+    }
     return upload_stream(
       bucket,
       segment_path,
@@ -636,6 +682,241 @@ ss::future<upload_result> remote::upload_segment(
       max_retries);
 }
 
+template<typename T>
+ss::future<result<T, upload_result>> remote::retry_multipart_op(
+  std::string_view op_name,
+  const cloud_storage_clients::object_key& key,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source,
+  multipart_op<T> op) {
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        auto lease = co_await acquire_client(fib);
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled {} of {}",
+              lazy_abort_source.abort_reason(),
+              op_name,
+              key);
+            co_return upload_result::cancelled;
+        }
+
+        auto res = co_await op(*lease.client, fib.get_timeout());
+        if (res) {
+            co_return std::move(res.value());
+        }
+
+        lease.client->shutdown();
+        if (res.error() != cloud_storage_clients::error_outcome::retry) {
+            vlog(ctxlog.warn, "Failed to {} of {}", op_name, key);
+            co_return upload_result::failed;
+        }
+        vlog(
+          ctxlog.debug,
+          "{} of {}, {} backoff required",
+          op_name,
+          key,
+          std::chrono::duration_cast<std::chrono::milliseconds>(permit.delay));
+        _probe.upload_backoff();
+        if (!lazy_abort_source.abort_requested()) {
+            co_await ss::sleep_abortable(permit.delay, fib.root_abort_source());
+        }
+        permit = fib.retry();
+    }
+    vlog(ctxlog.warn, "{} of {}, backoff quota exceded", op_name, key);
+    co_return upload_result::timedout;
+}
+
+ss::future<result<ss::sstring, upload_result>> remote::upload_part(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  iobuf part,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    const auto size = part.size_bytes();
+    co_return co_await retry_multipart_op<ss::sstring>(
+      "upload part",
+      key,
+      parent,
+      lazy_abort_source,
+      [&](
+        cloud_storage_clients::client& client,
+        ss::lowres_clock::duration timeout) {
+          return client.upload_part(
+            bucket,
+            key,
+            upload_id,
+            part_number,
+            size,
+            make_iobuf_input_stream(part.share(0, size)),
+            timeout);
+      });
+}
+
+ss::future<upload_result> remote::upload_segment_in_parts(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  uint64_t content_length,
+  const reset_input_stream& reset_str,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    using no_response = cloud_storage_clients::client::no_response;
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    const auto key = cloud_storage_clients::object_key(segment_path());
+    const size_t part_size
+      = config::shard_local_cfg().cloud_storage_multipart_upload_part_size();
+    const size_t num_parts = (content_length + part_size - 1) / part_size;
+    // Every part in flight needs its own connection, only the idle ones are
+    // used so that the upload doesn't hold back other requests.
+    const size_t concurrency = std::max<size_t>(
+      1,
+      std::min<size_t>(
+        config::shard_local_cfg().cloud_storage_multipart_upload_concurrency(),
+        available_concurrency()));
+    vlog(
+      ctxlog.debug,
+      "Uploading segment to path {} in {} parts, length {}",
+      segment_path,
+      num_parts,
+      content_length);
+    notify_external_subscribers(
+      api_activity_notification{
+        .type = api_activity_type::segment_upload, .is_retry = false},
+      parent);
+
+    auto upload_id = co_await retry_multipart_op<ss::sstring>(
+      "create multipart upload",
+      key,
+      fib,
+      lazy_abort_source,
+      [&](
+        cloud_storage_clients::client& client,
+        ss::lowres_clock::duration timeout) {
+          return client.create_multipart_upload(bucket, key, timeout);
+      });
+    if (!upload_id) {
+        _probe.failed_upload();
+        co_return upload_id.error();
+    }
+
+    std::vector<ss::sstring> part_tags(num_parts);
+    std::optional<upload_result> failure;
+    std::exception_ptr read_error;
+    ssx::semaphore parts_in_flight{concurrency, "cst_multipart_upload"};
+    ss::gate parts_gate;
+
+    auto reader_handle = co_await reset_str();
+    auto stream = reader_handle->take_stream();
+    try {
+        for (size_t i = 0; i < num_parts && !failure; ++i) {
+            auto units = co_await ss::get_units(parts_in_flight, 1);
+            if (failure) {
+                // a part failed while this one was waiting for its turn
+                break;
+            }
+            const auto size = std::min<size_t>(
+              part_size, content_length - i * part_size);
+            auto part = co_await read_iobuf_exactly(stream, size);
+            if (part.size_bytes() != size) {
+                vlog(
+                  ctxlog.warn,
+                  "Segment {} is shorter than its length {}",
+                  segment_path,
+                  content_length);
+                failure = upload_result::failed;
+                break;
+            }
+            ssx::spawn_with_gate(
+              parts_gate,
+              [&,
+               i,
+               part = std::move(part),
+               units = std::move(units)]() mutable {
+                  return upload_part(
+                           bucket,
+                           key,
+                           upload_id.value(),
+                           i + 1,
+                           std::move(part),
+                           fib,
+                           lazy_abort_source)
+                    .then([&part_tags, &failure, i, u = std::move(units)](
+                            result<ss::sstring, upload_result> res) {
+                        if (res) {
+                            part_tags[i] = std::move(res.value());
+                        } else if (!failure) {
+                            failure = res.error();
+                        }
+                    })
+                    .handle_exception([&failure](const std::exception_ptr&) {
+                        if (!failure) {
+                            failure = upload_result::failed;
+                        }
+                    });
+              });
+        }
+    } catch (...) {
+        read_error = std::current_exception();
+    }
+    co_await parts_gate.close();
+    // The stream is closed here rather than by the client, we must also call
+    // close() on the segment_reader_handle to release the FD.
+    co_await stream.close();
+    co_await reader_handle->close();
+
+    if (!failure && !read_error) {
+        auto res = co_await retry_multipart_op<no_response>(
+          "complete multipart upload",
+          key,
+          fib,
+          lazy_abort_source,
+          [&](
+            cloud_storage_clients::client& client,
+            ss::lowres_clock::duration timeout) {
+              return client.complete_multipart_upload(
+                bucket, key, upload_id.value(), part_tags, timeout);
+          });
+        if (res) {
+            _probe.successful_upload();
+            _probe.register_upload_size(content_length);
+            co_return upload_result::success;
+        }
+        failure = res.error();
+    }
+
+    // Best effort, the parts which are left behind are not visible and can be
+    // removed by the lifecycle rules of the bucket.
+    co_await retry_multipart_op<no_response>(
+      "abort multipart upload",
+      key,
+      fib,
+      lazy_abort_source,
+      [&](
+        cloud_storage_clients::client& client,
+        ss::lowres_clock::duration timeout) {
+          return client.abort_multipart_upload(
+            bucket, key, upload_id.value(), timeout);
+      });
+    _probe.failed_upload();
+    if (read_error) {
+        std::rethrow_exception(read_error);
+    }
+    vlog(
+      ctxlog.warn,
+      "Uploading segment {} to {}, {}, segment not uploaded",
+      segment_path,
+      bucket,
+      *failure);
+    co_return *failure;
+}
+
 ss::future<download_result> remote::download_stream(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& path,
@@ -703,7 +984,7 @@ ss::future<download_result> remote::download_stream(
 
     auto lease = co_await [this, &fib] {
         auto m = _probe.client_acquisition();
-        return _pool.local().acquire(fib.root_abort_source());
+        return acquire_client(fib);
     }();
 
     auto permit = fib.retry();
@@ -828,7 +1109,7 @@ remote::download_object(cloud_storage::download_request download_request) {
     const auto bucket = transfer_details.bucket;
     const auto object_type = download_request.type;
 
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
 
     auto permit = fib.retry();
     vlog(ctxlog.debug, "Downloading {} from {}", object_type, path);
@@ -910,7 +1191,7 @@ ss::future<download_result> remote::object_exists(
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto permit = fib.retry();
     vlog(ctxlog.debug, "Check {} {}", object_type, path);
     std::optional<download_result> result;
@@ -990,7 +1271,7 @@ ss::future<upload_result> remote::delete_object(
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto permit = fib.retry();
     vlog(ctxlog.debug, "Delete object {}", path);
     std::optional<upload_result> result;
@@ -1144,7 +1425,7 @@ ss::future<upload_result> remote::delete_object_batch(
 
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto permit = fib.retry();
     vlog(ctxlog.debug, "Deleting a batch of size {}", keys.size());
     std::optional<upload_result> result;
@@ -1318,7 +1599,7 @@ ss::future<remote::list_result> remote::list_objects(
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto lease = co_await acquire_client(fib);
     auto permit = fib.retry();
     vlog(ctxlog.debug, "List objects {}", bucket);
     std::optional<list_result> result;
@@ -1441,7 +1722,7 @@ ss::future<upload_result> remote::upload_object(upload_request upload_request) {
 
     std::optional<upload_result> result;
     while (!_gate.is_closed() && permit.is_allowed && !result) {
-        auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+        auto lease = co_await acquire_client(fib);
 
         vlog(
           ctxlog.debug,
@@ -25,6 +25,7 @@
 #include "model/metadata.h"
 #include "random/simple_time_jitter.h"
 #include "utils/retry_chain_node.h"
+#include "utils/token_bucket.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
@@ -227,6 +228,10 @@ public:
     /// can perform.
     size_t concurrency() const;
 
+    /// Return number of requests that can start right away, without waiting
+    /// for a connection.
+    size_t available_concurrency() const;
+
     model::cloud_storage_backend backend() const;
 
     bool is_batch_delete_supported() const;
@@ -523,6 +528,14 @@ public:
     ///         API operation.
     ss::future<api_activity_notification> subscribe(event_filter& filter);
 
+    /// Mark the requests of a background subsystem (e.g. housekeeping jobs)
+    /// so that they are limited by cloud_storage_background_requests_per_sec
+    /// and can't starve the uploads and downloads of the data path.
+    ///
+    /// \param source is the root retry_chain_node of the subsystem
+    void add_background_source(const retry_chain_node* source);
+    void remove_background_source(const retry_chain_node* source);
+
     // If you need to spawn a background task that relies on
     // this object staying alive, spawn it with this gate.
     seastar::gate& gate() { return _gate; };
@@ -547,6 +560,42 @@ private:
       UploadBackoffMetricFn upload_backoff_metric,
       std::optional<size_t> max_retries);
 
+    /// Upload a segment as a multipart upload. The parts are read from the
+    /// stream in order and up to cloud_storage_multipart_upload_concurrency
+    /// of them are uploaded at the same time, each one retried on its own.
+    ss::future<upload_result> upload_segment_in_parts(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      uint64_t content_length,
+      const reset_input_stream& reset_str,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    /// Upload one part of a multipart upload
+    ss::future<result<ss::sstring, upload_result>> upload_part(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      iobuf part,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    template<typename T>
+    using multipart_op = ss::noncopyable_function<
+      ss::future<result<T, cloud_storage_clients::error_outcome>>(
+        cloud_storage_clients::client&, ss::lowres_clock::duration)>;
+
+    /// Run a request of a multipart upload with a client from the pool,
+    /// retrying it while the errors are retryable.
+    template<typename T>
+    ss::future<result<T, upload_result>> retry_multipart_op(
+      std::string_view op_name,
+      const cloud_storage_clients::object_key& key,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source,
+      multipart_op<T> op);
+
     template<
       typename DownloadLatencyMeasurementFn,
       typename FailedDownloadMetricFn,
@@ -588,6 +637,11 @@ private:
     void notify_external_subscribers(
       api_activity_notification, const retry_chain_node& caller);
 
+    /// Acquire a client from the pool, the requests of the background
+    /// sources are throttled first.
+    ss::future<cloud_storage_clients::client_pool::client_lease>
+    acquire_client(retry_chain_node& caller);
+
     ss::sharded<cloud_storage_clients::client_pool>& _pool;
     ss::gate _gate;
     ss::abort_source _as;
@@ -601,6 +655,10 @@ private:
 
     config::binding<std::optional<ss::sstring>> _azure_shared_key_binding;
 
+    absl::node_hash_set<const retry_chain_node*> _background_sources;
+    config::binding<std::optional<size_t>> _background_requests_per_sec;
+    token_bucket<> _background_requests;
+
     model::cloud_storage_backend _cloud_storage_backend;
 };
 
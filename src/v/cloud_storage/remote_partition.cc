@@ -58,6 +58,10 @@ namespace cloud_storage {
 using data_t = model::record_batch_reader::data_t;
 using storage_t = model::record_batch_reader::storage_t;
 
+/// Prefetches are scheduled no further ahead than this, the read rate of
+/// slow consumers is too noisy to plan further
+static constexpr ss::lowres_clock::duration max_prefetch_lookahead = 60s;
+
 remote_partition::iterator remote_partition::get_or_materialize_segment(
   const remote_segment_path& path,
   const segment_meta& meta,
@@ -98,6 +102,21 @@ remote_partition::iterator remote_partition::get_or_materialize_segment(
     return new_iter;
 }
 
+ss::future<> remote_partition::prefetch_segment(
+  segment_meta meta, remote_segment_path path) {
+    auto g = _gate.hold();
+    auto units = co_await materialized().get_segment_units(_as);
+    if (auto it = _segments.find(meta.base_offset);
+        it != _segments.end()
+        && it->second->segment->get_segment_path() != path) {
+        // the segment was replaced since the prefetch was scheduled
+        co_return;
+    }
+    auto segment = get_or_materialize_segment(path, meta, std::move(units))
+                     ->second->segment;
+    co_await segment->prefetch_first_chunk();
+}
+
 remote_partition::borrow_result_t remote_partition::borrow_next_segment_reader(
   const partition_manifest& manifest,
   storage::log_reader_config config,
@@ -317,6 +336,19 @@ public:
                   std::current_exception());
             }
         }
+        if (_view_cursor && _resume_offset.has_value()) {
+            try {
+                _partition->park_cursor(
+                  *_resume_offset, std::move(_view_cursor));
+            } catch (...) {
+                // The cursor is only an optimization for the next reader
+                vlog(
+                  _ctxlog.debug,
+                  "partition_record_batch_reader_impl::~ exception while "
+                  "parking cursor: {}",
+                  std::current_exception());
+            }
+        }
     }
     partition_record_batch_reader_impl(
       partition_record_batch_reader_impl&& o) noexcept
@@ -462,11 +494,14 @@ public:
                     throw std::system_error(result.error());
                 }
                 data_t d = std::move(result.value());
+                size_t bytes_read = 0;
                 for (const auto& batch : d) {
                     _partition->_probe.add_bytes_read(
                       batch.header().size_bytes);
                     _partition->_probe.add_records_read(batch.record_count());
+                    bytes_read += batch.header().size_bytes;
                 }
+                maybe_schedule_prefetch(bytes_read);
                 if (_first_produced_offset == model::offset{} && !d.empty()) {
                     _first_produced_offset = d.front().base_offset();
                 } else {
@@ -542,13 +577,97 @@ public:
     }
 
 private:
+    /// Asks for the first chunk of the next segment to be hydrated ahead of
+    /// the consumer, once per segment of the partition. The consumer needs it
+    /// once it read the rest of the current segment, estimated from its
+    /// position in the segment and the read rate of the partition.
+    void maybe_schedule_prefetch(size_t bytes_read) {
+        _partition->_read_velocity.record(bytes_read);
+        auto& scheduler = _partition->materialized().get_prefetch_scheduler();
+        if (
+          !scheduler.enabled() || !_seg_reader
+          || _next_segment_base_offset == model::offset{}
+          || _partition->_prefetched_segment >= _next_segment_base_offset) {
+            return;
+        }
+        auto manifest = _view_cursor->manifest();
+        if (!manifest.has_value()) {
+            return;
+        }
+        auto current = manifest->find(_seg_reader->base_rp_offset());
+        auto next = manifest->find(_next_segment_base_offset);
+        if (current == manifest->end() || next == manifest->end()) {
+            return;
+        }
+        _partition->_prefetched_segment = _next_segment_base_offset;
+
+        const auto offsets = static_cast<double>(
+          current->committed_offset() - current->base_offset() + 1);
+        const auto offsets_left = static_cast<double>(std::max<int64_t>(
+          current->committed_offset() - _seg_reader->current_rp_offset()(),
+          0));
+        const auto bytes_left = static_cast<double>(current->size_bytes)
+                                * offsets_left / offsets;
+        const auto rate = _partition->_read_velocity.bytes_per_sec();
+        const auto time_left
+          = rate > 0 ? std::chrono::duration_cast<ss::lowres_clock::duration>(
+              std::chrono::duration<double>(bytes_left / rate))
+                     : max_prefetch_lookahead;
+        const auto bytes = std::min<size_t>(
+          next->size_bytes,
+          config::shard_local_cfg().cloud_storage_cache_chunk_size());
+        vlog(
+          _ctxlog.debug,
+          "Scheduling prefetch of segment {}, needed in {}ms",
+          _next_segment_base_offset,
+          std::chrono::duration_cast<std::chrono::milliseconds>(time_left)
+            .count());
+        scheduler.schedule(
+          bytes,
+          ss::lowres_clock::now() + std::min(time_left, max_prefetch_lookahead),
+          [partition = _partition->weak_from_this(),
+           meta = *next,
+           path = manifest->generate_segment_path(
+             *next, _partition->_manifest_view->path_provider())]() mutable {
+              if (!partition) {
+                  return ss::now();
+              }
+              return partition->prefetch_segment(meta, std::move(path));
+          });
+    }
+
     /// Return or evict currently referenced reader
     void dispose_current_reader() {
         if (_seg_reader) {
+            // The reader stops before the end of the segment, the next reader
+            // will most likely resume from there
+            _resume_offset = model::offset_cast(
+              _seg_reader->config().start_offset);
             _partition->return_segment_reader(std::move(_seg_reader));
         }
     }
 
+    /// Use the cursor parked by a previous reader that stopped at `offset`,
+    /// if it still points at a manifest that contains the offset
+    ss::future<bool> try_reuse_parked_cursor(kafka::offset offset) {
+        auto cursor = _partition->take_parked_cursor(offset);
+        if (!cursor) {
+            co_return false;
+        }
+        auto res = co_await cursor->seek(offset);
+        if (res.has_failure() || !res.value()) {
+            vlog(
+              _ctxlog.debug,
+              "parked cursor can't be used for offset {}, status: {}",
+              offset,
+              cursor->get_status());
+            co_return false;
+        }
+        vlog(_ctxlog.debug, "reusing parked cursor for offset {}", offset);
+        _view_cursor = std::move(cursor);
+        co_return true;
+    }
+
     ss::future<> init_cursor(storage::log_reader_config config) {
         auto segment_unit = co_await _partition->materialized()
                               .get_segment_units(config.abort_source);
@@ -556,6 +675,15 @@ private:
           = co_await _partition->materialized().get_segment_reader_units(
             config.abort_source);
 
+        if (
+          !config.first_timestamp.has_value()
+          && co_await try_reuse_parked_cursor(
+            model::offset_cast(config.start_offset))) {
+            co_await initialize_from_cursor(
+              config, std::move(segment_unit), std::move(segment_reader_unit));
+            co_return;
+        }
+
         async_view_search_query_t query;
         if (config.first_timestamp.has_value()) {
             query = async_view_timestamp_query(
@@ -642,6 +770,14 @@ private:
               query));
         }
         _view_cursor = std::move(cur.value());
+        co_await initialize_from_cursor(
+          config, std::move(segment_unit), std::move(segment_reader_unit));
+    }
+
+    ss::future<> initialize_from_cursor(
+      storage::log_reader_config config,
+      segment_units segment_unit,
+      segment_reader_units segment_reader_unit) {
         co_await _view_cursor->with_manifest(
           [this,
            config,
@@ -654,7 +790,6 @@ private:
                 std::move(segment_unit),
                 std::move(segment_reader_unit));
           });
-        co_return;
     }
 
     // Initialize object using remote_partition as a source
@@ -912,6 +1047,9 @@ private:
     /// Guard for the partition gate
     ss::gate::holder _gate_guard;
     model::offset _next_segment_base_offset{};
+    /// Offset the reader stopped at before the end of its segment, the cursor
+    /// is parked for the reader that resumes from there
+    std::optional<kafka::offset> _resume_offset;
     /// Contains offset of the first produced record batch or min()
     /// if no data were produced yet
     model::offset _first_produced_offset{};
@@ -1161,6 +1299,7 @@ ss::future<> remote_partition::stop() {
     _has_evictions_cvar.broken();
 
     co_await _gate.close();
+    _parked_cursors.clear();
     // Remove materialized_segment_state from the list that contains it, to
     // avoid it getting registered for eviction and stop.
     for (auto& pair : _segments) {
@@ -1221,6 +1360,53 @@ size_t remote_partition::reader_mem_use_estimate() noexcept {
            + sizeof(partition_record_batch_reader_impl);
 }
 
+size_t remote_partition::parked_cursor_mem_use_estimate() noexcept {
+    return sizeof(parked_cursor) + sizeof(async_manifest_view_cursor);
+}
+
+void remote_partition::park_cursor(
+  kafka::offset next_offset,
+  std::unique_ptr<async_manifest_view_cursor> cursor) {
+    switch (cursor->get_status()) {
+    case async_manifest_view_cursor_status::empty:
+    case async_manifest_view_cursor_status::evicted:
+        return;
+    case async_manifest_view_cursor_status::materialized_stm:
+    case async_manifest_view_cursor_status::materialized_spillover:
+        break;
+    }
+    if (_gate.is_closed()) {
+        return;
+    }
+    auto units = materialized().try_get_parked_cursor_units();
+    if (!units.has_value()) {
+        // Don't wait for memory that is needed by the readers
+        return;
+    }
+    if (_parked_cursors.size() >= max_parked_cursors) {
+        _parked_cursors.pop_front();
+    }
+    _parked_cursors.push_back(parked_cursor{
+      .next_offset = next_offset,
+      .cursor = std::move(cursor),
+      .units = std::move(*units),
+    });
+}
+
+std::unique_ptr<async_manifest_view_cursor>
+remote_partition::take_parked_cursor(kafka::offset offset) {
+    auto it = std::find_if(
+      _parked_cursors.begin(),
+      _parked_cursors.end(),
+      [offset](const parked_cursor& p) { return p.next_offset == offset; });
+    if (it == _parked_cursors.end()) {
+        return nullptr;
+    }
+    auto cursor = std::move(it->cursor);
+    _parked_cursors.erase(it);
+    return cursor;
+}
+
 ss::future<storage::translating_reader> remote_partition::make_reader(
   storage::log_reader_config config,
   std::optional<model::timeout_clock::time_point> deadline) {
@@ -10,14 +10,17 @@
 
 #pragma once
 
+#include "cloud_storage/async_manifest_view.h"
 #include "cloud_storage/fwd.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/prefetch_scheduler.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/segment_state.h"
 #include "cloud_storage/types.h"
 #include "model/fundamental.h"
+#include "ssx/semaphore.h"
 #include "storage/translating_reader.h"
 #include "storage/types.h"
 #include "utils/retry_chain_node.h"
@@ -82,6 +85,7 @@ public:
       std::optional<model::timeout_clock::time_point> deadline = std::nullopt);
 
     static size_t reader_mem_use_estimate() noexcept;
+    static size_t parked_cursor_mem_use_estimate() noexcept;
 
     /// Look up offset from timestamp
     ss::future<std::optional<storage::timequery_result>>
@@ -208,6 +212,20 @@ private:
     iterator get_or_materialize_segment(
       const remote_segment_path& path, const segment_meta&, segment_units);
 
+    /// Materialize the segment if needed and hydrate its first chunk, run by
+    /// the prefetch scheduler ahead of a reader
+    ss::future<> prefetch_segment(segment_meta, remote_segment_path);
+
+    /// Keep the manifest cursor of a reader that stopped before the end of its
+    /// segment, for the next reader that starts at `next_offset`. The cursor
+    /// is dropped if there is no memory for it.
+    void park_cursor(
+      kafka::offset next_offset, std::unique_ptr<async_manifest_view_cursor>);
+
+    /// Take the cursor parked by a reader that stopped at `offset`, if any
+    std::unique_ptr<async_manifest_view_cursor>
+    take_parked_cursor(kafka::offset offset);
+
     model::ntp _ntp;
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
@@ -249,6 +267,24 @@ private:
     segment_map_t _segments;
     partition_probe& _probe;
     ts_read_path_probe& _ts_probe;
+    /// Read rate of the consumers of the partition, used to prioritize their
+    /// prefetches
+    read_velocity _read_velocity;
+    /// Base offset of the last segment a reader asked to prefetch
+    model::offset _prefetched_segment;
+
+    /// Manifest cursor of a reader, parked until the next reader of the
+    /// partition starts at the offset the reader stopped at. Consumers doing
+    /// many small fetches resume where the previous fetch stopped, and reuse
+    /// the cursor instead of looking up the manifest again.
+    struct parked_cursor {
+        kafka::offset next_offset;
+        std::unique_ptr<async_manifest_view_cursor> cursor;
+        /// Memory units taken from materialized_resources
+        ssx::semaphore_units units;
+    };
+    static constexpr size_t max_parked_cursors = 4;
+    std::deque<parked_cursor> _parked_cursors;
 };
 
 } // namespace cloud_storage
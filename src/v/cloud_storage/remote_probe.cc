@@ -264,6 +264,30 @@ remote_probe::remote_probe(
                               "currently cached in memory"),
               {})
               .aggregate({sm::shard_label}),
+            sm::make_counter(
+              "spillover_manifest_cache_hits_total",
+              [&ms] { return ms.get_materialized_manifest_cache().hits(); },
+              sm::description(
+                "Lookups of spilled manifests served from memory"),
+              {})
+              .aggregate({sm::shard_label}),
+            sm::make_counter(
+              "spillover_manifest_cache_misses_total",
+              [&ms] { return ms.get_materialized_manifest_cache().misses(); },
+              sm::description(
+                "Lookups of spilled manifests not found in memory"),
+              {})
+              .aggregate({sm::shard_label}),
+            sm::make_counter(
+              "spillover_manifest_cache_ghost_hits_total",
+              [&ms] {
+                  return ms.get_materialized_manifest_cache().ghost_hits();
+              },
+              sm::description(
+                "Lookups of spilled manifests that missed but would have been "
+                "served by a cache twice as large"),
+              {})
+              .aggregate({sm::shard_label}),
           });
     }
 }
@@ -15,6 +15,7 @@
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/download_exception.h"
 #include "cloud_storage/logger.h"
+#include "cloud_storage/materialized_resources.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/segment_chunk_data_source.h"
@@ -253,7 +254,8 @@ remote_segment::offset_data_stream(
   kafka::offset end,
   std::optional<model::timestamp> first_timestamp,
   ss::io_priority_class io_priority,
-  storage::opt_abort_source_t as) {
+  storage::opt_abort_source_t as,
+  size_t max_bytes) {
     vlog(_ctxlog.debug, "remote segment file input stream at offset {}", start);
     ss::gate::holder g(_gate);
 
@@ -301,31 +303,76 @@ remote_segment::offset_data_stream(
         data_stream = ss::make_file_input_stream(
           _data_file, pos.file_pos, std::move(options));
     } else {
-        auto chunk_ds = std::make_unique<chunk_data_source_impl>(
-          _chunks_api.value(),
-          *this,
-          pos.kaf_offset,
-          end,
-          pos.file_pos,
-          std::move(options),
-          prefetch_override);
-        data_stream = ss::input_stream<char>{
-          ss::data_source{std::move(chunk_ds)}};
+        const auto memory_read_max_bytes
+          = config::shard_local_cfg().cloud_storage_memory_read_max_bytes();
+        iobuf prefix;
+        if (memory_read_max_bytes > 0 && max_bytes <= memory_read_max_bytes) {
+            prefix = co_await read_range_into_memory(
+              pos, memory_read_max_bytes);
+        }
+        auto make_chunk_ds = [this,
+                              start = pos.kaf_offset,
+                              end,
+                              begin = pos.file_pos
+                                      + static_cast<int64_t>(
+                                        prefix.size_bytes()),
+                              options = std::move(options),
+                              prefetch_override]() mutable {
+            return std::make_unique<chunk_data_source_impl>(
+              _chunks_api.value(),
+              *this,
+              start,
+              end,
+              begin,
+              std::move(options),
+              prefetch_override);
+        };
+        if (prefix.empty()) {
+            data_stream = ss::input_stream<char>{
+              ss::data_source{make_chunk_ds()}};
+        } else {
+            // the chunks are only registered with if the consumer reads past
+            // the range in memory
+            data_stream = ss::input_stream<char>{
+              ss::data_source{std::make_unique<memory_data_source_impl>(
+                std::move(prefix), std::move(make_chunk_ds))}};
+        }
     }
 
     co_return input_stream_with_offsets{
       .stream = std::move(data_stream),
       .rp_offset = pos.rp_offset,
       .kafka_offset = pos.kaf_offset,
+      .file_pos = pos.file_pos,
     };
 }
 
 std::optional<offset_index::find_result>
 remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
-    if (!_index) {
-        return {};
+    // The closest position a previous reader stopped at, readers usually
+    // continue exactly where the last one stopped.
+    std::optional<offset_index::find_result> checkpoint;
+    if (auto it = _checkpoints.upper_bound(kafka_offset);
+        it != _checkpoints.begin()) {
+        checkpoint = std::prev(it)->second;
+    }
+    if (checkpoint && checkpoint->kaf_offset == kafka_offset) {
+        vlog(
+          _ctxlog.debug,
+          "Using checkpoint to locate Kafka offset {}, rp-offset: {}, "
+          "file-pos: {}",
+          kafka_offset,
+          checkpoint->rp_offset,
+          checkpoint->file_pos);
+        return checkpoint;
+    }
+    std::optional<offset_index::find_result> pos;
+    if (_index) {
+        pos = _index->find_kaf_offset(kafka_offset);
+    }
+    if (checkpoint && (!pos || pos->kaf_offset < checkpoint->kaf_offset)) {
+        pos = checkpoint;
     }
-    auto pos = _index->find_kaf_offset(kafka_offset);
     if (!pos) {
         return {};
     }
@@ -348,9 +395,22 @@ size_t remote_segment::estimate_memory_use() const {
     if (_index) {
         res += _index->estimate_memory_use();
     }
+    res += _checkpoints.size() * sizeof(offset_index::find_result);
     return res;
 }
 
+void remote_segment::add_checkpoint(offset_index::find_result pos) {
+    if (
+      pos.kaf_offset < _base_rp_offset - _base_offset_delta
+      || pos.rp_offset > _max_rp_offset) {
+        return;
+    }
+    _checkpoints.insert_or_assign(pos.kaf_offset, pos);
+    if (_checkpoints.size() > max_checkpoints) {
+        _checkpoints.erase(_checkpoints.begin());
+    }
+}
+
 std::optional<offset_index::find_result>
 remote_segment::maybe_get_offsets(model::timestamp ts) {
     if (!_index) {
@@ -530,6 +590,21 @@ ss::future<> remote_segment::do_hydrate_index() {
     });
 }
 
+ss::future<> remote_segment::do_hydrate_index_and_chunk() {
+    auto [index, chunk] = co_await ss::when_all(
+      do_hydrate_index(), hydrate_chunk(0));
+    if (chunk.failed()) {
+        // The chunk will be hydrated on demand once the index is available
+        vlog(
+          _ctxlog.debug,
+          "Failed to hydrate the chunk alongside the index: {}",
+          chunk.get_exception());
+    }
+    if (index.failed()) {
+        std::rethrow_exception(index.get_exception());
+    }
+}
+
 ss::future<> remote_segment::do_hydrate_txrange() {
     ss::gate::holder guard(_gate);
     retry_chain_node local_rtc(
@@ -779,7 +854,10 @@ ss::future<> remote_segment::run_hydrate_bg() {
     if (!is_legacy_mode_engaged()) {
         hydration.add_request(
           generate_index_path(_path),
-          [this] { return do_hydrate_index(); },
+          [this] {
+              return is_single_chunk() ? do_hydrate_index_and_chunk()
+                                       : do_hydrate_index();
+          },
           [this] { return maybe_materialize_index(); },
           hydration_request::kind::index);
     }
@@ -957,6 +1035,76 @@ ss::future<ss::file> remote_segment::hydrate_and_materialize_chunk(
     co_return co_await materialize_chunk(start_offset);
 }
 
+ss::future<iobuf> remote_segment::download_range(
+  uint64_t first, uint64_t last, retry_chain_node& parent) {
+    retry_chain_node rtc{&parent};
+    iobuf data;
+    auto res = co_await _api.download_segment(
+      _bucket,
+      _path,
+      [&data](uint64_t size, ss::input_stream<char> stream) {
+          return ss::do_with(
+            std::move(stream), [&data, size](ss::input_stream<char>& stream) {
+                return read_iobuf_exactly(stream, size)
+                  .then([&data, &stream](iobuf buf) {
+                      data = std::move(buf);
+                      return stream.close();
+                  })
+                  .then([size] { return size; });
+            });
+      },
+      rtc,
+      std::make_pair(first, last));
+    if (res != download_result::success) {
+        throw download_exception{res, _path};
+    }
+    co_return data;
+}
+
+ss::future<iobuf> remote_segment::read_range_into_memory(
+  offset_index::find_result pos, size_t max_bytes) {
+    auto& range_cache = _api.materialized().get_segment_range_cache();
+    if (auto cached = range_cache.get(_path, pos.file_pos); cached) {
+        vlog(_ctxlog.trace, "Range at {} served from memory", pos.file_pos);
+        co_return std::move(*cached);
+    }
+
+    // The range doesn't cross the end of the chunk of the position, the chunk
+    // data source reading anything past it starts within the same chunk.
+    const auto chunk_start = get_chunk_start_for_kafka_offset(pos.kaf_offset);
+    const auto chunk_last
+      = _chunks_api->get_byte_range_for_chunk(chunk_start, _size - 1).second;
+    const auto first = static_cast<uint64_t>(pos.file_pos);
+    const auto last = std::min<uint64_t>(chunk_last, first + max_bytes - 1);
+    if (first > last) {
+        co_return iobuf{};
+    }
+
+    retry_chain_node rtc{
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc};
+    iobuf data;
+    try {
+        data = co_await download_range(first, last, rtc);
+    } catch (const download_exception& ex) {
+        vlog(
+          _ctxlog.debug,
+          "Failed to download range [{}, {}] into memory: {}, reading from "
+          "chunks",
+          first,
+          last,
+          ex);
+        co_return iobuf{};
+    }
+    vlog(
+      _ctxlog.debug,
+      "Downloaded range [{}, {}] into memory, {} bytes",
+      first,
+      last,
+      data.size_bytes());
+    range_cache.put(_path, pos.file_pos, data.share(0, data.size_bytes()));
+    co_return data;
+}
+
 ss::future<ss::file>
 remote_segment::download_chunk(chunk_start_offset_t chunk_start) {
     auto g = _gate.hold();
@@ -968,6 +1116,9 @@ remote_segment::download_chunk(chunk_start_offset_t chunk_start) {
 }
 
 namespace {
+// chunks are split in parts of at least this size when downloaded in parallel
+constexpr size_t min_chunk_download_part_size = 4_MiB;
+
 void log_hydration_abort_cause(
   const retry_chain_logger& logger,
   const ss::lowres_clock::time_point& deadline,
@@ -1073,11 +1224,20 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
         co_return;
     }
 
+    co_await _cache.download_once(path_to_start, [this, start_offset] {
+        return download_chunk_into_cache(start_offset);
+    });
+}
+
+ss::future<>
+remote_segment::download_chunk_into_cache(chunk_start_offset_t start_offset) {
     retry_chain_node rtc{
       cache_hydration_timeout, cache_hydration_backoff, &_rtc};
 
-    auto byte_range = _chunks_api->get_byte_range_for_chunk(
-      start_offset, _size - 1);
+    auto byte_range = is_single_chunk()
+                        ? std::make_pair(size_t{0}, _size - 1)
+                        : _chunks_api->get_byte_range_for_chunk(
+                          start_offset, _size - 1);
 
     const auto space_required = byte_range.second - byte_range.first + 1;
     auto reserved = co_await _cache.reserve_space(space_required, 1);
@@ -1085,6 +1245,20 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
     auto measurement = _ts_probe.chunk_hydration_latency();
     track_hydration t{_ts_probe};
 
+    const auto parts = chunk_download_parts(space_required);
+    if (parts > 1) {
+        try {
+            co_await hydrate_chunk_in_parts(
+              reserved, start_offset, byte_range, parts, rtc);
+        } catch (...) {
+            measurement->cancel();
+            throw;
+        }
+        _probe.chunk_size(space_required);
+        _ts_probe.on_chunks_hydration(1);
+        co_return;
+    }
+
     auto res = co_await _api.download_segment(
       _bucket,
       _path,
@@ -1105,6 +1279,78 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
     _ts_probe.on_chunks_hydration(1);
 }
 
+size_t remote_segment::chunk_download_parts(size_t chunk_size) const {
+    const size_t max_parts
+      = config::shard_local_cfg().cloud_storage_chunk_hydration_max_parts();
+    if (max_parts <= 1) {
+        return 1;
+    }
+    // Every part needs its own connection, only the idle ones are used so
+    // that parallel downloads don't hold back other requests.
+    return std::clamp<size_t>(
+      std::min(
+        {max_parts,
+         chunk_size / min_chunk_download_part_size,
+         _api.available_concurrency()}),
+      1,
+      max_parts);
+}
+
+ss::future<> remote_segment::hydrate_chunk_in_parts(
+  space_reservation_guard& reserved,
+  chunk_start_offset_t start_offset,
+  std::pair<size_t, size_t> byte_range,
+  size_t parts,
+  retry_chain_node& rtc) {
+    const auto [first, last] = byte_range;
+    const auto part_size = (last - first + parts) / parts;
+    vlog(
+      _ctxlog.debug,
+      "Hydrating chunk {} [{}, {}] in {} parts",
+      start_offset,
+      first,
+      last,
+      parts);
+
+    std::vector<ss::future<iobuf>> downloads;
+    downloads.reserve(parts);
+    for (auto part_first = first; part_first <= last;
+         part_first += part_size) {
+        downloads.push_back(download_range(
+          part_first, std::min(last, part_first + part_size - 1), rtc));
+    }
+    auto results = co_await ss::when_all(downloads.begin(), downloads.end());
+
+    iobuf data;
+    std::exception_ptr err;
+    for (auto& result : results) {
+        if (result.failed()) {
+            err = result.get_exception();
+        } else if (!err) {
+            data.append(result.get());
+        }
+    }
+    if (err) {
+        std::rethrow_exception(err);
+    }
+    co_await put_chunk_in_cache(
+      reserved, make_iobuf_input_stream(std::move(data)), start_offset);
+}
+
+ss::future<> remote_segment::prefetch_first_chunk() {
+    auto g = _gate.hold();
+    if (is_legacy_mode_engaged()) {
+        co_return;
+    }
+    co_await hydrate();
+    if (is_legacy_mode_engaged()) {
+        // the index couldn't be hydrated, the segment was hydrated instead
+        co_return;
+    }
+    vlog(_ctxlog.debug, "Prefetching first chunk of segment {}", _path);
+    co_await _chunks_api->hydrate_chunk(0, 0);
+}
+
 ss::future<ss::file>
 remote_segment::materialize_chunk(chunk_start_offset_t chunk_start) {
     auto res = co_await _cache.get(get_path_to_chunk(chunk_start));
@@ -1329,8 +1575,8 @@ public:
     /// Consume batch start
     void consume_batch_start(
       model::record_batch_header header,
-      size_t /*physical_base_offset*/,
-      size_t /*size_on_disk*/) override {
+      size_t physical_base_offset,
+      size_t size_on_disk) override {
         vlog(
           _ctxlog.trace,
           "[{}] consume_batch_start called for {}",
@@ -1338,13 +1584,14 @@ public:
           header.base_offset);
         _header = header;
         _header.ctx.term = _term;
+        _batch_end = physical_base_offset + size_on_disk;
     }
 
     /// Skip batch (called if accept_batch_start returned 'skip')
     void skip_batch_start(
       model::record_batch_header header,
-      size_t /*physical_base_offset*/,
-      size_t /*size_on_disk*/) override {
+      size_t physical_base_offset,
+      size_t size_on_disk) override {
         // NOTE: that advance_config_start_offset should be called before
         // changing the _cur_delta. The _cur_delta that is be used for current
         // record batch can only account record batches in all previous batches.
@@ -1376,6 +1623,8 @@ public:
             _seg_reader._cur_delta += header.last_offset_delta
                                       + model::offset(1);
         }
+        _seg_reader.set_next_batch_position(
+          physical_base_offset + size_on_disk);
     }
 
     void consume_records(iobuf&& ib) override { _records = std::move(ib); }
@@ -1387,6 +1636,7 @@ public:
 
         _config.bytes_consumed += batch.size_bytes();
         advance_config_offsets(batch.header());
+        _seg_reader.set_next_batch_position(_batch_end);
 
         // NOTE: we need to translate offset of the batch after we updated
         // start offset of the config since it assumes that the header has
@@ -1420,6 +1670,8 @@ private:
     remote_segment_batch_reader& _seg_reader;
     model::record_batch_header _header;
     iobuf _records;
+    /// Position of the end of the current batch in the stream
+    size_t _batch_end{0};
     model::term_id _term;
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
@@ -1512,7 +1764,8 @@ remote_segment_batch_reader::init_parser() {
       model::offset_cast(_config.max_offset),
       _config.first_timestamp,
       priority_manager::local().shadow_indexing_priority(),
-      _config.abort_source);
+      _config.abort_source,
+      _config.max_bytes);
 
     vlog(
       _ctxlog.debug,
@@ -1527,9 +1780,15 @@ remote_segment_batch_reader::init_parser() {
       storage::segment_reader_handle(std::move(stream_off.stream)));
     _cur_rp_offset = stream_off.rp_offset;
     _cur_delta = stream_off.rp_offset - stream_off.kafka_offset;
+    _stream_file_pos = stream_off.file_pos;
     co_return parser;
 }
 
+void remote_segment_batch_reader::set_next_batch_position(size_t stream_pos) {
+    _next_batch_file_pos = _stream_file_pos
+                           + static_cast<int64_t>(stream_pos);
+}
+
 size_t remote_segment_batch_reader::produce(model::record_batch batch) {
     ss::gate::holder h(_gate);
     vlog(_ctxlog.debug, "remote_segment_batch_reader::produce");
@@ -1559,6 +1818,14 @@ ss::future<> remote_segment_batch_reader::stop() {
       "[{}] remote_segment_batch_reader::stop",
       _config.client_address);
     co_await _gate.close();
+    if (_next_batch_file_pos && !is_eof()) {
+        // The next reader of the segment is likely to continue from here
+        _seg->add_checkpoint(offset_index::find_result{
+          .rp_offset = _cur_rp_offset,
+          .kaf_offset = current_kafka_offset(),
+          .file_pos = *_next_batch_file_pos,
+        });
+    }
     if (_parser) {
         vlog(
           _ctxlog.debug,
@@ -1660,7 +1927,8 @@ ss::future<> hydration_loop_state::hydrate(size_t wait_list_size) {
               state.path_kind,
               state.path,
               wait_list_size);
-            fs.push_back(state.hydrate_action());
+            fs.push_back(_cache.download_once(
+              state.path, [&state] { return state.hydrate_action(); }));
             break;
         case cache_element_status::in_progress:
             vassert(false, "{} is already in progress", state.path);
@@ -35,6 +35,8 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
 
+#include <absl/container/btree_map.h>
+
 namespace cloud_storage {
 
 std::filesystem::path
@@ -98,15 +100,22 @@ public:
         ss::input_stream<char> stream;
         model::offset rp_offset;
         kafka::offset kafka_offset;
+        /// Position of the start of the stream in the segment
+        int64_t file_pos{0};
     };
     /// create an input stream _sharing_ the underlying file handle
     /// starting at position @pos
+    ///
+    /// \param max_bytes is the most the consumer of the stream expects to
+    /// read. Small reads download the byte range they start with into memory
+    /// instead of hydrating a chunk, see cloud_storage_memory_read_max_bytes.
     ss::future<input_stream_with_offsets> offset_data_stream(
       kafka::offset start,
       kafka::offset end,
       std::optional<model::timestamp>,
       ss::io_priority_class,
-      storage::opt_abort_source_t as);
+      storage::opt_abort_source_t as,
+      size_t max_bytes = std::numeric_limits<size_t>::max());
 
     /// Hydrates the segment, index or tx-range depending on segment meta
     /// version, returning a future that the caller can use to wait for the
@@ -127,6 +136,11 @@ public:
     /// files are written to cache.
     ss::future<> hydrate_chunk(chunk_start_offset_t start_offset);
 
+    /// Hydrates the index and the first chunk of the segment ahead of a reader.
+    /// Segments read in legacy mode are not prefetched, their first read
+    /// hydrates the whole segment.
+    ss::future<> prefetch_first_chunk();
+
     /// Loads the segment chunk file from cache into an open file handle. If the
     /// file is not present in cache, the returned file handle is unopened.
     ss::future<ss::file> materialize_chunk(chunk_start_offset_t);
@@ -134,6 +148,11 @@ public:
     /// Return memory occupied by the object
     size_t estimate_memory_use() const;
 
+    /// Remember the position of the batch a reader of the segment stopped
+    /// before, so that the next reader starting from there doesn't have to
+    /// search the index or scan the preceding batches.
+    void add_checkpoint(offset_index::find_result);
+
     retry_chain_node* get_retry_chain_node() { return &_rtc; }
 
     bool download_in_progress() const noexcept {
@@ -182,6 +201,8 @@ public:
 
     size_t concurrency() { return _api.concurrency(); }
 
+    ts_read_path_probe& get_read_path_probe() { return _ts_probe; }
+
 private:
     /// get a file offset for the corresponding kafka offset
     /// if the index is available
@@ -227,6 +248,14 @@ private:
 
     ss::future<> do_hydrate_index();
 
+    /// Hydrate the index and, alongside it, the only chunk of a segment which
+    /// fits in a single chunk. The byte range of the chunk doesn't depend on
+    /// the index so the cold read doesn't wait for a second round trip.
+    ss::future<> do_hydrate_index_and_chunk();
+
+    /// True if the whole segment is covered by the chunk at offset 0
+    bool is_single_chunk() const { return _size > 0 && _size <= _chunk_size; }
+
     /// Materilize segment. Segment has to be hydrated beforehand. The
     /// 'materialization' process opens file handle and creates
     /// compressed segment index in memory.
@@ -263,6 +292,36 @@ private:
     ss::future<ss::file>
     hydrate_and_materialize_chunk(chunk_start_offset_t start_offset);
 
+    /// Returns the byte range of the segment starting at the indexed position
+    /// `pos`, at most `max_bytes` long and within the chunk of the position,
+    /// from the shard's range cache or downloaded into memory. Returns an
+    /// empty buffer if the download fails, the read then goes through the
+    /// chunks.
+    ss::future<iobuf>
+    read_range_into_memory(offset_index::find_result pos, size_t max_bytes);
+
+    /// Downloads the inclusive byte range of the segment into memory, throws
+    /// download_exception on failure.
+    ss::future<iobuf>
+    download_range(uint64_t first, uint64_t last, retry_chain_node& parent);
+
+    /// Number of concurrent ranged requests used to download a chunk of the
+    /// given size, see cloud_storage_chunk_hydration_max_parts.
+    size_t chunk_download_parts(size_t chunk_size) const;
+
+    /// Downloads a chunk and stores it in cache. Called by hydrate_chunk
+    /// unless another shard is already downloading the same chunk.
+    ss::future<> download_chunk_into_cache(chunk_start_offset_t start_offset);
+
+    /// Downloads the parts of a chunk concurrently and stores the chunk in
+    /// cache once all parts arrived.
+    ss::future<> hydrate_chunk_in_parts(
+      space_reservation_guard&,
+      chunk_start_offset_t start_offset,
+      std::pair<size_t, size_t> byte_range,
+      size_t parts,
+      retry_chain_node& rtc);
+
     ss::gate _gate;
     remote& _api;
     cache& _cache;
@@ -294,6 +353,11 @@ private:
     ss::file _data_file;
     std::optional<offset_index> _index;
 
+    /// Positions of batches where readers of the segment stopped, by kafka
+    /// offset. Readers move forward, so the lowest offsets are dropped first.
+    static constexpr size_t max_checkpoints = 16;
+    absl::btree_map<kafka::offset, offset_index::find_result> _checkpoints;
+
     using tx_range_vec = fragmented_vector<model::tx_range>;
     std::optional<tx_range_vec> _tx_range;
 
@@ -433,6 +497,10 @@ private:
 
     size_t produce(model::record_batch batch);
 
+    /// Called by the consumer once it went through a batch, with the position
+    /// of the end of the batch in the parser's stream
+    void set_next_batch_position(size_t stream_pos);
+
     ss::lw_shared_ptr<remote_segment> _seg;
     storage::log_reader_config _config;
     partition_probe& _probe;
@@ -448,6 +516,10 @@ private:
     model::offset _cur_rp_offset;
     model::offset_delta _cur_delta;
     size_t _bytes_consumed{0};
+    /// Position of the start of the parser's stream in the segment, and of
+    /// the end of the last batch the parser went through
+    int64_t _stream_file_pos{0};
+    std::optional<int64_t> _next_batch_file_pos;
     ss::gate _gate;
     bool _stopped{false};
     /// Set when EOF is reached earlier than expected
@@ -13,6 +13,7 @@
 #include "cloud_storage/logger.h"
 #include "cloud_storage/remote_segment.h"
 
+#include <algorithm>
 #include <chrono>
 
 using namespace std::chrono_literals;
@@ -130,13 +131,28 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
       "hydrate_chunk for {}, current state: {}",
       chunk_start,
       curr_state);
+    auto n_chunks_to_prefetch = prefetch_override.has_value()
+                                  ? prefetch_override.value()
+                                  : adaptive_prefetch(chunk_start);
+    auto& probe = _segment.get_read_path_probe();
     if (curr_state == chunk_state::hydrated) {
         vassert(
           chunk.handle,
           "chunk state is hydrated without data file for id {}",
           chunk_start);
+        probe.on_chunk_hit();
+        // Keep the prefetch ahead of a sequential reader which is consuming
+        // the chunks prefetched for it.
+        if (
+          !prefetch_override.has_value()
+          && n_chunks_to_prefetch
+               > config::shard_local_cfg().cloud_storage_chunk_prefetch()) {
+            schedule_prefetches(chunk_start, n_chunks_to_prefetch);
+            _bg_cvar.signal();
+        }
         co_return chunk.handle.value();
     }
+    probe.on_chunk_miss();
 
     chunk.current_state = chunk_state::download_in_progress;
 
@@ -151,14 +167,34 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
       chunk_start,
       chunk.waiters.size());
 
-    auto n_chunks_to_prefetch = prefetch_override.value_or(
-      config::shard_local_cfg().cloud_storage_chunk_prefetch);
     schedule_prefetches(chunk_start, n_chunks_to_prefetch);
 
     _bg_cvar.signal();
     co_return co_await std::move(f);
 }
 
+size_t segment_chunks::adaptive_prefetch(chunk_start_offset_t chunk_start) {
+    const size_t configured
+      = config::shard_local_cfg().cloud_storage_chunk_prefetch();
+    const auto last = std::exchange(_last_requested_chunk, chunk_start);
+    if (last == chunk_start) {
+        return _sequential_prefetch;
+    }
+    auto next = _chunks.end();
+    if (last.has_value()) {
+        next = _chunks.upper_bound(*last);
+    }
+    if (next != _chunks.end() && next->first == chunk_start) {
+        _sequential_prefetch = std::clamp(
+          _sequential_prefetch * 2,
+          configured,
+          configured * max_sequential_prefetch_factor);
+    } else {
+        _sequential_prefetch = configured;
+    }
+    return _sequential_prefetch;
+}
+
 void segment_chunks::schedule_prefetches(
   chunk_start_offset_t start_offset, size_t n_chunks_to_prefetch) {
     vassert(
@@ -176,6 +212,7 @@ void segment_chunks::schedule_prefetches(
         }
 
         chunk.current_state = chunk_state::download_in_progress;
+        _segment.get_read_path_probe().on_chunks_prefetch(1);
         ss::promise<cloud_storage::segment_chunk::handle_t> p;
         _prefetches.emplace_back(p.get_future());
         chunk.waiters.push_back(
@@ -106,6 +106,13 @@ private:
     void schedule_prefetches(
       chunk_start_offset_t start_offset, size_t n_chunks_to_prefetch);
 
+    /// Number of chunks to prefetch for a request of the given chunk, when
+    /// the reader doesn't ask for a specific number. Readers going through
+    /// the segment chunk after chunk get up to a few times the configured
+    /// prefetch, so that bulk scans turn into larger sequential downloads,
+    /// while other access patterns stick to the configured prefetch.
+    size_t adaptive_prefetch(chunk_start_offset_t chunk_start);
+
     /// Periodically resolves prefetch futures. Since there is no explicit
     /// waiter for prefetch downloads, potential errors during these downloads
     /// must be consumed to avoid ignored-future warnings. This method inspects
@@ -138,6 +145,15 @@ private:
     retry_chain_logger _ctxlog;
 
     uint64_t _max_hydrated_chunks;
+
+    /// Upper bound of the prefetch of sequential readers, relative to the
+    /// configured prefetch
+    static constexpr size_t max_sequential_prefetch_factor = 4;
+    /// Last chunk requested by a reader and the current prefetch of the
+    /// sequential access pattern, if readers follow it.
+    std::optional<chunk_start_offset_t> _last_requested_chunk;
+    size_t _sequential_prefetch{0};
+
     ss::condition_variable _bg_cvar;
     fragmented_vector<ss::future<segment_chunk::handle_t>> _prefetches;
 };
@@ -157,6 +157,29 @@ ss::future<> chunk_data_source_impl::close() {
     co_await maybe_close_stream();
 }
 
+memory_data_source_impl::memory_data_source_impl(
+  iobuf data, make_next_t make_next)
+  : _data(std::move(data))
+  , _make_next(std::move(make_next)) {}
+
+ss::future<ss::temporary_buffer<char>> memory_data_source_impl::get() {
+    if (_data.begin() != _data.end()) {
+        auto buf = _data.begin()->share();
+        _data.pop_front();
+        co_return buf;
+    }
+    if (!_next) {
+        _next = _make_next();
+    }
+    co_return co_await _next->get();
+}
+
+ss::future<> memory_data_source_impl::close() {
+    if (_next) {
+        co_await _next->close();
+    }
+}
+
 ss::future<> chunk_data_source_impl::maybe_close_stream() {
     if (_current_stream) {
         co_await _current_stream->close();
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "cloud_storage/segment_chunk_api.h"
 #include "model/fundamental.h"
 
@@ -72,4 +73,34 @@ private:
     std::optional<uint16_t> _prefetch_override;
 };
 
+/// Serves the beginning of a read from a byte range of the segment held in
+/// memory. If the consumer reads past the range, the rest of the read is
+/// served by the data source created with `make_next`, which must start where
+/// the range ends. It's only created when needed so that short reads never
+/// register with the chunks of the segment.
+class memory_data_source_impl final : public ss::data_source_impl {
+public:
+    using make_next_t
+      = ss::noncopyable_function<std::unique_ptr<ss::data_source_impl>()>;
+
+    memory_data_source_impl(iobuf data, make_next_t make_next);
+
+    memory_data_source_impl(const memory_data_source_impl&) = delete;
+    memory_data_source_impl& operator=(const memory_data_source_impl&)
+      = delete;
+    memory_data_source_impl(memory_data_source_impl&&) = delete;
+    memory_data_source_impl& operator=(memory_data_source_impl&&) = delete;
+
+    ~memory_data_source_impl() override = default;
+
+    ss::future<ss::temporary_buffer<char>> get() override;
+
+    ss::future<> close() override;
+
+private:
+    iobuf _data;
+    make_next_t _make_next;
+    std::unique_ptr<ss::data_source_impl> _next;
+};
+
 } // namespace cloud_storage
@@ -623,21 +623,40 @@ public:
             _metadata_size_hint, ix, hint));
     }
 
+    /// Hint of the base_offset column to search for `bo` from. It's the
+    /// hint of the closest element lower or equal to `bo`, so the search
+    /// decodes a few rows of the frame instead of the whole frame.
+    std::optional<hint_t> base_offset_search_hint(int64_t bo) const {
+        if (unlikely(
+              config::shard_local_cfg().storage_ignore_cstore_hints.value())) {
+            return std::nullopt;
+        }
+        auto hint_it = _hints.lower_bound(bo);
+        if (hint_it == _hints.end() || hint_it->second == std::nullopt) {
+            return std::nullopt;
+        }
+        return hint_it->second->at(
+          static_cast<size_t>(segment_meta_ix::base_offset));
+    }
+
     /// Search by base_offset
     auto find(int64_t bo) const {
-        auto it = _base_offset.find(bo);
+        auto it = _base_offset.pred_search(
+          bo, std::equal_to<>{}, base_offset_search_hint(bo));
         return materialize(std::move(it));
     }
 
     /// Search by base_offset
     auto lower_bound(int64_t bo) const {
-        auto it = _base_offset.lower_bound(bo);
+        auto it = _base_offset.pred_search(
+          bo, std::greater_equal<>{}, base_offset_search_hint(bo));
         return materialize(std::move(it));
     }
 
     /// Search by base_offset
     auto upper_bound(int64_t bo) const -> iterators_t {
-        auto it = _base_offset.upper_bound(bo);
+        auto it = _base_offset.pred_search(
+          bo, std::greater<>{}, base_offset_search_hint(bo));
         return materialize(std::move(it));
     }
 
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_range_cache.h"
+
+namespace cloud_storage {
+
+segment_range_cache::segment_range_cache(config::binding<size_t> max_bytes)
+  : _max_bytes(std::move(max_bytes)) {
+    _max_bytes.watch([this] { evict(_max_bytes()); });
+}
+
+std::optional<iobuf> segment_range_cache::get(
+  const remote_segment_path& path, int64_t file_pos) {
+    auto it = _index.find(key_t{path().native(), file_pos});
+    if (it == _index.end()) {
+        return std::nullopt;
+    }
+    _lru.splice(_lru.begin(), _lru, it->second);
+    auto& data = it->second->data;
+    return data.share(0, data.size_bytes());
+}
+
+void segment_range_cache::put(
+  const remote_segment_path& path, int64_t file_pos, iobuf data) {
+    const auto max_bytes = _max_bytes();
+    const auto size = data.size_bytes();
+    if (size > max_bytes) {
+        return;
+    }
+    key_t key{path().native(), file_pos};
+    if (auto it = _index.find(key); it != _index.end()) {
+        _size_bytes -= it->second->data.size_bytes();
+        _lru.erase(it->second);
+        _index.erase(it);
+    }
+    evict(max_bytes - size);
+    _lru.push_front(entry{.key = key, .data = std::move(data)});
+    _index.emplace(std::move(key), _lru.begin());
+    _size_bytes += size;
+}
+
+void segment_range_cache::evict(size_t max_bytes) {
+    while (_size_bytes > max_bytes && !_lru.empty()) {
+        auto& last = _lru.back();
+        _size_bytes -= last.data.size_bytes();
+        _index.erase(last.key);
+        _lru.pop_back();
+    }
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/types.h"
+#include "config/property.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <list>
+#include <optional>
+#include <string>
+
+namespace cloud_storage {
+
+/**
+ * Shard-local LRU cache of byte ranges of remote segments which were
+ * downloaded into memory by small reads, see
+ * remote_segment::offset_data_stream. A range is identified by its segment and
+ * its start position. Reads of the same offset start at the same index entry
+ * so repeated lookups of a record hit the cache.
+ *
+ * Segment objects are never modified in place, entries don't become stale and
+ * are only evicted to stay under the size limit.
+ */
+class segment_range_cache {
+public:
+    explicit segment_range_cache(config::binding<size_t> max_bytes);
+
+    segment_range_cache(const segment_range_cache&) = delete;
+    segment_range_cache& operator=(const segment_range_cache&) = delete;
+    segment_range_cache(segment_range_cache&&) = delete;
+    segment_range_cache& operator=(segment_range_cache&&) = delete;
+    ~segment_range_cache() = default;
+
+    /// Returns the range starting at `file_pos` of the segment if it's cached.
+    /// The returned buffer shares its fragments with the cached one.
+    std::optional<iobuf> get(const remote_segment_path&, int64_t file_pos);
+
+    /// Caches a range, evicting the least recently used ones if the cache
+    /// goes over its size limit. Ranges larger than the limit aren't cached.
+    void put(const remote_segment_path&, int64_t file_pos, iobuf data);
+
+    /// Total size of the cached ranges
+    size_t size_bytes() const { return _size_bytes; }
+
+    /// Number of cached ranges
+    size_t size() const { return _index.size(); }
+
+private:
+    using key_t = std::pair<std::string, int64_t>;
+
+    struct entry {
+        key_t key;
+        iobuf data;
+    };
+
+    /// Evicts ranges until the cache is under `max_bytes`
+    void evict(size_t max_bytes);
+
+    config::binding<size_t> _max_bytes;
+    // most recently used first
+    std::list<entry> _lru;
+    absl::flat_hash_map<key_t, std::list<entry>::iterator> _index;
+    size_t _size_bytes{0};
+};
+
+} // namespace cloud_storage
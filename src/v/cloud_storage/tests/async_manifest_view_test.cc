@@ -19,6 +19,7 @@
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 #include "utils/retry_chain_node.h"
 
@@ -28,8 +29,10 @@
 #include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/timed_out_error.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/testing/seastar_test.hh>
 #include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
 
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
@@ -432,6 +435,38 @@ FIXTURE_TEST(test_async_manifest_view_iter, async_manifest_view_fixture) {
     BOOST_REQUIRE(expected == actual);
 }
 
+FIXTURE_TEST(test_async_manifest_view_prefetch, async_manifest_view_fixture) {
+    config::shard_local_cfg()
+      .cloud_storage_spillover_manifest_prefetch_count.set_value(size_t{2});
+    auto reset = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_spillover_manifest_prefetch_count.reset();
+    });
+    for (int i = 0; i < 4; i++) {
+        generate_manifest_section(100, false);
+    }
+    listen();
+
+    auto is_cached = [this](size_t ix) {
+        return cache.local().is_cached(
+          std::filesystem::path(_expectations.at(ix).url));
+    };
+    auto cursor = view.get_cursor(spillover_start_offsets.at(0)).get();
+    BOOST_REQUIRE(cursor.has_value());
+
+    // the two manifests after the requested one are downloaded in the
+    // background, the last one isn't
+    tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return ss::when_all_succeed(is_cached(1), is_cached(2))
+          .then_unpack(
+            [](cache_element_status first, cache_element_status second) {
+                return first == cache_element_status::available
+                       && second == cache_element_status::available;
+            });
+    }).get();
+    BOOST_REQUIRE(is_cached(3).get() == cache_element_status::not_available);
+}
+
 FIXTURE_TEST(test_async_manifest_view_truncate, async_manifest_view_fixture) {
     // Check archive truncation
     std::vector<segment_meta> expected;
@@ -968,6 +1003,52 @@ FIXTURE_TEST(
     BOOST_REQUIRE(past_term_query.value() == std::nullopt);
 }
 
+FIXTURE_TEST(
+  test_async_manifest_view_term_index_follows_stm,
+  async_manifest_view_fixture) {
+    std::vector<segment_meta> expected;
+    collect_segments_to(expected);
+
+    auto first_term = generate_random_segments(stm_manifest, 10);
+    auto first_term_last_offset = first_term.back().committed_offset;
+    add_segments_to_stm_manifest(std::move(first_term));
+
+    auto second_term = generate_random_segments(stm_manifest, 5);
+    auto second_term_last_offset = second_term.back().committed_offset;
+    for (auto& meta : second_term) {
+        meta.segment_term = model::term_id{2};
+    }
+    add_segments_to_stm_manifest(std::move(second_term));
+
+    auto query = [this](model::term_id term) {
+        auto res = view.get_term_last_offset(term).get();
+        BOOST_REQUIRE(res.has_value());
+        return res.value();
+    };
+    BOOST_REQUIRE_EQUAL(
+      kafka::offset_cast(query(model::term_id{1}).value()),
+      first_term_last_offset);
+    BOOST_REQUIRE(query(model::term_id{3}) == std::nullopt);
+
+    // the index built by the lookups above has to be rebuilt
+    auto third_term = generate_random_segments(stm_manifest, 5);
+    auto third_term_last_offset = third_term.back().committed_offset;
+    for (auto& meta : third_term) {
+        meta.segment_term = model::term_id{3};
+    }
+    add_segments_to_stm_manifest(std::move(third_term));
+
+    BOOST_REQUIRE_EQUAL(
+      kafka::offset_cast(query(model::term_id{2}).value()),
+      second_term_last_offset);
+    BOOST_REQUIRE_EQUAL(
+      kafka::offset_cast(query(model::term_id{3}).value()),
+      third_term_last_offset);
+    BOOST_REQUIRE_EQUAL(
+      kafka::offset_cast(query(model::term_id{1}).value()),
+      first_term_last_offset);
+}
+
 FIXTURE_TEST(
   test_async_manifest_view_spill_concurrently, async_manifest_view_fixture) {
     // Enumerate all segments while spilling.
@@ -14,6 +14,8 @@
 
 #include <seastar/testing/perf_tests.hh>
 
+#include <random>
+
 static std::chrono::system_clock::time_point make_ts(int64_t val) {
     auto seconds = std::chrono::seconds(val);
     return std::chrono::system_clock::time_point(seconds);
@@ -36,3 +38,26 @@ static void run_test(int test_scale) {
 PERF_TEST(cache_utils, cm_sketch_1000) { run_test(1000); }
 
 PERF_TEST(cache_utils, cm_sketch_10000) { run_test(10000); }
+
+/// Selects the least recently accessed entries making up 1% of a tracker
+/// of `test_scale` entries, the way trim picks its candidates.
+static void run_lru_test(int test_scale) {
+    cloud_storage::access_time_tracker tracker;
+    std::mt19937 rng(test_scale);
+    for (int i = 0; i < test_scale; i++) {
+        tracker.add(ssx::sformat("name-{}", i), make_ts(rng() % 86400), 1);
+    }
+
+    const size_t to_select = test_scale / 100;
+    size_t selected = 0;
+    perf_tests::start_measuring_time();
+    tracker.for_each_lru([&](const cloud_storage::file_list_item&) {
+        return ss::stop_iteration(++selected >= to_select);
+    });
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(selected);
+}
+
+PERF_TEST(cache_utils, lru_select_100000) { run_lru_test(100000); }
+
+PERF_TEST(cache_utils, lru_select_1000000) { run_lru_test(1000000); }
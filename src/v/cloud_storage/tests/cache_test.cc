@@ -451,6 +451,42 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_read_skipped_on_old_version) {
     BOOST_REQUIRE_EQUAL(out.size(), 0);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_lru_order) {
+    access_time_tracker in;
+    in.add("key0", make_ts(30), 0);
+    in.add("key1", make_ts(10), 1);
+    in.add("key2", make_ts(20), 2);
+    in.add("key3", make_ts(40), 3);
+
+    // an access moves the entry to the back, a removal drops it
+    in.add("key1", make_ts(50), 1);
+    in.remove("key2");
+
+    auto lru_paths = [](const access_time_tracker& t) {
+        std::vector<ss::sstring> paths;
+        for (const auto& item : t.lru_entries()) {
+            paths.push_back(item.path);
+        }
+        return paths;
+    };
+    const std::vector<ss::sstring> expected{"key0", "key3", "key1"};
+    BOOST_REQUIRE(lru_paths(in) == expected);
+
+    // the index survives a round trip
+    auto out = serde_roundtrip(in);
+    BOOST_REQUIRE(lru_paths(out) == expected);
+
+    // visits stop early
+    std::vector<ss::sstring> visited;
+    out.for_each_lru([&visited](const file_list_item& item) {
+        visited.push_back(item.path);
+        return ss::stop_iteration(visited.size() == 2);
+    });
+    BOOST_REQUIRE(
+      visited
+      == std::vector<ss::sstring>(expected.begin(), expected.begin() + 2));
+}
+
 /**
  * Validate that .part files and empty directories are deleted if found during
  * the startup walk of the cache.
@@ -774,3 +810,31 @@ FIXTURE_TEST(test_tracker_sync_add_remove, cache_test_fixture) {
     BOOST_REQUIRE_EQUAL(cache.get_usage_bytes(), 1024);
     BOOST_REQUIRE_EQUAL(cache.get_usage_objects(), 1);
 }
+
+FIXTURE_TEST(test_download_once_concurrent, cache_test_fixture) {
+    auto& cache = sharded_cache.local();
+    size_t downloads = 0;
+    ss::promise<> unblock;
+    auto first = cache.download_once(KEY, [&]() -> ss::future<> {
+        ++downloads;
+        co_await unblock.get_future();
+        iobuf buf;
+        buf.append(create_data_string('a', 1_KiB).data(), 1_KiB);
+        auto reservation = co_await cache.reserve_space(buf.size_bytes(), 1);
+        auto input = make_iobuf_input_stream(std::move(buf));
+        co_await cache.put(KEY, input, reservation);
+    });
+    // Waits for the first download rather than downloading the object again
+    auto second = cache.download_once(KEY, [&] {
+        ++downloads;
+        return ss::now();
+    });
+    BOOST_REQUIRE(!second.available());
+
+    unblock.set_value();
+    first.get();
+    second.get();
+    BOOST_REQUIRE_EQUAL(downloads, 1);
+    BOOST_REQUIRE(
+      cache.is_cached(KEY).get() == cache_element_status::available);
+}
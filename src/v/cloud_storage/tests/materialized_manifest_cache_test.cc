@@ -514,3 +514,33 @@ SEASTAR_THREAD_TEST_CASE(test_materialized_manifest_cache_grow) {
     p1 = cache.get(make_key(1), ctxlog);
     BOOST_REQUIRE(p1 != nullptr);
 }
+
+// Evict elements and verify that looking them up again is counted as a miss
+// that a larger cache would have served, as long as the evicted elements fit
+// in the capacity of the cache.
+SEASTAR_THREAD_TEST_CASE(test_materialized_manifest_cache_ghost_hits) {
+    ss::abort_source as;
+    retry_chain_node rtc(as);
+    retry_chain_logger ctxlog(test_log, rtc);
+    materialized_manifest_cache cache(40);
+    cache.start().get();
+
+    for (int i = 0; i < 5; i++) {
+        auto fut = cache.prepare(20, ctxlog);
+        cache.put(
+          std::move(fut.get()), make_manifest(model::offset(i)), ctxlog);
+    }
+    // 3 and 4 are cached, 1 and 2 are remembered as evicted, 0 was
+    // forgotten because the evicted elements exceeded the capacity
+    BOOST_REQUIRE(cache.get(make_key(4), ctxlog) != nullptr);
+    BOOST_REQUIRE(cache.get(make_key(0), ctxlog) == nullptr);
+    BOOST_REQUIRE(cache.get(make_key(1), ctxlog) == nullptr);
+    BOOST_REQUIRE(cache.get(make_key(2), ctxlog) == nullptr);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 3);
+    BOOST_REQUIRE_EQUAL(cache.ghost_hits(), 2);
+
+    // A ghost is only counted once
+    BOOST_REQUIRE(cache.get(make_key(1), ctxlog) == nullptr);
+    BOOST_REQUIRE_EQUAL(cache.ghost_hits(), 2);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/prefetch_scheduler.h"
+#include "config/mock_property.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <vector>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+namespace {
+struct prefetches {
+    std::vector<int> started;
+    std::vector<ss::promise<>> done;
+
+    prefetch_scheduler::prefetch_fn make(int id) {
+        return [this, id] {
+            started.push_back(id);
+            return done.emplace_back().get_future();
+        };
+    }
+
+    // completes the i-th prefetch that started
+    void complete(size_t i) {
+        done.at(i).set_value();
+        ss::yield().get();
+    }
+};
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_prefetch_scheduler_deadline_order) {
+    prefetch_scheduler scheduler(config::mock_binding<size_t>(100));
+    prefetches p;
+    auto now = prefetch_scheduler::clock::now();
+
+    // the first one runs right away, the others wait for budget
+    scheduler.schedule(100, now + 10s, p.make(0));
+    scheduler.schedule(100, now + 30s, p.make(1));
+    scheduler.schedule(100, now + 20s, p.make(2));
+    BOOST_REQUIRE(p.started == std::vector<int>({0}));
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 100);
+    BOOST_REQUIRE_EQUAL(scheduler.queued(), 2);
+
+    p.complete(0);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 2}));
+    p.complete(1);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 2, 1}));
+    p.complete(2);
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 0);
+    BOOST_REQUIRE_EQUAL(scheduler.queued(), 0);
+    scheduler.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_prefetch_scheduler_bytes_bound) {
+    prefetch_scheduler scheduler(config::mock_binding<size_t>(250));
+    prefetches p;
+    auto now = prefetch_scheduler::clock::now();
+
+    for (int i = 0; i < 4; ++i) {
+        scheduler.schedule(100, now + 10s + i * 1s, p.make(i));
+    }
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 1}));
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 200);
+
+    p.complete(0);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 1, 2}));
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 200);
+
+    // a prefetch larger than the budget still runs alone
+    scheduler.schedule(1000, now + 1s, p.make(4));
+    p.complete(1);
+    p.complete(2);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 1, 2, 4}));
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 1000);
+    p.complete(3);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 1, 2, 4, 3}));
+    p.complete(4);
+    BOOST_REQUIRE_EQUAL(scheduler.bytes_in_flight(), 0);
+    scheduler.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_prefetch_scheduler_drops_expired) {
+    prefetch_scheduler scheduler(config::mock_binding<size_t>(100));
+    prefetches p;
+    auto now = prefetch_scheduler::clock::now();
+
+    scheduler.schedule(100, now + 10s, p.make(0));
+    scheduler.schedule(100, now - 1s, p.make(1));
+    scheduler.schedule(100, now + 20s, p.make(2));
+
+    p.complete(0);
+    BOOST_REQUIRE(p.started == std::vector<int>({0, 2}));
+    BOOST_REQUIRE_EQUAL(scheduler.dropped(), 1);
+    p.complete(1);
+    scheduler.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_prefetch_scheduler_disabled) {
+    config::mock_property<size_t> max_bytes(0);
+    prefetch_scheduler scheduler(max_bytes.bind());
+    prefetches p;
+    auto now = prefetch_scheduler::clock::now();
+
+    BOOST_REQUIRE(!scheduler.enabled());
+    scheduler.schedule(100, now + 10s, p.make(0));
+    BOOST_REQUIRE(p.started.empty());
+    BOOST_REQUIRE_EQUAL(scheduler.queued(), 0);
+
+    max_bytes.update(100);
+    BOOST_REQUIRE(scheduler.enabled());
+    scheduler.schedule(100, now + 10s, p.make(1));
+    BOOST_REQUIRE(p.started == std::vector<int>({1}));
+    p.complete(0);
+    scheduler.stop().get();
+}
@@ -503,3 +503,90 @@ FIXTURE_TEST(
     reader.stop().get();
     segment->stop().get();
 }
+
+FIXTURE_TEST(
+  test_remote_segment_batch_reader_resume_from_checkpoint,
+  cloud_storage_fixture) { // NOLINT
+    iobuf segment_bytes = generate_segment(model::offset(1), 100);
+
+    std::vector<model::record_batch_header> headers;
+    std::vector<iobuf> records;
+    std::vector<uint64_t> file_offsets;
+    auto parser = make_recording_batch_parser(
+      iobuf_deep_copy(segment_bytes), headers, records, file_offsets);
+    parser->consume().get();
+    parser->close().get();
+    BOOST_REQUIRE(headers.size() > 3);
+
+    set_expectations_and_listen({});
+    partition_manifest m(manifest_ntp, manifest_revision);
+    uint64_t clen = segment_bytes.size_bytes();
+    partition_manifest::segment_meta meta{
+      .is_compacted = false,
+      .size_bytes = segment_bytes.size_bytes(),
+      .base_offset = headers.front().base_offset,
+      .committed_offset = headers.back().last_offset(),
+      .base_timestamp = {},
+      .max_timestamp = {},
+      .delta_offset = model::offset_delta(0),
+      .ntp_revision = manifest_revision};
+    auto path = m.generate_segment_path(meta, path_provider);
+    auto reset_stream = make_reset_fn(segment_bytes);
+    retry_chain_node fib(never_abort, 1000ms, 200ms);
+    auto upl_res
+      = api.local()
+          .upload_segment(
+            bucket_name, path, clen, reset_stream, fib, always_continue)
+          .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+    m.add(meta);
+
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    auto segment = ss::make_lw_shared<remote_segment>(
+      api.local(),
+      cache.local(),
+      bucket_name,
+      path,
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    auto read_batches = [&](size_t first, size_t last) {
+        remote_segment_batch_reader reader(
+          segment,
+          storage::log_reader_config(
+            headers.at(first).base_offset,
+            headers.at(last).last_offset(),
+            ss::default_priority_class()),
+          probe,
+          ts_probe,
+          ssx::semaphore_units());
+        storage::offset_translator_state ot_state(m.get_ntp());
+        auto s = reader.read_some(model::no_timeout, ot_state).get();
+        BOOST_REQUIRE(static_cast<bool>(s));
+        std::vector<model::offset> offsets;
+        for (const auto& batch : s.value()) {
+            offsets.push_back(batch.base_offset());
+        }
+        reader.stop().get();
+        return offsets;
+    };
+
+    // The first reader stops before the fourth batch, the next one
+    // continues from there.
+    auto offsets = read_batches(0, 2);
+    BOOST_REQUIRE_EQUAL(offsets.size(), 3);
+    offsets = read_batches(3, 3);
+    BOOST_REQUIRE_EQUAL(offsets.size(), 1);
+    BOOST_REQUIRE_EQUAL(offsets.at(0), headers.at(3).base_offset);
+
+    // Reading from before the checkpoints still works.
+    offsets = read_batches(1, 1);
+    BOOST_REQUIRE_EQUAL(offsets.size(), 1);
+    BOOST_REQUIRE_EQUAL(offsets.at(0), headers.at(1).base_offset);
+
+    segment->stop().get();
+}
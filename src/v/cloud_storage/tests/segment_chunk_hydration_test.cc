@@ -132,9 +132,10 @@ template<typename Test>
 void test_wrapper(
   cloud_storage_fixture& f,
   Test do_test,
-  upload_index_t index_upload = upload_index_t::yes) {
+  upload_index_t index_upload = upload_index_t::yes,
+  uint64_t chunk_size = 128_KiB) {
     config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
-      static_cast<uint64_t>(128_KiB));
+      chunk_size);
     auto reset_cfg = ss::defer(
       [] { config::shard_local_cfg().cloud_storage_cache_chunk_size.reset(); });
 
@@ -292,6 +293,31 @@ FIXTURE_TEST(test_remote_segment_chunk_read_fallback, cloud_storage_fixture) {
     test_wrapper(*this, test, upload_index_t::no);
 }
 
+FIXTURE_TEST(test_single_chunk_hydrated_with_index, cloud_storage_fixture) {
+    /**
+     * The segment fits in a single chunk. The chunk is downloaded alongside
+     * the index so it is in the cache before any reader asks for it.
+     */
+    constexpr uint64_t chunk_size = 16_MiB;
+    auto test =
+      [&](
+        remote_segment& segment, segment_chunks&, const iobuf& segment_bytes) {
+          BOOST_REQUIRE_LE(segment_bytes.size_bytes(), chunk_size);
+          segment.hydrate().get();
+          BOOST_REQUIRE(!segment.is_fallback_engaged());
+
+          BOOST_REQUIRE(ranges::any_of(
+            std::filesystem::recursive_directory_iterator{
+              tmp_directory.get_path()},
+            is_chunk_file));
+
+          const auto requests = get_requests(is_segment_dl_req);
+          BOOST_REQUIRE_EQUAL(requests.size(), 1);
+          BOOST_REQUIRE(requests.front().header("Range") != "");
+      };
+    test_wrapper(*this, test, upload_index_t::yes, chunk_size);
+}
+
 FIXTURE_TEST(test_chunks_initialization, cloud_storage_fixture) {
     auto test =
       [](remote_segment& segment, segment_chunks& chunk_api, const iobuf&) {
@@ -515,6 +541,37 @@ FIXTURE_TEST(test_chunk_prefetch, cloud_storage_fixture) {
     test_wrapper(*this, test_f);
 }
 
+FIXTURE_TEST(test_chunk_prefetch_sequential_reads, cloud_storage_fixture) {
+    scoped_config reset;
+    reset.get("cloud_storage_chunk_prefetch").set_value(uint16_t{1});
+
+    auto test_f = [&](remote_segment& r, segment_chunks& c, const iobuf&) {
+        r.hydrate().get();
+        std::vector<chunk_start_offset_t> starts;
+        for (const auto& [start, chunk] : c) {
+            starts.push_back(start);
+        }
+        BOOST_REQUIRE_GT(starts.size(), 3);
+
+        // Each request following the previous one doubles the prefetch:
+        // the third request prefetches four chunks past the third one.
+        for (size_t i = 0; i < 3; ++i) {
+            c.hydrate_chunk(starts[i]).get();
+        }
+        RPTEST_REQUIRE_EVENTUALLY(
+          10s, [&c] { return !c.downloads_in_progress(); })
+
+        const auto expected = std::min<size_t>(starts.size(), 7);
+        for (size_t i = 0; i < starts.size(); ++i) {
+            const auto& chunk = c.get(starts[i]);
+            BOOST_REQUIRE_EQUAL(
+              chunk.current_state == chunk_state::hydrated, i < expected);
+        }
+    };
+
+    test_wrapper(*this, test_f);
+}
+
 FIXTURE_TEST(test_abort_hydration_timeout, cloud_storage_fixture) {
     scoped_config reset;
     reset.get("cloud_storage_hydration_timeout_ms").set_value(0ms);
@@ -235,6 +235,26 @@ void cs_lower_bound_test(StoreT& store, size_t sz) {
     }
 }
 
+/// Point lookups spread over the whole manifest, most of them hit a frame
+/// followed by many others.
+template<class StoreT>
+void cs_lower_bound_spread_test(StoreT& store, size_t sz) {
+    auto manifest = generate_metadata(sz);
+
+    for (const auto& s : manifest) {
+        store.insert(s);
+    }
+
+    constexpr size_t lookups = 100;
+    for (size_t i = 0; i < lookups; ++i) {
+        const auto& e = manifest[i * (sz / lookups)];
+        perf_tests::start_measuring_time();
+        auto it = store.lower_bound(e.base_offset + model::offset(1));
+        perf_tests::do_not_optimize(it);
+        perf_tests::stop_measuring_time();
+    }
+}
+
 template<class StoreT>
 void cs_upper_bound_test(StoreT& store, size_t sz) {
     auto manifest = generate_metadata(sz);
@@ -335,6 +355,25 @@ PERF_TEST(cstore_bench, column_store_lower_bound_result) {
     cs_lower_bound_test(store, 10000);
 }
 
+PERF_TEST(cstore_bench, column_store_lower_bound_spread_100k_baseline) {
+    baseline_column_store store;
+    cs_lower_bound_spread_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_lower_bound_spread_100k_result) {
+    segment_meta_cstore store;
+    cs_lower_bound_spread_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_lower_bound_spread_100k_no_hints) {
+    segment_meta_cstore store;
+    config::shard_local_cfg().storage_ignore_cstore_hints.set_value(true);
+    auto _ = ss::defer([] {
+        config::shard_local_cfg().storage_ignore_cstore_hints.set_value(false);
+    });
+    cs_lower_bound_spread_test(store, 100000);
+}
+
 PERF_TEST(cstore_bench, column_store_upper_bound_baseline) {
     baseline_column_store store;
     cs_upper_bound_test(store, 10000);
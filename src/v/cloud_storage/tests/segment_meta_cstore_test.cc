@@ -201,6 +201,39 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_full_upper_bound) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_search_between_segments) {
+    // lookups of offsets inside segments start decoding from the closest
+    // hint, they should find the same segments as lookups from the frame start
+    segment_meta_cstore store;
+    auto manifest = generate_metadata(short_test_size);
+    for (const auto& sm : manifest) {
+        store.insert(sm);
+    }
+
+    auto expected_lower_bound = [&](model::offset o) {
+        return std::ranges::lower_bound(
+          manifest, o, std::less<>{}, &segment_meta::base_offset);
+    };
+    for (const auto& sm : manifest) {
+        auto o = sm.base_offset + model::offset(1);
+        auto expected = expected_lower_bound(o);
+
+        auto lb = store.lower_bound(o);
+        auto ub = store.upper_bound(sm.base_offset);
+        if (expected == manifest.end()) {
+            BOOST_REQUIRE(lb == store.end());
+            BOOST_REQUIRE(ub == store.end());
+            continue;
+        }
+        BOOST_REQUIRE(lb != store.end());
+        BOOST_REQUIRE(*lb == *expected);
+        BOOST_REQUIRE(ub != store.end());
+        BOOST_REQUIRE(*ub == *expected);
+        BOOST_REQUIRE(
+          store.find(o) == store.end() || expected->base_offset == o);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_iterators) {
     segment_meta_cstore store;
 
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/segment_range_cache.h"
+#include "cloud_storage/types.h"
+#include "config/mock_property.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+
+namespace {
+iobuf make_range(size_t size, char c) {
+    iobuf buf;
+    buf.append(ss::sstring(size, c).data(), size);
+    return buf;
+}
+
+const remote_segment_path first_segment{"a/b/1-1-v1.log.1"};
+const remote_segment_path second_segment{"a/b/2-1-v1.log.1"};
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_segment_range_cache_lookup) {
+    segment_range_cache cache(config::mock_binding<size_t>(1024));
+    BOOST_REQUIRE(!cache.get(first_segment, 0).has_value());
+
+    cache.put(first_segment, 0, make_range(100, 'a'));
+    cache.put(first_segment, 100, make_range(100, 'b'));
+    cache.put(second_segment, 0, make_range(100, 'c'));
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 300);
+
+    auto range = cache.get(first_segment, 100);
+    BOOST_REQUIRE(range.has_value());
+    BOOST_REQUIRE(*range == make_range(100, 'b'));
+    // ranges are looked up by their exact start
+    BOOST_REQUIRE(!cache.get(first_segment, 50).has_value());
+
+    // replacing a range doesn't count it twice
+    cache.put(second_segment, 0, make_range(50, 'd'));
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 250);
+    BOOST_REQUIRE(*cache.get(second_segment, 0) == make_range(50, 'd'));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_segment_range_cache_eviction) {
+    config::mock_property<size_t> max_bytes(300);
+    segment_range_cache cache(max_bytes.bind());
+
+    cache.put(first_segment, 0, make_range(100, 'a'));
+    cache.put(first_segment, 100, make_range(100, 'b'));
+    cache.put(first_segment, 200, make_range(100, 'c'));
+    // the first range becomes the most recently used
+    BOOST_REQUIRE(cache.get(first_segment, 0).has_value());
+
+    cache.put(first_segment, 300, make_range(100, 'd'));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 300);
+    BOOST_REQUIRE(cache.get(first_segment, 0).has_value());
+    BOOST_REQUIRE(!cache.get(first_segment, 100).has_value());
+
+    // ranges larger than the cache aren't cached
+    cache.put(second_segment, 0, make_range(400, 'e'));
+    BOOST_REQUIRE(!cache.get(second_segment, 0).has_value());
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+
+    // shrinking the cache evicts right away
+    max_bytes.update(100);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE(cache.get(first_segment, 0).has_value());
+}
@@ -25,9 +25,15 @@
 
 #include <absl/container/btree_set.h>
 
+#include <ranges>
+
 namespace cloud_storage {
 
 namespace {
+// Bounds the number of topic manifests downloaded in parallel when recovering
+// many topics at once.
+constexpr size_t max_concurrent_manifest_downloads = 32;
+
 bool bin_manifest_filter(
   const cloud_storage_clients::client::list_bucket_item& i) {
     return i.key.ends_with("topic_manifest.bin");
@@ -217,6 +223,22 @@ ss::future<result<list_outcome_t, error_outcome>> find_prefixed_manifest_paths(
     }
     co_return prefixed_list_res.value().contents;
 }
+
+ss::future<result<find_topic_manifest_outcome, error_outcome>>
+download_topic_manifest(
+  remote& remote,
+  cloud_storage_clients::bucket_name bucket,
+  model::topic_namespace tp,
+  retry_chain_node& parent_retry,
+  ss::lowres_clock::time_point deadline,
+  model::timestamp_clock::duration backoff,
+  topic_manifest* manifest) {
+    topic_manifest_downloader dl(bucket, /*hint=*/std::nullopt, tp, remote);
+    // Not the most optimal since the downloader will check multiple paths,
+    // even though we looked at paths above, but this is nice and tidy.
+    co_return co_await dl.download_manifest(
+      parent_retry, deadline, backoff, manifest);
+}
 } // namespace
 
 ss::future<result<find_topic_manifest_outcome, error_outcome>>
@@ -291,15 +313,31 @@ topic_manifest_downloader::find_manifests(
         co_return error_outcome::manifest_download_error;
     }
     // Use the manifest downloader to look for the filtered manifests.
+    std::vector<model::topic_namespace> to_download{
+      topics.begin(), topics.end()};
+    std::vector<topic_manifest> downloaded(to_download.size());
+    using download_result_t
+      = result<find_topic_manifest_outcome, error_outcome>;
+    std::vector<std::optional<download_result_t>> results(to_download.size());
+    co_await ss::max_concurrent_for_each(
+      std::views::iota(size_t{0}, to_download.size()),
+      max_concurrent_manifest_downloads,
+      [&](size_t i) {
+          return download_topic_manifest(
+                   remote,
+                   bucket,
+                   to_download[i],
+                   parent_retry,
+                   deadline,
+                   backoff,
+                   &downloaded[i])
+            .then([&results, i](auto res) { results[i] = std::move(res); });
+      });
     chunked_vector<topic_manifest> m;
-    m.reserve(topics.size());
-    for (const auto& tp : topics) {
-        topic_manifest tm;
-        topic_manifest_downloader dl(bucket, /*hint=*/std::nullopt, tp, remote);
-        // Not the most optimal since the downloader will check multiple paths,
-        // even though we looked at paths above, but this is nice and tidy.
-        auto res = co_await dl.download_manifest(
-          parent_retry, deadline, backoff, &tm);
+    m.reserve(to_download.size());
+    for (size_t i = 0; i < to_download.size(); ++i) {
+        const auto& tp = to_download[i];
+        const auto& res = results[i].value();
         if (res.has_error()) {
             vlog(
               cst_log.error,
@@ -316,7 +354,7 @@ topic_manifest_downloader::find_manifests(
               res.value());
             co_return res.value();
         }
-        m.push_back(std::move(tm));
+        m.push_back(std::move(downloaded[i]));
     }
     *manifests = std::move(m);
     co_return find_topic_manifest_outcome::success;
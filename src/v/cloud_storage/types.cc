@@ -37,6 +37,8 @@ cloud_storage_clients::default_overrides get_default_overrides() {
           std::filesystem::path(*cert));
     }
     overrides.port = config::shard_local_cfg().cloud_storage_api_endpoint_port;
+    overrides.warm_up_connections
+      = config::shard_local_cfg().cloud_storage_warm_up_connections();
 
     return overrides;
 }
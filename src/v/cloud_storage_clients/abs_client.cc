@@ -21,6 +21,7 @@
 #include "config/configuration.h"
 #include "json/document.h"
 #include "json/istreamwrapper.h"
+#include "utils/base64.h"
 
 #include <utility>
 
@@ -239,6 +240,85 @@ result<http::client::request_header> abs_request_creator::make_put_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& block_id,
+  size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={block-id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+abs_request_creator::make_put_block_list_request(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<ss::sstring>& block_ids) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // Content-Type: text/plain
+    //
+    // <?xml version="1.0" encoding="utf-8"?>
+    // <BlockList>
+    //   <Latest>{block-id}</Latest>
+    //   ...
+    // </BlockList>
+    std::string xml{R"(<?xml version="1.0" encoding="utf-8"?><BlockList>)"};
+    for (const auto& id : block_ids) {
+        fmt::format_to(std::back_inserter(xml), "<Latest>{}</Latest>", id);
+    }
+    xml.append("</BlockList>");
+    iobuf body;
+    body.append(xml.data(), xml.size());
+
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_type, content_type_value);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(body.size_bytes()));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return {std::move(header), make_iobuf_input_stream(std::move(body))};
+}
+
 result<http::client::request_header>
 abs_request_creator::make_get_blob_metadata_request(
   bucket_name const& name, object_key const& key) {
@@ -488,6 +568,11 @@ ss::future<> abs_client::stop() {
 
 void abs_client::shutdown() { _client.shutdown(); }
 
+ss::future<> abs_client::warm_up(ss::lowres_clock::duration timeout) {
+    return _client.get_connected(timeout, prefix_logger(abs_log, "warm_up"))
+      .discard_result();
+}
+
 template<typename T>
 ss::future<result<T, error_outcome>> abs_client::send_request(
   ss::future<T> request_future,
@@ -685,6 +770,131 @@ ss::future<> abs_client::do_put_object(
     }
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::create_multipart_upload(
+  bucket_name const&, object_key const&, ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<ss::sstring, error_outcome>>(
+      ss::sstring{});
+}
+
+ss::future<result<ss::sstring, error_outcome>> abs_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block(
+        name, key, part_number, payload_size, std::move(body), timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<ss::sstring> abs_client::do_put_block(
+  bucket_name const& name,
+  object_key const& key,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    // All block ids of a blob must have the same length. Nine digits encode
+    // to twelve base64 characters without padding nor characters which need
+    // to be escaped in the query string.
+    const auto id = fmt::format("{:09}", part_number);
+    auto block_id = bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(id.data()), id.size()});
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, payload_size);
+    if (!header) {
+        co_await body.close();
+
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_return block_id;
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  const std::vector<ss::sstring>& part_tags,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, part_tags, timeout).then([] {
+          return no_response{};
+      }),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<ss::sstring>& block_ids,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_put_block_list_request(
+      name, key, block_ids);
+    if (!request) {
+        vlog(
+          abs_log.warn,
+          "Failed to create request header: {}",
+          request.error());
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+
+    vlog(abs_log.trace, "send https request:\n{}", header);
+
+    auto response_stream = co_await _client
+                             .request(std::move(header), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  const ss::sstring&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::head_object_result, error_outcome>>
 abs_client::head_object(
   bucket_name const& name,
@@ -39,6 +39,31 @@ public:
       object_key const& key,
       size_t payload_size_bytes);
 
+    /// \brief Create 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 encoded identifier of the block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& block_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create 'Put Block List' request header and body
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_ids are the identifiers of the blocks, in blob order
+    /// \return the header and the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_put_block_list_request(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<ss::sstring>& block_ids);
+
     /// \brief Create a 'Get Blob' request header
     ///
     /// \param name is container name
@@ -137,6 +162,9 @@ public:
     /// Shutdown the underlying connection
     void shutdown() override;
 
+    /// Establish the connection ahead of the first request
+    ss::future<> warm_up(ss::lowres_clock::duration timeout) override;
+
     /// Download object from ABS container
     ///
     /// \param name is a container name
@@ -176,6 +204,39 @@ public:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout) override;
 
+    /// Blocks are staged under the name of the blob, there is no upload to
+    /// start so the upload id is empty.
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request, the tag of the part is its block id
+    ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request which commits the blocks as the blob
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<ss::sstring>& part_tags,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Uncommitted blocks are garbage collected by the service, nothing
+    /// needs to be sent.
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     /// Send List Blobs request
     /// \param name is a container name
     /// \param prefix is an optional blob prefix to match
@@ -264,6 +325,20 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_put_block(
+      bucket_name const& name,
+      object_key const& key,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<ss::sstring>& block_ids,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
       object_key const& key,
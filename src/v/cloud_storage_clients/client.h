@@ -40,6 +40,12 @@ public:
     /// Shutdown the underlying connection
     virtual void shutdown() = 0;
 
+    /// Establish the connection ahead of the first request so that the
+    /// request doesn't have to wait for the TCP and TLS handshakes.
+    ///
+    /// \param timeout is a timeout of the connection attempts
+    virtual ss::future<> warm_up(ss::lowres_clock::duration timeout) = 0;
+
     /// Download object from cloud storage.
     ///
     /// \param name is a bucket name
@@ -89,6 +95,72 @@ public:
       ss::lowres_clock::duration timeout)
       = 0;
 
+    /// Start a multipart upload of an object. The object is not visible
+    /// until the upload is completed.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the id of the upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload one part of a multipart upload
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param part_number is a position of the part in the object, from 1
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the tag which identifies the part
+    virtual ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Assemble the object from the parts of a multipart upload
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param part_tags are the tags returned by upload_part, in part order
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the object is assembled
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<ss::sstring>& part_tags,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Drop the parts of a multipart upload which won't be completed
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by create_multipart_upload
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the request is completed
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
     struct list_bucket_item {
         ss::sstring key;
         std::chrono::system_clock::time_point last_modified;
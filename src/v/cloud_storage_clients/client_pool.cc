@@ -29,6 +29,7 @@ using namespace std::chrono_literals;
 namespace {
 constexpr auto self_configure_attempts = 3;
 constexpr auto self_configure_backoff = 1s;
+constexpr auto warm_up_timeout = 10s;
 } // namespace
 
 namespace cloud_storage_clients {
@@ -160,6 +161,7 @@ ss::future<> client_pool::accept_self_configure_result(
     }
 
     populate_client_pool();
+    warm_up_connections();
 
     // We signal the waiters only after the client pool is initialized, so
     // that any upload operations waiting are ready to proceed.
@@ -434,10 +436,10 @@ bool client_pool::borrow_one(unsigned other) {
       other,
       _pool.size(),
       _capacity);
-    // TODO: do not use the topmost element. Find the one
-    // with expired connection.
-    auto c = _pool.back();
-    _pool.pop_back();
+    // Give away the coldest client, the connections of the hot clients at the
+    // back are the most likely to be reused.
+    auto c = _pool.front();
+    _pool.pop_front();
     update_usage_stats();
     c->shutdown();
     ssx::spawn_with_gate(_bg_gate, [c] { return c->stop().finally([c] {}); });
@@ -473,6 +475,33 @@ void client_pool::populate_client_pool() {
     _cvar.signal();
 }
 
+void client_pool::warm_up_connections() {
+    const auto count = std::min(
+      std::visit(
+        [](const auto& cfg) { return cfg.warm_up_connections; }, _config),
+      _pool.size());
+    if (count == 0) {
+        return;
+    }
+    vlog(pool_log.debug, "Warming up {} client connections", count);
+    // The clients are taken out of the pool while they connect and are
+    // returned to the hot end of the pool once connected.
+    for (size_t i = 0; i < count; i++) {
+        auto client = _pool.back();
+        _pool.pop_back();
+        ssx::spawn_with_gate(_bg_gate, [this, client] {
+            return client->warm_up(warm_up_timeout)
+              .handle_exception([](const std::exception_ptr& e) {
+                  vlog(
+                    pool_log.debug,
+                    "Failed to warm up a client connection: {}",
+                    e);
+              })
+              .finally([this, client] { release(client); });
+        });
+    }
+}
+
 client_pool::http_client_ptr client_pool::make_client() const noexcept {
     return std::visit(
       [this](const auto& cfg) -> http_client_ptr {
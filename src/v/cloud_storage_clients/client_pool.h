@@ -150,6 +150,8 @@ private:
       std::optional<client_self_configuration_output> result);
 
     void populate_client_pool();
+    /// Connect the configured number of clients in the background
+    void warm_up_connections();
     http_client_ptr make_client() const noexcept;
     void release(http_client_ptr leased);
 
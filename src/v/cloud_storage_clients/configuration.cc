@@ -165,6 +165,7 @@ ss::future<s3_configuration> s3_configuration::make_configuration(
     client_cfg.max_idle_time = overrides.max_idle_time
                                  ? *overrides.max_idle_time
                                  : default_max_idle_time;
+    client_cfg.warm_up_connections = overrides.warm_up_connections;
     co_return client_cfg;
 }
 
@@ -176,7 +177,7 @@ std::ostream& operator<<(std::ostream& o, const s3_configuration& c) {
       << ",server_addr:" << c.server_addr << ",max_idle_time:"
       << std::chrono::duration_cast<std::chrono::milliseconds>(c.max_idle_time)
            .count()
-      << "}";
+      << ",warm_up_connections:" << c.warm_up_connections << "}";
     return o;
 }
 
@@ -225,6 +226,7 @@ ss::future<abs_configuration> abs_configuration::make_configuration(
     client_cfg.max_idle_time = overrides.max_idle_time
                                  ? *overrides.max_idle_time
                                  : default_max_idle_time;
+    client_cfg.warm_up_connections = overrides.warm_up_connections;
     co_return client_cfg;
 }
 
@@ -292,6 +294,7 @@ std::ostream& operator<<(std::ostream& o, const abs_configuration& c) {
       << ", max_idle_time:"
       << std::chrono::duration_cast<std::chrono::milliseconds>(c.max_idle_time)
            .count()
+      << ", warm_up_connections:" << c.warm_up_connections
       << ", is_hns_enabled:" << c.is_hns_enabled << "}";
     return o;
 }
@@ -28,6 +28,7 @@ struct default_overrides {
     std::optional<ca_trust_file> trust_file = std::nullopt;
     std::optional<ss::lowres_clock::duration> max_idle_time = std::nullopt;
     bool disable_tls = false;
+    size_t warm_up_connections = 0;
 };
 
 /// Configuration options common across cloud storage clients
@@ -36,6 +37,9 @@ struct common_configuration : net::base_transport::configuration {
     access_point_uri uri;
     /// Max time that connection can spend idle
     ss::lowres_clock::duration max_idle_time;
+    /// Number of connections the client pool establishes on every shard
+    /// before the first requests are made
+    size_t warm_up_connections{0};
     /// Metrics probe (should be created for every aws account on every shard)
     ss::shared_ptr<client_probe> _probe;
 
@@ -184,6 +184,184 @@ request_creator::make_unsigned_put_object_request(
     return header;
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name, object_key const& key) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateMultipartUpload.html
+    // Virtual Style:
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // POST /{bucket-name}/{object-id}?uploads HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Authorization: authorization string
+    // Content-Type: text/plain
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name, object_key{fmt::format("{}?uploads", key().string())});
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size_bytes) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_UploadPart.html
+    // Virtual Style:
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // PUT /{bucket-name}/{object-id}?partNumber={part-number}&uploadId=...
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Authorization: authorization string
+    // Content-Length: 11434
+    // [11434 bytes of part data]
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format(
+        "{}?partNumber={}&uploadId={}",
+        key().string(),
+        part_number,
+        upload_id)});
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<ss::sstring>& part_etags) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+    // Virtual Style:
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // POST /{bucket-name}/{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Authorization: authorization string
+    // Content-Length: <...>
+    //
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <ETag>etag</ETag>
+    //         <PartNumber>1</PartNumber>
+    //     </Part>
+    //     ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        size_t part_number = 1;
+        for (auto part_tree = boost::property_tree::ptree{};
+             auto const& etag : part_etags) {
+            part_tree.put("ETag", etag.c_str());
+            part_tree.put("PartNumber", part_number++);
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format("{}?uploadId={}", key().string(), upload_id)});
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    iobuf payload;
+    payload.append(body.data(), body.size());
+    return {std::move(header), make_iobuf_input_stream(std::move(payload))};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_AbortMultipartUpload.html
+    // Virtual Style:
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // DELETE /{bucket-name}/{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Authorization: authorization string
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format("{}?uploadId={}", key().string(), upload_id)});
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 result<http::client::request_header>
 request_creator::make_list_objects_v2_request(
   const bucket_name& name,
@@ -666,6 +844,11 @@ ss::future<> s3_client::stop() { return _client.stop(); }
 
 void s3_client::shutdown() { _client.shutdown(); }
 
+ss::future<> s3_client::warm_up(ss::lowres_clock::duration timeout) {
+    return _client.get_connected(timeout, prefix_logger(s3_log, "warm_up"))
+      .discard_result();
+}
+
 ss::future<result<http::client::response_stream_ref, error_outcome>>
 s3_client::get_object(
   bucket_name const& name,
@@ -885,6 +1068,208 @@ ss::future<> s3_client::do_put_object(
       });
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_create_multipart_upload(name, key, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(name, key);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    try {
+        auto ref = co_await _client.request(std::move(header.value()), timeout);
+        auto res = co_await util::drain_response_stream(ref);
+        auto status = ref->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 CreateMultipartUpload request failed for key {}: {} {:l}",
+              key,
+              status,
+              ref->get_headers());
+            co_await parse_rest_error_response<>(status, std::move(res));
+        }
+        auto root = util::iobuf_to_ptree(std::move(res), s3_log);
+        co_return root.get<ss::sstring>(
+          "InitiateMultipartUploadResult.UploadId");
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+ss::future<result<ss::sstring, error_outcome>> s3_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name,
+        key,
+        upload_id,
+        part_number,
+        payload_size,
+        std::move(body),
+        timeout),
+      name,
+      key);
+}
+
+ss::future<ss::sstring> s3_client::do_upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        co_await body.close();
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    std::exception_ptr eptr;
+    ss::sstring etag;
+    try {
+        auto ref = co_await _client.request(
+          std::move(header.value()), body, timeout);
+        auto res = co_await util::drain_response_stream(ref);
+        auto status = ref->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 UploadPart request failed for key {} part {}: {} {:l}",
+              key,
+              part_number,
+              status,
+              ref->get_headers());
+            co_await parse_rest_error_response<>(status, std::move(res));
+        }
+        auto tag = ref->get_headers().at(boost::beast::http::field::etag);
+        etag = ss::sstring(tag.data(), tag.length());
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        eptr = std::current_exception();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await body.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+    co_return etag;
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<ss::sstring>& part_tags,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(name, key, upload_id, part_tags, timeout)
+        .then([] { return no_response{}; }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<ss::sstring>& part_etags,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, part_etags);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send CompleteMultipartUpload request:\n{}", header);
+    try {
+        auto ref = co_await _client.request(std::move(header), body, timeout)
+                     .finally([&body] { return body.close(); });
+        auto res = co_await util::drain_response_stream(ref);
+        auto status = ref->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 CompleteMultipartUpload request failed for key {}: {} {:l}",
+              key,
+              status,
+              ref->get_headers());
+            co_await parse_rest_error_response<>(status, std::move(res));
+        }
+        // S3 can reply with 200 error code and error response in the body
+        // when the request fails after the response headers were sent.
+        auto root = util::iobuf_to_ptree(res.copy(), s3_log);
+        if (root.get_optional<ss::sstring>("Error.Code")) {
+            co_await parse_rest_error_response<>(status, std::move(res));
+        }
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([] {
+          return no_response{};
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::no_content
+      && status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 AbortMultipartUpload request failed for key {}: {} {:l}",
+          key,
+          status,
+          ref->get_headers());
+        co_await parse_rest_error_response<>(status, std::move(res));
+    }
+}
+
 ss::future<result<s3_client::list_bucket_result, error_outcome>>
 s3_client::list_objects(
   const bucket_name& name,
@@ -10,12 +10,15 @@
 
 #include "base/seastarx.h"
 #include "cloud_storage_clients/client_pool.h"
+#include "test_utils/async.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/net/api.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/later.hh>
@@ -90,3 +93,61 @@ SEASTAR_THREAD_TEST_CASE(test_client_pool_acquire_abortable) {
 
     BOOST_REQUIRE_THROW(f.get(), ss::abort_requested_exception);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_client_pool_warm_up_connections) {
+    constexpr size_t num_connections_per_shard = 4;
+    constexpr size_t num_warm_up_connections = 2;
+
+    ss::listen_options lo;
+    lo.reuse_address = true;
+    auto server = ss::listen(
+      ss::socket_address(
+        ss::net::inet_address("127.0.0.1"), httpd_port_number),
+      lo);
+    std::vector<ss::connected_socket> accepted;
+    auto accept_loop = ss::repeat([&server, &accepted] {
+                           return server.accept().then(
+                             [&accepted](ss::accept_result res) {
+                                 accepted.push_back(std::move(res.connection));
+                                 return ss::stop_iteration::no;
+                             });
+                       }).handle_exception([](const std::exception_ptr&) {});
+    auto server_stop = ss::defer([&server, &accept_loop] {
+        server.abort_accept();
+        accept_loop.get();
+    });
+
+    auto sconf = ss::sharded_parameter([] {
+        auto conf = transport_configuration();
+        conf.warm_up_connections = num_warm_up_connections;
+        return conf;
+    });
+    auto conf = transport_configuration();
+
+    ss::sharded<cloud_storage_clients::client_pool> pool;
+    pool
+      .start(
+        num_connections_per_shard,
+        sconf,
+        cloud_storage_clients::client_pool_overdraft_policy::wait_if_empty)
+      .get();
+    pool
+      .invoke_on_all([&conf](cloud_storage_clients::client_pool& p) {
+          auto cred = cloud_roles::aws_credentials{
+            conf.access_key.value(),
+            conf.secret_key.value(),
+            std::nullopt,
+            conf.region};
+          p.load_credentials(cred);
+      })
+      .get();
+    auto pool_stop = ss::defer([&pool] { pool.stop().get(); });
+
+    // The connections are made without any request and the warmed up
+    // clients are returned to the pool.
+    tests::cooperative_spin_wait_with_timeout(10s, [&pool, &accepted] {
+        return accepted.size() == num_warm_up_connections
+               && !pool.local().has_background_operations()
+               && pool.local().size() == num_connections_per_shard;
+    }).get();
+}
@@ -15,6 +15,18 @@
 #include "cloud_storage_clients/util.h"
 
 namespace {
+/// Returns the name in `names` that matches `element_name`, or an empty view
+template<size_t N>
+std::string_view tracked_name(
+  std::string_view element_name, const std::string_view (&names)[N]) {
+    for (auto name : names) {
+        if (name == element_name) {
+            return name;
+        }
+    }
+    return {};
+}
+
 struct aws_tags {
     static constexpr std::string_view list_bucket_results{"ListBucketResult"};
     static constexpr std::string_view contents{"Contents"};
@@ -27,6 +39,10 @@ struct aws_tags {
     static constexpr std::string_view next_continuation_token{
       "NextContinuationToken"};
     static constexpr std::string_view common_prefixes{"CommonPrefixes"};
+
+    /// Elements the parser checks the path for
+    static constexpr std::string_view tracked[]{
+      list_bucket_results, contents, common_prefixes};
 };
 
 struct abs_tags {
@@ -40,6 +56,10 @@ struct abs_tags {
     static constexpr std::string_view blob_prefix{"BlobPrefix"};
     static constexpr std::string_view enumeration_results{"EnumerationResults"};
     static constexpr std::string_view properties{"Properties"};
+
+    /// Elements the parser checks the path for
+    static constexpr std::string_view tracked[]{
+      enumeration_results, blob, blob_prefix, properties};
 };
 
 } // namespace
@@ -97,7 +117,7 @@ void aws_parse_impl::handle_start_element(std::string_view element_name) {
       element_name == aws_tags::next_continuation_token && is_top_level()) {
         _current_tag = xml_tag::next_continuation_token;
     }
-    _tags.emplace_back(element_name.data(), element_name.size());
+    _tags.push_back(tracked_name(element_name, aws_tags::tracked));
 }
 
 void aws_parse_impl::handle_end_element(std::string_view element_name) {
@@ -215,7 +235,7 @@ void abs_parse_impl::handle_start_element(std::string_view element_name) {
     } else if (element_name == abs_tags::prefix && is_top_level()) {
         _current_tag = xml_tag::prefix;
     }
-    _tags.emplace_back(element_name.data(), element_name.size());
+    _tags.push_back(tracked_name(element_name, abs_tags::tracked));
 }
 
 void abs_parse_impl::handle_end_element(std::string_view element_name) {
@@ -295,8 +315,8 @@ void abs_parse_impl::handle_characters(std::string_view characters) {
     }
 }
 
-client::list_bucket_result parser_state::impl::parsed_items() const {
-    return _items;
+client::list_bucket_result parser_state::impl::parsed_items() {
+    return std::move(_items);
 }
 
 xml_sax_parser::xml_sax_parser(xml_sax_parser&& other) noexcept {
@@ -348,7 +368,7 @@ void xml_sax_parser::end_parse() {
     }
 }
 
-client::list_bucket_result xml_sax_parser::result() const {
+client::list_bucket_result xml_sax_parser::result() {
     return _state->parsed_items();
 }
 
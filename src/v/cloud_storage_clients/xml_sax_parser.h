@@ -54,7 +54,8 @@ struct parser_state {
         virtual void handle_start_element(std::string_view element_name) = 0;
         virtual void handle_end_element(std::string_view element_name) = 0;
         virtual void handle_characters(std::string_view characters) = 0;
-        client::list_bucket_result parsed_items() const;
+        /// Moves the items out of the parser, once the parse is done
+        client::list_bucket_result parsed_items();
 
         virtual ~impl() = default;
 
@@ -64,7 +65,10 @@ struct parser_state {
         std::optional<client::list_bucket_item> _current_item;
 
         xml_tag _current_tag;
-        std::vector<ss::sstring> _tags;
+        /// Path of the current element. Only the names of the elements the
+        /// parser checks the path for are kept, as views of static names, the
+        /// others are empty so that parsing doesn't copy element names.
+        std::vector<std::string_view> _tags;
     };
 
     explicit parser_state(std::unique_ptr<impl>);
@@ -81,7 +85,7 @@ struct parser_state {
         _impl->handle_characters(characters);
     }
 
-    client::list_bucket_result parsed_items() const {
+    client::list_bucket_result parsed_items() {
         return _impl->parsed_items();
     }
 
@@ -137,7 +141,9 @@ public:
     /// make sure that libxml2 parsing is finished.
     void end_parse();
 
-    client::list_bucket_result result() const;
+    /// \brief Moves the parsed result out of the parser, expected to be
+    /// called once after end_parse.
+    client::list_bucket_result result();
 
     /// \brief frees up the parser context pointer
     ~xml_sax_parser();
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/aborted_tx_index.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace cluster::tx {
+
+namespace {
+bool first_less(const model::tx_range& a, const model::tx_range& b) {
+    return a.first < b.first;
+}
+} // namespace
+
+aborted_tx_index::aborted_tx_index(fragmented_vector<model::tx_range> ranges)
+  : _sorted(std::move(ranges)) {
+    std::sort(_sorted.begin(), _sorted.end(), first_less);
+    update_max_last(0);
+}
+
+void aborted_tx_index::push_back(model::tx_range range) {
+    _tail.push_back(range);
+    if (_tail.size() >= max_tail_size) {
+        merge_tail();
+    }
+}
+
+void aborted_tx_index::collect_intersecting(
+  fragmented_vector<model::tx_range>& target,
+  model::offset from,
+  model::offset to) const {
+    auto end = std::upper_bound(
+      _sorted.begin(),
+      _sorted.end(),
+      to,
+      [](model::offset o, const model::tx_range& r) { return o < r.first; });
+    auto first_candidate = std::lower_bound(
+      _max_last.begin(), _max_last.end(), from);
+    for (auto it = _sorted.begin() + (first_candidate - _max_last.begin());
+         it < end;
+         ++it) {
+        if (it->last >= from) {
+            target.push_back(*it);
+        }
+    }
+    for (const auto& range : _tail) {
+        if (range.last >= from && range.first <= to) {
+            target.push_back(range);
+        }
+    }
+}
+
+void aborted_tx_index::remove_ending_before(model::offset offset) {
+    auto ends_before = [offset](const model::tx_range& r) {
+        return r.last < offset;
+    };
+    if (
+      std::none_of(_sorted.begin(), _sorted.end(), ends_before)
+      && std::none_of(_tail.begin(), _tail.end(), ends_before)) {
+        return;
+    }
+    fragmented_vector<model::tx_range> sorted;
+    std::copy_if(
+      _sorted.begin(),
+      _sorted.end(),
+      std::back_inserter(sorted),
+      std::not_fn(ends_before));
+    _sorted = std::move(sorted);
+    fragmented_vector<model::tx_range> tail;
+    std::copy_if(
+      _tail.begin(),
+      _tail.end(),
+      std::back_inserter(tail),
+      std::not_fn(ends_before));
+    _tail = std::move(tail);
+    _max_last.clear();
+    update_max_last(0);
+}
+
+fragmented_vector<model::tx_range> aborted_tx_index::copy() const {
+    auto ranges = _sorted.copy();
+    for (const auto& range : _tail) {
+        ranges.push_back(range);
+    }
+    return ranges;
+}
+
+fragmented_vector<model::tx_range> aborted_tx_index::release() && {
+    if (!_tail.empty()) {
+        merge_tail();
+    }
+    _max_last.clear();
+    return std::exchange(_sorted, {});
+}
+
+void aborted_tx_index::merge_tail() {
+    std::sort(_tail.begin(), _tail.end(), first_less);
+    // the sorted ranges up to the first of the tail stay in place
+    auto unchanged = std::upper_bound(
+                       _sorted.begin(),
+                       _sorted.end(),
+                       _tail.front(),
+                       first_less)
+                     - _sorted.begin();
+    auto merged = _sorted.size();
+    for (const auto& range : _tail) {
+        _sorted.push_back(range);
+    }
+    _tail.clear();
+    std::inplace_merge(
+      _sorted.begin(), _sorted.begin() + merged, _sorted.end(), first_less);
+    _max_last.pop_back_n(_max_last.size() - unchanged);
+    update_max_last(unchanged);
+}
+
+void aborted_tx_index::update_max_last(size_t from) {
+    for (size_t i = from; i < _sorted.size(); ++i) {
+        auto last = _sorted[i].last;
+        _max_last.push_back(i == 0 ? last : std::max(_max_last.back(), last));
+    }
+}
+
+} // namespace cluster::tx
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "container/fragmented_vector.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+
+namespace cluster::tx {
+
+/**
+ * Index of the ranges of aborted transactions, answering which of them
+ * intersect an offset range without scanning all of them.
+ *
+ * Ranges are kept sorted by their first offset along with the running maximum
+ * of their last offsets, so a lookup binary searches both ends of the
+ * candidates: the ranges after the end start after the looked up range, and
+ * the ranges before the start end before it. Transactions are short compared
+ * to the log, so there are few candidates that don't intersect.
+ *
+ * Ranges are added in the order their transactions are aborted, which isn't
+ * the order of their first offsets. Added ranges go to a short unsorted tail
+ * that is merged into the sorted ranges once it grows to `max_tail_size`.
+ */
+class aborted_tx_index {
+public:
+    static constexpr size_t max_tail_size = 128;
+
+    aborted_tx_index() = default;
+    explicit aborted_tx_index(fragmented_vector<model::tx_range>);
+
+    void push_back(model::tx_range);
+
+    /// Appends the ranges intersecting [from, to] to `target`.
+    void collect_intersecting(
+      fragmented_vector<model::tx_range>& target,
+      model::offset from,
+      model::offset to) const;
+
+    /// Removes the ranges that end before `offset`.
+    void remove_ending_before(model::offset offset);
+
+    size_t size() const { return _sorted.size() + _tail.size(); }
+    bool empty() const { return size() == 0; }
+
+    /// Returns a copy of the ranges, in no particular order.
+    fragmented_vector<model::tx_range> copy() const;
+
+    /// Returns the ranges sorted by their first offset.
+    fragmented_vector<model::tx_range> release() &&;
+
+private:
+    void merge_tail();
+    void update_max_last(size_t from);
+
+    // sorted by first offset
+    fragmented_vector<model::tx_range> _sorted;
+    // the largest last offset of the ranges in _sorted up to the same index
+    fragmented_vector<model::offset> _max_last;
+    // ranges added after the last merge
+    fragmented_vector<model::tx_range> _tail;
+};
+
+} // namespace cluster::tx
@@ -31,6 +31,8 @@
 #include <utility>
 
 constexpr size_t compacted_segment_size_multiplier{3};
+// Number of times in a row the timeboxed upload can be postponed
+constexpr size_t max_deferred_uploads{3};
 
 namespace archival {
 
@@ -146,7 +148,10 @@ archival_policy::archival_policy(
   ss::io_priority_class io_priority)
   : _ntp(std::move(ntp))
   , _upload_limit(limit)
-  , _io_priority(io_priority) {}
+  , _io_priority(io_priority)
+  , _min_timeboxed_upload_size(
+      config::shard_local_cfg()
+        .cloud_storage_segment_min_timeboxed_upload_size.bind()) {}
 
 bool archival_policy::upload_deadline_reached() {
     if (!_upload_limit.has_value()) {
@@ -164,6 +169,41 @@ bool archival_policy::upload_deadline_reached() {
     return _upload_deadline < now;
 }
 
+bool archival_policy::defer_small_upload(
+  storage::segment& segment, model::offset start) {
+    const auto min_size = _min_timeboxed_upload_size();
+    if (!min_size.has_value() || _deferred_uploads >= max_deferred_uploads) {
+        return false;
+    }
+    // The index is sparse so the size of the data which is not uploaded yet
+    // is overestimated, it's fine since it only makes the upload happen
+    // earlier.
+    size_t uploaded = 0;
+    if (start > segment.offsets().get_base_offset()) {
+        if (auto entry = segment.index().find_nearest(start); entry) {
+            uploaded = entry->filepos;
+        }
+    }
+    const auto size = segment.size_bytes();
+    const auto pending = size - std::min(uploaded, size);
+    if (pending >= min_size.value()) {
+        return false;
+    }
+    ++_deferred_uploads;
+    if (_upload_limit) {
+        _upload_deadline = ss::lowres_clock::now() + _upload_limit.value()();
+    }
+    vlog(
+      archival_log.debug,
+      "Upload policy for {}: postponing timeboxed upload of {} bytes, "
+      "minimum upload size is {}, postponed {} times",
+      _ntp,
+      pending,
+      min_size.value(),
+      _deferred_uploads);
+    return true;
+}
+
 archival_policy::lookup_result archival_policy::find_segment(
   model::offset start_offset,
   model::offset adjusted_lso,
@@ -249,6 +289,9 @@ archival_policy::lookup_result archival_policy::find_segment(
               kafka_lso);
             return {};
         }
+        if (defer_small_upload(**it, start_offset)) {
+            return {};
+        }
     }
 
     auto dirty_offset = (*it)->offsets().get_dirty_offset();
@@ -265,6 +308,7 @@ archival_policy::lookup_result archival_policy::find_segment(
     if (_upload_limit) {
         _upload_deadline = ss::lowres_clock::now() + _upload_limit.value()();
     }
+    _deferred_uploads = 0;
     return {.segment = *it, .ntp_conf = &ntp_conf, .forced = force_upload};
 }
 
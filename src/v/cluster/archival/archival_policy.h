@@ -14,6 +14,7 @@
 #include "cloud_storage/types.h"
 #include "cluster/archival/probe.h"
 #include "cluster/archival/types.h"
+#include "config/property.h"
 #include "model/fundamental.h"
 #include "storage/fwd.h"
 #include "storage/ntp_config.h"
@@ -118,6 +119,10 @@ private:
     /// result in partial upload.
     bool upload_deadline_reached();
 
+    /// Check if the timeboxed upload of the open segment has to be postponed
+    /// because too little data was added to it since the last upload.
+    bool defer_small_upload(storage::segment& segment, model::offset start);
+
     struct lookup_result {
         ss::lw_shared_ptr<storage::segment> segment;
         const storage::ntp_config* ntp_conf;
@@ -134,6 +139,8 @@ private:
     std::optional<segment_time_limit> _upload_limit;
     std::optional<ss::lowres_clock::time_point> _upload_deadline;
     ss::io_priority_class _io_priority;
+    config::binding<std::optional<size_t>> _min_timeboxed_upload_size;
+    size_t _deferred_uploads{0};
 };
 
 } // namespace archival
@@ -219,6 +219,9 @@ ntp_archiver::ntp_archiver(
   , _sync_manifest_timeout(
       config::shard_local_cfg()
         .cloud_storage_readreplica_manifest_sync_timeout_ms.bind())
+  , _sync_manifest_max_interval(
+      config::shard_local_cfg()
+        .cloud_storage_readreplica_manifest_sync_max_interval_ms.bind())
   , _max_segments_pending_deletion(
       config::shard_local_cfg()
         .cloud_storage_max_segments_pending_deletion_per_partition.bind())
@@ -685,8 +688,10 @@ ss::future<> ntp_archiver::upload_until_term_change() {
             continue;
         }
 
+        _may_defer_manifest_upload = true;
         auto [non_compacted_upload_result, compacted_upload_result]
-          = co_await upload_next_candidates();
+          = co_await upload_next_candidates().finally(
+            [this] { _may_defer_manifest_upload = false; });
         if (non_compacted_upload_result.num_failed != 0) {
             // The logic in class `remote` already does retries: if we get here,
             // it means the upload failed after several retries, justifying
@@ -750,8 +755,16 @@ ss::future<> ntp_archiver::upload_until_term_change() {
 
         // This is the fallback path for uploading manifest if it didn't happen
         // inline with segment uploads: this path will be taken on e.g. restarts
-        // or unclean leadership changes.
-        if (co_await maybe_upload_manifest(upload_loop_epilogue_ctx_label)) {
+        // or unclean leadership changes. A manifest upload deferred by this
+        // round is left to the next round.
+        if (
+          _manifest_upload_deferred
+          && non_compacted_upload_result.num_succeeded != 0) {
+            vlog(
+              _rtclog.debug,
+              "Manifest upload deferred to the next round of uploads");
+        } else if (co_await maybe_upload_manifest(
+                     upload_loop_epilogue_ctx_label)) {
             co_await flush_manifest_clean_offset();
         } else {
             // No manifest upload, but if some background task had incremented
@@ -810,6 +823,7 @@ ss::future<> ntp_archiver::sync_manifest_until_term_change() {
             continue;
         }
 
+        const auto prev_sync_time = _last_sync_time;
         cloud_storage::download_result result = co_await sync_manifest();
 
         if (result != cloud_storage::download_result::success) {
@@ -826,8 +840,24 @@ ss::future<> ntp_archiver::sync_manifest_until_term_change() {
               "Successfuly downloaded manifest {}",
               manifest().get_manifest_path(remote_path_provider()));
         }
-        co_await ss::sleep_abortable(_sync_manifest_timeout(), _as);
+        // The sync time only moves when a new manifest is replicated.
+        const bool idle = result == cloud_storage::download_result::success
+                          && _last_sync_time == prev_sync_time;
+        co_await ss::sleep_abortable(next_sync_manifest_interval(idle), _as);
+    }
+}
+
+ss::lowres_clock::duration
+ntp_archiver::next_sync_manifest_interval(bool idle) {
+    const ss::lowres_clock::duration base = _sync_manifest_timeout();
+    const auto max_interval = _sync_manifest_max_interval();
+    if (!idle || !max_interval.has_value() || max_interval.value() <= base) {
+        _sync_manifest_interval = base;
+    } else {
+        _sync_manifest_interval = std::clamp<ss::lowres_clock::duration>(
+          _sync_manifest_interval * 2, base, max_interval.value());
     }
+    return _sync_manifest_interval;
 }
 
 ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
@@ -862,7 +892,6 @@ ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
                               .cloud_storage_metadata_sync_timeout_ms.value();
         auto deadline = ss::lowres_clock::now() + sync_timeout;
 
-        auto serialized = m.to_iobuf();
         auto builder = _parent.archival_meta_stm()->batch_start(deadline, _as);
         builder.replace_manifest(m.to_iobuf());
 
@@ -1094,6 +1123,25 @@ ss::future<> ntp_archiver::flush_manifest_clean_offset() {
     }
 }
 
+std::optional<model::offset> ntp_archiver::add_projected_clean_offset(
+  cluster::command_batch_builder& builder) {
+    if (
+      _projected_manifest_clean_at
+      > _parent.archival_meta_stm()->get_last_clean_at()) {
+        builder.mark_clean(_projected_manifest_clean_at.value());
+        return _projected_manifest_clean_at;
+    }
+    return std::nullopt;
+}
+
+void ntp_archiver::projected_clean_offset_flushed(model::offset clean_offset) {
+    _last_marked_clean_time = ss::lowres_clock::now();
+    // The manifest could be uploaded again while the batch was replicated
+    if (_projected_manifest_clean_at == clean_offset) {
+        _projected_manifest_clean_at.reset();
+    }
+}
+
 ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
   const char* upload_ctx,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
@@ -1117,6 +1165,9 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
       &rtc.get());
     retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
 
+    // Any manifest upload includes the segments of a deferred upload
+    _manifest_upload_deferred = false;
+
     auto upload_insync_offset = manifest().get_insync_offset();
 
     auto path = manifest().get_manifest_path(remote_path_provider());
@@ -1831,11 +1882,24 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
     // We may upload manifest in parallel with segments when using time-based
     // (interval) manifest uploads.  If we aren't using an interval, then the
     // manifest will always be immediately updated after segment uploads, so
-    // there is no point doing it in parallel as well.
-    bool upload_manifest_in_parallel
-      = inline_manifest && _manifest_upload_interval().has_value();
-
-    if (upload_manifest_in_parallel) {
+    // there is no point doing it in parallel as well, unless the previous
+    // round deferred that update to this round.
+    const bool upload_deferred_manifest = inline_manifest
+                                          && _manifest_upload_deferred;
+    bool upload_manifest_in_parallel = upload_deferred_manifest
+                                       || (inline_manifest
+                                           && _manifest_upload_interval()
+                                                .has_value());
+
+    if (upload_deferred_manifest) {
+        // The manifest reflects the segments added by the previous round,
+        // the segments of this round are added to the stm after it.
+        flist.push_back(upload_manifest(concurrent_with_segs_ctx_label)
+                          .then([](cloud_storage::upload_result) {
+                              return ntp_archiver_upload_result{
+                                cloud_storage::upload_result::success};
+                          }));
+    } else if (upload_manifest_in_parallel) {
         // Munge the output of maybe_upload_manifest into an upload result,
         // so that we can conveniently await it along with our segment
         // uploads.  The actual result is reflected in
@@ -2002,14 +2066,26 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
         if (
           inline_manifest
           && (stm_was_clean || !_manifest_upload_interval().has_value())) {
-            // This is the path for uploading manifests for infrequent*
-            // segment uploads: we transitioned from clean to dirty, and the
-            // manifest upload interval has expired.
-            //
-            // * infrequent means we're uploading a segment less often than the
-            //   manifest upload interval, so can afford to upload manifest
-            //   immediately after each segment upload.
-            co_await maybe_upload_manifest(post_add_segs_ctx_label);
+            if (
+              _may_defer_manifest_upload
+              && segment_kind == segment_upload_kind::non_compacted
+              && total.num_failed == 0 && total.num_cancelled == 0
+              && total.num_succeeded >= _concurrency) {
+                // All upload slots were used so there is more data to upload
+                // and the next round starts without a backoff. Upload the
+                // manifest concurrently with that round instead of making
+                // it wait for the upload.
+                _manifest_upload_deferred = true;
+            } else {
+                // This is the path for uploading manifests for infrequent*
+                // segment uploads: we transitioned from clean to dirty, and
+                // the manifest upload interval has expired.
+                //
+                // * infrequent means we're uploading a segment less often
+                //   than the manifest upload interval, so can afford to upload
+                //   manifest immediately after each segment upload.
+                co_await maybe_upload_manifest(post_add_segs_ctx_label);
+            }
         }
     }
 
@@ -2673,6 +2749,7 @@ ss::future<> ntp_archiver::apply_spillover() {
             batch.truncate_archive_init(first.base_offset, first.delta_offset);
             batch.cleanup_archive(first.base_offset, 0);
         }
+        auto clean_offset = add_projected_clean_offset(batch);
         auto error = co_await batch.replicate();
         if (error != cluster::errc::success) {
             vlog(
@@ -2680,6 +2757,9 @@ ss::future<> ntp_archiver::apply_spillover() {
               "Failed to replicate spillover command: {}",
               error.message());
         } else {
+            if (clean_offset.has_value()) {
+                projected_clean_offset_flushed(*clean_offset);
+            }
             vlog(
               _rtclog.info,
               "Uploaded spillover manifest: {}",
@@ -2822,14 +2902,23 @@ ss::future<> ntp_archiver::apply_retention() {
         auto sync_timeout = config::shard_local_cfg()
                               .cloud_storage_metadata_sync_timeout_ms.value();
         auto deadline = ss::lowres_clock::now() + sync_timeout;
-        auto error = co_await _parent.archival_meta_stm()->truncate(
-          *next_start_offset, deadline, _as);
+        if (
+          *next_start_offset
+          < _parent.archival_meta_stm()->get_start_offset()) {
+            co_return;
+        }
+        auto batch = _parent.archival_meta_stm()->batch_start(deadline, _as);
+        batch.truncate(*next_start_offset);
+        auto clean_offset = add_projected_clean_offset(batch);
+        auto error = co_await batch.replicate();
         if (error != cluster::errc::success) {
             vlog(
               _rtclog.warn,
               "Failed to update archival metadata STM start offest according "
               "to retention policy: {}",
               error);
+        } else if (clean_offset.has_value()) {
+            projected_clean_offset_flushed(*clean_offset);
         }
     } else {
         vlog(
@@ -2912,14 +3001,20 @@ ss::future<> ntp_archiver::garbage_collect() {
         auto sync_timeout = config::shard_local_cfg()
                               .cloud_storage_metadata_sync_timeout_ms.value();
         auto deadline = ss::lowres_clock::now() + sync_timeout;
-        auto error = co_await _parent.archival_meta_stm()->cleanup_metadata(
-          deadline, _as);
+        // The manifest was just uploaded, the clean offset is replicated along
+        // with the cleanup.
+        auto batch = _parent.archival_meta_stm()->batch_start(deadline, _as);
+        batch.cleanup_metadata();
+        auto clean_offset = add_projected_clean_offset(batch);
+        auto error = co_await batch.replicate();
 
         if (error != cluster::errc::success) {
             vlog(
               _rtclog.info,
               "Failed to clean up metadata after garbage collection: {}",
               error);
+        } else if (clean_offset.has_value()) {
+            projected_clean_offset_flushed(*clean_offset);
         }
     } else {
         vlog(
@@ -33,6 +33,10 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+namespace cluster {
+class command_batch_builder;
+} // namespace cluster
+
 namespace archival {
 
 // Forward declaration for test class that we will befriend
@@ -577,6 +581,17 @@ private:
     /// set by some background operation.
     ss::future<> maybe_flush_manifest_clean_offset();
 
+    /// Add the projected manifest clean offset to a batch of STM commands,
+    /// so that it's replicated with them rather than in a batch of its own.
+    ///
+    /// \return the offset which is marked clean by the batch
+    std::optional<model::offset>
+    add_projected_clean_offset(cluster::command_batch_builder& builder);
+
+    /// Called after the batch returned by add_projected_clean_offset is
+    /// replicated
+    void projected_clean_offset_flushed(model::offset clean_offset);
+
     /// While leader, within a particular term, keep trying to upload data
     /// from local storage to remote storage until our term changes or
     /// our abort source fires.
@@ -594,6 +609,11 @@ private:
     /// abort source fires.
     ss::future<> sync_manifest_until_abort();
 
+    /// Returns the delay before the next read replica manifest sync. While the
+    /// remote manifest stays unchanged the delay is doubled, up to the
+    /// configured maximum. Any change resets it to the sync timeout.
+    ss::lowres_clock::duration next_sync_manifest_interval(bool idle);
+
     /// Delete a segment and its transaction metadata from S3.
     /// The transaction metadata is only deleted if the segment
     /// deletion was successful.
@@ -672,6 +692,9 @@ private:
 
     ss::lw_shared_ptr<const configuration> _conf;
     config::binding<std::chrono::milliseconds> _sync_manifest_timeout;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _sync_manifest_max_interval;
+    ss::lowres_clock::duration _sync_manifest_interval{};
     config::binding<size_t> _max_segments_pending_deletion;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
     size_t _concurrency{4};
@@ -740,6 +763,15 @@ private:
     // without persisting this clean offset to the stm.
     std::optional<model::offset> _projected_manifest_clean_at;
 
+    // Set when the manifest upload which follows a round of segment uploads
+    // is postponed so that it runs concurrently with the next round. This
+    // happens when the round used all upload slots, the next round is likely
+    // to start right away.
+    bool _manifest_upload_deferred{false};
+    // Only the upload loop runs the rounds back to back, other callers of
+    // upload_next_candidates expect the manifest to be uploaded by the call.
+    bool _may_defer_manifest_upload{false};
+
     // If this duration has elapsed since _last_manifest_upload_time,
     // then upload at the next opportunity.
     config::binding<std::optional<std::chrono::seconds>>
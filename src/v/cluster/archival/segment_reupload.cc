@@ -553,6 +553,47 @@ ss::future<candidate_creation_result> segment_collector::make_upload_candidate(
         }
     }
 
+    // Rewriting a range which local compaction barely changed costs a full
+    // upload of the range for little reclaimed space, keep such ranges as
+    // they are.
+    if (const auto min_savings_percent
+        = config::shard_local_cfg()
+            .cloud_storage_compacted_reupload_min_savings_percent();
+        min_savings_percent > 0) {
+        size_t replaced_size = 0;
+        bool range_aligned = false;
+        for (auto it = _manifest.find(starting_offset);
+             it != _manifest.end() && it->base_offset <= final_offset;
+             ++it) {
+            replaced_size += it->size_bytes;
+            if (it->committed_offset == final_offset) {
+                range_aligned = true;
+                break;
+            }
+        }
+        const auto savings = replaced_size > content_length
+                               ? replaced_size - content_length
+                               : 0;
+        if (
+          range_aligned
+          && savings * 100 < replaced_size * min_savings_percent) {
+            vlog(
+              archival_log.debug,
+              "Skipping re-upload of compacted range [{}, {}], size reduced "
+              "from {} to {} bytes which is less than {}%",
+              starting_offset,
+              final_offset,
+              replaced_size,
+              content_length,
+              min_savings_percent);
+
+            co_return skip_offset_range{
+              .begin_offset = _begin_inclusive,
+              .end_offset = _end_inclusive,
+              .reason = candidate_creation_error::upload_size_unchanged};
+        }
+    }
+
     co_return upload_candidate_with_locks{
       upload_candidate{
         .exposed_name = adjust_segment_name(),
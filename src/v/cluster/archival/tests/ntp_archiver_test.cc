@@ -1104,6 +1104,57 @@ SEASTAR_THREAD_TEST_CASE(test_archival_policy_timeboxed_uploads) {
     b.stop().get();
 }
 
+// NOLINTNEXTLINE
+SEASTAR_THREAD_TEST_CASE(test_archival_policy_small_timeboxed_uploads) {
+    auto cfg = scoped_config{};
+    cfg.get("cloud_storage_segment_min_timeboxed_upload_size")
+      .set_value(std::optional<size_t>{1024 * 1024});
+
+    storage::disk_log_builder b(
+      storage::log_builder_config(),
+      model::offset_translator_batch_types(),
+      raft::group_id{0});
+    b | storage::start(manifest_ntp);
+
+    archival::archival_policy policy(manifest_ntp, segment_time_limit{0s});
+
+    auto log = b.get_log();
+    log->start(std::nullopt).get();
+
+    b | storage::add_segment(model::offset{0})
+      | storage::add_random_batch(model::offset{0}, 10);
+    BOOST_REQUIRE_EQUAL(log->offsets().dirty_offset, model::offset{9});
+
+    auto get_next_candidate = [&] {
+        return policy
+          .get_next_candidate(
+            model::offset{0},
+            log->offsets().dirty_offset + model::offset{1},
+            std::nullopt,
+            log,
+            segment_read_lock_timeout)
+          .get();
+    };
+
+    // The open segment is far below the minimum upload size, the deadline
+    // is postponed three times before the upload is forced.
+    for (int i = 0; i < 3; ++i) {
+        require_candidate_creation_error(
+          get_next_candidate(),
+          candidate_creation_error::no_segment_for_begin_offset);
+    }
+    auto upload = require_upload_candidate(get_next_candidate()).candidate;
+    BOOST_REQUIRE_EQUAL(upload.starting_offset, model::offset{0});
+    BOOST_REQUIRE_EQUAL(upload.final_offset, model::offset{9});
+
+    // The counter is reset by the upload
+    require_candidate_creation_error(
+      get_next_candidate(),
+      candidate_creation_error::no_segment_for_begin_offset);
+
+    b.stop().get();
+}
+
 // NOLINTNEXTLINE
 FIXTURE_TEST(test_upload_segments_leadership_transfer, archiver_fixture) {
     // This test simulates leadership transfer. In this situation the
@@ -18,6 +18,7 @@
 #include "storage/log_manager.h"
 #include "storage/tests/utils/disk_log_builder.h"
 #include "test_utils/archival.h"
+#include "test_utils/scoped_config.h"
 #include "test_utils/tmp_dir.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -990,6 +991,73 @@ SEASTAR_THREAD_TEST_CASE(test_same_size_reupload_skipped) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_reupload_with_small_savings_skipped) {
+    // With cloud_storage_compacted_reupload_min_savings_percent set the
+    // range is re-uploaded only if local compaction reduced its size enough.
+    auto ntp = model::ntp{"test_ns", "test_tpc", 0};
+    temporary_dir tmp_dir("concat_segment_read");
+    auto data_path = tmp_dir.get_path();
+    using namespace storage;
+
+    auto b = make_log_builder(data_path.string());
+
+    auto o = std::make_unique<ntp_config::default_overrides>();
+    o->cleanup_policy_bitflags = model::cleanup_policy_bitflags::compaction;
+    b | start(ntp_config{ntp, {data_path}, std::move(o)});
+    auto defer = ss::defer([&b] { b.stop().get(); });
+
+    b | storage::add_segment(0) | storage::add_random_batch(0, 2);
+    auto seg_size = b.get_segment(0).size_bytes();
+
+    // The segment in the manifest is 10% larger than the compacted one
+    cloud_storage::partition_manifest m(ntp, model::initial_revision_id{1});
+    m.add(
+      segment_name("0-1-v1.log"),
+      cloud_storage::segment_meta{
+        .is_compacted = false,
+        .size_bytes = seg_size + seg_size / 10,
+        .base_offset = model::offset(0),
+        .committed_offset = model::offset(1),
+        .delta_offset = model::offset_delta(0),
+        .delta_offset_end = model::offset_delta(0)});
+
+    b.get_segment(0).mark_as_finished_self_compaction();
+    b.get_segment(0).mark_as_finished_windowed_compaction();
+
+    scoped_config cfg;
+    cfg.get("cloud_storage_compacted_reupload_min_savings_percent")
+      .set_value(size_t{50});
+    {
+        archival::segment_collector collector{
+          model::offset{0}, m, b.get_disk_log_impl(), seg_size};
+
+        collector.collect_segments();
+        BOOST_REQUIRE(collector.should_replace_manifest_segment());
+
+        require_skip_offset(
+          collector.make_upload_candidate(ss::default_priority_class(), 1s)
+            .get(),
+          candidate_creation_error::upload_size_unchanged,
+          model::offset{1});
+    }
+
+    cfg.get("cloud_storage_compacted_reupload_min_savings_percent")
+      .set_value(size_t{5});
+    {
+        archival::segment_collector collector{
+          model::offset{0}, m, b.get_disk_log_impl(), seg_size};
+
+        collector.collect_segments();
+        BOOST_REQUIRE(collector.should_replace_manifest_segment());
+
+        auto upload_with_locks = require_upload_candidate(
+          collector.make_upload_candidate(ss::default_priority_class(), 1s)
+            .get());
+        BOOST_REQUIRE_EQUAL(
+          upload_with_locks.candidate.content_length, seg_size);
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_do_not_reupload_self_concatenated) {
     auto ntp = model::ntp{"test_ns", "test_tpc", 0};
     temporary_dir tmp_dir("concat_segment_read");
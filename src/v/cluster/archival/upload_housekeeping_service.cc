@@ -220,6 +220,7 @@ void upload_housekeeping_service::register_jobs(
     for (auto ref : jobs) {
         vlog(archival_log.debug, "Registering job: {}", ref.get().name());
         _filter.add_source_to_ignore(ref.get().get_root_retry_chain_node());
+        _remote.add_background_source(ref.get().get_root_retry_chain_node());
         _workflow.register_job(ref.get());
     }
 }
@@ -230,6 +231,8 @@ void upload_housekeeping_service::deregister_jobs(
         vlog(archival_log.debug, "Deregistering job: {}", ref.get().name());
         _workflow.deregister_job(ref.get());
         _filter.remove_source_to_ignore(ref.get().get_root_retry_chain_node());
+        _remote.remove_background_source(
+          ref.get().get_root_retry_chain_node());
     }
 }
 
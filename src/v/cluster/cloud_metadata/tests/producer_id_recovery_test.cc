@@ -13,11 +13,13 @@
 #include "cluster/id_allocator_frontend.h"
 #include "cluster/partition.h"
 #include "cluster/tests/tx_compaction_utils.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
 #include "redpanda/tests/fixture.h"
 #include "test_utils/test.h"
 
+#include <absl/container/flat_hash_set.h>
 #include <gtest/gtest.h>
 
 static ss::logger test_log("pid_recovery");
@@ -129,3 +131,39 @@ TEST_F(ProducerIdRecoveryTest, TestRecoveryDoesntLower) {
     // The next pid shouldn't go down.
     ASSERT_EQ(last_pid() + 4, id_reply.id);
 }
+
+TEST_F(ProducerIdRecoveryTest, TestPrefetchedIdsAreUnique) {
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().id_allocator_prefetch_size.set_value(
+          int16_t{10});
+    }).get();
+    auto num_txns = 10;
+    auto last_pid = model::producer_id{num_txns - 1};
+    generate_txn_data(num_txns);
+
+    producer_id_recovery_manager recovery_mgr(
+      app.controller->get_members_table(),
+      app._connection_cache,
+      app.id_allocator_frontend);
+    ASSERT_EQ(error_outcome::success, recovery_mgr.recover().get());
+
+    absl::flat_hash_set<int64_t> ids;
+    auto allocate = [&] {
+        for (int i = 0; i < 50; i++) {
+            auto id_reply
+              = app.id_allocator_frontend.local().allocate_id(1s).get();
+            ASSERT_EQ(cluster::errc::success, id_reply.ec);
+            ASSERT_GT(id_reply.id, last_pid());
+            ASSERT_TRUE(ids.insert(id_reply.id).second);
+        }
+    };
+    allocate();
+    // recovering drops the prefetched ids, the ones allocated after it must
+    // still be new
+    ASSERT_EQ(error_outcome::success, recovery_mgr.recover().get());
+    allocate();
+
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().id_allocator_prefetch_size.reset();
+    }).get();
+}
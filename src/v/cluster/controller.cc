@@ -311,6 +311,8 @@ ss::future<> controller::start(
       _raft0->self().id(),
       ss::sharded_parameter(
         [this] { return std::ref(_partition_leaders.local()); }),
+      ss::sharded_parameter(
+        [this] { return std::ref(_partition_manager.local()); }),
       ss::sharded_parameter([this] { return std::ref(_as.local()); }));
     {
         limiter_configuration limiter_conf{
@@ -338,6 +340,7 @@ ss::future<> controller::start(
           std::move(limiter_conf),
           std::ref(_feature_table),
           config::shard_local_cfg().controller_snapshot_max_age_sec.bind(),
+          config::shard_local_cfg().controller_snapshot_max_log_bytes.bind(),
           std::ref(clusterlog),
           _raft0.get(),
           raft::persistent_last_applied::yes,
@@ -483,8 +486,10 @@ ss::future<> controller::start(
       std::ref(_storage),
       std::ref(_tp_state),
       std::ref(_backend),
+      std::ref(_partition_manager),
       config::shard_local_cfg().core_balancing_on_core_count_change.bind(),
       config::shard_local_cfg().core_balancing_continuous.bind(),
+      config::shard_local_cfg().core_balancing_throughput_aware.bind(),
       config::shard_local_cfg().core_balancing_debounce_timeout.bind(),
       config::shard_local_cfg().topic_partitions_per_shard.bind(),
       config::shard_local_cfg().topic_partitions_reserve_shard0.bind());
@@ -28,12 +28,14 @@
 #include "cluster/types.h"
 #include "config/configuration.h"
 #include "config/node_config.h"
+#include "container/fragmented_vector.h"
 #include "features/feature_table.h"
 #include "metrics/prometheus_sanitize.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/fundamental.h"
 #include "raft/group_configuration.h"
+#include "ssx/async_algorithm.h"
 #include "ssx/event.h"
 #include "ssx/future-util.h"
 #include "storage/offset_translator.h"
@@ -46,6 +48,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/coroutine/switch_to.hh>
 #include <seastar/util/later.hh>
 #include <seastar/util/variant_utils.hh>
@@ -409,21 +412,27 @@ void controller_backend::setup_metrics() {
  * If topic is not presented in this snapshot or its revision
  * its revision is less than in this snapshot then this topic
  * directory is orphan
+ *
+ * Yields between topics so that building the snapshot of a large cluster
+ * doesn't stall the reactor. The topic metadata reference is never held
+ * across a scheduling point.
  */
-static absl::flat_hash_map<model::ntp, model::revision_id>
+static ss::future<absl::flat_hash_map<model::ntp, model::revision_id>>
 create_topic_table_snapshot(
   ss::sharded<cluster::topic_table>& topics, model::node_id current_node) {
     absl::flat_hash_map<model::ntp, model::revision_id> snapshot;
 
     for (const auto& nt : topics.local().all_topics()) {
+        co_await ss::coroutine::maybe_yield();
         auto ntp_view = model::topic_namespace_view(nt);
-        auto ntp_meta = topics.local().get_topic_metadata(ntp_view);
-        if (!ntp_meta) {
+        auto ntp_meta_ref = topics.local().get_topic_metadata_ref(ntp_view);
+        if (!ntp_meta_ref) {
             continue;
         }
-        for (const auto& [_, p] : ntp_meta->get_assignments()) {
+        const auto& ntp_meta = ntp_meta_ref->get();
+        for (const auto& [_, p] : ntp_meta.get_assignments()) {
             auto ntp = model::ntp(nt.ns, nt.tp, p.id);
-            auto revision_id = ntp_meta->get_revision();
+            auto revision_id = ntp_meta.get_revision();
             if (cluster::contains_node(p.replicas, current_node)) {
                 snapshot.emplace(ntp, revision_id);
                 continue;
@@ -446,7 +455,7 @@ create_topic_table_snapshot(
             }
         }
     }
-    return snapshot;
+    co_return snapshot;
 }
 
 ss::future<> controller_backend::start() {
@@ -454,19 +463,19 @@ ss::future<> controller_backend::start() {
     return bootstrap_controller_backend().then([this] {
         if (ss::this_shard_id() == cluster::controller_stm_shard) {
             auto bootstrap_revision = _topics.local().last_applied_revision();
-            auto snapshot = create_topic_table_snapshot(_topics, _self);
-            ssx::spawn_with_gate(
-              _gate,
-              [this, bootstrap_revision, snapshot = std::move(snapshot)] {
-                  return clear_orphan_topic_files(
-                           bootstrap_revision, std::move(snapshot))
-                    .handle_exception([](const std::exception_ptr& err) {
-                        vlog(
-                          clusterlog.error,
-                          "Exception while cleaning orphan files {}",
-                          err);
-                    });
-              });
+            ssx::spawn_with_gate(_gate, [this, bootstrap_revision] {
+                return create_topic_table_snapshot(_topics, _self)
+                  .then([this, bootstrap_revision](auto snapshot) {
+                      return clear_orphan_topic_files(
+                        bootstrap_revision, std::move(snapshot));
+                  })
+                  .handle_exception([](const std::exception_ptr& err) {
+                      vlog(
+                        clusterlog.error,
+                        "Exception while cleaning orphan files {}",
+                        err);
+                  });
+            });
         }
 
         // unblock reconciliation fibers
@@ -478,10 +487,9 @@ ss::future<> controller_backend::start() {
 }
 
 ss::future<> controller_backend::bootstrap_controller_backend() {
-    for (const auto& [ntp, _] : _shard_placement.shard_local_states()) {
-        notify_reconciliation(ntp);
-    }
-
+    // Subscribe first, so that no delta is missed while the local partitions
+    // are being notified below. Notifying a partition that already has a
+    // reconciliation fiber only wakes it up.
     _topic_table_notify_handle = _topics.local().register_delta_notification(
       [this](topic_table::delta_range_t deltas_range) {
           for (const auto& d : deltas_range) {
@@ -489,7 +497,30 @@ ss::future<> controller_backend::bootstrap_controller_backend() {
           }
       });
 
-    co_return;
+    // The placement table may change while we yield, so iterate over a copy of
+    // the local partitions. Reconciliation fibers acquire units in the order
+    // they are started, so partitions for which this node is the preferred
+    // leader (first replica) are notified first: they are the ones clients
+    // wait for after a restart, while followers can catch up later.
+    chunked_vector<model::ntp> local_ntps;
+    chunked_vector<model::ntp> follower_ntps;
+    for (const auto& [ntp, _] : _shard_placement.shard_local_states()) {
+        auto assignment = _topics.local().get_partition_assignment(ntp);
+        if (
+          assignment && !assignment->replicas.empty()
+          && assignment->replicas.front().node_id == _self) {
+            local_ntps.push_back(ntp);
+        } else {
+            follower_ntps.push_back(ntp);
+        }
+    }
+    for (auto& ntp : follower_ntps) {
+        local_ntps.push_back(std::move(ntp));
+    }
+    co_await ssx::async_for_each(
+      local_ntps.begin(), local_ntps.end(), [this](const model::ntp& ntp) {
+          notify_reconciliation(ntp);
+      });
 }
 
 namespace {
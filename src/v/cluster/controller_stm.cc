@@ -31,13 +31,43 @@ ss::future<> controller_stm::on_batch_applied() {
     }
 
     auto current_offset = model::next_offset(last_applied_offset());
-    if (
-      current_offset > _raft->last_snapshot_index()
-      && !_snapshot_debounce_timer.armed()) {
+    if (current_offset <= _raft->last_snapshot_index()) {
+        co_return;
+    }
+    if (snapshot_log_size_exceeded()) {
+        // Do not wait for the debounce timer when the log has grown large,
+        // the snapshot is composed in the background either way.
+        _snapshot_debounce_timer.cancel();
+        _size_triggered_snapshot = true;
+        vlog(
+          clusterlog.info,
+          "controller log size since last snapshot exceeds {} bytes, "
+          "writing snapshot",
+          _snapshot_max_log_bytes().value());
+        ssx::background
+          = ssx::spawn_with_gate_then(_gate, [this] {
+                return maybe_write_snapshot().discard_result();
+            })
+              .handle_exception([](const std::exception_ptr& e) {
+                  vlog(clusterlog.warn, "failed to write snapshot: {}", e);
+              })
+              .finally([this] { _size_triggered_snapshot = false; });
+        co_return;
+    }
+    if (!_snapshot_debounce_timer.armed()) {
         _snapshot_debounce_timer.arm(_snapshot_max_age());
     };
 }
 
+bool controller_stm::snapshot_log_size_exceeded() const {
+    if (_size_triggered_snapshot || !_snapshot_max_log_bytes().has_value()) {
+        return false;
+    }
+    auto log = _raft->log();
+    return log->size_bytes_after_offset(_raft->last_snapshot_index())
+           >= _snapshot_max_log_bytes().value();
+}
+
 ss::future<> controller_stm::shutdown() {
     _snapshot_debounce_timer.cancel();
     return base_t::stop();
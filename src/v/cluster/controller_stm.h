@@ -48,11 +48,13 @@ public:
       limiter_configuration limiter_conf,
       const ss::sharded<features::feature_table>& feature_table,
       config::binding<std::chrono::seconds>&& snapshot_max_age,
+      config::binding<std::optional<size_t>>&& snapshot_max_log_bytes,
       Args&&... stm_args)
       : mux_state_machine(std::forward<Args>(stm_args)...)
       , _limiter(std::move(limiter_conf))
       , _feature_table(feature_table.local())
       , _snapshot_max_age(std::move(snapshot_max_age))
+      , _snapshot_max_log_bytes(std::move(snapshot_max_log_bytes))
       , _snapshot_debounce_timer([this] { snapshot_timer_callback(); }) {}
 
     controller_stm(controller_stm&&) = delete;
@@ -84,6 +86,7 @@ public:
 private:
     ss::future<> on_batch_applied() final;
     void snapshot_timer_callback();
+    bool snapshot_log_size_exceeded() const;
 
     ss::future<std::optional<iobuf>>
     maybe_make_snapshot(ssx::semaphore_units apply_mtx_holder) final;
@@ -93,10 +96,14 @@ private:
     controller_log_limiter _limiter;
     const features::feature_table& _feature_table;
     config::binding<std::chrono::seconds> _snapshot_max_age;
+    config::binding<std::optional<size_t>> _snapshot_max_log_bytes;
 
     metrics_reporter_cluster_info _metrics_reporter_cluster_info;
 
     ss::timer<ss::lowres_clock> _snapshot_debounce_timer;
+    // set while a snapshot triggered by the log size is being written, so
+    // that batches applied in the meantime do not queue up more of them
+    bool _size_triggered_snapshot = false;
 };
 
 static constexpr ss::shard_id controller_stm_shard = 0;
@@ -11,7 +11,10 @@
 #include "cluster/data_migration_worker.h"
 
 #include "base/vassert.h"
+#include "cluster/archival/ntp_archiver_service.h"
 #include "cluster/data_migration_types.h"
+#include "cluster/partition.h"
+#include "cluster/partition_manager.h"
 #include "errc.h"
 #include "logger.h"
 #include "model/fundamental.h"
@@ -32,9 +35,13 @@ namespace cluster::data_migrations {
 
 // TODO: add configuration property
 worker::worker(
-  model::node_id self, partition_leaders_table& leaders, ss::abort_source& as)
+  model::node_id self,
+  partition_leaders_table& leaders,
+  partition_manager& partition_manager,
+  ss::abort_source& as)
   : _self(self)
   , _leaders_table(leaders)
+  , _partition_manager(partition_manager)
   , _as(as)
   , _operation_timeout(5s) {}
 
@@ -188,19 +195,16 @@ ss::future<errc> worker::do_work(
   const model::ntp& ntp,
   state sought_state,
   const outbound_partition_work_info& pwi) {
+    std::ignore = pwi;
     switch (sought_state) {
     case state::prepared:
-        // todo: perform action here; remember to capture any values needed,
-        // worker doesn't keep them for you across scheduling points
-        std::ignore = ntp;
-        std::ignore = pwi;
-        return ssx::now(errc::success);
+        // Pre-copy: writes are still accepted, upload everything there is so
+        // far while the topic is available.
+        return flush_to_cloud(ntp);
     case state::executed:
-        // todo: perform action here; remember to capture any values needed,
-        // worker doesn't keep them for you across scheduling points
-        std::ignore = ntp;
-        std::ignore = pwi;
-        return ssx::now(errc::success);
+        // Writes are blocked now, only the delta produced since the pre-copy
+        // is left to be uploaded.
+        return flush_to_cloud(ntp);
     default:
         vassert(
           false,
@@ -210,6 +214,38 @@ ss::future<errc> worker::do_work(
     }
 }
 
+ss::future<errc> worker::flush_to_cloud(model::ntp ntp) {
+    auto partition = _partition_manager.get(ntp);
+    if (!partition) {
+        co_return errc::partition_not_exists;
+    }
+    auto archiver = partition->archiver();
+    if (!archiver) {
+        // not a tiered storage partition, nothing to upload
+        co_return errc::success;
+    }
+    auto flush = archiver->get().flush();
+    if (flush.response != archival::flush_response::accepted) {
+        co_return errc::not_leader;
+    }
+    vlog(
+      dm_log.debug,
+      "flushing ntp {} to cloud storage up to offset {}",
+      ntp,
+      flush.offset.value());
+    auto result = co_await archiver->get().wait(flush.offset.value());
+    switch (result) {
+    case archival::wait_result::complete:
+    case archival::wait_result::not_in_progress:
+        // not_in_progress means the flush has already completed
+        co_return errc::success;
+    case archival::wait_result::lost_leadership:
+        co_return errc::not_leader;
+    case archival::wait_result::failed:
+        co_return errc::partition_operation_failed;
+    }
+}
+
 void worker::spawn_work_if_leader(managed_ntp_it it) {
     vassert(!it->second.is_running, "work already running");
     if (!it->second.is_leader) {
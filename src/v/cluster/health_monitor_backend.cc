@@ -26,6 +26,7 @@
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/fwd.h"
+#include "random/generators.h"
 #include "rpc/connection_cache.h"
 #include "storage/types.h"
 
@@ -73,7 +74,8 @@ health_monitor_backend::health_monitor_backend(
   , _partition_leaders_table(partition_leaders_table)
   , _topic_table(topic_table)
   , _local_monitor(local_monitor)
-  , _self(_raft0->self().id()) {}
+  , _self(_raft0->self().id())
+  , _next_report_id(random_generators::get_int<uint64_t>()) {}
 
 cluster::notification_id_type
 health_monitor_backend::register_node_callback(health_node_cb_t cb) {
@@ -360,20 +362,69 @@ health_monitor_backend::maybe_refresh_cluster_health(
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
-    return _connections.local()
-      .with_node_client<controller_client_protocol>(
-        _self,
-        ss::this_shard_id(),
-        id,
-        max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
-            return client.collect_node_health_report(
-              get_node_health_request{}, rpc::client_opts(timeout));
-        })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
-      });
+    std::optional<health_report_id> base_id;
+    nhr_ptr base;
+    if (auto it = _report_ids.find(id); it != _report_ids.end()) {
+        if (auto r_it = _reports.find(id); r_it != _reports.end()) {
+            base_id = it->second;
+            base = r_it->second;
+        }
+    }
+
+    auto reply = co_await _connections.local()
+                   .with_node_client<controller_client_protocol>(
+                     _self,
+                     ss::this_shard_id(),
+                     id,
+                     max_metadata_age(),
+                     [timeout, base_id](controller_client_protocol client) {
+                         return client.collect_node_health_report(
+                           get_node_health_request{
+                             base_id, /*accepts_compressed_report=*/true},
+                           rpc::client_opts(timeout));
+                     })
+                   .then(&rpc::get_ctx_data<get_node_health_reply>);
+
+    _report_ids.erase(id);
+    if (reply && reply.value().compressed_report) {
+        auto& r = reply.value();
+        try {
+            r.report = co_await decompress_node_health_report(
+              std::move(*r.compressed_report));
+        } catch (...) {
+            vlog(
+              clusterlog.warn,
+              "unable to decode compressed health report from node {} - {}",
+              id,
+              std::current_exception());
+            co_return errc::error_collecting_health_report;
+        }
+        r.compressed_report.reset();
+    }
+    std::optional<health_report_id> report_id;
+    if (reply && reply.value().report) {
+        auto& r = reply.value();
+        if (r.base_report_id) {
+            if (!base || r.base_report_id != base_id) {
+                vlog(
+                  clusterlog.warn,
+                  "node {} sent a health report delta against unknown "
+                  "report {}",
+                  id,
+                  *r.base_report_id);
+                co_return errc::error_collecting_health_report;
+            }
+            r.report->topics = co_await apply_topics_delta(
+              base->topics, std::move(r.report->topics), r.removed_partitions);
+        }
+        report_id = r.report_id;
+    }
+
+    auto res = process_node_reply(id, std::move(reply));
+    if (res && report_id) {
+        _report_ids.emplace(id, *report_id);
+    }
+    co_return res;
 }
 
 result<node_health_report>
@@ -512,6 +563,7 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
      * Remove reports from nodes that were removed
      */
     absl::erase_if(_reports, not_in_members_table);
+    absl::erase_if(_report_ids, not_in_members_table);
     absl::erase_if(_status, not_in_members_table);
 
     _last_refresh = ss::lowres_clock::now();
@@ -574,6 +626,34 @@ health_monitor_backend::get_current_node_health() {
     co_return std::move(r);
 }
 
+ss::future<result<node_health_update>>
+health_monitor_backend::get_current_node_health_update(
+  std::optional<health_report_id> base) {
+    auto res = co_await get_current_node_health();
+    if (!res) {
+        co_return res.error();
+    }
+
+    node_health_update update{
+      .id = _next_report_id++,
+      .report = std::move(res.value()),
+    };
+    auto last_sent = std::exchange(
+      _last_sent_report,
+      ss::make_lw_shared<const sent_report>(sent_report{
+        .id = update.id,
+        .topics = update.report.topics.copy(),
+      }));
+
+    if (base && last_sent && last_sent->id == *base) {
+        update.base = base;
+        update.removed = co_await make_topics_delta(
+          last_sent->topics, update.report.topics);
+    }
+
+    co_return update;
+}
+
 namespace {
 
 struct ntp_report {
@@ -604,6 +684,12 @@ chunked_vector<ntp_report> collect_shard_local_reports(partition_manager& pm) {
                     .reclaimable_size_bytes
                     = p.second->reclaimable_size_bytes(),
                     .shard = ss::this_shard_id(),
+                    .leader_bytes_transferred
+                    = p.second->is_leader()
+                        ? std::make_optional(
+                            p.second->probe().get_bytes_produced()
+                            + p.second->probe().get_bytes_fetched())
+                        : std::nullopt,
                   },
               };
       });
@@ -75,6 +75,14 @@ public:
      */
     ss::future<result<node_health_report>> get_current_node_health();
 
+    /**
+     * Returns the current node health to be sent to the controller leader. If
+     * `base` identifies the last report sent, only the partitions that changed
+     * since are included.
+     */
+    ss::future<result<node_health_update>>
+      get_current_node_health_update(std::optional<health_report_id> base);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -197,6 +205,23 @@ private:
 
     mutex _report_collection_mutex{"health_report_collection"};
 
+    /**
+     * Topic statuses of the last report sent to the controller leader, used as
+     * the base of the next delta report.
+     */
+    struct sent_report {
+        health_report_id id;
+        chunked_vector<topic_status> topics;
+    };
+    ss::lw_shared_ptr<const sent_report> _last_sent_report;
+    health_report_id _next_report_id;
+
+    /**
+     * Ids of the reports in `_reports` as assigned by the nodes that sent them,
+     * present only for the nodes able to send delta reports.
+     */
+    absl::node_hash_map<model::node_id, health_report_id> _report_ids;
+
     friend struct health_report_accessor;
 };
 } // namespace cluster
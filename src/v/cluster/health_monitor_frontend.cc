@@ -73,6 +73,14 @@ health_monitor_frontend::get_current_node_health() {
         return be.get_current_node_health();
     });
 }
+
+ss::future<result<node_health_update>>
+health_monitor_frontend::get_current_node_health_update(
+  std::optional<health_report_id> base) {
+    return dispatch_to_backend([base](health_monitor_backend& be) mutable {
+        return be.get_current_node_health_update(base);
+    });
+}
 std::optional<alive>
 health_monitor_frontend::is_alive(model::node_id id) const {
     auto status = _node_status_table.local().get_node_status(id);
@@ -62,6 +62,11 @@ public:
     // Collects or return cached version of current node health report.
     ss::future<result<node_health_report>> get_current_node_health();
 
+    // Collects or returns cached version of current node health report, as a
+    // delta against the report identified by `base` when possible.
+    ss::future<result<node_health_update>>
+      get_current_node_health_update(std::optional<health_report_id> base);
+
     /**
      * Return drain status for a given node.
      */
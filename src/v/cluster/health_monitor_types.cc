@@ -13,16 +13,22 @@
 #include "cluster/drain_manager.h"
 #include "cluster/errc.h"
 #include "cluster/node/types.h"
+#include "compression/compression.h"
 #include "features/feature_table.h"
 #include "health_monitor_types.h"
 #include "model/adl_serde.h"
 #include "model/metadata.h"
+#include "serde/async.h"
 #include "utils/to_string.h"
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <fmt/ostream.h>
 
 #include <algorithm>
@@ -134,6 +140,165 @@ bool operator==(const node_health_report& a, const node_health_report& b) {
              b.topics.cend());
 }
 
+std::ostream&
+operator<<(std::ostream& o, const removed_topic_partitions& r) {
+    fmt::print(o, "{{tp_ns: {}, partitions: {}}}", r.tp_ns, r.partitions);
+    return o;
+}
+
+ss::future<std::vector<removed_topic_partitions>> make_topics_delta(
+  const chunked_vector<topic_status>& base,
+  chunked_vector<topic_status>& current) {
+    using partitions_t
+      = absl::flat_hash_map<model::partition_id, const partition_status*>;
+    absl::node_hash_map<model::topic_namespace, partitions_t> base_index;
+    for (const auto& topic : base) {
+        auto& partitions = base_index[topic.tp_ns];
+        partitions.reserve(topic.partitions.size());
+        for (const auto& p : topic.partitions) {
+            partitions.emplace(p.id, &p);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    std::vector<removed_topic_partitions> removed;
+    auto add_removed = [&removed](
+                         const model::topic_namespace& tp_ns,
+                         const partitions_t& partitions) {
+        if (partitions.empty()) {
+            return;
+        }
+        auto& r = removed.emplace_back();
+        r.tp_ns = tp_ns;
+        r.partitions.reserve(partitions.size());
+        for (const auto& [id, _] : partitions) {
+            r.partitions.push_back(id);
+        }
+    };
+
+    chunked_vector<topic_status> changed;
+    for (auto& topic : current) {
+        auto it = base_index.find(topic.tp_ns);
+        if (it == base_index.end()) {
+            changed.push_back(std::move(topic));
+            continue;
+        }
+        partition_statuses_t changed_partitions;
+        for (auto& p : topic.partitions) {
+            auto p_it = it->second.find(p.id);
+            if (p_it == it->second.end()) {
+                changed_partitions.push_back(std::move(p));
+                continue;
+            }
+            if (*p_it->second != p) {
+                changed_partitions.push_back(std::move(p));
+            }
+            it->second.erase(p_it);
+        }
+        add_removed(topic.tp_ns, it->second);
+        base_index.erase(it);
+        if (!changed_partitions.empty()) {
+            changed.emplace_back(
+              std::move(topic.tp_ns), std::move(changed_partitions));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    for (const auto& [tp_ns, partitions] : base_index) {
+        add_removed(tp_ns, partitions);
+    }
+
+    current = std::move(changed);
+    co_return removed;
+}
+
+ss::future<chunked_vector<topic_status>> apply_topics_delta(
+  const chunked_vector<topic_status>& base,
+  chunked_vector<topic_status> changed,
+  const std::vector<removed_topic_partitions>& removed) {
+    using partitions_t
+      = absl::flat_hash_map<model::partition_id, partition_status*>;
+    absl::node_hash_map<model::topic_namespace, partitions_t> changed_index;
+    for (auto& topic : changed) {
+        auto& partitions = changed_index[topic.tp_ns];
+        partitions.reserve(topic.partitions.size());
+        for (auto& p : topic.partitions) {
+            partitions.emplace(p.id, &p);
+        }
+    }
+    absl::node_hash_map<
+      model::topic_namespace,
+      absl::flat_hash_set<model::partition_id>>
+      removed_index;
+    for (const auto& r : removed) {
+        removed_index[r.tp_ns].insert(r.partitions.begin(), r.partitions.end());
+    }
+
+    chunked_vector<topic_status> result;
+    result.reserve(base.size());
+    for (const auto& topic : base) {
+        auto c_it = changed_index.find(topic.tp_ns);
+        auto r_it = removed_index.find(topic.tp_ns);
+        if (c_it == changed_index.end() && r_it == removed_index.end()) {
+            result.push_back(topic);
+            co_await ss::coroutine::maybe_yield();
+            continue;
+        }
+        partition_statuses_t partitions;
+        partitions.reserve(topic.partitions.size());
+        for (const auto& p : topic.partitions) {
+            if (r_it != removed_index.end() && r_it->second.contains(p.id)) {
+                continue;
+            }
+            if (c_it != changed_index.end()) {
+                if (auto p_it = c_it->second.find(p.id);
+                    p_it != c_it->second.end()) {
+                    partitions.push_back(std::move(*p_it->second));
+                    c_it->second.erase(p_it);
+                    continue;
+                }
+            }
+            partitions.push_back(p);
+        }
+        if (c_it != changed_index.end()) {
+            // partitions that were created since the base report
+            for (const auto& [_, p] : c_it->second) {
+                partitions.push_back(std::move(*p));
+            }
+            changed_index.erase(c_it);
+        }
+        if (!partitions.empty()) {
+            result.emplace_back(topic.tp_ns, std::move(partitions));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    // topics that were created since the base report
+    for (auto& topic : changed) {
+        auto it = changed_index.find(topic.tp_ns);
+        if (it != changed_index.end()) {
+            changed_index.erase(it);
+            result.push_back(std::move(topic));
+        }
+    }
+
+    co_return result;
+}
+
+ss::future<iobuf> compress_node_health_report(node_health_report report) {
+    iobuf encoded;
+    co_await serde::write_async(encoded, std::move(report));
+    co_return co_await compression::stream_compressor::compress(
+      std::move(encoded), compression::type::lz4);
+}
+
+ss::future<node_health_report> decompress_node_health_report(iobuf buf) {
+    auto encoded = co_await compression::stream_compressor::uncompress(
+      std::move(buf), compression::type::lz4);
+    iobuf_parser parser(std::move(encoded));
+    co_return co_await serde::read_async<node_health_report>(parser);
+}
+
 std::ostream& operator<<(std::ostream& o, const cluster_health_report& r) {
     fmt::print(
       o,
@@ -150,7 +315,8 @@ std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
     fmt::print(
       o,
       "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}, "
-      "reclaimable_size_bytes: {}, under_replicated: {}, shard: {}}}",
+      "reclaimable_size_bytes: {}, under_replicated: {}, shard: {}, "
+      "leader_bytes_transferred: {}}}",
       ps.id,
       ps.term,
       ps.leader_id,
@@ -158,7 +324,8 @@ std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
       ps.size_bytes,
       ps.reclaimable_size_bytes,
       ps.under_replicated_replicas,
-      ps.shard);
+      ps.shard,
+      ps.leader_bytes_transferred);
     return o;
 }
 
@@ -267,13 +434,27 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
     return o;
 }
 
-std::ostream& operator<<(std::ostream& o, const get_node_health_request&) {
-    fmt::print(o, "{{}}");
+std::ostream&
+operator<<(std::ostream& o, const get_node_health_request& r) {
+    fmt::print(
+      o,
+      "{{base_report_id: {}, accepts_compressed_report: {}}}",
+      r.base_report_id(),
+      r.accepts_compressed_report());
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, report_id: {}, base_report_id: {}, "
+      "removed_partitions: {}, compressed_report_bytes: {}}}",
+      r.error,
+      r.report,
+      r.report_id,
+      r.base_report_id,
+      r.removed_partitions,
+      r.compressed_report ? r.compressed_report->size_bytes() : 0);
     return o;
 }
 
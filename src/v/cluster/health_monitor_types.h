@@ -18,6 +18,8 @@
 #include "serde/async.h"
 #include "serde/rw/bool_class.h"
 #include "serde/rw/envelope.h"
+#include "serde/rw/iobuf.h"
+#include "serde/rw/named_type.h"
 #include "serde/rw/optional.h"
 #include "serde/rw/rw.h"
 #include "serde/rw/scalar.h"
@@ -86,7 +88,7 @@ private:
 
 struct partition_status
   : serde::
-      envelope<partition_status, serde::version<3>, serde::compat_version<0>> {
+      envelope<partition_status, serde::version<4>, serde::compat_version<0>> {
     static constexpr size_t invalid_size_bytes = size_t(-1);
     static constexpr uint32_t invalid_shard_id = uint32_t(-1);
 
@@ -114,6 +116,14 @@ struct partition_status
 
     uint32_t shard = invalid_shard_id;
 
+    /*
+     * total number of bytes produced to and fetched from this replica since
+     * it was created. only reported by the leader replica. the leader
+     * balancer uses the rate at which this value grows as the load of the
+     * partition.
+     */
+    std::optional<uint64_t> leader_bytes_transferred;
+
     auto serde_fields() {
         return std::tie(
           id,
@@ -123,7 +133,8 @@ struct partition_status
           size_bytes,
           under_replicated_replicas,
           reclaimable_size_bytes,
-          shard);
+          shard,
+          leader_bytes_transferred);
     }
 
     friend std::ostream& operator<<(std::ostream&, const partition_status&);
@@ -225,6 +236,78 @@ struct node_health_report
 
 using node_health_report_ptr
   = ss::foreign_ptr<ss::lw_shared_ptr<const node_health_report>>;
+
+/**
+ * Identifies a node health report sent to the controller leader. The leader
+ * sends it back when requesting the next report so that the node can reply
+ * with only the partitions that changed since.
+ */
+using health_report_id = named_type<uint64_t, struct health_report_id_tag>;
+
+/**
+ * Partitions of a topic that are no longer present on a node, part of a node
+ * health report delta.
+ */
+struct removed_topic_partitions
+  : serde::envelope<
+      removed_topic_partitions,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::topic_namespace tp_ns;
+    std::vector<model::partition_id> partitions;
+
+    friend bool
+    operator==(const removed_topic_partitions&, const removed_topic_partitions&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const removed_topic_partitions&);
+
+    auto serde_fields() { return std::tie(tp_ns, partitions); }
+};
+
+/**
+ * A node health report to be sent to the controller leader. When `base` is
+ * set the report topics only contain the partitions whose status changed since
+ * the report identified by `base`, and `removed` lists the partitions that are
+ * not present on the node anymore.
+ */
+struct node_health_update {
+    health_report_id id;
+    std::optional<health_report_id> base;
+    node_health_report report;
+    std::vector<removed_topic_partitions> removed;
+};
+
+/**
+ * Removes the partitions which have the same status in `base` from `current`
+ * and returns the partitions of `base` missing from `current`.
+ */
+ss::future<std::vector<removed_topic_partitions>> make_topics_delta(
+  const chunked_vector<topic_status>& base,
+  chunked_vector<topic_status>& current);
+
+/**
+ * Applies the delta created by `make_topics_delta` to `base`, returning the
+ * full topic statuses.
+ */
+ss::future<chunked_vector<topic_status>> apply_topics_delta(
+  const chunked_vector<topic_status>& base,
+  chunked_vector<topic_status> changed,
+  const std::vector<removed_topic_partitions>& removed);
+
+/**
+ * Health reports of nodes with fewer partitions are small enough to be sent
+ * uncompressed.
+ */
+inline constexpr size_t compressed_health_report_min_partitions = 128;
+
+/// Returns the lz4 compressed serde encoding of the report.
+ss::future<iobuf> compress_node_health_report(node_health_report);
+
+/// Decodes a report compressed with `compress_node_health_report`.
+ss::future<node_health_report> decompress_node_health_report(iobuf);
+
 struct cluster_health_report
   : serde::envelope<
       cluster_health_report,
@@ -436,11 +519,34 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 class get_node_health_request
   : public serde::envelope<
       get_node_health_request,
-      serde::version<0>,
+      serde::version<2>,
       serde::compat_version<0>> {
 public:
     using rpc_adl_exempt = std::true_type;
 
+    get_node_health_request() = default;
+    explicit get_node_health_request(
+      std::optional<health_report_id> base_report_id,
+      bool accepts_compressed_report = false)
+      : _base_report_id(base_report_id)
+      , _accepts_compressed_report(accepts_compressed_report) {}
+
+    /**
+     * Identifier of the last report received from the node, the node may reply
+     * with a delta against it.
+     */
+    std::optional<health_report_id> base_report_id() const {
+        return _base_report_id;
+    }
+
+    /**
+     * Set by senders that can decode a compressed report, see
+     * get_node_health_reply::compressed_report.
+     */
+    bool accepts_compressed_report() const {
+        return _accepts_compressed_report;
+    }
+
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
       = default;
@@ -448,7 +554,9 @@ public:
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(_filter); }
+    auto serde_fields() {
+        return std::tie(_filter, _base_report_id, _accepts_compressed_report);
+    }
 
 private:
     /**
@@ -456,17 +564,28 @@ private:
      * purpose
      */
     node_report_filter _filter;
+    std::optional<health_report_id> _base_report_id;
+    bool _accepts_compressed_report = false;
 };
 
 struct get_node_health_reply
   : serde::envelope<
       get_node_health_reply,
-      serde::version<0>,
+      serde::version<2>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // identifies the report, not set by nodes that don't support deltas
+    std::optional<health_report_id> report_id;
+    // when set the report is a delta against the report with this id, see
+    // node_health_update
+    std::optional<health_report_id> base_report_id;
+    std::vector<removed_topic_partitions> removed_partitions;
+    // lz4 compressed serde encoding of the report, used instead of the report
+    // field for large reports when the requester accepts compressed reports
+    std::optional<iobuf> compressed_report;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -475,7 +594,15 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(
+          error,
+          report,
+          report_id,
+          base_report_id,
+          removed_partitions,
+          compressed_report);
+    }
 };
 
 struct get_cluster_health_request
@@ -25,12 +25,18 @@
 #include "model/namespace.h"
 #include "model/record_batch_reader.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/sharded.hh>
 
+#include <boost/range/irange.hpp>
+
+#include <algorithm>
+
 namespace cluster {
 using namespace std::chrono_literals;
 
@@ -200,10 +206,34 @@ id_allocator_frontend::id_allocator_frontend(
       metadata_cache,
       connection_cache,
       leaders,
-      node_id) {}
+      node_id)
+  , _prefetch_size(
+      config::shard_local_cfg().id_allocator_prefetch_size.bind()) {}
+
+ss::future<> id_allocator_frontend::stop() {
+    auto f = _gate.close();
+    // fails the refills that are waiting on the leader
+    co_await _allocator_router.shutdown();
+    co_await std::move(f);
+}
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    if (!_prefetched_ids.empty()) {
+        auto id = _prefetched_ids.front();
+        _prefetched_ids.pop_front();
+        maybe_refill_prefetched_ids();
+        co_return allocate_id_reply{id, errc::success};
+    }
+    auto reply = co_await do_allocate_id(timeout);
+    if (reply.ec == errc::success) {
+        maybe_refill_prefetched_ids();
+    }
+    co_return reply;
+}
+
+ss::future<allocate_id_reply>
+id_allocator_frontend::do_allocate_id(model::timeout_clock::duration timeout) {
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return allocate_id_reply{0, errc::topic_not_exists};
     }
@@ -211,15 +241,81 @@ id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
       allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
 }
 
+void id_allocator_frontend::maybe_refill_prefetched_ids() {
+    const auto target = static_cast<size_t>(
+      std::max<int16_t>(_prefetch_size(), 0));
+    if (
+      target == 0 || _refilling || _gate.is_closed()
+      || _prefetched_ids.size() > target / 2) {
+        return;
+    }
+    _refilling = true;
+    ssx::spawn_with_gate(_gate, [this, target] {
+        return refill_prefetched_ids(target).finally(
+          [this] { _refilling = false; });
+    });
+}
+
+ss::future<> id_allocator_frontend::refill_prefetched_ids(size_t target) {
+    const auto epoch = _prefetch_epoch;
+    const auto timeout = config::shard_local_cfg().create_topic_timeout_ms();
+    while (_prefetched_ids.size() < target && !_gate.is_closed()) {
+        std::vector<int64_t> ids;
+        bool failed = false;
+        co_await ss::max_concurrent_for_each(
+          boost::irange(_prefetched_ids.size(), target),
+          prefetch_concurrency,
+          [this, &ids, &failed, timeout](size_t) -> ss::future<> {
+              try {
+                  auto reply = co_await do_allocate_id(timeout);
+                  if (reply.ec == errc::success) {
+                      ids.push_back(reply.id);
+                  } else {
+                      failed = true;
+                  }
+              } catch (...) {
+                  vlog(
+                    clusterlog.debug,
+                    "failed to prefetch a producer id: {}",
+                    std::current_exception());
+                  failed = true;
+              }
+          });
+        if (epoch != _prefetch_epoch) {
+            co_return;
+        }
+        std::sort(ids.begin(), ids.end());
+        for (auto id : ids) {
+            _prefetched_ids.push_back(id);
+        }
+        if (failed) {
+            // retried on the next allocation
+            co_return;
+        }
+    }
+}
+
+void id_allocator_frontend::drop_prefetched_ids() {
+    _prefetched_ids.clear();
+    ++_prefetch_epoch;
+}
+
 ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
   model::producer_id pid, model::timeout_clock::duration timeout) {
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return reset_id_allocator_reply{errc::topic_not_exists};
     }
-    co_return co_await _id_reset_router.reset_id_router::process_or_dispatch(
+    // ids prefetched before the reset may be below the new next id, drop
+    // them, and again once it's done for the allocations that raced with it
+    co_await container().invoke_on_all(
+      [](id_allocator_frontend& f) { f.drop_prefetched_ids(); });
+    auto reply = co_await _id_reset_router.reset_id_router::process_or_dispatch(
       reset_id_allocator_request{timeout, pid},
       model::id_allocator_ntp,
       timeout);
+    co_await container().invoke_on_all(
+      [](id_allocator_frontend& f) { f.drop_prefetched_ids(); });
+    co_return reply;
 }
 
 ss::future<bool> id_allocator_frontend::try_create_id_allocator_topic() {
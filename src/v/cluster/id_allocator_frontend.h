@@ -13,9 +13,12 @@
 #include "cluster/id_allocator_service.h"
 #include "cluster/leader_router.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "rpc/fwd.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
@@ -131,8 +134,17 @@ private:
 //
 // when the service recieves a call it triggers id_allocator_frontend
 // which in its own turn pass the request to the id_allocator_stm
-class id_allocator_frontend {
+//
+// when `id_allocator_prefetch_size` is set every shard keeps that many ids
+// allocated ahead of time, and allocate_id hands them out without a round
+// trip to the leader. They are refilled in the background when half of them
+// are used, and dropped when the next id is reset.
+class id_allocator_frontend
+  : public ss::peering_sharded_service<id_allocator_frontend> {
 public:
+    /// Allocations in flight at once when refilling the prefetched ids
+    static constexpr size_t prefetch_concurrency = 4;
+
     id_allocator_frontend(
       ss::smp_service_group,
       ss::sharded<cluster::partition_manager>&,
@@ -149,7 +161,7 @@ public:
     ss::future<reset_id_allocator_reply>
     reset_next_id(model::producer_id, model::timeout_clock::duration timeout);
 
-    ss::future<> stop() { return _allocator_router.shutdown(); }
+    ss::future<> stop();
 
     allocate_id_router& allocator_router() { return _allocator_router; }
     reset_id_router& id_reset_router() { return _id_reset_router; }
@@ -163,11 +175,26 @@ private:
     allocate_id_router _allocator_router;
     reset_id_router _id_reset_router;
 
+    config::binding<int16_t> _prefetch_size;
+    ss::circular_buffer<int64_t> _prefetched_ids;
+    // bumped when the prefetched ids are dropped, so that a refill that was
+    // in flight doesn't add ids allocated before a reset
+    uint64_t _prefetch_epoch{0};
+    bool _refilling{false};
+    ss::gate _gate;
+
     // Sets the underlying stm's next id to the given id, returning an error if
     // there was a problem (e.g. not leader, timed out, etc).
     ss::future<allocate_id_reply>
       do_reset_next_id(int64_t, model::timeout_clock::duration);
 
+    ss::future<allocate_id_reply>
+      do_allocate_id(model::timeout_clock::duration);
+
+    void maybe_refill_prefetched_ids();
+    ss::future<> refill_prefetched_ids(size_t target);
+    void drop_prefetched_ids();
+
     ss::future<bool> try_create_id_allocator_topic();
     ss::future<bool> ensure_id_allocator_topic_exists();
 
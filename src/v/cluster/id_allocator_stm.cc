@@ -152,6 +152,10 @@ id_allocator_stm::do_allocate_id(model::timeout_clock::duration timeout) {
     co_return stm_allocation_result{id};
 }
 
+bool id_allocator_stm::applies_to(model::record_batch_type type) const {
+    return type == model::record_batch_type::id_allocator;
+}
+
 ss::future<> id_allocator_stm::apply(const model::record_batch& b) {
     if (b.header().type != model::record_batch_type::id_allocator) {
         return ss::now();
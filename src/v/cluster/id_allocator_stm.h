@@ -99,6 +99,7 @@ private:
     ss::future<bool> set_state(int64_t, model::timeout_clock::duration);
 
     ss::future<> apply(const model::record_batch&) final;
+    bool applies_to(model::record_batch_type) const final;
 
     // Moves the state forward to the given value if the curent id is lower
     // than it.
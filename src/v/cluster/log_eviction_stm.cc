@@ -378,6 +378,10 @@ ss::future<log_eviction_stm::offset_result> log_eviction_stm::replicate_command(
     co_return result.value().last_offset;
 }
 
+bool log_eviction_stm::applies_to(model::record_batch_type type) const {
+    return type == model::record_batch_type::prefix_truncate;
+}
+
 ss::future<> log_eviction_stm::apply(const model::record_batch& batch) {
     if (likely(
           batch.header().type != model::record_batch_type::prefix_truncate)) {
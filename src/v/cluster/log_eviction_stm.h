@@ -124,6 +124,7 @@ private:
     ss::future<> do_write_raft_snapshot(model::offset);
     ss::future<> handle_log_eviction_events();
     ss::future<> apply(const model::record_batch&) final;
+    bool applies_to(model::record_batch_type) const final;
     ss::future<> apply_raft_snapshot(const iobuf&) final;
 
     ss::future<offset_result> replicate_command(
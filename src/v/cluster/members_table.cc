@@ -32,6 +32,15 @@ std::vector<node_metadata> members_table::node_list() const {
     }
     return nodes;
 }
+
+members_table::node_list_snapshot_t members_table::node_list_snapshot() const {
+    if (!_node_list_snapshot) {
+        _node_list_snapshot = ss::make_lw_shared<std::vector<node_metadata>>(
+          node_list());
+    }
+    return _node_list_snapshot;
+}
+
 size_t members_table::node_count() const { return _nodes.size(); }
 
 std::vector<model::node_id> members_table::node_ids() const {
@@ -350,6 +359,7 @@ void members_table::unregister_maintenance_state_change_notification(
 
 void members_table::notify_maintenance_state_change(
   model::node_id node_id, model::maintenance_state ms) {
+    _node_list_snapshot = nullptr;
     for (const auto& [id, cb] : _maintenance_state_change_notifications) {
         cb(node_id, ms);
     }
@@ -376,6 +386,7 @@ void members_table::unregister_members_updated_notification(
 
 void members_table::notify_member_updated(
   model::node_id n, model::membership_state new_state) {
+    _node_list_snapshot = nullptr;
     for (const auto& [id, cb] : _members_updated_notifications) {
         cb(n, new_state);
     }
@@ -17,6 +17,8 @@
 #include "model/metadata.h"
 #include "utils/waiter_queue.h"
 
+#include <seastar/core/shared_ptr.hh>
+
 #include <absl/container/node_hash_map.h>
 
 namespace cluster {
@@ -30,6 +32,12 @@ public:
 
     const cache_t& nodes() const;
     std::vector<node_metadata> node_list() const;
+
+    /// Immutable copy of node_list, shared by all the readers until the next
+    /// change of the members. Cheap to hold across scheduling points.
+    using node_list_snapshot_t
+      = ss::lw_shared_ptr<const std::vector<node_metadata>>;
+    node_list_snapshot_t node_list_snapshot() const;
     size_t node_count() const;
 
     std::vector<model::node_id> node_ids() const;
@@ -101,6 +109,9 @@ private:
 
     model::revision_id _version;
 
+    /// Built on first use after every change, see node_list_snapshot
+    mutable node_list_snapshot_t _node_list_snapshot;
+
     waiter_queue<model::node_id> _waiters;
 
     notification_id_type _maintenance_state_change_notification_id{0};
@@ -120,8 +120,10 @@ size_t metadata_cache::node_count() const {
 }
 
 ss::future<std::vector<node_metadata>> metadata_cache::alive_nodes() const {
+    auto nodes = _members_table.local().node_list_snapshot();
     std::vector<node_metadata> brokers;
-    for (auto& st : _members_table.local().node_list()) {
+    brokers.reserve(nodes->size());
+    for (const auto& st : *nodes) {
         auto is_alive = _health_monitor.local().is_alive(st.broker.id());
         /**
          * if node is not alive we skip adding it to the list of brokers. If
@@ -134,11 +136,14 @@ ss::future<std::vector<node_metadata>> metadata_cache::alive_nodes() const {
         brokers.push_back(st);
     }
 
-    co_return !brokers.empty() ? brokers : _members_table.local().node_list();
+    if (brokers.empty()) {
+        co_return *nodes;
+    }
+    co_return brokers;
 }
 
 std::vector<node_metadata> metadata_cache::all_nodes() const {
-    return _members_table.local().node_list();
+    return *_members_table.local().node_list_snapshot();
 }
 
 std::vector<model::node_id> metadata_cache::node_ids() const {
@@ -190,6 +195,15 @@ std::optional<model::node_id> metadata_cache::get_previous_leader_id(
     return _leaders.local().get_previous_leader(tp_ns, p_id);
 }
 
+partition_leaders_table::version metadata_cache::get_topic_leadership_version(
+  model::topic_namespace_view tp_ns) const {
+    return _leaders.local().topic_leadership_version(tp_ns);
+}
+
+model::revision_id metadata_cache::get_topics_revision() const {
+    return _topics_state.local().last_applied_revision();
+}
+
 /// If present returns a leader of raft0 group
 std::optional<model::node_id> metadata_cache::get_controller_leader_id() {
     return _leaders.local().get_leader(model::controller_ntp);
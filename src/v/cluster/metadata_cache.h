@@ -141,6 +141,15 @@ public:
 
     std::optional<model::node_id> get_previous_leader_id(
       model::topic_namespace_view, model::partition_id) const;
+
+    /// Changes whenever what get_leader_term() or get_previous_leader_id()
+    /// return for a partition of the topic changes.
+    partition_leaders_table::version
+      get_topic_leadership_version(model::topic_namespace_view) const;
+
+    /// Revision of the last command applied to the topics, changes whenever
+    /// the metadata of a topic does.
+    model::revision_id get_topics_revision() const;
     /// Returns metadata of all topics in cache internal format
     // const cache_t& all_metadata() const { return _cache; }
 
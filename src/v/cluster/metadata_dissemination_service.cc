@@ -30,6 +30,7 @@
 #include "model/timeout_clock.h"
 #include "rpc/connection_cache.h"
 #include "rpc/types.h"
+#include "ssx/async_algorithm.h"
 #include "utils/retry.h"
 #include "utils/unresolved_address.h"
 
@@ -40,6 +41,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/sleep.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 #include <chrono>
@@ -157,46 +159,76 @@ void metadata_dissemination_service::handle_leadership_notification(
   model::revision_id revision,
   model::term_id term,
   std::optional<model::node_id> lid) {
-    ssx::spawn_with_gate(
-      _bg, [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-          // the lock sequences the updates from raft
-          return _lock.with(
-            [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-                return container().invoke_on(
-                  0,
-                  [ntp = std::move(ntp), lid, revision, term](
-                    metadata_dissemination_service& s) mutable {
-                      return s.apply_leadership_notification(
-                        std::move(ntp), revision, term, lid);
-                  });
-            });
-      });
+    _pending_notifications.emplace_back(std::move(ntp), term, lid, revision);
+    if (_flushing_notifications) {
+        return;
+    }
+    _flushing_notifications = true;
+    ssx::spawn_with_gate(_bg, [this] {
+        return flush_leadership_notifications().finally(
+          [this] { _flushing_notifications = false; });
+    });
 }
 
-ss::future<> metadata_dissemination_service::apply_leadership_notification(
-  model::ntp ntp,
-  model::revision_id revision,
-  model::term_id term,
-  std::optional<model::node_id> lid) {
+ss::future<> metadata_dissemination_service::flush_leadership_notifications() {
+    while (!_pending_notifications.empty()) {
+        auto batch = std::exchange(_pending_notifications, {});
+        // the lock sequences the updates from raft
+        auto units = co_await _lock.get_units();
+        co_await container().invoke_on(
+          0,
+          [batch = std::move(batch)](
+            metadata_dissemination_service& s) mutable {
+              return s.apply_leadership_notifications(std::move(batch));
+          });
+    }
+}
+
+ss::future<> metadata_dissemination_service::apply_leadership_notifications(
+  chunked_vector<ntp_leader_revision> batch) {
     // the gate also needs to be taken on the destination core.
-    return ss::with_gate(
-      _bg, [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-          // update partition leaders
-          vlog(clusterlog.trace, "updating {} leadership locally", ntp);
-          auto f = _leaders.invoke_on_all(
-            [ntp, lid, revision, term](partition_leaders_table& leaders) {
-                leaders.update_partition_leader(ntp, revision, term, lid);
+    auto holder = _bg.hold();
+
+    // only the latest notification of each partition matters, notifications
+    // for a partition are received in order.
+    absl::flat_hash_map<model::ntp, size_t> latest;
+    latest.reserve(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        latest.insert_or_assign(batch[i].ntp, i);
+    }
+    if (latest.size() < batch.size()) {
+        chunked_vector<ntp_leader_revision> deduplicated;
+        deduplicated.reserve(latest.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (latest[batch[i].ntp] == i) {
+                deduplicated.push_back(std::move(batch[i]));
+            }
+        }
+        batch = std::move(deduplicated);
+    }
+
+    vlog(
+      clusterlog.trace,
+      "updating leadership of {} partitions locally",
+      batch.size());
+    co_await _leaders.invoke_on_all(
+      [&batch](partition_leaders_table& leaders) {
+          return ssx::async_for_each(
+            batch.begin(),
+            batch.end(),
+            [&leaders](const ntp_leader_revision& l) {
+                leaders.update_partition_leader(
+                  l.ntp, l.revision, l.term, l.leader_id);
             });
-          if (lid == _self.id()) {
-              // only disseminate from current leader
-              f = f.then(
-                [this, ntp = std::move(ntp), term, lid, revision]() mutable {
-                    return disseminate_leadership(
-                      std::move(ntp), revision, term, lid);
-                });
-          }
-          return f;
       });
+
+    for (auto& l : batch) {
+        if (l.leader_id == _self.id()) {
+            // only disseminate from current leader
+            disseminate_leadership(
+              std::move(l.ntp), l.revision, l.term, l.leader_id);
+        }
+    }
 }
 
 static inline ss::future<>
@@ -293,8 +325,30 @@ metadata_dissemination_service::dispatch_get_metadata_update(
 }
 
 void metadata_dissemination_service::collect_pending_updates() {
-    auto brokers = _members_table.local().node_ids();
+    if (_requests.empty()) {
+        return;
+    }
+    // deduplicate updates, keeping the latest one of each partition
+    absl::flat_hash_map<model::ntp, ntp_leader_revision> latest;
     for (auto& ntp_leader : _requests) {
+        auto ntp = ntp_leader.ntp;
+        latest.insert_or_assign(std::move(ntp), std::move(ntp_leader));
+    }
+    _requests.clear();
+
+    // drop the updates still pending delivery which are superseded
+    for (auto& [id, meta] : _pending_updates) {
+        ss::chunked_fifo<ntp_leader_revision> updates;
+        for (auto& u : meta.updates) {
+            if (!latest.contains(u.ntp)) {
+                updates.push_back(std::move(u));
+            }
+        }
+        meta.updates = std::move(updates);
+    }
+
+    auto brokers = _members_table.local().node_ids();
+    for (auto& [_, ntp_leader] : latest) {
         auto assignment = _topics.local().get_partition_assignment(
           ntp_leader.ntp);
 
@@ -320,7 +374,6 @@ void metadata_dissemination_service::collect_pending_updates() {
             _pending_updates[id].updates.push_back(ntp_leader);
         }
     }
-    _requests.clear();
 }
 
 void metadata_dissemination_service::cleanup_finished_updates() {
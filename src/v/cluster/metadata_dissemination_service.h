@@ -121,11 +121,9 @@ private:
       model::revision_id,
       model::term_id,
       std::optional<model::node_id>);
-    ss::future<> apply_leadership_notification(
-      model::ntp,
-      model::revision_id,
-      model::term_id,
-      std::optional<model::node_id>);
+    ss::future<> flush_leadership_notifications();
+    ss::future<>
+      apply_leadership_notifications(chunked_vector<ntp_leader_revision>);
 
     void collect_pending_updates();
     void cleanup_finished_updates();
@@ -154,6 +152,11 @@ private:
     std::chrono::milliseconds _dissemination_interval;
     config::tls_config _rpc_tls_config;
     ss::chunked_fifo<ntp_leader_revision> _requests;
+    // Leadership notifications received on this shard and not yet applied.
+    // They are applied to the partition leaders table in batches, new
+    // notifications accumulate while a batch is being applied.
+    chunked_vector<ntp_leader_revision> _pending_notifications;
+    bool _flushing_notifications{false};
     std::vector<net::unresolved_address> _seed_servers;
     broker_updates_t _pending_updates;
     mutex _lock{"metadata_dissemination_service"};
@@ -469,6 +469,21 @@ ss::future<> partition::start(
         co_await _cloud_storage_partition->start();
     }
 
+    if (_cloud_storage_partition) {
+        // lagging followers don't have to replicate the uploaded part of the
+        // log from the leader, they read it from cloud storage
+        _raft->set_follower_recovery_start_offset_fn(
+          [this]() -> std::optional<model::offset> {
+              if (
+                _raft->log_config().is_read_replica_mode_enabled()
+                || !is_remote_fetch_enabled() || !cloud_data_available()) {
+                  return std::nullopt;
+              }
+              return model::next_offset(
+                _archival_meta_stm->manifest().get_last_offset());
+          });
+    }
+
     {
         auto archiver_reset_guard = co_await ssx::with_timeout_abortable(
           ss::get_units(_archiver_reset_mutex, 1),
@@ -487,6 +502,7 @@ ss::future<> partition::stop() {
     auto partition_ntp = ntp();
     vlog(clusterlog.debug, "Stopping partition: {}", partition_ntp);
     _as.request_abort();
+    _raft->set_follower_recovery_start_offset_fn({});
 
     {
         // `partition_manager::do_shutdown` (caller of stop) will assert
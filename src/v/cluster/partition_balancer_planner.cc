@@ -122,6 +122,12 @@ public:
         }
     }
 
+    // True if no new reassignments or cancellations can be added to the
+    // plan. Only partitions which were already reassigned can still change.
+    bool is_batch_full() const {
+        return !can_add_reassignment() && !can_add_cancellation();
+    }
+
     ss::future<> maybe_yield() {
         co_await ss::coroutine::maybe_yield();
         _as.check();
@@ -1031,9 +1037,14 @@ ss::future<> partition_balancer_planner::request_context::for_each_partition(
         const auto& assignments = it->second.get_assignments();
         for (const auto& [_, assignment] : assignments) {
             auto ntp = model::ntp(it->first.ns, it->first.tp, assignment.id);
-            auto stop = do_with_partition(ntp, assignment, visitor);
-            if (stop == ss::stop_iteration::yes) {
-                co_return;
+            // Once the batch is full, the partitions which were not reassigned
+            // yet can only be visited as immutable, which can't add actions to
+            // the plan. Skip them instead of evaluating them one by one.
+            if (!is_batch_full() || _reassignments.contains(ntp)) {
+                auto stop = do_with_partition(ntp, assignment, visitor);
+                if (stop == ss::stop_iteration::yes) {
+                    co_return;
+                }
             }
             co_await maybe_yield();
             it.check();
@@ -1465,7 +1476,23 @@ ss::future<> partition_balancer_planner::get_node_drain_actions(
         co_return;
     }
 
-    co_await ctx.for_each_partition([&](partition& part) {
+    // Decommissioning moves only transfer the initial retention of the
+    // partitions that are in tiered storage, the new replicas catch up from
+    // there. These moves finish much faster, so they are scheduled first.
+    const bool tiered_first = reason == change_reason::node_decommissioning;
+    bool tiered_pass = tiered_first;
+    auto is_in_tiered_storage = [&ctx](const model::ntp& ntp) {
+        auto cfg = ctx.state().topics().get_topic_cfg(
+          model::topic_namespace_view(ntp));
+        return cfg && cfg->properties.shadow_indexing
+               && model::is_archival_enabled(*cfg->properties.shadow_indexing);
+    };
+
+    auto drain = [&](partition& part) {
+        if (tiered_first && tiered_pass != is_in_tiered_storage(part.ntp())) {
+            return ss::stop_iteration::no;
+        }
+
         std::vector<model::node_id> to_move;
         for (const auto& bs : part.replicas()) {
             if (nodes.contains(bs.node_id)) {
@@ -1514,7 +1541,13 @@ ss::future<> partition_balancer_planner::get_node_drain_actions(
           [&](immutable_partition& part) { part.report_failure(reason); });
 
         return ss::stop_iteration::no;
-    });
+    };
+
+    if (tiered_first) {
+        co_await ctx.for_each_partition(drain);
+        tiered_pass = false;
+    }
+    co_await ctx.for_each_partition(drain);
 }
 
 /// Try to fix ntps that have several replicas in one rack (these ntps can
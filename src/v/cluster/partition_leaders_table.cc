@@ -25,6 +25,7 @@
 #include <absl/container/btree_map.h>
 
 #include <optional>
+#include <tuple>
 
 namespace cluster {
 
@@ -55,6 +56,15 @@ std::optional<model::node_id> partition_leaders_table::get_previous_leader(
     return meta ? meta->get().previous_leader : std::nullopt;
 }
 
+partition_leaders_table::version
+partition_leaders_table::topic_leadership_version(
+  model::topic_namespace_view tp_ns) const {
+    if (auto t_it = _topic_leaders.find(tp_ns); t_it != _topic_leaders.end()) {
+        return t_it->second.leadership_version;
+    }
+    return version{0};
+}
+
 std::optional<model::node_id> partition_leaders_table::get_leader(
   model::topic_namespace_view tp_ns, model::partition_id pid) const {
     const auto meta = find_leader_meta(tp_ns, pid);
@@ -154,6 +164,13 @@ void partition_leaders_table::do_update_partition_leader(
         .update_term = term,
         .partition_revision = revision_id});
 
+    // what get_leader_term() and get_previous_leader() report for the
+    // partition before this update
+    const auto reported = std::make_tuple(
+      p_it->second.current_leader,
+      p_it->second.previous_leader,
+      p_it->second.update_term);
+
     if (!new_entry) [[likely]] {
         /**
          * Controller is a special case as it revision never but it
@@ -240,6 +257,16 @@ void partition_leaders_table::do_update_partition_leader(
         ++_version;
     }
 
+    if (
+      new_entry
+      || reported
+           != std::tie(
+             p_it->second.current_leader,
+             p_it->second.previous_leader,
+             p_it->second.update_term)) {
+        t_it->second.leadership_version = ++_leadership_version;
+    }
+
     vlog(
       clusterlog.trace,
       "updated partition: {}/{}/{} leader: {{term: {}, current leader: {}, "
@@ -355,6 +382,7 @@ void partition_leaders_table::remove_leader(
         }
 
         t_it->second.erase(p_it);
+        t_it->second.leadership_version = ++_leadership_version;
         if (t_it->second.empty()) {
             _topic_leaders.erase(t_it);
             ++_topic_map_version;
@@ -161,6 +161,14 @@ public:
         return _leaderless_partition_count;
     }
 
+    /**
+     * Returns a version that changes whenever what get_leader_term() or
+     * get_previous_leader() return for a partition of the topic changes, so
+     * that what is derived from them can be cached. All topics without any
+     * known leader have the version 0.
+     */
+    version topic_leadership_version(model::topic_namespace_view) const;
+
     using leader_change_cb_t = ss::noncopyable_function<void(
       model::ntp, model::term_id, model::node_id)>;
 
@@ -196,8 +204,12 @@ private:
         model::revision_id partition_revision;
     };
 
-    using partition_leaders
-      = contiguous_range_map<model::partition_id::type, leader_meta>;
+    struct partition_leaders
+      : contiguous_range_map<model::partition_id::type, leader_meta> {
+        // value of `_leadership_version` when the leadership of a partition
+        // of the topic last changed
+        version leadership_version{0};
+    };
     using topics_t = chunked_hash_map<
       model::topic_namespace,
       partition_leaders,
@@ -234,6 +246,9 @@ private:
      */
     version _version{0};
     version _topic_map_version{0};
+    // incremented whenever the leadership of any partition changes, the
+    // topic entries store the value of their last change
+    version _leadership_version{0};
     ss::gate _gate;
     ss::abort_source _as;
 };
@@ -240,8 +240,17 @@ ss::future<consensus_ptr> partition_manager::manage(
     }
     auto translator_batch_types = raft::offset_translator_batch_types(
       ntp_cfg.ntp());
+    // partitions that this node was leading are likely to be needed first,
+    // so let them jump the queue when many logs are waiting to be recovered
+    auto priority = raft::details::voted_for_self(
+                      group, _raft_manager.local().self(), _storage.kvs())
+                      ? storage::recovery_priority::high
+                      : storage::recovery_priority::normal;
     auto log = co_await _storage.log_mgr().manage(
-      std::move(ntp_cfg), group, std::move(translator_batch_types));
+      std::move(ntp_cfg),
+      group,
+      std::move(translator_batch_types),
+      priority);
     vlog(
       clusterlog.debug,
       "Log created manage completed, ntp: {}, rev: {}, {} "
@@ -77,6 +77,11 @@ public:
         return nullptr;
     }
 
+    /// \brief raw api for raft/service.h
+    void node_heartbeat_received(model::node_id source) {
+        _raft_manager.local().node_heartbeat_received(source);
+    }
+
     inline ss::lw_shared_ptr<partition>
     partition_for(raft::group_id group) const {
         if (auto it = _raft_table.find(group); it != _raft_table.end()) {
@@ -235,13 +235,9 @@ void replicated_partition_probe::setup_public_metrics(const model::ntp& ntp) {
         sm::make_gauge(
           "under_replicated_replicas",
           [this] {
-              auto metrics = _partition.raft()->get_follower_metrics();
-              return std::count_if(
-                metrics.cbegin(),
-                metrics.cend(),
-                [](const raft::follower_metrics& fm) {
-                    return fm.under_replicated;
-                });
+              // Evaluated for every partition on each scrape, so count the
+              // followers in place rather than building their metrics.
+              return _partition.raft()->get_under_replicated().value_or(0);
           },
           sm::description("Number of under replicated replicas (i.e. replicas "
                           "that are live, but not at the latest offest)"),
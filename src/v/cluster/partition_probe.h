@@ -31,6 +31,8 @@ public:
         virtual void add_bytes_fetched(uint64_t) = 0;
         virtual void add_bytes_fetched_from_follower(uint64_t) = 0;
         virtual void add_schema_id_validation_failed() = 0;
+        virtual uint64_t get_bytes_produced() const = 0;
+        virtual uint64_t get_bytes_fetched() const = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual void clear_metrics() = 0;
         virtual ~impl() noexcept = default;
@@ -66,6 +68,10 @@ public:
         _impl->add_schema_id_validation_failed();
     }
 
+    uint64_t get_bytes_produced() const { return _impl->get_bytes_produced(); }
+
+    uint64_t get_bytes_fetched() const { return _impl->get_bytes_fetched(); }
+
     void clear_metrics() { _impl->clear_metrics(); }
 
 private:
@@ -87,6 +93,8 @@ public:
     void add_schema_id_validation_failed() final {
         ++_schema_id_validation_records_failed;
     };
+    uint64_t get_bytes_produced() const final { return _bytes_produced; }
+    uint64_t get_bytes_fetched() const final { return _bytes_fetched; }
 
     void clear_metrics() final;
 
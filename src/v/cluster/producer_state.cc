@@ -85,6 +85,29 @@ bool request::operator==(const request& other) const {
     return compare;
 }
 
+void requests::finished_ring::push_back(finished_request request) {
+    if (_size < _ring.size()) {
+        _ring[(_head + _size) % _ring.size()] = request;
+        ++_size;
+        return;
+    }
+    // full, the oldest request makes room
+    _ring[_head] = request;
+    _head = (_head + 1) % _ring.size();
+}
+
+bool requests::finished_ring::operator==(const finished_ring& other) const {
+    if (_size != other._size) {
+        return false;
+    }
+    for (size_t i = 0; i < _size; ++i) {
+        if ((*this)[i] != other[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool requests::operator==(const requests& other) const {
     // check size match
     bool result
@@ -103,36 +126,27 @@ bool requests::operator==(const requests& other) const {
           return *left == *right;
       });
 
-    auto match_finished = std::equal(
-      _finished_requests.begin(),
-      _finished_requests.end(),
-      other._finished_requests.begin(),
-      other._finished_requests.end(),
-      [](const request_ptr& left, const request_ptr& right) {
-          return *left == *right;
-      });
-
-    return match_inflight && match_finished;
+    return match_inflight && _finished_requests == other._finished_requests;
 }
 
-std::optional<request_ptr> requests::last_request() const {
+std::optional<seq_t> requests::last_sequence() const {
     if (!_inflight_requests.empty()) {
-        return _inflight_requests.back();
+        return _inflight_requests.back()->_last_sequence;
     } else if (!_finished_requests.empty()) {
-        return _finished_requests.back();
+        return _finished_requests.back().last_sequence;
     }
     return std::nullopt;
 }
 
 bool requests::is_valid_sequence(seq_t incoming) const {
-    auto last_req = last_request();
+    auto last_seq = last_sequence();
     return
       // this is the first request with seq=0
-      (!last_req && incoming == 0)
+      (!last_seq && incoming == 0)
       // incoming request forms a sequence with last_request
-      || (last_req && last_req.value()->_last_sequence + 1 == incoming)
+      || (last_seq && last_seq.value() + 1 == incoming)
       // sequence numbers got rolled over because they hit int32 max limit.
-      || (last_req && last_req.value()->_last_sequence == std::numeric_limits<seq_t>::max() && incoming == 0);
+      || (last_seq && last_seq.value() == std::numeric_limits<seq_t>::max() && incoming == 0);
 }
 
 result<request_ptr> requests::try_emplace(
@@ -153,19 +167,20 @@ result<request_ptr> requests::try_emplace(
         // prior to this request.
         gc_requests_from_older_terms(current);
         // check if an existing request matches
-        auto match_it = std::find_if(
-          _finished_requests.begin(),
-          _finished_requests.end(),
-          [first, last](const auto& request) {
-              return request->_first_sequence == first
-                     && request->_last_sequence == last;
-          });
-
-        if (match_it != _finished_requests.end()) {
-            return *match_it;
+        for (size_t i = 0; i < _finished_requests.size(); ++i) {
+            const auto& finished = _finished_requests[i];
+            if (
+              finished.first_sequence == first
+              && finished.last_sequence == last) {
+                result_promise_t ready{};
+                ready.set_value(
+                  kafka_result{.last_offset = finished.last_offset});
+                return ss::make_lw_shared<request>(
+                  first, last, model::term_id{-1}, std::move(ready));
+            }
         }
 
-        match_it = std::find_if(
+        auto match_it = std::find_if(
           _inflight_requests.begin(),
           _inflight_requests.end(),
           [first, last, current](const auto& request) {
@@ -201,14 +216,11 @@ void requests::stm_apply(
         }
     }
     gc_requests_from_older_terms(term);
-    result_promise_t ready{};
-    ready.set_value(kafka_result{.last_offset = offset});
-    _finished_requests.emplace_back(ss::make_lw_shared<request>(
-      bid.first_seq, bid.last_seq, model::term_id{-1}, std::move(ready)));
-
-    while (_finished_requests.size() > requests_cached_max) {
-        _finished_requests.pop_front();
-    }
+    _finished_requests.push_back({
+      .first_sequence = bid.first_seq,
+      .last_sequence = bid.last_seq,
+      .last_offset = offset,
+    });
 }
 
 void requests::gc_requests_from_older_terms(model::term_id current_term) {
@@ -248,13 +260,11 @@ producer_state::producer_state(
     }
     // Hydrate from snapshot.
     for (auto& req : snapshot.finished_requests) {
-        result_promise_t ready{};
-        ready.set_value(kafka_result{req.last_offset});
-        _requests._finished_requests.push_back(ss::make_lw_shared<request>(
-          req.first_sequence,
-          req.last_sequence,
-          model::term_id{-1},
-          std::move(ready)));
+        _requests._finished_requests.push_back({
+          .first_sequence = req.first_sequence,
+          .last_sequence = req.last_sequence,
+          .last_offset = req.last_offset,
+        });
     }
 }
 
@@ -450,11 +460,7 @@ producer_state::apply_transaction_end(model::control_record_type crt) {
 }
 
 std::optional<seq_t> producer_state::last_sequence_number() const {
-    auto maybe_ptr = _requests.last_request();
-    if (!maybe_ptr) {
-        return std::nullopt;
-    }
-    return maybe_ptr.value()->_last_sequence;
+    return _requests.last_sequence();
 }
 
 bool producer_state::has_transaction_in_progress() const {
@@ -477,19 +483,12 @@ producer_state::snapshot(kafka::offset log_start_offset) const {
     snapshot.group = _group;
     snapshot.ms_since_last_update = ms_since_last_update();
     snapshot.finished_requests.reserve(_requests._finished_requests.size());
-    for (auto& req : _requests._finished_requests) {
-        vassert(
-          req->has_completed(),
-          "_finished_requests has unresolved promise: {}, range:[{}, {}]",
-          *this,
-          req->_first_sequence,
-          req->_last_sequence);
-        auto kafka_offset
-          = req->_result.get_shared_future().get().value().last_offset;
+    for (size_t i = 0; i < _requests._finished_requests.size(); ++i) {
+        const auto& req = _requests._finished_requests[i];
         // offsets older than log start are no longer interesting.
-        if (kafka_offset >= log_start_offset) {
+        if (req.last_offset >= log_start_offset) {
             snapshot.finished_requests.emplace_back(
-              req->_first_sequence, req->_last_sequence, kafka_offset);
+              req.first_sequence, req.last_sequence, req.last_offset);
         }
     }
     if (_transaction_state) {
@@ -24,6 +24,7 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <array>
 #include <bit>
 #include <chrono>
 
@@ -98,13 +99,25 @@ private:
     friend class producer_state;
 };
 
+// A request that was applied in the log. Only its sequence range and offset
+// are retained, a retry of the request gets a completed request built from
+// them.
+struct finished_request {
+    seq_t first_sequence;
+    seq_t last_sequence;
+    kafka::offset last_offset;
+
+    bool operator==(const finished_request&) const = default;
+};
+
 // A cached buffer of requests, the requests can be in progress / finished.
 // A request is promoted from inflight to finished once it is applied in the
 // log.
 //
 // We retain a maximum of `requests_cached_max` finished requests.
 // Kafka clients only issue requests in batches of 5, the queue is fairly small
-// at all times.
+// at all times. Finished requests are kept inline in a fixed size ring as
+// every idempotent producer has them, so they don't cost allocations.
 class requests {
 public:
     result<request_ptr> try_emplace(
@@ -123,11 +136,33 @@ private:
     // chunk size of the request containers to avoid wastage.
     static constexpr size_t chunk_size = std::bit_ceil(
       static_cast<unsigned long>(requests_cached_max));
+
+    // The last `requests_cached_max` finished requests, oldest first.
+    class finished_ring {
+    public:
+        void push_back(finished_request);
+        void clear() { _size = 0; }
+
+        const finished_request& operator[](size_t i) const {
+            return _ring[(_head + i) % _ring.size()];
+        }
+        const finished_request& back() const { return (*this)[_size - 1]; }
+        size_t size() const { return _size; }
+        bool empty() const { return _size == 0; }
+
+        bool operator==(const finished_ring&) const;
+
+    private:
+        std::array<finished_request, requests_cached_max> _ring{};
+        uint8_t _head{0};
+        uint8_t _size{0};
+    };
+
     bool is_valid_sequence(seq_t incoming) const;
-    std::optional<request_ptr> last_request() const;
+    std::optional<seq_t> last_sequence() const;
     void gc_requests_from_older_terms(model::term_id current);
     ss::chunked_fifo<request_ptr, chunk_size> _inflight_requests;
-    ss::chunked_fifo<request_ptr, chunk_size> _finished_requests;
+    finished_ring _finished_requests;
     friend producer_state;
 };
 
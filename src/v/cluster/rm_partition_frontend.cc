@@ -18,10 +18,15 @@
 #include "cluster/shard_table.h"
 #include "cluster/tx_gateway_service.h"
 #include "config/configuration.h"
+#include "features/feature_table.h"
 #include "rpc/connection_cache.h"
 #include "types.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <boost/range/irange.hpp>
 
 namespace cluster {
 using namespace std::chrono_literals;
@@ -540,4 +545,245 @@ ss::future<abort_tx_reply> rm_partition_frontend::do_abort_tx(
       });
 }
 
+namespace {
+
+ss::future<std::vector<tx::errc>> end_tx_on_shard(
+  cluster::partition_manager& mgr,
+  model::control_record_type marker,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    std::vector<tx::errc> ecs(ntps.size(), tx::errc::none);
+    co_await ss::coroutine::parallel_for_each(
+      boost::irange<size_t>(0, ntps.size()), [&](size_t i) {
+          auto partition = mgr.get(ntps[i]);
+          if (!partition) {
+              ecs[i] = tx::errc::partition_not_found;
+              return ss::now();
+          }
+          auto stm = partition->rm_stm();
+          if (!stm) {
+              vlog(
+                txlog.warn, "can't get tx stm of the {}' partition", ntps[i]);
+              ecs[i] = tx::errc::stm_not_found;
+              return ss::now();
+          }
+          auto f = marker == model::control_record_type::tx_commit
+                     ? stm->commit_tx(pid, tx_seq, timeout)
+                     : stm->abort_tx(pid, tx_seq, timeout);
+          return f.then([&ecs, i](tx::errc ec) { ecs[i] = ec; });
+      });
+    co_return ecs;
+}
+
+} // namespace
+
+ss::future<std::vector<tx::errc>> rm_partition_frontend::end_tx_batch(
+  model::control_record_type marker,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    if (!_controller->get_feature_table().local().is_active(
+          features::feature::tx_end_batch)) {
+        co_return co_await end_tx_unbatched(
+          marker, std::move(ntps), pid, tx_seq, timeout);
+    }
+
+    std::vector<tx::errc> ecs(ntps.size(), tx::errc::none);
+    // indices of the partitions in `ntps` by the node leading them
+    absl::flat_hash_map<model::node_id, std::vector<size_t>> by_leader;
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        const auto& ntp = ntps[i];
+        auto nt = model::topic_namespace(ntp.ns, ntp.tp.topic);
+        if (!_metadata_cache.local().contains(nt, ntp.tp.partition)) {
+            ecs[i] = tx::errc::partition_not_exists;
+            continue;
+        }
+        if (_metadata_cache.local().is_disabled(nt, ntp.tp.partition)) {
+            ecs[i] = tx::errc::partition_disabled;
+            continue;
+        }
+        auto leader = _leaders.local().get_leader(ntp);
+        if (!leader) {
+            vlog(txlog.warn, "can't find a leader for {} pid:{}", ntp, pid);
+            ecs[i] = tx::errc::leader_not_found;
+            continue;
+        }
+        by_leader[*leader].push_back(i);
+    }
+
+    auto self = _controller->self();
+    co_await ss::coroutine::parallel_for_each(by_leader, [&](auto& entry) {
+        auto leader = entry.first;
+        const auto& indices = entry.second;
+        std::vector<model::ntp> leader_ntps;
+        leader_ntps.reserve(indices.size());
+        for (auto i : indices) {
+            leader_ntps.push_back(ntps[i]);
+        }
+        auto f = leader == self
+                   ? end_tx_batch_locally(
+                       marker, std::move(leader_ntps), pid, tx_seq, timeout)
+                   : dispatch_end_tx_batch(
+                       leader,
+                       marker,
+                       std::move(leader_ntps),
+                       pid,
+                       tx_seq,
+                       timeout);
+        return f.then([&ecs, &indices](std::vector<tx::errc> leader_ecs) {
+            for (size_t j = 0; j < indices.size(); ++j) {
+                ecs[indices[j]] = leader_ecs[j];
+            }
+        });
+    });
+    co_return ecs;
+}
+
+ss::future<std::vector<tx::errc>> rm_partition_frontend::end_tx_unbatched(
+  model::control_record_type marker,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    std::vector<ss::future<tx::errc>> fs;
+    fs.reserve(ntps.size());
+    for (auto& ntp : ntps) {
+        if (marker == model::control_record_type::tx_commit) {
+            fs.push_back(commit_tx(std::move(ntp), pid, tx_seq, timeout)
+                           .then([](commit_tx_reply r) { return r.ec; }));
+        } else {
+            fs.push_back(abort_tx(std::move(ntp), pid, tx_seq, timeout)
+                           .then([](abort_tx_reply r) { return r.ec; }));
+        }
+    }
+    return ss::when_all_succeed(fs.begin(), fs.end());
+}
+
+ss::future<std::vector<tx::errc>> rm_partition_frontend::dispatch_end_tx_batch(
+  model::node_id leader,
+  model::control_record_type marker,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    vlog(
+      txlog.trace,
+      "dispatching name:end_tx_batch, marker:{}, ntps:{}, pid:{}, tx_seq:{}, "
+      "from:{}, to:{}",
+      marker,
+      ntps.size(),
+      pid,
+      tx_seq,
+      _controller->self(),
+      leader);
+    const auto size = ntps.size();
+    auto r
+      = co_await _connection_cache.local()
+          .with_node_client<cluster::tx_gateway_client_protocol>(
+            _controller->self(),
+            ss::this_shard_id(),
+            leader,
+            timeout,
+            [marker, ntps = std::move(ntps), pid, tx_seq, timeout](
+              tx_gateway_client_protocol cp) mutable {
+                return cp.end_tx_batch(
+                  end_tx_batch_request{
+                    marker, std::move(ntps), pid, tx_seq, timeout},
+                  rpc::client_opts(model::timeout_clock::now() + timeout));
+            })
+          .then(&rpc::get_ctx_data<end_tx_batch_reply>);
+    if (r.has_error()) {
+        vlog(txlog.warn, "got error {} on remote end tx batch", r.error());
+        co_return std::vector<tx::errc>(size, tx::errc::timeout);
+    }
+    if (r.value().ecs.size() != size) {
+        vlog(
+          txlog.warn,
+          "remote end tx batch replied for {} partitions, expected {}",
+          r.value().ecs.size(),
+          size);
+        co_return std::vector<tx::errc>(size, tx::errc::unknown_server_error);
+    }
+    vlog(
+      txlog.trace,
+      "received name:end_tx_batch, marker:{}, pid:{}, tx_seq:{}, ecs:{}",
+      marker,
+      pid,
+      tx_seq,
+      fmt::join(r.value().ecs, ", "));
+    co_return std::move(r.value().ecs);
+}
+
+ss::future<std::vector<tx::errc>> rm_partition_frontend::end_tx_batch_locally(
+  model::control_record_type marker,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    vlog(
+      txlog.trace,
+      "processing name:end_tx_batch, marker:{}, ntps:{}, pid:{}, tx_seq:{}",
+      marker,
+      ntps.size(),
+      pid,
+      tx_seq);
+    if (
+      marker != model::control_record_type::tx_commit
+      && marker != model::control_record_type::tx_abort) {
+        co_return std::vector<tx::errc>(
+          ntps.size(), tx::errc::invalid_txn_state);
+    }
+
+    std::vector<tx::errc> ecs(ntps.size(), tx::errc::none);
+    // indices of the partitions in `ntps` by the shard they are on
+    absl::flat_hash_map<ss::shard_id, std::vector<size_t>> by_shard;
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        if (!is_leader_of(ntps[i])) {
+            ecs[i] = tx::errc::leader_not_found;
+            continue;
+        }
+        auto shard = _shard_table.local().shard_for(ntps[i]);
+        if (!shard) {
+            ecs[i] = tx::errc::shard_not_found;
+            continue;
+        }
+        by_shard[*shard].push_back(i);
+    }
+
+    co_await ss::coroutine::parallel_for_each(by_shard, [&](auto& entry) {
+        auto shard = entry.first;
+        const auto& indices = entry.second;
+        std::vector<model::ntp> shard_ntps;
+        shard_ntps.reserve(indices.size());
+        for (auto i : indices) {
+            shard_ntps.push_back(ntps[i]);
+        }
+        return _partition_manager
+          .invoke_on(
+            shard,
+            _ssg,
+            [marker, shard_ntps = std::move(shard_ntps), pid, tx_seq, timeout](
+              cluster::partition_manager& mgr) mutable {
+                return end_tx_on_shard(
+                  mgr, marker, std::move(shard_ntps), pid, tx_seq, timeout);
+            })
+          .then([&ecs, &indices](std::vector<tx::errc> shard_ecs) {
+              for (size_t j = 0; j < indices.size(); ++j) {
+                  ecs[indices[j]] = shard_ecs[j];
+              }
+          });
+    });
+    vlog(
+      txlog.trace,
+      "sending name:end_tx_batch, marker:{}, pid:{}, tx_seq:{}, ecs:{}",
+      marker,
+      pid,
+      tx_seq,
+      fmt::join(ecs, ", "));
+    co_return ecs;
+}
+
 } // namespace cluster
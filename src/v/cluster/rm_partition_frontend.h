@@ -49,6 +49,17 @@ public:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    /// Writes a commit or an abort marker of the transaction to each of
+    /// `ntps`, returning an error code per partition in the same order.
+    /// Partitions led by the same node are handled with a single RPC and,
+    /// on the leader, partitions on the same shard with a single cross shard
+    /// call.
+    ss::future<std::vector<tx::errc>> end_tx_batch(
+      model::control_record_type,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
     ss::future<> stop() {
         _as.request_abort();
         return ss::make_ready_future<>();
@@ -120,6 +131,25 @@ private:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    ss::future<std::vector<tx::errc>> end_tx_unbatched(
+      model::control_record_type,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
+    ss::future<std::vector<tx::errc>> dispatch_end_tx_batch(
+      model::node_id,
+      model::control_record_type,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
+    ss::future<std::vector<tx::errc>> end_tx_batch_locally(
+      model::control_record_type,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
 
     friend tx_gateway;
 };
@@ -1125,7 +1125,7 @@ rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
         }
     }
 
-    filter_intersecting(result, _aborted_tx_state.aborted, from, to);
+    _aborted_tx_state.aborted.collect_intersecting(result, from, to);
 
     for (const auto& idx : intersecting_idxes) {
         auto opt = co_await load_abort_snapshot(idx);
@@ -1415,6 +1415,12 @@ void rm_stm::apply_fence(model::producer_identity pid, model::record_batch b) {
     _producer_state_manager.local().touch(*producer, _vcluster_id);
 }
 
+bool rm_stm::applies_to(model::record_batch_type type) const {
+    return type == model::record_batch_type::tx_fence
+           || type == model::record_batch_type::tx_prepare
+           || type == model::record_batch_type::raft_data;
+}
+
 ss::future<> rm_stm::apply(const model::record_batch& b) {
     const auto& hdr = b.header();
     const auto bid = model::batch_identity::from(hdr);
@@ -1546,13 +1552,13 @@ rm_stm::apply_local_snapshot(raft::stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
 
     _highest_producer_id = std::max(
       data.highest_producer_id, _highest_producer_id);
-    _aborted_tx_state.aborted = std::move(data.aborted);
+    _aborted_tx_state.aborted = tx::aborted_tx_index(std::move(data.aborted));
     co_await ss::max_concurrent_for_each(
       data.abort_indexes, 32, [this](const abort_index& idx) -> ss::future<> {
           auto f_name = abort_idx_name(idx.first, idx.last);
           return _abort_snapshot_mgr.get_snapshot_size(f_name).then(
             [this, idx](uint64_t snapshot_size) {
-                _abort_snapshot_sizes.emplace(
+                add_abort_snapshot_size(
                   std::make_pair(idx.first, idx.last), snapshot_size);
             });
       });
@@ -1638,14 +1644,11 @@ uint8_t rm_stm::active_snapshot_version() {
 ss::future<> rm_stm::offload_aborted_txns() {
     // Note: this method requires a consistent view of aborted state
     // make sure to call this under _state_lock.write_lock()
-    std::sort(
-      std::begin(_aborted_tx_state.aborted),
-      std::end(_aborted_tx_state.aborted),
-      [](tx_range a, tx_range b) { return a.first < b.first; });
+    auto aborted = std::move(_aborted_tx_state.aborted).release();
 
     abort_snapshot snapshot{
       .first = model::offset::max(), .last = model::offset::min()};
-    for (auto const& entry : _aborted_tx_state.aborted) {
+    for (auto const& entry : aborted) {
         snapshot.first = std::min(snapshot.first, entry.first);
         snapshot.last = std::max(snapshot.last, entry.last);
         snapshot.aborted.push_back(entry);
@@ -1657,7 +1660,8 @@ ss::future<> rm_stm::offload_aborted_txns() {
               .first = model::offset::max(), .last = model::offset::min()};
         }
     }
-    _aborted_tx_state.aborted = std::move(snapshot.aborted);
+    _aborted_tx_state.aborted = tx::aborted_tx_index(
+      std::move(snapshot.aborted));
 }
 
 ss::future<raft::stm_snapshot> rm_stm::take_local_snapshot() {
@@ -1709,17 +1713,11 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
             _ctx_log.debug,
             "removing aborted transactions {} snapshot file",
             f_name);
-          _abort_snapshot_sizes.erase(std::make_pair(idx.first, idx.last));
+          remove_abort_snapshot_size(std::make_pair(idx.first, idx.last));
           return _abort_snapshot_mgr.remove_snapshot(f_name);
       });
 
-    fragmented_vector<tx_range> aborted;
-    std::copy_if(
-      _aborted_tx_state.aborted.begin(),
-      _aborted_tx_state.aborted.end(),
-      std::back_inserter(aborted),
-      [start_offset](tx_range range) { return range.last >= start_offset; });
-    _aborted_tx_state.aborted = std::move(aborted);
+    _aborted_tx_state.aborted.remove_ending_before(start_offset);
 
     if (_aborted_tx_state.aborted.size() > _abort_index_segment_size) {
         // There is nested locking here. Snapshot is done under
@@ -1759,15 +1757,11 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
 }
 
 uint64_t rm_stm::get_local_snapshot_size() const {
-    uint64_t abort_snapshots_size = 0;
-    for (const auto& snapshot_size : _abort_snapshot_sizes) {
-        abort_snapshots_size += snapshot_size.second;
-    }
     vlog(
       clusterlog.trace,
       "rm_stm: aborted snapshots size {}",
-      abort_snapshots_size);
-    return persisted_stm::get_local_snapshot_size() + abort_snapshots_size;
+      _abort_snapshots_size);
+    return persisted_stm::get_local_snapshot_size() + _abort_snapshots_size;
 }
 
 ss::future<> rm_stm::save_abort_snapshot(abort_snapshot snapshot) {
@@ -1790,10 +1784,27 @@ ss::future<> rm_stm::save_abort_snapshot(abort_snapshot snapshot) {
     co_await _abort_snapshot_mgr.finish_snapshot(writer);
     uint64_t snapshot_disk_size
       = co_await _abort_snapshot_mgr.get_snapshot_size(filename);
-    _abort_snapshot_sizes.emplace(
+    add_abort_snapshot_size(
       std::make_pair(first_offset, last_offset), snapshot_disk_size);
 }
 
+void rm_stm::add_abort_snapshot_size(
+  std::pair<model::offset, model::offset> range, uint64_t size) {
+    if (_abort_snapshot_sizes.emplace(range, size).second) {
+        _abort_snapshots_size += size;
+    }
+}
+
+void rm_stm::remove_abort_snapshot_size(
+  std::pair<model::offset, model::offset> range) {
+    auto it = _abort_snapshot_sizes.find(range);
+    if (it == _abort_snapshot_sizes.end()) {
+        return;
+    }
+    _abort_snapshots_size -= it->second;
+    _abort_snapshot_sizes.erase(it);
+}
+
 ss::future<std::optional<abort_snapshot>>
 rm_stm::load_abort_snapshot(abort_index index) {
     auto filename = abort_idx_name(index.first, index.last);
@@ -1843,6 +1854,7 @@ ss::future<> rm_stm::remove_persistent_state() {
 
 ss::future<> rm_stm::do_remove_persistent_state() {
     _abort_snapshot_sizes.clear();
+    _abort_snapshots_size = 0;
     for (const auto& idx : _aborted_tx_state.abort_indexes) {
         auto filename = abort_idx_name(idx.first, idx.last);
         co_await _abort_snapshot_mgr.remove_snapshot(filename);
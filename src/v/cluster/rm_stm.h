@@ -12,6 +12,7 @@
 #pragma once
 
 #include "bytes/iobuf.h"
+#include "cluster/aborted_tx_index.h"
 #include "cluster/fwd.h"
 #include "cluster/producer_state.h"
 #include "cluster/rm_stm_types.h"
@@ -257,6 +258,9 @@ private:
     ss::future<std::optional<tx::abort_snapshot>>
       load_abort_snapshot(tx::abort_index);
     ss::future<> save_abort_snapshot(tx::abort_snapshot);
+    void add_abort_snapshot_size(
+      std::pair<model::offset, model::offset>, uint64_t);
+    void remove_abort_snapshot_size(std::pair<model::offset, model::offset>);
 
     ss::future<result<kafka_result>> do_replicate(
       model::batch_identity,
@@ -320,6 +324,7 @@ private:
     abort_origin get_abort_origin(tx::producer_ptr, model::tx_seq) const;
 
     ss::future<> apply(const model::record_batch&) override;
+    bool applies_to(model::record_batch_type) const override;
     void apply_fence(model::producer_identity, model::record_batch);
     void apply_control(model::producer_identity, model::control_record_type);
     void apply_data(model::batch_identity, const model::record_batch_header&);
@@ -334,7 +339,7 @@ private:
 
     // Populated from state machine up calls.
     struct aborted_tx_state {
-        fragmented_vector<tx::tx_range> aborted;
+        tx::aborted_tx_index aborted;
         fragmented_vector<tx::abort_index> abort_indexes;
         tx::abort_snapshot last_abort_snapshot{.last = model::offset(-1)};
     };
@@ -372,6 +377,8 @@ private:
     storage::snapshot_manager _abort_snapshot_mgr;
     absl::flat_hash_map<std::pair<model::offset, model::offset>, uint64_t>
       _abort_snapshot_sizes{};
+    // sum of _abort_snapshot_sizes, reported with every health report
+    uint64_t _abort_snapshots_size{0};
     ss::sharded<features::feature_table>& _feature_table;
     prefix_logger _ctx_log;
     ss::sharded<tx::producer_state_manager>& _producer_state_manager;
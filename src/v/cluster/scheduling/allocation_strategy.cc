@@ -57,6 +57,7 @@ std::vector<model::node_id> solve_hard_constraints(
         return possible_nodes;
     }
 
+    possible_nodes.reserve(nodes.size());
     for (auto& p : nodes) {
         auto& node = p.second;
         bool result = true;
@@ -109,6 +110,7 @@ std::vector<model::node_id> optimize_constraints(
 
     uint32_t best_score = 0;
     std::vector<model::node_id> best_fits;
+    best_fits.reserve(possible_nodes.size());
 
     for (const auto& id : possible_nodes) {
         auto it = allocation_nodes.find(id);
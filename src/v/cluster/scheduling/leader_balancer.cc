@@ -432,6 +432,15 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
     auto muted_nodes = collect_muted_nodes(health_report.value());
 
     auto mode = config::shard_local_cfg().leader_balancer_mode();
+    leader_balancer_types::group_load_t group_loads;
+    if (
+      mode == model::leader_balancer_mode::random_hill_climbing
+      && config::shard_local_cfg().leader_balancer_throughput_aware()) {
+        group_loads = co_await collect_group_loads(health_report.value());
+    } else {
+        _last_leader_bytes.clear();
+        _last_leader_bytes_at.reset();
+    }
     std::unique_ptr<leader_balancer_strategy> strategy;
 
     switch (mode) {
@@ -441,7 +450,8 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
           leader_balancer_types::random_hill_climbing_strategy>(
           std::move(index),
           std::move(group_id_to_topic),
-          leader_balancer_types::muted_index{std::move(muted_nodes), {}});
+          leader_balancer_types::muted_index{std::move(muted_nodes), {}},
+          group_loads);
         break;
     case model::leader_balancer_mode::greedy_balanced_shards:
         vlog(clusterlog.debug, "using greedy_balanced_shards");
@@ -741,6 +751,72 @@ leader_balancer::collect_group_replicas_from_health_report(
     co_return group_replicas;
 }
 
+/*
+ * Computes the load of each group as the rate of bytes transferred by its
+ * leader since the previous balancer tick. Groups whose leader changed or whose
+ * counter went backwards (e.g. after a restart) get no load on this tick.
+ */
+ss::future<leader_balancer_types::group_load_t>
+leader_balancer::collect_group_loads(const cluster_health_report& hr) {
+    const auto now = clock_type::now();
+    chunked_hash_map<raft::group_id, leader_bytes> leader_bytes;
+    ssx::async_counter counter;
+    for (const auto& node : hr.node_reports) {
+        for (const auto& topic : node->topics) {
+            auto maybe_meta = _topics.get_topic_metadata_ref(topic.tp_ns);
+            if (!maybe_meta) {
+                continue;
+            }
+            const auto& meta = maybe_meta->get();
+
+            co_await ssx::async_for_each_counter(
+              counter,
+              topic.partitions.begin(),
+              topic.partitions.end(),
+              [&](const partition_status& partition) {
+                  if (
+                    partition.leader_id != node->id
+                    || !partition.leader_bytes_transferred) {
+                      return;
+                  }
+                  auto as_it = meta.get_assignments().find(partition.id);
+                  if (as_it != meta.get_assignments().end()) {
+                      leader_bytes.insert_or_assign(
+                        as_it->second.group,
+                        leader_balancer::leader_bytes{
+                          .leader = node->id,
+                          .bytes = *partition.leader_bytes_transferred,
+                        });
+                  }
+              });
+        }
+    }
+
+    leader_balancer_types::group_load_t group_loads;
+    if (_last_leader_bytes_at && now > *_last_leader_bytes_at) {
+        const auto elapsed = std::chrono::duration<double>(
+                               now - *_last_leader_bytes_at)
+                               .count();
+        for (const auto& [group, current] : leader_bytes) {
+            auto it = _last_leader_bytes.find(group);
+            if (
+              it == _last_leader_bytes.end()
+              || it->second.leader != current.leader
+              || it->second.bytes > current.bytes) {
+                continue;
+            }
+            group_loads.emplace(
+              group,
+              static_cast<double>(current.bytes - it->second.bytes)
+                / elapsed);
+        }
+    }
+
+    _last_leader_bytes = std::move(leader_bytes);
+    _last_leader_bytes_at = now;
+    co_return group_loads;
+}
+
 /*
  * builds an index that maps each core in the cluster to the set of replica
  * groups such that the leader of each mapped replica group is on the given
@@ -113,6 +113,8 @@ private:
     index_type build_index(std::optional<group_replicas_t>);
     absl::flat_hash_set<model::node_id>
     collect_muted_nodes(const cluster_health_report&);
+    ss::future<leader_balancer_types::group_load_t>
+    collect_group_loads(const cluster_health_report&);
 
     leader_balancer_types::muted_groups_t muted_groups() const;
 
@@ -189,6 +191,18 @@ private:
     };
     absl::btree_map<raft::group_id, last_known_leader> _last_leader;
 
+    /*
+     * Cumulative bytes transferred by group leaders as of the previous
+     * balancer tick. Group loads are computed as the rate of change of these
+     * counters between ticks.
+     */
+    struct leader_bytes {
+        model::node_id leader;
+        uint64_t bytes;
+    };
+    chunked_hash_map<raft::group_id, leader_bytes> _last_leader_bytes;
+    std::optional<clock_type::time_point> _last_leader_bytes_at;
+
     leader_balancer_probe _probe;
     bool _need_controller_refresh{true};
     bool _throttled{false};
@@ -13,6 +13,9 @@
 #include "base/vassert.h"
 #include "model/metadata.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace cluster::leader_balancer_types {
 
 even_topic_distributon_constraint::even_topic_distributon_constraint(
@@ -288,4 +291,134 @@ std::vector<shard_load> even_shard_load_constraint::stats() const {
     return ret;
 }
 
+even_shard_throughput_constraint::even_shard_throughput_constraint(
+  const group_load_t& group_load,
+  const shard_index& si,
+  const muted_index& mi)
+  : _si(si)
+  , _mi(mi) {
+    size_t num_groups = 0;
+    double total_load = 0;
+    for (const auto& [shard, groups] : si.shards()) {
+        num_groups += groups.size();
+        for (const auto& [group, _] : groups) {
+            if (auto it = group_load.find(group); it != group_load.end()) {
+                total_load += it->second;
+            }
+        }
+    }
+
+    const double scale = total_load > 0 ? num_groups / total_load : 0;
+    double non_muted_load = 0;
+    size_t non_muted_cores = 0;
+    for (const auto& [shard, groups] : si.shards()) {
+        double load = 0;
+        for (const auto& [group, _] : groups) {
+            if (auto it = group_load.find(group); it != group_load.end()) {
+                const auto scaled = it->second * scale;
+                _group_load.emplace(group, scaled);
+                load += scaled;
+            }
+        }
+        _shard_load[shard] = load;
+        if (!mi.muted_nodes().contains(shard.node_id)) {
+            non_muted_load += load;
+            non_muted_cores += 1;
+        }
+    }
+
+    if (non_muted_cores > 0) {
+        _target_load = non_muted_load / static_cast<double>(non_muted_cores);
+    }
+
+    for (const auto& [_, load] : _shard_load) {
+        _error += shard_error(load);
+    }
+}
+
+void even_shard_throughput_constraint::update_index(const reassignment& r) {
+    const auto load = group_load(r.group);
+    _error -= improvement(load, r.from, r.to);
+    _shard_load[r.from] -= load;
+    _shard_load[r.to] += load;
+}
+
+std::optional<reassignment>
+even_shard_throughput_constraint::recommended_reassignment() {
+    std::vector<std::pair<double, model::broker_shard>> shards;
+    shards.reserve(_shard_load.size());
+    for (const auto& [shard, load] : _shard_load) {
+        shards.emplace_back(load, shard);
+    }
+    std::sort(shards.begin(), shards.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for (const auto& [_, from] : shards) {
+        if (mi().muted_nodes().contains(from.node_id)) {
+            continue;
+        }
+        auto groups_it = si().shards().find(from);
+        if (groups_it == si().shards().end()) {
+            continue;
+        }
+
+        double best_improvement = error_jitter;
+        std::optional<reassignment> best;
+        for (const auto& [group, replicas] : groups_it->second) {
+            if (mi().muted_groups().contains(static_cast<uint64_t>(group))) {
+                continue;
+            }
+            const auto load = group_load(group);
+            if (load <= 0) {
+                continue;
+            }
+            for (const auto& to : replicas) {
+                if (to == from || mi().muted_nodes().contains(to.node_id)) {
+                    continue;
+                }
+                const auto imp = improvement(load, from, to);
+                if (imp > best_improvement) {
+                    best_improvement = imp;
+                    best = reassignment{group, from, to};
+                }
+            }
+        }
+
+        if (best) {
+            return best;
+        }
+    }
+
+    return std::nullopt;
+}
+
+double
+even_shard_throughput_constraint::group_load(raft::group_id group) const {
+    auto it = _group_load.find(group);
+    return it == _group_load.end() ? 0 : it->second;
+}
+
+double even_shard_throughput_constraint::shard_load(
+  const model::broker_shard& shard) const {
+    auto it = _shard_load.find(shard);
+    return it == _shard_load.end() ? 0 : it->second;
+}
+
+double even_shard_throughput_constraint::shard_error(double load) const {
+    const auto excess = std::max(
+      0.0, std::abs(load - _target_load) - load_tolerance * _target_load);
+    return excess * excess;
+}
+
+double even_shard_throughput_constraint::improvement(
+  double load,
+  const model::broker_shard& from,
+  const model::broker_shard& to) const {
+    const auto from_load = shard_load(from);
+    const auto to_load = shard_load(to);
+    return shard_error(from_load) + shard_error(to_load)
+           - shard_error(from_load - load) - shard_error(to_load + load);
+}
+
 } // namespace cluster::leader_balancer_types
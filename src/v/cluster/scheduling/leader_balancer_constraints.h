@@ -306,4 +306,84 @@ private:
     std::pair<load_t, load_map_t> build_load_indexes() const;
 };
 
+/*
+ * Evaluates how evenly the load of the groups, in bytes produced and fetched
+ * per second, is spread across the shards leading them. Group loads are scaled
+ * so that the total load equals the number of groups, which makes the error
+ * comparable to the error of even_shard_load_constraint.
+ *
+ * Shard loads within a tolerance band around the target load don't contribute
+ * to the error. This provides hysteresis: small changes in throughput don't
+ * make leadership flap between shards.
+ */
+class even_shard_throughput_constraint final
+  : public soft_constraint
+  , public index {
+    static constexpr double error_jitter = 0.000001;
+
+public:
+    // The fraction of the target load a shard may deviate from it by without
+    // contributing to the error.
+    static constexpr double load_tolerance = 0.1;
+
+    even_shard_throughput_constraint(
+      const group_load_t& group_load,
+      const shard_index& si,
+      const muted_index& mi);
+
+    even_shard_throughput_constraint(
+      even_shard_throughput_constraint&&) noexcept
+      = default;
+    even_shard_throughput_constraint&
+    operator=(even_shard_throughput_constraint&&) noexcept
+      = default;
+
+    even_shard_throughput_constraint(const even_shard_throughput_constraint&)
+      = delete;
+    even_shard_throughput_constraint&
+    operator=(const even_shard_throughput_constraint&)
+      = delete;
+
+    ~even_shard_throughput_constraint() override = default;
+
+    double error() const { return _error; }
+
+    void update_index(const reassignment& r) override;
+
+    /*
+     * Looks at the shards in order of decreasing load and returns the move of
+     * a group from the first such shard that reduces error the most.
+     */
+    std::optional<reassignment> recommended_reassignment() override;
+
+private:
+    std::reference_wrapper<const shard_index> _si;
+    std::reference_wrapper<const muted_index> _mi;
+    // Scaled group loads, groups without a known load have no entry.
+    group_load_t _group_load;
+    absl::flat_hash_map<model::broker_shard, double> _shard_load;
+    double _target_load{0};
+    double _error{0};
+
+    const shard_index& si() const { return _si.get(); }
+    const muted_index& mi() const { return _mi.get(); }
+
+    double group_load(raft::group_id) const;
+    double shard_load(const model::broker_shard&) const;
+    double shard_error(double load) const;
+
+    /*
+     * Returns the error reduction of moving a group with the given load
+     * between the two shards. Evaluating a move takes constant time.
+     */
+    double improvement(
+      double load,
+      const model::broker_shard& from,
+      const model::broker_shard& to) const;
+
+    double evaluate_internal(const reassignment& r) override {
+        return improvement(group_load(r.group), r.from, r.to);
+    }
+};
+
 } // namespace cluster::leader_balancer_types
@@ -102,14 +102,23 @@ private:
 class random_hill_climbing_strategy final : public leader_balancer_strategy {
 public:
     random_hill_climbing_strategy(
-      index_type index, group_id_to_topic_revision_t g_to_ntp, muted_index mi)
+      index_type index,
+      group_id_to_topic_revision_t g_to_ntp,
+      muted_index mi,
+      const group_load_t& group_load = {})
       : _mi(std::make_unique<muted_index>(std::move(mi)))
       , _si(std::make_unique<shard_index>(std::move(index)))
       , _reassignments(_si->shards())
       , _etdc(std::move(g_to_ntp), *_si, *_mi)
-      , _eslc(*_si, *_mi) {}
+      , _eslc(*_si, *_mi) {
+        if (!group_load.empty()) {
+            _estc.emplace(group_load, *_si, *_mi);
+        }
+    }
 
-    double error() const override { return _eslc.error() + _etdc.error(); }
+    double error() const override {
+        return _eslc.error() + _etdc.error() + (_estc ? _estc->error() : 0);
+    }
 
     /*
      * Find a group reassignment that reduces total error.
@@ -133,6 +142,9 @@ public:
 
             auto eval = _etdc.evaluate(reassignment)
                         + _eslc.evaluate(reassignment);
+            if (_estc) {
+                eval += _estc->evaluate(reassignment);
+            }
 
             if (eval <= error_jitter) {
                 continue;
@@ -147,6 +159,9 @@ public:
     void apply_movement(const reassignment& reassignment) override {
         _etdc.update_index(reassignment);
         _eslc.update_index(reassignment);
+        if (_estc) {
+            _estc->update_index(reassignment);
+        }
         _mi->update_index(reassignment);
         _si->update_index(reassignment);
         _reassignments.update_index(reassignment);
@@ -166,6 +181,8 @@ private:
 
     even_topic_distributon_constraint _etdc;
     even_shard_load_constraint _eslc;
+    // Only present when group loads are known.
+    std::optional<even_shard_throughput_constraint> _estc;
 };
 
 } // namespace cluster::leader_balancer_types
@@ -42,6 +42,12 @@ using group_id_to_topic_revision_t
   = chunked_hash_map<raft::group_id, model::revision_id>;
 
 using muted_groups_t = roaring::Roaring64Map;
+
+/*
+ * Load of each group, in bytes produced and fetched per second, as measured on
+ * its current leader.
+ */
+using group_load_t = chunked_hash_map<raft::group_id, double>;
 /*
  * Leaders per shard.
  */
@@ -267,6 +267,18 @@ partition_allocator::allocate(allocation_request request) {
         std::optional<raft::group_id> existing_group;
     };
 
+    // constraints are shared pointers, so the ones common to all partitions
+    // of the request are created once and only the partition specific
+    // constraints are added for each partition.
+    auto request_constraints = default_constraints();
+    if (node2count) {
+        request_constraints.ensure_new_level();
+        request_constraints.add(
+          min_count_in_map("min topic-wise count", *node2count));
+    }
+    request_constraints.ensure_new_level();
+    request_constraints.add(max_final_capacity(request.domain));
+
     chunked_vector<allocation_info> allocations;
     allocations.reserve(request.partitions.size());
     for (auto& p_constraints : request.partitions) {
@@ -278,14 +290,7 @@ partition_allocator::allocate(allocation_request request) {
             co_return errc::topic_invalid_replication_factor;
         }
 
-        auto effective_constraints = default_constraints();
-        if (node2count) {
-            effective_constraints.ensure_new_level();
-            effective_constraints.add(
-              min_count_in_map("min topic-wise count", *node2count));
-        }
-        effective_constraints.ensure_new_level();
-        effective_constraints.add(max_final_capacity(request.domain));
+        auto effective_constraints = request_constraints;
         effective_constraints.add(p_constraints.constraints);
 
         auto ntp = model::ntp(nt.ns, nt.tp, p_constraints.partition_id);
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/self_test/kafkacheck.h"
+
+#include "base/units.h"
+#include "base/vlog.h"
+#include "cluster/logger.h"
+#include "cluster/partition.h"
+#include "cluster/partition_manager.h"
+#include "model/namespace.h"
+#include "model/record_batch_reader.h"
+#include "random/generators.h"
+#include "raft/replicate.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/with_scheduling_group.hh>
+
+#include <boost/range/irange.hpp>
+
+namespace cluster::self_test {
+
+namespace {
+using hr_clock = std::chrono::steady_clock;
+
+/// Upper bound of the latency histograms
+constexpr int64_t max_latency_us = 10'000'000;
+/// Same as the default limit of a fetch for a single partition
+constexpr size_t fetch_max_bytes = 1_MiB;
+
+std::chrono::microseconds since(hr_clock::time_point tp) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+      hr_clock::now() - tp);
+}
+
+model::record_batch make_batch(const kafkacheck_opts& opts) {
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    const auto value = random_generators::gen_alphanum_string(
+      opts.record_size);
+    for (uint16_t i = 0; i < opts.records_per_batch; ++i) {
+        iobuf v;
+        v.append(value.data(), value.size());
+        builder.add_raw_kv(std::nullopt, std::move(v));
+    }
+    return std::move(builder).build();
+}
+} // namespace
+
+void kafkacheck::validate_options(const kafkacheck_opts& opts) {
+    using namespace std::chrono_literals;
+    if (opts.topic().empty()) {
+        throw kafkacheck_option_out_of_range("No topic to run against");
+    }
+    const auto duration = std::chrono::duration_cast<std::chrono::seconds>(
+      opts.duration);
+    if (duration < 1s || duration > (5 * 60s)) {
+        throw kafkacheck_option_out_of_range(
+          "Duration out of range, min is 1s max is 5 minutes");
+    }
+    if (opts.parallelism < 1 || opts.parallelism > 256) {
+        throw kafkacheck_option_out_of_range(
+          "Parallelism out of range, min is 1, max 256");
+    }
+    if (opts.record_size < 1 || opts.records_per_batch < 1) {
+        throw kafkacheck_option_out_of_range(
+          "Record size and records per batch must be at least 1");
+    }
+    if (opts.batch_size() > 1_MiB) {
+        throw kafkacheck_option_out_of_range(
+          "Batch size (record_size * records_per_batch) out of range, max is "
+          "1MiB");
+    }
+}
+
+kafkacheck::kafkacheck(ss::sharded<partition_manager>& pm)
+  : _pm(pm) {}
+
+ss::future<> kafkacheck::start() { return ss::now(); }
+
+ss::future<> kafkacheck::stop() {
+    auto f = _gate.close();
+    _as.request_abort();
+    return f;
+}
+
+void kafkacheck::cancel() { _cancelled = true; }
+
+ss::future<std::vector<self_test_result>>
+kafkacheck::run(kafkacheck_opts opts) {
+    if (_gate.is_closed()) {
+        vlog(clusterlog.debug, "kafkacheck - gate already closed");
+        co_return std::vector<self_test_result>();
+    }
+    auto g = _gate.hold();
+    co_await ss::futurize_invoke(validate_options, opts);
+    vlog(
+      clusterlog.info,
+      "Starting redpanda self-test kafka benchmark, with options: {}",
+      opts);
+    _cancelled = false;
+    _opts = opts;
+    auto targets = co_await find_targets();
+    if (targets.empty()) {
+        co_return std::vector<self_test_result>{self_test_result{
+          .name = _opts.name,
+          .test_type = "kafka",
+          .warning = fmt::format(
+            "No partition of topic {} is led by this node", _opts.topic)}};
+    }
+    co_return co_await ss::with_scheduling_group(
+      _opts.sg, [this, targets = std::move(targets)]() mutable {
+          return run_configured_benchmarks(std::move(targets));
+      });
+}
+
+ss::future<std::vector<kafkacheck::target>> kafkacheck::find_targets() {
+    auto per_shard = co_await _pm.map(
+      [tp_ns = model::topic_namespace(model::kafka_namespace, _opts.topic)](
+        partition_manager& pm) {
+          std::vector<target> targets;
+          for (const auto& [ntp, p] : pm.get_topic_partition_table(tp_ns)) {
+              if (p->is_leader()) {
+                  targets.push_back(target{
+                    .ntp = ntp,
+                    .shard = ss::this_shard_id(),
+                    .start = model::next_offset(p->dirty_offset())});
+              }
+          }
+          return targets;
+      });
+    std::vector<target> targets;
+    for (auto& ts : per_shard) {
+        std::move(ts.begin(), ts.end(), std::back_inserter(targets));
+    }
+    co_return targets;
+}
+
+ss::future<std::vector<self_test_result>>
+kafkacheck::run_configured_benchmarks(std::vector<target> targets) {
+    std::vector<self_test_result> r;
+    const auto irange = boost::irange<uint16_t>(0, _opts.parallelism);
+    const auto params = fmt::format(
+      "acks: {}, partitions: {}, parallelism: {}, batch size: {}",
+      _opts.acks_all ? "all" : "1",
+      targets.size(),
+      _opts.parallelism,
+      _opts.batch_size());
+
+    metrics enqueue{max_latency_us};
+    metrics replicate{max_latency_us};
+    auto start = ss::lowres_clock::now();
+    auto start_highres = ss::lowres_system_clock::now();
+    co_await ss::parallel_for_each(irange, [&](uint16_t i) {
+        return run_produce_fiber(
+          start + _opts.duration,
+          targets[i % targets.size()],
+          enqueue,
+          replicate);
+    });
+    auto end = ss::lowres_system_clock::now();
+    for (auto* m : {&enqueue, &replicate}) {
+        m->set_start_end_time(start_highres, end);
+        m->set_total_time(end - start_highres);
+    }
+    r.push_back(make_result(
+      enqueue, fmt::format("produce run, enqueue stage ({})", params)));
+    r.push_back(make_result(
+      replicate, fmt::format("produce run, replicate stage ({})", params)));
+
+    if (!_opts.skip_read && !_cancelled) {
+        metrics fetch{max_latency_us};
+        start = ss::lowres_clock::now();
+        start_highres = ss::lowres_system_clock::now();
+        co_await ss::parallel_for_each(irange, [&](uint16_t i) {
+            return run_fetch_fiber(
+              start + _opts.duration, targets[i % targets.size()], fetch);
+        });
+        end = ss::lowres_system_clock::now();
+        fetch.set_start_end_time(start_highres, end);
+        fetch.set_total_time(end - start_highres);
+        r.push_back(make_result(fetch, fmt::format("fetch run ({})", params)));
+    }
+    co_return r;
+}
+
+ss::future<> kafkacheck::run_produce_fiber(
+  ss::lowres_clock::time_point stop,
+  const target& t,
+  metrics& enqueue,
+  metrics& replicate) {
+    while (stop > ss::lowres_clock::now() && !_cancelled
+           && !_as.abort_requested()) {
+        auto stages = co_await _pm.invoke_on(
+          t.shard, [ntp = t.ntp, opts = _opts](partition_manager& pm) {
+              return ss::with_scheduling_group(opts.sg, [&pm, ntp, opts] {
+                  return produce_once(pm, ntp, opts);
+              });
+          });
+        enqueue.record(stages.enqueue, _opts.batch_size());
+        replicate.record(stages.replicate, _opts.batch_size());
+    }
+}
+
+ss::future<> kafkacheck::run_fetch_fiber(
+  ss::lowres_clock::time_point stop, const target& t, metrics& fetch) {
+    auto offset = t.start;
+    while (stop > ss::lowres_clock::now() && !_cancelled
+           && !_as.abort_requested()) {
+        auto r = co_await _pm.invoke_on(
+          t.shard,
+          [ntp = t.ntp, sg = _opts.sg, offset](partition_manager& pm) {
+              return ss::with_scheduling_group(sg, [&pm, ntp, offset] {
+                  return fetch_once(pm, ntp, offset);
+              });
+          });
+        if (r.bytes == 0) {
+            if (offset == t.start) {
+                // Nothing was produced to this partition
+                co_return;
+            }
+            // Read everything that was produced, start over
+            offset = t.start;
+            continue;
+        }
+        fetch.record(r.latency, r.bytes);
+        offset = r.next;
+    }
+}
+
+ss::future<kafkacheck::produce_stages> kafkacheck::produce_once(
+  partition_manager& pm, model::ntp ntp, kafkacheck_opts opts) {
+    auto p = pm.get(ntp);
+    if (!p || !p->is_leader()) {
+        throw kafkacheck_exception(
+          fmt::format("Lost leadership of {} during the benchmark", ntp));
+    }
+    auto batch = make_batch(opts);
+    auto bid = model::batch_identity::from(batch.header());
+    raft::replicate_options ropts(
+      opts.acks_all ? raft::consistency_level::quorum_ack
+                    : raft::consistency_level::leader_ack);
+
+    const auto begin = hr_clock::now();
+    auto stages = p->replicate_in_stages(
+      bid, model::make_memory_record_batch_reader(std::move(batch)), ropts);
+    co_await std::move(stages.request_enqueued);
+    produce_stages res{.enqueue = since(begin)};
+    auto r = co_await std::move(stages.replicate_finished);
+    res.replicate = since(begin);
+    if (r.has_error()) {
+        throw kafkacheck_exception(fmt::format(
+          "Produce to {} failed: {}", ntp, r.error().message()));
+    }
+    co_return res;
+}
+
+ss::future<kafkacheck::fetch_result> kafkacheck::fetch_once(
+  partition_manager& pm, model::ntp ntp, model::offset offset) {
+    auto p = pm.get(ntp);
+    if (!p) {
+        throw kafkacheck_exception(
+          fmt::format("Partition {} removed during the benchmark", ntp));
+    }
+    storage::log_reader_config cfg(
+      offset,
+      model::offset::max(),
+      0,
+      fetch_max_bytes,
+      ss::default_priority_class(),
+      model::record_batch_type::raft_data,
+      std::nullopt,
+      std::nullopt);
+
+    const auto begin = hr_clock::now();
+    auto rdr = co_await p->make_reader(cfg);
+    auto batches = co_await model::consume_reader_to_memory(
+      std::move(rdr), model::no_timeout);
+    fetch_result res{.latency = since(begin), .next = offset};
+    for (const auto& b : batches) {
+        res.bytes += b.size_bytes();
+        res.next = model::next_offset(b.last_offset());
+    }
+    co_return res;
+}
+
+self_test_result
+kafkacheck::make_result(const metrics& m, ss::sstring info) const {
+    auto result = m.to_st_result();
+    result.name = _opts.name;
+    result.info = std::move(info);
+    result.test_type = "kafka";
+    if (_cancelled) {
+        result.warning = "Run was manually cancelled";
+    }
+    return result;
+}
+
+} // namespace cluster::self_test
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "cluster/fwd.h"
+#include "cluster/self_test/metrics.h"
+#include "cluster/self_test_rpc_types.h"
+#include "model/fundamental.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
+
+#include <chrono>
+#include <exception>
+#include <vector>
+
+namespace cluster::self_test {
+
+class kafkacheck_exception : public std::runtime_error {
+public:
+    explicit kafkacheck_exception(const std::string& msg)
+      : std::runtime_error(msg) {}
+};
+class kafkacheck_option_out_of_range final : public kafkacheck_exception {
+public:
+    explicit kafkacheck_option_out_of_range(const ss::sstring& msg)
+      : kafkacheck_exception(msg) {}
+};
+
+/// Produce and fetch benchmark running through the partitions of a topic
+///
+/// Synthetic batches are replicated through the same partition interface that
+/// the kafka produce handler uses, then read back through the one the fetch
+/// handler uses. The latency of each stage is reported separately so that the
+/// effect of tuning the write path (raft, storage, write caching) can be
+/// observed on a live cluster without an external load generator.
+class kafkacheck final {
+public:
+    /// Made public for unit testing, only used internally
+    ///
+    static void validate_options(const kafkacheck_opts& opts);
+
+    /// Class constructor
+    ///
+    explicit kafkacheck(ss::sharded<partition_manager>& pm);
+
+    /// Initialize the benchmark
+    ///
+    ss::future<> start();
+
+    /// Stops the benchmark
+    ///
+    /// On resolution of the future returned all async work will have completed
+    ss::future<> stop();
+
+    /// Run the actual produce and fetch benchmarks
+    ///
+    /// Produces to the partitions of the configured topic that are led by this
+    /// node, then fetches the produced data back (unless marked as skip in the
+    /// configuration options).
+    ss::future<std::vector<self_test_result>> run(kafkacheck_opts);
+
+    /// Signal to stop all work as soon as possible
+    ///
+    /// Immediately returns, waiter can expect to wait on the results to be
+    /// returned by \run to be available shortly
+    void cancel();
+
+private:
+    /// A partition of the topic led by this node
+    struct target {
+        model::ntp ntp;
+        ss::shard_id shard;
+        /// First offset written by the benchmark
+        model::offset start;
+    };
+
+    /// Latency of the stages of a single produce request
+    struct produce_stages {
+        std::chrono::microseconds enqueue{0};
+        std::chrono::microseconds replicate{0};
+    };
+
+    /// Latency and size of a single fetch request
+    struct fetch_result {
+        std::chrono::microseconds latency{0};
+        size_t bytes{0};
+        /// Offset the next fetch of the fiber should start at
+        model::offset next;
+    };
+
+    ss::future<std::vector<target>> find_targets();
+
+    ss::future<std::vector<self_test_result>>
+    run_configured_benchmarks(std::vector<target>);
+
+    ss::future<> run_produce_fiber(
+      ss::lowres_clock::time_point stop,
+      const target&,
+      metrics& enqueue,
+      metrics& replicate);
+
+    ss::future<> run_fetch_fiber(
+      ss::lowres_clock::time_point stop, const target&, metrics& fetch);
+
+    /// Run on the shard of the partition, like the kafka handlers do
+    static ss::future<produce_stages>
+      produce_once(partition_manager&, model::ntp, kafkacheck_opts);
+    static ss::future<fetch_result>
+      fetch_once(partition_manager&, model::ntp, model::offset);
+
+    self_test_result make_result(const metrics&, ss::sstring info) const;
+
+private:
+    ss::sharded<partition_manager>& _pm;
+
+    bool _cancelled{false};
+    /// For shutting down service
+    ss::abort_source _as;
+    ss::gate _gate;
+    kafkacheck_opts _opts;
+};
+
+} // namespace cluster::self_test
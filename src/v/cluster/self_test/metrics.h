@@ -55,6 +55,13 @@ public:
         }
     }
 
+    /// Record a latency that was measured elsewhere, e.g. on another shard
+    void record(std::chrono::microseconds latency, size_t bytes) {
+        _hist.record(latency.count());
+        _bytes_operated += bytes;
+        _num_requests++;
+    }
+
     void set_start_end_time(
       ss::lowres_system_clock::time_point start,
       ss::lowres_system_clock::time_point end) {
@@ -10,6 +10,7 @@
 #define BOOST_TEST_MODULE self_test
 
 #include "cluster/self_test/diskcheck.h"
+#include "cluster/self_test/kafkacheck.h"
 #include "cluster/self_test/netcheck.h"
 #include "json/document.h"
 
@@ -93,6 +94,40 @@ BOOST_AUTO_TEST_CASE(test_netcheck_validation) {
       .parallelism = 25}));
 }
 
+BOOST_AUTO_TEST_CASE(test_kafkacheck_validation) {
+    namespace cft = cluster::self_test;
+    const model::topic topic("self-test");
+
+    BOOST_CHECK_THROW(
+      cft::kafkacheck::validate_options(cluster::kafkacheck_opts{}),
+      cft::kafkacheck_option_out_of_range);
+
+    BOOST_CHECK_THROW(
+      cft::kafkacheck::validate_options(
+        cluster::kafkacheck_opts{.topic = topic, .duration = 100ms}),
+      cft::kafkacheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::kafkacheck::validate_options(
+        cluster::kafkacheck_opts{.topic = topic, .parallelism = 0}),
+      cft::kafkacheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::kafkacheck::validate_options(
+        cluster::kafkacheck_opts{.topic = topic, .record_size = 0}),
+      cft::kafkacheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::kafkacheck::validate_options(cluster::kafkacheck_opts{
+        .topic = topic, .record_size = 1 << 20, .records_per_batch = 2}),
+      cft::kafkacheck_option_out_of_range);
+
+    BOOST_CHECK_NO_THROW(
+      cft::kafkacheck::validate_options(cluster::kafkacheck_opts{
+        .topic = topic,
+        .duration = 5000ms,
+        .parallelism = 4,
+        .record_size = 512,
+        .records_per_batch = 100}));
+}
+
 static const std::string sample_self_test_config = R"(
 {
     "tests": [
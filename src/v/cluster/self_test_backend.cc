@@ -29,17 +29,20 @@ self_test_backend::self_test_backend(
   ss::sharded<node::local_monitor>& nlm,
   ss::sharded<rpc::connection_cache>& connections,
   ss::sharded<cloud_storage::remote>& cloud_storage_api,
+  ss::sharded<partition_manager>& pm,
   ss::scheduling_group sg)
   : _self(self)
   , _st_sg(sg)
   , _disk_test(nlm)
   , _network_test(self, connections)
-  , _cloud_test(cloud_storage_api) {}
+  , _cloud_test(cloud_storage_api)
+  , _kafka_test(pm) {}
 
 ss::future<> self_test_backend::start() {
     co_await _disk_test.start();
     co_await _network_test.start();
     co_await _cloud_test.start();
+    co_await _kafka_test.start();
 }
 
 ss::future<> self_test_backend::stop() {
@@ -47,6 +50,7 @@ ss::future<> self_test_backend::stop() {
     co_await _disk_test.stop();
     co_await _network_test.stop();
     co_await _cloud_test.stop();
+    co_await _kafka_test.stop();
     co_await _lock.get_units(); /// Ensure outstanding work is completed
     co_await std::move(f);
 }
@@ -54,7 +58,8 @@ ss::future<> self_test_backend::stop() {
 ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
   std::vector<diskcheck_opts> dtos,
   std::vector<netcheck_opts> ntos,
-  std::vector<cloudcheck_opts> ctos) {
+  std::vector<cloudcheck_opts> ctos,
+  std::vector<kafkacheck_opts> ktos) {
     auto gate_holder = _gate.hold();
     std::vector<self_test_result> results;
 
@@ -150,6 +155,34 @@ ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
         }
     }
 
+    _stage = self_test_stage::kafka;
+    for (auto& kto : ktos) {
+        try {
+            kto.sg = _st_sg;
+            if (!_cancelling) {
+                auto ktr = co_await _kafka_test.run(kto);
+                results.insert(
+                  results.end(),
+                  std::make_move_iterator(ktr.begin()),
+                  std::make_move_iterator(ktr.end()));
+            } else {
+                results.push_back(self_test_result{
+                  .name = kto.name,
+                  .test_type = "kafka",
+                  .warning = "Kafka self test prevented from starting due to "
+                             "cancel signal"});
+            }
+        } catch (const std::exception& ex) {
+            vlog(
+              clusterlog.error,
+              "Kafka self test finished with error: {} - options: {}",
+              ex.what(),
+              kto);
+            results.push_back(self_test_result{
+              .name = kto.name, .test_type = "kafka", .error = ex.what()});
+        }
+    }
+
     co_return results;
 }
 
@@ -165,7 +198,8 @@ get_status_response self_test_backend::start_test(start_test_request req) {
                 return do_start_test(
                          std::move(req.dtos),
                          std::move(req.ntos),
-                         std::move(req.ctos))
+                         std::move(req.ctos),
+                         std::move(req.ktos))
                   .then([this, id = req.id](auto results) {
                       for (auto& r : results) {
                           r.test_id = id;
@@ -195,6 +229,7 @@ ss::future<get_status_response> self_test_backend::stop_test() {
     _disk_test.cancel();
     _network_test.cancel();
     _cloud_test.cancel();
+    _kafka_test.cancel();
     try {
         /// When lock is released, the 'then' block above will set the _prev_run
         /// var with the finalized test results from the cancelled run.
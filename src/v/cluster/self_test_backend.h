@@ -15,6 +15,7 @@
 #include "rpc/connection_cache.h"
 #include "self_test/cloudcheck.h"
 #include "self_test/diskcheck.h"
+#include "self_test/kafkacheck.h"
 #include "self_test/netcheck.h"
 #include "self_test_rpc_types.h"
 #include "utils/mutex.h"
@@ -41,6 +42,7 @@ public:
       ss::sharded<node::local_monitor>& nlm,
       ss::sharded<rpc::connection_cache>& connections,
       ss::sharded<cloud_storage::remote>& cloud_storage_api,
+      ss::sharded<partition_manager>& pm,
       ss::scheduling_group sg);
 
     ss::future<> start();
@@ -79,7 +81,8 @@ private:
     ss::future<std::vector<self_test_result>> do_start_test(
       std::vector<diskcheck_opts> dtos,
       std::vector<netcheck_opts> ntos,
-      std::vector<cloudcheck_opts> ctos);
+      std::vector<cloudcheck_opts> ctos,
+      std::vector<kafkacheck_opts> ktos);
 
     struct previous_netcheck_entity {
         static const inline model::node_id unassigned{-1};
@@ -103,5 +106,6 @@ private:
     self_test::diskcheck _disk_test;
     self_test::netcheck _network_test;
     self_test::cloudcheck _cloud_test;
+    self_test::kafkacheck _kafka_test;
 };
 } // namespace cluster
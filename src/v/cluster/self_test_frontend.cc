@@ -140,7 +140,9 @@ ss::future<uuid_t> self_test_frontend::start_test(
     if (ids.empty()) {
         throw self_test_exception("No node ids provided");
     }
-    if (req.dtos.empty() && req.ntos.empty() && req.ctos.empty()) {
+    if (
+      req.dtos.empty() && req.ntos.empty() && req.ctos.empty()
+      && req.ktos.empty()) {
         throw self_test_exception("No tests specified to run");
     }
     /// Validate input
@@ -195,7 +197,8 @@ ss::future<uuid_t> self_test_frontend::start_test(
             .id = test_id,
             .dtos = std::move(req.dtos),
             .ntos = std::move(new_ntos),
-            .ctos = std::move(req.ctos)});
+            .ctos = std::move(req.ctos),
+            .ktos = std::move(req.ktos)});
       });
     co_return test_id;
 }
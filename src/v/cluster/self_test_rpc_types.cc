@@ -46,6 +46,8 @@ ss::sstring self_test_stage_as_string(self_test_stage sts) {
         return "net";
     case self_test_stage::cloud:
         return "cloud";
+    case self_test_stage::kafka:
+        return "kafka";
     }
 }
 
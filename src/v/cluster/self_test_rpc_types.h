@@ -18,6 +18,7 @@
 #include "serde/rw/enum.h"
 #include "serde/rw/envelope.h"
 #include "serde/rw/iobuf.h"
+#include "serde/rw/named_type.h"
 #include "serde/rw/optional.h"
 #include "serde/rw/scalar.h"
 #include "serde/rw/sstring.h"
@@ -36,7 +37,7 @@ ss::sstring self_test_status_as_string(self_test_status sts);
 
 std::ostream& operator<<(std::ostream& o, self_test_status sts);
 
-enum class self_test_stage : int8_t { idle = 0, disk, net, cloud };
+enum class self_test_stage : int8_t { idle = 0, disk, net, cloud, kafka };
 
 ss::sstring self_test_stage_as_string(self_test_stage sts);
 
@@ -239,6 +240,92 @@ struct cloudcheck_opts
     }
 };
 
+struct kafkacheck_opts
+  : serde::
+      envelope<kafkacheck_opts, serde::version<0>, serde::compat_version<0>> {
+    /// Descriptive name given to test run
+    ss::sstring name{"unspecified"};
+    /// Existing topic that the benchmark will produce to and fetch from.
+    /// Only the partitions led by the node running the test are used.
+    model::topic topic;
+    /// Total duration of each of the produce and fetch runs
+    ss::lowres_clock::duration duration{std::chrono::milliseconds(5000)};
+    /// Amount of fibers producing or fetching concurrently
+    uint16_t parallelism{10};
+    /// Size of the value of each record
+    size_t record_size{1024};
+    /// Amount of records in each produced batch
+    uint16_t records_per_batch{16};
+    /// Wait for the majority of replicas (acks=all) or only for the leader
+    bool acks_all{true};
+    /// Set to true to disable the fetch portion of the benchmark
+    bool skip_read{false};
+    /// Scheduling group that the benchmark will operate under
+    ss::scheduling_group sg;
+
+    size_t batch_size() const { return record_size * records_per_batch; }
+
+    static kafkacheck_opts from_json(const json::Value& obj) {
+        /// The application using these parameters will perform any validation
+        kafkacheck_opts opts;
+        if (obj.HasMember("name")) {
+            opts.name = obj["name"].GetString();
+        }
+        if (obj.HasMember("topic")) {
+            opts.topic = model::topic(obj["topic"].GetString());
+        }
+        if (obj.HasMember("duration_ms")) {
+            opts.duration = std::chrono::milliseconds(
+              obj["duration_ms"].GetInt());
+        }
+        if (obj.HasMember("parallelism")) {
+            opts.parallelism = obj["parallelism"].GetUint();
+        }
+        if (obj.HasMember("record_size")) {
+            opts.record_size = obj["record_size"].GetUint64();
+        }
+        if (obj.HasMember("records_per_batch")) {
+            opts.records_per_batch = obj["records_per_batch"].GetUint();
+        }
+        if (obj.HasMember("acks_all")) {
+            opts.acks_all = obj["acks_all"].GetBool();
+        }
+        if (obj.HasMember("skip_read")) {
+            opts.skip_read = obj["skip_read"].GetBool();
+        }
+        return opts;
+    }
+
+    auto serde_fields() {
+        return std::tie(
+          name,
+          topic,
+          duration,
+          parallelism,
+          record_size,
+          records_per_batch,
+          acks_all,
+          skip_read);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const kafkacheck_opts& opts) {
+        fmt::print(
+          o,
+          "{{name: {} topic: {} duration: {} parallelism: {} record_size: {} "
+          "records_per_batch: {} acks_all: {} skip_read: {}}}",
+          opts.name,
+          opts.topic,
+          opts.duration,
+          opts.parallelism,
+          opts.record_size,
+          opts.records_per_batch,
+          opts.acks_all,
+          opts.skip_read);
+        return o;
+    }
+};
+
 struct self_test_result
   : serde::
       envelope<self_test_result, serde::version<1>, serde::compat_version<0>> {
@@ -321,7 +408,7 @@ struct empty_request
 struct start_test_request
   : serde::envelope<
       start_test_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
@@ -329,6 +416,7 @@ struct start_test_request
     std::vector<diskcheck_opts> dtos;
     std::vector<netcheck_opts> ntos;
     std::vector<cloudcheck_opts> ctos;
+    std::vector<kafkacheck_opts> ktos;
 
     friend std::ostream&
     operator<<(std::ostream& o, const start_test_request& r) {
@@ -342,6 +430,9 @@ struct start_test_request
         for (const auto& v : r.ctos) {
             fmt::print(ss, "cloudcheck_opts: {}", v);
         }
+        for (const auto& v : r.ktos) {
+            fmt::print(ss, "kafkacheck_opts: {}", v);
+        }
         fmt::print(o, "{{id: {} {}}}", r.id, ss.str());
         return o;
     }
@@ -42,6 +42,17 @@
 #include <seastar/coroutine/switch_to.hh>
 
 namespace cluster {
+
+namespace {
+size_t partition_count(const node_health_report& report) {
+    size_t count = 0;
+    for (const auto& topic : report.topics) {
+        count += topic.partitions.size();
+    }
+    return count;
+}
+} // namespace
+
 service::service(
   ss::scheduling_group sg,
   ss::smp_service_group ssg,
@@ -514,16 +525,30 @@ ss::future<get_cluster_health_reply> service::get_cluster_health_report(
 }
 
 ss::future<get_node_health_reply>
-service::do_collect_node_health_report(get_node_health_request) {
-    auto res = co_await _hm_frontend.local().get_current_node_health();
+service::do_collect_node_health_report(get_node_health_request req) {
+    auto res = co_await _hm_frontend.local().get_current_node_health_update(
+      req.base_report_id());
     if (res.has_error()) {
         co_return get_node_health_reply{
           .error = map_health_monitor_error_code(res.error())};
     }
-    co_return get_node_health_reply{
+    auto& update = res.value();
+    get_node_health_reply reply{
       .error = errc::success,
-      .report = std::move(res.value()),
+      .report = std::move(update.report),
+      .report_id = update.id,
+      .base_report_id = update.base,
+      .removed_partitions = std::move(update.removed),
     };
+    if (
+      req.accepts_compressed_report() && reply.report
+      && partition_count(*reply.report)
+           >= compressed_health_report_min_partitions) {
+        reply.compressed_report = co_await compress_node_health_report(
+          std::move(*reply.report));
+        reply.report.reset();
+    }
+    co_return reply;
 }
 
 ss::future<get_cluster_health_reply>
@@ -13,11 +13,16 @@
 
 #include "cluster/cluster_utils.h"
 #include "cluster/logger.h"
+#include "cluster/partition_manager.h"
 #include "config/node_config.h"
 #include "random/generators.h"
 #include "ssx/async_algorithm.h"
 #include "types.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 namespace cluster {
 
 namespace {
@@ -48,8 +53,10 @@ shard_balancer::shard_balancer(
   ss::sharded<storage::api>& storage,
   ss::sharded<topic_table>& topics,
   ss::sharded<controller_backend>& cb,
+  ss::sharded<partition_manager>& pm,
   config::binding<bool> balancing_on_core_count_change,
   config::binding<bool> balancing_continuous,
+  config::binding<bool> balancing_throughput_aware,
   config::binding<std::chrono::milliseconds> debounce_timeout,
   config::binding<uint32_t> partitions_per_shard,
   config::binding<uint32_t> partitions_reserve_shard0)
@@ -58,14 +65,17 @@ shard_balancer::shard_balancer(
   , _storage(storage.local())
   , _topics(topics)
   , _controller_backend(cb)
+  , _partition_manager(pm)
   , _self(*config::node().node_id())
   , _balancing_on_core_count_change(std::move(balancing_on_core_count_change))
   , _balancing_continuous(std::move(balancing_continuous))
+  , _balancing_throughput_aware(std::move(balancing_throughput_aware))
   , _debounce_timeout(std::move(debounce_timeout))
   , _debounce_jitter(_debounce_timeout())
   , _partitions_per_shard(std::move(partitions_per_shard))
   , _partitions_reserve_shard0(std::move(partitions_reserve_shard0))
   , _balance_timer([this] { balance_timer_callback(); })
+  , _throughput_balance_timer([this] { throughput_balance_timer_callback(); })
   , _total_counts(ss::smp::count, 0) {
     _total_counts.at(0) += 1; // controller partition
 
@@ -203,6 +213,7 @@ ss::future<> shard_balancer::start(size_t kvstore_shard_count) {
       "topic_table unexpectedly changed");
 
     ssx::background = assign_fiber();
+    _throughput_balance_timer.arm(throughput_balance_interval);
 }
 
 ss::future<> shard_balancer::init_shard_placement(
@@ -294,6 +305,7 @@ ss::future<> shard_balancer::stop() {
 
     _topics.local().unregister_delta_notification(_topic_table_notify_handle);
     _balance_timer.cancel();
+    _throughput_balance_timer.cancel();
     _wakeup_event.set();
     return _gate.close();
 }
@@ -575,6 +587,140 @@ ss::future<> shard_balancer::do_balance(mutex::units& lock) {
       }));
 }
 
+void shard_balancer::throughput_balance_timer_callback() {
+    ssx::spawn_with_gate(_gate, [this] {
+        return _mtx.get_units()
+          .then([this](mutex::units lock) {
+              return ss::do_with(std::move(lock), [this](mutex::units& lock) {
+                  return do_balance_throughput(lock);
+              });
+          })
+          .handle_exception([](const std::exception_ptr& e) {
+              if (!ssx::is_shutdown_exception(e)) {
+                  vlog(
+                    clusterlog.warn, "failed to balance throughput: {}", e);
+              }
+          })
+          .finally([this] {
+              if (!_gate.is_closed()) {
+                  _throughput_balance_timer.arm(throughput_balance_interval);
+              }
+          });
+    });
+}
+
+ss::future<> shard_balancer::do_balance_throughput(mutex::units& lock) {
+    if (
+      !_balancing_throughput_aware()
+      || !_features.is_active(features::feature::node_local_core_assignment)) {
+        _last_ntp_bytes.clear();
+        co_return;
+    }
+
+    using ntp_bytes_t = chunked_vector<std::pair<model::ntp, uint64_t>>;
+    auto shard2bytes = co_await _partition_manager.map(
+      [](partition_manager& pm) {
+          ntp_bytes_t ret;
+          ret.reserve(pm.partitions().size());
+          for (const auto& [ntp, p] : pm.partitions()) {
+              ret.emplace_back(
+                ntp,
+                p->probe().get_bytes_produced()
+                  + p->probe().get_bytes_fetched());
+          }
+          return ret;
+      });
+
+    // Throughput of each partition since the previous tick, only known for
+    // partitions that stayed on the same shard.
+    const auto now = ss::lowres_clock::now();
+    const auto elapsed
+      = std::chrono::duration<double>(now - _last_ntp_bytes_at).count();
+    std::vector<double> shard2load(ss::smp::count, 0);
+    std::vector<chunked_vector<std::pair<model::ntp, double>>> shard2ntps(
+      ss::smp::count);
+    chunked_hash_map<model::ntp, ntp_bytes> current;
+    for (ss::shard_id shard = 0; shard < shard2bytes.size(); ++shard) {
+        co_await ssx::async_for_each(
+          shard2bytes[shard].begin(),
+          shard2bytes[shard].end(),
+          [&](const std::pair<model::ntp, uint64_t>& entry) {
+              const auto& [ntp, bytes] = entry;
+              auto it = _last_ntp_bytes.find(ntp);
+              if (
+                it != _last_ntp_bytes.end() && it->second.shard == shard
+                && it->second.bytes <= bytes && elapsed > 0) {
+                  const auto rate = static_cast<double>(
+                                      bytes - it->second.bytes)
+                                    / elapsed;
+                  shard2load[shard] += rate;
+                  shard2ntps[shard].emplace_back(ntp, rate);
+              }
+              current.emplace(
+                ntp, shard_balancer::ntp_bytes{.shard = shard, .bytes = bytes});
+          });
+    }
+    _last_ntp_bytes = std::move(current);
+    _last_ntp_bytes_at = now;
+
+    const auto [min_it, max_it] = std::minmax_element(
+      shard2load.begin(), shard2load.end());
+    const double total = std::accumulate(
+      shard2load.begin(), shard2load.end(), 0.0);
+    const double avg = total / static_cast<double>(ss::smp::count);
+    if (total <= 0 || *max_it <= avg * (1 + throughput_imbalance_threshold)) {
+        co_return;
+    }
+
+    // Moving a partition with throughput lower than the gap between the
+    // busiest and the idlest shards reduces the load of the busiest shard,
+    // the best candidate leaves both shards as close to each other as
+    // possible.
+    const auto from = static_cast<ss::shard_id>(max_it - shard2load.begin());
+    const auto to = static_cast<ss::shard_id>(min_it - shard2load.begin());
+    const double gap = *max_it - *min_it;
+    std::optional<model::ntp> best;
+    double best_distance = gap / 2;
+    for (const auto& [ntp, rate] : shard2ntps[from]) {
+        if (rate <= 0 || rate >= gap) {
+            continue;
+        }
+        const auto distance = std::abs(rate - gap / 2);
+        if (!best || distance < best_distance) {
+            best = ntp;
+            best_distance = distance;
+        }
+    }
+    if (!best) {
+        co_return;
+    }
+
+    auto prev_target = _shard_placement.get_target(*best);
+    if (!prev_target || prev_target->shard != from) {
+        co_return;
+    }
+    auto target = *prev_target;
+    target.shard = to;
+
+    vlog(
+      clusterlog.info,
+      "[{}] moving from shard {} ({:.0f} B/s) to shard {} ({:.0f} B/s) to "
+      "balance throughput",
+      *best,
+      from,
+      *max_it,
+      to,
+      *min_it);
+
+    update_counts(
+      *best,
+      _topic2data[model::topic_namespace_view{*best}],
+      prev_target,
+      target);
+    _last_ntp_bytes.erase(*best);
+    co_await set_target(*best, target, lock);
+}
+
 ss::future<> shard_balancer::set_target(
   const model::ntp& ntp,
   const std::optional<shard_placement_target>& target,
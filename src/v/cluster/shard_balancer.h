@@ -34,14 +34,23 @@ public:
     // single instance
     static constexpr ss::shard_id shard_id = 0;
 
+    /// Interval between evaluations of throughput balance across shards. At
+    /// most one partition is moved per interval.
+    static constexpr std::chrono::minutes throughput_balance_interval{5};
+    /// A partition is moved away from the busiest shard only if its
+    /// throughput exceeds the average by more than this fraction.
+    static constexpr double throughput_imbalance_threshold = 0.2;
+
     shard_balancer(
       ss::sharded<shard_placement_table>&,
       ss::sharded<features::feature_table>&,
       ss::sharded<storage::api>&,
       ss::sharded<topic_table>&,
       ss::sharded<controller_backend>&,
+      ss::sharded<partition_manager>&,
       config::binding<bool> balancing_on_core_count_change,
       config::binding<bool> balancing_continuous,
+      config::binding<bool> balancing_throughput_aware,
       config::binding<std::chrono::milliseconds> debounce_timeout,
       config::binding<uint32_t> partitions_per_shard,
       config::binding<uint32_t> partitions_reserve_shard0);
@@ -78,6 +87,8 @@ private:
       mutex::units& lock, size_t kvstore_shard_count);
     void balance_timer_callback();
     ss::future<> do_balance(mutex::units& lock);
+    void throughput_balance_timer_callback();
+    ss::future<> do_balance_throughput(mutex::units& lock);
 
     void maybe_assign(
       const model::ntp&,
@@ -115,10 +126,12 @@ private:
     storage::api& _storage;
     ss::sharded<topic_table>& _topics;
     ss::sharded<controller_backend>& _controller_backend;
+    ss::sharded<partition_manager>& _partition_manager;
     model::node_id _self;
 
     config::binding<bool> _balancing_on_core_count_change;
     config::binding<bool> _balancing_continuous;
+    config::binding<bool> _balancing_throughput_aware;
     config::binding<std::chrono::milliseconds> _debounce_timeout;
     simple_time_jitter<ss::lowres_clock> _debounce_jitter;
     config::binding<uint32_t> _partitions_per_shard;
@@ -126,6 +139,7 @@ private:
 
     cluster::notification_id_type _topic_table_notify_handle;
     ss::timer<ss::lowres_clock> _balance_timer;
+    ss::timer<ss::lowres_clock> _throughput_balance_timer;
     ssx::event _wakeup_event{"shard_balancer"};
     mutex _mtx{"shard_balancer"};
     ss::gate _gate;
@@ -139,6 +153,15 @@ private:
       model::topic_namespace_eq>
       _topic2data;
     shard2count_t _total_counts;
+
+    // Bytes produced and fetched by each local partition as of the previous
+    // throughput balancing tick.
+    struct ntp_bytes {
+        ss::shard_id shard;
+        uint64_t bytes;
+    };
+    chunked_hash_map<model::ntp, ntp_bytes> _last_ntp_bytes;
+    ss::lowres_clock::time_point _last_ntp_bytes_at;
 };
 
 } // namespace cluster
@@ -0,0 +1,136 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/aborted_tx_index.h"
+#include "random/generators.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <algorithm>
+
+namespace {
+
+model::tx_range make_range(int64_t first, int64_t last) {
+    return {
+      model::producer_identity{first, 0},
+      model::offset{first},
+      model::offset{last}};
+}
+
+// transactions of random lengths in the order they are aborted, which isn't
+// the order they started in
+fragmented_vector<model::tx_range> random_aborted(size_t n) {
+    fragmented_vector<model::tx_range> ranges;
+    int64_t offset = 0;
+    for (size_t i = 0; i < n; ++i) {
+        offset += random_generators::get_int(1, 10);
+        auto length = random_generators::get_int<int64_t>(0, 50);
+        if (random_generators::get_int(100) == 0) {
+            // an occasional long transaction
+            length = random_generators::get_int<int64_t>(1000);
+        }
+        ranges.push_back(make_range(offset, offset + length));
+    }
+    std::shuffle(
+      ranges.begin(), ranges.end(), random_generators::internal::gen);
+    return ranges;
+}
+
+fragmented_vector<model::tx_range>
+sorted(fragmented_vector<model::tx_range> v) {
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+fragmented_vector<model::tx_range> expected_intersecting(
+  const fragmented_vector<model::tx_range>& ranges,
+  model::offset from,
+  model::offset to) {
+    fragmented_vector<model::tx_range> result;
+    for (const auto& r : ranges) {
+        if (r.last >= from && r.first <= to) {
+            result.push_back(r);
+        }
+    }
+    return sorted(std::move(result));
+}
+
+void check_lookups(
+  const cluster::tx::aborted_tx_index& index,
+  const fragmented_vector<model::tx_range>& ranges) {
+    for (int i = 0; i < 200; ++i) {
+        model::offset from{random_generators::get_int<int64_t>(-10, 6000)};
+        model::offset to{
+          from() + random_generators::get_int<int64_t>(0, 100)};
+        fragmented_vector<model::tx_range> result;
+        index.collect_intersecting(result, from, to);
+        BOOST_REQUIRE(
+          sorted(std::move(result)) == expected_intersecting(ranges, from, to));
+    }
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(aborted_tx_index_lookup_test) {
+    auto ranges = random_aborted(1000);
+    cluster::tx::aborted_tx_index index;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        index.push_back(ranges[i]);
+        if (i % 97 == 0) {
+            fragmented_vector<model::tx_range> added;
+            for (size_t j = 0; j <= i; ++j) {
+                added.push_back(ranges[j]);
+            }
+            check_lookups(index, added);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(index.size(), ranges.size());
+    check_lookups(index, ranges);
+    BOOST_REQUIRE(sorted(index.copy()) == sorted(ranges.copy()));
+
+    cluster::tx::aborted_tx_index loaded(ranges.copy());
+    check_lookups(loaded, ranges);
+}
+
+SEASTAR_THREAD_TEST_CASE(aborted_tx_index_remove_test) {
+    auto ranges = random_aborted(500);
+    cluster::tx::aborted_tx_index index;
+    for (const auto& r : ranges) {
+        index.push_back(r);
+    }
+    model::offset start{1000};
+    index.remove_ending_before(start);
+    fragmented_vector<model::tx_range> remaining;
+    std::copy_if(
+      ranges.begin(),
+      ranges.end(),
+      std::back_inserter(remaining),
+      [start](const model::tx_range& r) { return r.last >= start; });
+    BOOST_REQUIRE_EQUAL(index.size(), remaining.size());
+    check_lookups(index, remaining);
+
+    auto released = std::move(index).release();
+    BOOST_REQUIRE(std::is_sorted(
+      released.begin(),
+      released.end(),
+      [](const model::tx_range& a, const model::tx_range& b) {
+          return a.first < b.first;
+      }));
+    BOOST_REQUIRE(sorted(std::move(released)) == sorted(std::move(remaining)));
+}
+
+SEASTAR_THREAD_TEST_CASE(aborted_tx_index_empty_test) {
+    cluster::tx::aborted_tx_index index;
+    fragmented_vector<model::tx_range> result;
+    index.collect_intersecting(result, model::offset{0}, model::offset::max());
+    BOOST_REQUIRE(result.empty());
+    BOOST_REQUIRE(index.empty());
+}
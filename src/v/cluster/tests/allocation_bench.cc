@@ -90,3 +90,20 @@ PERF_TEST_F(partition_allocator_fixture, recovery) {
       cluster::partition_allocation_domains::common);
     perf_tests::stop_measuring_time();
 }
+PERF_TEST_F(partition_allocator_fixture, allocation_10k_partitions) {
+    static bool initialized = false;
+    if (!initialized) {
+        register_node(0, 24);
+        register_node(1, 24);
+        register_node(2, 24);
+        initialized = true;
+    }
+
+    auto req = make_allocation_request(10'000, 3);
+
+    perf_tests::start_measuring_time();
+    return allocator().allocate(std::move(req)).then([](auto vals) {
+        perf_tests::do_not_optimize(vals);
+        perf_tests::stop_measuring_time();
+    });
+}
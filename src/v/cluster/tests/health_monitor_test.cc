@@ -18,6 +18,7 @@
 #include "model/metadata.h"
 #include "model/namespace.h"
 #include "model/timeout_clock.h"
+#include "serde/rw/rw.h"
 #include "test_utils/fixture.h"
 
 #include <seastar/core/shared_ptr.hh>
@@ -571,3 +572,96 @@ FIXTURE_TEST(
     BOOST_REQUIRE(
       std::get<0>(results).get().value() == std::get<1>(results).get().value());
 }
+
+namespace {
+cluster::partition_status
+make_partition_status(model::partition_id id, size_t size_bytes) {
+    return cluster::partition_status{
+      .id = id,
+      .term = model::term_id(1),
+      .leader_id = model::node_id(0),
+      .revision_id = model::revision_id(1),
+      .size_bytes = size_bytes,
+    };
+}
+
+cluster::topic_status make_topic_status(
+  std::string_view topic,
+  std::vector<std::pair<model::partition_id, size_t>> partitions) {
+    cluster::partition_statuses_t statuses;
+    for (auto [id, size] : partitions) {
+        statuses.push_back(make_partition_status(id, size));
+    }
+    return {
+      model::topic_namespace(model::kafka_namespace, model::topic(topic)),
+      std::move(statuses)};
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_topics_delta_round_trip) {
+    using model::partition_id;
+    chunked_vector<cluster::topic_status> base;
+    base.push_back(make_topic_status(
+      "t1",
+      {{partition_id(0), 10},
+       {partition_id(1), 10},
+       {partition_id(2), 10}}));
+    base.push_back(make_topic_status("t2", {{partition_id(0), 10}}));
+
+    chunked_vector<cluster::topic_status> current;
+    current.push_back(make_topic_status(
+      "t1",
+      {{partition_id(0), 10},
+       {partition_id(1), 20},
+       {partition_id(3), 10}}));
+    current.push_back(make_topic_status("t3", {{partition_id(0), 10}}));
+
+    auto delta = current.copy();
+    auto removed = cluster::make_topics_delta(base, delta).get();
+
+    // only the changed, created and removed partitions are part of the delta
+    BOOST_REQUIRE_EQUAL(delta.size(), 2);
+    BOOST_REQUIRE_EQUAL(delta[0].tp_ns.tp, model::topic("t1"));
+    BOOST_REQUIRE_EQUAL(delta[0].partitions.size(), 2);
+    BOOST_REQUIRE_EQUAL(delta[1].tp_ns.tp, model::topic("t3"));
+    BOOST_REQUIRE_EQUAL(removed.size(), 2);
+    size_t removed_partitions = 0;
+    for (const auto& r : removed) {
+        removed_partitions += r.partitions.size();
+    }
+    BOOST_REQUIRE_EQUAL(removed_partitions, 2);
+
+    auto applied
+      = cluster::apply_topics_delta(base, std::move(delta), removed).get();
+    BOOST_REQUIRE(applied == current);
+
+    // nothing changed
+    auto unchanged = current.copy();
+    removed = cluster::make_topics_delta(current, unchanged).get();
+    BOOST_REQUIRE(unchanged.empty());
+    BOOST_REQUIRE(removed.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_compressed_report_round_trip) {
+    using model::partition_id;
+    cluster::node_health_report report;
+    report.id = model::node_id(1);
+    for (int t = 0; t < 10; ++t) {
+        std::vector<std::pair<partition_id, size_t>> partitions;
+        for (int p = 0; p < 100; ++p) {
+            partitions.emplace_back(partition_id(p), 10);
+        }
+        report.topics.push_back(
+          make_topic_status(fmt::format("topic-{}", t), partitions));
+    }
+
+    auto uncompressed_size
+      = serde::to_iobuf(cluster::node_health_report(report)).size_bytes();
+    auto compressed = cluster::compress_node_health_report(
+                        cluster::node_health_report(report))
+                        .get();
+    BOOST_REQUIRE_LT(compressed.size_bytes(), uncompressed_size);
+    auto decompressed
+      = cluster::decompress_node_health_report(std::move(compressed)).get();
+    BOOST_REQUIRE(decompressed == report);
+}
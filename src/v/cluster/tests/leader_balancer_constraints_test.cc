@@ -516,3 +516,49 @@ BOOST_AUTO_TEST_CASE(topic_skew_error) {
     BOOST_REQUIRE(post_topic_error <= pre_topic_error);
     BOOST_REQUIRE(post_shard_error <= pre_shard_error);
 }
+
+BOOST_AUTO_TEST_CASE(even_shard_throughput_movement) {
+    // both shards lead two groups, but the groups led by node 0 carry almost
+    // all the traffic
+    auto [shard_index, muted_index] = from_spec({
+      {{1, 2}, {3, 4}},
+      {{3, 4}, {1, 2}},
+    });
+    lbt::group_load_t loads;
+    loads.emplace(raft::group_id{1}, 100);
+    loads.emplace(raft::group_id{2}, 100);
+    loads.emplace(raft::group_id{3}, 1);
+    loads.emplace(raft::group_id{4}, 1);
+
+    auto estc = lbt::even_shard_throughput_constraint(
+      loads, shard_index, muted_index);
+    BOOST_REQUIRE_GT(estc.error(), 0);
+
+    auto movement = estc.recommended_reassignment();
+    BOOST_REQUIRE(movement);
+    check_valid(shard_index.shards(), *movement);
+    BOOST_REQUIRE_EQUAL(movement->from.node_id, model::node_id{0});
+
+    estc.update_index(*movement);
+    shard_index.update_index(*movement);
+    BOOST_REQUIRE_EQUAL(estc.error(), 0);
+    BOOST_REQUIRE(!estc.recommended_reassignment());
+}
+
+BOOST_AUTO_TEST_CASE(even_shard_throughput_tolerance) {
+    // a small imbalance in throughput stays within the tolerance band
+    auto [shard_index, muted_index] = from_spec({
+      {{1, 2}, {3, 4}},
+      {{3, 4}, {1, 2}},
+    });
+    lbt::group_load_t loads;
+    loads.emplace(raft::group_id{1}, 105);
+    loads.emplace(raft::group_id{2}, 100);
+    loads.emplace(raft::group_id{3}, 100);
+    loads.emplace(raft::group_id{4}, 100);
+
+    auto estc = lbt::even_shard_throughput_constraint(
+      loads, shard_index, muted_index);
+    BOOST_REQUIRE_EQUAL(estc.error(), 0);
+    BOOST_REQUIRE(!estc.recommended_reassignment());
+}
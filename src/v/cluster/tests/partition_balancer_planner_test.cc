@@ -832,6 +832,35 @@ FIXTURE_TEST(
     BOOST_REQUIRE_EQUAL(plan_data.failed_actions_count, 0);
 }
 
+/*
+ * 4 nodes; 2 topics, one of them in tiered storage; 1 decommissioning node
+ * The planner should first move the partitions that are in tiered storage.
+ */
+FIXTURE_TEST(
+  test_decommission_tiered_first, partition_balancer_planner_fixture) {
+    allocator_register_nodes(3);
+    create_topic("topic-local", 2, 3);
+    auto tiered = workers.make_tp_configuration("topic-tiered", 2, 3);
+    tiered.cfg.properties.shadow_indexing = model::shadow_indexing_mode::full;
+    workers.dispatch_topic_command(
+      cluster::create_topic_cmd{make_tp_ns("topic-tiered"), std::move(tiered)});
+    allocator_register_nodes(1);
+
+    auto hr = create_health_report();
+    populate_node_status_table().get();
+
+    set_decommissioning(model::node_id{0});
+
+    auto planner = make_planner(
+      model::partition_autobalancing_mode::continuous, 2);
+    auto plan_data = planner.plan_actions(hr, as).get();
+
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 2);
+    for (const auto& r : plan_data.reassignments) {
+        BOOST_REQUIRE_EQUAL(r.ntp.tp.topic, model::topic("topic-tiered"));
+    }
+}
+
 FIXTURE_TEST(
   test_state_ntps_with_broken_rack_constraint,
   partition_balancer_planner_fixture) {
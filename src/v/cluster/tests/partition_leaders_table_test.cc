@@ -238,4 +238,55 @@ TEST_F_CORO(test_fixture, test_leadership_notification) {
     EXPECT_EQ(notifies[p_1], 1);
     EXPECT_EQ(notifies[p_2], 0);
 }
+
+TEST_F_CORO(test_fixture, test_topic_leadership_version) {
+    model::topic tp_a("topic_a");
+    model::topic tp_b("topic_b");
+    co_await add_topic(tp_a, 2);
+    co_await add_topic(tp_b, 1);
+    model::topic_namespace_view a(model::kafka_namespace, tp_a);
+    model::topic_namespace_view b(model::kafka_namespace, tp_b);
+    model::ntp a_0(model::kafka_namespace, tp_a, model::partition_id(0));
+    model::ntp a_1(model::kafka_namespace, tp_a, model::partition_id(1));
+    model::ntp b_0(model::kafka_namespace, tp_b, model::partition_id(0));
+    using version = partition_leaders_table::version;
+
+    // topics without known leaders
+    EXPECT_EQ(leaders.topic_leadership_version(a), version{0});
+    EXPECT_EQ(leaders.topic_leadership_version(b), version{0});
+
+    leaders.update_partition_leader(a_0, model::term_id{1}, model::node_id(1));
+    auto a_version = leaders.topic_leadership_version(a);
+    EXPECT_NE(a_version, version{0});
+    EXPECT_EQ(leaders.topic_leadership_version(b), version{0});
+
+    // the same leadership again doesn't change the version
+    leaders.update_partition_leader(a_0, model::term_id{1}, model::node_id(1));
+    EXPECT_EQ(leaders.topic_leadership_version(a), a_version);
+
+    // changes of other topics don't either
+    leaders.update_partition_leader(b_0, model::term_id{1}, model::node_id(1));
+    EXPECT_EQ(leaders.topic_leadership_version(a), a_version);
+    auto b_version = leaders.topic_leadership_version(b);
+    EXPECT_NE(b_version, version{0});
+
+    // a new leader, a new term, a new partition or one losing its leader
+    // does
+    auto expect_changed = [&] {
+        EXPECT_NE(leaders.topic_leadership_version(a), a_version);
+        a_version = leaders.topic_leadership_version(a);
+    };
+    leaders.update_partition_leader(a_0, model::term_id{2}, model::node_id(2));
+    expect_changed();
+    leaders.update_partition_leader(a_0, model::term_id{3}, model::node_id(2));
+    expect_changed();
+    leaders.update_partition_leader(a_1, model::term_id{1}, model::node_id(1));
+    expect_changed();
+    leaders.update_partition_leader(a_1, model::term_id{2}, std::nullopt);
+    expect_changed();
+
+    leaders.remove_leader(a_1, model::revision_id{0});
+    EXPECT_NE(leaders.topic_leadership_version(a), a_version);
+    EXPECT_EQ(leaders.topic_leadership_version(b), b_version);
+}
 } // namespace cluster
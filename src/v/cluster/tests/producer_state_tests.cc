@@ -202,6 +202,58 @@ FIXTURE_TEST(test_inflight_tx_producer_is_not_evicted, test_fixture) {
     BOOST_REQUIRE(producer->can_evict());
 }
 
+FIXTURE_TEST(test_finished_requests_window, test_fixture) {
+    create_producer_state_manager(1, 1);
+    auto producer = new_producer();
+    auto defer = ss::defer(
+      [&] { manager().deregister_producer(*producer, std::nullopt); });
+
+    auto make_batch = [&](int32_t seq) {
+        model::test::record_batch_spec spec{
+          .offset = model::offset{seq},
+          .count = 1,
+          .bt = model::record_batch_type::raft_data,
+          .enable_idempotence = true,
+          .producer_id = producer->id().id,
+          .producer_epoch = producer->id().epoch,
+          .base_sequence = seq};
+        return model::test::make_random_batch(spec);
+    };
+
+    constexpr int32_t num_requests = 8;
+    for (int32_t seq = 0; seq < num_requests; ++seq) {
+        auto batch = make_batch(seq);
+        auto bid = model::batch_identity::from(batch.header());
+        auto request = producer->try_emplace_request(bid, model::term_id{1});
+        BOOST_REQUIRE(!request.has_error());
+        BOOST_REQUIRE_EQUAL(
+          request.value()->state(), request_state::initialized);
+        producer->apply_data(batch.header(), kafka::offset{seq});
+    }
+
+    // only the last 5 requests are retained
+    auto snapshot = producer->snapshot(kafka::offset{0});
+    BOOST_REQUIRE_EQUAL(snapshot.finished_requests.size(), 5);
+    BOOST_REQUIRE_EQUAL(snapshot.finished_requests.front().first_sequence, 3);
+    BOOST_REQUIRE(producer->last_sequence_number() == num_requests - 1);
+
+    // a retry of a retained request gets its result
+    auto retried = make_batch(5);
+    auto request = producer->try_emplace_request(
+      model::batch_identity::from(retried.header()), model::term_id{1});
+    BOOST_REQUIRE(!request.has_error());
+    BOOST_REQUIRE_EQUAL(request.value()->state(), request_state::completed);
+    BOOST_REQUIRE_EQUAL(
+      request.value()->result().get().value().last_offset, kafka::offset{5});
+
+    // a retry of a request out of the window is out of order
+    auto old = make_batch(1);
+    request = producer->try_emplace_request(
+      model::batch_identity::from(old.header()), model::term_id{1});
+    BOOST_REQUIRE(request.has_error());
+    BOOST_REQUIRE(request.error() == cluster::errc::sequence_out_of_order);
+}
+
 FIXTURE_TEST(test_lru_maintenance, test_fixture) {
     create_producer_state_manager(10, 10);
     const size_t num_producers = 5;
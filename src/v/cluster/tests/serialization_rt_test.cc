@@ -1038,6 +1038,20 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         cluster::abort_tx_reply data{random_tx_errc()};
         roundtrip_test(data);
     }
+    {
+        cluster::end_tx_batch_request data{
+          model::control_record_type::tx_commit,
+          {model::random_ntp(), model::random_ntp()},
+          random_producer_identity(),
+          tests::random_named_int<model::tx_seq>(),
+          random_timeout_clock_duration()};
+
+        roundtrip_test(data);
+    }
+    {
+        cluster::end_tx_batch_reply data{{random_tx_errc(), random_tx_errc()}};
+        roundtrip_test(data);
+    }
     {
         cluster::begin_group_tx_request data{
           model::random_ntp(),
@@ -544,3 +544,29 @@ FIXTURE_TEST(test_topic_table_iterator_invalidation, topic_table_fixture) {
     add_random_topic(); // invalidates iterator
     BOOST_REQUIRE_THROW((void)it->first, iterator_stability_violation);
 }
+
+FIXTURE_TEST(test_deltas_since, topic_table_fixture) {
+    auto& t = table.local();
+    for (int64_t o = 1; o <= 3; ++o) {
+        auto cmd = make_create_topic_cmd(fmt::format("delta_tp_{}", o), 2, 1);
+        auto res = t.apply(std::move(cmd), model::offset(o)).get();
+        BOOST_REQUIRE_EQUAL(res, cluster::errc::success);
+    }
+
+    auto all = t.deltas_since(model::revision_id(0));
+    BOOST_REQUIRE(all.has_value());
+    BOOST_REQUIRE_EQUAL(all->size(), 6);
+
+    auto recent = t.deltas_since(model::revision_id(2));
+    BOOST_REQUIRE(recent.has_value());
+    BOOST_REQUIRE_EQUAL(recent->size(), 2);
+    for (const auto& d : *recent) {
+        BOOST_REQUIRE_EQUAL(d.revision, model::revision_id(3));
+        BOOST_REQUIRE_EQUAL(d.ntp.tp.topic, model::topic("delta_tp_3"));
+    }
+
+    auto none = t.deltas_since(model::revision_id(3));
+    BOOST_REQUIRE(none.has_value());
+    BOOST_REQUIRE(none->empty());
+    BOOST_REQUIRE_LE(t.delta_log_horizon(), model::revision_id(0));
+}
@@ -713,6 +713,10 @@ tm_stm::apply_tm_update(model::record_batch_header hdr, model::record_batch b) {
     return ss::now();
 }
 
+bool tm_stm::applies_to(model::record_batch_type type) const {
+    return type == model::record_batch_type::tm_update;
+}
+
 ss::future<> tm_stm::apply(const model::record_batch& b) {
     const auto& hdr = b.header();
 
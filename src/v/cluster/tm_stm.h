@@ -363,6 +363,7 @@ private:
     ss::future<raft::stm_snapshot> take_local_snapshot() override;
 
     ss::future<> apply(const model::record_batch& b) final;
+    bool applies_to(model::record_batch_type) const final;
 
     ss::future<>
     apply_tm_update(model::record_batch_header hdr, model::record_batch b);
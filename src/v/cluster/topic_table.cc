@@ -1381,7 +1381,13 @@ ss::future<> topic_table::apply_snapshot(
     }
 
     // 3. notify delta waiters
-    notify_waiters();
+    co_await notify_waiters_chunked();
+
+    // The deltas produced by a snapshot aren't ordered by revision, so they
+    // aren't kept: subscribers older than the snapshot have to rebuild their
+    // state from the table.
+    _delta_log.clear();
+    _delta_log_horizon = snap_revision;
 
     _last_applied_revision_id = snap_revision;
 }
@@ -1410,6 +1416,7 @@ void topic_table::notify_waiters() {
             cb.second(changes);
         }
     }
+    append_to_delta_log(_pending_deltas);
     _pending_deltas.clear();
 
     for (auto& cb : _lw_notifications) {
@@ -1417,6 +1424,51 @@ void topic_table::notify_waiters() {
     }
 }
 
+void topic_table::append_to_delta_log(const fragmented_vector<delta>& deltas) {
+    for (const auto& d : deltas) {
+        _delta_log.push_back(d);
+    }
+    while (_delta_log.size() > max_delta_log_size) {
+        _delta_log_horizon = _delta_log.front().revision;
+        _delta_log.pop_front();
+    }
+}
+
+std::optional<fragmented_vector<topic_table::delta>>
+topic_table::deltas_since(model::revision_id rev) const {
+    if (rev < _delta_log_horizon) {
+        return std::nullopt;
+    }
+    auto it = std::upper_bound(
+      _delta_log.begin(),
+      _delta_log.end(),
+      rev,
+      [](model::revision_id r, const delta& d) { return r < d.revision; });
+    fragmented_vector<delta> ret;
+    std::copy(it, _delta_log.end(), std::back_inserter(ret));
+    return ret;
+}
+
+ss::future<> topic_table::notify_waiters_chunked() {
+    constexpr size_t max_deltas_per_chunk = 1024;
+    // Other fibers may modify the table while we yield between chunks, so
+    // take ownership of the deltas before delivering them.
+    auto deltas = std::exchange(_pending_deltas, {});
+    for (size_t begin = 0; begin < deltas.size();
+         begin += max_deltas_per_chunk) {
+        const auto end = std::min(deltas.size(), begin + max_deltas_per_chunk);
+        delta_range_t changes{deltas.cbegin() + begin, deltas.cbegin() + end};
+        for (auto& cb : _notifications) {
+            cb.second(changes);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    for (auto& cb : _lw_notifications) {
+        cb.second();
+    }
+}
+
 std::vector<model::topic_namespace> topic_table::all_topics() const {
     std::vector<model::topic_namespace> topics;
     topics.reserve(topics.size());
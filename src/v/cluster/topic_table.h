@@ -23,6 +23,8 @@
 
 #include <absl/container/node_hash_map.h>
 
+#include <deque>
+#include <optional>
 #include <type_traits>
 
 namespace cluster {
@@ -524,6 +526,17 @@ public:
         return _last_applied_revision_id;
     }
 
+    /// Returns the deltas with a revision greater than the given one, in the
+    /// order they were applied. Only a bounded number of recent deltas is
+    /// kept: returns std::nullopt if some of the requested deltas are no
+    /// longer available, in which case the caller has to rebuild its state
+    /// from the table itself.
+    std::optional<fragmented_vector<delta>>
+      deltas_since(model::revision_id) const;
+
+    /// Revision at or after which deltas_since is able to answer
+    model::revision_id delta_log_horizon() const { return _delta_log_horizon; }
+
     // does not include non-replicable partitions
     size_t partition_count() const { return _partition_count; }
 
@@ -630,6 +643,11 @@ private:
     };
 
     void notify_waiters();
+    void append_to_delta_log(const fragmented_vector<delta>&);
+    // Same as notify_waiters but passes the pending deltas to the callbacks in
+    // bounded chunks, yielding in between. Used after applying a controller
+    // snapshot, which may produce a delta for every partition in the cluster.
+    ss::future<> notify_waiters_chunked();
 
     void change_partition_replicas(
       model::ntp ntp,
@@ -674,6 +692,12 @@ private:
     model::revision_id _topics_map_revision{0};
 
     fragmented_vector<delta> _pending_deltas;
+
+    /// Recently applied deltas, ordered by revision, for deltas_since. Deltas
+    /// with a revision greater than _delta_log_horizon are all in the log.
+    static constexpr size_t max_delta_log_size = 10'000;
+    std::deque<delta> _delta_log;
+    model::revision_id _delta_log_horizon;
     cluster::notification_id_type _notification_id{0};
     cluster::notification_id_type _lw_notification_id{0};
     std::vector<std::pair<cluster::notification_id_type, delta_cb_t>>
@@ -54,6 +54,8 @@
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
+#include <boost/range/irange.hpp>
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
@@ -157,18 +159,7 @@ ss::future<std::vector<topic_result>> topics_frontend::create_topics(
               return ss::make_ready_future<std::vector<topic_result>>(
                 make_error_topic_results(topics, errc::not_leader_controller));
           }
-          std::vector<ss::future<topic_result>> futures;
-          futures.reserve(topics.size());
-
-          std::transform(
-            std::begin(topics),
-            std::end(topics),
-            std::back_inserter(futures),
-            [this, timeout](custom_assignable_topic_configuration& t_cfg) {
-                return do_create_topic(std::move(t_cfg), timeout);
-            });
-
-          return ss::when_all_succeed(futures.begin(), futures.end());
+          return do_create_topics(std::move(topics), timeout);
       })
       .then([this, timeout](std::vector<topic_result> results) {
           if (needs_linearizable_barrier(results)) {
@@ -424,12 +415,10 @@ errc topics_frontend::validate_topic_configuration(
     return errc::success;
 }
 
-ss::future<topic_result> topics_frontend::do_create_topic(
-  custom_assignable_topic_configuration assignable_config,
-  model::timeout_clock::time_point timeout) {
+ss::future<std::error_code> topics_frontend::prepare_create_topic(
+  custom_assignable_topic_configuration& assignable_config) {
     if (_topics.local().contains(assignable_config.cfg.tp_ns)) {
-        co_return topic_result(
-          assignable_config.cfg.tp_ns, errc::topic_already_exists);
+        co_return errc::topic_already_exists;
     }
 
     if (_migrated_resources.is_already_migrated(assignable_config.cfg.tp_ns)) {
@@ -437,20 +426,18 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           clusterlog.warn,
           "unable to create topic {} as it is being migrated",
           assignable_config.cfg.tp_ns);
-        co_return topic_result(
-          assignable_config.cfg.tp_ns, errc::topic_already_exists);
+        co_return errc::topic_already_exists;
     }
 
     auto validation_err = validate_topic_configuration(assignable_config);
 
     if (validation_err != errc::success) {
-        co_return topic_result(assignable_config.cfg.tp_ns, validation_err);
+        co_return validation_err;
     }
 
     if (assignable_config.is_read_replica()) {
         if (!assignable_config.cfg.properties.read_replica_bucket) {
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_invalid_config);
+            co_return errc::topic_invalid_config;
         }
         auto rr_manager = remote_topic_configuration_source(
           _cloud_storage_api.local());
@@ -462,8 +449,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           _as.local());
 
         if (download_res != errc::success) {
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_operation_error);
+            co_return errc::topic_operation_error;
         }
 
         if (!assignable_config.cfg.properties.remote_topic_properties) {
@@ -488,8 +474,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
               "Can't run topic recovery for the topic {}, {} is not set",
               assignable_config.cfg.tp_ns,
               bucket_config.name());
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_operation_error);
+            co_return errc::topic_operation_error;
         }
 
         auto bucket = cloud_storage_clients::bucket_name{
@@ -513,8 +498,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
                   clusterlog.error,
                   "Can't run topic recovery for the topic {}",
                   assignable_config.cfg.tp_ns);
-                co_return make_error_result(
-                  assignable_config.cfg.tp_ns, errc::topic_invalid_config);
+                co_return errc::topic_invalid_config;
             }
             vassert(
               static_cast<bool>(
@@ -545,9 +529,8 @@ ss::future<topic_result> topics_frontend::do_create_topic(
               clusterlog.error,
               "Stopping recovery of {} due to validation error",
               assignable_config.cfg.tp_ns);
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns,
-              make_error_code(errc::validation_of_recovery_topic_failed));
+            co_return make_error_code(
+              errc::validation_of_recovery_topic_failed);
         }
 
         vlog(
@@ -581,6 +564,89 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           assignable_config.cfg.tp_ns,
           remote_label);
     }
+    co_return errc::success;
+}
+
+namespace {
+ss::future<std::vector<result<allocation_units::pointer>>> allocate_topics(
+  partition_allocator& al, std::vector<allocation_request> requests) {
+    std::vector<result<allocation_units::pointer>> ret;
+    ret.reserve(requests.size());
+    for (auto& req : requests) {
+        ret.push_back(co_await al.allocate(std::move(req)));
+    }
+    co_return ret;
+}
+} // namespace
+
+ss::future<std::vector<topic_result>> topics_frontend::do_create_topics(
+  custom_assignable_topic_configuration_vector topics,
+  model::timeout_clock::time_point timeout) {
+    if (topics.size() == 1) {
+        std::vector<topic_result> results;
+        results.push_back(
+          co_await do_create_topic(std::move(topics.front()), timeout));
+        co_return results;
+    }
+    /**
+     * Validation and remote manifest lookups are independent for each topic
+     * and run concurrently. Allocation is then done for all the topics that
+     * passed in a single hop to the allocator shard, rather than one hop per
+     * topic interleaving with each other.
+     */
+    std::vector<std::error_code> errors(topics.size());
+    co_await ss::parallel_for_each(
+      boost::irange<size_t>(0, topics.size()),
+      [this, &topics, &errors](size_t i) {
+          return prepare_create_topic(topics[i]).then(
+            [&errors, i](std::error_code ec) { errors[i] = ec; });
+      });
+
+    std::vector<allocation_request> requests;
+    requests.reserve(topics.size());
+    const auto topic_aware = _partition_autobalancing_topic_aware();
+    for (size_t i = 0; i < topics.size(); ++i) {
+        if (!errors[i]) {
+            requests.push_back(make_allocation_request(topics[i], topic_aware));
+        }
+    }
+
+    auto units = co_await _allocator.invoke_on(
+      partition_allocator::shard,
+      [requests = std::move(requests)](partition_allocator& al) mutable {
+          return allocate_topics(al, std::move(requests));
+      });
+
+    std::vector<ss::future<topic_result>> futures;
+    futures.reserve(topics.size());
+    auto units_it = units.begin();
+    for (size_t i = 0; i < topics.size(); ++i) {
+        auto& tp_ns = topics[i].cfg.tp_ns;
+        if (errors[i]) {
+            futures.push_back(ss::make_ready_future<topic_result>(
+              make_error_result(tp_ns, errors[i])));
+            continue;
+        }
+        auto& u = *units_it++;
+        if (!u) {
+            futures.push_back(ss::make_ready_future<topic_result>(
+              make_error_result(tp_ns, u.error())));
+            continue;
+        }
+        futures.push_back(replicate_create_topic(
+          std::move(topics[i].cfg), std::move(u.value()), timeout));
+    }
+
+    co_return co_await ss::when_all_succeed(futures.begin(), futures.end());
+}
+
+ss::future<topic_result> topics_frontend::do_create_topic(
+  custom_assignable_topic_configuration assignable_config,
+  model::timeout_clock::time_point timeout) {
+    auto ec = co_await prepare_create_topic(assignable_config);
+    if (ec) {
+        co_return make_error_result(assignable_config.cfg.tp_ns, ec);
+    }
 
     auto units = co_await _allocator.invoke_on(
       partition_allocator::shard,
@@ -229,9 +229,18 @@ public:
 private:
     using ntp_leader = std::pair<model::ntp, model::node_id>;
 
+    ss::future<std::vector<topic_result>> do_create_topics(
+      custom_assignable_topic_configuration_vector,
+      model::timeout_clock::time_point);
+
     ss::future<topic_result> do_create_topic(
       custom_assignable_topic_configuration, model::timeout_clock::time_point);
 
+    /// Validates the topic and fills in its configuration from the remote
+    /// manifest for read replicas and recovered topics.
+    ss::future<std::error_code>
+      prepare_create_topic(custom_assignable_topic_configuration&);
+
     ss::future<topic_result> replicate_create_topic(
       topic_configuration,
       allocation_units::pointer,
@@ -88,6 +88,20 @@ tx_gateway::abort_tx(abort_tx_request request, rpc::streaming_context&) {
       request.ntp, request.pid, request.tx_seq, request.timeout);
 }
 
+ss::future<end_tx_batch_reply> tx_gateway::end_tx_batch(
+  end_tx_batch_request request, rpc::streaming_context&) {
+    return _rm_partition_frontend.local()
+      .end_tx_batch_locally(
+        request.marker,
+        std::move(request.ntps),
+        request.pid,
+        request.tx_seq,
+        request.timeout)
+      .then([](std::vector<tx::errc> ecs) {
+          return end_tx_batch_reply{std::move(ecs)};
+      });
+}
+
 ss::future<begin_group_tx_reply> tx_gateway::begin_group_tx(
   begin_group_tx_request request, rpc::streaming_context&) {
     return _rm_group_proxy->begin_group_tx_locally(std::move(request));
@@ -56,6 +56,9 @@ public:
     ss::future<abort_tx_reply>
     abort_tx(abort_tx_request, rpc::streaming_context&) override;
 
+    ss::future<end_tx_batch_reply>
+    end_tx_batch(end_tx_batch_request, rpc::streaming_context&) override;
+
     ss::future<begin_group_tx_reply>
     begin_group_tx(begin_group_tx_request, rpc::streaming_context&) override;
 
@@ -2120,12 +2120,17 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::commit_data(
             gfs.push_back(_rm_group_proxy->commit_group_tx(
               group.group_id, tx.pid, tx.tx_seq, timeout));
         }
-        std::vector<ss::future<commit_tx_reply>> cfs;
-        cfs.reserve(tx.partitions.size());
-        for (auto rm : tx.partitions) {
-            cfs.push_back(_rm_partition_frontend.local().commit_tx(
-              rm.ntp, tx.pid, tx.tx_seq, timeout));
+        std::vector<model::ntp> ntps;
+        ntps.reserve(tx.partitions.size());
+        for (const auto& rm : tx.partitions) {
+            ntps.push_back(rm.ntp);
         }
+        auto cf = _rm_partition_frontend.local().end_tx_batch(
+          model::control_record_type::tx_commit,
+          std::move(ntps),
+          tx.pid,
+          tx.tx_seq,
+          timeout);
         auto ok = true;
         auto failed = false;
         auto rejected = false;
@@ -2160,9 +2165,9 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::commit_data(
             }
             ok = ok && (r.ec == tx::errc::none);
         }
-        auto crs = co_await when_all_succeed(cfs.begin(), cfs.end());
-        for (const auto& r : crs) {
-            if (r.ec == tx::errc::request_rejected) {
+        auto crs = co_await std::move(cf);
+        for (auto ec : crs) {
+            if (ec == tx::errc::request_rejected) {
                 rejected = true;
                 vlog(
                   txlog.warn,
@@ -2174,7 +2179,7 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::commit_data(
                   tx.tx_seq,
                   tx.status,
                   expected_term);
-            } else if (r.ec != tx::errc::none) {
+            } else if (ec != tx::errc::none) {
                 failed = true;
                 vlog(
                   txlog.trace,
@@ -2186,9 +2191,9 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::commit_data(
                   tx.tx_seq,
                   tx.status,
                   expected_term,
-                  r.ec);
+                  ec);
             }
-            ok = ok && (r.ec == tx::errc::none);
+            ok = ok && (ec == tx::errc::none);
         }
         if (ok) {
             done = true;
@@ -2250,25 +2255,30 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::abort_data(
     auto done = false;
     vlog(txlog.trace, "[tx_id={}] aborting transaction: {} data", tx.id, tx);
     while (0 < retries--) {
-        std::vector<ss::future<abort_tx_reply>> pfs;
-        pfs.reserve(tx.partitions.size());
-        for (auto rm : tx.partitions) {
-            pfs.push_back(_rm_partition_frontend.local().abort_tx(
-              rm.ntp, tx.pid, tx.tx_seq, timeout));
+        std::vector<model::ntp> ntps;
+        ntps.reserve(tx.partitions.size());
+        for (const auto& rm : tx.partitions) {
+            ntps.push_back(rm.ntp);
         }
+        auto pf = _rm_partition_frontend.local().end_tx_batch(
+          model::control_record_type::tx_abort,
+          std::move(ntps),
+          tx.pid,
+          tx.tx_seq,
+          timeout);
         std::vector<ss::future<abort_group_tx_reply>> gfs;
         gfs.reserve(tx.groups.size());
         for (auto group : tx.groups) {
             gfs.push_back(_rm_group_proxy->abort_group_tx(
               group.group_id, tx.pid, tx.tx_seq, timeout));
         }
-        auto prs = co_await when_all_succeed(pfs.begin(), pfs.end());
+        auto prs = co_await std::move(pf);
         auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
         auto ok = true;
         auto failed = false;
         auto rejected = false;
-        for (const auto& r : prs) {
-            if (r.ec == tx::errc::request_rejected) {
+        for (auto ec : prs) {
+            if (ec == tx::errc::request_rejected) {
                 rejected = true;
                 vlog(
                   txlog.warn,
@@ -2280,7 +2290,7 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::abort_data(
                   tx.tx_seq,
                   tx.status,
                   expected_term);
-            } else if (r.ec != tx::errc::none) {
+            } else if (ec != tx::errc::none) {
                 failed = true;
                 vlog(
                   txlog.info,
@@ -2292,9 +2302,9 @@ ss::future<tx_gateway_frontend::op_result_t> tx_gateway_frontend::abort_data(
                   tx.tx_seq,
                   tx.status,
                   expected_term,
-                  r.ec);
+                  ec);
             }
-            ok = ok && (r.ec == tx::errc::none);
+            ok = ok && (ec == tx::errc::none);
         }
         for (const auto& r : grs) {
             if (r.ec == tx::errc::request_rejected) {
@@ -47,6 +47,23 @@ std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const end_tx_batch_request& r) {
+    fmt::print(
+      o,
+      "{{marker {} ntps {} pid {} tx_seq {} timeout {}}}",
+      r.marker,
+      r.ntps.size(),
+      r.pid,
+      r.tx_seq,
+      r.timeout);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const end_tx_batch_reply& r) {
+    fmt::print(o, "{{ecs {}}}", fmt::join(r.ecs, ", "));
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const begin_group_tx_request& r) {
     fmt::print(
       o,
@@ -554,6 +554,72 @@ struct abort_tx_reply
     friend std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r);
 };
 
+// Ends a transaction on the partitions of `ntps` led by the receiver with a
+// single RPC, writing a commit or an abort marker to each of them. The
+// reply has an error code per partition, in the order of `ntps`.
+struct end_tx_batch_request
+  : serde::envelope<
+      end_tx_batch_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    model::control_record_type marker{model::control_record_type::unknown};
+    std::vector<model::ntp> ntps;
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    model::timeout_clock::duration timeout{};
+
+    end_tx_batch_request() noexcept = default;
+
+    end_tx_batch_request(
+      model::control_record_type marker,
+      std::vector<model::ntp> ntps,
+      model::producer_identity pid,
+      model::tx_seq tx_seq,
+      model::timeout_clock::duration timeout)
+      : marker(marker)
+      , ntps(std::move(ntps))
+      , pid(pid)
+      , tx_seq(tx_seq)
+      , timeout(timeout) {}
+
+    friend bool
+    operator==(const end_tx_batch_request&, const end_tx_batch_request&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(marker, ntps, pid, tx_seq, timeout);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const end_tx_batch_request& r);
+};
+
+struct end_tx_batch_reply
+  : serde::envelope<
+      end_tx_batch_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    std::vector<tx::errc> ecs;
+
+    end_tx_batch_reply() noexcept = default;
+
+    explicit end_tx_batch_reply(std::vector<tx::errc> ecs)
+      : ecs(std::move(ecs)) {}
+
+    friend bool
+    operator==(const end_tx_batch_reply&, const end_tx_batch_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(ecs); }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const end_tx_batch_reply& r);
+};
+
 struct begin_group_tx_request
   : serde::envelope<
       begin_group_tx_request,
@@ -17,6 +17,7 @@
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
+#include "compression/offload.h"
 
 namespace compression {
 
@@ -73,6 +74,10 @@ iobuf compressor::uncompress(const iobuf& io, type t) {
 }
 
 ss::future<iobuf> stream_compressor::compress(iobuf io, type t) {
+    if (auto* offload = offload_compressor_instance();
+        offload && offload->should_offload(io.size_bytes(), t)) {
+        return offload->compress(std::move(io), t);
+    }
     switch (t) {
     case type::none:
         return ss::make_exception_future<iobuf>(
@@ -89,6 +94,10 @@ ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
         return ss::make_exception_future<iobuf>(std::runtime_error(fmt::format(
           "Asked to decompress:{} an empty buffer:{}", (int)t, io)));
     }
+    if (auto* offload = offload_compressor_instance();
+        offload && offload->should_offload(io.size_bytes(), t)) {
+        return offload->uncompress(std::move(io), t);
+    }
     switch (t) {
     case type::zstd:
         return compression::async_stream_zstd_instance().uncompress(
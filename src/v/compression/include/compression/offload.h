@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "model/compression.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+
+namespace ssx {
+class sharded_thread_worker;
+} // namespace ssx
+
+namespace compression {
+
+/*
+ * Runs zstd and gzip compression of large payloads on the std::thread twin
+ * of the current reactor core (see ssx::sharded_thread_worker) so that
+ * multi-megabyte buffers do not stall the reactor. Smaller payloads and the
+ * cheaper codecs stay inline, where the hand-off would cost more than it
+ * saves.
+ */
+class offload_compressor {
+public:
+    struct config {
+        // payloads of at least this many bytes are offloaded
+        size_t min_bytes;
+        // payloads a shard may have queued on its helper thread at once
+        size_t max_concurrency;
+        // zstd decompression workspace of the helper thread
+        size_t zstd_decompress_workspace_bytes;
+    };
+
+    offload_compressor(ssx::sharded_thread_worker&, config);
+
+    bool should_offload(size_t size_bytes, model::compression) const;
+
+    ss::future<iobuf> compress(iobuf, model::compression);
+    ss::future<iobuf> uncompress(iobuf, model::compression);
+
+private:
+    ssx::sharded_thread_worker& _worker;
+    config _config;
+    ssx::semaphore _units;
+};
+
+/// installs an offload_compressor on the current shard, from then on
+/// stream_compressor hands large payloads to it
+ss::future<> initialize_offload_compressor(
+  ssx::sharded_thread_worker&, offload_compressor::config);
+/// removes the current shard's offload_compressor, must happen before the
+/// worker is stopped
+void reset_offload_compressor();
+/// the current shard's offload_compressor or nullptr when there is none
+offload_compressor* offload_compressor_instance();
+
+} // namespace compression
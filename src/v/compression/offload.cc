@@ -0,0 +1,110 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/offload.h"
+
+#include "base/vassert.h"
+#include "compression/internal/gzip_compressor.h"
+#include "compression/stream_zstd.h"
+#include "ssx/thread_worker.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace compression {
+
+namespace {
+
+// stream_zstd keeps its compression context between calls, so one instance
+// per helper thread is that thread's context pool
+thread_local stream_zstd worker_zstd;
+
+iobuf worker_compress(const iobuf& in, model::compression t) {
+    switch (t) {
+    case model::compression::zstd:
+        return worker_zstd.compress(in);
+    case model::compression::gzip:
+        return internal::gzip_compressor::compress(in);
+    default:
+        vassert(false, "Cannot offload compression of type {}", t);
+    }
+}
+
+iobuf worker_uncompress(const iobuf& in, model::compression t) {
+    switch (t) {
+    case model::compression::zstd:
+        return worker_zstd.uncompress(in);
+    case model::compression::gzip:
+        return internal::gzip_compressor::uncompress(in);
+    default:
+        vassert(false, "Cannot offload decompression of type {}", t);
+    }
+}
+
+/*
+ * The result was assembled on the helper thread. Move its fragments into an
+ * iobuf that belongs to the current shard, which keeps the shard ownership
+ * checks of debug builds happy.
+ */
+iobuf adopt(iobuf result) {
+    iobuf ret;
+    ret.append_fragments(std::move(result));
+    return ret;
+}
+
+thread_local std::unique_ptr<offload_compressor> offload_instance;
+
+} // namespace
+
+offload_compressor::offload_compressor(
+  ssx::sharded_thread_worker& worker, config cfg)
+  : _worker(worker)
+  , _config(cfg)
+  , _units(cfg.max_concurrency, "compression_offload") {}
+
+bool offload_compressor::should_offload(
+  size_t size_bytes, model::compression t) const {
+    return size_bytes >= _config.min_bytes
+           && (t == model::compression::zstd || t == model::compression::gzip);
+}
+
+ss::future<iobuf>
+offload_compressor::compress(iobuf in, model::compression t) {
+    auto units = co_await ss::get_units(_units, 1);
+    // `in` stays alive and untouched in this frame until the thread is done
+    auto out = co_await _worker.submit(
+      [&in, t] { return worker_compress(in, t); });
+    co_return adopt(std::move(out));
+}
+
+ss::future<iobuf>
+offload_compressor::uncompress(iobuf in, model::compression t) {
+    auto units = co_await ss::get_units(_units, 1);
+    auto out = co_await _worker.submit(
+      [&in, t] { return worker_uncompress(in, t); });
+    co_return adopt(std::move(out));
+}
+
+ss::future<> initialize_offload_compressor(
+  ssx::sharded_thread_worker& worker, offload_compressor::config cfg) {
+    vassert(!offload_instance, "offload_compressor initialized twice");
+    // allocate the helper thread's zstd workspace up front, like the
+    // reactor's own at startup
+    co_await worker.submit([size = cfg.zstd_decompress_workspace_bytes] {
+        stream_zstd::init_workspace(size);
+    });
+    offload_instance = std::make_unique<offload_compressor>(worker, cfg);
+}
+
+void reset_offload_compressor() { offload_instance.reset(); }
+
+offload_compressor* offload_compressor_instance() {
+    return offload_instance.get();
+}
+
+} // namespace compression
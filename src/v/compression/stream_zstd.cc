@@ -58,6 +58,12 @@ void stream_zstd::init_workspace(size_t size) {
 }
 
 void stream_zstd::reset_compressor() {
+    if (_compress) {
+        // reuse the allocated context, only dropping the previous session
+        throw_if_error(ZSTD_CCtx_reset(
+          _compress.get(), ZSTD_reset_session_and_parameters));
+        return;
+    }
     _compress.reset(ZSTD_createCCtx());
     if (!_compress) {
         throw std::bad_alloc{};
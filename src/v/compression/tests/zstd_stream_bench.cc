@@ -11,9 +11,12 @@
 #include "base/vassert.h"
 #include "compression/async_stream_zstd.h"
 #include "compression/internal/gzip_compressor.h"
+#include "compression/compression.h"
 #include "compression/internal/lz4_frame_compressor.h"
+#include "compression/offload.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
+#include "ssx/thread_worker.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -157,3 +160,67 @@ PERF_TEST_C(async_stream_zstd, 10mb_compress) {
 PERF_TEST_C(async_stream_zstd, 10mb_uncompress) {
     co_return co_await async_uncompress_test(10 << 20);
 }
+
+/*
+ * Offloaded compression also pays for handing the payload to the helper
+ * thread and back; compare with the inline zstd and gzip numbers above.
+ */
+inline ss::future<>
+offload_compress_test(model::compression t, size_t data_size) {
+    ssx::sharded_thread_worker worker;
+    co_await worker.start({.name = "bench"});
+    compression::offload_compressor fn(
+      worker,
+      {.min_bytes = 0,
+       .max_concurrency = 1,
+       .zstd_decompress_workspace_bytes = 2_MiB});
+    auto o = gen(data_size);
+
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(co_await fn.compress(std::move(o), t));
+    perf_tests::stop_measuring_time();
+    co_await worker.stop();
+}
+
+inline ss::future<>
+offload_uncompress_test(model::compression t, size_t data_size) {
+    ssx::sharded_thread_worker worker;
+    co_await worker.start({.name = "bench"});
+    compression::offload_compressor fn(
+      worker,
+      {.min_bytes = 0,
+       .max_concurrency = 1,
+       .zstd_decompress_workspace_bytes = 2_MiB});
+    auto o = compression::compressor::compress(gen(data_size), t);
+
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(co_await fn.uncompress(std::move(o), t));
+    perf_tests::stop_measuring_time();
+    co_await worker.stop();
+}
+
+struct offload_compression {};
+PERF_TEST_C(offload_compression, zstd_1mb_compress) {
+    co_await offload_compress_test(model::compression::zstd, 1 << 20);
+}
+PERF_TEST_C(offload_compression, zstd_1mb_uncompress) {
+    co_await offload_uncompress_test(model::compression::zstd, 1 << 20);
+}
+PERF_TEST_C(offload_compression, zstd_10mb_compress) {
+    co_await offload_compress_test(model::compression::zstd, 10 << 20);
+}
+PERF_TEST_C(offload_compression, zstd_10mb_uncompress) {
+    co_await offload_uncompress_test(model::compression::zstd, 10 << 20);
+}
+PERF_TEST_C(offload_compression, gzip_1mb_compress) {
+    co_await offload_compress_test(model::compression::gzip, 1 << 20);
+}
+PERF_TEST_C(offload_compression, gzip_1mb_uncompress) {
+    co_await offload_uncompress_test(model::compression::gzip, 1 << 20);
+}
+PERF_TEST_C(offload_compression, gzip_10mb_compress) {
+    co_await offload_compress_test(model::compression::gzip, 10 << 20);
+}
+PERF_TEST_C(offload_compression, gzip_10mb_uncompress) {
+    co_await offload_uncompress_test(model::compression::gzip, 10 << 20);
+}
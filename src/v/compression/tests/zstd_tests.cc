@@ -14,9 +14,11 @@
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
+#include "compression/offload.h"
 #include "compression/snappy_standard_compressor.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
+#include "ssx/thread_worker.h"
 
 #include <seastar/testing/thread_test_case.hh>
 
@@ -186,3 +188,24 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+
+SEASTAR_THREAD_TEST_CASE(offload_compressor_test) {
+    ssx::sharded_thread_worker worker;
+    worker.start({.name = "test"}).get();
+    compression::offload_compressor fn(
+      worker,
+      {.min_bytes = 0,
+       .max_concurrency = 2,
+       .zstd_decompress_workspace_bytes = default_decompression_size});
+    for (auto t : {model::compression::zstd, model::compression::gzip}) {
+        BOOST_REQUIRE(fn.should_offload(0, t));
+        for (size_t i : sizes) {
+            iobuf buf = gen(i);
+            auto cbuf = fn.compress(buf.share(0, i), t).get();
+            auto dbuf = fn.uncompress(std::move(cbuf), t).get();
+            BOOST_CHECK_EQUAL(dbuf, buf);
+        }
+    }
+    BOOST_REQUIRE(!fn.should_offload(1_MiB, model::compression::lz4));
+    worker.stop().get();
+}
@@ -157,6 +157,16 @@ configuration::configuration()
       "Enable compression for internal rpc server replies",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , rpc_client_priority_connection(
+      *this,
+      "rpc_client_priority_connection",
+      "Open a second connection to each peer, next to every data connection, "
+      "that carries only small latency sensitive requests such as raft "
+      "heartbeats and votes. Keeps them from queueing behind large "
+      "replication and recovery requests. Applies to connections created "
+      "after the change.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , enable_coproc(*this, "enable_coproc")
   , coproc_max_inflight_bytes(*this, "coproc_max_inflight_bytes")
   , coproc_max_ingest_bytes(*this, "coproc_max_ingest_bytes")
@@ -207,6 +217,14 @@ configuration::configuration()
       2_MiB,
       // WebAssembly uses 64KiB pages and has a 32bit address space
       {.min = 64_KiB, .max = 4_GiB})
+  , data_transforms_huge_pages(
+      *this,
+      "data_transforms_huge_pages",
+      "Back the memory of Data Transform WebAssembly Virtual Machines with "
+      "transparent huge pages. This reduces TLB misses of transforms that "
+      "access a lot of their memory.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      true)
   , data_transforms_runtime_limit_ms(
       *this,
       "data_transforms_runtime_limit_ms",
@@ -386,6 +404,58 @@ configuration::configuration()
       "enables raft optimization of heartbeats",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , raft_enable_quiescence(
+      *this,
+      "raft_enable_quiescence",
+      "Stop heartbeating idle raft groups whose followers are caught up. The "
+      "followers of a quiescent group rely on the heartbeats of the leader "
+      "node instead, any request sent to them wakes the group.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_quiescence_lease_ms(
+      *this,
+      "raft_quiescence_lease_ms",
+      "Time for which a follower of a quiescent raft group doesn't expect "
+      "heartbeats of the group. The leader renews the lease with a single "
+      "heartbeat, it bounds the time a group can stay quiescent after its "
+      "leader stepped down on a node that is still alive.",
+      {.needs_restart = needs_restart::no,
+       .example = "30000",
+       .visibility = visibility::tunable},
+      30s)
+  , raft_enable_eager_commit_propagation(
+      *this,
+      "raft_enable_eager_commit_propagation",
+      "Send the followers a heartbeat as soon as the leader commit index "
+      "advances instead of waiting for the next append or heartbeat interval. "
+      "Shortens the time until records are visible to consumers fetching "
+      "from followers.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_enable_leader_lease(
+      *this,
+      "raft_enable_leader_lease",
+      "Serve linearizable reads on raft leaders holding a lease instead of "
+      "confirming leadership with a round of requests to the followers. The "
+      "lease lasts for most of the election timeout after the followers "
+      "last acknowledged the leader. Followers delay granting votes for an "
+      "election timeout after they start when it is enabled.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_replication_compression(
+      *this,
+      "raft_replication_compression",
+      "Wire compression of raft append entries requests carrying data, "
+      "applied to requests of at least 1 KiB. Useful for replicating "
+      "uncompressed topics across availability zones. lz4 is used only once "
+      "every node in the cluster supports it, until then zstd is used.",
+      {.needs_restart = needs_restart::no,
+       .example = "lz4",
+       .visibility = visibility::tunable},
+      model::compression::none,
+      {model::compression::none,
+       model::compression::lz4,
+       model::compression::zstd})
   , raft_recovery_concurrency_per_shard(
       *this,
       "raft_recovery_concurrency_per_shard",
@@ -436,6 +506,17 @@ configuration::configuration()
       "truncation if any of the replicas has more data than the majority.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , raft_append_entries_batch_max_bytes(
+      *this,
+      "raft_append_entries_batch_max_bytes",
+      "Maximum number of bytes of append entries requests, from different raft "
+      "groups on a shard and bound for the same node, that are combined into a "
+      "single RPC. Larger requests are sent on their own. Zero disables "
+      "batching.",
+      {.needs_restart = needs_restart::no,
+       .example = "262144",
+       .visibility = visibility::tunable},
+      128_KiB)
   , enable_usage(
       *this,
       "enable_usage",
@@ -570,6 +651,25 @@ configuration::configuration()
       "Extra delay (ms) added to rebalance phase to wait for new members",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       3s)
+  , group_offset_commit_coalesce_ms(
+      *this,
+      "group_offset_commit_coalesce_ms",
+      "Window (ms) during which the offset commits of a consumer group are "
+      "buffered and then replicated together in a single batch. Only the last "
+      "commit of a partition within the window is stored. 0 replicates every "
+      "commit request on its own.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
+  , group_offset_fetch_snapshot_ttl_ms(
+      *this,
+      "group_offset_fetch_snapshot_ttl_ms",
+      "Maximum age of the shard local snapshot of a consumer group's committed "
+      "offsets used to answer OffsetFetch requests without going to the "
+      "group coordinator shard. Offsets committed within this window may not "
+      "be visible to OffsetFetch. Requests with require_stable set always go "
+      "to the coordinator. 0 disables the snapshot.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , group_new_member_join_timeout(
       *this,
       "group_new_member_join_timeout",
@@ -665,6 +765,37 @@ configuration::configuration()
         model::fetch_read_strategy::non_polling,
         model::fetch_read_strategy::non_polling_with_debounce,
       })
+  , fetch_link_foreign_reads(
+      *this,
+      "fetch_link_foreign_reads",
+      "Copy the data a fetch reads from a partition of another shard than the "
+      "one of the connection into buffers owned by the response on the shard "
+      "of the partition. The connection shard then links these buffers into "
+      "the response instead of copying the data itself",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , fetch_catchup_read_min_lag(
+      *this,
+      "fetch_catchup_read_min_lag",
+      "Number of offsets behind the high watermark at which a fetch is "
+      "considered a catch-up read. Catch-up reads use an I/O priority class "
+      "with fewer shares than the one of appends and of reads near the tip "
+      "of the log, so that consumers reading historical data cannot saturate "
+      "the disk. If not set all fetches use the same I/O priority class.",
+      {.needs_restart = needs_restart::no,
+       .example = "100000",
+       .visibility = visibility::tunable},
+      100'000)
+  , fetch_response_cache_ttl_ms(
+      *this,
+      "fetch_response_cache_ttl_ms",
+      "Maximum age of the encoded partition data a shard keeps to serve "
+      "fetches from the same offset, e.g. from many consumer groups tailing "
+      "the same partition, without reading and encoding it again. Cached data "
+      "is dropped as soon as the high watermark of its partition moves. 0 "
+      "disables the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1'000ms)
   , alter_topic_cfg_timeout_ms(
       *this,
       "alter_topic_cfg_timeout_ms",
@@ -862,6 +993,17 @@ configuration::configuration()
       "Use sliding window compaction.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       true)
+  , log_compaction_rewrite_parallelism(
+      *this,
+      "log_compaction_rewrite_parallelism",
+      "Maximum number of segments of one log that sliding window compaction "
+      "deduplicates concurrently. Each concurrent rewrite holds its own read "
+      "buffers and write-behind memory.",
+      {.needs_restart = needs_restart::no,
+       .example = "4",
+       .visibility = visibility::tunable},
+      1,
+      {.min = 1, .max = 16})
   , retention_bytes(
       *this,
       "retention_bytes",
@@ -995,6 +1137,18 @@ configuration::configuration()
       "Max size of requests cached for replication",
       {.visibility = visibility::tunable},
       1_MiB)
+  , raft_replicate_batch_max_flush_delay_ms(
+      *this,
+      "raft_replicate_batch_max_flush_delay_ms",
+      "Upper bound of the delay the replicate batcher may hold requests back "
+      "for to let more of them join a batch. The delay adapts to the request "
+      "arrival rate and replication latency of each partition and is only "
+      "applied when more requests are expected to arrive meanwhile. Set to 0 "
+      "to flush requests as soon as they arrive.",
+      {.needs_restart = needs_restart::no,
+       .example = "2",
+       .visibility = visibility::tunable},
+      0ms)
   , raft_learner_recovery_rate(
       *this,
       "raft_learner_recovery_rate",
@@ -1007,6 +1161,49 @@ configuration::configuration()
       "Disables dynamic rate allocation in recovery throttle (advanced).",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , raft_recovery_priority_topics(
+      *this,
+      "raft_recovery_priority_topics",
+      "Topics whose partitions are recovered ahead of other user partitions. "
+      "When they compete with other partitions for the learner recovery rate "
+      "they are guaranteed raft_recovery_priority_bandwidth_percent of it.",
+      {.needs_restart = needs_restart::no,
+       .example = R"(['orders', 'payments'])",
+       .visibility = visibility::user},
+      {},
+      &validate_non_empty_string_vec)
+  , raft_recovery_priority_bandwidth_percent(
+      *this,
+      "raft_recovery_priority_bandwidth_percent",
+      "Share of the learner recovery rate guaranteed to the partitions of "
+      "raft_recovery_priority_topics and internal topics while other "
+      "partitions recover too. Whatever one of the classes leaves unused is "
+      "available to the other.",
+      {.needs_restart = needs_restart::no,
+       .example = "80",
+       .visibility = visibility::tunable},
+      80,
+      {.min = 1, .max = 99})
+  , raft_recovery_segment_transfer_enabled(
+      *this,
+      "raft_recovery_segment_transfer_enabled",
+      "Recover followers that are missing whole closed segments of the leader "
+      "log by transferring the segment and index files instead of replicating "
+      "their batches. The open segment is always recovered with batches.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_recovery_cloud_storage_min_lag_bytes(
+      *this,
+      "raft_recovery_cloud_storage_min_lag_bytes",
+      "For topics with data in cloud storage, followers lagging behind the "
+      "leader by at least this many bytes of uploaded data skip it: they are "
+      "sent a snapshot at the last uploaded offset and only the tail of the "
+      "log is replicated from the leader disk. The skipped data is read from "
+      "cloud storage. Disabled if not set.",
+      {.needs_restart = needs_restart::no,
+       .example = "1073741824",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , raft_smp_max_non_local_requests(
       *this,
       "raft_smp_max_non_local_requests",
@@ -1018,8 +1215,10 @@ configuration::configuration()
       *this,
       "raft_max_concurrent_append_requests_per_follower",
       "Maximum number of concurrent append entries requests sent by leader to "
-      "one follower",
-      {.visibility = visibility::tunable},
+      "one follower. This is the replication pipeline depth of a single "
+      "partition; increase it when round-trip time between brokers limits "
+      "per-partition throughput.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       16)
   , write_caching_default(
       *this,
@@ -1090,6 +1289,14 @@ configuration::configuration()
       "Key-value maximum segment size (bytes)",
       {.visibility = visibility::tunable},
       16_MiB)
+  , kvstore_consensus_flush_interval(
+      *this,
+      "kvstore_consensus_flush_interval",
+      "Key-value store flush interval (ms) for raft consensus metadata such as "
+      "voted_for. Writes to this key space are flushed on their own cadence "
+      "instead of waiting for the `kvstore_flush_interval` of bulk writes.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::chrono::milliseconds(10))
   , max_kafka_throttle_delay_ms(
       *this,
       "max_kafka_throttle_delay_ms",
@@ -1148,6 +1355,14 @@ configuration::configuration()
       "cache",
       {.visibility = visibility::tunable},
       60s)
+  , fetch_session_cache_max_bytes(
+      *this,
+      "fetch_session_cache_max_bytes",
+      "Memory budget of the incremental fetch sessions cache of a shard. Over "
+      "it the least frequently used sessions are evicted and their clients "
+      "have to start over with a full fetch.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      10_MiB)
   , append_chunk_size(
       *this,
       "append_chunk_size",
@@ -1163,6 +1378,26 @@ configuration::configuration()
        .example = "31768",
        .visibility = visibility::tunable},
       128_KiB)
+  , storage_scrub_interval_ms(
+      *this,
+      "storage_scrub_interval_ms",
+      "Time between two passes of the local scrubber, which reads the closed "
+      "segments of every partition on a shard and validates the checksum of "
+      "every batch to find corruption on disk before a reader does. If not set "
+      "local scrubbing is disabled.",
+      {.needs_restart = needs_restart::no,
+       .example = "86400000",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_scrub_bytes_per_sec(
+      *this,
+      "storage_scrub_bytes_per_sec",
+      "Maximum rate at which the local scrubber reads segments, per shard.",
+      {.needs_restart = needs_restart::no,
+       .example = "10485760",
+       .visibility = visibility::tunable},
+      10_MiB,
+      {.min = 64_KiB})
   , storage_read_readahead_count(
       *this,
       "storage_read_readahead_count",
@@ -1171,6 +1406,17 @@ configuration::configuration()
        .example = "1",
        .visibility = visibility::tunable},
       10)
+  , storage_read_readahead_memory(
+      *this,
+      "storage_read_readahead_memory",
+      "Memory per shard that local log readers may hold in read-ahead "
+      "buffers. Readers ramp up to `storage_read_readahead_count` reads in "
+      "flight while they read sequentially; readers that don't fit in this "
+      "budget issue one read at a time.",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      64_MiB)
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -1234,6 +1480,86 @@ configuration::configuration()
        .visibility = visibility::tunable},
       12.0,
       {.min = 1.0, .max = 100.0})
+  , storage_segment_index_memory(
+      *this,
+      "storage_segment_index_memory",
+      "Maximum number of bytes that may be used on each shard by the offset "
+      "and time indices of segments that are no longer being appended to. "
+      "When exceeded, the least recently used indices are dropped from memory "
+      "and re-read from disk on their next lookup. If unset, indices are "
+      "always kept in memory.",
+      {.needs_restart = needs_restart::no,
+       .example = "134217728",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_segment_index_page_cache_memory(
+      *this,
+      "storage_segment_index_page_cache_memory",
+      "Maximum number of bytes that may be used on each shard to cache pages "
+      "of the index files of segments whose indices were dropped from memory "
+      "under `storage_segment_index_memory`. Offset lookups for reads on such "
+      "segments only load the index pages they need through this cache "
+      "instead of re-reading the whole index. Zero disables the cache.",
+      {.needs_restart = needs_restart::no,
+       .example = "8388608",
+       .visibility = visibility::tunable},
+      4_MiB)
+  , storage_time_index_step_bytes(
+      *this,
+      "storage_time_index_step_bytes",
+      "Density of the per-segment batch time index: a user data batch is "
+      "indexed by timestamp once this many bytes were appended since the "
+      "previous indexed batch. Denser indices answer more timequeries "
+      "without reading the segment, at the cost of index memory. Zero "
+      "indexes every batch.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_KiB)
+  , storage_flush_coalesce_window_us(
+      *this,
+      "storage_flush_coalesce_window_us",
+      "Time window in microseconds during which flushes of local log "
+      "segments on a shard are collected and then issued together. A larger "
+      "window lowers the rate of fdatasync calls with many low throughput "
+      "partitions at the cost of produce latency. Zero flushes each segment "
+      "as soon as it is requested.",
+      {.needs_restart = needs_restart::no,
+       .example = "500",
+       .visibility = visibility::tunable},
+      0,
+      {.max = 10000})
+  , storage_segment_pool_size(
+      *this,
+      "storage_segment_pool_size",
+      "Number of empty segment files that each shard keeps created and "
+      "preallocated in the background, so that rolling a segment only has "
+      "to rename a file into place. Each file reserves "
+      "`segment_fallocation_step` bytes of disk space. Zero disables the "
+      "pool.",
+      {.needs_restart = needs_restart::no,
+       .example = "4",
+       .visibility = visibility::tunable},
+      0)
+  , storage_cold_tier_segment_age_ms(
+      *this,
+      "storage_cold_tier_segment_age_ms",
+      "Closed segments whose newest batch is older than this are moved to "
+      "`cold_data_directory`, if the node has one configured. Segments of "
+      "compacted topics are never moved. Null disables age based demotion.",
+      {.needs_restart = needs_restart::no,
+       .example = "86400000",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_hot_tier_partition_bytes(
+      *this,
+      "storage_hot_tier_partition_bytes",
+      "Closed segments of a partition beyond this many bytes from the head of "
+      "the log are moved to `cold_data_directory`, if the node has one "
+      "configured. Segments of compacted topics are never moved. Null "
+      "disables size based demotion.",
+      {.needs_restart = needs_restart::no,
+       .example = "10737418240",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
@@ -1297,6 +1623,16 @@ configuration::configuration()
       "touching the log until the batch is exhausted.",
       {.visibility = visibility::tunable},
       1000)
+  , id_allocator_prefetch_size(
+      *this,
+      "id_allocator_prefetch_size",
+      "Number of producer ids every shard allocates ahead of InitProducerId "
+      "requests, so that they are served without a round trip to the id "
+      "allocator leader. Refilled in the background once half of them are "
+      "used. 0 disables prefetching.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0,
+      {.min = 0})
   , enable_sasl(
       *this,
       "enable_sasl",
@@ -1399,6 +1735,25 @@ configuration::configuration()
       "limit applies to compressed batch size",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_MiB)
+  , kafka_max_pipelined_requests_per_connection(
+      *this,
+      "kafka_max_pipelined_requests_per_connection",
+      "Maximum number of requests of a connection that are read, throttled "
+      "and wait to be dispatched while an earlier request of the connection "
+      "is dispatched. Requests are still dispatched and responded to in "
+      "order. 0 disables pipelining. Applies to new connections.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
+  , kafka_produce_recompression_max_bytes_per_sec(
+      *this,
+      "kafka_produce_recompression_max_bytes_per_sec",
+      "Maximum rate, per shard, at which produced batches that are not "
+      "compressed are compressed with the `compression.type` of their topic "
+      "before they are written. Batches produced over this rate, and batches "
+      "of topics with the `producer` compression type, are written as "
+      "received. 0 disables recompression.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , kafka_nodelete_topics(
       *this,
       "kafka_nodelete_topics",
@@ -1536,6 +1891,19 @@ configuration::configuration()
       // permit setting a max below the min).  The maximum is set to forbid
       // contiguous allocations beyond that size.
       {.min = 512, .max = 512_KiB, .align = 4_KiB})
+  , kafka_rpc_server_cork_window_us(
+      *this,
+      "kafka_rpc_server_cork_window_us",
+      "Upper bound in microseconds on delaying the flush of a Kafka response "
+      "while more requests of the same connection are in flight. Responses "
+      "written in the meantime are sent with a single syscall, which lowers "
+      "the syscall rate of busy connections at the cost of response latency. "
+      "Zero flushes every response as soon as it is written.",
+      {.needs_restart = needs_restart::yes,
+       .example = "100",
+       .visibility = visibility::tunable},
+      0,
+      {.max = 10000})
   , kafka_enable_describe_log_dirs_remote_storage(
       *this,
       "kafka_enable_describe_log_dirs_remote_storage",
@@ -1819,6 +2187,15 @@ configuration::configuration()
       "Max https connection idle time (ms)",
       {.visibility = visibility::tunable},
       5s)
+  , cloud_storage_warm_up_connections(
+      *this,
+      "cloud_storage_warm_up_connections",
+      "Number of connections to the cloud storage endpoint that every shard "
+      "establishes on startup, before they are needed by requests, so that "
+      "the first requests don't wait for TCP and TLS handshakes. The value is "
+      "capped by the number of connections per shard.",
+      {.visibility = visibility::tunable},
+      0)
   , cloud_storage_segment_max_upload_interval_sec(
       *this,
       "cloud_storage_segment_max_upload_interval_sec",
@@ -1826,6 +2203,16 @@ configuration::configuration()
       "remote storage (sec)",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1h)
+  , cloud_storage_segment_min_timeboxed_upload_size(
+      *this,
+      "cloud_storage_segment_min_timeboxed_upload_size",
+      "Minimum amount of data (in bytes) which is uploaded when "
+      "cloud_storage_segment_max_upload_interval_sec elapses. Smaller uploads "
+      "of a low throughput partition are postponed by another interval, at "
+      "most three times, to avoid creating many small objects. If not set the "
+      "uploads are never postponed.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_manifest_max_upload_interval_sec(
       *this,
       "cloud_storage_manifest_max_upload_interval_sec",
@@ -1841,6 +2228,16 @@ configuration::configuration()
       "replica",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_readreplica_manifest_sync_max_interval_ms(
+      *this,
+      "cloud_storage_readreplica_manifest_sync_max_interval_ms",
+      "Upper bound of the interval between manifest syncs of an idle read "
+      "replica partition. While the remote manifest is unchanged the interval "
+      "doubles, starting from "
+      "cloud_storage_readreplica_manifest_sync_timeout_ms. If not set, the "
+      "manifest is synced at a fixed interval.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_metadata_sync_timeout_ms(
       *this,
       "cloud_storage_metadata_sync_timeout_ms",
@@ -1995,6 +2392,17 @@ configuration::configuration()
       "Enable re-uploading data for compacted topics",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , cloud_storage_compacted_reupload_min_savings_percent(
+      *this,
+      "cloud_storage_compacted_reupload_min_savings_percent",
+      "Minimum reduction of the size of the uploaded segments, in percent, "
+      "required to re-upload a range of a compacted topic after local "
+      "compaction. Ranges where local compaction removed less data are kept "
+      "as they are in the cloud storage. 0 re-uploads every range which got "
+      "smaller.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0,
+      {.min = 0, .max = 100})
   , cloud_storage_recovery_temporary_retention_bytes_default(
       *this,
       "cloud_storage_recovery_temporary_retention_bytes_default",
@@ -2033,6 +2441,29 @@ configuration::configuration()
       "cloud_storage_segment_size_target/2",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt)
+  , cloud_storage_multipart_upload_threshold(
+      *this,
+      "cloud_storage_multipart_upload_threshold",
+      "Segments of at least this size are uploaded to the cloud storage in "
+      "parts, which are sent concurrently and retried individually. Segments "
+      "are uploaded with a single request when unset.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , cloud_storage_multipart_upload_part_size(
+      *this,
+      "cloud_storage_multipart_upload_part_size",
+      "Size of the parts of segments uploaded in parts. The parts in flight "
+      "are buffered in memory.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_MiB,
+      {.min = 5_MiB, .max = 512_MiB})
+  , cloud_storage_multipart_upload_concurrency(
+      *this,
+      "cloud_storage_multipart_upload_concurrency",
+      "Maximum number of parts of a segment uploaded concurrently. Fewer are "
+      "used when few connections are idle.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
   , cloud_storage_max_throughput_per_shard(
       *this,
       "cloud_storage_max_throughput_per_shard",
@@ -2061,6 +2492,18 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       50,
       {.min = 0, .max = 100})
+  , cloud_storage_background_requests_per_sec(
+      *this,
+      "cloud_storage_background_requests_per_sec",
+      "Max number of requests per second per shard issued to the object "
+      "storage by the housekeeping jobs (segment merging and reupload, "
+      "scrubbing and purging). Limits the bursts of housekeeping requests so "
+      "that the uploads and reads of the data path are not delayed. If not "
+      "set the housekeeping requests are not limited.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt,
+      // The token bucket can't refill at rates below ~22 per second
+      {.min = 25})
   , cloud_storage_graceful_transfer_timeout_ms(
       *this,
       "cloud_storage_graceful_transfer_timeout_ms",
@@ -2117,6 +2560,15 @@ configuration::configuration()
       "environment",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt)
+  , cloud_storage_spillover_manifest_prefetch_count(
+      *this,
+      "cloud_storage_spillover_manifest_prefetch_count",
+      "Number of spillover manifests following a newly materialized one that "
+      "are downloaded into the cache in the background, so that readers "
+      "moving through the archive don't wait for a download per manifest. 0 "
+      "disables prefetching.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_manifest_cache_size(
       *this,
       "cloud_storage_manifest_cache_size",
@@ -2562,6 +3014,41 @@ configuration::configuration()
       "Number of chunks to prefetch ahead of every downloaded chunk",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       0)
+  , cloud_storage_chunk_hydration_max_parts(
+      *this,
+      "cloud_storage_chunk_hydration_max_parts",
+      "Maximum number of concurrent ranged requests used to download a chunk "
+      "of a segment into the cloud storage cache. Fewer are used when few "
+      "connections are idle or the chunk is small. A single request is used "
+      "when set to 1.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1)
+  , cloud_storage_prefetch_max_bytes_in_flight(
+      *this,
+      "cloud_storage_prefetch_max_bytes_in_flight",
+      "Maximum number of bytes per shard of segments hydrated ahead of the "
+      "consumers of tiered storage partitions. Readers ask for the first "
+      "chunk of the next segment they will read, the prefetches of the "
+      "consumers closest to running out of data go first. Set to 0 to "
+      "disable.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_memory_read_max_bytes(
+      *this,
+      "cloud_storage_memory_read_max_bytes",
+      "Reads from tiered storage asking for at most this many bytes download "
+      "the byte range they start with directly into memory instead of "
+      "hydrating a chunk into the cloud storage cache. Reads that go past the "
+      "range continue from the cache. Set to 0 to disable.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_memory_read_cache_size(
+      *this,
+      "cloud_storage_memory_read_cache_size",
+      "Amount of memory per shard used to keep the byte ranges downloaded by "
+      "reads from tiered storage served from memory",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_MiB)
   , cloud_storage_cache_num_buckets(
       *this,
       "cloud_storage_cache_num_buckets",
@@ -2655,6 +3142,18 @@ configuration::configuration()
       "Update frequency for kafka queue depth control.",
       {.visibility = visibility::tunable},
       7s)
+  , kafka_produce_latency_target_ms(
+      *this,
+      "kafka_produce_latency_target_ms",
+      "Target for the p99 latency of produce requests on each shard. When "
+      "set, the I/O shares of fetches reading far behind the tip of a "
+      "partition are lowered as the produce latency gets close to the "
+      "target, and raised again while it is well under it. Null disables "
+      "the controller.",
+      {.needs_restart = needs_restart::yes,
+       .example = "50",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , zstd_decompress_workspace_bytes(
       *this,
       "zstd_decompress_workspace_bytes",
@@ -2667,6 +3166,22 @@ configuration::configuration()
       "Disable reusable preallocated buffers for LZ4 decompression",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       false)
+  , compression_offload_min_bytes(
+      *this,
+      "compression_offload_min_bytes",
+      "Payloads of at least this many bytes are compressed and decompressed "
+      "with zstd or gzip on a helper thread instead of the reactor. Null "
+      "disables the offload and the helper threads.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      std::nullopt)
+  , compression_offload_max_concurrency(
+      *this,
+      "compression_offload_max_concurrency",
+      "Maximum number of payloads each shard may have queued on its "
+      "compression helper thread at once",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      2,
+      {.min = 1})
   , full_raft_configuration_recovery_pattern(
       *this, "full_raft_configuration_recovery_pattern")
   , enable_auto_rebalance_on_node_add(
@@ -2796,6 +3311,14 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , leader_balancer_throughput_aware(
+      *this,
+      "leader_balancer_throughput_aware",
+      "If set to 'true', the random_hill_climbing leader balancer also spreads "
+      "the bytes produced and fetched per second by partition leaders evenly "
+      "across shards, in addition to the number of leaders.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , core_balancing_on_core_count_change(
       *this,
       "core_balancing_on_core_count_change",
@@ -2818,6 +3341,14 @@ configuration::configuration()
       "balancing.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , core_balancing_throughput_aware(
+      *this,
+      "core_balancing_throughput_aware",
+      "If set to 'true', Redpanda periodically moves a partition from the "
+      "shard with the highest produce and fetch throughput to the shard with "
+      "the lowest one when throughput across shards is unbalanced.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -3056,6 +3587,16 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt,
       {.min = 1})
+  , kafka_client_quota_max_lease_bytes(
+      *this,
+      "kafka_client_quota_max_lease_bytes",
+      "Maximum number of bytes a shard takes at once from the node wide "
+      "throughput quota of a client and records requests against, instead "
+      "of updating the quota on every request. Leases are also limited to "
+      "keep the bytes outstanding across shards within 10ms of the quota. 0 "
+      "updates the quota on every request.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , kafka_quota_balancer_window(
       *this,
       "kafka_quota_balancer_window_ms",
@@ -3132,6 +3673,16 @@ configuration::configuration()
       "controller snapshot, after a new controller command appears",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       60s)
+  , controller_snapshot_max_log_bytes(
+      *this,
+      "controller_snapshot_max_log_bytes",
+      "Size of the controller log written since the last controller snapshot "
+      "that triggers a new snapshot right away, without waiting for "
+      "controller_snapshot_max_age_sec. Keeps controller log replay at "
+      "startup bounded under heavy metadata churn. Null disables the size "
+      "trigger.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64_MiB)
   , legacy_permit_unsafe_log_operation(
       *this,
       "legacy_permit_unsafe_log_operation",
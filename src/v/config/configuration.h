@@ -68,6 +68,7 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> rpc_server_tcp_send_buf;
     bounded_property<int> rpc_client_connections_per_peer;
     property<bool> rpc_server_compress_replies;
+    property<bool> rpc_client_priority_connection;
     // Coproc
     deprecated_property enable_coproc;
     deprecated_property coproc_max_inflight_bytes;
@@ -80,6 +81,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> data_transforms_commit_interval_ms;
     bounded_property<size_t> data_transforms_per_core_memory_reservation;
     bounded_property<size_t> data_transforms_per_function_memory_limit;
+    property<bool> data_transforms_huge_pages;
     property<std::chrono::milliseconds> data_transforms_runtime_limit_ms;
     bounded_property<size_t> data_transforms_binary_max_size;
     bounded_property<size_t> data_transforms_logging_buffer_capacity_bytes;
@@ -110,11 +112,17 @@ struct configuration final : public config_store {
     bounded_property<std::optional<size_t>> raft_max_recovery_memory;
     bounded_property<size_t> raft_recovery_default_read_size;
     property<bool> raft_enable_lw_heartbeat;
+    property<bool> raft_enable_quiescence;
+    property<std::chrono::milliseconds> raft_quiescence_lease_ms;
+    property<bool> raft_enable_eager_commit_propagation;
+    property<bool> raft_enable_leader_lease;
+    enum_property<model::compression> raft_replication_compression;
     bounded_property<size_t> raft_recovery_concurrency_per_shard;
     property<std::optional<size_t>> raft_replica_max_pending_flush_bytes;
     property<std::chrono::milliseconds> raft_flush_timer_interval_ms;
     property<std::chrono::milliseconds> raft_replica_max_flush_delay_ms;
     property<bool> raft_enable_longest_log_detection;
+    property<size_t> raft_append_entries_batch_max_bytes;
     // Kafka
     property<bool> enable_usage;
     bounded_property<size_t> usage_num_windows;
@@ -135,6 +143,8 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> group_min_session_timeout_ms;
     property<std::chrono::milliseconds> group_max_session_timeout_ms;
     property<std::chrono::milliseconds> group_initial_rebalance_delay;
+    property<std::chrono::milliseconds> group_offset_commit_coalesce_ms;
+    property<std::chrono::milliseconds> group_offset_fetch_snapshot_ttl_ms;
     property<std::chrono::milliseconds> group_new_member_join_timeout;
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
@@ -152,6 +162,9 @@ struct configuration final : public config_store {
     deprecated_property rm_violation_recovery_policy;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
     enum_property<model::fetch_read_strategy> fetch_read_strategy;
+    property<bool> fetch_link_foreign_reads;
+    property<std::optional<int64_t>> fetch_catchup_read_min_lag;
+    property<std::chrono::milliseconds> fetch_response_cache_ttl_ms;
     property<std::chrono::milliseconds> alter_topic_cfg_timeout_ms;
     property<model::cleanup_policy_bitflags> log_cleanup_policy;
     enum_property<model::timestamp_type> log_message_timestamp_type;
@@ -180,6 +193,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> log_compaction_interval_ms;
     property<bool> log_disable_housekeeping_for_tests;
     property<bool> log_compaction_use_sliding_window;
+    bounded_property<size_t> log_compaction_rewrite_parallelism;
     // same as retention.size in kafka - TODO: size not implemented
     property<std::optional<size_t>> retention_bytes;
     property<int32_t> group_topic_partitions;
@@ -207,8 +221,13 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
+    property<std::chrono::milliseconds> raft_replicate_batch_max_flush_delay_ms;
     property<size_t> raft_learner_recovery_rate;
     property<bool> raft_recovery_throttle_disable_dynamic_mode;
+    property<std::vector<ss::sstring>> raft_recovery_priority_topics;
+    bounded_property<uint16_t> raft_recovery_priority_bandwidth_percent;
+    property<bool> raft_recovery_segment_transfer_enabled;
+    property<std::optional<size_t>> raft_recovery_cloud_storage_min_lag_bytes;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
     property<uint32_t> raft_max_concurrent_append_requests_per_follower;
     enum_property<model::write_caching_mode> write_caching_default;
@@ -222,6 +241,7 @@ struct configuration final : public config_store {
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
     property<size_t> kvstore_max_segment_size;
+    property<std::chrono::milliseconds> kvstore_consensus_flush_interval;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
     property<size_t> kafka_max_bytes_per_fetch;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
@@ -232,9 +252,14 @@ struct configuration final : public config_store {
     property<bool> release_cache_on_segment_roll;
     property<std::chrono::milliseconds> segment_appender_flush_timeout_ms;
     property<std::chrono::milliseconds> fetch_session_eviction_timeout_ms;
+    property<size_t> fetch_session_cache_max_bytes;
     bounded_property<size_t> append_chunk_size;
     property<size_t> storage_read_buffer_size;
+    property<std::optional<std::chrono::milliseconds>>
+      storage_scrub_interval_ms;
+    bounded_property<size_t> storage_scrub_bytes_per_sec;
     property<int16_t> storage_read_readahead_count;
+    property<size_t> storage_read_readahead_memory;
     property<size_t> segment_fallocation_step;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
@@ -242,6 +267,14 @@ struct configuration final : public config_store {
     bounded_property<uint64_t> storage_compaction_key_map_memory;
     bounded_property<double, numeric_bounds>
       storage_compaction_key_map_memory_limit_percent;
+    property<std::optional<size_t>> storage_segment_index_memory;
+    property<size_t> storage_segment_index_page_cache_memory;
+    property<size_t> storage_time_index_step_bytes;
+    bounded_property<uint32_t> storage_flush_coalesce_window_us;
+    property<size_t> storage_segment_pool_size;
+    property<std::optional<std::chrono::milliseconds>>
+      storage_cold_tier_segment_age_ms;
+    property<std::optional<size_t>> storage_hot_tier_partition_bytes;
     property<size_t> max_compacted_log_segment_size;
     property<std::optional<std::chrono::seconds>>
       storage_ignore_timestamps_in_future_sec;
@@ -252,6 +285,7 @@ struct configuration final : public config_store {
     deprecated_property tx_registry_log_capacity;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
+    bounded_property<int16_t> id_allocator_prefetch_size;
     property<bool> enable_sasl;
     property<std::vector<ss::sstring>> sasl_mechanisms;
     property<ss::sstring> sasl_kerberos_config;
@@ -269,6 +303,8 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
+    property<size_t> kafka_max_pipelined_requests_per_connection;
+    property<size_t> kafka_produce_recompression_max_bytes_per_sec;
     property<std::vector<ss::sstring>> kafka_nodelete_topics;
     property<std::vector<ss::sstring>> kafka_noproduce_topics;
 
@@ -291,6 +327,7 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_send_buf;
     bounded_property<std::optional<size_t>> kafka_rpc_server_stream_recv_buf;
+    bounded_property<uint32_t> kafka_rpc_server_cork_window_us;
     property<bool> kafka_enable_describe_log_dirs_remote_storage;
 
     // Audit logging
@@ -339,12 +376,17 @@ struct configuration final : public config_store {
       cloud_storage_garbage_collect_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_max_connection_idle_time_ms;
+    property<size_t> cloud_storage_warm_up_connections;
     property<std::optional<std::chrono::seconds>>
       cloud_storage_segment_max_upload_interval_sec;
+    property<std::optional<size_t>>
+      cloud_storage_segment_min_timeboxed_upload_size;
     property<std::optional<std::chrono::seconds>>
       cloud_storage_manifest_max_upload_interval_sec;
     property<std::chrono::milliseconds>
       cloud_storage_readreplica_manifest_sync_timeout_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      cloud_storage_readreplica_manifest_sync_max_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_metadata_sync_timeout_ms;
     property<std::chrono::milliseconds> cloud_storage_housekeeping_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_idle_timeout_ms;
@@ -370,6 +412,8 @@ struct configuration final : public config_store {
     property<bool> enable_cluster_metadata_upload_loop;
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
+    bounded_property<size_t>
+      cloud_storage_compacted_reupload_min_savings_percent;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
     // validation of topic manifest during recovery
     enum_property<model::recovery_validation_mode>
@@ -378,9 +422,14 @@ struct configuration final : public config_store {
 
     property<std::optional<size_t>> cloud_storage_segment_size_target;
     property<std::optional<size_t>> cloud_storage_segment_size_min;
+    property<std::optional<size_t>> cloud_storage_multipart_upload_threshold;
+    bounded_property<size_t> cloud_storage_multipart_upload_part_size;
+    property<uint16_t> cloud_storage_multipart_upload_concurrency;
     property<std::optional<size_t>> cloud_storage_max_throughput_per_shard;
     bounded_property<std::optional<size_t>>
       cloud_storage_throughput_limit_percent;
+    bounded_property<std::optional<size_t>>
+      cloud_storage_background_requests_per_sec;
     property<std::optional<std::chrono::milliseconds>>
       cloud_storage_graceful_transfer_timeout_ms;
     enum_property<model::cloud_storage_backend> cloud_storage_backend;
@@ -389,6 +438,7 @@ struct configuration final : public config_store {
       cloud_storage_spillover_manifest_size;
     property<std::optional<size_t>>
       cloud_storage_spillover_manifest_max_segments;
+    property<size_t> cloud_storage_spillover_manifest_prefetch_count;
     bounded_property<size_t> cloud_storage_manifest_cache_size;
     property<std::chrono::milliseconds> cloud_storage_manifest_cache_ttl_ms;
     property<std::chrono::milliseconds>
@@ -459,6 +509,10 @@ struct configuration final : public config_store {
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_chunk_hydration_max_parts;
+    property<size_t> cloud_storage_prefetch_max_bytes_in_flight;
+    property<size_t> cloud_storage_memory_read_max_bytes;
+    property<size_t> cloud_storage_memory_read_cache_size;
     bounded_property<uint32_t> cloud_storage_cache_num_buckets;
     bounded_property<std::optional<double>, numeric_bounds>
       cloud_storage_cache_trim_threshold_percent_size;
@@ -480,8 +534,12 @@ struct configuration final : public config_store {
     property<size_t> kafka_qdc_min_depth;
     property<size_t> kafka_qdc_max_depth;
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_produce_latency_target_ms;
     property<size_t> zstd_decompress_workspace_bytes;
     property<bool> lz4_decompress_reusable_buffers_disabled;
+    property<std::optional<size_t>> compression_offload_min_bytes;
+    bounded_property<size_t> compression_offload_max_concurrency;
     deprecated_property full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
 
@@ -504,10 +562,12 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    property<bool> leader_balancer_throughput_aware;
 
     property<bool> core_balancing_on_core_count_change;
     property<bool> core_balancing_continuous;
     property<std::chrono::milliseconds> core_balancing_debounce_timeout;
+    property<bool> core_balancing_throughput_aware;
 
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
@@ -563,6 +623,7 @@ struct configuration final : public config_store {
     property<bool> kafka_throughput_throttling_v2;
     bounded_property<std::optional<int64_t>>
       kafka_throughput_replenish_threshold;
+    property<uint64_t> kafka_client_quota_max_lease_bytes;
     bounded_property<std::chrono::milliseconds> kafka_quota_balancer_window;
     bounded_property<std::chrono::milliseconds>
       kafka_quota_balancer_node_period;
@@ -574,6 +635,7 @@ struct configuration final : public config_store {
     bounded_property<int64_t> node_isolation_heartbeat_timeout;
 
     property<std::chrono::seconds> controller_snapshot_max_age_sec;
+    property<std::optional<size_t>> controller_snapshot_max_log_bytes;
     // security controls
     property<bool> legacy_permit_unsafe_log_operation;
     property<std::chrono::seconds> legacy_unsafe_log_warning_interval_sec;
@@ -138,6 +138,16 @@ node_config::node_config() noexcept
       "`cloud_storage_enabled` is present",
       {.visibility = visibility::user},
       std::nullopt)
+  , cold_data_directory(
+      *this,
+      "cold_data_directory",
+      "Secondary directory, usually on a larger and slower volume, that "
+      "closed segments are moved to according to "
+      "`storage_cold_tier_segment_age_ms` and "
+      "`storage_hot_tier_partition_bytes`. The moved segments are reached "
+      "through symbolic links left in `data_directory`.",
+      {.visibility = visibility::user},
+      std::nullopt)
   , enable_central_config(*this, "enable_central_config")
   , crash_loop_limit(
       *this,
@@ -61,6 +61,7 @@ public:
 
     // Shadow indexing/S3 cache location
     property<std::optional<ss::sstring>> cloud_storage_cache_directory;
+    property<std::optional<ss::sstring>> cold_data_directory;
 
     deprecated_property enable_central_config;
 
@@ -114,6 +115,11 @@ public:
         return data_directory().path / "startup_log";
     }
 
+    // Precompiled WebAssembly modules for data transforms
+    std::filesystem::path wasm_compilation_cache_path() const {
+        return data_directory().path / "wasm_cache";
+    }
+
     /**
      * Return the configured cache path if set, otherwise a default
      * path within the data directory.
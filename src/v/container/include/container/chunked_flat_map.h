@@ -0,0 +1,404 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/vassert.h"
+#include "container/chunked_hash_map.h"
+#include "container/fragmented_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace detail {
+
+/// A probing group of the chunked_flat_map index. Each control byte holds
+/// either the low 7 bits of the hash of the entry in that slot or `empty`,
+/// so that a whole group is matched against a hash with two SSE2
+/// instructions.
+struct flat_map_group {
+    static constexpr size_t width = 16;
+    static constexpr uint8_t empty = 0x80;
+
+    flat_map_group() noexcept { ctrl.fill(empty); }
+
+    /// bit i is set if slot i may hold an entry with the given tag
+    uint32_t match(uint8_t tag) const noexcept {
+#if defined(__SSE2__)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data()));
+        return _mm_movemask_epi8(
+          _mm_cmpeq_epi8(c, _mm_set1_epi8(static_cast<char>(tag))));
+#else
+        uint32_t m = 0;
+        for (size_t i = 0; i < width; ++i) {
+            m |= static_cast<uint32_t>(ctrl[i] == tag) << i;
+        }
+        return m;
+#endif
+    }
+
+    /// bit i is set if slot i is empty
+    uint32_t match_empty() const noexcept {
+#if defined(__SSE2__)
+        // only `empty` has the high bit set
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data()));
+        return _mm_movemask_epi8(c);
+#else
+        return match(empty);
+#endif
+    }
+
+    std::array<uint8_t, width> ctrl;
+    // index of the entry in the dense value storage
+    std::array<uint32_t, width> slots;
+};
+
+} // namespace detail
+
+/**
+ * @brief An open addressing hash map whose storage is split in bounded
+ * fragments.
+ *
+ * Entries are kept densely in a chunked_vector, in insertion order as long as
+ * nothing is erased. A separate index of 7 bit hash tags and entry positions,
+ * also chunked, is probed linearly one group of 16 slots at a time with SIMD
+ * compares, in the style of Swiss tables. Erasing shifts the following
+ * entries of the probe sequence back rather than leaving tombstones, so
+ * lookups never slow down because of past deletions, and moves the last
+ * entry into the hole in the dense storage.
+ *
+ * Growing only rebuilds the index; entries are not moved.
+ *
+ * NB: References and iterators are not stable across insertions and
+ * deletions.
+ *
+ * Hashing follows chunked_hash_map, the hash is expected to be avalanching.
+ */
+template<
+  typename Key,
+  typename Value,
+  typename Hash = std::conditional_t<
+    detail::has_absl_hash<Key>,
+    detail::avalanching_absl_hash<Key>,
+    ankerl::unordered_dense::hash<Key>>,
+  typename EqualTo = std::equal_to<Key>>
+class chunked_flat_map {
+    using group = detail::flat_map_group;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = EqualTo;
+    using iterator = typename chunked_vector<value_type>::iterator;
+    using const_iterator = typename chunked_vector<value_type>::const_iterator;
+
+    chunked_flat_map() = default;
+    chunked_flat_map(const chunked_flat_map&) = delete;
+    chunked_flat_map& operator=(const chunked_flat_map&) = delete;
+    chunked_flat_map(chunked_flat_map&&) noexcept = default;
+    chunked_flat_map& operator=(chunked_flat_map&&) noexcept = default;
+    ~chunked_flat_map() = default;
+
+    iterator begin() { return _values.begin(); }
+    iterator end() { return _values.end(); }
+    const_iterator begin() const { return _values.begin(); }
+    const_iterator end() const { return _values.end(); }
+    const_iterator cbegin() const { return _values.cbegin(); }
+    const_iterator cend() const { return _values.cend(); }
+
+    bool empty() const noexcept { return _values.empty(); }
+    size_t size() const noexcept { return _values.size(); }
+
+    void clear() {
+        _values.clear();
+        _groups.clear();
+        _group_mask = 0;
+    }
+
+    void reserve(size_t n) {
+        _values.reserve(n);
+        auto groups = groups_for(n);
+        if (groups > _groups.size()) {
+            rehash(groups);
+        }
+    }
+
+    iterator find(const Key& key) {
+        auto p = find_position(key, _hash(key));
+        return p ? begin() + slot(*p) : end();
+    }
+
+    const_iterator find(const Key& key) const {
+        auto p = find_position(key, _hash(key));
+        return p ? begin() + slot(*p) : end();
+    }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    Value& at(const Key& key) {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("chunked_flat_map::at");
+        }
+        return it->second;
+    }
+
+    const Value& at(const Key& key) const {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("chunked_flat_map::at");
+        }
+        return it->second;
+    }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+    Value& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return do_try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return do_try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type v(std::forward<Args>(args)...);
+        return do_try_emplace(std::move(v.first), std::move(v.second));
+    }
+
+    std::pair<iterator, bool> insert(value_type v) {
+        return do_try_emplace(std::move(v.first), std::move(v.second));
+    }
+
+    size_t erase(const Key& key) {
+        auto p = find_position(key, _hash(key));
+        if (!p) {
+            return 0;
+        }
+        erase_at(*p);
+        return 1;
+    }
+
+    /// returns an iterator to the entry that took the place of the erased one
+    iterator erase(iterator it) {
+        const auto idx = it - begin();
+        auto p = find_position(it->first, _hash(it->first));
+        vassert(p.has_value(), "erasing an entry missing from the index");
+        erase_at(*p);
+        return begin() + idx;
+    }
+
+private:
+    // a slot of the index
+    struct position {
+        size_t group_idx;
+        size_t slot_idx;
+    };
+
+    // maximum load factor of the index, linear probing degrades quickly
+    // beyond it
+    static constexpr size_t max_load_num = 3;
+    static constexpr size_t max_load_den = 4;
+
+    static constexpr uint8_t tag_of(uint64_t h) noexcept {
+        return static_cast<uint8_t>(h & 0x7fU);
+    }
+
+    static size_t groups_for(size_t n) {
+        const auto slots = (n * max_load_den + max_load_num - 1)
+                           / max_load_num;
+        return std::bit_ceil(
+          std::max<size_t>(1, (slots + group::width - 1) / group::width));
+    }
+
+    size_t capacity() const noexcept { return _groups.size() * group::width; }
+
+    size_t home_slot(uint64_t h) const noexcept {
+        return (h >> 7U) & (capacity() - 1);
+    }
+
+    uint32_t& slot(position p) {
+        return _groups[p.group_idx].slots[p.slot_idx];
+    }
+    uint32_t slot(position p) const {
+        return _groups[p.group_idx].slots[p.slot_idx];
+    }
+
+    /*
+     * Scans the groups starting at the one holding the home slot of `h` and
+     * calls `f(group_index, group, mask)` where the mask excludes the slots
+     * of the home group that precede the home slot. Stops when `f` returns
+     * true. The load factor guarantees every walk reaches an empty slot.
+     */
+    template<typename Func>
+    void probe(uint64_t h, Func f) const {
+        const auto home = home_slot(h);
+        auto g = home / group::width;
+        uint32_t mask = ~((uint32_t{1} << (home % group::width)) - 1);
+        while (!f(g, _groups[g], mask)) {
+            mask = ~uint32_t{0};
+            g = (g + 1) & _group_mask;
+        }
+    }
+
+    std::optional<position> find_position(const Key& key, uint64_t h) const {
+        if (_groups.empty()) {
+            return std::nullopt;
+        }
+        std::optional<position> ret;
+        const auto tag = tag_of(h);
+        probe(h, [&](size_t g, const group& grp, uint32_t mask) {
+            for (auto m = grp.match(tag) & mask; m != 0; m &= m - 1) {
+                const auto i = static_cast<size_t>(std::countr_zero(m));
+                if (_eq(_values[grp.slots[i]].first, key)) {
+                    ret = position{g, i};
+                    return true;
+                }
+            }
+            return (grp.match_empty() & mask) != 0;
+        });
+        return ret;
+    }
+
+    // the index slot pointing at the entry with the given value index
+    position find_value_slot(uint32_t idx) const {
+        const auto h = _hash(_values[idx].first);
+        const auto tag = tag_of(h);
+        std::optional<position> ret;
+        probe(h, [&](size_t g, const group& grp, uint32_t mask) {
+            for (auto m = grp.match(tag) & mask; m != 0; m &= m - 1) {
+                const auto i = static_cast<size_t>(std::countr_zero(m));
+                if (grp.slots[i] == idx) {
+                    ret = position{g, i};
+                    return true;
+                }
+            }
+            return false;
+        });
+        return *ret;
+    }
+
+    void insert_index(uint64_t h, uint32_t idx) {
+        probe(h, [&](size_t g, const group&, uint32_t mask) {
+            auto& grp = _groups[g];
+            auto m = grp.match_empty() & mask;
+            if (m == 0) {
+                return false;
+            }
+            const auto i = static_cast<size_t>(std::countr_zero(m));
+            grp.ctrl[i] = tag_of(h);
+            grp.slots[i] = idx;
+            return true;
+        });
+    }
+
+    void rehash(size_t groups) {
+        chunked_vector<group> fresh;
+        fresh.reserve(groups);
+        for (size_t i = 0; i < groups; ++i) {
+            fresh.emplace_back();
+        }
+        _groups = std::move(fresh);
+        _group_mask = groups - 1;
+        for (size_t i = 0; i < _values.size(); ++i) {
+            insert_index(_hash(_values[i].first), static_cast<uint32_t>(i));
+        }
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> do_try_emplace(K&& key, Args&&... args) {
+        const auto h = _hash(key);
+        if (auto p = find_position(key, h); p) {
+            return {begin() + slot(*p), false};
+        }
+        vassert(
+          _values.size() < std::numeric_limits<uint32_t>::max(),
+          "chunked_flat_map is full");
+        if ((_values.size() + 1) * max_load_den > capacity() * max_load_num) {
+            rehash(_groups.empty() ? 1 : _groups.size() * 2);
+        }
+        const auto idx = static_cast<uint32_t>(_values.size());
+        _values.emplace_back(
+          std::piecewise_construct,
+          std::forward_as_tuple(std::forward<K>(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+        insert_index(h, idx);
+        return {begin() + idx, true};
+    }
+
+    /*
+     * Backward shift deletion: walk the probe sequence after the removed
+     * slot and move back every entry whose home slot is at or before the
+     * hole, until an empty slot is reached. This keeps the invariant that no
+     * empty slot separates an entry from its home slot.
+     */
+    void remove_from_index(position p) {
+        const auto mask = capacity() - 1;
+        auto ctrl = [this](size_t s) -> uint8_t& {
+            return _groups[s / group::width].ctrl[s % group::width];
+        };
+        auto index = [this](size_t s) -> uint32_t& {
+            return _groups[s / group::width].slots[s % group::width];
+        };
+        auto hole = p.group_idx * group::width + p.slot_idx;
+        for (auto j = (hole + 1) & mask; ctrl(j) != group::empty;
+             j = (j + 1) & mask) {
+            const auto home = home_slot(_hash(_values[index(j)].first));
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                ctrl(hole) = ctrl(j);
+                index(hole) = index(j);
+                hole = j;
+            }
+        }
+        ctrl(hole) = group::empty;
+    }
+
+    void erase_at(position p) {
+        const auto idx = slot(p);
+        remove_from_index(p);
+        const auto last = static_cast<uint32_t>(_values.size() - 1);
+        if (idx != last) {
+            // fill the hole in the dense storage with the last entry
+            auto last_slot = find_value_slot(last);
+            _values[idx] = std::move(_values[last]);
+            slot(last_slot) = idx;
+        }
+        _values.pop_back();
+    }
+
+    chunked_vector<value_type> _values;
+    chunked_vector<group> _groups;
+    size_t _group_mask{0};
+    [[no_unique_address]] Hash _hash;
+    [[no_unique_address]] EqualTo _eq;
+};
@@ -16,6 +16,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/util/later.hh>
 
+#include <algorithm>
 #include <bit>
 #include <climits>
 #include <compare>
@@ -133,10 +134,11 @@ public:
         if (this != &other) {
             this->_size = other._size;
             this->_capacity = other._capacity;
+            this->_head = other._head;
             this->_frags = std::move(other._frags);
             // Move compatibility with std::vector that post move
             // the vector is empty().
-            other._size = other._capacity = 0;
+            other._size = other._capacity = other._head = 0;
             other.update_generation();
             update_generation();
         }
@@ -151,6 +153,7 @@ public:
     void swap(fragmented_vector& other) noexcept {
         std::swap(_size, other._size);
         std::swap(_capacity, other._capacity);
+        std::swap(_head, other._head);
         std::swap(_frags, other._frags);
         other.update_generation();
         update_generation();
@@ -175,6 +178,10 @@ public:
 
     void pop_back() {
         vassert(_size > 0, "Cannot pop from empty container");
+        if (_size == 1) {
+            clear();
+            return;
+        }
         _frags.back().pop_back();
         --_size;
         if (_frags.back().empty()) {
@@ -211,29 +218,81 @@ public:
         update_generation();
     }
 
+    /**
+     * Removes the first n elements, like a deque. Fragments are released as
+     * soon as all of their elements are gone and the remaining elements are
+     * not moved, so the cost is independent of the number of elements left.
+     *
+     * Erased elements sharing a fragment with remaining ones are reset to a
+     * default constructed value if possible, their storage is only released
+     * with the fragment.
+     */
+    void pop_front_n(size_t n) {
+        vassert(
+          _size >= n, "Cannot pop more than size() elements in container");
+
+        if (_size == n) {
+            clear();
+            return;
+        }
+
+        _size -= n;
+        _head += n;
+
+        // all fragments but the last are full, and the last one still has
+        // elements
+        const auto released = _head / elems_per_frag;
+        if (released > 0) {
+            _frags.erase(_frags.begin(), _frags.begin() + released);
+            _head -= released * elems_per_frag;
+            _capacity -= released * elems_per_frag;
+        }
+
+        if constexpr (
+          !std::is_trivially_destructible_v<T>
+          && std::is_default_constructible_v<T>
+          && std::is_move_assignable_v<T>) {
+            auto& front = _frags.front();
+            for (size_t i = _head - std::min(_head, n); i < _head; ++i) {
+                front[i] = T{};
+            }
+        }
+        update_generation();
+    }
+
     const T& at(size_t index) const {
-        return _frags.at(index / elems_per_frag).at(index % elems_per_frag);
+        if (index >= _size) {
+            throw std::out_of_range("fragmented_vector::at");
+        }
+        index += _head;
+        return _frags[index / elems_per_frag][index % elems_per_frag];
     }
 
     T& at(size_t index) {
-        return _frags.at(index / elems_per_frag).at(index % elems_per_frag);
+        if (index >= _size) {
+            throw std::out_of_range("fragmented_vector::at");
+        }
+        index += _head;
+        return _frags[index / elems_per_frag][index % elems_per_frag];
     }
 
     const T& operator[](size_t index) const {
+        index += _head;
         return _frags[index / elems_per_frag][index % elems_per_frag];
     }
 
     T& operator[](size_t index) {
+        index += _head;
         return _frags[index / elems_per_frag][index % elems_per_frag];
     }
 
-    const T& front() const { return _frags.front().front(); }
+    const T& front() const { return _frags.front()[_head]; }
     const T& back() const { return _frags.back().back(); }
-    T& front() { return _frags.front().front(); }
+    T& front() { return _frags.front()[_head]; }
     T& back() { return _frags.back().back(); }
     bool empty() const noexcept { return _size == 0; }
     size_t size() const noexcept { return _size; }
-    size_t capacity() const noexcept { return _capacity; }
+    size_t capacity() const noexcept { return _capacity - _head; }
 
     /**
      * Requests the removal of unused capacity.
@@ -274,6 +333,8 @@ public:
         // For fixed size fragments we noop, as we already reserve the full size
         // of vector
         if constexpr (is_chunked_vector) {
+            // slots of elements popped from the front stay allocated
+            new_cap += _head;
             if (new_cap > _capacity) {
                 if (_frags.empty()) {
                     auto& frag = _frags.emplace_back();
@@ -296,7 +357,10 @@ public:
     }
 
     bool operator==(const fragmented_vector& o) const noexcept {
-        return o._frags == _frags;
+        if (_head == 0 && o._head == 0) {
+            return o._frags == _frags;
+        }
+        return _size == o._size && std::equal(begin(), end(), o.begin());
     }
 
     /**
@@ -324,6 +388,7 @@ public:
         std::vector<std::vector<T>>{}.swap(_frags);
         _size = 0;
         _capacity = 0;
+        _head = 0;
         update_generation();
     }
 
@@ -490,7 +555,7 @@ public:
 
 private:
     [[gnu::always_inline]] void maybe_add_capacity() {
-        if (_size == _capacity) [[unlikely]] {
+        if (_head + _size == _capacity) [[unlikely]] {
             add_capacity();
         }
     }
@@ -537,6 +602,8 @@ private:
 
     size_t _size{0};
     size_t _capacity{0};
+    // elements popped from the front of the first fragment
+    size_t _head{0};
     backing_type _frags;
 #ifndef NDEBUG
     // Add a generation number that is incremented on every mutation to catch
@@ -580,13 +647,15 @@ template<typename T, size_t S>
 inline seastar::future<>
 fragmented_vector_fill_async(fragmented_vector<T, S>& vec, const T& value) {
     auto remaining = vec._size;
+    auto skip = vec._head;
     for (auto& frag : vec._frags) {
-        const auto n = std::min(frag.size(), remaining);
+        const auto n = std::min(frag.size() - skip, remaining);
         if (n == 0) {
             break;
         }
-        std::fill_n(frag.begin(), n, value);
+        std::fill_n(frag.begin() + skip, n, value);
         remaining -= n;
+        skip = 0;
         if (seastar::need_preempt()) {
             co_await seastar::yield();
         }
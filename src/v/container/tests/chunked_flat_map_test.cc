@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "container/chunked_flat_map.h"
+#include "random/generators.h"
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+namespace {
+
+// forces long probe sequences and shared tags
+struct colliding_hash {
+    uint64_t operator()(uint64_t x) const { return ((x % 7) << 7U) | 1U; }
+};
+
+template<typename Map>
+void check_against_reference(Map& map, size_t key_range, size_t ops) {
+    std::unordered_map<uint64_t, uint64_t> ref;
+    for (size_t i = 0; i < ops; ++i) {
+        auto key = random_generators::get_int<uint64_t>(key_range);
+        switch (random_generators::get_int(2)) {
+        case 0:
+            map[key] = i;
+            ref[key] = i;
+            break;
+        case 1:
+            ASSERT_EQ(map.erase(key), ref.erase(key));
+            break;
+        default: {
+            auto it = map.find(key);
+            auto ref_it = ref.find(key);
+            ASSERT_EQ(it == map.end(), ref_it == ref.end());
+            if (it != map.end()) {
+                ASSERT_EQ(it->second, ref_it->second);
+            }
+        }
+        }
+        ASSERT_EQ(map.size(), ref.size());
+    }
+    for (const auto& [k, v] : map) {
+        ASSERT_EQ(ref.at(k), v);
+    }
+}
+
+} // namespace
+
+TEST(chunked_flat_map, basic) {
+    chunked_flat_map<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.emplace(1, "one").second);
+    EXPECT_FALSE(map.emplace(1, "uno").second);
+    map[2] = "two";
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_EQ(map.find(2)->second, "two");
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_FALSE(map.contains(3));
+    EXPECT_THROW(map.at(3), std::out_of_range);
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.erase(1), 0);
+    EXPECT_EQ(map.size(), 1);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(2), map.end());
+}
+
+TEST(chunked_flat_map, insertion_order_iteration) {
+    chunked_flat_map<int, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map.emplace(i * 31, i);
+    }
+    int expected = 0;
+    for (const auto& [k, v] : map) {
+        EXPECT_EQ(k, expected * 31);
+        EXPECT_EQ(v, expected++);
+    }
+}
+
+TEST(chunked_flat_map, erase_iterator) {
+    chunked_flat_map<int, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map.emplace(i, i);
+    }
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 2 == 0) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(map.size(), 500);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(map.contains(i), i % 2 == 1);
+    }
+}
+
+TEST(chunked_flat_map, reserve) {
+    chunked_flat_map<int, int> map;
+    map.reserve(10000);
+    for (int i = 0; i < 10000; ++i) {
+        map.emplace(i, i);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        EXPECT_EQ(map.at(i), i);
+    }
+}
+
+TEST(chunked_flat_map, randomized) {
+    chunked_flat_map<uint64_t, uint64_t> small;
+    check_against_reference(small, 1000, 200000);
+    chunked_flat_map<uint64_t, uint64_t> large;
+    check_against_reference(large, 1000000, 200000);
+}
+
+TEST(chunked_flat_map, randomized_colliding) {
+    chunked_flat_map<uint64_t, uint64_t, colliding_hash> map;
+    check_against_reference(map, 3000, 100000);
+}
+
+TEST(chunked_flat_map, move_assignment) {
+    chunked_flat_map<int, int> map;
+    map[1] = 2;
+    chunked_flat_map<int, int> other;
+    other = std::move(map);
+    EXPECT_EQ(other.at(1), 2);
+}
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <initializer_list>
 #include <limits>
 #include <memory>
@@ -76,11 +77,16 @@ public:
             }
         }
 
-        if (calc_size != v.size()) {
+        if (v._head >= v.elems_per_frag) {
             return AssertionFailure() << fmt::format(
-                     "calculated size is wrong ({} != {})",
+                     "a whole fragment was not released (head {})", v._head);
+        }
+        if (calc_size != v.size() + v._head) {
+            return AssertionFailure() << fmt::format(
+                     "calculated size is wrong ({} != {} + {})",
                      calc_size,
-                     v.size());
+                     v.size(),
+                     v._head);
         }
         if (calc_cap != v._capacity) {
             return AssertionFailure() << fmt::format(
@@ -430,6 +436,55 @@ TEST(Vector, EraseToEnd) {
     EXPECT_THAT(v, ElementsAre(0));
 }
 
+TEST(Vector, PopFrontN) {
+    // small fragment size to stress multiple fragments
+    fragmented_vector<int, 4 * sizeof(int)> v;
+    std::deque<int> shadow;
+    for (int i = 0; i < 1000; ++i) {
+        switch (random_generators::get_int(3)) {
+        case 0:
+        case 1:
+            v.push_back(i);
+            shadow.push_back(i);
+            break;
+        case 2: {
+            auto n = random_generators::get_int(v.size());
+            v.pop_front_n(n);
+            shadow.erase(shadow.begin(), shadow.begin() + n);
+            break;
+        }
+        case 3:
+            if (!v.empty()) {
+                v.pop_back();
+                shadow.pop_back();
+            }
+            break;
+        }
+        ASSERT_THAT(v, IsValid());
+        ASSERT_THAT(v, ElementsAreArray(shadow));
+        if (!v.empty()) {
+            ASSERT_EQ(v.front(), shadow.front());
+            ASSERT_EQ(v.at(0), shadow.front());
+        }
+    }
+    EXPECT_THROW(v.at(v.size()), std::out_of_range);
+}
+
+TEST(Vector, PopFrontNReleasesFragments) {
+    fragmented_vector<int, 4 * sizeof(int)> v;
+    for (int i = 0; i < 16; ++i) {
+        v.push_back(i);
+    }
+    const auto before = v.memory_size();
+    v.pop_front_n(9);
+    EXPECT_THAT(v, IsValid());
+    EXPECT_THAT(v, ElementsAre(9, 10, 11, 12, 13, 14, 15));
+    // two of the four fragments are gone
+    EXPECT_LT(v.memory_size(), before);
+    auto other = v.copy();
+    EXPECT_EQ(other, v);
+}
+
 TEST(Vector, FromIterRangeConstructor) {
     std::vector<int> vals{1, 2, 3};
 
@@ -506,6 +561,26 @@ TEST(ChunkedVector, PushPopN) {
     }
 }
 
+TEST(ChunkedVector, PushPopFrontN) {
+    for (int i = 0; i < 10; ++i) {
+        chunked_vector<int32_t> vec;
+        std::deque<int32_t> shadow;
+        for (size_t i = 0; i < vec.elements_per_fragment() * 3; ++i) {
+            if (random_generators::get_int(8) == 0) {
+                auto n = random_generators::get_int(vec.size());
+                vec.pop_front_n(n);
+                shadow.erase(shadow.begin(), shadow.begin() + n);
+            } else {
+                vec.push_back(i);
+                shadow.push_back(i);
+            }
+            ASSERT_TRUE(fragmented_vector_validator::validate(vec));
+        }
+        EXPECT_TRUE(std::equal(
+          vec.begin(), vec.end(), shadow.begin(), shadow.end()));
+    }
+}
+
 TEST(ChunkedVector, FirstChunkCapacityDoubles) {
     chunked_vector<int32_t> vec;
     for (size_t i = 0; i < vec.elements_per_fragment(); ++i) {
@@ -17,6 +17,7 @@
 #include <seastar/testing/perf_tests.hh>
 
 #include <algorithm>
+#include <deque>
 #include <iterator>
 #include <vector>
 
@@ -144,3 +145,45 @@ VECTOR_PERF_TEST(chunked_vector, large_struct, 10000)
 VECTOR_PERF_TEST(std_vector, int64_t, 1048576)
 VECTOR_PERF_TEST(fragmented_vector, int64_t, 1048576)
 VECTOR_PERF_TEST(chunked_vector, int64_t, 1048576)
+
+/*
+ * Prefix truncation, e.g. dropping the oldest entries of an index: fill the
+ * container then drop the front in steps until it is empty.
+ */
+template<typename Vector, typename EraseFront>
+size_t prefix_erase_test(size_t size, size_t step, EraseFront erase_front) {
+    Vector v;
+    for (size_t i = 0; i < size; ++i) {
+        v.push_back(static_cast<int64_t>(i));
+    }
+    perf_tests::start_measuring_time();
+    while (!v.empty()) {
+        erase_front(v, std::min(step, v.size()));
+    }
+    perf_tests::stop_measuring_time();
+    return size / step;
+}
+
+PERF_TEST(PrefixErase, std_vector_int64_t_100000) {
+    return prefix_erase_test<std::vector<int64_t>>(
+      100000, 100, [](auto& v, size_t n) {
+          v.erase(v.begin(), v.begin() + static_cast<ssize_t>(n));
+      });
+}
+
+PERF_TEST(PrefixErase, std_deque_int64_t_100000) {
+    return prefix_erase_test<std::deque<int64_t>>(
+      100000, 100, [](auto& v, size_t n) {
+          v.erase(v.begin(), v.begin() + static_cast<ssize_t>(n));
+      });
+}
+
+PERF_TEST(PrefixErase, fragmented_vector_int64_t_100000) {
+    return prefix_erase_test<fragmented_vector<int64_t>>(
+      100000, 100, [](auto& v, size_t n) { v.pop_front_n(n); });
+}
+
+PERF_TEST(PrefixErase, chunked_vector_int64_t_100000) {
+    return prefix_erase_test<chunked_vector<int64_t>>(
+      100000, 100, [](auto& v, size_t n) { v.pop_front_n(n); });
+}
@@ -112,6 +112,16 @@ std::string_view to_string_view(feature f) {
         return "transforms_specify_offset";
     case feature::remote_labels:
         return "remote_labels";
+    case feature::raft_append_entries_batch:
+        return "raft_append_entries_batch";
+    case feature::raft_segment_transfer_recovery:
+        return "raft_segment_transfer_recovery";
+    case feature::raft_leader_lease:
+        return "raft_leader_lease";
+    case feature::tx_end_batch:
+        return "tx_end_batch";
+    case feature::rpc_lz4_compression:
+        return "rpc_lz4_compression";
 
     /*
      * testing features
@@ -164,7 +174,7 @@ std::string_view to_string_view(feature_state::state s) {
 // bumps, this is _not_ the intended usage, as stable branches are
 // meant to be safely downgradable within the branch, and new features
 // imply that new data formats may be written.
-static constexpr cluster_version latest_version = cluster_version{13};
+static constexpr cluster_version latest_version = cluster_version{14};
 
 // The earliest version we can upgrade from.  This is the version that
 // a freshly initialized node will start at: e.g. a 23.1 Redpanda joining
@@ -80,6 +80,11 @@ enum class feature : std::uint64_t {
     group_tx_fence_dedicated_batch_type = 1ULL << 49U,
     transforms_specify_offset = 1ULL << 50U,
     remote_labels = 1ULL << 51U,
+    raft_append_entries_batch = 1ULL << 52U,
+    raft_segment_transfer_recovery = 1ULL << 53U,
+    raft_leader_lease = 1ULL << 54U,
+    tx_end_batch = 1ULL << 55U,
+    rpc_lz4_compression = 1ULL << 56U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -416,6 +421,36 @@ constexpr static std::array feature_schema{
     feature::remote_labels,
     feature_spec::available_policy::always,
     feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{14},
+    "raft_append_entries_batch",
+    feature::raft_append_entries_batch,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{14},
+    "raft_segment_transfer_recovery",
+    feature::raft_segment_transfer_recovery,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{14},
+    "raft_leader_lease",
+    feature::raft_leader_lease,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{14},
+    "tx_end_batch",
+    feature::tx_end_batch,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{14},
+    "rpc_lz4_compression",
+    feature::rpc_lz4_compression,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
 };
 
 std::string_view to_string_view(feature);
@@ -14,6 +14,8 @@
 
 #include <crc32c/crc32c.h>
 
+#include <array>
+#include <cstring>
 #include <type_traits>
 
 namespace crc {
@@ -43,11 +45,33 @@ private:
 
 } // namespace crc
 
+/// The hardware accelerated paths of ::crc32c::Extend interleave three
+/// independent streams and fold them together, but only for inputs of at
+/// least a few hundred bytes; shorter inputs go through a latency bound
+/// serial loop. Runs of small fragments are gathered into a stack buffer so
+/// they take the interleaved path as well.
 inline void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf) {
-    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
-    (void)in.consume(buf.size_bytes(), [&crc](const char* src, size_t sz) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), sz);
-        return ss::stop_iteration::no;
-    });
+    static constexpr size_t gather_size = 4096;
+    static constexpr size_t small_fragment_size = 1024;
+    std::array<char, gather_size> gather; // NOLINT
+    size_t gathered = 0;
+    auto flush = [&] {
+        if (gathered > 0) {
+            crc.extend(gather.data(), gathered);
+            gathered = 0;
+        }
+    };
+    for (const auto& f : buf) {
+        if (f.size() >= small_fragment_size) {
+            flush();
+            crc.extend(f.get(), f.size());
+            continue;
+        }
+        if (gathered + f.size() > gather_size) {
+            flush();
+        }
+        std::memcpy(gather.data() + gathered, f.get(), f.size());
+        gathered += f.size();
+    }
+    flush();
 }
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/vassert.h"
 #include "hashing/crc32c.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
@@ -254,3 +255,73 @@ PERF_TEST(ntp_hash, absl_hash_of) {
 PERF_TEST(ntp_hash, absl_hash_value) {
     return ntp_body([](const ntp& v) { return absl::Hash<ntp>{}(v); });
 }
+
+namespace {
+
+// the shape of a produced batch body: many small records appended as
+// separate fragments, or one large contiguous fragment
+iobuf make_records(size_t count, size_t size) {
+    iobuf buf;
+    for (size_t i = 0; i < count; ++i) {
+        iobuf record;
+        auto data = random_generators::gen_alphanum_string(size);
+        record.append(data.data(), data.size());
+        buf.append_fragments(std::move(record));
+    }
+    return buf;
+}
+
+// checksums every fragment on its own, as crc_extend_iobuf used to
+uint32_t crc_per_fragment(const iobuf& buf) {
+    crc::crc32c crc;
+    for (const auto& f : buf) {
+        crc.extend(f.get(), f.size());
+    }
+    return crc.value();
+}
+
+uint32_t crc_iobuf(const iobuf& buf) {
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, buf);
+    return crc.value();
+}
+
+template<typename F>
+size_t iobuf_crc_body(size_t count, size_t size, F f) {
+    auto buf = make_records(count, size);
+    vassert(
+      crc_per_fragment(buf) == crc_iobuf(buf), "crc32c mismatch over iobuf");
+    perf_tests::start_measuring_time();
+    for (auto i = inner_iters; i--;) {
+        auto s = f(buf);
+        perf_tests::do_not_optimize(s);
+    }
+    perf_tests::stop_measuring_time();
+    return inner_iters * buf.size_bytes();
+}
+
+} // namespace
+
+PERF_TEST(iobuf_crc32c, per_fragment_1000x64) {
+    return iobuf_crc_body(1000, 64, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc32c, gathered_1000x64) {
+    return iobuf_crc_body(1000, 64, crc_iobuf);
+}
+
+PERF_TEST(iobuf_crc32c, per_fragment_100x512) {
+    return iobuf_crc_body(100, 512, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc32c, gathered_100x512) {
+    return iobuf_crc_body(100, 512, crc_iobuf);
+}
+
+PERF_TEST(iobuf_crc32c, per_fragment_1x65536) {
+    return iobuf_crc_body(1, 65536, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc32c, gathered_1x65536) {
+    return iobuf_crc_body(1, 65536, crc_iobuf);
+}
@@ -26,11 +26,19 @@ namespace http {
 void chunked_encoder::append_chunk_body(
   iobuf& seq, ss::temporary_buffer<char>&& payload) {
     size_t sz = payload.size();
-    boost::beast::http::chunk_header header(sz);
+    append_chunk_header(seq, sz);
+    seq.append(std::move(payload));
+    append_chunk_crlf(seq);
+}
+
+void chunked_encoder::append_chunk_header(iobuf& seq, size_t size) {
+    boost::beast::http::chunk_header header(size);
     for (const auto& buf : header) {
         seq.append(static_cast<const uint8_t*>(buf.data()), buf.size());
     }
-    seq.append(std::move(payload));
+}
+
+void chunked_encoder::append_chunk_crlf(iobuf& seq) {
     boost::beast::http::chunk_crlf crlf;
     for (const auto& buf : crlf) {
         seq.append(static_cast<const uint8_t*>(buf.data()), buf.size());
@@ -64,10 +72,16 @@ iobuf chunked_encoder::encode(iobuf&& inp) {
     if (_bypass) {
         return std::move(inp);
     }
+    // Consecutive fragments are shared into chunks of up to max_chunk_size
+    // rather than framing every fragment on its own, which would add a chunk
+    // header and trailer for each of the small fragments of a body.
     iobuf out;
-    for (auto& frag : inp) {
-        auto tmp = frag.share();
-        encode_impl(out, std::move(tmp));
+    while (!inp.empty()) {
+        auto sz = std::min(_max_chunk_size, inp.size_bytes());
+        append_chunk_header(out, sz);
+        out.append(inp.share(0, sz));
+        inp.trim_front(sz);
+        append_chunk_crlf(out);
     }
     return out;
 }
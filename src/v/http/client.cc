@@ -184,6 +184,9 @@ ss::future<reconnect_result_t> client::get_connected(
             // this loop with the `stop` call.
             ss::gate::holder gg(_connect_gate);
             co_await connect(current + interval);
+            // The idle time of a new connection is counted from the moment
+            // it was established so it can be reused by the next request.
+            _last_response = ss::lowres_clock::now();
             break;
         } catch (const std::system_error& err) {
             vlog(ctxlog.trace, "connection refused {}", err);
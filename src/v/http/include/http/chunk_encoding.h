@@ -53,6 +53,8 @@ private:
     ///     - crlf
     static void
     append_chunk_body(iobuf& seq, ss::temporary_buffer<char>&& payload);
+    static void append_chunk_header(iobuf& seq, size_t size);
+    static void append_chunk_crlf(iobuf& seq);
 
     void encode_impl(iobuf& seq, ss::temporary_buffer<char>&& buf) const;
 
@@ -259,7 +259,7 @@ private:
     const ss::abort_source* _as;
     ss::shared_ptr<http::client_probe> _probe;
     // Stores point in time when the last response was received
-    // from the server.
+    // from the server, or when the connection was established.
     ss::lowres_clock::time_point _last_response{
       ss::lowres_clock::time_point::min()};
     ss::lowres_clock::duration _max_idle_time;
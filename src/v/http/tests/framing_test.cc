@@ -22,6 +22,7 @@
 #include <optional>
 #include <random>
 #include <sstream>
+#include <vector>
 
 #define REQUIRE_CRLF(exp)                                                      \
     BOOST_REQUIRE_EQUAL((exp)[0], '\r');                                       \
@@ -142,6 +143,22 @@ SEASTAR_THREAD_TEST_CASE(test_chunked_encoding_empty_fragm) {
     test_chunked_encoding_fragmentation({{0x40, 0x0, 0x20}, 0x100});
 }
 
+SEASTAR_THREAD_TEST_CASE(test_chunked_encoding_coalesces_fragments) {
+    fragmented_test_data_generator gen;
+    http::chunked_encoder encoder(false, 0x300);
+    iobuf inp = gen.generate_fragmented({0x100, 0x100, 0x100, 0x80});
+    iobuf out;
+    out.append(encoder.encode(std::move(inp)));
+    out.append(encoder.encode_eof());
+
+    std::vector<size_t> chunk_sizes;
+    chunk_decoder decoder(out);
+    while (auto it = decoder.get_next()) {
+        chunk_sizes.push_back(it->size_bytes());
+    }
+    BOOST_REQUIRE(chunk_sizes == (std::vector<size_t>{0x300, 0x80}));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_chunked_bypass) {
     fragmented_test_data_generator gen;
     http::chunked_encoder encoder(true, 1000);
@@ -0,0 +1,171 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "iceberg/commit_coordinator.h"
+
+#include "base/vlog.h"
+#include "iceberg/logger.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/loop.hh>
+#include <seastar/coroutine/as_future.hh>
+
+#include <absl/strings/numbers.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace iceberg {
+
+namespace {
+constexpr std::string_view offset_property_prefix = "redpanda.offset.";
+} // namespace
+
+std::map<std::string, std::string> table_commit::summary_properties() const {
+    std::map<std::string, std::string> props;
+    for (const auto& [partition, offset] : offsets) {
+        props.emplace(
+          fmt::format("{}{}", offset_property_prefix, partition()),
+          fmt::format("{}", offset()));
+    }
+    return props;
+}
+
+partition_offsets
+parse_partition_offsets(const std::map<std::string, std::string>& props) {
+    partition_offsets offsets;
+    for (const auto& [key, value] : props) {
+        std::string_view k = key;
+        if (!k.starts_with(offset_property_prefix)) {
+            continue;
+        }
+        k.remove_prefix(offset_property_prefix.size());
+        model::partition_id::type partition{};
+        kafka::offset::type offset{};
+        if (
+          !absl::SimpleAtoi(k, &partition)
+          || !absl::SimpleAtoi(value, &offset)) {
+            throw std::invalid_argument(fmt::format(
+              "invalid partition offset property: {}={}", key, value));
+        }
+        offsets.emplace(model::partition_id(partition), kafka::offset(offset));
+    }
+    return offsets;
+}
+
+template<typename ClockType>
+commit_coordinator<ClockType>::commit_coordinator(
+  config::binding<std::chrono::milliseconds> commit_interval,
+  std::unique_ptr<table_committer> committer)
+  : _committer(std::move(committer))
+  , _commit_interval(std::move(commit_interval))
+  , _timer(
+      [this] { ssx::spawn_with_gate(_gate, [this] { return flush(); }); }) {}
+
+template<typename ClockType>
+ss::future<> commit_coordinator<ClockType>::start() {
+    return ss::now();
+}
+
+template<typename ClockType>
+ss::future<> commit_coordinator<ClockType>::stop() {
+    _timer.cancel();
+    co_await _gate.close();
+    // Give pending files one last chance to be committed, anything that fails
+    // now is retranslated from the offsets in the last snapshot.
+    co_await flush();
+}
+
+template<typename ClockType>
+void commit_coordinator<ClockType>::add(
+  const model::topic& topic, partition_data_files data) {
+    table_commit commit;
+    commit.files = std::move(data.files);
+    commit.offsets.emplace(data.partition, data.last_offset);
+    merge(topic, std::move(commit));
+    if (!_timer.armed() && !_gate.is_closed()) {
+        _timer.arm(_commit_interval());
+    }
+}
+
+template<typename ClockType>
+void commit_coordinator<ClockType>::merge(
+  const model::topic& topic, table_commit commit) {
+    auto& pending = _pending[topic];
+    std::move(
+      commit.files.begin(),
+      commit.files.end(),
+      std::back_inserter(pending.files));
+    for (const auto& [partition, offset] : commit.offsets) {
+        auto [it, inserted] = pending.offsets.try_emplace(partition, offset);
+        if (!inserted) {
+            it->second = std::max(it->second, offset);
+        }
+    }
+}
+
+template<typename ClockType>
+size_t commit_coordinator<ClockType>::pending_files() const {
+    size_t count = 0;
+    for (const auto& [_, commit] : _pending) {
+        count += commit.files.size();
+    }
+    return count;
+}
+
+template<typename ClockType>
+ss::future<> commit_coordinator<ClockType>::flush() {
+    // Serialize flushes so that there is only ever one commit in flight for a
+    // topic, otherwise a retried commit could race with a newer one.
+    auto units = co_await _flush_mutex.get_units();
+    absl::btree_map<model::topic, table_commit> pending;
+    _pending.swap(pending);
+    constexpr static size_t max_concurrent_commits = 10;
+    co_await ss::max_concurrent_for_each(
+      std::make_move_iterator(pending.begin()),
+      std::make_move_iterator(pending.end()),
+      max_concurrent_commits,
+      [this](auto entry) {
+          return do_commit(entry.first, std::move(entry.second));
+      });
+}
+
+template<typename ClockType>
+ss::future<> commit_coordinator<ClockType>::do_commit(
+  model::topic topic, table_commit commit) {
+    auto fut = co_await ss::coroutine::as_future(
+      _committer->commit(topic, commit));
+    if (!fut.failed()) {
+        vlog(
+          iceberg_log.debug,
+          "committed {} data files to {} for {} partitions",
+          commit.files.size(),
+          topic,
+          commit.offsets.size());
+        co_return;
+    }
+    vlog(
+      iceberg_log.warn,
+      "unable to commit {} data files to {}, retrying in the next commit: {}",
+      commit.files.size(),
+      topic,
+      fut.get_exception());
+    merge(topic, std::move(commit));
+    if (!_timer.armed() && !_gate.is_closed()) {
+        _timer.arm(_commit_interval());
+    }
+}
+
+template class commit_coordinator<ss::lowres_clock>;
+template class commit_coordinator<ss::manual_clock>;
+
+} // namespace iceberg
@@ -0,0 +1,141 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#pragma once
+
+#include "config/property.h"
+#include "container/fragmented_vector.h"
+#include "iceberg/manifest_entry.h"
+#include "model/fundamental.h"
+#include "utils/mutex.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/manual_clock.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/btree_map.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace iceberg {
+
+/**
+ * Data files written for a partition of a topic, which cover the partition's
+ * log up to and including `last_offset`.
+ */
+struct partition_data_files {
+    model::partition_id partition;
+    kafka::offset last_offset;
+    chunked_vector<manifest_entry> files;
+};
+
+using partition_offsets = absl::btree_map<model::partition_id, kafka::offset>;
+
+/**
+ * A single atomic commit of data files from any number of partitions of a
+ * topic's table.
+ */
+struct table_commit {
+    chunked_vector<manifest_entry> files;
+    // The last offset covered for each partition in the commit.
+    partition_offsets offsets;
+
+    // Properties for the snapshot summary of the commit, which record the
+    // offsets in the table itself so that translation can resume exactly once
+    // after a failure, without a separate offset store.
+    std::map<std::string, std::string> summary_properties() const;
+};
+
+/**
+ * Parse the partition offsets out of the properties of a snapshot summary
+ * written by table_commit::summary_properties, other properties are ignored.
+ */
+partition_offsets
+parse_partition_offsets(const std::map<std::string, std::string>& props);
+
+/**
+ * Writes the manifests and table metadata for a commit to a topic's table.
+ */
+class table_committer {
+public:
+    table_committer() = default;
+    table_committer(const table_committer&) = default;
+    table_committer(table_committer&&) = default;
+    table_committer& operator=(const table_committer&) = default;
+    table_committer& operator=(table_committer&&) = default;
+    virtual ~table_committer() = default;
+
+    /**
+     * Atomically commit a snapshot of the table with the given files.
+     *
+     * Failures are reported by returning an exceptional future, in which case
+     * none of the commit must be visible.
+     */
+    virtual ss::future<> commit(const model::topic&, const table_commit&) = 0;
+};
+
+/**
+ * Batches commits of data files for each topic.
+ *
+ * Committing each partition's data files separately creates a snapshot per
+ * partition per interval, which grows the table metadata quickly and makes
+ * the committers of a topic contend on the catalog. Instead data files are
+ * gathered from all partitions over a fixed interval and committed as a single
+ * snapshot per topic.
+ *
+ * Commits for a topic are never concurrent, and a failed commit is merged into
+ * the next one so that no data files are lost.
+ */
+template<typename ClockType = ss::lowres_clock>
+class commit_coordinator {
+    static_assert(
+      std::is_same_v<ClockType, ss::lowres_clock>
+        || std::is_same_v<ClockType, ss::manual_clock>,
+      "Only lowres or manual clocks are supported");
+
+public:
+    commit_coordinator(
+      config::binding<std::chrono::milliseconds> commit_interval,
+      std::unique_ptr<table_committer>);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /**
+     * Add data files for a partition of a topic to the next commit.
+     */
+    void add(const model::topic&, partition_data_files);
+
+    /**
+     * Commit all of the pending data files.
+     */
+    ss::future<> flush();
+
+    /**
+     * The number of data files waiting to be committed.
+     */
+    size_t pending_files() const;
+
+private:
+    void merge(const model::topic&, table_commit);
+    ss::future<> do_commit(model::topic, table_commit);
+
+    absl::btree_map<model::topic, table_commit> _pending;
+    std::unique_ptr<table_committer> _committer;
+    config::binding<std::chrono::milliseconds> _commit_interval;
+    ss::timer<ClockType> _timer;
+    mutex _flush_mutex{"iceberg/commit_coordinator"};
+    ss::gate _gate;
+};
+
+} // namespace iceberg
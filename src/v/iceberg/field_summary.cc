@@ -0,0 +1,155 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "iceberg/field_summary.h"
+
+#include <seastar/core/byteorder.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <variant>
+
+namespace iceberg {
+
+namespace {
+
+// Numbers are serialized as fixed width little-endian values.
+template<typename T>
+T read_le(const primitive_type& type, bytes_view v) {
+    if (v.size() != sizeof(T)) {
+        throw std::invalid_argument(fmt::format(
+          "Invalid size {} for serialized value of type {}, expected {}",
+          v.size(),
+          type.index(),
+          sizeof(T)));
+    }
+    T value;
+    std::memcpy(&value, v.data(), sizeof(T));
+    return ss::le_to_cpu(value);
+}
+
+// Decimals are serialized as the minimal big-endian two's complement bytes of
+// their unscaled value.
+bool decimal_less(bytes_view lhs, bytes_view rhs) {
+    auto is_negative = [](bytes_view v) {
+        return !v.empty() && (v.front() & 0x80U) != 0;
+    };
+    bool lhs_negative = is_negative(lhs);
+    bool rhs_negative = is_negative(rhs);
+    if (lhs_negative != rhs_negative) {
+        return lhs_negative;
+    }
+    // With the same sign, sign extend both values to the same width and they
+    // can be compared as unsigned bytes.
+    uint8_t extension = lhs_negative ? 0xFF : 0x00;
+    size_t width = std::max(lhs.size(), rhs.size());
+    for (size_t i = 0; i < width; ++i) {
+        auto byte_at = [&](bytes_view v) {
+            size_t padding = width - v.size();
+            return i < padding ? extension : v[i - padding];
+        };
+        uint8_t l = byte_at(lhs);
+        uint8_t r = byte_at(rhs);
+        if (l != r) {
+            return l < r;
+        }
+    }
+    return false;
+}
+
+struct value_less_visitor {
+    const primitive_type& type;
+    bytes_view lhs;
+    bytes_view rhs;
+
+    template<typename T>
+    bool compare_le() const {
+        return read_le<T>(type, lhs) < read_le<T>(type, rhs);
+    }
+
+    bool operator()(const boolean_type&) const { return compare_le<uint8_t>(); }
+    bool operator()(const int_type&) const { return compare_le<int32_t>(); }
+    bool operator()(const date_type&) const { return compare_le<int32_t>(); }
+    bool operator()(const long_type&) const { return compare_le<int64_t>(); }
+    bool operator()(const time_type&) const { return compare_le<int64_t>(); }
+    bool operator()(const timestamp_type&) const {
+        return compare_le<int64_t>();
+    }
+    bool operator()(const timestamptz_type&) const {
+        return compare_le<int64_t>();
+    }
+    bool operator()(const float_type&) const {
+        return std::bit_cast<float>(read_le<uint32_t>(type, lhs))
+               < std::bit_cast<float>(read_le<uint32_t>(type, rhs));
+    }
+    bool operator()(const double_type&) const {
+        return std::bit_cast<double>(read_le<uint64_t>(type, lhs))
+               < std::bit_cast<double>(read_le<uint64_t>(type, rhs));
+    }
+    bool operator()(const decimal_type&) const {
+        return decimal_less(lhs, rhs);
+    }
+    // Strings, uuids, fixed and binary values all sort as unsigned bytes.
+    template<typename T>
+    bool operator()(const T&) const {
+        return lhs < rhs;
+    }
+};
+
+bool is_nan(const primitive_type& type, bytes_view v) {
+    if (std::holds_alternative<float_type>(type)) {
+        return std::isnan(std::bit_cast<float>(read_le<uint32_t>(type, v)));
+    }
+    if (std::holds_alternative<double_type>(type)) {
+        return std::isnan(std::bit_cast<double>(read_le<uint64_t>(type, v)));
+    }
+    return false;
+}
+
+} // namespace
+
+bool serialized_value_less(
+  const primitive_type& type, bytes_view lhs, bytes_view rhs) {
+    return std::visit(
+      value_less_visitor{.type = type, .lhs = lhs, .rhs = rhs}, type);
+}
+
+field_summary_builder::field_summary_builder(primitive_type type)
+  : _type(std::move(type)) {
+    if (
+      std::holds_alternative<float_type>(_type)
+      || std::holds_alternative<double_type>(_type)) {
+        _summary.contains_nan = false;
+    }
+}
+
+void field_summary_builder::add(std::optional<bytes_view> value) {
+    if (!value) {
+        _summary.contains_null = true;
+        return;
+    }
+    if (is_nan(_type, *value)) {
+        _summary.contains_nan = true;
+        return;
+    }
+    auto& lower = _summary.lower_bound;
+    if (!lower || serialized_value_less(_type, *value, *lower)) {
+        lower.emplace(value->data(), value->size());
+    }
+    auto& upper = _summary.upper_bound;
+    if (!upper || serialized_value_less(_type, *upper, *value)) {
+        upper.emplace(value->data(), value->size());
+    }
+}
+
+} // namespace iceberg
@@ -0,0 +1,59 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#pragma once
+
+#include "bytes/bytes.h"
+#include "iceberg/datatypes.h"
+
+#include <optional>
+
+namespace iceberg {
+
+// Summary of the values of a single partition field across all the data
+// files of a manifest. These are stored in the manifest list so that query
+// engines can skip whole manifests without reading them.
+//
+// Bounds are in Iceberg's single-value binary serialization.
+struct field_summary {
+    bool contains_null = false;
+    // Only tracked for floating point fields.
+    std::optional<bool> contains_nan;
+    std::optional<bytes> lower_bound;
+    std::optional<bytes> upper_bound;
+
+    friend bool operator==(const field_summary&, const field_summary&)
+      = default;
+};
+
+// Returns true if `lhs` sorts before `rhs`, where both are values of `type` in
+// Iceberg's single-value binary serialization. NaNs should not be compared.
+//
+// Throws std::invalid_argument if either value has an invalid size for
+// `type`.
+bool serialized_value_less(
+  const primitive_type& type, bytes_view lhs, bytes_view rhs);
+
+// Incrementally builds the summary of a partition field as data files are
+// added to a manifest.
+class field_summary_builder {
+public:
+    explicit field_summary_builder(primitive_type type);
+
+    // Add the serialized partition value of a data file, or std::nullopt for
+    // files with a null partition value.
+    void add(std::optional<bytes_view> value);
+
+    const field_summary& summary() const { return _summary; }
+
+private:
+    primitive_type _type;
+    field_summary _summary;
+};
+
+} // namespace iceberg
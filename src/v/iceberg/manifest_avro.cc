@@ -22,6 +22,8 @@
 
 #include <avro/DataFile.hh>
 
+#include <vector>
+
 namespace iceberg {
 
 namespace {
@@ -138,38 +140,11 @@ metadata_from_reader(avro::DataFileReader<manifest_entry>& rdr) {
 } // anonymous namespace
 
 iobuf serialize_avro(const manifest& m) {
-    size_t bytes_streamed = 0;
-    avro_iobuf_ostream::buf_container_t bufs;
-    static constexpr size_t avro_default_sync_bytes = 16_KiB;
-    auto meta = metadata_to_map(m.metadata);
-    {
-        auto out = std::make_unique<avro_iobuf_ostream>(
-          4_KiB, &bufs, &bytes_streamed);
-        avro::DataFileWriter<manifest_entry> writer(
-          std::move(out),
-          manifest_entry::valid_schema(),
-          avro_default_sync_bytes,
-          avro::NULL_CODEC,
-          meta);
-
-        // TODO: the Avro code-generated manifest_entry doesn't have the r102
-        // partition field defined, as it relies on runtime information of the
-        // partition spec!
-        for (const auto& e : m.entries) {
-            writer.write(e);
-        }
-        writer.flush();
-        writer.close();
-
-        // NOTE: ~DataFileWriter does a final sync which may write to the
-        // chunks. Destruct the writer before moving ownership of the chunks.
+    manifest_writer writer(m.metadata, {});
+    for (const auto& e : m.entries) {
+        writer.add(e);
     }
-    iobuf buf;
-    for (auto& b : bufs) {
-        buf.append(std::move(b));
-    }
-    buf.trim_back(buf.size_bytes() - bytes_streamed);
-    return buf;
+    return writer.finish();
 }
 
 manifest parse_manifest(iobuf buf) {
@@ -192,4 +167,125 @@ manifest parse_manifest(iobuf buf) {
     return m;
 }
 
+manifest_writer::manifest_writer(
+  const manifest_metadata& metadata,
+  chunked_vector<primitive_type> partition_types) {
+    static constexpr size_t avro_default_sync_bytes = 16_KiB;
+    auto out = std::make_unique<avro_iobuf_ostream>(
+      4_KiB, &_bufs, &_bytes_streamed);
+    _writer = std::make_unique<avro::DataFileWriter<manifest_entry>>(
+      std::move(out),
+      manifest_entry::valid_schema(),
+      avro_default_sync_bytes,
+      avro::NULL_CODEC,
+      metadata_to_map(metadata));
+    for (auto& type : partition_types) {
+        _partitions.emplace_back(std::move(type));
+    }
+}
+
+manifest_writer::~manifest_writer() = default;
+
+void manifest_writer::add(
+  const manifest_entry& e,
+  std::span<const std::optional<bytes>> partition_values) {
+    if (partition_values.size() != _partitions.size()) {
+        throw std::invalid_argument(fmt::format(
+          "Expected {} partition values, got {}",
+          _partitions.size(),
+          partition_values.size()));
+    }
+    // TODO: the Avro code-generated manifest_entry doesn't have the r102
+    // partition field defined, as it relies on runtime information of the
+    // partition spec! Until then, partition values are only used for the
+    // partition summaries.
+    _writer->write(e);
+    for (size_t i = 0; i < _partitions.size(); ++i) {
+        const auto& value = partition_values[i];
+        _partitions[i].add(
+          value ? std::make_optional<bytes_view>(*value) : std::nullopt);
+    }
+    // https://iceberg.apache.org/spec/#manifests
+    enum class entry_status { existing = 0, added = 1, deleted = 2 };
+    auto rows = e.data_file.record_count;
+    switch (static_cast<entry_status>(e.status)) {
+    case entry_status::existing:
+        ++_stats.existing_files;
+        _stats.existing_rows += rows;
+        break;
+    case entry_status::added:
+        ++_stats.added_files;
+        _stats.added_rows += rows;
+        break;
+    case entry_status::deleted:
+        ++_stats.deleted_files;
+        _stats.deleted_rows += rows;
+        break;
+    }
+}
+
+manifest_stats manifest_writer::stats() const {
+    manifest_stats stats{
+      .added_files = _stats.added_files,
+      .existing_files = _stats.existing_files,
+      .deleted_files = _stats.deleted_files,
+      .added_rows = _stats.added_rows,
+      .existing_rows = _stats.existing_rows,
+      .deleted_rows = _stats.deleted_rows,
+    };
+    for (const auto& p : _partitions) {
+        stats.partitions.push_back(p.summary());
+    }
+    return stats;
+}
+
+iobuf manifest_writer::finish() {
+    _writer->flush();
+    _writer->close();
+    // NOTE: ~DataFileWriter does a final sync which may write to the
+    // chunks. Destruct the writer before moving ownership of the chunks.
+    _writer.reset();
+    iobuf buf;
+    for (auto& b : _bufs) {
+        buf.append(std::move(b));
+    }
+    _bufs.clear();
+    buf.trim_back(buf.size_bytes() - _bytes_streamed);
+    return buf;
+}
+
+void set_manifest_stats(manifest_file& f, const manifest_stats& stats) {
+    f.added_data_files_count = stats.added_files;
+    f.existing_data_files_count = stats.existing_files;
+    f.deleted_data_files_count = stats.deleted_files;
+    f.added_rows_count = stats.added_rows;
+    f.existing_rows_count = stats.existing_rows;
+    f.deleted_rows_count = stats.deleted_rows;
+    const auto to_vector = [](const bytes& b) {
+        return std::vector<uint8_t>(b.begin(), b.end());
+    };
+    std::vector<r508> summaries;
+    summaries.reserve(stats.partitions.size());
+    for (const auto& p : stats.partitions) {
+        auto& s = summaries.emplace_back();
+        s.contains_null = p.contains_null;
+        if (p.contains_nan) {
+            s.contains_nan.set_bool(*p.contains_nan);
+        } else {
+            s.contains_nan.set_null();
+        }
+        if (p.lower_bound) {
+            s.lower_bound.set_bytes(to_vector(*p.lower_bound));
+        } else {
+            s.lower_bound.set_null();
+        }
+        if (p.upper_bound) {
+            s.upper_bound.set_bytes(to_vector(*p.upper_bound));
+        } else {
+            s.upper_bound.set_null();
+        }
+    }
+    f.partitions.set_array(summaries);
+}
+
 } // namespace iceberg
@@ -8,12 +8,82 @@
 // by the Apache License, Version 2.0
 #pragma once
 
+#include "bytes/bytes.h"
 #include "bytes/iobuf.h"
+#include "container/fragmented_vector.h"
+#include "iceberg/avro_utils.h"
+#include "iceberg/datatypes.h"
+#include "iceberg/field_summary.h"
 #include "iceberg/manifest.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_file.h"
+
+#include <avro/DataFile.hh>
+
+#include <memory>
+#include <optional>
+#include <span>
 
 namespace iceberg {
 
 iobuf serialize_avro(const manifest&);
 manifest parse_manifest(iobuf);
 
+// The entry counts of a manifest and the summaries of its partition values,
+// which are recorded in the manifest's entry in the manifest list.
+struct manifest_stats {
+    int32_t added_files = 0;
+    int32_t existing_files = 0;
+    int32_t deleted_files = 0;
+    int64_t added_rows = 0;
+    int64_t existing_rows = 0;
+    int64_t deleted_rows = 0;
+    chunked_vector<field_summary> partitions;
+};
+
+// Set the entry counts and partition summaries of a manifest list entry.
+void set_manifest_stats(manifest_file&, const manifest_stats&);
+
+// Writes a manifest as its entries are produced.
+//
+// Entries are encoded into Avro blocks as they're added instead of first
+// collecting a whole manifest in memory, and the manifest's stats are
+// computed along the way so that data files don't need to be revisited to
+// build the manifest list.
+class manifest_writer {
+public:
+    // `partition_types` are the result types of the fields of the partition
+    // spec in `metadata`.
+    manifest_writer(
+      const manifest_metadata& metadata,
+      chunked_vector<primitive_type> partition_types);
+    manifest_writer(const manifest_writer&) = delete;
+    manifest_writer& operator=(const manifest_writer&) = delete;
+    manifest_writer(manifest_writer&&) = delete;
+    manifest_writer& operator=(manifest_writer&&) = delete;
+    ~manifest_writer();
+
+    // Write an entry. `partition_values` are the serialized partition values
+    // of the entry's data file, one for each partition field.
+    //
+    // Throws std::invalid_argument if the number of partition values doesn't
+    // match the partition spec.
+    void add(
+      const manifest_entry&,
+      std::span<const std::optional<bytes>> partition_values = {});
+
+    manifest_stats stats() const;
+
+    // Flush the remaining entries and return the manifest file. No entries can
+    // be added afterwards.
+    iobuf finish();
+
+private:
+    size_t _bytes_streamed = 0;
+    avro_iobuf_ostream::buf_container_t _bufs;
+    std::unique_ptr<avro::DataFileWriter<manifest_entry>> _writer;
+    chunked_vector<field_summary_builder> _partitions;
+    manifest_stats _stats;
+};
+
 } // namespace iceberg
@@ -0,0 +1,125 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "iceberg/parquet_encoding.h"
+
+#include <seastar/core/byteorder.hh>
+
+#include <bit>
+
+namespace iceberg::parquet {
+
+namespace {
+
+// Runs and bit-packed groups are both made up of 8 values.
+constexpr size_t group_size = 8;
+
+void write_uleb128(iobuf& out, uint64_t value) {
+    constexpr uint64_t continuation = 0x80;
+    do {
+        uint8_t b = value & (continuation - 1);
+        value >>= 7U;
+        if (value != 0) {
+            b |= continuation;
+        }
+        out.append(&b, 1);
+    } while (value != 0);
+}
+
+template<typename T>
+void write_le(iobuf& out, T value) {
+    auto le = ss::cpu_to_le(value);
+    out.append(reinterpret_cast<const uint8_t*>(&le), sizeof(le));
+}
+
+void write_rle_run(iobuf& out, uint32_t value, size_t count, uint8_t width) {
+    write_uleb128(out, count << 1U);
+    // The repeated value is stored in the minimum number of bytes.
+    auto le = ss::cpu_to_le(value);
+    out.append(reinterpret_cast<const uint8_t*>(&le), (width + 7) / 8);
+}
+
+// Bit-pack `values` from the least significant bit of each byte, padding the
+// last group with zeros.
+void write_bit_packed_run(
+  iobuf& out, std::span<const uint32_t> values, uint8_t width) {
+    size_t groups = (values.size() + group_size - 1) / group_size;
+    write_uleb128(out, (groups << 1U) | 1U);
+    bytes packed(groups * width, 0);
+    uint64_t buffer = 0;
+    unsigned buffered_bits = 0;
+    size_t pos = 0;
+    for (uint32_t v : values) {
+        buffer |= uint64_t(v) << buffered_bits;
+        buffered_bits += width;
+        while (buffered_bits >= 8) {
+            packed[pos++] = static_cast<uint8_t>(buffer);
+            buffer >>= 8U;
+            buffered_bits -= 8;
+        }
+    }
+    if (buffered_bits > 0) {
+        packed[pos] = static_cast<uint8_t>(buffer);
+    }
+    out.append(packed.data(), packed.size());
+}
+
+} // namespace
+
+uint8_t bit_width(uint32_t max_value) {
+    return static_cast<uint8_t>(std::bit_width(max_value));
+}
+
+iobuf encode_rle_bit_packed(std::span<const uint32_t> values, uint8_t width) {
+    iobuf out;
+    // Values that have been passed over but not written yet, these are always
+    // a whole number of groups unless they are at the end of the input, as
+    // only the last group of a bit-packed run can be padded.
+    size_t pending = 0;
+    size_t i = 0;
+    while (i < values.size()) {
+        size_t run = 1;
+        while (i + run < values.size() && values[i + run] == values[i]) {
+            ++run;
+        }
+        if (run < group_size) {
+            i = std::min(i + group_size, values.size());
+            continue;
+        }
+        if (pending < i) {
+            write_bit_packed_run(
+              out, values.subspan(pending, i - pending), width);
+        }
+        write_rle_run(out, values[i], run, width);
+        i += run;
+        pending = i;
+    }
+    if (pending < values.size()) {
+        write_bit_packed_run(out, values.subspan(pending), width);
+    }
+    return out;
+}
+
+void plain_encode(iobuf& out, int32_t value) { write_le(out, value); }
+
+void plain_encode(iobuf& out, int64_t value) { write_le(out, value); }
+
+void plain_encode(iobuf& out, float value) {
+    write_le(out, std::bit_cast<uint32_t>(value));
+}
+
+void plain_encode(iobuf& out, double value) {
+    write_le(out, std::bit_cast<uint64_t>(value));
+}
+
+void plain_encode(iobuf& out, const bytes& value) {
+    write_le(out, static_cast<uint32_t>(value.size()));
+    out.append(value.data(), value.size());
+}
+
+} // namespace iceberg::parquet
@@ -0,0 +1,163 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#pragma once
+
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "container/fragmented_vector.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Building blocks for writing the column chunks of Parquet data files.
+//
+// https://parquet.apache.org/docs/file-format/data-pages/encodings/
+namespace iceberg::parquet {
+
+// Physical values that can be stored in a column chunk. Strings, binary,
+// decimals and uuids are all stored as byte arrays.
+template<typename T>
+concept physical_value = std::is_same_v<T, int32_t>
+                         || std::is_same_v<T, int64_t>
+                         || std::is_same_v<T, float>
+                         || std::is_same_v<T, double>
+                         || std::is_same_v<T, bytes>;
+
+// The number of bits needed to represent every value up to `max_value`.
+uint8_t bit_width(uint32_t max_value);
+
+// Encode `values` using the RLE / bit-packing hybrid encoding. This is used
+// both for definition levels and for dictionary indices. Runs of at least 8
+// repeated values are run length encoded and everything else is bit-packed in
+// groups of 8 values. The output does not include a length prefix.
+iobuf encode_rle_bit_packed(std::span<const uint32_t> values, uint8_t width);
+
+// Append the PLAIN encoding of `value` to `out`.
+void plain_encode(iobuf& out, int32_t value);
+void plain_encode(iobuf& out, int64_t value);
+void plain_encode(iobuf& out, float value);
+void plain_encode(iobuf& out, double value);
+void plain_encode(iobuf& out, const bytes& value);
+
+// The size of the PLAIN encoding of `value`.
+template<physical_value T>
+size_t plain_encoded_size(const T& value) {
+    if constexpr (std::is_same_v<T, bytes>) {
+        return sizeof(uint32_t) + value.size();
+    } else {
+        return sizeof(T);
+    }
+}
+
+// Dictionary encoding for a single column chunk.
+//
+// Values are assigned indexes in the order they are first seen. The dictionary
+// page is the PLAIN encoding of the distinct values, and data pages hold the
+// bit width of the indexes followed by the RLE / bit-packing hybrid encoding of
+// the indexes.
+//
+// Writers are expected to fall back to PLAIN encoding for the rest of the
+// chunk once the dictionary grows past their memory budget, which is what
+// `dictionary_bytes` is for.
+template<physical_value T>
+class dictionary_encoder {
+public:
+    void put(const T& value) {
+        auto [it, inserted] = _index.try_emplace(
+          value, static_cast<uint32_t>(_dictionary.size()));
+        if (inserted) {
+            _dictionary.push_back(value);
+            _dictionary_bytes += plain_encoded_size(value);
+        }
+        _indexes.push_back(it->second);
+    }
+
+    // The number of distinct values in the dictionary.
+    size_t dictionary_size() const { return _dictionary.size(); }
+    // The size of the dictionary page.
+    size_t dictionary_bytes() const { return _dictionary_bytes; }
+    // The number of values that have been put into the encoder.
+    size_t num_values() const { return _indexes.size(); }
+
+    iobuf encode_dictionary_page() const {
+        iobuf out;
+        for (const auto& value : _dictionary) {
+            plain_encode(out, value);
+        }
+        return out;
+    }
+
+    // Encode the indexes of all the values put since the last data page.
+    iobuf encode_data_page() {
+        uint8_t width = 0;
+        if (!_dictionary.empty()) {
+            width = bit_width(static_cast<uint32_t>(_dictionary.size() - 1));
+        }
+        iobuf out;
+        out.append(&width, sizeof(width));
+        out.append(encode_rle_bit_packed(
+          std::span<const uint32_t>(_indexes.begin(), _indexes.end()), width));
+        _indexes.clear();
+        return out;
+    }
+
+private:
+    using hash = std::
+      conditional_t<std::is_same_v<T, bytes>, bytes_type_hash, absl::Hash<T>>;
+    using eq = std::
+      conditional_t<std::is_same_v<T, bytes>, bytes_type_eq, std::equal_to<T>>;
+
+    absl::flat_hash_map<T, uint32_t, hash, eq> _index;
+    chunked_vector<T> _dictionary;
+    size_t _dictionary_bytes = 0;
+    std::vector<uint32_t> _indexes;
+};
+
+// Statistics for a single column chunk, these are both written into the
+// Parquet footer and used for the column metrics of the data file in the
+// Iceberg manifest.
+template<physical_value T>
+struct column_stats {
+    std::optional<T> min;
+    std::optional<T> max;
+    int64_t value_count = 0;
+    int64_t null_count = 0;
+    // NaNs are not ordered, so they are counted instead of being considered
+    // for the bounds.
+    int64_t nan_count = 0;
+
+    void update(const std::optional<T>& value) {
+        ++value_count;
+        if (!value) {
+            ++null_count;
+            return;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(*value)) {
+                ++nan_count;
+                return;
+            }
+        }
+        if (!min || *value < *min) {
+            min = *value;
+        }
+        if (!max || *max < *value) {
+            max = *value;
+        }
+    }
+};
+
+} // namespace iceberg::parquet
@@ -0,0 +1,168 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "container/fragmented_vector.h"
+#include "iceberg/commit_coordinator.h"
+#include "iceberg/manifest_entry.h"
+#include "model/fundamental.h"
+
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/manual_clock.hh>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace iceberg;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct committed {
+    model::topic topic;
+    std::vector<std::string> files;
+    partition_offsets offsets;
+};
+
+class fake_table_committer : public table_committer {
+public:
+    ss::future<>
+    commit(const model::topic& topic, const table_commit& commit) override {
+        if (_failures > 0) {
+            --_failures;
+            throw std::runtime_error("injected commit failure");
+        }
+        committed c{.topic = topic, .offsets = commit.offsets};
+        for (const auto& f : commit.files) {
+            c.files.push_back(f.data_file.file_path);
+        }
+        _commits.push_back(std::move(c));
+        _cond_var.broadcast();
+        co_return;
+    }
+
+    void inject_failures(int count) { _failures = count; }
+
+    ss::future<> wait_for_commits(size_t n) {
+        return _cond_var.wait([this, n] { return _commits.size() >= n; });
+    }
+
+    const std::vector<committed>& commits() const { return _commits; }
+
+private:
+    int _failures = 0;
+    std::vector<committed> _commits;
+    ss::condition_variable _cond_var;
+};
+
+constexpr auto commit_interval = 10s;
+
+class CommitCoordinatorTest : public testing::Test {
+public:
+    void SetUp() override {
+        auto committer = std::make_unique<fake_table_committer>();
+        _committer = committer.get();
+        _coordinator = std::make_unique<commit_coordinator<ss::manual_clock>>(
+          config::mock_binding(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+              commit_interval)),
+          std::move(committer));
+        _coordinator->start().get();
+    }
+
+    void TearDown() override {
+        _coordinator->stop().get();
+        _coordinator = nullptr;
+    }
+
+    void add(std::string_view topic, int partition, int offset) {
+        chunked_vector<manifest_entry> files;
+        auto& f = files.emplace_back();
+        f.data_file.file_path = fmt::format(
+          "{}/{}/{}", topic, partition, offset);
+        _coordinator->add(
+          model::topic(ss::sstring(topic)),
+          {
+            .partition = model::partition_id(partition),
+            .last_offset = kafka::offset(offset),
+            .files = std::move(files),
+          });
+    }
+
+    fake_table_committer* _committer = nullptr;
+    std::unique_ptr<commit_coordinator<ss::manual_clock>> _coordinator;
+};
+
+} // namespace
+
+TEST_F(CommitCoordinatorTest, BatchesPartitionsPerTopic) {
+    add("a", 0, 10);
+    add("a", 1, 20);
+    add("b", 0, 5);
+    add("a", 0, 15);
+    EXPECT_EQ(_coordinator->pending_files(), 4);
+
+    ss::manual_clock::advance(commit_interval);
+    _committer->wait_for_commits(2).get();
+
+    const auto& commits = _committer->commits();
+    ASSERT_EQ(commits.size(), 2);
+    EXPECT_EQ(commits[0].topic, model::topic("a"));
+    EXPECT_EQ(
+      commits[0].files,
+      (std::vector<std::string>{"a/0/10", "a/1/20", "a/0/15"}));
+    EXPECT_EQ(
+      commits[0].offsets,
+      (partition_offsets{
+        {model::partition_id(0), kafka::offset(15)},
+        {model::partition_id(1), kafka::offset(20)},
+      }));
+    EXPECT_EQ(commits[1].topic, model::topic("b"));
+    EXPECT_EQ(commits[1].files, (std::vector<std::string>{"b/0/5"}));
+    EXPECT_EQ(_coordinator->pending_files(), 0);
+}
+
+TEST_F(CommitCoordinatorTest, RetriesFailedCommits) {
+    _committer->inject_failures(1);
+    add("a", 0, 10);
+    _coordinator->flush().get();
+    EXPECT_TRUE(_committer->commits().empty());
+    EXPECT_EQ(_coordinator->pending_files(), 1);
+
+    add("a", 1, 3);
+    _coordinator->flush().get();
+    const auto& commits = _committer->commits();
+    ASSERT_EQ(commits.size(), 1);
+    EXPECT_EQ(commits[0].files, (std::vector<std::string>{"a/0/10", "a/1/3"}));
+    EXPECT_EQ(
+      commits[0].offsets,
+      (partition_offsets{
+        {model::partition_id(0), kafka::offset(10)},
+        {model::partition_id(1), kafka::offset(3)},
+      }));
+}
+
+TEST(CommitSummaryTest, RoundTripsOffsets) {
+    table_commit commit;
+    commit.offsets.emplace(model::partition_id(0), kafka::offset(42));
+    commit.offsets.emplace(model::partition_id(7), kafka::offset(3));
+    auto props = commit.summary_properties();
+    EXPECT_EQ(props.at("redpanda.offset.0"), "42");
+    props.emplace("added-data-files", "2");
+    EXPECT_EQ(parse_partition_offsets(props), commit.offsets);
+
+    props.emplace("redpanda.offset.x", "1");
+    EXPECT_THROW(parse_partition_offsets(props), std::invalid_argument);
+}
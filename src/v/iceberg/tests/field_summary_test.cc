@@ -0,0 +1,101 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "iceberg/datatypes.h"
+#include "iceberg/field_summary.h"
+
+#include <seastar/core/byteorder.hh>
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <limits>
+
+using namespace iceberg;
+
+// NOLINTBEGIN(*-magic-*)
+
+namespace {
+
+template<typename T>
+bytes serialize_le(T v) {
+    auto le = ss::cpu_to_le(v);
+    return {reinterpret_cast<const uint8_t*>(&le), sizeof(le)};
+}
+
+bytes serialize_double(double v) {
+    return serialize_le(std::bit_cast<uint64_t>(v));
+}
+
+} // namespace
+
+TEST(FieldSummaryTest, CompareNumbers) {
+    const primitive_type type = int_type{};
+    // Serialized ints are little-endian, so they don't sort as bytes.
+    EXPECT_TRUE(serialized_value_less(
+      type, serialize_le<int32_t>(255), serialize_le<int32_t>(256)));
+    EXPECT_TRUE(serialized_value_less(
+      type, serialize_le<int32_t>(-1), serialize_le<int32_t>(0)));
+    EXPECT_FALSE(serialized_value_less(
+      type, serialize_le<int32_t>(7), serialize_le<int32_t>(7)));
+    EXPECT_TRUE(serialized_value_less(
+      double_type{}, serialize_double(-0.5), serialize_double(0.25)));
+    EXPECT_THROW(
+      serialized_value_less(
+        long_type{}, serialize_le<int32_t>(1), serialize_le<int64_t>(2)),
+      std::invalid_argument);
+}
+
+TEST(FieldSummaryTest, CompareDecimals) {
+    const primitive_type type = decimal_type{.precision = 10, .scale = 2};
+    // -1 < 1
+    EXPECT_TRUE(serialized_value_less(type, bytes{0xFF}, bytes{0x01}));
+    // -129 < -1
+    EXPECT_TRUE(serialized_value_less(type, bytes{0xFF, 0x7F}, bytes{0xFF}));
+    // 127 < 128
+    EXPECT_TRUE(serialized_value_less(type, bytes{0x7F}, bytes{0x00, 0x80}));
+    EXPECT_FALSE(serialized_value_less(type, bytes{0x00, 0x80}, bytes{0x7F}));
+}
+
+TEST(FieldSummaryTest, CompareBytes) {
+    EXPECT_TRUE(
+      serialized_value_less(string_type{}, bytes{'a', 'b'}, bytes{'b'}));
+    EXPECT_TRUE(serialized_value_less(binary_type{}, bytes{0x7F}, bytes{0x80}));
+}
+
+TEST(FieldSummaryTest, BuildSummary) {
+    field_summary_builder builder(int_type{});
+    EXPECT_EQ(builder.summary(), field_summary{});
+    builder.add(serialize_le<int32_t>(3));
+    builder.add(serialize_le<int32_t>(-8));
+    builder.add(serialize_le<int32_t>(1000));
+    EXPECT_EQ(
+      builder.summary(),
+      (field_summary{
+        .contains_null = false,
+        .lower_bound = serialize_le<int32_t>(-8),
+        .upper_bound = serialize_le<int32_t>(1000),
+      }));
+    builder.add(std::nullopt);
+    EXPECT_TRUE(builder.summary().contains_null);
+}
+
+TEST(FieldSummaryTest, BuildSummaryWithNaNs) {
+    field_summary_builder builder(double_type{});
+    EXPECT_EQ(builder.summary().contains_nan, false);
+    builder.add(serialize_double(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_EQ(builder.summary().contains_nan, true);
+    EXPECT_FALSE(builder.summary().lower_bound.has_value());
+    builder.add(serialize_double(1.5));
+    EXPECT_EQ(builder.summary().lower_bound, serialize_double(1.5));
+    EXPECT_EQ(builder.summary().upper_bound, serialize_double(1.5));
+}
+
+// NOLINTEND(*-magic-*)
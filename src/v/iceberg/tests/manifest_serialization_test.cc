@@ -11,6 +11,8 @@
 #include "bytes/iobuf.h"
 #include "container/fragmented_vector.h"
 #include "iceberg/avro_utils.h"
+#include "iceberg/datatypes.h"
+#include "iceberg/field_summary.h"
 #include "iceberg/manifest.h"
 #include "iceberg/manifest_avro.h"
 #include "iceberg/manifest_entry.h"
@@ -19,6 +21,7 @@
 #include "iceberg/tests/test_schemas.h"
 #include "utils/file_io.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/util/file.hh>
 
@@ -26,6 +29,11 @@
 #include <avro/Stream.hh>
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
 using namespace iceberg;
 
 namespace {
@@ -262,3 +270,66 @@ TEST(ManifestSerializationTest, TestSerializeManifestData) {
     auto roundtrip_buf = serialize_avro(m_roundtrip);
     ASSERT_EQ(serialized_buf, roundtrip_buf);
 }
+
+TEST(ManifestSerializationTest, TestManifestWriterStats) {
+    auto orig_buf = iobuf{
+      ss::util::read_entire_file("nested_manifest.avro").get0()};
+    auto m = parse_manifest(orig_buf.copy());
+
+    chunked_vector<primitive_type> partition_types;
+    partition_types.emplace_back(int_type{});
+    manifest_writer writer(m.metadata, std::move(partition_types));
+
+    auto int_value = [](int32_t v) {
+        auto le = ss::cpu_to_le(v);
+        return bytes(reinterpret_cast<const uint8_t*>(&le), sizeof(le));
+    };
+    const std::vector<std::pair<int, std::optional<bytes>>> files = {
+      {1, int_value(5)},
+      {1, int_value(-3)},
+      {0, std::nullopt},
+      {2, int_value(10)},
+    };
+    for (const auto& [status, value] : files) {
+        manifest_entry entry;
+        entry.status = status;
+        entry.data_file.file_path = "path/to/file";
+        entry.data_file.file_format = "PARQUET";
+        entry.data_file.record_count = 3;
+        writer.add(entry, std::span(&value, 1));
+    }
+    EXPECT_THROW(writer.add(manifest_entry{}), std::invalid_argument);
+
+    auto stats = writer.stats();
+    EXPECT_EQ(stats.added_files, 2);
+    EXPECT_EQ(stats.existing_files, 1);
+    EXPECT_EQ(stats.deleted_files, 1);
+    EXPECT_EQ(stats.added_rows, 6);
+    EXPECT_EQ(stats.existing_rows, 3);
+    EXPECT_EQ(stats.deleted_rows, 3);
+    ASSERT_EQ(stats.partitions.size(), 1);
+    EXPECT_EQ(
+      stats.partitions[0],
+      (field_summary{
+        .contains_null = true,
+        .lower_bound = int_value(-3),
+        .upper_bound = int_value(10),
+      }));
+
+    auto m_written = parse_manifest(writer.finish());
+    ASSERT_EQ(m.metadata, m_written.metadata);
+    ASSERT_EQ(files.size(), m_written.entries.size());
+
+    manifest_file list_entry;
+    set_manifest_stats(list_entry, stats);
+    EXPECT_EQ(list_entry.added_data_files_count, 2);
+    EXPECT_EQ(list_entry.deleted_rows_count, 3);
+    const auto& summaries = list_entry.partitions.get_array();
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_TRUE(summaries[0].contains_null);
+    EXPECT_TRUE(summaries[0].contains_nan.is_null());
+    auto lower = int_value(-3);
+    EXPECT_EQ(
+      summaries[0].lower_bound.get_bytes(),
+      std::vector<uint8_t>(lower.begin(), lower.end()));
+}
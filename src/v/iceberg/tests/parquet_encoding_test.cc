@@ -0,0 +1,123 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "iceberg/parquet_encoding.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace iceberg::parquet;
+
+// NOLINTBEGIN(*-magic-*)
+
+namespace {
+
+bytes encode(const std::vector<uint32_t>& values, uint8_t width) {
+    return iobuf_to_bytes(encode_rle_bit_packed(values, width));
+}
+
+} // namespace
+
+TEST(ParquetEncodingTest, BitWidth) {
+    EXPECT_EQ(bit_width(0), 0);
+    EXPECT_EQ(bit_width(1), 1);
+    EXPECT_EQ(bit_width(7), 3);
+    EXPECT_EQ(bit_width(8), 4);
+    EXPECT_EQ(bit_width(std::numeric_limits<uint32_t>::max()), 32);
+}
+
+TEST(ParquetEncodingTest, BitPacked) {
+    // The example from the Parquet spec.
+    EXPECT_EQ(
+      encode({0, 1, 2, 3, 4, 5, 6, 7}, 3), (bytes{0x03, 0x88, 0xC6, 0xFA}));
+    // Partial groups are padded with zeros.
+    EXPECT_EQ(encode({1, 2}, 3), (bytes{0x03, 0x11, 0x00, 0x00}));
+}
+
+TEST(ParquetEncodingTest, RunLengthEncoded) {
+    EXPECT_EQ(encode(std::vector<uint32_t>(10, 3), 2), (bytes{0x14, 0x03}));
+    EXPECT_EQ(
+      encode(std::vector<uint32_t>(300, 1), 9),
+      (bytes{0xD8, 0x04, 0x01, 0x00}));
+}
+
+TEST(ParquetEncodingTest, MixedRuns) {
+    std::vector<uint32_t> values(10, 5);
+    values.push_back(1);
+    values.push_back(2);
+    EXPECT_EQ(encode(values, 3), (bytes{0x14, 0x05, 0x03, 0x11, 0x00, 0x00}));
+
+    // A run that starts in the middle of a group can only be run length
+    // encoded from the next group onwards.
+    values = {1, 2};
+    values.insert(values.end(), 14, 0);
+    EXPECT_EQ(encode(values, 2), (bytes{0x03, 0x09, 0x00, 0x10, 0x00}));
+}
+
+TEST(ParquetEncodingTest, DictionaryEncoding) {
+    dictionary_encoder<int64_t> encoder;
+    for (int64_t v : {7, 9, 7, 7}) {
+        encoder.put(v);
+    }
+    EXPECT_EQ(encoder.dictionary_size(), 2);
+    EXPECT_EQ(encoder.dictionary_bytes(), 16);
+    EXPECT_EQ(encoder.num_values(), 4);
+    EXPECT_EQ(
+      iobuf_to_bytes(encoder.encode_dictionary_page()),
+      (bytes{7, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0}));
+    EXPECT_EQ(
+      iobuf_to_bytes(encoder.encode_data_page()), (bytes{0x01, 0x03, 0x02}));
+    EXPECT_EQ(encoder.num_values(), 0);
+
+    // The dictionary is shared by all the pages in the chunk.
+    encoder.put(9);
+    EXPECT_EQ(encoder.dictionary_size(), 2);
+    EXPECT_EQ(
+      iobuf_to_bytes(encoder.encode_data_page()), (bytes{0x01, 0x03, 0x01}));
+}
+
+TEST(ParquetEncodingTest, DictionaryEncodingByteArrays) {
+    dictionary_encoder<bytes> encoder;
+    encoder.put(bytes{'a'});
+    encoder.put(bytes{'b', 'c'});
+    encoder.put(bytes{'a'});
+    EXPECT_EQ(encoder.dictionary_size(), 2);
+    EXPECT_EQ(encoder.dictionary_bytes(), 11);
+    EXPECT_EQ(
+      iobuf_to_bytes(encoder.encode_dictionary_page()),
+      (bytes{1, 0, 0, 0, 'a', 2, 0, 0, 0, 'b', 'c'}));
+}
+
+TEST(ParquetEncodingTest, ColumnStats) {
+    column_stats<double> stats;
+    for (std::optional<double> v :
+         {std::optional<double>(2.5),
+          std::optional<double>(),
+          std::optional<double>(std::numeric_limits<double>::quiet_NaN()),
+          std::optional<double>(-1.0),
+          std::optional<double>(1.0)}) {
+        stats.update(v);
+    }
+    EXPECT_EQ(stats.value_count, 5);
+    EXPECT_EQ(stats.null_count, 1);
+    EXPECT_EQ(stats.nan_count, 1);
+    EXPECT_EQ(stats.min, -1.0);
+    EXPECT_EQ(stats.max, 2.5);
+
+    column_stats<bytes> empty;
+    empty.update(std::nullopt);
+    EXPECT_EQ(empty.null_count, 1);
+    EXPECT_FALSE(empty.min.has_value());
+    EXPECT_FALSE(empty.max.has_value());
+}
+
+// NOLINTEND(*-magic-*)
@@ -0,0 +1,99 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "iceberg/upsert_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace iceberg;
+
+namespace {
+
+bytes key(std::string_view k) {
+    return {reinterpret_cast<const uint8_t*>(k.data()), k.size()};
+}
+
+std::vector<bytes> sorted_equality_keys(const upsert_deletes& d) {
+    std::vector<bytes> keys(d.equality_keys.begin(), d.equality_keys.end());
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+std::vector<position_delete> positions(const upsert_deletes& d) {
+    return {d.positions.begin(), d.positions.end()};
+}
+
+} // namespace
+
+TEST(UpsertTrackerTest, PositionDeletesWithinCommit) {
+    upsert_tracker tracker(100);
+    tracker.start_file("b.parquet");
+    tracker.add_row(key("k1"), 0);
+    tracker.add_row(key("k2"), 1);
+    tracker.add_row(key("k1"), 2);
+    tracker.start_file("a.parquet");
+    tracker.add_row(key("k2"), 0);
+    tracker.add_row(key("k3"), 1);
+    tracker.add_tombstone(key("k3"));
+
+    auto deletes = tracker.finish_commit();
+    EXPECT_EQ(
+      positions(deletes),
+      (std::vector<position_delete>{
+        {.file_path = "a.parquet", .pos = 1},
+        {.file_path = "b.parquet", .pos = 0},
+        {.file_path = "b.parquet", .pos = 1},
+      }));
+    // Nothing was committed before, so there's nothing else to delete.
+    EXPECT_TRUE(deletes.equality_keys.empty());
+    EXPECT_EQ(tracker.committed_keys(), 2);
+}
+
+TEST(UpsertTrackerTest, EqualityDeletesAcrossCommits) {
+    upsert_tracker tracker(100);
+    tracker.start_file("1.parquet");
+    tracker.add_row(key("k1"), 0);
+    tracker.add_row(key("k2"), 1);
+    tracker.finish_commit();
+
+    tracker.start_file("2.parquet");
+    tracker.add_row(key("k1"), 0);
+    tracker.add_row(key("k3"), 1);
+    tracker.add_tombstone(key("k2"));
+    auto deletes = tracker.finish_commit();
+    EXPECT_TRUE(deletes.positions.empty());
+    EXPECT_EQ(
+      sorted_equality_keys(deletes),
+      (std::vector<bytes>{key("k1"), key("k2")}));
+    // k2 was deleted, so writing it again doesn't need a delete.
+    EXPECT_EQ(tracker.committed_keys(), 2);
+
+    tracker.start_file("3.parquet");
+    tracker.add_row(key("k2"), 0);
+    deletes = tracker.finish_commit();
+    EXPECT_TRUE(deletes.equality_keys.empty());
+}
+
+TEST(UpsertTrackerTest, DeletesAllKeysOnceSaturated) {
+    upsert_tracker tracker(1);
+    tracker.start_file("1.parquet");
+    tracker.add_row(key("k1"), 0);
+    tracker.add_row(key("k2"), 1);
+    tracker.finish_commit();
+    EXPECT_EQ(tracker.committed_keys(), 0);
+
+    tracker.start_file("2.parquet");
+    tracker.add_row(key("k3"), 0);
+    auto deletes = tracker.finish_commit();
+    EXPECT_EQ(sorted_equality_keys(deletes), (std::vector<bytes>{key("k3")}));
+}
@@ -0,0 +1,88 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "iceberg/upsert_tracker.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace iceberg {
+
+upsert_tracker::upsert_tracker(size_t max_committed_keys)
+  : _max_committed_keys(max_committed_keys) {}
+
+void upsert_tracker::start_file(ss::sstring file_path) {
+    _files.push_back(std::move(file_path));
+}
+
+void upsert_tracker::add_row(const bytes& key, int64_t pos) {
+    if (_files.empty()) {
+        throw std::logic_error("upsert_tracker: row added before any file");
+    }
+    update_latest(key, {.file = _files.size() - 1, .pos = pos});
+}
+
+void upsert_tracker::add_tombstone(const bytes& key) {
+    update_latest(key, {.file = 0, .pos = std::nullopt});
+}
+
+void upsert_tracker::update_latest(const bytes& key, row_location loc) {
+    auto [it, inserted] = _latest.try_emplace(key, loc);
+    if (inserted) {
+        return;
+    }
+    const auto& prev = it->second;
+    if (prev.pos) {
+        _positions.push_back(position_delete{
+          .file_path = _files[prev.file],
+          .pos = *prev.pos,
+        });
+    }
+    it->second = loc;
+}
+
+upsert_deletes upsert_tracker::finish_commit() {
+    upsert_deletes deletes;
+    for (const auto& [key, loc] : _latest) {
+        if (_saturated || _committed.contains(key)) {
+            deletes.equality_keys.push_back(key);
+        }
+        if (_saturated) {
+            continue;
+        }
+        if (!loc.pos) {
+            _committed.erase(key);
+            continue;
+        }
+        if (
+          !_committed.contains(key)
+          && _committed.size() >= _max_committed_keys) {
+            // Every key needs an equality delete from now on, so there's no
+            // point in remembering any of them.
+            _saturated = true;
+            _committed.clear();
+            continue;
+        }
+        _committed.insert(key);
+    }
+    std::sort(
+      _positions.begin(),
+      _positions.end(),
+      [](const position_delete& lhs, const position_delete& rhs) {
+          return std::tie(lhs.file_path, lhs.pos)
+                 < std::tie(rhs.file_path, rhs.pos);
+      });
+    deletes.positions = std::move(_positions);
+    _positions = {};
+    _latest.clear();
+    _files.clear();
+    return deletes;
+}
+
+} // namespace iceberg
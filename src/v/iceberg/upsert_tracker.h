@@ -0,0 +1,94 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#pragma once
+
+#include "bytes/bytes.h"
+#include "container/fragmented_vector.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <optional>
+
+namespace iceberg {
+
+// A row of a position delete file, which deletes the row at `pos` of the data
+// file at `file_path`.
+struct position_delete {
+    ss::sstring file_path;
+    int64_t pos;
+
+    friend bool operator==(const position_delete&, const position_delete&)
+      = default;
+};
+
+// The deletes that need to be committed alongside a commit's data files so
+// that readers only see the latest value of each key.
+struct upsert_deletes {
+    // Rows of this commit's data files that were superseded by a later row or
+    // tombstone for the same key in the same commit. Sorted by file path and
+    // position, as the spec requires.
+    chunked_vector<position_delete> positions;
+    // Keys that may have rows in previous commits. Equality deletes only
+    // apply to data files with a lower sequence number, so these don't delete
+    // the rows written by this commit.
+    chunked_vector<bytes> equality_keys;
+};
+
+// Tracks the keys written to a table in upsert mode, for translating
+// compacted topics with merge-on-read deletes instead of rewriting data files.
+//
+// Like compaction's key_offset_map, this remembers the latest location of each
+// key in the data files of the commit being built, and additionally remembers
+// which keys have been committed to the table before. Once more than
+// `max_committed_keys` keys have been committed, as we can no longer tell
+// which keys are new, an equality delete is emitted for every key.
+class upsert_tracker {
+public:
+    explicit upsert_tracker(size_t max_committed_keys);
+
+    // Start writing rows to a new data file of the current commit.
+    void start_file(ss::sstring file_path);
+
+    // A row with `key` was appended to the current data file at `pos`.
+    void add_row(const bytes& key, int64_t pos);
+
+    // A tombstone for `key` was read. No row is written for it, but it
+    // deletes all the earlier rows for the key.
+    void add_tombstone(const bytes& key);
+
+    // Returns the deletes for the data files written since the last commit,
+    // and starts a new commit.
+    upsert_deletes finish_commit();
+
+    // The number of committed keys that are being tracked.
+    size_t committed_keys() const { return _committed.size(); }
+
+private:
+    struct row_location {
+        size_t file;
+        // std::nullopt for tombstones.
+        std::optional<int64_t> pos;
+    };
+
+    void update_latest(const bytes& key, row_location);
+
+    size_t _max_committed_keys;
+    bool _saturated = false;
+    absl::flat_hash_set<bytes, bytes_type_hash, bytes_type_eq> _committed;
+
+    chunked_vector<ss::sstring> _files;
+    absl::flat_hash_map<bytes, row_location, bytes_type_hash, bytes_type_eq>
+      _latest;
+    chunked_vector<position_delete> _positions;
+};
+
+} // namespace iceberg
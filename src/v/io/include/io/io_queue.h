@@ -124,6 +124,14 @@ public:
      */
     void submit_write(page&) noexcept;
 
+    /**
+     * Make writes that completed before the call durable.
+     *
+     * If the queue is closed a temporary handle is opened for the duration of
+     * the flush. Pending and inflight writes are not waited for.
+     */
+    seastar::future<> flush() noexcept;
+
 private:
     friend testing_details::io_queue_accessor;
 
@@ -14,6 +14,7 @@
 #include "io/page_set.h"
 #include "io/scheduler.h"
 
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/temporary_buffer.hh>
 
@@ -68,6 +69,17 @@ public:
      */
     seastar::future<> append(seastar::temporary_buffer<char> data) noexcept;
 
+    /**
+     * Make all data appended before the call durable. When the returned future
+     * completes the dirty pages have been written back to the underlying file
+     * and the file has been synced.
+     *
+     * Write-back of data appended while the flush is waiting is also waited
+     * for, so a caller flushing a file that is continuously appended to may
+     * wait longer than strictly necessary.
+     */
+    seastar::future<> flush() noexcept;
+
     /**
      * Configuration object for read interface.
      */
@@ -100,7 +112,12 @@ private:
     seastar::future<seastar::lw_shared_ptr<page>>
     get_page(uint64_t offset) noexcept;
 
-    static void handle_completion(page&) noexcept;
+    void handle_completion(page&) noexcept;
+
+    /*
+     * Mark a page as dirty and submit it for write-back.
+     */
+    void mark_dirty(page&) noexcept;
 
     /// The underlying file managed by this pager.
     std::filesystem::path file_;
@@ -114,6 +131,11 @@ private:
     /// Pages that contain data for this file.
     page_set pages_;
 
+    /// Number of pages with data not yet written back, and waiters for it to
+    /// drop to zero.
+    size_t dirty_pages_{0};
+    seastar::condition_variable clean_cond_;
+
     /// The IO scheduler and queue for IO operations on this file.
     scheduler* sched_;
     scheduler::queue queue_;
@@ -66,6 +66,11 @@ public:
         virtual seastar::future<size_t>
         dma_write(uint64_t offset, const char* buf, size_t size) noexcept = 0;
 
+        /**
+         * Make previously completed writes durable.
+         */
+        virtual seastar::future<> flush() noexcept = 0;
+
         /**
          * Close the file.
          */
@@ -227,6 +232,8 @@ public:
         seastar::future<size_t>
         dma_write(uint64_t pos, const char* buf, size_t len) noexcept override;
 
+        seastar::future<> flush() noexcept override;
+
         seastar::future<> close() noexcept override;
 
         [[nodiscard]] uint64_t
@@ -305,6 +312,8 @@ public:
         seastar::future<size_t>
         dma_write(uint64_t pos, const char* buf, size_t len) noexcept override;
 
+        seastar::future<> flush() noexcept override;
+
         seastar::future<> close() noexcept override;
 
         [[nodiscard]] uint64_t
@@ -86,6 +86,35 @@ seastar::future<> io_queue::close() noexcept {
     }
 }
 
+seastar::future<> io_queue::flush() noexcept {
+    /*
+     * holding a unit synchronizes with close(), which waits for all units
+     * before releasing the file handle.
+     */
+    auto units = co_await seastar::get_units(ops_, 1);
+    if (file_ != nullptr) {
+        co_await file_->flush();
+        co_return;
+    }
+
+    /*
+     * syncing any handle to the file makes the data written through previous
+     * handles durable, so there is no need to wait for the scheduler to
+     * reopen the queue.
+     */
+    auto file = co_await storage_->open(path_);
+    std::exception_ptr eptr;
+    try {
+        co_await file->flush();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await file->close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+}
+
 void io_queue::submit_read(page& page) noexcept {
     page.set_flag(page::flags::read);
     enqueue_pending(page);
@@ -34,12 +34,15 @@ pager::pager(
   , cache_(cache)
   , sched_(sched)
   , queue_(
-      storage, file_, [](page& page) noexcept { handle_completion(page); }) {
+      storage,
+      file_,
+      [this](page& page) noexcept { handle_completion(page); }) {
     sched_->add_queue(&queue_);
 }
 
 seastar::future<> pager::close() noexcept {
     co_await scheduler::remove_queue(&queue_);
+    clean_cond_.broken();
     for (const auto& page : pages_) {
         cache_->remove(*page);
     }
@@ -103,12 +106,7 @@ seastar::future<> pager::append(seastar::temporary_buffer<char> data) noexcept {
         auto dst = std::span(page->get_write(), page->size()).subspan(off);
         std::copy_n(src.begin(), src.size(), dst.begin());
         data.trim_front(src.size());
-        /*
-         * the scheduler does the right thing if pages are marked more than once
-         * as dirty and resubmitted for write-back.
-         */
-        page->set_flag(page::flags::dirty);
-        sched_->submit_write(&queue_, page);
+        mark_dirty(*page);
         return src.size();
     };
 
@@ -144,6 +142,23 @@ seastar::future<> pager::append(seastar::temporary_buffer<char> data) noexcept {
     size_ = offset;
 }
 
+seastar::future<> pager::flush() noexcept {
+    co_await clean_cond_.wait([this] { return dirty_pages_ == 0; });
+    co_await queue_.flush();
+}
+
+void pager::mark_dirty(page& page) noexcept {
+    if (!page.test_flag(page::flags::dirty)) {
+        page.set_flag(page::flags::dirty);
+        ++dirty_pages_;
+    }
+    /*
+     * the scheduler does the right thing if pages are marked more than once
+     * as dirty and resubmitted for write-back.
+     */
+    sched_->submit_write(&queue_, &page);
+}
+
 seastar::future<seastar::lw_shared_ptr<page>>
 pager::get_page(uint64_t offset) noexcept {
     /*
@@ -224,6 +239,10 @@ void pager::handle_completion(page& page) noexcept {
     } else if (page.test_flag(page::flags::dirty)) {
         vassert(page.test_flag(page::flags::write), "Expected write page");
         page.clear_flag(page::flags::dirty);
+        vassert(dirty_pages_ > 0, "Dirty page accounting underflow");
+        if (--dirty_pages_ == 0) {
+            clean_cond_.broadcast();
+        }
     }
 }
 
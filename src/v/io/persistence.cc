@@ -137,6 +137,10 @@ seastar::future<size_t> disk_persistence::disk_file::dma_write(
       [this, pos, buf, len] { return file_.dma_write(pos, buf, len); });
 }
 
+seastar::future<> disk_persistence::disk_file::flush() noexcept {
+    return seastar::futurize_invoke([this] { return file_.flush(); });
+}
+
 seastar::future<> disk_persistence::disk_file::close() noexcept {
     return maybe_fail_close().then([this] { return file_.close(); });
 }
@@ -288,6 +292,11 @@ seastar::future<size_t> memory_persistence::memory_file::dma_write(
     });
 }
 
+seastar::future<> memory_persistence::memory_file::flush() noexcept {
+    // memory is as durable as it gets
+    return seastar::make_ready_future<>();
+}
+
 seastar::future<> memory_persistence::memory_file::close() noexcept {
     return maybe_fail_close();
 }
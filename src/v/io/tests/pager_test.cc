@@ -84,6 +84,7 @@ public:
     }
 
     io::pager& pager() { return *pager_; }
+    const std::filesystem::path& file() const { return file_; }
 
 private:
     std::filesystem::path file_{"foo"};
@@ -264,6 +265,32 @@ TEST_P(PagerTest, Read) {
     }
 }
 
+TEST_P(PagerTest, FlushWritesBackAppendedData) {
+    pager().flush().get();
+
+    /*
+     * a pager with its own cache over the same file can only see the data if
+     * it was written back to the underlying storage.
+     */
+    const io::page_cache::config cache_config{
+      .cache_size = 2_MiB, .small_size = 1_MiB};
+    io::page_cache cache(cache_config);
+    io::scheduler scheduler(open_files());
+    io::pager reader(file(), file_size(), storage(), &cache, &scheduler);
+
+    seastar::input_stream<char> input1(
+      seastar::data_source(std::make_unique<io::paging_data_source>(
+        &reader, io::paging_data_source::config{0, file_size()})));
+    seastar::input_stream<char> input2(seastar::data_source(
+      std::make_unique<memory_data_source>(data().share())));
+    EXPECT_TRUE(EqualInputStreams(input1, input2));
+
+    reader.close().get();
+
+    // nothing left to write back
+    pager().flush().get();
+}
+
 INSTANTIATE_TEST_SUITE_P(
   Pager,
   PagerTest,
@@ -15,6 +15,7 @@
 namespace kafka::client {
 
 ss::future<> brokers::stop() {
+    _unconnected.clear();
     return ss::parallel_for_each(
       std::move(_brokers),
       [](const shared_broker_t& broker) { return broker->stop(); });
@@ -22,6 +23,12 @@ ss::future<> brokers::stop() {
 
 ss::future<shared_broker_t> brokers::any() {
     if (_brokers.empty()) {
+        if (!_unconnected.empty()) {
+            return find(
+              std::next(
+                _unconnected.begin(), _next_broker++ % _unconnected.size())
+                ->first);
+        }
         return ss::make_exception_future<shared_broker_t>(
           broker_error(unknown_node_id, error_code::broker_not_available));
     }
@@ -33,13 +40,46 @@ ss::future<shared_broker_t> brokers::any() {
 ss::future<shared_broker_t> brokers::find(model::node_id id) {
     auto b_it = _brokers.find(id);
     if (b_it == _brokers.end()) {
+        if (_unconnected.contains(id)) {
+            return connect(id);
+        }
         return ss::make_exception_future<shared_broker_t>(
           broker_error(id, error_code::broker_not_available));
     }
     return ss::make_ready_future<shared_broker_t>(*b_it);
 }
 
+ss::future<shared_broker_t> brokers::connect(model::node_id id) {
+    auto c_it = _connecting.find(id);
+    if (c_it == _connecting.end()) {
+        auto addr = _unconnected.at(id);
+        ss::shared_future<shared_broker_t> f{
+          make_broker(id, addr, _config)
+            .then_wrapped([this, id](ss::future<shared_broker_t> f) {
+                _connecting.erase(id);
+                if (f.failed()) {
+                    return f;
+                }
+                auto broker = f.get();
+                // The broker may have left the metadata while connecting.
+                if (_unconnected.erase(id) == 0) {
+                    return broker->stop()
+                      .finally([broker] {})
+                      .then([id] {
+                          return ss::make_exception_future<shared_broker_t>(
+                            broker_error(id, error_code::broker_not_available));
+                      });
+                }
+                _brokers.emplace(broker);
+                return ss::make_ready_future<shared_broker_t>(broker);
+            })};
+        c_it = _connecting.emplace(id, std::move(f)).first;
+    }
+    return c_it->second.get_future();
+}
+
 ss::future<> brokers::erase(model::node_id node_id) {
+    _unconnected.erase(node_id);
     if (auto b_it = _brokers.find(node_id); b_it != _brokers.end()) {
         auto broker = *b_it;
         _brokers.erase(broker);
@@ -49,6 +89,20 @@ ss::future<> brokers::erase(model::node_id node_id) {
 }
 
 ss::future<> brokers::apply(chunked_vector<metadata_response::broker>&& res) {
+    if (_config.lazy_broker_connections()) {
+        brokers_t brokers;
+        _unconnected.clear();
+        for (const auto& b : res) {
+            if (auto b_it = _brokers.find(b.node_id); b_it != _brokers.end()) {
+                brokers.emplace(*b_it);
+            } else {
+                _unconnected.emplace(
+                  b.node_id, net::unresolved_address(b.host, b.port));
+            }
+        }
+        std::swap(brokers, _brokers);
+        return ss::now();
+    }
     using new_brokers_t = chunked_vector<metadata_response::broker>;
     return ss::do_with(std::move(res), [this](new_brokers_t& new_brokers) {
         auto new_brokers_begin = std::partition(
@@ -92,7 +146,8 @@ ss::future<> brokers::apply(chunked_vector<metadata_response::broker>&& res) {
 }
 
 ss::future<bool> brokers::empty() const {
-    return ss::make_ready_future<bool>(_brokers.empty());
+    return ss::make_ready_future<bool>(
+      _brokers.empty() && _unconnected.empty());
 }
 
 } // namespace kafka::client
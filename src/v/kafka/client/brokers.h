@@ -17,8 +17,10 @@
 #include "kafka/client/configuration.h"
 #include "kafka/protocol/metadata.h"
 #include "model/fundamental.h"
+#include "utils/unresolved_address.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/shared_future.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
@@ -46,10 +48,14 @@ public:
 
     /// \brief Retrieve any broker.
     ///
-    /// The broker returned is fetched using a round-robin strategy.
+    /// The broker returned is fetched using a round-robin strategy. With lazy
+    /// connections, connected brokers are preferred.
     ss::future<shared_broker_t> any();
 
     /// \brief Retrieve the broker for the given node_id.
+    ///
+    /// With lazy connections, connect to the broker if this is the first
+    /// request for it.
     ss::future<shared_broker_t> find(model::node_id id);
 
     /// \brief Remove a broker.
@@ -58,13 +64,24 @@ public:
     /// \brief Apply the given metadata response.
     ss::future<> apply(chunked_vector<metadata_response::broker>&& brokers);
 
-    /// \brief Returns true if there are no connected brokers
+    /// \brief Returns true if there are no connected brokers, or known brokers
+    /// with lazy connections.
     ss::future<bool> empty() const;
 
 private:
+    ss::future<shared_broker_t> connect(model::node_id id);
+
     const configuration& _config;
     /// \brief Brokers map a model::node_id to a client.
     brokers_t _brokers;
+    /// \brief Brokers in the metadata that haven't been connected to yet.
+    ///
+    /// Only used with lazy_broker_connections, where clients that talk to a
+    /// few leaders don't hold a connection to every broker in the cluster.
+    absl::flat_hash_map<model::node_id, net::unresolved_address> _unconnected;
+    /// \brief Connections in progress, shared by concurrent requests.
+    absl::flat_hash_map<model::node_id, ss::shared_future<shared_broker_t>>
+      _connecting;
     /// \brief Next broker to select with round-robin
     size_t _next_broker{0};
 };
@@ -47,7 +47,7 @@ namespace kafka::client {
 client::client(const YAML::Node& cfg, external_mitigate mitigater)
   : _config{cfg}
   , _seeds{_config.brokers()}
-  , _topic_cache{}
+  , _topic_cache{_config}
   , _brokers{_config}
   , _wait_or_start_update_metadata{[this](wait_or_start::tag tag) {
       return update_metadata(tag);
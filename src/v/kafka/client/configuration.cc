@@ -60,6 +60,35 @@ configuration::configuration()
       "Delay (in milliseconds) to wait before sending batch",
       {},
       100ms)
+  , produce_max_in_flight(
+      *this,
+      "produce_max_in_flight",
+      "Number of batches of a partition that can be sent to the broker before "
+      "the response to the first one is received. With more than one, a "
+      "retried batch can be written after the batches sent after it",
+      {},
+      1,
+      [](int32_t v) -> std::optional<ss::sstring> {
+          if (v < 1) {
+              return ss::format("produce_max_in_flight must be at least 1");
+          }
+          return std::nullopt;
+      })
+  , produce_sticky_partition_bytes(
+      *this,
+      "produce_sticky_partition_bytes",
+      "Number of bytes of records without a key or partition to send to the "
+      "same partition before moving on to the next one. 0 assigns each of "
+      "these records to the next partition",
+      {},
+      0,
+      [](int32_t v) -> std::optional<ss::sstring> {
+          if (v < 0) {
+              return ss::format(
+                "produce_sticky_partition_bytes must not be negative");
+          }
+          return std::nullopt;
+      })
   , produce_compression_type(
       *this,
       "produce_compression_type",
@@ -160,6 +189,13 @@ configuration::configuration()
       "client_identifier",
       "Identifier to use within the kafka request header",
       {},
-      "test_client") {}
+      "test_client")
+  , lazy_broker_connections(
+      *this,
+      "lazy_broker_connections",
+      "Connect to a broker when a request is first sent to it, rather than to "
+      "every broker in the metadata",
+      {},
+      false) {}
 
 } // namespace kafka::client
@@ -34,6 +34,8 @@ struct configuration final : public config::config_store {
     config::property<int32_t> produce_batch_record_count;
     config::property<int32_t> produce_batch_size_bytes;
     config::property<std::chrono::milliseconds> produce_batch_delay;
+    config::property<int32_t> produce_max_in_flight;
+    config::property<int32_t> produce_sticky_partition_bytes;
     config::property<ss::sstring> produce_compression_type;
     config::property<std::chrono::milliseconds> produce_shutdown_delay;
     config::property<int16_t> produce_ack_level;
@@ -49,6 +51,7 @@ struct configuration final : public config::config_store {
     config::property<ss::sstring> scram_password;
 
     config::property<std::optional<ss::sstring>> client_identifier;
+    config::property<bool> lazy_broker_connections;
 
     configuration();
     explicit configuration(const YAML::Node& cfg);
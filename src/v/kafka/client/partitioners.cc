@@ -59,6 +59,33 @@ private:
     model::partition_id _next;
 };
 
+class sticky_partitioner final : public partitioner_impl {
+public:
+    sticky_partitioner(model::partition_id initial, size_t sticky_bytes)
+      : partitioner_impl{}
+      , _current(initial)
+      , _sticky_bytes(sticky_bytes) {}
+
+    std::optional<model::partition_id>
+    operator()(const record_essence& rec, size_t partition_count) override {
+        auto p_id = model::partition_id(_current % partition_count);
+        _assigned_bytes += (rec.key ? rec.key->size_bytes() : 0)
+                           + (rec.value ? rec.value->size_bytes() : 0);
+        if (_assigned_bytes >= _sticky_bytes) {
+            // the records assigned so far fill a batch, start the next one on
+            // another partition
+            ++_current;
+            _assigned_bytes = 0;
+        }
+        return p_id;
+    }
+
+private:
+    model::partition_id _current;
+    size_t _sticky_bytes;
+    size_t _assigned_bytes{0};
+};
+
 // Try each partitioner in the list until one succeeds.
 template<typename... Impls>
 class composed_partitioner final : public partitioner_impl {
@@ -98,14 +125,21 @@ partitioner roundrobin_partitioner(model::partition_id initial) {
       std::make_unique<detail::roundrobin_partitioner>(initial)};
 }
 
-partitioner default_partitioner(model::partition_id initial) {
+partitioner
+sticky_partitioner(model::partition_id initial, size_t sticky_bytes) {
+    return partitioner{
+      std::make_unique<detail::sticky_partitioner>(initial, sticky_bytes)};
+}
+
+partitioner
+default_partitioner(model::partition_id initial, size_t sticky_bytes) {
     return partitioner{std::make_unique<detail::composed_partitioner<
       detail::identity_partitioner,
       detail::murmur2_key_partitioner,
-      detail::roundrobin_partitioner>>(
+      detail::sticky_partitioner>>(
       detail::identity_partitioner{},
       detail::murmur2_key_partitioner{},
-      detail::roundrobin_partitioner{initial})};
+      detail::sticky_partitioner{initial, sticky_bytes})};
 }
 
 } // namespace kafka::client
@@ -57,9 +57,16 @@ partitioner murmur2_key_partitioner();
 /// \ref initial
 partitioner roundrobin_partitioner(model::partition_id initial);
 
+/// \brief Returns the same partition_id, starting from \ref initial, until
+/// records of at least \ref sticky_bytes were assigned to it, then moves on
+/// to the next one. With 0 bytes it is a round-robin partitioner.
+partitioner
+sticky_partitioner(model::partition_id initial, size_t sticky_bytes);
+
 /// \brief Returns the partition_id if one exists in the record, or,
 /// returns the murmer2 hash of the key if there is one, or,
-/// returns partition_id based on round-robin.
-partitioner default_partitioner(model::partition_id initial);
+/// returns partition_id based on the sticky partitioner.
+partitioner
+default_partitioner(model::partition_id initial, size_t sticky_bytes = 0);
 
 } // namespace kafka::client
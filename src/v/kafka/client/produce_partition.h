@@ -26,6 +26,10 @@
 namespace kafka::client {
 
 /// \brief Batch multiple client requests, flush them based on size or time.
+///
+/// Up to produce_max_in_flight batches are sent before the response to the
+/// oldest one is received. Batches are consumed one at a time, in the order
+/// of the records, and their responses are handled in the same order.
 class produce_partition {
 public:
     using response = produce_batcher::partition_response;
@@ -48,18 +52,28 @@ public:
     }
 
     void handle_response(response&& res) {
-        vassert(_in_flight, "handle_response requires a batch in flight");
+        vassert(_in_flight > 0, "handle_response requires a batch in flight");
         _batcher.handle_response(std::move(res));
-        _in_flight = false;
-        if (_await_in_flight) {
+        --_in_flight;
+        if (_in_flight == 0 && _await_in_flight) {
             _await_in_flight->set_value();
             _await_in_flight = std::nullopt;
         }
         arm_consumer();
     }
 
+    /// \brief Handle the response of a batch once the responses of the
+    /// batches consumed before it have been handled.
+    void handle_response(ss::future<response> res) {
+        _responses = _responses.then(
+          [this, res = std::move(res)]() mutable -> ss::future<> {
+              return std::move(res).then(
+                [this](response r) { handle_response(std::move(r)); });
+          });
+    }
+
     ss::future<> await_in_flight() {
-        if (!_in_flight) {
+        if (_in_flight == 0) {
             return ss::now();
         }
         vassert(!_await_in_flight, "Double call to await_in_flight()");
@@ -71,7 +85,7 @@ public:
         /// Immediately force flush of buffer
         if (consumer_can_run()) {
             _timer.cancel();
-            _consumer(co_await do_consume());
+            co_await consume();
         }
     }
 
@@ -80,21 +94,29 @@ public:
         co_await try_consume();
         _timer.cancel();
         co_await _gate.close();
+        co_await std::exchange(_responses, ss::now());
     }
 
 private:
-    ss::future<model::record_batch> do_consume() {
-        vassert(!_in_flight, "do_consume should not run concurrently");
+    ss::future<> consume() {
+        vassert(
+          !_consuming && _in_flight < max_in_flight(),
+          "consume should not run concurrently or past the in flight limit");
 
-        _in_flight = true;
+        _consuming = true;
+        ++_in_flight;
         _record_count = 0;
         _size_bytes = 0;
-        return _batcher.consume();
+        auto batch = co_await _batcher.consume();
+        _consuming = false;
+        _consumer(std::move(batch));
+        // more records may have been produced while the batch was built
+        arm_consumer();
     }
 
     ss::future<> try_consume() {
         if (consumer_can_run()) {
-            _consumer(co_await do_consume());
+            co_await consume();
         }
     }
 
@@ -129,9 +151,15 @@ private:
 
     /// \brief Checks to see if the consumer can run
     ///
-    /// Consumer can only run if one is not already running and there are
-    /// records available
-    bool consumer_can_run() const { return !_in_flight && _record_count > 0; }
+    /// Consumer can only run if one is not already running, fewer than
+    /// produce_max_in_flight batches are in flight and there are records
+    /// available
+    bool consumer_can_run() const {
+        return !_consuming && _in_flight < max_in_flight()
+               && _record_count > 0;
+    }
+
+    int32_t max_in_flight() const { return _config.produce_max_in_flight(); }
 
     const configuration& _config;
     produce_batcher _batcher{};
@@ -139,9 +167,12 @@ private:
     consumer _consumer;
     int32_t _record_count{};
     int32_t _size_bytes{};
-    bool _in_flight{};
+    int32_t _in_flight{};
+    bool _consuming{};
     ss::gate _gate;
     std::optional<ss::promise<>> _await_in_flight;
+    // handling of the responses, in the order the batches were consumed
+    ss::future<> _responses{ss::now()};
 };
 
 } // namespace kafka::client
@@ -161,41 +161,45 @@ producer::send(model::topic_partition tp, model::record_batch&& batch) {
       tp,
       record_count);
     auto p_id = tp.partition;
-    return ss::do_with(
-             std::move(batch),
-             [this, tp](model::record_batch& batch) mutable {
-                 return ss::with_gate(_gate, [this, tp, &batch]() {
-                     return retry_with_mitigation(
-                       _config.retries(),
-                       _config.retry_base_backoff(),
-                       [this, tp{std::move(tp)}, &batch]() {
-                           return do_send(tp, batch.share());
-                       },
-                       [this](std::exception_ptr ex) {
-                           return _error_handler(std::move(ex))
-                             .handle_exception([](std::exception_ptr ex) {
-                                 vlog(
-                                   kclog.trace,
-                                   "Error during mitigation: {}",
-                                   ex);
-                                 // ignore failed mitigation
-                             });
-                       },
-                       _as);
-                 });
-             })
+    auto res = ss::do_with(
+                 std::move(batch),
+                 [this, tp](model::record_batch& batch) mutable {
+                     return ss::with_gate(_gate, [this, tp, &batch]() {
+                         return retry_with_mitigation(
+                           _config.retries(),
+                           _config.retry_base_backoff(),
+                           [this, tp{std::move(tp)}, &batch]() {
+                               return do_send(tp, batch.share());
+                           },
+                           [this](std::exception_ptr ex) {
+                               return _error_handler(std::move(ex))
+                                 .handle_exception([](std::exception_ptr ex) {
+                                     vlog(
+                                       kclog.trace,
+                                       "Error during mitigation: {}",
+                                       ex);
+                                     // ignore failed mitigation
+                                 });
+                           },
+                           _as);
+                     });
+                 })
       .handle_exception([p_id](std::exception_ptr ex) {
           return make_produce_response(p_id, std::move(ex));
       })
-      .then([this, tp, record_count](produce_response::partition res) mutable {
+      .then([tp, record_count](produce_response::partition res) {
           vlog(
             kclog.debug,
             "sent record_batch: {}, {{record_count: {}}}, {}",
             tp,
             record_count,
             res.error_code);
-          get_context(std::move(tp))->handle_response(std::move(res));
+          return res;
       });
+    // with more than one batch in flight the responses can be received out of
+    // order, the partition handles them in the order the batches were sent
+    get_context(std::move(tp))->handle_response(std::move(res));
+    return ss::now();
 }
 
 } // namespace kafka::client
@@ -76,3 +76,28 @@ BOOST_AUTO_TEST_CASE(test_default_partitioner) {
     BOOST_REQUIRE_EQUAL(*partitioner(match_key, 6), murmur2(a_key(), 6));
     BOOST_REQUIRE_EQUAL(*partitioner(match_none, 6), initial_partition);
 }
+
+BOOST_AUTO_TEST_CASE(test_sticky_partitioner) {
+    auto partitioner{kc::sticky_partitioner(initial_partition, 10)};
+    auto record = kc::record_essence{
+      .partition_id = no_partition,
+      .key = no_key,
+      .value = make_iobuf("four"),
+      .headers{}};
+    // records stick to a partition until 10 bytes were assigned to it
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE_EQUAL(*partitioner(record, 6), initial_partition);
+    }
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE_EQUAL(
+          *partitioner(record, 6), (initial_partition + 1) % 6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_default_sticky_partitioner) {
+    auto partitioner{kc::default_partitioner(initial_partition, 1024)};
+    BOOST_REQUIRE_EQUAL(*partitioner(match_partition, 6), a_partition);
+    BOOST_REQUIRE_EQUAL(*partitioner(match_key, 6), murmur2(a_key(), 6));
+    BOOST_REQUIRE_EQUAL(*partitioner(match_none, 6), initial_partition);
+    BOOST_REQUIRE_EQUAL(*partitioner(match_none, 6), initial_partition);
+}
@@ -18,6 +18,7 @@
 #include "model/record.h"
 #include "test_utils/async.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/thread_test_case.hh>
 
 #include <boost/test/tools/old/interface.hpp>
@@ -75,3 +76,64 @@ SEASTAR_THREAD_TEST_CASE(test_produce_partition_record_count) {
     BOOST_REQUIRE_EQUAL(c_res2.base_offset, model::offset{3});
     producer.stop().get();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_max_in_flight) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    cfg.produce_batch_size_bytes.set_value(1024);
+    cfg.produce_batch_record_count.set_value(2);
+    // configuration under test
+    cfg.produce_max_in_flight.set_value(2);
+
+    kc::produce_partition producer(cfg, consumer);
+
+    // two batches are sent without waiting for a response
+    auto c_res0_fut = producer.produce(make_batch(model::offset(0), 2));
+    tests::cooperative_spin_wait_with_timeout(5s, [&consumed_batches]() {
+        return consumed_batches.size() > 0;
+    }).get();
+    auto c_res1_fut = producer.produce(make_batch(model::offset(2), 2));
+    tests::cooperative_spin_wait_with_timeout(5s, [&consumed_batches]() {
+        return consumed_batches.size() > 1;
+    }).get();
+
+    // the third one waits for a response
+    auto c_res2_fut = producer.produce(make_batch(model::offset(4), 2));
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 2);
+
+    // responses are handled in the order of the batches, even when they are
+    // received in another order
+    ss::promise<kafka::produce_response::partition> res0;
+    producer.handle_response(res0.get_future());
+    producer.handle_response(
+      ss::make_ready_future<kafka::produce_response::partition>(
+        kafka::produce_response::partition{
+          .partition_index{model::partition_id{42}},
+          .error_code = kafka::error_code::none,
+          .base_offset{model::offset{12}}}));
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!c_res0_fut.available());
+    BOOST_REQUIRE(!c_res1_fut.available());
+
+    res0.set_value(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{10}}});
+    BOOST_REQUIRE_EQUAL(c_res0_fut.get0().base_offset, model::offset{10});
+    BOOST_REQUIRE_EQUAL(c_res1_fut.get0().base_offset, model::offset{12});
+
+    tests::cooperative_spin_wait_with_timeout(5s, [&consumed_batches]() {
+        return consumed_batches.size() > 2;
+    }).get();
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{14}}});
+    BOOST_REQUIRE_EQUAL(c_res2_fut.get0().base_offset, model::offset{14});
+    producer.stop().get();
+}
@@ -152,3 +152,18 @@ FIXTURE_TEST(password_change_live_client, kafka_client_fixture) {
     info("Stopping kafka client");
     kafka_client.stop().get();
 }
+
+FIXTURE_TEST(lazy_broker_connections, kafka_client_fixture) {
+    info("Waiting for leadership");
+    wait_for_controller_leadership().get();
+
+    auto client = make_client();
+    client.config().lazy_broker_connections.set_value(true);
+    client.connect().get();
+    auto stop_client = ss::defer([&client]() { client.stop().get(); });
+
+    // The broker is known from the metadata, and connected on first use.
+    BOOST_REQUIRE(client.is_connected().get());
+    auto res = client.dispatch(make_list_topics_req()).get();
+    BOOST_REQUIRE_EQUAL(res.data.topics.size(), 0);
+}
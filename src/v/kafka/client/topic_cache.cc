@@ -29,7 +29,9 @@ topic_cache::apply(small_fragment_vector<metadata_response::topic>&& topics) {
           random_generators::get_int<model::partition_id::type>(
             t.partitions.size())};
         topic_data topic_data{
-          .partitioner_func = default_partitioner(initial_partition_id)};
+          .partitioner_func = default_partitioner(
+            initial_partition_id,
+            static_cast<size_t>(_config.produce_sticky_partition_bytes()))};
         auto& cache_t
           = cache.emplace(t.name, std::move(topic_data)).first->second;
         cache_t.partitions.reserve(t.partitions.size());
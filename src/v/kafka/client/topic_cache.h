@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "container/fragmented_vector.h"
+#include "kafka/client/configuration.h"
 #include "kafka/client/partitioners.h"
 #include "kafka/client/types.h"
 #include "kafka/protocol/metadata.h"
@@ -39,7 +40,8 @@ class topic_cache {
     using topics_t = absl::node_hash_map<model::topic, topic_data>;
 
 public:
-    topic_cache() = default;
+    explicit topic_cache(const configuration& config)
+      : _config(config) {}
     topic_cache(const topic_cache&) = delete;
     topic_cache(topic_cache&&) = default;
     topic_cache& operator=(topic_cache const&) = delete;
@@ -58,6 +60,7 @@ public:
     partition_for(model::topic_view tv, const record_essence& rec);
 
 private:
+    const configuration& _config;
     /// \brief Cache of topic information.
     topics_t _topics;
 };
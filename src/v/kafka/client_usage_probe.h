@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/configuration.h"
+#include "metrics/metrics.h"
+#include "metrics/prometheus_sanitize.h"
+#include "utils/absl_sstring_hash.h"
+#include "utils/space_saving.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/btree_set.h>
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+namespace kafka {
+
+/*
+ * Attributes the kafka traffic of a shard to the client ids sending it.
+ *
+ * Client ids are unbounded, so only the heaviest ones are counted, with a
+ * space-saving sketch, and only the top few of those are exported. The set
+ * of exported clients is refreshed periodically, which keeps the number of
+ * series bounded while following changes in the workload.
+ */
+class client_usage_probe {
+public:
+    static constexpr size_t tracked_clients = 128;
+    static constexpr size_t exported_clients = 10;
+    static constexpr std::chrono::seconds refresh_interval{60};
+
+    client_usage_probe() = default;
+    client_usage_probe(const client_usage_probe&) = delete;
+    client_usage_probe& operator=(const client_usage_probe&) = delete;
+    client_usage_probe(client_usage_probe&&) = delete;
+    client_usage_probe& operator=(client_usage_probe&&) = delete;
+    ~client_usage_probe() = default;
+
+    void setup_metrics() {
+        if (config::shard_local_cfg().disable_metrics()) {
+            return;
+        }
+        _refresh.set_callback([this] { refresh_metrics(); });
+        _refresh.arm_periodic(refresh_interval);
+    }
+
+    void add_bytes_received(
+      std::optional<std::string_view> client_id, size_t bytes) {
+        if (client_id) {
+            _received.add(*client_id, bytes);
+        }
+    }
+
+    void add_bytes_sent(
+      const std::optional<ss::sstring>& client_id, size_t bytes) {
+        if (client_id) {
+            _sent.add(*client_id, bytes);
+        }
+    }
+
+private:
+    using sketch_t = space_saving<ss::sstring, sstring_hash, sstring_eq>;
+
+    void refresh_metrics() {
+        namespace sm = ss::metrics;
+
+        absl::btree_set<ss::sstring> clients;
+        for (auto& c : _received.top(exported_clients)) {
+            clients.insert(std::move(c.key));
+        }
+        for (auto& c : _sent.top(exported_clients)) {
+            clients.insert(std::move(c.key));
+        }
+
+        _metrics.clear();
+        _exported.assign(clients.begin(), clients.end());
+        const auto client_label = sm::label("client_id");
+        std::vector<sm::impl::metric_definition_impl> defs;
+        defs.reserve(_exported.size() * 2);
+        for (const auto& client : _exported) {
+            std::vector<sm::label_instance> labels{client_label(client)};
+            defs.emplace_back(sm::make_counter(
+              "received_bytes_total",
+              [this, &client] { return _received.count(client); },
+              sm::description(
+                "Bytes received in requests from one of the heaviest clients, "
+                "approximate"),
+              labels));
+            defs.emplace_back(sm::make_counter(
+              "sent_bytes_total",
+              [this, &client] { return _sent.count(client); },
+              sm::description(
+                "Bytes sent in responses to one of the heaviest clients, "
+                "approximate"),
+              labels));
+        }
+        if (!defs.empty()) {
+            _metrics.add_group(
+              prometheus_sanitize::metrics_name("kafka:client_usage"),
+              std::move(defs),
+              {},
+              {sm::shard_label});
+        }
+    }
+
+    sketch_t _received{tracked_clients};
+    sketch_t _sent{tracked_clients};
+    // Owns the client ids that the registered metrics refer to.
+    std::vector<ss::sstring> _exported;
+    ss::timer<ss::lowres_clock> _refresh;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace kafka
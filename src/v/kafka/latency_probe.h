@@ -55,6 +55,25 @@ public:
               sm::description("Produce Latency"),
               labels,
               [this] { return _produce_latency.internal_histogram_logform(); }),
+            sm::make_histogram(
+              "produce_dispatch_latency_us",
+              sm::description(
+                "Time from the start of a produce request until all of its "
+                "batches are enqueued for replication"),
+              labels,
+              [this] {
+                  return _produce_dispatch_latency.internal_histogram_logform();
+              }),
+            sm::make_histogram(
+              "produce_replicate_latency_us",
+              sm::description(
+                "Time from enqueueing the batches of a produce request until "
+                "all of them are replicated"),
+              labels,
+              [this] {
+                  return _produce_replicate_latency
+                    .internal_histogram_logform();
+              }),
           },
           {},
           {sm::shard_label});
@@ -88,13 +107,29 @@ public:
         return _produce_latency.auto_measure();
     }
 
+    seastar::metrics::histogram produce_latency_histogram() const {
+        return _produce_latency.internal_histogram_logform();
+    }
+
     void record_fetch_latency(std::chrono::microseconds micros) {
         _fetch_latency.record(micros.count());
     }
 
+    void record_produce_dispatch_latency(std::chrono::microseconds micros) {
+        _produce_dispatch_latency.record(micros.count());
+    }
+
+    void record_produce_replicate_latency(std::chrono::microseconds micros) {
+        _produce_replicate_latency.record(micros.count());
+    }
+
 private:
     hist_t _produce_latency;
     hist_t _fetch_latency;
+    // Produce latency split at the point where every batch of the request was
+    // enqueued, to tell queueing and hand-off from replication.
+    hist_t _produce_dispatch_latency;
+    hist_t _produce_replicate_latency;
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
 };
@@ -18,12 +18,14 @@
 #include "kafka/protocol/wire.h"
 #include "model/fundamental.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "storage/parser_utils.h"
 
 #include <seastar/core/smp.hh>
 
 #include <fmt/ostream.h>
 
+#include <optional>
 #include <stdexcept>
 
 namespace kafka {
@@ -95,41 +97,51 @@ model::record_batch_header kafka_batch_adapter::read_header(iobuf_parser& in) {
     return header;
 }
 
-void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
+bool kafka_batch_adapter::verify_records(
+  const model::record_batch_header& header, const iobuf& records) {
+    // the checksummed data starts at the attributes, right after the crc. The
+    // header fields it covers are re-encoded the way they arrived, so the
+    // records are the only bytes that have to be walked.
     auto crc = crc::crc32c();
+    model::crc_record_batch_header(crc, header);
 
-    // move the cursor to correct offset where the data to be checksummed
-    // begins. That location skips the following 21 bytes:
-    //
-    //   - 8 base offset
-    //   - 4 batch length
-    //   - 4 partition leader epoch
-    //   - 1 magic
-    //   - 4 exepcted crc
-    //
-    static constexpr size_t checksum_data_offset_start = 21;
-    in.skip(checksum_data_offset_start);
-
-    // 2. consume & checksum the CRC
-    in.consume(in.bytes_left(), [&crc](const char* src, size_t n) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), n);
-        return ss::stop_iteration::no;
-    });
+    /**
+     * Perform some type of validation on the uncompressed input. In this case
+     * we make sure that the records can be parsed, skipping over their keys,
+     * values and headers instead of materializing them, and we avoid
+     * re-encoding them using the lazy-record optimization. It's done in the
+     * same pass over the records as the crc.
+     */
+    std::optional<ss::sstring> parse_error;
+    if (header.attrs.compression() == model::compression::none) {
+        try {
+            model::crc_and_validate_records(
+              crc, records, header.record_count);
+        } catch (const std::exception& e) {
+            parse_error = e.what();
+        }
+    } else {
+        crc_extend_iobuf(crc, records);
+    }
 
     // the crc is calculated over the bytes we receive as a uint32_t, but the
     // crc arrives off the wire as a signed 32-bit value.
-    if (unlikely((uint32_t)expected_crc != crc.value())) {
+    if (unlikely((uint32_t)header.crc != crc.value())) {
         valid_crc = false;
         vlog(
           klog.warn,
           "Cannot validate Kafka record batch. Missmatching CRC. Expected:{}, "
           "Got:{}",
-          expected_crc,
+          header.crc,
           crc.value());
-    } else {
-        valid_crc = true;
+        return false;
     }
+    valid_crc = true;
+    if (unlikely(parse_error.has_value())) {
+        vlog(klog.error, "Parsing uncompressed records: {}", *parse_error);
+        return false;
+    }
+    return true;
 }
 
 iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
@@ -144,17 +156,16 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return iobuf{};
     }
 
-    auto batch_length =
-      [peeker{iobuf_parser(kbatch.share(0, kafka_length_diff))}]() mutable {
-          peeker.skip(sizeof(model::record_batch_header::base_offset));
-          return peeker.consume_be_type<int32_t>() + kafka_length_diff;
-      }();
+    auto batch_length = [&kbatch] {
+        iobuf_const_parser peeker(kbatch);
+        peeker.skip(sizeof(model::record_batch_header::base_offset));
+        return peeker.consume_be_type<int32_t>() + kafka_length_diff;
+    }();
 
     auto remainder = kbatch.share(
       batch_length, kbatch.size_bytes() - batch_length);
     kbatch.trim_back(remainder.size_bytes());
 
-    auto crcparser = iobuf_parser(kbatch.share(0, kbatch.size_bytes()));
     auto parser = iobuf_parser(std::move(kbatch));
 
     auto header = read_header(parser);
@@ -165,34 +176,28 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return remainder;
     }
 
-    verify_crc(header.crc, std::move(crcparser));
-    if (unlikely(!valid_crc)) {
-        vlog(klog.warn, "batch has invalid CRC: {}", header);
-        return remainder;
-    }
-
     auto records_size = header.size_bytes
                         - model::packed_record_batch_header_size;
+    if (unlikely(
+          records_size < 0
+          || parser.bytes_left() != static_cast<size_t>(records_size))) {
+        valid_crc = false;
+        vlog(klog.warn, "batch is truncated: {}", header);
+        return remainder;
+    }
     auto records = parser.share(records_size);
 
-    auto new_batch = model::record_batch(
-      header, std::move(records), model::record_batch::tag_ctor_ng{});
-
-    /**
-     * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
-     */
-    if (!new_batch.compressed()) {
-        try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
-        } catch (const std::exception& e) {
-            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
-            return remainder;
-        }
+    const bool well_formed = verify_records(header, records);
+    if (unlikely(!valid_crc)) {
+        vlog(klog.warn, "batch has invalid CRC: {}", header);
+        return remainder;
+    }
+    if (unlikely(!well_formed)) {
+        return remainder;
     }
 
-    batch = std::move(new_batch);
+    batch = model::record_batch(
+      header, std::move(records), model::record_batch::tag_ctor_ng{});
     return remainder;
 }
 
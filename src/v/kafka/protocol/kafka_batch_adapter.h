@@ -70,7 +70,11 @@ public:
     void adapt_with_version(iobuf, api_version);
 
 private:
-    void verify_crc(int32_t, iobuf_parser);
+    /// Checks the crc of the batch, and that the records can be parsed when
+    /// they aren't compressed, in a single pass over the records. Sets
+    /// valid_crc and returns whether the records are valid.
+    bool
+    verify_records(const model::record_batch_header&, const iobuf& records);
     model::record_batch_header read_header(iobuf_parser&);
     void convert_message_set(storage::record_batch_builder&, iobuf, bool);
 };
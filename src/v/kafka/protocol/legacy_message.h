@@ -97,10 +97,30 @@ inline std::optional<legacy_message> decode_legacy_batch(iobuf_parser& parser) {
     auto base_offset = model::offset(parser.consume_be_type<int64_t>());
     auto batch_length = parser.consume_be_type<int32_t>();
     auto expected_crc = parser.consume_be_type<int32_t>();
+    if (unlikely(batch_length < static_cast<int32_t>(sizeof(int32_t)))) {
+        vlog(klog.error, "Invalid legacy batch length {}", batch_length);
+        return std::nullopt;
+    }
     // bytes covered by crc start immediately after the crc value, but not
-    // including it
-    auto crc_parser = iobuf_parser(
-      parser.share_no_consume(batch_length - sizeof(int32_t)));
+    // including it. they are read in place rather than through a shared
+    // copy of the message to save an allocation per message.
+    const auto crc_length = static_cast<size_t>(batch_length)
+                            - sizeof(int32_t);
+    crc::crc32 computed_crc;
+    auto crc_consumed = parser.peek_consume(
+      crc_length, [&computed_crc](const char* src, size_t n) {
+          computed_crc.extend(
+            reinterpret_cast<const uint8_t*>(src), n); // NOLINT
+          return ss::stop_iteration::no;
+      });
+    if (unlikely(crc_consumed != crc_length)) {
+        vlog(
+          klog.error,
+          "Legacy batch is truncated. Expected length {}, available {}",
+          batch_length,
+          crc_consumed + sizeof(int32_t));
+        return std::nullopt;
+    }
     auto magic = parser.consume_type<int8_t>();
     if (unlikely(magic != 0 && magic != 1)) {
         vlog(klog.error, "Expected magic 0 or 1 got {}", magic);
@@ -112,14 +132,6 @@ inline std::optional<legacy_message> decode_legacy_batch(iobuf_parser& parser) {
         timestamp = model::timestamp(parser.consume_be_type<int64_t>());
     }
 
-    crc::crc32 computed_crc;
-    crc_parser.consume(
-      crc_parser.bytes_left(), [&computed_crc](const char* src, size_t n) {
-          computed_crc.extend(
-            reinterpret_cast<const uint8_t*>(src), n); // NOLINT
-          return ss::stop_iteration::no;
-      });
-
     if (unlikely(static_cast<uint32_t>(expected_crc) != computed_crc.value())) {
         vlog(
           klog.error,
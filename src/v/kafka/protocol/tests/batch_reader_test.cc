@@ -122,6 +122,36 @@ SEASTAR_THREAD_TEST_CASE(consumer_records_consume_batch) {
     BOOST_REQUIRE_EQUAL(last_offset, ctx.last_offset);
 }
 
+SEASTAR_THREAD_TEST_CASE(serializer_shares_large_batches) {
+    auto batch = model::test::make_random_batch(model::test::record_batch_spec{
+      .offset = base_offset,
+      .allow_compression = false,
+      .count = 1,
+      .record_sizes = std::vector<size_t>{
+        kafka::protocol::zero_copy_batch_threshold}});
+    const auto* data = batch.data().begin()->get();
+
+    std::vector<model::record_batch> input;
+    input.push_back(std::move(batch));
+    auto res = model::make_memory_record_batch_reader(std::move(input))
+                 .consume(kafka::kafka_batch_serializer{}, model::no_timeout)
+                 .get();
+
+    // the record data is linked into the output rather than copied
+    BOOST_REQUIRE(std::any_of(
+      res.data.begin(), res.data.end(), [data](const auto& f) {
+          return f.get() == data;
+      }));
+
+    // and it still reads back as a valid batch
+    auto crs = kafka::batch_reader(std::move(res.data));
+    auto kba = crs.consume_batch();
+    BOOST_REQUIRE(kba.v2_format);
+    BOOST_REQUIRE(kba.valid_crc);
+    BOOST_REQUIRE(kba.batch);
+    BOOST_REQUIRE(crs.empty());
+}
+
 SEASTAR_THREAD_TEST_CASE(consumer_records_consume_batch_fail_magic) {
     auto ctx = make_context(base_offset, few_batches);
     corrupt_offset<int32_t>(
@@ -25,6 +25,8 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -348,6 +350,11 @@ concept SizedContainer = requires(C c, const C cc) {
 };
 
 class encoder;
+
+/// Record data of at least this size is linked into fetch responses rather
+/// than copied.
+inline constexpr size_t zero_copy_batch_threshold = 4096;
+
 void writer_serialize_batch(encoder& w, model::record_batch&& batch);
 
 class encoder {
@@ -503,28 +510,42 @@ public:
         if (!rdr) {
             return write(std::optional<iobuf>());
         }
-        return write(std::move(*rdr).release());
+        return write_records(std::move(*rdr).release());
     }
 
     uint32_t write(std::optional<batch_reader>& rdr) {
         if (!rdr) {
             return write(std::optional<iobuf>());
         }
-        return write(std::move(*rdr).release());
+        return write_records(std::move(*rdr).release());
     }
 
     uint32_t write_flex(std::optional<batch_reader>&& rdr) {
         if (!rdr) {
             return write_flex(std::optional<iobuf>());
         }
-        return write_flex(std::move(*rdr).release());
+        return write_flex_records(std::move(*rdr).release());
     }
 
     uint32_t write_flex(std::optional<batch_reader>& rdr) {
         if (!rdr) {
             return write_flex(std::optional<iobuf>());
         }
-        return write_flex(std::move(*rdr).release());
+        return write_flex_records(std::move(*rdr).release());
+    }
+
+    // write bytes directly to output without a length prefix
+    uint32_t write_direct(std::string_view v) {
+        _out->append(v.data(), v.size());
+        return v.size();
+    }
+
+    // write bytes directly to output without a length prefix, linking rather
+    // than copying the fragments of `f`
+    uint32_t write_direct_fragments(iobuf&& f) {
+        auto size = f.size_bytes();
+        _out->append_fragments(std::move(f));
+        return size;
     }
 
     // write bytes directly to output without a length prefix
@@ -685,6 +706,24 @@ public:
     }
 
 private:
+    /*
+     * Record sets are built by kafka_batch_serializer, which already decided
+     * which batches to copy and which to link. Linking its fragments as they
+     * are avoids copying every fetched byte a second time, which append(iobuf)
+     * would do for fragments smaller than the last allocation.
+     */
+    uint32_t write_records(iobuf&& data) {
+        const auto size = data.size_bytes();
+        return serialize_int<int32_t>(size)
+               + write_direct_fragments(std::move(data));
+    }
+
+    uint32_t write_flex_records(iobuf&& data) {
+        const auto size = data.size_bytes();
+        return write_unsigned_varint(size + 1)
+               + write_direct_fragments(std::move(data));
+    }
+
     iobuf* _out;
 };
 
@@ -709,21 +748,42 @@ inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
                 + internal::kafka_header_size - sizeof(int64_t)
                 - sizeof(int32_t);
 
-    w.write(int64_t(batch.base_offset()));
-    w.write(int32_t(size)); // batch length
-    w.write(
-      int32_t(leader_epoch_from_term(batch.term()))); // partition leader epoch
-    w.write(int8_t(2));                               // magic
-    w.write(batch.header().crc);
-    w.write(int16_t(batch.header().attrs.value()));
-    w.write(int32_t(batch.header().last_offset_delta));
-    w.write(int64_t(batch.header().first_timestamp.value()));
-    w.write(int64_t(batch.header().max_timestamp.value()));
-    w.write(int64_t(batch.header().producer_id));
-    w.write(int16_t(batch.header().producer_epoch));
-    w.write(int32_t(batch.header().base_sequence));
-    w.write(int32_t(batch.record_count()));
-    w.write_direct(std::move(batch).release_data());
+    // the header is assembled on the stack and appended in one go rather
+    // than field by field.
+    std::array<char, internal::kafka_header_size> hdr;
+    auto* out = hdr.data();
+    auto put = [&out]<typename T>(T v) {
+        auto be = ss::cpu_to_be(v);
+        std::memcpy(out, &be, sizeof(be));
+        out += sizeof(be);
+    };
+    const auto& h = batch.header();
+    put(int64_t(h.base_offset));
+    put(int32_t(size));                                 // batch length
+    put(int32_t(leader_epoch_from_term(batch.term()))); // leader epoch
+    put(int8_t(2));                                     // magic
+    put(int32_t(h.crc));
+    put(int16_t(h.attrs.value()));
+    put(int32_t(h.last_offset_delta));
+    put(int64_t(h.first_timestamp.value()));
+    put(int64_t(h.max_timestamp.value()));
+    put(int64_t(h.producer_id));
+    put(int16_t(h.producer_epoch));
+    put(int32_t(h.base_sequence));
+    put(int32_t(h.record_count));
+    w.write_direct(std::string_view(hdr.data(), hdr.size()));
+
+    /*
+     * record data is shared with its source (e.g. the batch cache) rather
+     * than copied once the batch is large enough for the extra fragment and
+     * iovec to be cheaper than a copy. smaller batches are linearized.
+     */
+    auto data = std::move(batch).release_data();
+    if (data.size_bytes() >= zero_copy_batch_threshold) {
+        w.write_direct_fragments(std::move(data));
+    } else {
+        w.write_direct(std::move(data));
+    }
 }
 
 } // namespace kafka::protocol
@@ -16,6 +16,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/util/shared_token_bucket.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <numeric>
 #include <vector>
@@ -78,6 +79,17 @@ public:
     /// replenished
     uint64_t rate() const { return _bucket.rate(); }
 
+    /// Replenishes the bucket and returns the tokens left in it, zero if it
+    /// is in deficit
+    uint64_t update_and_get_available(const clock::time_point& now) {
+        replenish(now);
+        // head and tail are wrapping counters, tail runs ahead of head when
+        // the bucket is in deficit
+        const auto available = static_cast<int64_t>(
+          _bucket.head() - _bucket.tail());
+        return available > 0 ? static_cast<uint64_t>(available) : 0;
+    }
+
 private:
     template<typename delay_t>
     delay_t delay_for(uint64_t grab_result) {
@@ -93,3 +105,58 @@ private:
 
     bucket_t _bucket;
 };
+
+// token_lease is the shard local end of an atomic_token_bucket shared by all
+// shards. Rather than taking every recorded value from the shared bucket, a
+// shard takes tokens in leases and records values against its lease, so the
+// shared bucket is only touched once the lease runs out. The lease size
+// adapts to how fast the shard uses it up: leases used up within
+// `refresh_interval` double, up to the given maximum, and leases are back to
+// the size of the recorded value after the bucket went into deficit. The
+// tokens left in leases are already taken from the shared bucket, so the
+// node wide rate is exact up to the tokens outstanding in leases.
+class token_lease {
+public:
+    using clock = atomic_token_bucket::clock;
+
+    static constexpr auto refresh_interval = std::chrono::milliseconds(10);
+
+    /// Records `v` tokens against the lease, taking a new lease of at most
+    /// `max_lease` tokens from `bucket` if the lease doesn't have enough.
+    /// Returns the delay necessary to replenish the deficit of the bucket.
+    template<typename delay_t>
+    delay_t record_and_calculate_delay(
+      atomic_token_bucket& bucket,
+      const clock::time_point& now,
+      uint64_t v,
+      uint64_t max_lease) {
+        if (v <= _tokens) {
+            _tokens -= v;
+            return delay_t::zero();
+        }
+        const auto needed = v - _tokens;
+        if (now - _leased_at < refresh_interval) {
+            _lease_size = std::min(
+              std::max(_lease_size * 2, needed), max_lease);
+        } else {
+            _lease_size /= 2;
+        }
+        const auto lease = std::max(needed, _lease_size);
+        auto delay = bucket.update_and_calculate_delay<delay_t>(now, lease);
+        if (delay > delay_t::zero()) {
+            // don't take tokens in advance for a client that is throttled
+            _lease_size = 0;
+        }
+        _tokens = lease - needed;
+        _leased_at = now;
+        return delay;
+    }
+
+    /// Returns the tokens left in the lease
+    uint64_t tokens() const { return _tokens; }
+
+private:
+    uint64_t _tokens{0};
+    uint64_t _lease_size{0};
+    clock::time_point _leased_at;
+};
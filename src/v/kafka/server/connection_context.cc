@@ -23,6 +23,8 @@
 #include "kafka/server/handlers/fetch.h"
 #include "kafka/server/handlers/handler_interface.h"
 #include "kafka/server/handlers/produce.h"
+#include "kafka/server/handlers/sasl_authenticate.h"
+#include "kafka/server/handlers/sasl_handshake.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/protocol_utils.h"
 #include "kafka/server/quota_manager.h"
@@ -162,11 +164,15 @@ connection_context::connection_context(
   std::optional<security::tls::mtls_state> mtls_state,
   config::binding<uint32_t> max_request_size,
   config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
-    kafka_throughput_controlled_api_keys) noexcept
+    kafka_throughput_controlled_api_keys,
+  size_t max_pipelined_requests) noexcept
   : _hook(hook)
   , _server(s)
   , conn(conn)
   , _protocol_state()
+  , _max_pipelined_requests(max_pipelined_requests)
+  , _pipelined_requests(
+      max_pipelined_requests, "kafka/connection-pipelined-requests")
   , _as()
   , _sasl(std::move(sasl))
   // tests may build a context without a live connection
@@ -406,6 +412,7 @@ ss::future<> connection_context::process_one_request() {
         co_return;
     }
     _server.handler_probe(h->key).add_bytes_received(sz.value());
+    _server.client_usage_probe().add_bytes_received(h->client_id, sz.value());
     /**
      * An entry point for the MPX serverless extensions. If the first request
      * for a given connection has a special client_id then MPX extensions are
@@ -424,6 +431,17 @@ ss::future<> connection_context::process_one_request() {
     try {
         co_return co_await dispatch_method_once(
           std::move(h.value()), sz.value());
+    } catch (...) {
+        auto e = std::current_exception();
+        if (!handle_request_error(e)) {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
+bool connection_context::handle_request_error(const std::exception_ptr& eptr) {
+    try {
+        std::rethrow_exception(eptr);
     } catch (const kafka_api_version_not_supported_exception& e) {
         vlog(
           klog.warn,
@@ -455,7 +473,10 @@ ss::future<> connection_context::process_one_request() {
         conn->shutdown_input();
     } catch (const ss::sleep_aborted&) {
         // shutdown started while force-throttling
+    } catch (...) {
+        return false;
     }
+    return true;
 }
 
 /*
@@ -722,8 +743,7 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
     if (
       !_is_virtualized_connection
       || rctx.header().client_id == multi_proxy_initial_client_id) {
-        co_return co_await _protocol_state.process_request(
-          shared_from_this(), std::move(rctx), sres);
+        co_return co_await dispatch_in_order(std::move(rctx), std::move(sres));
     }
     auto client_connection_id = parse_virtual_connection_id(rctx.header());
     rctx.override_client_id(client_connection_id.client_id);
@@ -745,6 +765,70 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
       shared_from_this(), std::move(rctx), sres);
 }
 
+bool connection_context::can_pipeline(const request_header& hdr) const {
+    if (_max_pipelined_requests == 0) {
+        return false;
+    }
+    /*
+     * authentication requests change how the requests that follow them are
+     * read and handled (see client_protocol_state::process_request), they and
+     * everything sent before the authentication completes are processed one
+     * at a time.
+     */
+    if (_sasl && !_sasl->complete()) {
+        return false;
+    }
+    return hdr.key != sasl_handshake_handler::api::key
+           && hdr.key != sasl_authenticate_handler::api::key;
+}
+
+ss::future<> connection_context::dispatch_in_order(
+  request_context rctx, ss::lw_shared_ptr<session_resources> sres) {
+    if (!can_pipeline(rctx.header())) {
+        auto u = co_await _dispatch_lock.get_units();
+        co_return co_await _protocol_state.process_request(
+          shared_from_this(), std::move(rctx), std::move(sres));
+    }
+    // reading off the connection stops once enough requests are waiting
+    auto pipeline_u = co_await ss::get_units(_pipelined_requests, 1);
+    // waiters of the lock are served in order, so are the requests
+    auto dispatch_u = _dispatch_lock.get_units();
+    ssx::spawn_with_gate(
+      _gate,
+      [this,
+       dispatch_u = std::move(dispatch_u),
+       pipeline_u = std::move(pipeline_u),
+       rctx = std::move(rctx),
+       sres = std::move(sres)]() mutable {
+          return dispatch_pipelined(
+            std::move(dispatch_u),
+            std::move(pipeline_u),
+            std::move(rctx),
+            std::move(sres));
+      });
+}
+
+ss::future<> connection_context::dispatch_pipelined(
+  ss::future<mutex::units> dispatch_units,
+  ssx::semaphore_units pipeline_units,
+  request_context rctx,
+  ss::lw_shared_ptr<session_resources> sres) {
+    // released once the request is dispatched and the next one can be read
+    auto units = std::move(pipeline_units);
+    auto self = shared_from_this();
+    try {
+        auto u = co_await std::move(dispatch_units);
+        co_await _protocol_state.process_request(
+          self, std::move(rctx), std::move(sres));
+    } catch (...) {
+        auto e = std::current_exception();
+        if (!handle_request_error(e)) {
+            vlog(klog.info, "Detected error processing request: {}", e);
+            conn->shutdown_input();
+        }
+    }
+}
+
 ss::future<> connection_context::virtual_connection_state::process_request(
   ss::lw_shared_ptr<connection_context> connection_ctx,
   request_context rctx,
@@ -931,8 +1015,14 @@ connection_context::client_protocol_state::do_process_responses(
     }
     connection_ctx->_server.handler_probe(request_key)
       .add_bytes_sent(response_size);
+    connection_ctx->_server.client_usage_probe().add_bytes_sent(
+      resp_and_res.resources->request_data.client_id, response_size);
     try {
-        co_await connection_ctx->conn->write(std::move(msg));
+        // requests dispatched after this one will be answered shortly, let
+        // the stream batch their responses into one flush
+        const auto more = net::batched_output_stream::more_pending(
+          _seq_idx > _next_response);
+        co_await connection_ctx->conn->write(std::move(msg), more);
     } catch (...) {
         resp_and_res.resources->tracker->mark_errored();
         vlog(
@@ -158,7 +158,8 @@ public:
       std::optional<security::tls::mtls_state> mtls_state,
       config::binding<uint32_t> max_request_size,
       config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
-        kafka_throughput_controlled_api_keys) noexcept;
+        kafka_throughput_controlled_api_keys,
+      size_t max_pipelined_requests) noexcept;
     ~connection_context() noexcept;
 
     connection_context(const connection_context&) = delete;
@@ -251,6 +252,21 @@ private:
     ss::future<session_resources>
     throttle_request(request_data r_data, size_t sz);
 
+    /// Requests that don't change the state of the connection can be
+    /// pipelined: the next requests are read while they are dispatched.
+    bool can_pipeline(const request_header&) const;
+    // Dispatches requests in the order they were read off the connection.
+    ss::future<>
+      dispatch_in_order(request_context, ss::lw_shared_ptr<session_resources>);
+    ss::future<> dispatch_pipelined(
+      ss::future<mutex::units>,
+      ssx::semaphore_units,
+      request_context,
+      ss::lw_shared_ptr<session_resources>);
+    /// Handles the errors that end the processing of a request, returns
+    /// false if the error isn't one of them.
+    bool handle_request_error(const std::exception_ptr&);
+
     ss::future<> do_process(request_context);
 
     ss::future<> handle_auth_v0(size_t);
@@ -478,6 +494,17 @@ private:
       ss::lw_shared_ptr<virtual_connection_state>>
       _virtual_states;
 
+    /**
+     * Requests are dispatched one at a time, in the order they were read.
+     * While a request is dispatched up to `max_pipelined_requests` of the
+     * following ones are already read off the connection, throttled and hold
+     * their memory units, so the decoding and accounting of pipelined
+     * requests of a client isn't stuck behind a request that takes long to
+     * dispatch, like a produce waiting for its batches to be replicated.
+     */
+    mutex _dispatch_lock{"connection_context::dispatch_lock"};
+    const size_t _max_pipelined_requests;
+    ssx::semaphore _pipelined_requests;
     ss::gate _gate;
     ssx::sharded_abort_source _as;
     std::optional<security::sasl_server> _sasl;
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "container/chunked_hash_map.h"
+#include "kafka/protocol/types.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/metadata.h"
+#include "model/record.h"
+#include "model/timestamp.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Caches the encoded data fetches read from the partitions of a shard. When
+ * many consumer groups tail the same partition they fetch from the same offset
+ * one after another, and without the cache each fetch reads and encodes the
+ * same batches again. With it they share the buffers of the first read.
+ *
+ * The data a read returns only depends on where it starts, how far it may go
+ * and how many bytes it may return. A read goes up to the high watermark, or
+ * to the max offset derived from the last stable offset for read_committed,
+ * so a payload stays valid until the leader epoch, the high watermark or the
+ * max offset of its partition changes. A payload read with a given max_bytes
+ * is served to fetches with the same max_bytes. If the read reached the end
+ * of the readable range, it is also served to fetches with a larger max_bytes
+ * since they would read the same batches.
+ *
+ * Entries are short lived: they expire after the configured ttl and the cache
+ * starts over when it holds more than `max_bytes` or `max_entries`.
+ */
+class fetch_response_cache {
+public:
+    struct key {
+        model::ktp ktp;
+        model::offset start_offset;
+        model::isolation_level isolation_level;
+
+        bool operator==(const key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const key& k) {
+            return H::combine(
+              std::move(h),
+              std::hash<model::ktp>{}(k.ktp),
+              k.start_offset(),
+              k.isolation_level);
+        }
+    };
+
+    struct version {
+        kafka::leader_epoch leader_epoch;
+        model::offset high_watermark;
+        model::offset max_offset;
+
+        bool operator==(const version&) const = default;
+    };
+
+    struct payload {
+        iobuf data;
+        uint32_t record_count{0};
+        model::timestamp first_timestamp;
+        std::vector<model::tx_range> aborted_transactions;
+    };
+
+    static constexpr size_t max_bytes = 16_MiB;
+    static constexpr size_t max_entries = 10'000;
+
+    /// Returns the payload cached for `k` if it was read at `v` and may be
+    /// served to a fetch of at most `max_bytes_requested` bytes, nullptr
+    /// otherwise.
+    payload* get(
+      const key& k,
+      version v,
+      size_t max_bytes_requested,
+      bool strict_max_bytes,
+      ss::lowres_clock::duration ttl) {
+        auto it = _cache.find(k);
+        if (it == _cache.end()) {
+            return nullptr;
+        }
+        auto& e = it->second;
+        if (
+          e.v != v || e.inserted + ttl < ss::lowres_clock::now()
+          || !e.serves(max_bytes_requested, strict_max_bytes)) {
+            return nullptr;
+        }
+        return &e.p;
+    }
+
+    /// Caches `p` read at `v` with the given max_bytes. `complete` says whether
+    /// the read reached the end of the readable range of the partition.
+    void put(
+      const key& k,
+      version v,
+      size_t max_bytes_read,
+      bool strict_max_bytes,
+      bool complete,
+      payload p) {
+        const auto size = p.data.size_bytes();
+        if (size > max_bytes) {
+            return;
+        }
+        if (auto it = _cache.find(k); it != _cache.end()) {
+            _bytes -= it->second.p.data.size_bytes();
+            _cache.erase(it);
+        }
+        if (_bytes + size > max_bytes || _cache.size() >= max_entries) {
+            // entries expire quickly and are invalidated by every append,
+            // rather than tracking their age start over
+            clear();
+        }
+        _bytes += size;
+        _cache.emplace(
+          k,
+          entry{
+            .v = v,
+            .max_bytes_read = max_bytes_read,
+            .strict_max_bytes = strict_max_bytes,
+            .complete = complete,
+            .inserted = ss::lowres_clock::now(),
+            .p = std::move(p),
+          });
+    }
+
+    void clear() {
+        _cache.clear();
+        _bytes = 0;
+    }
+
+    /**
+     * @brief Return the number of payloads currently cached.
+     */
+    size_t size() const { return _cache.size(); }
+
+    /**
+     * @brief Return the number of bytes currently cached.
+     */
+    size_t size_bytes() const { return _bytes; }
+
+private:
+    struct entry {
+        version v;
+        size_t max_bytes_read;
+        bool strict_max_bytes;
+        bool complete;
+        ss::lowres_clock::time_point inserted;
+        payload p;
+
+        bool serves(size_t max_bytes_requested, bool strict) const {
+            if (
+              max_bytes_requested == max_bytes_read
+              && strict == strict_max_bytes) {
+                return true;
+            }
+            return complete && p.data.size_bytes() <= max_bytes_requested;
+        }
+    };
+
+    chunked_hash_map<key, entry> _cache;
+    size_t _bytes{0};
+};
+
+} // namespace kafka
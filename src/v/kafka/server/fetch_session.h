@@ -55,6 +55,10 @@ private:
         explicit entry(kafka::fetch_session_partition partition)
           : partition(std::move(partition)) {}
 
+        size_t name_bytes() const {
+            return partition.topic_partition.get_topic()().size();
+        }
+
         kafka::fetch_session_partition partition;
         intrusive_list_hook _hook;
     };
@@ -134,13 +138,19 @@ public:
           "Can not insert {} to partitions map as it is already present.",
           it->second->partition.topic_partition);
         insertion_order.push_back(*it->second);
+        _names_bytes += it->second->name_bytes();
     }
 
     bool contains(model::topic_partition_view v) {
         return partitions.contains(v);
     }
 
-    void erase(model::topic_partition_view v) { partitions.erase(v); }
+    void erase(model::topic_partition_view v) {
+        if (auto it = partitions.find(v); it != partitions.end()) {
+            _names_bytes -= it->second->name_bytes();
+            partitions.erase(it);
+        }
+    }
 
     iterator find(model::topic_partition_view v) { return partitions.find(v); }
 
@@ -164,7 +174,7 @@ public:
         using debug = absl::container_internal::hashtable_debug_internal::
           HashtableDebugAccess<underlying_t>;
         return debug::AllocatedByteSize(partitions)
-               + partitions.size() * sizeof(fetch_session_partition);
+               + partitions.size() * sizeof(entry) + _names_bytes;
     }
 
     void move_to_end(iterator it) {
@@ -184,6 +194,8 @@ public:
 private:
     underlying_t partitions;
     intrusive_list<entry, &entry::_hook> insertion_order;
+    // topic names are held by each entry, count them as if on the heap
+    size_t _names_bytes{0};
 };
 
 inline fetch_session_epoch next_epoch(fetch_session_epoch current) {
@@ -218,6 +230,7 @@ public:
     void advance_epoch() {
         _epoch = next_epoch(_epoch);
         _last_used = model::timeout_clock::now();
+        ++_uses;
     }
 
     bool is_locked() const { return _locked; }
@@ -235,6 +248,9 @@ private:
     model::timeout_clock::time_point _last_used;
     fetch_session_epoch _epoch;
     bool _locked;
+    // number of fetches, decays over time, used to pick the sessions evicted
+    // when the cache is over its memory budget
+    uint64_t _uses{1};
 };
 
 using fetch_session_ptr = ss::lw_shared_ptr<fetch_session>;
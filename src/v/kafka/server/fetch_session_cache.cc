@@ -10,7 +10,10 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <algorithm>
 #include <chrono>
+#include <tuple>
+#include <vector>
 
 namespace kafka {
 
@@ -42,11 +45,13 @@ void update_fetch_session(fetch_session& session, const fetch_request& req) {
 }
 
 fetch_session_cache::fetch_session_cache(
-  std::chrono::milliseconds eviction_timeout)
+  std::chrono::milliseconds eviction_timeout,
+  config::binding<size_t> max_mem_usage)
   : _min_session_id(max_sessions_per_core() * seastar::this_shard_id())
   , _max_session_id(max_sessions_per_core() + _min_session_id - 1)
   , _last_session_id(_min_session_id)
-  , _session_eviction_duration(eviction_timeout) {
+  , _session_eviction_duration(eviction_timeout)
+  , _max_mem_usage(std::move(max_mem_usage)) {
     register_metrics();
     _session_eviction_timer.set_callback([this] {
         gc_sessions();
@@ -68,8 +73,7 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
         if (session_id != invalid_fetch_session_id) {
             if (auto it = _sessions.find(session_id); it != _sessions.end()) {
                 vlog(klog.debug, "removing fetch session {}", session_id);
-                _sessions_mem_usage -= it->second->mem_usage();
-                _sessions.erase(it);
+                erase(it);
             }
         }
         if (epoch == final_fetch_session_epoch) {
@@ -136,8 +140,11 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
 
 // we split whole range from 1 to max int32_t betewen all shards
 std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
+    if (mem_usage() > _max_mem_usage()) {
+        evict_over_budget();
+    }
     if (unlikely(
-          mem_usage() > max_mem_usage
+          mem_usage() > _max_mem_usage()
           || _sessions.size() > max_sessions_per_core())) {
         return std::nullopt;
     }
@@ -154,19 +161,65 @@ std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
 
 void fetch_session_cache::gc_sessions() {
     auto now = model::timeout_clock::now();
-    for (auto it = _sessions.cbegin(); it != _sessions.cend();) {
+    for (auto it = _sessions.begin(); it != _sessions.end();) {
         // session is in use or was used recently skip
         if (
           it->second->is_locked()
           || now - it->second->_last_used < _session_eviction_duration) {
-            // do nothing
+            // age the frequency of use
+            it->second->_uses /= 2;
             ++it;
         } else {
             vlog(klog.debug, "evicting session {}", it->second->id());
-            _sessions_mem_usage -= it->second->mem_usage();
-            _sessions.erase(it++);
+            erase(it++);
+        }
+    }
+    if (mem_usage() > _max_mem_usage()) {
+        evict_over_budget();
+    }
+}
+
+void fetch_session_cache::evict_over_budget() {
+    struct candidate {
+        uint64_t uses;
+        model::timeout_clock::time_point last_used;
+        fetch_session_id id;
+    };
+    std::vector<candidate> candidates;
+    candidates.reserve(_sessions.size());
+    for (const auto& [id, session] : _sessions) {
+        if (!session->is_locked()) {
+            candidates.push_back(candidate{
+              .uses = session->_uses,
+              .last_used = session->_last_used,
+              .id = id});
         }
     }
+    // least frequently used first, least recently used on ties
+    std::sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const candidate& lhs, const candidate& rhs) {
+          return std::tie(lhs.uses, lhs.last_used)
+                 < std::tie(rhs.uses, rhs.last_used);
+      });
+    for (const auto& c : candidates) {
+        if (mem_usage() <= _max_mem_usage()) {
+            break;
+        }
+        vlog(
+          klog.debug,
+          "evicting session {} used {} times to free memory",
+          c.id,
+          c.uses);
+        erase(_sessions.find(c.id));
+        ++_evicted_sessions;
+    }
+}
+
+void fetch_session_cache::erase(underlying_t::iterator it) {
+    _sessions_mem_usage -= it->second->mem_usage();
+    _sessions.erase(it);
 }
 
 void fetch_session_cache::register_metrics() {
@@ -184,7 +237,13 @@ void fetch_session_cache::register_metrics() {
        sm::make_gauge(
          "sessions_count",
          [this] { return _sessions.size(); },
-         sm::description("Total number of fetch sessions"))});
+         sm::description("Total number of fetch sessions")),
+       sm::make_counter(
+         "sessions_evicted",
+         [this] { return _evicted_sessions; },
+         sm::description(
+           "Number of fetch sessions evicted to stay within the memory budget, "
+           "their clients have to start over with a full fetch"))});
 }
 
 } // namespace kafka
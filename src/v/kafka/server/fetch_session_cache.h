@@ -10,7 +10,7 @@
  */
 #pragma once
 
-#include "base/units.h"
+#include "config/property.h"
 #include "kafka/server/fetch_session.h"
 #include "metrics/metrics.h"
 
@@ -30,21 +30,30 @@ struct fetch_request;
  * for the node (non overlapping ranges of ids are assigned to each core).
  *
  * The cache evicts not used sessions after configurable period of inactivity.
- * Fetch session cache will stop adding new sessions after its max memory usage
- * is reached.
+ * When its memory usage goes over the configured budget the cache evicts the
+ * least frequently used sessions that aren't in use, the clients of evicted
+ * sessions have to start over with a full fetch. The frequency of use of
+ * sessions decays over time, so that sessions that used to be busy don't
+ * stay forever. If there isn't anything left to evict, new sessions aren't
+ * added.
  **/
 class fetch_session_cache {
 public:
-    explicit fetch_session_cache(std::chrono::milliseconds);
+    fetch_session_cache(
+      std::chrono::milliseconds, config::binding<size_t> max_mem_usage);
     fetch_session_ctx maybe_get_session(const fetch_request& req);
     size_t size() const { return _sessions.size(); }
 
+    size_t mem_usage() const {
+        using debug = absl::container_internal::hashtable_debug_internal::
+          HashtableDebugAccess<underlying_t>;
+        return debug::AllocatedByteSize(_sessions) + _sessions_mem_usage;
+    }
+
 private:
     using underlying_t
       = absl::flat_hash_map<fetch_session_id, fetch_session_ptr>;
 
-    static constexpr size_t max_mem_usage = 10_MiB;
-
     // used to split range of possible session ids to limit memory size we use
     // max_mem_used, this is theoretical limit, the actual number of session
     // held in a cache on single core is limitted by the memory usage.
@@ -56,12 +65,8 @@ private:
 
     std::optional<fetch_session_id> new_session_id();
     void gc_sessions();
-
-    size_t mem_usage() const {
-        using debug = absl::container_internal::hashtable_debug_internal::
-          HashtableDebugAccess<underlying_t>;
-        return debug::AllocatedByteSize(_sessions) + _sessions_mem_usage;
-    }
+    void evict_over_budget();
+    void erase(underlying_t::iterator);
 
     void register_metrics();
 
@@ -73,8 +78,11 @@ private:
     // min time that will elapse since the session was last used before it is
     // going to be evicted
     std::chrono::milliseconds _session_eviction_duration;
+    config::binding<size_t> _max_mem_usage;
 
     size_t _sessions_mem_usage = 0;
+    // sessions evicted to stay within the memory budget
+    uint64_t _evicted_sessions = 0;
 
     metrics::internal_metric_groups _metrics;
 };
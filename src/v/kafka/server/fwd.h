@@ -20,6 +20,7 @@ class fetch_session_cache;
 class group_manager;
 class group_router;
 class partition_proxy;
+class produce_latency_controller;
 class quota_manager;
 class request_context;
 class response;
@@ -41,6 +41,7 @@
 #include "utils/to_string.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/as_future.hh>
 
 #include <absl/container/flat_hash_set.h>
 #include <boost/uuid/random_generator.hpp>
@@ -138,6 +139,8 @@ group::group(
         _probe.setup_public_metrics(_id);
     }
 
+    _commit_window_timer.set_callback(
+      [this] { flush_offset_commit_window(); });
     start_abort_timer();
 }
 
@@ -197,6 +200,8 @@ group::group(
         _probe.setup_public_metrics(_id);
     }
 
+    _commit_window_timer.set_callback(
+      [this] { flush_offset_commit_window(); });
     start_abort_timer();
 }
 
@@ -1307,6 +1312,14 @@ void group::remove_pending_member(kafka::member_id member_id) {
 
 ss::future<> group::shutdown() {
     _auto_abort_timer.cancel();
+    _commit_window_timer.cancel();
+    for (const auto& [tp, md] : _commit_window.offsets) {
+        fail_offset_commit(tp, md);
+    }
+    for (auto& waiter : _commit_window.waiters) {
+        waiter.set_value(error_code::not_coordinator);
+    }
+    _commit_window = {};
     co_await _gate.close();
     // cancel join timer
     _join_timer.cancel();
@@ -1483,8 +1496,9 @@ group::sync_group_stages group::handle_sync_group(sync_group_request&& r) {
 }
 
 model::record_batch group::checkpoint(const assignments_type& assignments) {
-    return do_checkpoint(
-      [&assignments](const member_id& id) { return assignments.at(id); });
+    return do_checkpoint([&assignments](const member_id& id) {
+        return bytes_to_iobuf(assignments.at(id));
+    });
 }
 
 model::record_batch group::checkpoint() {
@@ -1495,7 +1509,7 @@ model::record_batch group::checkpoint() {
           "Checkpointed member {} must be part of the group {}",
           id,
           *this);
-        return it->second->assignment();
+        return it->second->share_assignment();
     });
 }
 
@@ -2230,11 +2244,7 @@ void group::update_store_offset_builder(
 }
 
 group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
-    cluster::simple_batch_builder builder(
-      model::record_batch_type::raft_data, model::offset(0));
-
-    std::vector<std::pair<model::topic_partition, offset_metadata>>
-      offset_commits;
+    offset_commits_t offset_commits;
 
     const auto expiry_timestamp = [&r]() -> std::optional<model::timestamp> {
         if (r.data.retention_time_ms == -1) {
@@ -2254,17 +2264,6 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
 
     for (const auto& t : r.data.topics) {
         for (const auto& p : t.partitions) {
-            const auto commit_timestamp = get_commit_timestamp(p);
-            update_store_offset_builder(
-              builder,
-              t.name,
-              p.partition_index,
-              p.committed_offset,
-              p.committed_leader_epoch,
-              p.committed_metadata.value_or(""),
-              commit_timestamp,
-              expiry_timestamp);
-
             model::topic_partition tp(t.name, p.partition_index);
 
             /*
@@ -2279,18 +2278,47 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
               .offset = p.committed_offset,
               .metadata = p.committed_metadata.value_or(""),
               .committed_leader_epoch = p.committed_leader_epoch,
-              .commit_timestamp = commit_timestamp,
+              .commit_timestamp = get_commit_timestamp(p),
               .expiry_timestamp = expiry_timestamp,
             };
 
-            offset_commits.emplace_back(tp, md);
-
             // record the offset commits as pending commits which will be
             // inspected after the append to catch concurrent updates.
             _pending_offset_commits[tp] = md;
+
+            offset_commits.emplace_back(std::move(tp), std::move(md));
         }
     }
 
+    const auto window = _conf.group_offset_commit_coalesce_ms();
+    if (window > std::chrono::milliseconds::zero()) {
+        return coalesce_offsets(
+          std::move(r), std::move(offset_commits), window);
+    }
+
+    auto replicate_stages = replicate_offsets(std::move(offset_commits));
+    auto f = replicate_stages.result.then(
+      [req = std::move(r)](error_code error) mutable {
+          return offset_commit_response(req, error);
+      });
+    return {std::move(replicate_stages.dispatched), std::move(f)};
+}
+
+group::stages<error_code> group::replicate_offsets(offset_commits_t commits) {
+    cluster::simple_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (const auto& [tp, md] : commits) {
+        update_store_offset_builder(
+          builder,
+          tp.topic,
+          tp.partition,
+          md.offset,
+          md.committed_leader_epoch,
+          md.metadata,
+          md.commit_timestamp,
+          md.expiry_timestamp);
+    }
+
     auto batch = std::move(builder).build();
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
@@ -2300,7 +2328,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
       raft::replicate_options(raft::consistency_level::quorum_ack));
 
     auto f = replicate_stages.replicate_finished.then(
-      [this, req = std::move(r), commits = std::move(offset_commits)](
+      [this, commits = std::move(commits)](
         result<raft::replicate_result> r) mutable {
           auto error = error_code::none;
           if (!r) {
@@ -2311,7 +2339,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
               error = map_store_offset_error_code(r.error());
           }
           if (in_state(group_state::dead)) {
-              return offset_commit_response(req, error);
+              return error;
           }
 
           if (error == error_code::none) {
@@ -2324,10 +2352,69 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
                   fail_offset_commit(e.first, e.second);
               }
           }
+          return error;
+      });
+    return {std::move(replicate_stages.request_enqueued), std::move(f)};
+}
 
+group::offset_commit_stages group::coalesce_offsets(
+  offset_commit_request&& r,
+  offset_commits_t commits,
+  std::chrono::milliseconds window) {
+    for (auto& [tp, md] : commits) {
+        // the last commit of a partition within the window wins, the ones it
+        // replaces are acked along with it
+        _commit_window.offsets[tp] = std::move(md);
+    }
+    auto f = _commit_window.waiters.emplace_back().get_future();
+    if (!_commit_window_timer.armed()) {
+        _commit_window_timer.arm(window);
+    }
+    return offset_commit_stages(
+      f.then([req = std::move(r)](error_code error) mutable {
           return offset_commit_response(req, error);
+      }));
+}
+
+void group::flush_offset_commit_window() {
+    ssx::spawn_with_gate(
+      _gate, [this, window = std::exchange(_commit_window, {})]() mutable {
+          return do_flush_offset_commit_window(std::move(window));
       });
-    return {std::move(replicate_stages.request_enqueued), std::move(f)};
+}
+
+ss::future<>
+group::do_flush_offset_commit_window(offset_commit_window window) {
+    offset_commits_t commits;
+    commits.reserve(window.offsets.size());
+    for (auto& [tp, md] : window.offsets) {
+        commits.emplace_back(tp, std::move(md));
+    }
+    vlog(
+      _ctxlog.trace,
+      "Storing {} coalesced offset commits of {} requests",
+      commits.size(),
+      window.waiters.size());
+
+    auto error = error_code::none;
+    try {
+        auto replicate_stages = replicate_offsets(std::move(commits));
+        auto dispatched = co_await ss::coroutine::as_future(
+          std::move(replicate_stages.dispatched));
+        if (dispatched.failed()) {
+            dispatched.ignore_ready_future();
+        }
+        error = co_await std::move(replicate_stages.result);
+    } catch (...) {
+        vlog(
+          _ctxlog.warn,
+          "Storing coalesced offset commits failed - {}",
+          std::current_exception());
+        error = error_code::unknown_server_error;
+    }
+    for (auto& waiter : window.waiters) {
+        waiter.set_value(error);
+    }
 }
 
 ss::future<cluster::commit_group_tx_reply>
@@ -613,10 +613,7 @@ public:
         if (auto o_it = _offsets.find(tp); o_it != _offsets.end()) {
             o_it->second->metadata = std::move(md);
         } else {
-            _offsets.emplace(
-              std::move(tp),
-              std::make_unique<offset_metadata_with_probe>(
-                std::move(md), _id, tp, _enable_group_metrics));
+            emplace_offset(std::move(tp), std::move(md));
         }
     }
 
@@ -628,10 +625,7 @@ public:
             }
             return false;
         } else {
-            _offsets.emplace(
-              std::move(tp),
-              std::make_unique<offset_metadata_with_probe>(
-                std::move(md), _id, tp, _enable_group_metrics));
+            emplace_offset(std::move(tp), std::move(md));
             return true;
         }
     }
@@ -703,9 +697,26 @@ private:
     using member_map = absl::node_hash_map<kafka::member_id, member_ptr>;
     using protocol_support = absl::node_hash_map<kafka::protocol_name, int>;
     using producers_map = chunked_hash_map<model::producer_id, tx_producer>;
+    using offset_commits_t
+      = std::vector<std::pair<model::topic_partition, offset_metadata>>;
 
     friend std::ostream& operator<<(std::ostream&, const group&);
 
+    void emplace_offset(model::topic_partition tp, offset_metadata md) {
+        // the probe is labeled with the partition, build it before the key is
+        // moved into the map
+        auto entry = std::make_unique<offset_metadata_with_probe>(
+          std::move(md), _id, tp, _enable_group_metrics);
+        _offsets.emplace(std::move(tp), std::move(entry));
+    }
+
+    // Replicates the commits in a single batch. The result is set once the
+    // commits are applied to the group.
+    stages<error_code> replicate_offsets(offset_commits_t);
+    offset_commit_stages coalesce_offsets(
+      offset_commit_request&&, offset_commits_t, std::chrono::milliseconds);
+    void flush_offset_commit_window();
+
     class ctx_log {
     public:
         explicit ctx_log(ss::logger& logger, const group& group)
@@ -802,14 +813,24 @@ private:
           model::timestamp(-1));
 
         for (const auto& [id, member] : _members) {
-            auto state = member->state().copy();
-            // this is not coming from the member itself because the checkpoint
-            // occurs right before the members go live and get their
-            // assignments.
-            state.assignment = bytes_to_iobuf(assignments_provider(id));
-            state.subscription = bytes_to_iobuf(
-              member->get_protocol_metadata(_protocol.value()));
-            metadata.members.push_back(std::move(state));
+            // build the state field by field rather than copying it, the
+            // member's current subscription and assignment buffers would be
+            // copied only to be replaced.
+            const auto& current = member->state();
+            metadata.members.push_back(member_state{
+              .id = current.id,
+              .instance_id = current.instance_id,
+              .client_id = current.client_id,
+              .client_host = current.client_host,
+              .rebalance_timeout = current.rebalance_timeout,
+              .session_timeout = current.session_timeout,
+              .subscription = bytes_to_iobuf(
+                member->get_protocol_metadata(_protocol.value())),
+              // this is not coming from the member itself because the
+              // checkpoint occurs right before the members go live and get
+              // their assignments.
+              .assignment = assignments_provider(id),
+            });
         }
 
         cluster::simple_batch_builder builder(
@@ -942,6 +963,19 @@ private:
     producers_map _producers;
     chunked_hash_map<model::topic_partition, offset_metadata>
       _pending_offset_commits;
+    /**
+     * With group_offset_commit_coalesce_ms set, the offset commits of the
+     * group are buffered for the window and replicated together in a single
+     * batch, instead of a batch per request. Commits are acked together once
+     * the batch is replicated.
+     */
+    struct offset_commit_window {
+        chunked_hash_map<model::topic_partition, offset_metadata> offsets;
+        std::vector<ss::promise<error_code>> waiters;
+    };
+    ss::future<> do_flush_offset_commit_window(offset_commit_window);
+    offset_commit_window _commit_window;
+    ss::timer<clock_type> _commit_window_timer;
     enable_group_metrics _enable_group_metrics;
 
     ss::gate _gate;
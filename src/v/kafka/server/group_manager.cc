@@ -41,6 +41,7 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/loop.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/later.hh>
 
@@ -956,22 +957,31 @@ ss::future<> group_manager::do_recover_group(
             group->reschedule_all_member_heartbeats();
         }
 
-        for (auto& [tp, meta] : group_stm.offsets()) {
+        /*
+         * the offsets are moved into the group and released from the stm as
+         * they are, so that the offsets of large groups aren't held twice.
+         */
+        auto offsets = group_stm.release_offsets();
+        const auto offsets_count = offsets.size();
+        while (!offsets.empty()) {
+            auto& [tp, meta] = offsets.back();
             const auto expiry_timestamp
               = meta.metadata.expiry_timestamp == model::timestamp(-1)
                   ? std::optional<model::timestamp>(std::nullopt)
                   : meta.metadata.expiry_timestamp;
             group->try_upsert_offset(
-              tp,
+              std::move(tp),
               group::offset_metadata{
                 .log_offset = meta.log_offset,
                 .offset = meta.metadata.offset,
-                .metadata = meta.metadata.metadata,
+                .metadata = std::move(meta.metadata.metadata),
                 .committed_leader_epoch = meta.metadata.leader_epoch,
                 .commit_timestamp = meta.metadata.commit_timestamp,
                 .expiry_timestamp = expiry_timestamp,
                 .non_reclaimable = meta.metadata.non_reclaimable,
               });
+            offsets.pop_back();
+            co_await ss::coroutine::maybe_yield();
         }
         for (auto& [id, session] : group_stm.producers()) {
             group->try_set_fence(id, session.epoch);
@@ -997,7 +1007,7 @@ ss::future<> group_manager::do_recover_group(
         }
 
         if (group_stm.is_removed()) {
-            if (group_stm.offsets().size() > 0) {
+            if (offsets_count > 0) {
                 klog.warn(
                   "Unexpected active group unload {} while loading {}",
                   group_id,
@@ -13,14 +13,66 @@
 #include "kafka/server/logger.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/when_all.hh>
 #include <seastar/core/with_scheduling_group.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 
+using namespace std::chrono_literals;
+
 namespace kafka {
 
+namespace {
+
+offset_fetch_response response_from_snapshot(
+  const offset_fetch_request& r,
+  const absl::
+    flat_hash_map<model::topic_partition, offset_fetch_response_partition>&
+      partitions) {
+    offset_fetch_response resp;
+    resp.data.error_code = error_code::none;
+    if (!r.data.topics) {
+        absl::flat_hash_map<
+          model::topic,
+          small_fragment_vector<offset_fetch_response_partition>>
+          tmp;
+        for (const auto& [tp, p] : partitions) {
+            tmp[tp.topic].push_back(p);
+        }
+        for (auto& e : tmp) {
+            resp.data.topics.push_back(
+              {.name = e.first, .partitions = std::move(e.second)});
+        }
+        return resp;
+    }
+    for (const auto& topic : *r.data.topics) {
+        offset_fetch_response_topic t;
+        t.name = topic.name;
+        for (auto id : topic.partition_indexes) {
+            auto it = partitions.find(model::topic_partition(topic.name, id));
+            if (it != partitions.end()) {
+                t.partitions.push_back(it->second);
+                continue;
+            }
+            t.partitions.push_back({
+              .partition_index = id,
+              .committed_offset = model::offset(-1),
+              .metadata = "",
+              .error_code = error_code::none,
+            });
+        }
+        resp.data.topics.push_back(std::move(t));
+    }
+    return resp;
+}
+
+} // namespace
+
 template<typename Request, typename FwdFunc>
 auto group_router::route(Request&& r, FwdFunc func) {
     // get response type from FwdFunc it has return future<response>.
@@ -263,21 +315,66 @@ group_router::leave_group(leave_group_request&& request) {
 
 ss::future<offset_fetch_response>
 group_router::offset_fetch(offset_fetch_request&& request) {
-    return route(std::move(request), &group_manager::offset_fetch);
+    auto ttl = _offset_fetch_snapshot_ttl();
+    if (ttl <= 0ms || request.data.require_stable) {
+        return route(std::move(request), &group_manager::offset_fetch);
+    }
+    return offset_fetch_from_snapshot(std::move(request), ttl);
+}
+
+ss::future<offset_fetch_response> group_router::offset_fetch_from_snapshot(
+  offset_fetch_request request, std::chrono::milliseconds ttl) {
+    auto now = ss::lowres_clock::now();
+    auto it = _offset_snapshots.find(request.data.group_id);
+    if (it == _offset_snapshots.end() || now - it->second.taken_at > ttl) {
+        offset_fetch_request all;
+        all.data.group_id = request.data.group_id;
+        all.data.topics = std::nullopt;
+        auto resp = co_await route(std::move(all), &group_manager::offset_fetch);
+        if (resp.data.error_code != error_code::none) {
+            co_return resp;
+        }
+        offset_snapshot snapshot{.taken_at = now};
+        for (auto& topic : resp.data.topics) {
+            for (auto& p : topic.partitions) {
+                auto id = p.partition_index;
+                snapshot.partitions.emplace(
+                  model::topic_partition(topic.name, id), std::move(p));
+            }
+        }
+        _offset_snapshots.erase(request.data.group_id);
+        if (_offset_snapshots.size() >= max_offset_snapshots) {
+            absl::erase_if(_offset_snapshots, [now, ttl](const auto& e) {
+                return now - e.second.taken_at > ttl;
+            });
+        }
+        if (_offset_snapshots.size() >= max_offset_snapshots) {
+            // too many groups are polled through this shard, answer without
+            // keeping the snapshot around
+            co_return response_from_snapshot(request, snapshot.partitions);
+        }
+        it = _offset_snapshots
+               .emplace(request.data.group_id, std::move(snapshot))
+               .first;
+    }
+    co_return response_from_snapshot(request, it->second.partitions);
 }
 
 ss::future<offset_delete_response>
 group_router::offset_delete(offset_delete_request&& request) {
+    _offset_snapshots.erase(request.data.group_id);
     return route(std::move(request), &group_manager::offset_delete);
 }
 
 group::offset_commit_stages
 group_router::offset_commit(offset_commit_request&& request) {
+    _offset_snapshots.erase(request.data.group_id);
     return route_stages(std::move(request), &group_manager::offset_commit);
 }
 
 ss::future<txn_offset_commit_response>
 group_router::txn_offset_commit(txn_offset_commit_request&& request) {
+    _offset_snapshots.erase(request.data.group_id);
     return route(std::move(request), &group_manager::txn_offset_commit);
 }
 
@@ -13,6 +13,8 @@
 #include "base/seastarx.h"
 #include "cluster/fwd.h"
 #include "cluster/shard_table.h"
+#include "config/configuration.h"
+#include "config/property.h"
 #include "container/fragmented_vector.h"
 #include "kafka/protocol/describe_groups.h"
 #include "kafka/protocol/heartbeat.h"
@@ -26,11 +28,14 @@
 #include "kafka/server/coordinator_ntp_mapper.h"
 #include "kafka/server/group_manager.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 namespace kafka {
 
 /**
@@ -40,6 +45,10 @@ namespace kafka {
  * mapped to its associated ntp using the coordinator_ntp_mapper. Given the ntp
  * the owning shard is found using the cluster::shard_table. Finally, a x-core
  * operation on the destination shard's group manager is invoked.
+ *
+ * When group_offset_fetch_snapshot_ttl_ms is set, OffsetFetch requests are
+ * answered from a shard local snapshot of the group's committed offsets which
+ * is refreshed from the coordinator once it gets older than the ttl.
  */
 class group_router final {
 public:
@@ -53,7 +62,10 @@ public:
       , _ssg(smp_group)
       , _group_manager(gr_manager)
       , _shards(shards)
-      , _coordinators(coordinators) {}
+      , _coordinators(coordinators)
+      , _offset_fetch_snapshot_ttl(
+          config::shard_local_cfg().group_offset_fetch_snapshot_ttl_ms.bind()) {
+    }
 
     group::join_group_stages join_group(join_group_request&& request);
 
@@ -121,6 +133,9 @@ private:
         return std::nullopt;
     }
 
+    ss::future<offset_fetch_response>
+    offset_fetch_from_snapshot(offset_fetch_request, std::chrono::milliseconds);
+
     ss::future<std::vector<deletable_group_result>> route_delete_groups(
       ss::shard_id, std::vector<std::pair<model::ntp, group_id>>);
 
@@ -132,6 +147,18 @@ private:
     ss::sharded<group_manager>& _group_manager;
     ss::sharded<cluster::shard_table>& _shards;
     ss::sharded<coordinator_ntp_mapper>& _coordinators;
+
+    // committed offsets of a group as last fetched from its coordinator
+    struct offset_snapshot {
+        ss::lowres_clock::time_point taken_at;
+        absl::flat_hash_map<
+          model::topic_partition,
+          offset_fetch_response_partition>
+          partitions;
+    };
+    static constexpr size_t max_offset_snapshots = 10'000;
+    config::binding<std::chrono::milliseconds> _offset_fetch_snapshot_ttl;
+    absl::flat_hash_map<group_id, offset_snapshot> _offset_snapshots;
 };
 
 } // namespace kafka
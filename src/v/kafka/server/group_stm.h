@@ -21,6 +21,7 @@
 #include <absl/container/node_hash_set.h>
 
 #include <memory>
+#include <utility>
 
 namespace kafka {
 
@@ -72,6 +73,12 @@ public:
         return _offsets;
     }
 
+    /// Hands the offsets over to the caller, the stm is left without any.
+    chunked_vector<std::pair<model::topic_partition, logged_metadata>>
+    release_offsets() {
+        return std::exchange(_offsets, {}).extract();
+    }
+
     group_metadata_value& get_metadata() { return _metadata; }
 
     const group_metadata_value& get_metadata() const { return _metadata; }
@@ -10,6 +10,7 @@
 #include "kafka/server/handlers/fetch.h"
 
 #include "base/likely.h"
+#include "base/units.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
@@ -20,6 +21,7 @@
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/read_distribution_probe.h"
+#include "kafka/server/fetch_response_cache.h"
 #include "kafka/server/fetch_session.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
@@ -27,6 +29,7 @@
 #include "kafka/server/handlers/fetch/fetch_planner.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/partition_proxy.h"
+#include "kafka/server/quota_manager.h"
 #include "kafka/server/replicated_partition.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -51,8 +54,10 @@
 #include <boost/range/irange.hpp>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
+#include <numeric>
 #include <ranges>
 #include <string_view>
 
@@ -72,14 +77,83 @@ make_partition_response_error(model::partition_id p_id, error_code error) {
     };
 }
 
+/**
+ * Reads starting far behind the high watermark are served from disk rather
+ * than from the batch cache and are usually large. They get their own I/O
+ * priority class so that a consumer catching up cannot add latency to the
+ * appends and tail reads of the other partitions of the shard.
+ */
+static ss::io_priority_class
+read_priority(model::offset start_offset, model::offset hw) {
+    const auto min_lag
+      = config::shard_local_cfg().fetch_catchup_read_min_lag();
+    if (min_lag && hw() - start_offset() >= *min_lag) {
+        return kafka_catchup_read_priority();
+    }
+    return kafka_read_priority();
+}
+
+static std::optional<std::chrono::milliseconds>
+delta_from_tip(model::timestamp first_timestamp) {
+    auto curr_timestamp = model::timestamp::now();
+    if (curr_timestamp >= first_timestamp) {
+        return std::chrono::milliseconds{
+          curr_timestamp() - first_timestamp()};
+    }
+    return std::nullopt;
+}
+
+static read_result make_read_result(
+  std::unique_ptr<iobuf> data,
+  model::offset start_o,
+  model::offset hw,
+  model::offset lso,
+  std::optional<std::chrono::milliseconds> delta_from_tip_ms,
+  std::vector<cluster::tx::tx_range> aborted_transactions,
+  bool foreign_read) {
+    if (
+      foreign_read && config::shard_local_cfg().fetch_link_foreign_reads()) {
+        return read_result(
+          read_result::make_foreign_fragments(std::move(data)),
+          start_o,
+          hw,
+          lso,
+          delta_from_tip_ms,
+          std::move(aborted_transactions));
+    }
+
+    if (foreign_read) {
+        return read_result(
+          ss::make_foreign<read_result::data_t>(std::move(data)),
+          start_o,
+          hw,
+          lso,
+          delta_from_tip_ms,
+          std::move(aborted_transactions));
+    }
+
+    return read_result(
+      std::move(data),
+      start_o,
+      hw,
+      lso,
+      delta_from_tip_ms,
+      std::move(aborted_transactions));
+}
+
 /**
  * Low-level handler for reading from an ntp. Runs on ntp's home core.
+ *
+ * Reads of the partition leader are served from and added to
+ * `response_cache` if one is given.
  */
 static ss::future<read_result> read_from_partition(
+  const model::ktp& ktp,
   kafka::partition_proxy part,
   fetch_config config,
   bool foreign_read,
-  std::optional<model::timeout_clock::time_point> deadline) {
+  std::optional<model::timeout_clock::time_point> deadline,
+  fetch_response_cache* response_cache) {
     auto lso = part.last_stable_offset();
     if (unlikely(!lso)) {
         co_return read_result(lso.error());
@@ -93,12 +167,52 @@ static ss::future<read_result> read_from_partition(
         co_return read_result(start_o, hw, lso.value());
     }
 
+    const auto cache_ttl
+      = config::shard_local_cfg().fetch_response_cache_ttl_ms();
+    // a follower may not have all the data below its high watermark yet, only
+    // reads of the leader are cached
+    if (cache_ttl <= 0ms || !part.is_leader()) {
+        response_cache = nullptr;
+    }
+    const fetch_response_cache::key cache_key{
+      .ktp = ktp,
+      .start_offset = config.start_offset,
+      .isolation_level = config.isolation_level,
+    };
+    const fetch_response_cache::version cache_version{
+      .leader_epoch = part.leader_epoch(),
+      .high_watermark = hw,
+      .max_offset = config.max_offset,
+    };
+    if (response_cache) {
+        auto* cached = response_cache->get(
+          cache_key,
+          cache_version,
+          config.max_bytes,
+          config.strict_max_bytes,
+          cache_ttl);
+        if (cached) {
+            auto data = std::make_unique<iobuf>(
+              cached->data.share(0, cached->data.size_bytes()));
+            part.probe().add_records_fetched(cached->record_count);
+            part.probe().add_bytes_fetched(data->size_bytes());
+            co_return make_read_result(
+              std::move(data),
+              start_o,
+              hw,
+              lso.value(),
+              delta_from_tip(cached->first_timestamp),
+              cached->aborted_transactions,
+              foreign_read);
+        }
+    }
+
     storage::log_reader_config reader_config(
       config.start_offset,
       config.max_offset,
       0,
       config.max_bytes,
-      kafka_read_priority(),
+      read_priority(config.start_offset, hw),
       std::nullopt,
       std::nullopt,
       config.abort_source.has_value()
@@ -112,10 +226,16 @@ static ss::future<read_result> read_from_partition(
     std::unique_ptr<iobuf> data;
     std::vector<cluster::tx::tx_range> aborted_transactions;
     std::optional<std::chrono::milliseconds> delta_from_tip_ms;
+    uint32_t record_count = 0;
+    model::offset last_offset;
+    model::timestamp first_timestamp;
     try {
         auto result = co_await rdr.reader.consume(
           kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
         data = std::make_unique<iobuf>(std::move(result.data));
+        record_count = result.record_count;
+        last_offset = result.last_offset;
+        first_timestamp = result.first_timestamp;
         part.probe().add_records_fetched(result.record_count);
         part.probe().add_bytes_fetched(data->size_bytes());
         if (!part.is_leader() && config.read_from_follower) {
@@ -123,11 +243,7 @@ static ss::future<read_result> read_from_partition(
         }
 
         if (data->size_bytes() > 0) {
-            auto curr_timestamp = model::timestamp::now();
-            if (curr_timestamp >= result.first_timestamp) {
-                delta_from_tip_ms = std::chrono::milliseconds{
-                  curr_timestamp() - result.first_timestamp()};
-            }
+            delta_from_tip_ms = delta_from_tip(result.first_timestamp);
         }
         // Only return aborted transactions range if consumer is using
         // read_committed isolation level and there are tx batches in the
@@ -165,23 +281,50 @@ static ss::future<read_result> read_from_partition(
         std::rethrow_exception(e);
     }
 
-    if (foreign_read) {
-        co_return read_result(
-          ss::make_foreign<read_result::data_t>(std::move(data)),
-          start_o,
-          hw,
-          lso.value(),
-          delta_from_tip_ms,
-          std::move(aborted_transactions));
+    // a read cut short by the deadline may hold less data than another read
+    // with the same limits, don't serve it to other fetches
+    const bool timed_out = deadline
+                           && model::timeout_clock::now() >= *deadline;
+    if (response_cache && record_count > 0 && !timed_out) {
+        const bool complete = last_offset
+                              >= std::min(
+                                model::prev_offset(hw), config.max_offset);
+        response_cache->put(
+          cache_key,
+          cache_version,
+          config.max_bytes,
+          config.strict_max_bytes,
+          complete,
+          {
+            .data = data->share(0, data->size_bytes()),
+            .record_count = record_count,
+            .first_timestamp = first_timestamp,
+            .aborted_transactions = aborted_transactions,
+          });
     }
 
-    co_return read_result(
+    co_return make_read_result(
       std::move(data),
       start_o,
       hw,
       lso.value(),
       delta_from_tip_ms,
-      std::move(aborted_transactions));
+      std::move(aborted_transactions),
+      foreign_read);
+}
+
+read_result::foreign_fragments_t
+read_result::make_foreign_fragments(data_t data) {
+    foreign_fragments_t ret;
+    if (!data) {
+        return ret;
+    }
+    auto copy = data->copy();
+    data.reset();
+    for (auto& frag : copy) {
+        ret.push_back(std::move(frag).release());
+    }
+    return ret;
 }
 
 read_result::memory_units_t::memory_units_t(
@@ -302,7 +445,8 @@ static ss::future<read_result> do_read_from_ntp(
   std::optional<model::timeout_clock::time_point> deadline,
   const bool obligatory_batch_read,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_response_cache* response_cache) {
     // control available memory
     read_result::memory_units_t memory_units(memory_sem, memory_fetch_sem);
     if (!ntp_config.cfg.skip_read) {
@@ -394,7 +538,12 @@ static ss::future<read_result> do_read_from_ntp(
         }
     }
     read_result result = co_await read_from_partition(
-      std::move(*kafka_partition), ntp_config.cfg, foreign_read, deadline);
+      ntp_config.ktp(),
+      std::move(*kafka_partition),
+      ntp_config.cfg,
+      foreign_read,
+      deadline,
+      response_cache);
 
     adjust_memory_units(
       memory_sem, memory_fetch_sem, memory_units, result.data_size_bytes());
@@ -422,7 +571,8 @@ ss::future<read_result> read_from_ntp(
       deadline,
       obligatory_batch_read,
       memory_sem,
-      memory_fetch_sem);
+      memory_fetch_sem,
+      nullptr);
 }
 
 read_result::memory_units_t reserve_memory_units(
@@ -556,7 +706,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
   std::optional<model::timeout_clock::time_point> deadline,
   const size_t bytes_left,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_response_cache& response_cache) {
     size_t total_max_bytes = 0;
     for (const auto& c : ntp_fetch_configs) {
         total_max_bytes += c.cfg.max_bytes;
@@ -589,7 +740,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
        foreign_read,
        first_p_id,
        &memory_sem,
-       &memory_fetch_sem](const ntp_fetch_config& ntp_cfg) {
+       &memory_fetch_sem,
+       &response_cache](const ntp_fetch_config& ntp_cfg) {
           auto p_id = ntp_cfg.ktp().get_partition();
           return do_read_from_ntp(
                    cluster_pm,
@@ -599,7 +751,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
                    deadline,
                    first_p_id == p_id,
                    memory_sem,
-                   memory_fetch_sem)
+                   memory_fetch_sem,
+                   &response_cache)
             .then([p_id](read_result res) {
                 res.partition = p_id;
                 return res;
@@ -673,7 +826,8 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
               octx.deadline,
               octx.bytes_left,
               octx.rctx.server().local().memory(),
-              octx.rctx.server().local().memory_fetch_sem());
+              octx.rctx.server().local().memory_fetch_sem(),
+              octx.rctx.server().local().get_fetch_response_cache());
         })
       .then([responses = std::move(fetch.responses),
              start_time = fetch.start_time,
@@ -719,6 +873,10 @@ public:
         // The fetch sub-requests of partitions local to the shard this worker
         // is running on.
         std::vector<ntp_fetch_config> requests;
+        // The last visible indexes returned by the previous worker for
+        // `requests`, empty if this is the first worker of the fetch.
+        // Partitions whose index hasn't changed since aren't read again.
+        std::vector<model::offset> last_visible_indexes;
 
         // References to services local to the shard this worker is running on.
         // They are protected from deletion by the coordinator.
@@ -732,10 +890,16 @@ public:
 
     struct worker_result {
         std::vector<read_result> read_results;
+        // The index in `shard_local_fetch_context::requests` of every result
+        // in `read_results`. Requests that weren't read have no result.
+        std::vector<size_t> result_indexes;
+        // The last observed visible index of every request.
+        std::vector<model::offset> last_visible_indexes;
         // The total amount of bytes read across all results in `read_results`.
         size_t total_size;
-        // The time it took for the first `fetch_ntps_in_parallel` to complete
-        std::chrono::microseconds first_run_latency_result;
+        // The time it took for the first `fetch_ntps_in_parallel` to complete,
+        // unset if the worker didn't read any partition on its first run.
+        std::optional<std::chrono::microseconds> first_run_latency_result;
     };
 
     ss::future<worker_result> run() {
@@ -830,7 +994,8 @@ private:
           _ctx.deadline,
           _ctx.bytes_left,
           _ctx.srv.memory(),
-          _ctx.srv.memory_fetch_sem());
+          _ctx.srv.memory_fetch_sem(),
+          _ctx.srv.get_fetch_response_cache());
 
         // If we weren't able to read the last_visible_index for a partition
         // before calling `fetch_ntps_in_parallel` then we need to
@@ -896,73 +1061,121 @@ private:
         return {};
     }
 
+    // Returns the indexes of the requests in `_ctx.requests` whose partition
+    // has a different last visible index than `_last_visible_indexes`, or
+    // can't be found anymore.
+    std::vector<size_t> changed_request_indexes() const {
+        std::vector<size_t> ret;
+        for (size_t i = 0; i < _ctx.requests.size(); i++) {
+            auto part = _ctx.mgr.get(_ctx.requests[i].ktp());
+            if (
+              !part || !part->raft()
+              || part->raft()->last_visible_index()
+                   != _last_visible_indexes[i]) {
+                ret.push_back(i);
+            }
+        }
+        return ret;
+    }
+
     ss::future<worker_result> do_run() {
         bool first_run{true};
-        std::chrono::microseconds first_run_latency_result{0};
+        std::optional<std::chrono::microseconds> first_run_latency_result;
         // A map of indexes in `requests` to their corresponding index in
         // `_ctx.requests`.
         std::vector<size_t> requests_map;
 
+        // Results of the requests that have been read, `result_indexes` holds
+        // their index in `_ctx.requests` and `result_positions` maps the
+        // other way around.
         std::vector<read_result> results;
+        std::vector<size_t> result_indexes;
+        std::vector<std::optional<size_t>> result_positions(
+          _ctx.requests.size());
         size_t total_size{0};
 
-        for (;;) {
-            std::vector<ntp_fetch_config> requests;
-
-            if (first_run) {
-                requests = _ctx.requests;
+        auto set_result = [&](size_t r_i, read_result r) {
+            auto& pos = result_positions[r_i];
+            if (pos) {
+                total_size -= results[*pos].data_size_bytes();
+                results[*pos] = std::move(r);
             } else {
-                requests_map.clear();
+                pos = results.size();
+                results.push_back(std::move(r));
+                result_indexes.push_back(r_i);
+            }
+            total_size += results[*pos].data_size_bytes();
+        };
 
-                for (auto i : _request_indexes) {
-                    requests.push_back(_ctx.requests[i]);
-                    requests_map.push_back(i);
-                }
+        auto make_result = [&] {
+            return worker_result{
+              .read_results = std::move(results),
+              .result_indexes = std::move(result_indexes),
+              .last_visible_indexes = std::move(_last_visible_indexes),
+              .total_size = total_size,
+              .first_run_latency_result = first_run_latency_result,
+            };
+        };
 
+        // A worker restarted by the coordinator only needs to read the
+        // partitions that changed since the previous worker read them, the
+        // responses of the others are still current.
+        const bool restarted = _ctx.last_visible_indexes.size()
+                               == _ctx.requests.size();
+        if (restarted) {
+            _last_visible_indexes = std::move(_ctx.last_visible_indexes);
+        } else {
+            _last_visible_indexes.resize(_ctx.requests.size());
+        }
+
+        for (;;) {
+            if (first_run) {
+                if (restarted) {
+                    requests_map = changed_request_indexes();
+                } else {
+                    requests_map.resize(_ctx.requests.size());
+                    std::iota(
+                      requests_map.begin(), requests_map.end(), size_t{0});
+                }
+            } else {
+                requests_map = std::move(_request_indexes);
                 _request_indexes.clear();
                 // All `_request_indexes` have been read. Reset counter
                 _completed_waiter_count.consume(
                   _completed_waiter_count.current());
             }
 
-            std::optional<op_context::latency_point> start_time;
-            if (first_run) {
-                start_time = op_context::latency_clock::now();
-            }
+            bool has_error{false};
+            if (!requests_map.empty()) {
+                std::vector<ntp_fetch_config> requests;
+                requests.reserve(requests_map.size());
+                for (auto i : requests_map) {
+                    requests.push_back(_ctx.requests[i]);
+                }
+
+                auto start_time = op_context::latency_clock::now();
+                auto q_results = co_await query_requests(std::move(requests));
+                if (first_run) {
+                    first_run_latency_result
+                      = std::chrono::duration_cast<std::chrono::microseconds>(
+                        op_context::latency_clock::now() - start_time);
+                }
 
-            auto q_results = co_await query_requests(std::move(requests));
-            if (first_run) {
-                results = std::move(q_results.results);
-                total_size = q_results.total_size;
-
-                _last_visible_indexes = std::move(
-                  q_results.last_visible_indexes);
-                first_run_latency_result
-                  = std::chrono::duration_cast<std::chrono::microseconds>(
-                    op_context::latency_clock::now() - *start_time);
-            } else {
                 // Override the older results of the partitions with the newly
                 // queried results.
                 for (size_t i = 0; i < requests_map.size(); i++) {
                     auto r_i = requests_map[i];
-                    auto& r = results[r_i];
-                    total_size -= r.data_size_bytes();
-                    r = std::move(q_results.results[i]);
-                    total_size += r.data_size_bytes();
-
+                    set_result(r_i, std::move(q_results.results[i]));
                     _last_visible_indexes[r_i]
                       = q_results.last_visible_indexes[i];
                 }
+                has_error = q_results.has_error;
             }
 
             if (
-              total_size >= _ctx.min_bytes || q_results.has_error
+              total_size >= _ctx.min_bytes || has_error
               || _as.abort_requested()) {
-                co_return worker_result{
-                  .read_results = std::move(results),
-                  .total_size = total_size,
-                  .first_run_latency_result = first_run_latency_result,
-                };
+                co_return make_result();
             }
 
             std::optional<size_t> has_errored_request;
@@ -975,26 +1188,16 @@ private:
 
             if (has_errored_request) {
                 auto r_i = has_errored_request.value();
-                total_size -= results[r_i].data_size_bytes();
-                results[r_i] = read_result(
-                  error_code::not_leader_for_partition);
-                results[r_i].partition
-                  = _ctx.requests[r_i].ktp().get_partition();
-                co_return worker_result{
-                  .read_results = std::move(results),
-                  .total_size = total_size,
-                  .first_run_latency_result = first_run_latency_result,
-                };
+                read_result r(error_code::not_leader_for_partition);
+                r.partition = _ctx.requests[r_i].ktp().get_partition();
+                set_result(r_i, std::move(r));
+                co_return make_result();
             }
 
             co_await _completed_waiter_count.wait();
 
             if (_as.abort_requested()) {
-                co_return worker_result{
-                  .read_results = std::move(results),
-                  .total_size = total_size,
-                  .first_run_latency_result = first_run_latency_result,
-                };
+                co_return make_result();
             }
 
             first_run = false;
@@ -1010,8 +1213,7 @@ private:
 class nonpolling_fetch_plan_executor final : public fetch_plan_executor::impl {
 public:
     explicit nonpolling_fetch_plan_executor(bool debounce = false)
-      : _last_result_size(ss::smp::count, 0)
-      , _debounce(debounce)
+      : _debounce(debounce)
       , _fetch_timeout{[this] { _has_progress.signal(); }} {}
 
     /**
@@ -1072,14 +1274,13 @@ private:
             for (auto& sf : completed_shard_fetches) {
                 ssx::spawn_with_gate(
                   _workers_gate, [this, &octx, sf = std::move(sf)]() mutable {
-                      auto shard = sf.shard;
                       return handle_exceptions(start_shard_fetch_worker(
                         octx,
                         std::move(sf),
-                        // Require that a worker returns more data than before.
-                        // Otherwise it'll return right away with the previous
-                        // result.
-                        _last_result_size[shard] + 1));
+                        // The restarted worker only reads partitions that
+                        // changed since, require that it returns new data.
+                        // Otherwise it'll return right away.
+                        1));
                   });
             }
         }
@@ -1171,6 +1372,7 @@ private:
              min_fetch_bytes,
              foreign_read,
              configs = fetch.requests,
+             visible_indexes = fetch.last_visible_indexes,
              &octx](cluster::partition_manager& mgr) mutable
             -> ss::future<fetch_worker::worker_result> {
                 // Although this and octx are captured by reference across
@@ -1187,6 +1389,7 @@ private:
                     .min_bytes = min_fetch_bytes,
                     .deadline = octx.deadline,
                     .requests = std::move(configs),
+                    .last_visible_indexes = std::move(visible_indexes),
                     .srv = octx.rctx.server().local(),
                     .mgr = mgr,
                     .as = _worker_aborts[shard],
@@ -1194,17 +1397,27 @@ private:
                   [](auto& worker) { return worker.run(); });
             });
 
+        // Only the responses of the partitions the worker read are updated,
+        // the others keep the results of the previous worker.
+        std::vector<op_context::response_placeholder_ptr> responses;
+        responses.reserve(results.result_indexes.size());
+        for (auto i : results.result_indexes) {
+            responses.push_back(fetch.responses[i]);
+        }
+
         fill_fetch_responses(
           octx,
           std::move(results.read_results),
-          fetch.responses,
+          responses,
           fetch.start_time,
           false);
 
-        octx.rctx.probe().record_fetch_latency(
-          results.first_run_latency_result);
+        if (results.first_run_latency_result) {
+            octx.rctx.probe().record_fetch_latency(
+              *results.first_run_latency_result);
+        }
 
-        _last_result_size[fetch.shard] = results.total_size;
+        fetch.last_visible_indexes = std::move(results.last_visible_indexes);
         _completed_shard_fetches.push_back(std::move(fetch));
         _has_progress.signal();
     }
@@ -1239,7 +1452,6 @@ private:
     std::unordered_map<ss::shard_id, ss::abort_source> _worker_aborts;
     ss::condition_variable _has_progress;
     std::vector<shard_fetch> _completed_shard_fetches;
-    std::vector<size_t> _last_result_size;
     // If any child task throws an exception this holds on to the exception
     // until all child tasks have been stopped and its safe to rethrow the
     // exception.
@@ -1287,11 +1499,51 @@ void op_context::for_each_fetch_partition(Func&& f) const {
     }
 }
 
+std::vector<size_t> split_fetch_budget(
+  size_t budget, const std::vector<size_t>& demands, size_t min_share) {
+    std::vector<size_t> shares(demands.size(), 0);
+    if (demands.empty()) {
+        return shares;
+    }
+    // partitions in request order have priority when there isn't enough for
+    // all of them
+    const size_t served = std::clamp<size_t>(
+      budget / std::max<size_t>(min_share, 1), 1, demands.size());
+
+    // water filling: the partitions asking for the least are served first,
+    // each one gets at most an equal share of what is left
+    std::vector<size_t> order(served);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&demands](size_t a, size_t b) {
+        return demands[a] < demands[b];
+    });
+    auto left = budget;
+    for (size_t i = 0; i < served; ++i) {
+        const auto idx = order[i];
+        const auto share = std::min(demands[idx], left / (served - i));
+        shares[idx] = share;
+        left -= share;
+    }
+    return shares;
+}
+
 class simple_fetch_planner final : public fetch_planner::impl {
+    // a share smaller than this is not worth a read, it may not even cover a
+    // batch
+    static constexpr size_t min_partition_share = 64_KiB;
+
+    /// Where a partition of the plan is, and whether it's expected to return
+    /// data.
+    struct planned_partition {
+        ss::shard_id shard;
+        size_t index;
+        bool expects_data;
+    };
+
     fetch_plan create_plan(op_context& octx) final {
         fetch_plan plan(ss::smp::count);
         auto resp_it = octx.response_begin();
-        auto bytes_left_in_plan = octx.bytes_left;
+        std::vector<planned_partition> planned;
 
         plan.reserve_from_partition_count(octx.fetch_partition_count());
 
@@ -1304,7 +1556,7 @@ class simple_fetch_planner final : public fetch_planner::impl {
          * group fetch requests by shard
          */
         octx.for_each_fetch_partition(
-          [&resp_it, &octx, &plan, &bytes_left_in_plan, &client_address](
+          [&resp_it, &octx, &plan, &planned, &client_address](
             const fetch_session_partition& fp) {
               // if this is not an initial fetch we are allowed to skip
               // partions that aleready have an error or we have enough data
@@ -1368,24 +1620,23 @@ class simple_fetch_planner final : public fetch_planner::impl {
               }
 
               auto fetch_md = octx.rctx.get_fetch_metadata_cache().get(tp);
-              auto max_bytes = std::min(
-                bytes_left_in_plan, size_t(fp.max_bytes));
               /**
-               * If offset is greater, assume that fetch will read max_bytes
+               * If the high watermark is unknown or greater than the offset,
+               * assume the fetch will read its max_bytes. The budget is split
+               * once all the partitions are planned.
                */
-              if (fetch_md && fetch_md->high_watermark > fp.fetch_offset) {
-                  bytes_left_in_plan -= max_bytes;
-              }
+              const bool expects_data = !fetch_md
+                                        || fetch_md->high_watermark
+                                             > fp.fetch_offset;
 
               fetch_config config{
                 .start_offset = fp.fetch_offset,
                 .max_offset = model::model_limits<model::offset>::max(),
-                .max_bytes = max_bytes,
+                .max_bytes = size_t(fp.max_bytes),
                 .timeout = octx.deadline.value_or(model::no_timeout),
                 .current_leader_epoch = fp.current_leader_epoch,
                 .isolation_level = octx.request.data.isolation_level,
                 .strict_max_bytes = octx.response_size > 0,
-                .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
                 .read_from_follower = octx.request.has_rack_id(),
                 .consumer_rack_id = octx.request.has_rack_id()
                                       ? std::make_optional(
@@ -1395,12 +1646,61 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 .client_address = model::client_address_t{client_address},
               };
 
-              plan.fetches_per_shard[*shard].push_back(
-                {tp, std::move(config)}, &(*resp_it));
+              auto& shard_fetch = plan.fetches_per_shard[*shard];
+              planned.push_back(planned_partition{
+                .shard = *shard,
+                .index = shard_fetch.requests.size(),
+                .expects_data = expects_data,
+              });
+              shard_fetch.push_back({tp, std::move(config)}, &(*resp_it));
               ++resp_it;
           });
+
+        split_budget(plan, planned, octx.bytes_left);
         return plan;
     }
+
+    /**
+     * Splits the bytes left in the fetch across the partitions expected to
+     * return data. The others don't take from the budget, as before they get
+     * at most the largest share, or skip the read if there is nothing left.
+     */
+    static void split_budget(
+      fetch_plan& plan,
+      const std::vector<planned_partition>& planned,
+      size_t bytes_left) {
+        auto cfg = [&plan](const planned_partition& p) -> fetch_config& {
+            return plan.fetches_per_shard[p.shard].requests[p.index].cfg;
+        };
+
+        std::vector<size_t> demands;
+        demands.reserve(planned.size());
+        for (const auto& p : planned) {
+            if (p.expects_data) {
+                demands.push_back(cfg(p).max_bytes);
+            }
+        }
+        auto shares = split_fetch_budget(
+          bytes_left, demands, min_partition_share);
+        const size_t max_share = shares.empty()
+                                   ? bytes_left
+                                   : *std::max_element(
+                                     shares.begin(), shares.end());
+
+        auto share_it = shares.begin();
+        for (const auto& p : planned) {
+            auto& config = cfg(p);
+            // a partition asking for 0 bytes still gets its first batch
+            const bool left_out = p.expects_data && config.max_bytes > 0
+                                  && *share_it == 0;
+            if (p.expects_data) {
+                config.max_bytes = *share_it++;
+            } else {
+                config.max_bytes = std::min(config.max_bytes, max_share);
+            }
+            config.skip_read = left_out || bytes_left == 0;
+        }
+    }
 };
 
 /**
@@ -1454,7 +1754,28 @@ kafka::fetch_plan make_simple_fetch_plan(op_context& octx) {
 } // namespace testing
 
 namespace {
+/*
+ * Caps the budget of the fetch to what the client can read within its fetch
+ * quota. The quota is enforced after the fetch, by throttling the client once
+ * it's in deficit, so without this a client over its quota still does all of
+ * the reads first. The fetch plan splits the capped budget over the
+ * partitions, so it also caps what is read from each of them.
+ */
+ss::future<> cap_budget_to_fetch_quota(op_context& octx) {
+    auto available = co_await octx.rctx.quota_mgr().fetch_bytes_available(
+      octx.rctx.header().client_id);
+    if (available && *available < octx.bytes_left) {
+        vlog(
+          klog.trace,
+          "capping fetch budget from {} to {} bytes by the client quota",
+          octx.bytes_left,
+          *available);
+        octx.bytes_left = *available;
+    }
+}
+
 ss::future<> do_fetch(op_context& octx) {
+    co_await cap_budget_to_fetch_quota(octx);
     switch (config::shard_local_cfg().fetch_read_strategy) {
     case model::fetch_read_strategy::polling: {
         // first fetch, do not wait
@@ -1666,13 +1987,11 @@ ss::future<response_ptr> op_context::send_response() && {
     final_response.data.session_id = response.data.session_id;
 
     /// Account for special internal topic bytes for usage
-    for (const auto& topic : response.data.topics) {
-        const bool bytes_to_exclude = std::find(
-                                        usage_excluded_topics.cbegin(),
-                                        usage_excluded_topics.cend(),
-                                        topic.name)
-                                      != usage_excluded_topics.cend();
-        if (bytes_to_exclude) {
+    if (rctx.usage_mgr().enabled()) {
+        for (const auto& topic : response.data.topics) {
+            if (!is_usage_excluded_topic(topic.name)) {
+                continue;
+            }
             for (const auto& part : topic.partitions) {
                 if (part.records) {
                     final_response.internal_topic_bytes
@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "base/vassert.h"
 #include "cluster/rm_stm.h"
 #include "container/intrusive_list_helpers.h"
 #include "kafka/protocol/fetch.h"
@@ -21,8 +22,10 @@
 #include "utils/log_hist.h"
 
 #include <seastar/core/smp.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <memory>
+#include <vector>
 
 namespace kafka {
 
@@ -217,7 +220,16 @@ struct ntp_fetch_config {
 struct read_result {
     using foreign_data_t = ss::foreign_ptr<std::unique_ptr<iobuf>>;
     using data_t = std::unique_ptr<iobuf>;
-    using variant_t = std::variant<data_t, foreign_data_t>;
+    /// Data read on another shard, copied there into buffers that only this
+    /// result refers to. These are linked into an iobuf on the shard
+    /// assembling the response without copying them again.
+    using foreign_fragments_t = std::vector<ss::temporary_buffer<char>>;
+    using variant_t = std::variant<data_t, foreign_data_t, foreign_fragments_t>;
+
+    /// Copies `data` into buffers allocated on this shard. Unlike the
+    /// fragments of `data` they don't share memory with anything else, e.g.
+    /// the batch cache, so any shard can link them into an iobuf.
+    static foreign_fragments_t make_foreign_fragments(data_t data);
 
     /// Holds semaphore units from memory semaphores. Can be passed across
     /// shards, semaphore units will be released in the shard where the instance
@@ -288,10 +300,16 @@ struct read_result {
         return ss::visit(
           data,
           [](const data_t& d) { return d != nullptr; },
-          [](const foreign_data_t& d) { return !d->empty(); });
+          [](const foreign_data_t& d) { return !d->empty(); },
+          [](const foreign_fragments_t& f) { return !f.empty(); });
     }
 
+    /// Not available for foreign fragments, these aren't an iobuf until the
+    /// data is released.
     const iobuf& get_data() const {
+        vassert(
+          !std::holds_alternative<foreign_fragments_t>(data),
+          "foreign fragments must be released to be accessed");
         if (std::holds_alternative<data_t>(data)) {
             return *std::get<data_t>(data);
         } else {
@@ -305,6 +323,13 @@ struct read_result {
           [](const data_t& d) { return d == nullptr ? 0 : d->size_bytes(); },
           [](const foreign_data_t& d) {
               return d->empty() ? 0 : d->size_bytes();
+          },
+          [](const foreign_fragments_t& f) {
+              size_t size = 0;
+              for (const auto& buf : f) {
+                  size += buf.size();
+              }
+              return size;
           });
     }
 
@@ -316,6 +341,14 @@ struct read_result {
               auto ret = d->copy();
               d.reset();
               return ret;
+          },
+          [](foreign_fragments_t& f) {
+              iobuf ret;
+              for (auto& buf : f) {
+                  ret.append(std::make_unique<iobuf::fragment>(std::move(buf)));
+              }
+              f.clear();
+              return ret;
           });
     }
 
@@ -352,6 +385,9 @@ struct shard_fetch {
     std::vector<ntp_fetch_config> requests;
     std::vector<op_context::response_placeholder_ptr> responses;
     op_context::latency_point start_time;
+    // The last visible index of every partition in `requests` as observed by
+    // the previous fetch worker of the shard. Empty until a worker returned.
+    std::vector<model::offset> last_visible_indexes;
 
     friend std::ostream& operator<<(std::ostream& o, const shard_fetch& sf) {
         fmt::print(o, "{}", sf.requests);
@@ -398,6 +434,23 @@ struct fetch_plan {
     }
 };
 
+/**
+ * Splits the byte budget of a fetch across the partitions expected to return
+ * data, before any of them is read, so that partitions read in parallel on
+ * different shards don't each read up to the whole budget.
+ *
+ * \param demands how much each partition asks for, in request order
+ * \param min_share the smallest budget worth giving a partition; when the
+ *   budget doesn't cover this much for every partition, only the first ones
+ *   get a share
+ *
+ * The served partitions get an equal share, and the part of the share that
+ * partitions asking for less leave unused is split among the others. Returns
+ * the budget of each partition, in the order of \p demands.
+ */
+std::vector<size_t> split_fetch_budget(
+  size_t budget, const std::vector<size_t>& demands, size_t min_share);
+
 /*
  * Unit Tests Exposure
  */
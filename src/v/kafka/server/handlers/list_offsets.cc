@@ -16,14 +16,20 @@
 #include "kafka/protocol/errors.h"
 #include "kafka/server/errors.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
+#include "kafka/server/list_offsets_cache.h"
 #include "kafka/server/partition_proxy.h"
 #include "kafka/server/replicated_partition.h"
 #include "kafka/server/request_context.h"
 #include "kafka/server/response.h"
+#include "kafka/server/server.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
 #include "resource_mgmt/io_priority.h"
 
+#include <seastar/core/loop.hh>
+
+#include <boost/range/irange.hpp>
+
 namespace kafka {
 
 void list_offsets_request::compute_duplicate_topics() {
@@ -68,7 +74,8 @@ static ss::future<list_offset_partition_response> list_offsets_partition(
   model::ktp ktp,
   model::isolation_level isolation_lvl,
   kafka::leader_epoch current_leader_epoch,
-  cluster::partition_manager& mgr) {
+  cluster::partition_manager& mgr,
+  list_offsets_cache& cache) {
     auto kafka_partition = make_partition_proxy(ktp, mgr);
     if (!kafka_partition) {
         co_return list_offsets_response::make_partition(
@@ -142,13 +149,24 @@ static ss::future<list_offset_partition_response> list_offsets_partition(
           kafka_partition->leader_epoch());
     }
 
-    auto res = co_await kafka_partition->timequery(storage::timequery_config{
-      min_offset,
-      timestamp,
-      max_offset,
-      kafka_read_priority(),
-      {model::record_batch_type::raft_data},
-      octx.rctx.abort_source().local()});
+    const list_offsets_cache::version version{
+      .leader_epoch = kafka_partition->leader_epoch(),
+      .start_offset = min_offset,
+      .max_offset = max_offset,
+    };
+    std::optional<storage::timequery_result> res;
+    if (const auto* cached = cache.get(ktp, timestamp, version)) {
+        res = cached->result;
+    } else {
+        res = co_await kafka_partition->timequery(storage::timequery_config{
+          min_offset,
+          timestamp,
+          max_offset,
+          kafka_read_priority(),
+          {model::record_batch_type::raft_data},
+          octx.rctx.abort_source().local()});
+        cache.put(ktp, timestamp, version, res);
+    }
     auto id = ktp.get_partition();
     if (res) {
         co_return list_offsets_response::make_partition(
@@ -157,43 +175,70 @@ static ss::future<list_offset_partition_response> list_offsets_partition(
     co_return list_offsets_response::make_partition(id, error_code::none);
 }
 
-static ss::future<list_offset_partition_response> list_offsets_partition(
+/*
+ * A partition of the request, answered by the shard that manages it.
+ */
+struct partition_query {
+    model::ktp ktp;
+    model::timestamp timestamp;
+    kafka::leader_epoch current_leader_epoch;
+};
+
+/*
+ * The partitions of the request managed by a shard, and where their answers
+ * go in the response.
+ */
+struct shard_queries {
+    chunked_vector<partition_query> queries;
+    chunked_vector<std::pair<size_t, size_t>> positions;
+};
+
+/*
+ * Answers the partitions of the request managed by the current shard. The
+ * answers are in the order of the queries.
+ */
+static ss::future<chunked_vector<list_offset_partition_response>>
+list_offsets_shard(
   list_offsets_ctx& octx,
-  model::timestamp timestamp,
-  list_offset_topic& topic,
-  list_offset_partition& part) {
-    model::ktp ktp(topic.name, part.partition_index);
-
-    auto shard = octx.rctx.shards().shard_for(ktp);
-    if (!shard) {
-        return ss::make_ready_future<list_offset_partition_response>(
-          list_offsets_response::make_partition(
-            ktp.get_partition(), error_code::unknown_topic_or_partition));
+  chunked_vector<partition_query> queries,
+  model::isolation_level isolation_lvl,
+  cluster::partition_manager& mgr,
+  list_offsets_cache& cache) {
+    chunked_vector<list_offset_partition_response> responses;
+    responses.reserve(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        responses.emplace_back();
     }
-
-    return octx.rctx.partition_manager().invoke_on(
-      *shard,
-      octx.ssg,
-      [timestamp,
-       &octx,
-       ntp = std::move(ktp),
-       isolation_lvl = model::isolation_level(
-         octx.request.data.isolation_level),
-       current_leader_epoch = part.current_leader_epoch](
-        cluster::partition_manager& mgr) mutable {
+    co_await ss::parallel_for_each(
+      boost::irange<size_t>(0, queries.size()),
+      [&octx, &queries, &responses, isolation_lvl, &mgr, &cache](size_t i) {
+          auto& q = queries[i];
           return list_offsets_partition(
-            octx,
-            timestamp,
-            std::move(ntp),
-            isolation_lvl,
-            current_leader_epoch,
-            mgr);
+                   octx,
+                   q.timestamp,
+                   q.ktp,
+                   isolation_lvl,
+                   q.current_leader_epoch,
+                   mgr,
+                   cache)
+            .then([&responses, i](list_offset_partition_response r) {
+                responses[i] = std::move(r);
+            });
       });
+    co_return responses;
 }
 
-static ss::future<list_offset_topic_response>
-list_offsets_topic(list_offsets_ctx& octx, list_offset_topic& topic) {
-    std::vector<ss::future<list_offset_partition_response>> partitions;
+/*
+ * Answers the partitions of a topic that can be answered without asking the
+ * shard that manages them, and queues the others in `shards`. Returns the
+ * response of the topic, in which the queued partitions are placeholders.
+ */
+static list_offset_topic_response queue_topic(
+  list_offsets_ctx& octx,
+  size_t topic_idx,
+  list_offset_topic& topic,
+  std::vector<shard_queries>& shards) {
+    chunked_vector<list_offset_partition_response> partitions;
     partitions.reserve(topic.partitions.size());
 
     const auto* disabled_set
@@ -202,58 +247,95 @@ list_offsets_topic(list_offsets_ctx& octx, list_offset_topic& topic) {
 
     for (auto& part : topic.partitions) {
         if (octx.request.duplicate_tp(topic.name, part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index, error_code::invalid_request)));
+            partitions.push_back(list_offsets_response::make_partition(
+              part.partition_index, error_code::invalid_request));
             continue;
         }
 
         if (!octx.rctx.metadata_cache().contains(
               model::topic_namespace_view(model::kafka_namespace, topic.name),
               part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index,
-                  error_code::unknown_topic_or_partition)));
+            partitions.push_back(list_offsets_response::make_partition(
+              part.partition_index, error_code::unknown_topic_or_partition));
             continue;
         }
 
         if (disabled_set && disabled_set->is_disabled(part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index, error_code::replica_not_available)));
+            partitions.push_back(list_offsets_response::make_partition(
+              part.partition_index, error_code::replica_not_available));
+            continue;
+        }
+
+        model::ktp ktp(topic.name, part.partition_index);
+        auto shard = octx.rctx.shards().shard_for(ktp);
+        if (!shard) {
+            partitions.push_back(list_offsets_response::make_partition(
+              part.partition_index, error_code::unknown_topic_or_partition));
             continue;
         }
 
-        auto pr = list_offsets_partition(octx, part.timestamp, topic, part);
-        partitions.push_back(std::move(pr));
+        auto& queued = shards[*shard];
+        queued.queries.push_back(partition_query{
+          .ktp = std::move(ktp),
+          .timestamp = part.timestamp,
+          .current_leader_epoch = part.current_leader_epoch,
+        });
+        queued.positions.emplace_back(topic_idx, partitions.size());
+        partitions.push_back(list_offsets_response::make_partition(
+          part.partition_index, error_code::none));
     }
 
-    return when_all_succeed(partitions.begin(), partitions.end())
-      .then([name = std::move(topic.name)](
-              std::vector<list_offset_partition_response> parts) mutable {
-          return list_offset_topic_response{
-            .name = std::move(name),
-            .partitions = chunked_vector<list_offset_partition_response>{
-              std::make_move_iterator(parts.begin()),
-              std::make_move_iterator(parts.end())}};
-      });
+    return list_offset_topic_response{
+      .name = std::move(topic.name), .partitions = std::move(partitions)};
 }
 
-static chunked_vector<ss::future<list_offset_topic_response>>
-list_offsets_topics(list_offsets_ctx& octx) {
-    chunked_vector<ss::future<list_offset_topic_response>> topics;
-    topics.reserve(octx.request.data.topics.size());
+/*
+ * Fills the response with the answers of all the partitions of the request.
+ * The partitions managed by a shard are answered in a single cross shard call.
+ */
+static ss::future<> list_offsets_topics(list_offsets_ctx& octx) {
+    std::vector<shard_queries> shards(ss::smp::count);
 
-    for (auto& topic : octx.request.data.topics) {
-        auto tr = list_offsets_topic(octx, topic);
-        topics.push_back(std::move(tr));
+    octx.response.data.topics.reserve(octx.request.data.topics.size());
+    for (size_t i = 0; i < octx.request.data.topics.size(); ++i) {
+        octx.response.data.topics.push_back(
+          queue_topic(octx, i, octx.request.data.topics[i], shards));
     }
 
-    return topics;
+    auto isolation_lvl = model::isolation_level(
+      octx.request.data.isolation_level);
+    co_await ss::parallel_for_each(
+      boost::irange<ss::shard_id>(0, ss::smp::count),
+      [&octx, &shards, isolation_lvl](ss::shard_id shard) {
+          auto& queued = shards[shard];
+          if (queued.queries.empty()) {
+              return ss::now();
+          }
+          return octx.rctx.connection()
+            ->server()
+            .container()
+            .invoke_on(
+              shard,
+              octx.ssg,
+              [&octx, queries = std::move(queued.queries), isolation_lvl](
+                kafka::server& srv) mutable {
+                  return list_offsets_shard(
+                    octx,
+                    std::move(queries),
+                    isolation_lvl,
+                    srv.partition_manager().local(),
+                    srv.get_list_offsets_cache());
+              })
+            .then([&octx, &queued](
+                    chunked_vector<list_offset_partition_response> answers) {
+                for (size_t i = 0; i < answers.size(); ++i) {
+                    auto [topic_idx, partition_idx] = queued.positions[i];
+                    octx.response.data.topics[topic_idx]
+                      .partitions[partition_idx]
+                      = std::move(answers[i]);
+                }
+            });
+      });
 }
 
 /*
@@ -340,15 +422,10 @@ list_offsets_handler::handle(request_context ctx, ss::smp_service_group ssg) {
       std::move(ctx), std::move(request), ssg, std::move(unauthorized_topics));
 
     return ss::do_with(std::move(octx), [](list_offsets_ctx& octx) {
-        auto topics = list_offsets_topics(octx);
-        return ss::when_all_succeed(topics.begin(), topics.end())
-          .then([&octx](std::vector<list_offset_topic_response> topics) {
-              octx.response.data.topics = {
-                std::make_move_iterator(topics.begin()),
-                std::make_move_iterator(topics.end())};
-              handle_unauthorized(octx);
-              return octx.rctx.respond(std::move(octx.response));
-          });
+        return list_offsets_topics(octx).then([&octx] {
+            handle_unauthorized(octx);
+            return octx.rctx.respond(std::move(octx.response));
+        });
     });
 }
 
@@ -23,6 +23,7 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
@@ -78,7 +79,8 @@ std::optional<cluster::leader_term> get_leader_term(
   model::topic_namespace_view tp_ns,
   model::partition_id p_id,
   const cluster::metadata_cache& md_cache,
-  const std::vector<model::node_id>& replicas) {
+  const std::vector<model::node_id>& replicas,
+  bool* random_leader = nullptr) {
     auto leader_term = md_cache.get_leader_term(tp_ns, p_id);
     /**
      * If current broker do not yet have any information about leadership we
@@ -97,6 +99,9 @@ std::optional<cluster::leader_term> get_leader_term(
         if (previous == *config::node().node_id()) {
             auto idx = fast_prng_source() % replicas.size();
             leader_term->leader = replicas[idx];
+            if (random_leader) {
+                *random_leader = true;
+            }
         }
     }
 
@@ -110,11 +115,16 @@ bool is_internal(model::topic_namespace_view tp_ns) {
 
 } // namespace
 
+/**
+ * \param random_leader if not null, set to true if the leader of a partition
+ *   was picked at random
+ */
 metadata_response::topic make_topic_response_from_topic_metadata(
   const cluster::metadata_cache& md_cache,
   const cluster::topic_metadata& tp_md,
   const is_node_isolated_or_decommissioned is_node_isolated,
-  bool recovery_mode_enabled) {
+  bool recovery_mode_enabled,
+  bool* random_leader = nullptr) {
     metadata_response::topic tp;
     tp.error_code = error_code::none;
     model::topic_namespace_view tp_ns = tp_md.get_configuration().tp_ns;
@@ -143,7 +153,8 @@ metadata_response::topic make_topic_response_from_topic_metadata(
         }
         p.partition_index = p_as.id;
         p.leader_id = no_leader;
-        auto lt = get_leader_term(tp_ns, p_as.id, md_cache, replicas);
+        auto lt = get_leader_term(
+          tp_ns, p_as.id, md_cache, replicas, random_leader);
         if (lt && !is_node_isolated && p.error_code == error_code::none) {
             p.leader_id = lt->leader.value_or(no_leader);
             p.leader_epoch = leader_epoch_from_term(lt->term);
@@ -244,6 +255,52 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+static metadata_response::topic
+copy_topic_response(const metadata_response::topic& tp) {
+    return metadata_response::topic{
+      .error_code = tp.error_code,
+      .name = tp.name,
+      .is_internal = tp.is_internal,
+      .partitions = tp.partitions.copy(),
+      .topic_authorized_operations = tp.topic_authorized_operations,
+    };
+}
+
+/**
+ * Builds the response of the topic or copies it from the metadata response
+ * cache of the shard. Responses of isolated nodes, of nodes in recovery mode
+ * and of topics with leaders picked at random aren't cached, these differ
+ * from the usual ones or from one request to the next.
+ */
+static metadata_response::topic get_topic_response(
+  request_context& ctx,
+  const cluster::topic_metadata& md,
+  const is_node_isolated_or_decommissioned is_node_isolated) {
+    const auto& md_cache = ctx.metadata_cache();
+    if (is_node_isolated || ctx.recovery_mode_enabled()) {
+        return make_topic_response_from_topic_metadata(
+          md_cache, md, is_node_isolated, ctx.recovery_mode_enabled());
+    }
+
+    model::topic_namespace_view tp_ns = md.get_configuration().tp_ns;
+    const metadata_response_cache::version version{
+      .topics = md_cache.get_topics_revision(),
+      .leadership = md_cache.get_topic_leadership_version(tp_ns),
+    };
+    auto& cache = ctx.get_metadata_response_cache();
+    if (const auto* cached = cache.get(tp_ns, version); cached) {
+        return copy_topic_response(*cached);
+    }
+
+    bool random_leader = false;
+    auto res = make_topic_response_from_topic_metadata(
+      md_cache, md, is_node_isolated, false, &random_leader);
+    if (!random_leader) {
+        cache.put(tp_ns, version, copy_topic_response(res));
+    }
+    return res;
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
@@ -258,8 +315,7 @@ static metadata_response::topic make_topic_response(
           details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
     }
 
-    auto res = make_topic_response_from_topic_metadata(
-      ctx.metadata_cache(), md, is_node_isolated, ctx.recovery_mode_enabled());
+    auto res = get_topic_response(ctx, md, is_node_isolated);
     res.topic_authorized_operations = auth_operations;
     return res;
 }
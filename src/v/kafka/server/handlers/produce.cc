@@ -10,6 +10,7 @@
 #include "kafka/server/handlers/produce.h"
 
 #include "base/likely.h"
+#include "base/units.h"
 #include "base/vlog.h"
 #include "bytes/iobuf.h"
 #include "cluster/metadata_cache.h"
@@ -28,6 +29,7 @@
 #include "pandaproxy/schema_registry/validation.h"
 #include "raft/errc.h"
 #include "ssx/future-util.h"
+#include "storage/parser_utils.h"
 #include "utils/remote.h"
 #include "utils/to_string.h"
 
@@ -35,6 +37,8 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/with_scheduling_group.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/log.hh>
 
 #include <boost/container_hash/extensions.hpp>
@@ -104,7 +108,14 @@ acks_to_replicate_options(int16_t acks, std::chrono::milliseconds timeout) {
 }
 
 static inline model::record_batch_reader
-reader_from_lcore_batch(model::record_batch&& batch) {
+reader_from_lcore_batch(model::record_batch&& batch, ss::shard_id shard) {
+    /*
+     * When the partition is managed by this core the batch is handed over as
+     * is, there is no reason for its consumers to copy it.
+     */
+    if (shard == ss::this_shard_id()) {
+        return model::make_memory_record_batch_reader(std::move(batch));
+    }
     /*
      * The remainder of work for this partition is handled on its home
      * core. The foreign memory record batch reader requires that once the
@@ -297,12 +308,208 @@ static auto validate_batch_timestamps(
     }
 }
 
+/*
+ * Returns the codec to compress a produced batch with if the client didn't
+ * compress it and its topic has a compression type, as long as the shard is
+ * within its recompression budget. Small batches are left as they are, they
+ * don't compress well.
+ */
+static std::optional<model::compression> recompression_codec(
+  produce_ctx& octx,
+  const cluster::topic_configuration& topic_cfg,
+  const model::record_batch& batch) {
+    static constexpr size_t min_recompression_bytes = 1_KiB;
+    if (
+      batch.compressed() || batch.header().attrs.is_control()
+      || static_cast<size_t>(batch.size_bytes()) < min_recompression_bytes) {
+        return std::nullopt;
+    }
+    auto codec = topic_cfg.properties.compression.value_or(
+      octx.rctx.metadata_cache().get_default_compression());
+    if (
+      codec == model::compression::none
+      || codec == model::compression::producer) {
+        return std::nullopt;
+    }
+    if (!octx.rctx.connection()->server().try_admit_recompression(
+          batch.size_bytes())) {
+        return std::nullopt;
+    }
+    return codec;
+}
+
+/*
+ * Compresses a batch in the given scheduling group. The batch is returned as
+ * received if compressing it fails or doesn't make it smaller.
+ */
+static ss::future<model::record_batch> recompress_batch(
+  ss::scheduling_group sg,
+  model::compression codec,
+  model::record_batch batch) {
+    auto compressed = co_await ss::coroutine::as_future(
+      ss::with_scheduling_group(sg, [codec, shared = batch.share()]() mutable {
+          return storage::internal::compress_batch(codec, std::move(shared));
+      }));
+    if (compressed.failed()) {
+        vlog(
+          klog.warn,
+          "failed to compress produced batch {} with {}: {}",
+          batch.header(),
+          codec,
+          compressed.get_exception());
+        co_return batch;
+    }
+    auto result = compressed.get();
+    if (result.size_bytes() >= batch.size_bytes()) {
+        co_return batch;
+    }
+    co_return result;
+}
+
+/*
+ * Hands the batch over to the shard of the partition and appends it there.
+ * `dispatch` is set once the batch is enqueued for replication.
+ */
+static ss::future<produce_response::partition> append_to_partition(
+  produce_ctx& octx,
+  model::ntp ntp,
+  ss::shard_id shard,
+  model::record_batch batch,
+  std::optional<pandaproxy::schema_registry::schema_id_validator> validator,
+  uint32_t batch_max_bytes,
+  std::unique_ptr<ss::promise<>> dispatch) {
+    auto batch_size = batch.size_bytes();
+    // reject oversized batches before they are copied over to another shard,
+    // the limit doesn't depend on any state of the partition
+    if (unlikely(static_cast<uint32_t>(batch_size) > batch_max_bytes)) {
+        dispatch->set_value();
+        return ss::make_ready_future<produce_response::partition>(
+          produce_response::partition{
+            .partition_index = ntp.tp.partition,
+            .error_code = error_code::message_too_large});
+    }
+    const auto& hdr = batch.header();
+    auto bid = model::batch_identity::from(hdr);
+    auto num_records = batch.record_count();
+    auto reader = reader_from_lcore_batch(std::move(batch), shard);
+    auto start = std::chrono::steady_clock::now();
+
+    auto m = octx.rctx.probe().auto_produce_measurement();
+    auto timeout = octx.request.data.timeout_ms;
+    if (timeout < 0ms) {
+        static constexpr std::chrono::milliseconds max_timeout{
+          std::numeric_limits<int32_t>::max()};
+        // negative timeout translates to no timeout
+        timeout = max_timeout;
+    }
+    return octx.rctx.partition_manager()
+      .invoke_on(
+        shard,
+        octx.ssg,
+        [reader = std::move(reader),
+         validator = std::move(validator),
+         ntp = std::move(ntp),
+         dispatch = std::move(dispatch),
+         num_records,
+         batch_size,
+         bid,
+         acks = octx.request.data.acks,
+         timeout,
+         source_shard = ss::this_shard_id()](
+          cluster::partition_manager& mgr) mutable {
+            auto partition = mgr.get(ntp);
+            if (!partition) {
+                return finalize_request_with_error_code(
+                  error_code::not_leader_for_partition,
+                  std::move(dispatch),
+                  ntp,
+                  source_shard);
+            }
+            if (unlikely(!partition->is_leader())) {
+                return finalize_request_with_error_code(
+                  error_code::not_leader_for_partition,
+                  std::move(dispatch),
+                  ntp,
+                  source_shard);
+            }
+
+            auto probe = std::addressof(partition->probe());
+            return pandaproxy::schema_registry::maybe_validate_schema_id(
+                     std::move(validator), std::move(reader), probe)
+              .then([ntp{std::move(ntp)},
+                     partition{std::move(partition)},
+                     dispatch = std::move(dispatch),
+                     bid,
+                     acks,
+                     source_shard,
+                     num_records,
+                     batch_size,
+                     timeout](auto reader) mutable {
+                  if (reader.has_error()) {
+                      return finalize_request_with_error_code(
+                        reader.assume_error(),
+                        std::move(dispatch),
+                        ntp,
+                        source_shard);
+                  }
+                  auto stages = partition_append(
+                    ntp.tp.partition,
+                    ss::make_lw_shared<replicated_partition>(
+                      std::move(partition)),
+                    bid,
+                    std::move(reader).assume_value(),
+                    acks,
+                    num_records,
+                    batch_size,
+                    timeout);
+                  return stages.dispatched
+                    .then_wrapped(
+                      [source_shard, dispatch = std::move(dispatch)](
+                        ss::future<> f) mutable {
+                          if (f.failed()) {
+                              (void)ss::smp::submit_to(
+                                source_shard,
+                                [dispatch = std::move(dispatch),
+                                 e = f.get_exception()]() mutable {
+                                    dispatch->set_exception(e);
+                                    dispatch.reset();
+                                });
+                              return;
+                          }
+                          (void)ss::smp::submit_to(
+                            source_shard,
+                            [dispatch = std::move(dispatch)]() mutable {
+                                dispatch->set_value();
+                                dispatch.reset();
+                            });
+                      })
+                    .then([f = std::move(stages.produced)]() mutable {
+                        return std::move(f);
+                    });
+              });
+        })
+      .then([&octx, start, m = std::move(m)](
+              produce_response::partition p) {
+          if (p.error_code == error_code::none) {
+              auto dur = std::chrono::steady_clock::now() - start;
+              octx.rctx.connection()->server().update_produce_latency(dur);
+          } else {
+              m->cancel();
+          }
+          return p;
+      });
+}
+
 /**
  * \brief handle writing to a single topic partition.
+ *
+ * \param topic_cfg configuration of the topic, looked up once for all the
+ *   partitions of the topic in the request
  */
 static partition_produce_stages produce_topic_partition(
   produce_ctx& octx,
   produce_request::topic& topic,
+  const std::optional<cluster::topic_configuration>& topic_cfg,
   produce_request::partition& part) {
     auto ntp = model::ntp(
       model::kafka_namespace, topic.name, part.partition_index);
@@ -322,9 +529,6 @@ static partition_produce_stages produce_topic_partition(
     // steal the batch from the adapter
     auto batch = std::move(part.records->adapter.batch.value());
 
-    auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
-      model::topic_namespace_view(model::kafka_namespace, topic.name));
-
     if (!topic_cfg) {
         return make_ready_stage(produce_response::partition{
           .partition_index = ntp.tp.partition,
@@ -344,132 +548,46 @@ static partition_produce_stages produce_topic_partition(
           model::timestamp_type::append_time, new_timestamp.value());
     }
 
-    const auto& hdr = batch.header();
-    auto bid = model::batch_identity::from(hdr);
-    auto batch_size = batch.size_bytes();
-    auto num_records = batch.record_count();
-    auto reader = reader_from_lcore_batch(std::move(batch));
     auto validator
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
         octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
-    auto start = std::chrono::steady_clock::now();
-
     auto dispatch = std::make_unique<ss::promise<>>();
     auto dispatch_f = dispatch->get_future();
-    auto m = octx.rctx.probe().auto_produce_measurement();
-    auto timeout = octx.request.data.timeout_ms;
-    if (timeout < 0ms) {
-        static constexpr std::chrono::milliseconds max_timeout{
-          std::numeric_limits<int32_t>::max()};
-        // negative timeout translates to no timeout
-        timeout = max_timeout;
+    ss::future<produce_response::partition> f = ss::make_ready_future<
+      produce_response::partition>();
+    if (auto codec = recompression_codec(octx, *topic_cfg, batch); codec) {
+        f = recompress_batch(
+              octx.rctx.connection()
+                ->server()
+                .produce_compression_scheduling_group(),
+              *codec,
+              std::move(batch))
+              .then([&octx,
+                     ntp = std::move(ntp),
+                     shard = *shard,
+                     validator = std::move(validator),
+                     batch_max_bytes,
+                     dispatch = std::move(dispatch)](
+                      model::record_batch compressed) mutable {
+                  return append_to_partition(
+                    octx,
+                    std::move(ntp),
+                    shard,
+                    std::move(compressed),
+                    std::move(validator),
+                    batch_max_bytes,
+                    std::move(dispatch));
+              });
+    } else {
+        f = append_to_partition(
+          octx,
+          std::move(ntp),
+          *shard,
+          std::move(batch),
+          std::move(validator),
+          batch_max_bytes,
+          std::move(dispatch));
     }
-    auto f
-      = octx.rctx.partition_manager()
-          .invoke_on(
-            *shard,
-            octx.ssg,
-            [reader = std::move(reader),
-             validator = std::move(validator),
-             ntp = std::move(ntp),
-             dispatch = std::move(dispatch),
-             num_records,
-             batch_size,
-             bid,
-             acks = octx.request.data.acks,
-             batch_max_bytes,
-             timeout,
-             source_shard = ss::this_shard_id()](
-              cluster::partition_manager& mgr) mutable {
-                auto partition = mgr.get(ntp);
-                if (!partition) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(
-                      static_cast<uint32_t>(batch_size) > batch_max_bytes)) {
-                    return finalize_request_with_error_code(
-                      error_code::message_too_large,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(!partition->is_leader())) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-
-                auto probe = std::addressof(partition->probe());
-                return pandaproxy::schema_registry::maybe_validate_schema_id(
-                         std::move(validator), std::move(reader), probe)
-                  .then([ntp{std::move(ntp)},
-                         partition{std::move(partition)},
-                         dispatch = std::move(dispatch),
-                         bid,
-                         acks,
-                         source_shard,
-                         num_records,
-                         batch_size,
-                         timeout](auto reader) mutable {
-                      if (reader.has_error()) {
-                          return finalize_request_with_error_code(
-                            reader.assume_error(),
-                            std::move(dispatch),
-                            ntp,
-                            source_shard);
-                      }
-                      auto stages = partition_append(
-                        ntp.tp.partition,
-                        ss::make_lw_shared<replicated_partition>(
-                          std::move(partition)),
-                        bid,
-                        std::move(reader).assume_value(),
-                        acks,
-                        num_records,
-                        batch_size,
-                        timeout);
-                      return stages.dispatched
-                        .then_wrapped(
-                          [source_shard, dispatch = std::move(dispatch)](
-                            ss::future<> f) mutable {
-                              if (f.failed()) {
-                                  (void)ss::smp::submit_to(
-                                    source_shard,
-                                    [dispatch = std::move(dispatch),
-                                     e = f.get_exception()]() mutable {
-                                        dispatch->set_exception(e);
-                                        dispatch.reset();
-                                    });
-                                  return;
-                              }
-                              (void)ss::smp::submit_to(
-                                source_shard,
-                                [dispatch = std::move(dispatch)]() mutable {
-                                    dispatch->set_value();
-                                    dispatch.reset();
-                                });
-                          })
-                        .then([f = std::move(stages.produced)]() mutable {
-                            return std::move(f);
-                        });
-                  });
-            })
-          .then([&octx, start, m = std::move(m)](
-                  produce_response::partition p) {
-              if (p.error_code == error_code::none) {
-                  auto dur = std::chrono::steady_clock::now() - start;
-                  octx.rctx.connection()->server().update_produce_latency(dur);
-              } else {
-                  m->cancel();
-              }
-              return p;
-          });
     return partition_produce_stages{
       .dispatched = std::move(dispatch_f),
       .produced = std::move(f),
@@ -481,7 +599,12 @@ partition_produce_stages produce_single_partition(
   produce_ctx& octx,
   produce_request::topic& topic,
   produce_request::partition& part) {
-    return produce_topic_partition(octx, topic, part);
+    return produce_topic_partition(
+      octx,
+      topic,
+      octx.rctx.metadata_cache().get_topic_cfg(
+        model::topic_namespace_view(model::kafka_namespace, topic.name)),
+      part);
 }
 } // namespace testing
 
@@ -498,6 +621,31 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
     const auto* disabled_set
       = octx.rctx.metadata_cache().get_topic_disabled_set(
         model::topic_namespace_view{model::kafka_namespace, topic.name});
+    const auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
+      model::topic_namespace_view{model::kafka_namespace, topic.name});
+
+    const bool is_transform_logs_topic
+      = topic.name == model::transform_log_internal_topic;
+
+    const auto& kafka_noproduce_topics
+      = config::shard_local_cfg().kafka_noproduce_topics();
+
+    const bool is_noproduce_topic = is_transform_logs_topic
+                                    || std::find(
+                                         kafka_noproduce_topics.begin(),
+                                         kafka_noproduce_topics.end(),
+                                         topic.name)
+                                         != kafka_noproduce_topics.end();
+
+    const bool audit_produce_restricted
+      = !octx.rctx.authorized_auditor()
+        && topic.name == model::kafka_audit_logging_topic();
+
+    // Need to make an exception here in case the audit log topic is in the
+    // noproduce topics list
+    const bool is_audit_produce
+      = octx.rctx.authorized_auditor()
+        && topic.name == model::kafka_audit_logging_topic();
 
     for (auto& part : topic.partitions) {
         auto push_error_response = [&](error_code errc) {
@@ -509,28 +657,6 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
                   .error_code = errc}));
         };
 
-        const bool is_transform_logs_topic
-          = topic.name == model::transform_log_internal_topic;
-
-        const auto& kafka_noproduce_topics
-          = config::shard_local_cfg().kafka_noproduce_topics();
-
-        const bool is_noproduce_topic = is_transform_logs_topic
-                                        || std::find(
-                                             kafka_noproduce_topics.begin(),
-                                             kafka_noproduce_topics.end(),
-                                             topic.name)
-                                             != kafka_noproduce_topics.end();
-
-        const bool audit_produce_restricted
-          = !octx.rctx.authorized_auditor()
-            && topic.name == model::kafka_audit_logging_topic();
-
-        // Need to make an exception here in case the audit log topic is in the
-        // noproduce topics list
-        const bool is_audit_produce
-          = octx.rctx.authorized_auditor()
-            && topic.name == model::kafka_audit_logging_topic();
         if (
           (is_noproduce_topic || audit_produce_restricted)
           && !is_audit_produce) {
@@ -583,7 +709,7 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
             continue;
         }
 
-        auto pr = produce_topic_partition(octx, topic, part);
+        auto pr = produce_topic_partition(octx, topic, topic_cfg, part);
         partitions_produced.push_back(std::move(pr.produced));
         partitions_dispatched.push_back(std::move(pr.dispatched));
     }
@@ -647,13 +773,11 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
 
     // Account for special internal topic bytes for usage
     produce_response resp;
-    for (const auto& topic : request.data.topics) {
-        const bool bytes_to_exclude = std::find(
-                                        usage_excluded_topics.cbegin(),
-                                        usage_excluded_topics.cend(),
-                                        topic.name())
-                                      != usage_excluded_topics.cend();
-        if (bytes_to_exclude) {
+    if (ctx.usage_mgr().enabled()) {
+        for (const auto& topic : request.data.topics) {
+            if (!is_usage_excluded_topic(topic.name)) {
+                continue;
+            }
             for (const auto& part : topic.partitions) {
                 if (part.records) {
                     const auto& records = part.records;
@@ -764,10 +888,11 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
 
     ss::promise<> dispatched_promise;
     auto dispatched_f = dispatched_promise.get_future();
+    auto start = std::chrono::steady_clock::now();
     auto produced_f = ss::do_with(
       produce_ctx(std::move(ctx), std::move(request), std::move(resp), ssg),
-      [dispatched_promise = std::move(dispatched_promise)](
-        produce_ctx& octx) mutable {
+      [dispatched_promise = std::move(dispatched_promise),
+       start](produce_ctx& octx) mutable {
           // dispatch produce requests for each topic
           auto stages = produce_topics(octx);
           std::vector<ss::future<>> dispatched;
@@ -782,15 +907,24 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
           return seastar::when_all_succeed(dispatched.begin(), dispatched.end())
             .then_wrapped([&octx,
                            dispatched_promise = std::move(dispatched_promise),
-                           produced = std::move(produced)](
-                            ss::future<> f) mutable {
+                           produced = std::move(produced),
+                           start](ss::future<> f) mutable {
                 try {
                     f.get();
                     dispatched_promise.set_value();
+                    auto dispatched_at = std::chrono::steady_clock::now();
+                    octx.rctx.probe().record_produce_dispatch_latency(
+                      std::chrono::duration_cast<std::chrono::microseconds>(
+                        dispatched_at - start));
                     // collect topic responses
                     return when_all_succeed(produced.begin(), produced.end())
-                      .then(
-                        [&octx](std::vector<produce_response::topic> topics) {
+                      .then([&octx, dispatched_at](
+                              std::vector<produce_response::topic> topics) {
+                            octx.rctx.probe().record_produce_replicate_latency(
+                              std::chrono::duration_cast<
+                                std::chrono::microseconds>(
+                                std::chrono::steady_clock::now()
+                                - dispatched_at));
                             std::move(
                               topics.begin(),
                               topics.end(),
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "container/chunked_hash_map.h"
+#include "kafka/protocol/types.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/timestamp.h"
+#include "storage/types.h"
+
+#include <absl/container/inlined_vector.h>
+
+#include <optional>
+
+namespace kafka {
+
+/**
+ * Caches the answers of ListOffsets timestamp queries of the partitions of a
+ * shard. Lag monitoring tools send the same queries for every partition every
+ * few seconds and each one is a lookup in the log.
+ *
+ * The answer of a query only depends on the range of offsets it searches and
+ * on the leader that answers it, so an answer stays valid until the leader
+ * epoch, the start offset or the last searchable offset of its partition
+ * changes. A partition keeps the answers of its last few distinct timestamps.
+ *
+ * The earliest and latest offsets are not cached, they are read from the
+ * partition without a lookup.
+ */
+class list_offsets_cache {
+public:
+    struct version {
+        kafka::leader_epoch leader_epoch;
+        model::offset start_offset;
+        model::offset max_offset;
+
+        bool operator==(const version&) const = default;
+    };
+
+    struct answer {
+        model::timestamp query;
+        std::optional<storage::timequery_result> result;
+    };
+
+    static constexpr size_t max_answers_per_partition = 4;
+    static constexpr size_t max_partitions = 10'000;
+
+    /// Returns the cached answer of `query` if it was computed at `v`,
+    /// nullptr otherwise.
+    const answer*
+    get(const model::ktp& ktp, model::timestamp query, version v) const {
+        auto it = _cache.find(ktp);
+        if (it == _cache.end() || it->second.v != v) {
+            return nullptr;
+        }
+        for (const auto& a : it->second.answers) {
+            if (a.query == query) {
+                return &a;
+            }
+        }
+        return nullptr;
+    }
+
+    void put(
+      const model::ktp& ktp,
+      model::timestamp query,
+      version v,
+      std::optional<storage::timequery_result> result) {
+        auto it = _cache.find(ktp);
+        if (it == _cache.end()) {
+            if (_cache.size() >= max_partitions) {
+                // partitions come and go with leadership, rather than tracking
+                // them start over
+                _cache.clear();
+            }
+            it = _cache.emplace(ktp.to_ntp(), entry{.v = v}).first;
+        } else if (it->second.v != v) {
+            it->second = entry{.v = v};
+        }
+        auto& answers = it->second.answers;
+        if (answers.size() >= max_answers_per_partition) {
+            answers.erase(answers.begin());
+        }
+        answers.push_back(answer{.query = query, .result = result});
+    }
+
+    /**
+     * @brief Return the number of partitions currently cached.
+     */
+    size_t size() const { return _cache.size(); }
+
+private:
+    struct entry {
+        version v;
+        // oldest first
+        absl::InlinedVector<answer, max_answers_per_partition> answers;
+    };
+
+    chunked_hash_map<
+      model::ntp,
+      entry,
+      model::ktp_hash_eq,
+      model::ktp_hash_eq>
+      _cache;
+};
+
+} // namespace kafka
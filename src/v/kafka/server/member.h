@@ -122,7 +122,12 @@ public:
     const kafka::protocol_type& protocol_type() const { return _protocol_type; }
 
     /// Get the member's assignment.
-    const bytes assignment() const { return iobuf_to_bytes(_state.assignment); }
+    bytes assignment() const { return iobuf_to_bytes(_state.assignment); }
+
+    /// Get the member's assignment sharing its underlying buffers.
+    iobuf share_assignment() {
+        return _state.assignment.share(0, _state.assignment.size_bytes());
+    }
 
     /// Set the member's assignment.
     void set_assignment(bytes assignment) {
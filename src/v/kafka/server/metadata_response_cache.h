@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/partition_leaders_table.h"
+#include "container/chunked_hash_map.h"
+#include "kafka/protocol/metadata.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+namespace kafka {
+
+/**
+ * Caches the topics of Metadata responses. They are the bulk of a response
+ * and, for topics with many partitions, the most expensive part to build.
+ *
+ * An entry stays valid until the topic table of the shard applies a command,
+ * which invalidates all of them, or the leadership of a partition of its topic
+ * changes. Leadership changes are by far the most common and only invalidate
+ * the topic they affect. Entries don't depend on the version of the request,
+ * a response is encoded for the version after it's built.
+ */
+class metadata_response_cache {
+public:
+    struct version {
+        model::revision_id topics;
+        cluster::partition_leaders_table::version leadership;
+
+        bool operator==(const version&) const = default;
+    };
+
+    /// Returns the cached topic if it was built at `v`, nullptr otherwise.
+    const metadata_response::topic*
+    get(model::topic_namespace_view tp_ns, version v) const {
+        if (v.topics != _topics_revision) {
+            return nullptr;
+        }
+        auto it = _cache.find(tp_ns);
+        if (it == _cache.end() || it->second.leadership != v.leadership) {
+            return nullptr;
+        }
+        return &it->second.topic;
+    }
+
+    void put(
+      model::topic_namespace_view tp_ns,
+      version v,
+      metadata_response::topic topic) {
+        if (v.topics != _topics_revision) {
+            // all the entries are stale, including the ones of topics that
+            // don't exist anymore
+            _cache.clear();
+            _topics_revision = v.topics;
+        }
+        _cache.insert_or_assign(
+          model::topic_namespace(tp_ns),
+          entry{.leadership = v.leadership, .topic = std::move(topic)});
+    }
+
+    /**
+     * @brief Return the number of topics currently cached.
+     */
+    size_t size() const { return _cache.size(); }
+
+private:
+    struct entry {
+        cluster::partition_leaders_table::version leadership;
+        metadata_response::topic topic;
+    };
+
+    model::revision_id _topics_revision;
+    chunked_hash_map<
+      model::topic_namespace,
+      entry,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _cache;
+};
+
+} // namespace kafka
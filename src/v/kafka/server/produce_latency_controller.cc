@@ -0,0 +1,70 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/produce_latency_controller.h"
+
+#include "kafka/server/server.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <cmath>
+
+namespace kafka {
+static ss::logger latency_ctrl_log{"produce_latency_ctrl"};
+
+produce_latency_sampler::produce_latency_sampler(
+  ss::sharded<server>& server, double quantile)
+  : _server(server)
+  , _quantile(quantile) {}
+
+ss::future<int64_t> produce_latency_sampler::sample_backlog() {
+    // The kafka server is stopped before the services registered after it
+    if (!_server.local_is_initialized()) {
+        co_return 0;
+    }
+    auto cur = _server.local().latency_probe().produce_latency_histogram();
+    auto q = quantile_between(_prev, cur, _quantile);
+    _prev = std::move(cur);
+    co_return q;
+}
+
+int64_t produce_latency_sampler::quantile_between(
+  const ss::metrics::histogram& prev,
+  const ss::metrics::histogram& cur,
+  double quantile) {
+    if (cur.sample_count <= prev.sample_count || cur.buckets.empty()) {
+        return 0;
+    }
+    const auto total = cur.sample_count - prev.sample_count;
+    const auto rank = static_cast<uint64_t>(
+      std::ceil(quantile * static_cast<double>(total)));
+    for (size_t i = 0; i < cur.buckets.size(); ++i) {
+        const auto before = i < prev.buckets.size() ? prev.buckets[i].count
+                                                    : 0;
+        if (cur.buckets[i].count - before >= rank) {
+            return static_cast<int64_t>(cur.buckets[i].upper_bound);
+        }
+    }
+    return static_cast<int64_t>(cur.buckets.back().upper_bound);
+}
+
+produce_latency_controller::produce_latency_controller(
+  ss::sharded<server>& server,
+  double quantile,
+  storage::backlog_controller_config cfg)
+  : _ctrl(
+    std::make_unique<produce_latency_sampler>(server, quantile),
+    latency_ctrl_log,
+    std::move(cfg)) {
+    _ctrl.setup_metrics("kafka:produce_latency");
+}
+
+} // namespace kafka
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "kafka/server/fwd.h"
+#include "storage/backlog_controller.h"
+
+#include <seastar/core/metrics_types.hh>
+#include <seastar/core/sharded.hh>
+
+#include <vector>
+
+namespace kafka {
+
+/*
+ * Samples a quantile of the produce latency of the shard, in microseconds,
+ * over the interval since the previous sample.
+ */
+class produce_latency_sampler final
+  : public storage::backlog_controller::sampler {
+public:
+    produce_latency_sampler(ss::sharded<server>&, double quantile);
+
+    ss::future<int64_t> sample_backlog() final;
+
+    /// Upper bound of the bucket holding the quantile of the samples
+    /// recorded between two snapshots of a cumulative histogram. Zero if
+    /// nothing was recorded.
+    static int64_t quantile_between(
+      const ss::metrics::histogram& prev,
+      const ss::metrics::histogram& cur,
+      double quantile);
+
+private:
+    ss::sharded<server>& _server;
+    double _quantile;
+    ss::metrics::histogram _prev;
+};
+
+/**
+ * PID controller trading read throughput for produce tail latency.
+ *
+ * Keeps a quantile of the produce latency of the shard under a target by
+ * adjusting the I/O shares of the reads far behind the tip of partitions,
+ * which are the reads competing the most with appends for the disk. Catch-up
+ * reads get the maximum shares while produce latency is low and fewer as it
+ * gets close to the target.
+ */
+class produce_latency_controller {
+public:
+    produce_latency_controller(
+      ss::sharded<server>&,
+      double quantile,
+      storage::backlog_controller_config);
+
+    ss::future<> start() { return _ctrl.start(); }
+    ss::future<> stop() { return _ctrl.stop(); }
+
+private:
+    storage::backlog_controller _ctrl;
+};
+
+} // namespace kafka
@@ -159,6 +159,8 @@ quota_manager::quota_manager(
   , _default_window_width(config::shard_local_cfg().default_window_sec.bind())
   , _replenish_threshold(
       config::shard_local_cfg().kafka_throughput_replenish_threshold.bind())
+  , _max_lease_bytes(
+      config::shard_local_cfg().kafka_client_quota_max_lease_bytes.bind())
   , _translator{client_quota_store}
   , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
   , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {
@@ -389,6 +391,22 @@ clock::duration quota_manager::cap_to_max_delay(
 }
 
 // record a new observation and return <previous delay, new delay>
+clock::duration quota_manager::record_throughput(
+  atomic_token_bucket& tracker,
+  token_lease& lease,
+  clock::time_point now,
+  uint64_t bytes) {
+    if (_max_lease_bytes() == 0) {
+        return tracker.update_and_calculate_delay<clock::duration>(now, bytes);
+    }
+    // the tokens outstanding in the leases of all shards are bounded by
+    // 10ms worth of the rate
+    const auto max_lease = std::min(
+      _max_lease_bytes(), tracker.rate() / (100 * ss::smp::count));
+    return lease.record_and_calculate_delay<clock::duration>(
+      tracker, now, bytes, max_lease);
+}
+
 ss::future<clock::duration> quota_manager::record_produce_tp_and_throttle(
   std::optional<std::string_view> client_id,
   uint64_t bytes,
@@ -417,13 +435,12 @@ ss::future<clock::duration> quota_manager::record_produce_tp_and_throttle(
         co_return clock::duration::zero();
     }
     auto delay = co_await maybe_add_and_retrieve_quota(
-      key, now, [now, bytes](quota_manager::client_quota& cq) {
+      key, now, [this, now, bytes](quota_manager::client_quota& cq) {
           if (!cq.tp_produce_rate.has_value()) {
               return clock::duration::zero();
           }
-          auto& produce_tracker = cq.tp_produce_rate.value();
-          return produce_tracker.update_and_calculate_delay<clock::duration>(
-            now, bytes);
+          return record_throughput(
+            cq.tp_produce_rate.value(), cq.produce_lease.local(), now, bytes);
       });
 
     auto capped_delay = cap_to_max_delay(key, delay);
@@ -465,12 +482,17 @@ ss::future<> quota_manager::record_fetch_tp(
         co_return;
     }
     auto delay [[maybe_unused]] = co_await maybe_add_and_retrieve_quota(
-      key, now, [bytes](quota_manager::client_quota& cq) {
+      key, now, [this, now, bytes](quota_manager::client_quota& cq) {
           if (!cq.tp_fetch_rate.has_value()) {
               return clock::duration::zero();
           }
           auto& fetch_tracker = cq.tp_fetch_rate.value();
-          fetch_tracker.record(bytes);
+          if (_max_lease_bytes() == 0) {
+              fetch_tracker.record(bytes);
+          } else {
+              record_throughput(
+                fetch_tracker, cq.fetch_lease.local(), now, bytes);
+          }
           return clock::duration::zero();
       });
 }
@@ -522,6 +544,44 @@ ss::future<clock::duration> quota_manager::throttle_fetch_tp(
     co_return capped_delay;
 }
 
+ss::future<std::optional<uint64_t>> quota_manager::fetch_bytes_available(
+  std::optional<std::string_view> client_id, clock::time_point now) {
+    if (_translator.is_empty()) {
+        co_return std::nullopt;
+    }
+    auto ctx = client_quota_request_ctx{
+      .q_type = client_quota_type::fetch_quota,
+      .client_id = client_id,
+    };
+    auto [key, value] = _translator.find_quota(ctx);
+    if (!value.limit) {
+        co_return std::nullopt;
+    }
+
+    std::optional<uint64_t> available;
+    co_await maybe_add_and_retrieve_quota(
+      key, now, [this, now, &available](quota_manager::client_quota& cq) {
+          if (!cq.tp_fetch_rate.has_value()) {
+              return clock::duration::zero();
+          }
+          available = cq.tp_fetch_rate->update_and_get_available(now);
+          if (_max_lease_bytes() != 0) {
+              // tokens in the lease of the shard are already taken from the
+              // bucket, but can still be used by this shard
+              *available += cq.fetch_lease.local().tokens();
+          }
+          return clock::duration::zero();
+      });
+    vlog(
+      client_quota_log.trace,
+      "fetch bytes available: ctx:{}, key:{}, value:{}, available:{}",
+      ctx,
+      key,
+      value,
+      available.value_or(0));
+    co_return available;
+}
+
 const std::optional<quota_manager::global_map_t>&
 quota_manager::get_global_map_for_testing() const {
     return _global_map;
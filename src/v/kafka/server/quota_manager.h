@@ -62,11 +62,15 @@ public:
     // tp_produce_rate: produce throughput tracking
     // tp_fetch_rate: fetch throughput tracking
     // pm_rate: partition mutation quota tracking
+    // produce_lease, fetch_lease: shard local leases of the throughput
+    // trackers, used when kafka_client_quota_max_lease_bytes is set
     struct client_quota {
         ssx::sharded_value<clock::time_point> last_seen_ms;
         std::optional<atomic_token_bucket> tp_produce_rate;
         std::optional<atomic_token_bucket> tp_fetch_rate;
         std::optional<atomic_token_bucket> pm_rate;
+        ssx::sharded_value<token_lease> produce_lease{token_lease{}};
+        ssx::sharded_value<token_lease> fetch_lease{token_lease{}};
     };
 
     // Note: the use of std::shared_ptr<> is generally discouraged in the
@@ -113,6 +117,12 @@ public:
       std::optional<std::string_view> client_id,
       clock::time_point now = clock::now());
 
+    // bytes the client can fetch before it goes over its fetch quota, or
+    // nullopt if the client has no fetch quota
+    ss::future<std::optional<uint64_t>> fetch_bytes_available(
+      std::optional<std::string_view> client_id,
+      clock::time_point now = clock::now());
+
     // Used to record new number of partitions mutations
     // Only for use with the quotas introduced by KIP-599, namely to track
     // partition creation and deletion events (create topics, delete topics &
@@ -135,6 +145,11 @@ private:
 
     clock::duration cap_to_max_delay(const tracker_key&, clock::duration);
 
+    // Records `bytes` in the throughput tracker, through the lease of the
+    // shard when leases are enabled
+    clock::duration record_throughput(
+      atomic_token_bucket&, token_lease&, clock::time_point, uint64_t bytes);
+
     // erase inactive tracked quotas. windows are considered inactive if they
     // have not received any updates in ten window's worth of time.
     void gc();
@@ -153,6 +168,7 @@ private:
     config::binding<int16_t> _default_num_windows;
     config::binding<std::chrono::milliseconds> _default_window_width;
     config::binding<std::optional<int64_t>> _replenish_threshold;
+    config::binding<uint64_t> _max_lease_bytes;
 
     local_map_t _local_map;
     std::optional<global_map_t> _global_map; // Only on shard 0
@@ -204,6 +204,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    metadata_response_cache& get_metadata_response_cache() {
+        return _conn->server().get_metadata_response_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, protocol::encoder& writer, api_version version) {
@@ -468,6 +472,9 @@ private:
     }
     template<typename ResponseType>
     void update_usage_stats(const ResponseType& r, size_t response_size) {
+        if (!usage_mgr().enabled()) {
+            return;
+        }
         size_t internal_bytes_recv = 0;
         size_t internal_bytes_sent = 0;
         if constexpr (std::is_same_v<ResponseType, produce_response>) {
@@ -116,6 +116,7 @@ server::server(
   ss::sharded<net::server_configuration>* cfg,
   ss::smp_service_group smp,
   ss::scheduling_group fetch_sg,
+  ss::scheduling_group produce_compression_sg,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<cluster::config_frontend>& cf,
@@ -142,6 +143,7 @@ server::server(
   : net::server(cfg, klog)
   , _smp_group(smp)
   , _fetch_scheduling_group(fetch_sg)
+  , _produce_compression_scheduling_group(produce_compression_sg)
   , _topics_frontend(tf)
   , _config_frontend(cf)
   , _feature_table(ft)
@@ -155,7 +157,8 @@ server::server(
   , _shard_table(tbl)
   , _partition_manager(pm)
   , _fetch_session_cache(
-      config::shard_local_cfg().fetch_session_eviction_timeout_ms())
+      config::shard_local_cfg().fetch_session_eviction_timeout_ms(),
+      config::shard_local_cfg().fetch_session_cache_max_bytes.bind())
   , _id_allocator_frontend(id_allocator_frontend)
   , _is_idempotence_enabled(
       config::shard_local_cfg().enable_idempotence.value())
@@ -179,8 +182,13 @@ server::server(
         cfg->local().max_service_memory_per_core
         * config::shard_local_cfg().kafka_memory_share_for_fetch()),
       "kafka/server-mem-fetch")
+  , _recompression_rate(
+      config::shard_local_cfg()
+        .kafka_produce_recompression_max_bytes_per_sec.bind())
+  , _recompression_budget(_recompression_rate(), "kafka/recompression")
   , _probe(std::make_unique<class latency_probe>())
   , _sasl_probe(std::make_unique<class sasl_probe>())
+  , _client_usage_probe(std::make_unique<class client_usage_probe>())
   , _read_dist_probe(std::make_unique<read_distribution_probe>())
   , _thread_worker(tw)
   , _replica_selector(
@@ -193,11 +201,15 @@ server::server(
     if (qdc_config) {
         _qdc_mon.emplace(*qdc_config);
     }
+    _recompression_rate.watch([this] {
+        _recompression_budget.update_rate(_recompression_rate());
+    });
     setup_metrics();
     _probe->setup_metrics();
     _probe->setup_public_metrics();
 
     _sasl_probe->setup_metrics(cfg->local().name);
+    _client_usage_probe->setup_metrics();
     _read_dist_probe->setup_metrics();
 }
 
@@ -224,6 +236,11 @@ ss::scheduling_group server::fetch_scheduling_group() const {
              : ss::default_scheduling_group();
 }
 
+bool server::try_admit_recompression(size_t bytes) {
+    return _recompression_rate() > 0
+           && _recompression_budget.try_throttle(bytes);
+}
+
 coordinator_ntp_mapper& server::coordinator_mapper() {
     return _group_router.local().coordinator_mapper().local();
 }
@@ -343,7 +360,8 @@ ss::future<> server::apply(ss::lw_shared_ptr<net::connection> conn) {
       config::shard_local_cfg().kafka_request_max_bytes.bind(),
       config::shard_local_cfg()
         .kafka_throughput_controlled_api_keys.bind<std::vector<bool>>(
-          &convert_api_names_to_key_bitmap));
+          &convert_api_names_to_key_bitmap),
+      config::shard_local_cfg().kafka_max_pipelined_requests_per_connection());
 
     std::exception_ptr eptr;
     try {
@@ -14,16 +14,20 @@
 #include "cluster/fwd.h"
 #include "config/configuration.h"
 #include "features/feature_table.h"
+#include "kafka/client_usage_probe.h"
 #include "kafka/latency_probe.h"
 #include "kafka/protocol/types.h"
 #include "kafka/read_distribution_probe.h"
 #include "kafka/sasl_probe.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/fetch_metadata_cache.hh"
+#include "kafka/server/fetch_response_cache.h"
 #include "kafka/server/fetch_session_cache.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/handlers/handler_probe.h"
+#include "kafka/server/list_offsets_cache.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "metrics/metrics.h"
 #include "net/server.h"
@@ -35,6 +39,7 @@
 #include "security/mtls.h"
 #include "ssx/fwd.h"
 #include "utils/ema.h"
+#include "utils/token_bucket.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/scheduling.hh>
@@ -50,7 +55,8 @@ public:
     server(
       ss::sharded<net::server_configuration>*,
       ss::smp_service_group,
-      ss::scheduling_group,
+      ss::scheduling_group fetch_sg,
+      ss::scheduling_group produce_compression_sg,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<cluster::config_frontend>&,
@@ -97,6 +103,18 @@ public:
      */
     ss::scheduling_group fetch_scheduling_group() const;
 
+    /// Scheduling group in which produced batches are recompressed.
+    ss::scheduling_group produce_compression_scheduling_group() const {
+        return _produce_compression_scheduling_group;
+    }
+
+    /**
+     * @brief Returns true if a produced batch of `bytes` can be recompressed
+     * within the recompression budget of the shard, and takes it from the
+     * budget.
+     */
+    bool try_admit_recompression(size_t bytes);
+
     cluster::topics_frontend& topics_frontend() {
         return _topics_frontend.local();
     }
@@ -173,6 +191,18 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::fetch_response_cache& get_fetch_response_cache() {
+        return _fetch_response_cache;
+    }
+
+    kafka::metadata_response_cache& get_metadata_response_cache() {
+        return _metadata_response_cache;
+    }
+
+    kafka::list_offsets_cache& get_list_offsets_cache() {
+        return _list_offsets_cache;
+    }
+
     security::gssapi_principal_mapper& gssapi_principal_mapper() {
         return _gssapi_principal_mapper;
     }
@@ -181,6 +211,8 @@ public:
 
     sasl_probe& sasl_probe() { return *_sasl_probe; }
 
+    client_usage_probe& client_usage_probe() { return *_client_usage_probe; }
+
     read_distribution_probe& read_probe() { return *_read_dist_probe; }
 
     ssx::singleton_thread_worker& thread_worker() { return _thread_worker; }
@@ -219,6 +251,7 @@ private:
 
     ss::smp_service_group _smp_group;
     ss::scheduling_group _fetch_scheduling_group;
+    ss::scheduling_group _produce_compression_scheduling_group;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::config_frontend>& _config_frontend;
     ss::sharded<features::feature_table>& _feature_table;
@@ -245,15 +278,21 @@ private:
     ss::sharded<cluster::tx_gateway_frontend>& _tx_gateway_frontend;
     std::optional<qdc_monitor> _qdc_mon;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    kafka::fetch_response_cache _fetch_response_cache;
+    kafka::metadata_response_cache _metadata_response_cache;
+    kafka::list_offsets_cache _list_offsets_cache;
     security::tls::principal_mapper _mtls_principal_mapper;
     security::gssapi_principal_mapper _gssapi_principal_mapper;
     security::krb5::configurator _krb_configurator;
     ssx::semaphore _memory_fetch_sem;
+    config::binding<size_t> _recompression_rate;
+    token_bucket<> _recompression_budget;
 
     handler_probe_manager _handler_probes;
     metrics::internal_metric_groups _metrics;
     std::unique_ptr<class latency_probe> _probe;
     std::unique_ptr<class sasl_probe> _sasl_probe;
+    std::unique_ptr<class client_usage_probe> _client_usage_probe;
     std::unique_ptr<read_distribution_probe> _read_dist_probe;
     ssx::singleton_thread_worker& _thread_worker;
     std::unique_ptr<replica_selector> _replica_selector;
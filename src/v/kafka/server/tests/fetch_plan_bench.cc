@@ -22,6 +22,7 @@
 #include "redpanda/tests/fixture.h"
 #include "test_utils/fixture.h"
 
+#include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/testing/perf_tests.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -209,3 +210,75 @@ PERF_TEST_F(fetch_plan_fixture, test_fetch_plan) {
     // }
     return (size_t)(session_partition_count * iters);
 }
+
+/*
+ * Assembly of the data of a fetch read on another shard: the connection
+ * shard copying each partition's foreign iobuf, against linking the buffers
+ * that the partition's shard copied the data into.
+ */
+struct foreign_read_fixture {
+    static constexpr size_t partition_count = 500;
+    static constexpr size_t partition_bytes = 16_KiB;
+
+    using read_result_data_t = kafka::read_result::data_t;
+
+    static ss::shard_id source_shard() {
+        return (ss::this_shard_id() + 1) % ss::smp::count;
+    }
+
+    static read_result_data_t make_data() {
+        static thread_local const ss::sstring payload
+          = random_generators::gen_alphanum_string(4_KiB);
+        auto data = std::make_unique<iobuf>();
+        while (data->size_bytes() < partition_bytes) {
+            data->append(payload.data(), payload.size());
+        }
+        return data;
+    }
+
+    template<typename Func>
+    static ss::future<size_t> assemble(Func make_variant) {
+        auto results = co_await ss::smp::submit_to(
+          source_shard(), [make_variant] {
+              std::vector<kafka::read_result> ret;
+              ret.reserve(partition_count);
+              for (size_t i = 0; i < partition_count; ++i) {
+                  ret.emplace_back(
+                    make_variant(make_data()),
+                    model::offset(0),
+                    model::offset(100),
+                    model::offset(100),
+                    std::nullopt,
+                    std::vector<cluster::tx::tx_range>{});
+              }
+              return ret;
+          });
+        size_t total = 0;
+        for (auto& r : results) {
+            auto data = std::move(r).release_data();
+            total += data.size_bytes();
+            perf_tests::do_not_optimize(data);
+        }
+        co_return total;
+    }
+};
+
+PERF_TEST_C(foreign_read_fixture, test_foreign_read_copy) {
+    perf_tests::start_measuring_time();
+    auto total = co_await assemble([](read_result_data_t data) {
+        return kafka::read_result::variant_t(
+          ss::make_foreign<read_result_data_t>(std::move(data)));
+    });
+    perf_tests::stop_measuring_time();
+    co_return total;
+}
+
+PERF_TEST_C(foreign_read_fixture, test_foreign_read_link) {
+    perf_tests::start_measuring_time();
+    auto total = co_await assemble([](read_result_data_t data) {
+        return kafka::read_result::variant_t(
+          kafka::read_result::make_foreign_fragments(std::move(data)));
+    });
+    perf_tests::stop_measuring_time();
+    co_return total;
+}
@@ -0,0 +1,137 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/fetch_response_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const model::ktp tp0{model::topic("t"), model::partition_id(0)};
+const model::ktp tp1{model::topic("t"), model::partition_id(1)};
+constexpr auto ttl = std::chrono::seconds(60);
+
+kafka::fetch_response_cache::key
+make_key(const model::ktp& ktp, int64_t start) {
+    return {
+      .ktp = ktp,
+      .start_offset = model::offset(start),
+      .isolation_level = model::isolation_level::read_uncommitted,
+    };
+}
+
+kafka::fetch_response_cache::version make_version(int64_t hw) {
+    return {
+      .leader_epoch = kafka::leader_epoch(1),
+      .high_watermark = model::offset(hw),
+      .max_offset = model::offset::max(),
+    };
+}
+
+kafka::fetch_response_cache::payload make_payload(size_t size) {
+    iobuf data;
+    data.append(ss::temporary_buffer<char>(size));
+    return {.data = std::move(data), .record_count = 1};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_fetch_response_cache_hit) {
+    kafka::fetch_response_cache cache;
+    auto k = make_key(tp0, 10);
+    auto v = make_version(100);
+    BOOST_REQUIRE(cache.get(k, v, 1024, false, ttl) == nullptr);
+
+    cache.put(k, v, 1024, false, false, make_payload(512));
+    auto* p = cache.get(k, v, 1024, false, ttl);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_REQUIRE_EQUAL(p->data.size_bytes(), 512);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 512);
+
+    BOOST_REQUIRE(cache.get(make_key(tp1, 10), v, 1024, false, ttl) == nullptr);
+    BOOST_REQUIRE(cache.get(make_key(tp0, 11), v, 1024, false, ttl) == nullptr);
+    auto read_committed = k;
+    read_committed.isolation_level = model::isolation_level::read_committed;
+    BOOST_REQUIRE(cache.get(read_committed, v, 1024, false, ttl) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_fetch_response_cache_invalidation) {
+    kafka::fetch_response_cache cache;
+    auto k = make_key(tp0, 10);
+    auto v = make_version(100);
+    cache.put(k, v, 1024, false, true, make_payload(512));
+
+    // a new high watermark, max offset or leader invalidates the payload
+    BOOST_REQUIRE(
+      cache.get(k, make_version(101), 1024, false, ttl) == nullptr);
+    auto lower_max = v;
+    lower_max.max_offset = model::offset(50);
+    BOOST_REQUIRE(cache.get(k, lower_max, 1024, false, ttl) == nullptr);
+    auto new_leader = v;
+    new_leader.leader_epoch = kafka::leader_epoch(2);
+    BOOST_REQUIRE(cache.get(k, new_leader, 1024, false, ttl) == nullptr);
+
+    // and so does its age
+    BOOST_REQUIRE(cache.get(k, v, 1024, false, -1ms) == nullptr);
+
+    // a newer payload replaces the older one
+    cache.put(k, make_version(101), 1024, false, true, make_payload(256));
+    BOOST_REQUIRE(cache.get(k, v, 1024, false, ttl) == nullptr);
+    BOOST_REQUIRE(cache.get(k, make_version(101), 1024, false, ttl) != nullptr);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 256);
+}
+
+BOOST_AUTO_TEST_CASE(test_fetch_response_cache_max_bytes) {
+    kafka::fetch_response_cache cache;
+    auto k = make_key(tp0, 10);
+    auto v = make_version(100);
+
+    // a partial read is only served to fetches with the same limits
+    cache.put(k, v, 1024, false, false, make_payload(1024));
+    BOOST_REQUIRE(cache.get(k, v, 1024, false, ttl) != nullptr);
+    BOOST_REQUIRE(cache.get(k, v, 1024, true, ttl) == nullptr);
+    BOOST_REQUIRE(cache.get(k, v, 2048, false, ttl) == nullptr);
+    BOOST_REQUIRE(cache.get(k, v, 512, false, ttl) == nullptr);
+
+    // a read that reached the end is served to any fetch it fits in
+    cache.put(k, v, 1024, false, true, make_payload(700));
+    BOOST_REQUIRE(cache.get(k, v, 2048, false, ttl) != nullptr);
+    BOOST_REQUIRE(cache.get(k, v, 700, true, ttl) != nullptr);
+    BOOST_REQUIRE(cache.get(k, v, 512, false, ttl) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_fetch_response_cache_bounded) {
+    kafka::fetch_response_cache cache;
+    auto v = make_version(100);
+    constexpr auto size = kafka::fetch_response_cache::max_bytes / 4;
+    for (int64_t i = 0; i < 4; ++i) {
+        cache.put(make_key(tp0, i), v, size, false, true, make_payload(size));
+    }
+    BOOST_REQUIRE_EQUAL(cache.size(), 4);
+
+    // the cache starts over once it is full
+    cache.put(make_key(tp0, 4), v, size, false, true, make_payload(size));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), size);
+    BOOST_REQUIRE(cache.get(make_key(tp0, 0), v, size, false, ttl) == nullptr);
+    BOOST_REQUIRE(cache.get(make_key(tp0, 4), v, size, false, ttl) != nullptr);
+
+    // payloads larger than the cache are not cached
+    cache.put(
+      make_key(tp1, 0),
+      v,
+      kafka::fetch_response_cache::max_bytes + 1,
+      false,
+      true,
+      make_payload(kafka::fetch_response_cache::max_bytes + 1));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+}
@@ -8,6 +8,8 @@
  * the Business Source License, use of this software will be governed
  * by the Apache License, Version 2.0
  */
+#include "base/units.h"
+#include "config/mock_property.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/protocol/schemata/fetch_request.h"
 #include "kafka/server/fetch_session.h"
@@ -130,7 +132,8 @@ FIXTURE_TEST(test_fetch_session_basic_operations, fixture) {
 }
 
 FIXTURE_TEST(test_session_operations, fixture) {
-    kafka::fetch_session_cache cache(120s);
+    kafka::fetch_session_cache cache(
+      120s, config::mock_binding<size_t>(10_MiB));
     kafka::fetch_request req;
     req.data.session_epoch = kafka::initial_fetch_session_epoch;
     req.data.session_id = kafka::invalid_fetch_session_id;
@@ -245,3 +248,48 @@ FIXTURE_TEST(test_session_operations, fixture) {
         BOOST_REQUIRE(cache.size() == 0);
     }
 }
+
+FIXTURE_TEST(test_evicting_least_used_sessions, fixture) {
+    config::mock_property<size_t> max_mem_usage(10_MiB);
+    kafka::fetch_session_cache cache(120s, max_mem_usage.bind());
+
+    auto create_session = [&cache] {
+        kafka::fetch_request req;
+        req.data.session_epoch = kafka::initial_fetch_session_epoch;
+        req.data.session_id = kafka::invalid_fetch_session_id;
+        req.data.topics.emplace_back(
+          make_fetch_request_topic(model::topic("test"), 3));
+        auto ctx = cache.maybe_get_session(req);
+        BOOST_REQUIRE(!ctx.is_sessionless());
+        return std::make_pair(ctx.session()->id(), ctx.session()->epoch());
+    };
+    auto fetch = [&cache](
+                   kafka::fetch_session_id id,
+                   kafka::fetch_session_epoch& epoch) {
+        kafka::fetch_request req;
+        req.data.session_id = id;
+        req.data.session_epoch = epoch;
+        auto ctx = cache.maybe_get_session(req);
+        if (!ctx.has_error()) {
+            epoch = ctx.session()->epoch();
+        }
+        return ctx.error();
+    };
+
+    auto [busy_id, busy_epoch] = create_session();
+    auto [idle_id, idle_epoch] = create_session();
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE_EQUAL(
+          fetch(busy_id, busy_epoch), kafka::error_code::none);
+    }
+
+    // the next session only fits if one of the existing ones is evicted
+    max_mem_usage.update(cache.mem_usage() - 1);
+    create_session();
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE_EQUAL(fetch(busy_id, busy_epoch), kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(
+      fetch(idle_id, idle_epoch),
+      kafka::error_code::fetch_session_id_not_found);
+}
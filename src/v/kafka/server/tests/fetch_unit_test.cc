@@ -145,3 +145,22 @@ BOOST_AUTO_TEST_CASE(reserve_memory_units_test) {
     memsemunits.return_all();
     kafka_mem = memory_sem.available_units();
 }
+
+BOOST_AUTO_TEST_CASE(split_fetch_budget_test) {
+    using v = std::vector<size_t>;
+    auto split = [](size_t budget, const v& demands, size_t min_share) {
+        return kafka::split_fetch_budget(budget, demands, min_share);
+    };
+    // the budget covers everything
+    BOOST_TEST(split(100, v{10, 20, 30}, 1) == v({10, 20, 30}));
+    // equal shares
+    BOOST_TEST(split(90, v{50, 50, 50}, 1) == v({30, 30, 30}));
+    // what small partitions leave is split among the others
+    BOOST_TEST(split(100, v{50, 10, 50}, 1) == v({45, 10, 45}));
+    // only the first partitions are served when shares would be too small
+    BOOST_TEST(split(100, v{50, 50, 50}, 40) == v({50, 50, 0}));
+    // at least one partition is always served
+    BOOST_TEST(split(10, v{50, 50}, 40) == v({10, 0}));
+    BOOST_TEST(split(0, v{50, 50}, 40) == v({0, 0}));
+    BOOST_TEST(split(100, v{}, 40).empty());
+}
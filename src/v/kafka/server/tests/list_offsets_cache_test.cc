@@ -0,0 +1,87 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/list_offsets_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+const model::ktp tp0{model::topic("t"), model::partition_id(0)};
+const model::ktp tp1{model::topic("t"), model::partition_id(1)};
+
+kafka::list_offsets_cache::version make_version(int64_t start, int64_t max) {
+    return {
+      .leader_epoch = kafka::leader_epoch(1),
+      .start_offset = model::offset(start),
+      .max_offset = model::offset(max),
+    };
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_list_offsets_cache_hit) {
+    kafka::list_offsets_cache cache;
+    auto v = make_version(0, 100);
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(10), v) == nullptr);
+
+    cache.put(
+      tp0,
+      model::timestamp(10),
+      v,
+      storage::timequery_result(model::offset(5), model::timestamp(11)));
+    cache.put(tp0, model::timestamp(1000), v, std::nullopt);
+
+    const auto* a = cache.get(tp0, model::timestamp(10), v);
+    BOOST_REQUIRE(a != nullptr && a->result.has_value());
+    BOOST_REQUIRE_EQUAL(a->result->offset, model::offset(5));
+    BOOST_REQUIRE_EQUAL(a->result->time, model::timestamp(11));
+
+    a = cache.get(tp0, model::timestamp(1000), v);
+    BOOST_REQUIRE(a != nullptr && !a->result.has_value());
+
+    BOOST_REQUIRE(cache.get(tp1, model::timestamp(10), v) == nullptr);
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(11), v) == nullptr);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_list_offsets_cache_invalidation) {
+    kafka::list_offsets_cache cache;
+    auto v = make_version(0, 100);
+    cache.put(tp0, model::timestamp(10), v, std::nullopt);
+
+    // a new high watermark, start offset or leader invalidates the answers
+    BOOST_REQUIRE(
+      cache.get(tp0, model::timestamp(10), make_version(0, 101)) == nullptr);
+    BOOST_REQUIRE(
+      cache.get(tp0, model::timestamp(10), make_version(1, 100)) == nullptr);
+    auto new_leader = v;
+    new_leader.leader_epoch = kafka::leader_epoch(2);
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(10), new_leader) == nullptr);
+
+    // answers of a newer version replace the older ones
+    auto next = make_version(0, 101);
+    cache.put(tp0, model::timestamp(20), next, std::nullopt);
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(10), v) == nullptr);
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(20), next) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_list_offsets_cache_answers_per_partition) {
+    kafka::list_offsets_cache cache;
+    auto v = make_version(0, 100);
+    constexpr auto max = kafka::list_offsets_cache::max_answers_per_partition;
+    for (size_t i = 0; i <= max; ++i) {
+        cache.put(tp0, model::timestamp(i), v, std::nullopt);
+    }
+    // the oldest answer is dropped
+    BOOST_REQUIRE(cache.get(tp0, model::timestamp(0), v) == nullptr);
+    for (size_t i = 1; i <= max; ++i) {
+        BOOST_REQUIRE(cache.get(tp0, model::timestamp(i), v) != nullptr);
+    }
+}
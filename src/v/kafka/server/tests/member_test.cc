@@ -71,6 +71,8 @@ SEASTAR_THREAD_TEST_CASE(assignment) {
 
     m.set_assignment(bytes("abc"));
     BOOST_TEST(m.assignment() == bytes("abc"));
+    BOOST_TEST(iobuf_to_bytes(m.share_assignment()) == bytes("abc"));
+    BOOST_TEST(m.assignment() == bytes("abc"));
 
     m.clear_assignment();
     BOOST_TEST(m.assignment() == bytes());
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "container/fragmented_vector.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/protocol/types.h"
+#include "kafka/server/handlers/fetch.h"
+#include "kafka/server/handlers/produce.h"
+#include "model/compression.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+#include "model/record.h"
+#include "random/generators.h"
+#include "redpanda/tests/fixture.h"
+#include "storage/parser_utils.h"
+#include "storage/record_batch_builder.h"
+#include "test_utils/fixture.h"
+
+#include <seastar/core/smp.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <limits>
+
+using namespace std::chrono_literals; // NOLINT
+
+/*
+ * The produce and fetch pipelines end to end, through the kafka handlers of an
+ * in-process broker: request decoding, dispatch to the partition, raft
+ * replication and storage append for produce, then planning, reading and
+ * response encoding for fetch.
+ *
+ * Every test returns the number of records it processed, so the reported time
+ * per run is per record. Comparing the stages for different batch sizes and
+ * compression types shows where the per record cost goes.
+ */
+struct pipeline_fixture : redpanda_thread_fixture {
+    static constexpr size_t topic_name_length = 30;
+    static constexpr size_t record_size = 1_KiB;
+
+    model::topic t;
+
+    pipeline_fixture() {
+        wait_for_controller_leadership().get();
+
+        t = model::topic(
+          random_generators::gen_alphanum_string(topic_name_length));
+        add_topic(model::topic_namespace_view(model::kafka_namespace, t), 1)
+          .get();
+        wait_for_leader(make_default_ntp(t, model::partition_id(0))).get();
+        conn = make_connection_context();
+    }
+
+    ss::future<model::record_batch>
+    make_batch(size_t num_records, model::compression compression) {
+        storage::record_batch_builder builder(
+          model::record_batch_type::raft_data, model::offset{0});
+        for (size_t i = 0; i < num_records; ++i) {
+            builder.add_raw_kv(iobuf{}, rand_iobuf(record_size));
+        }
+        auto batch = std::move(builder).build();
+        if (compression == model::compression::none) {
+            co_return batch;
+        }
+        co_return co_await storage::compress_batch(
+          compression, std::move(batch));
+    }
+
+    kafka::request_context make_produce_context(model::record_batch batch) {
+        chunked_vector<kafka::produce_request::partition> partitions;
+        partitions.push_back(kafka::produce_request::partition{
+          .partition_index{model::partition_id(0)},
+          .records = kafka::produce_request_record_data(std::move(batch))});
+
+        chunked_vector<kafka::produce_request::topic> topics;
+        topics.push_back(kafka::produce_request::topic{
+          .name{t}, .partitions{std::move(partitions)}});
+
+        kafka::request_header header{
+          .key = kafka::produce_handler::api::key,
+          .version = kafka::produce_handler::max_supported};
+        return make_request_context(
+          kafka::produce_request(std::nullopt, -1, std::move(topics)),
+          header,
+          conn);
+    }
+
+    kafka::request_context make_fetch_context(model::offset offset) {
+        kafka::fetch_request req;
+        req.data.max_bytes = std::numeric_limits<int32_t>::max();
+        req.data.min_bytes = 1;
+        req.data.max_wait_ms = 0ms;
+        // disable incremental fetches
+        req.data.session_id = kafka::invalid_fetch_session_id;
+        req.data.session_epoch = kafka::final_fetch_session_epoch;
+        req.data.topics.emplace_back(kafka::fetch_topic{
+          .name = t,
+          .fetch_partitions = {{
+            .partition_index = model::partition_id(0),
+            .fetch_offset = offset,
+          }},
+        });
+
+        kafka::request_header header{
+          .key = kafka::fetch_handler::api::key,
+          .version = kafka::fetch_handler::max_supported};
+        return make_request_context(std::move(req), header, conn);
+    }
+
+    // Runs the produce handler to completion and returns the offset the
+    // batch was written at. Measures everything from decoding the request to
+    // encoding the response when `measure` is set.
+    ss::future<model::offset>
+    produce(kafka::request_context rctx, bool measure) {
+        if (measure) {
+            perf_tests::start_measuring_time();
+        }
+        auto stages = kafka::produce_handler::handle(
+          std::move(rctx), ss::default_smp_service_group());
+        co_await std::move(stages.dispatched);
+        auto resp = co_await std::move(stages.response);
+        if (measure) {
+            perf_tests::stop_measuring_time();
+        }
+
+        kafka::produce_response r;
+        r.decode(
+          std::move(*resp).release(), kafka::produce_handler::max_supported);
+        const auto& p = r.data.responses[0].partitions[0];
+        vassert(
+          p.error_code == kafka::error_code::none,
+          "error_code: {}",
+          p.error_code);
+        co_return p.base_offset;
+    }
+
+    ss::future<size_t>
+    run_decode(size_t num_records, model::compression compression) {
+        auto batch = co_await make_batch(num_records, compression);
+        auto rctx = make_produce_context(std::move(batch));
+
+        perf_tests::start_measuring_time();
+        kafka::produce_request request;
+        request.decode(rctx.reader(), rctx.header().version);
+        perf_tests::stop_measuring_time();
+
+        perf_tests::do_not_optimize(request);
+        co_return num_records;
+    }
+
+    ss::future<size_t>
+    run_produce(size_t num_records, model::compression compression) {
+        auto batch = co_await make_batch(num_records, compression);
+        co_await produce(make_produce_context(std::move(batch)), true);
+        co_return num_records;
+    }
+
+    ss::future<size_t>
+    run_fetch(size_t num_records, model::compression compression) {
+        auto batch = co_await make_batch(num_records, compression);
+        auto offset = co_await produce(
+          make_produce_context(std::move(batch)), false);
+        auto rctx = make_fetch_context(offset);
+
+        perf_tests::start_measuring_time();
+        auto resp = co_await kafka::fetch_handler::handle(
+          std::move(rctx), ss::default_smp_service_group());
+        perf_tests::stop_measuring_time();
+
+        kafka::fetch_response r;
+        r.decode(
+          std::move(*resp).release(), kafka::fetch_handler::max_supported);
+        const auto& p = r.data.topics[0].partitions[0];
+        vassert(
+          p.error_code == kafka::error_code::none,
+          "error_code: {}",
+          p.error_code);
+        co_return num_records;
+    }
+
+    conn_ptr conn;
+};
+
+PERF_TEST_C(pipeline_fixture, decode_1_none) {
+    co_return co_await run_decode(1, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, decode_100_none) {
+    co_return co_await run_decode(100, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, decode_100_zstd) {
+    co_return co_await run_decode(100, model::compression::zstd);
+}
+
+PERF_TEST_C(pipeline_fixture, produce_1_none) {
+    co_return co_await run_produce(1, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, produce_100_none) {
+    co_return co_await run_produce(100, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, produce_100_lz4) {
+    co_return co_await run_produce(100, model::compression::lz4);
+}
+PERF_TEST_C(pipeline_fixture, produce_100_zstd) {
+    co_return co_await run_produce(100, model::compression::zstd);
+}
+
+PERF_TEST_C(pipeline_fixture, fetch_1_none) {
+    co_return co_await run_fetch(1, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, fetch_100_none) {
+    co_return co_await run_fetch(100, model::compression::none);
+}
+PERF_TEST_C(pipeline_fixture, fetch_100_lz4) {
+    co_return co_await run_fetch(100, model::compression::lz4);
+}
+PERF_TEST_C(pipeline_fixture, fetch_100_zstd) {
+    co_return co_await run_fetch(100, model::compression::zstd);
+}
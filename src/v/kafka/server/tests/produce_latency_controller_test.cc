@@ -0,0 +1,44 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/produce_latency_controller.h"
+#include "utils/log_hist.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_produce_latency_quantile_between_samples) {
+    using kafka::produce_latency_sampler;
+    log_hist_internal hist;
+
+    auto empty = hist.internal_histogram_logform();
+    BOOST_REQUIRE_EQUAL(
+      produce_latency_sampler::quantile_between(empty, empty, 0.99), 0);
+
+    for (int i = 0; i < 99; ++i) {
+        hist.record(100);
+    }
+    hist.record(10'000);
+    auto first = hist.internal_histogram_logform();
+    // 100 falls in [64, 128), 10'000 in [8192, 16384)
+    BOOST_REQUIRE_EQUAL(
+      produce_latency_sampler::quantile_between(empty, first, 0.99), 127);
+    BOOST_REQUIRE_EQUAL(
+      produce_latency_sampler::quantile_between(empty, first, 1.0), 16383);
+
+    // Only the samples recorded since the previous snapshot count
+    for (int i = 0; i < 10; ++i) {
+        hist.record(1'000);
+    }
+    auto second = hist.internal_histogram_logform();
+    BOOST_REQUIRE_EQUAL(
+      produce_latency_sampler::quantile_between(first, second, 0.99), 1023);
+    BOOST_REQUIRE_EQUAL(
+      produce_latency_sampler::quantile_between(second, second, 0.99), 0);
+}
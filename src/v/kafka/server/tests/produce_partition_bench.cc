@@ -62,10 +62,14 @@ struct produce_partition_fixture : redpanda_thread_fixture {
         wait_for_leader(ntp).get();
         BOOST_TEST_CHECKPOINT("HERE");
     }
-    ss::future<> run_test(size_t data_size);
+    // Unless `until_produced` is set only the dispatch of the produce request
+    // is measured. Otherwise the measurement includes the hand off to the
+    // partition's shard, which is this one, and its replication.
+    ss::future<> run_test(size_t data_size, bool until_produced = false);
 };
 
-ss::future<> produce_partition_fixture::run_test(size_t data_size) {
+ss::future<>
+produce_partition_fixture::run_test(size_t data_size, bool until_produced) {
     BOOST_TEST_CHECKPOINT("HERE");
 
     model::topic_partition tp = model::topic_partition(
@@ -122,9 +126,17 @@ ss::future<> produce_partition_fixture::run_test(size_t data_size) {
     perf_tests::start_measuring_time();
     auto stages = kafka::testing::produce_single_partition(
       pctx, topic, partition);
-    perf_tests::stop_measuring_time();
+    if (!until_produced) {
+        perf_tests::stop_measuring_time();
+    }
 
     auto fut = co_await ss::coroutine::as_future(std::move(stages.dispatched));
+    auto produced_fut = co_await ss::coroutine::as_future(
+      std::move(stages.produced));
+    if (until_produced) {
+        perf_tests::stop_measuring_time();
+    }
+
     if (fut.failed()) {
         vlog(
           plog.error,
@@ -133,8 +145,6 @@ ss::future<> produce_partition_fixture::run_test(size_t data_size) {
         co_return;
     }
 
-    auto produced_fut = co_await ss::coroutine::as_future(
-      std::move(stages.produced));
     if (produced_fut.failed()) {
         vlog(
           plog.error,
@@ -160,3 +170,9 @@ PERF_TEST_C(produce_partition_fixture, 4_KiB) {
 PERF_TEST_C(produce_partition_fixture, 8_KiB) {
     co_return co_await this->run_test(8_KiB);
 }
+PERF_TEST_C(produce_partition_fixture, produced_1_KiB) {
+    co_return co_await this->run_test(1024, true);
+}
+PERF_TEST_C(produce_partition_fixture, produced_8_KiB) {
+    co_return co_await this->run_test(8_KiB, true);
+}
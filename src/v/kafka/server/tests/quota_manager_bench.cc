@@ -83,13 +83,17 @@ ss::future<> test_quota_manager(size_t count, bool use_unique) {
 struct throughput_test_case {
     std::optional<uint32_t> fetch_tp;
     bool use_unique;
+    uint64_t max_lease_bytes{0};
 };
 
 future<size_t> run_tc(throughput_test_case tc) {
-    co_await ss::smp::invoke_on_all([fetch_tp{tc.fetch_tp}]() {
-        config::shard_local_cfg().target_fetch_quota_byte_rate.set_value(
-          fetch_tp);
-    });
+    co_await ss::smp::invoke_on_all(
+      [fetch_tp{tc.fetch_tp}, max_lease_bytes{tc.max_lease_bytes}]() {
+          config::shard_local_cfg().target_fetch_quota_byte_rate.set_value(
+            fetch_tp);
+          config::shard_local_cfg()
+            .kafka_client_quota_max_lease_bytes.set_value(max_lease_bytes);
+      });
     co_await test_quota_manager(total_requests / ss::smp::count, tc.use_unique);
     co_return total_requests;
 }
@@ -124,6 +128,22 @@ PERF_TEST_CN(throughput_group, test_quota_manager_on_limited_unique) {
     });
 }
 
+PERF_TEST_CN(throughput_group, test_quota_manager_on_unlimited_shared_leased) {
+    return run_tc(throughput_test_case{
+      .fetch_tp = std::numeric_limits<uint32_t>::max(),
+      .use_unique = false,
+      .max_lease_bytes = 1 << 20,
+    });
+}
+
+PERF_TEST_CN(throughput_group, test_quota_manager_on_limited_shared_leased) {
+    return run_tc(throughput_test_case{
+      .fetch_tp = 1000,
+      .use_unique = false,
+      .max_lease_bytes = 1 << 20,
+    });
+}
+
 PERF_TEST_CN(throughput_group, test_quota_manager_off_shared) {
     return run_tc(throughput_test_case{
       .fetch_tp = std::nullopt,
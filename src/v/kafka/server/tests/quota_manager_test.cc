@@ -101,6 +101,42 @@ SEASTAR_THREAD_TEST_CASE(quota_manager_fetch_throttling) {
     BOOST_CHECK_EQUAL(delay, 0ms);
 }
 
+SEASTAR_THREAD_TEST_CASE(quota_manager_fetch_bytes_available) {
+    fixture f;
+
+    auto& qm = f.sqm.local();
+    auto now = kafka::quota_manager::clock::now();
+
+    // Test that there is no limit without a fetch quota
+    BOOST_CHECK(!qm.fetch_bytes_available(client_id, now).get().has_value());
+
+    using cluster::client_quota::entity_key;
+    using cluster::client_quota::entity_value;
+
+    auto default_key = entity_key(entity_key::client_id_default_match{});
+    auto default_values = entity_value{
+      .consumer_byte_rate = 100,
+    };
+    f.quota_store.local().set_quota(default_key, default_values);
+
+    // Test that the fetch quota is available before anything is fetched
+    auto available = qm.fetch_bytes_available(client_id, now).get();
+    BOOST_REQUIRE(available.has_value());
+    BOOST_CHECK_GT(*available, 0);
+
+    // Test that nothing is available once the client is over its quota
+    qm.record_fetch_tp(client_id, *available + 10, now).get();
+    available = qm.fetch_bytes_available(client_id, now).get();
+    BOOST_REQUIRE(available.has_value());
+    BOOST_CHECK_EQUAL(*available, 0);
+
+    // Test that the quota becomes available again over time
+    now += 1s;
+    available = qm.fetch_bytes_available(client_id, now).get();
+    BOOST_REQUIRE(available.has_value());
+    BOOST_CHECK_GT(*available, 0);
+}
+
 SEASTAR_THREAD_TEST_CASE(quota_manager_fetch_stress_test) {
     fixture f;
 
@@ -9,6 +9,7 @@
 
 #include "base/vlog.h"
 #include "kafka/server/usage_aggregator.h"
+#include "kafka/server/usage_manager.h"
 #include "storage/tests/kvstore_fixture.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -205,3 +206,12 @@ SEASTAR_THREAD_TEST_CASE(test_round_to_interval_method) {
         BOOST_CHECK(ts != kafka::detail::round_to_interval(ival, ts - 10min));
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_usage_excluded_topics) {
+    for (const auto& topic : kafka::usage_excluded_topics) {
+        BOOST_CHECK(kafka::is_usage_excluded_topic(topic));
+    }
+    BOOST_CHECK(!kafka::is_usage_excluded_topic(model::topic("topic")));
+    BOOST_CHECK(!kafka::is_usage_excluded_topic(model::topic("_topic")));
+    BOOST_CHECK(!kafka::is_usage_excluded_topic(model::topic("")));
+}
@@ -21,6 +21,8 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/timer.hh>
 
+#include <algorithm>
+
 namespace kafka {
 
 /// Class that manages all usage statistics. Usage stats are more accurate
@@ -73,6 +75,10 @@ public:
     /// Safely shuts down accounting fiber and deallocates it
     ss::future<> stop();
 
+    /// True if usage is accounted for, bytes added while it isn't are
+    /// dropped when it is enabled
+    bool enabled() const { return _usage_enabled(); }
+
     /// Adds bytes to current open window
     ///
     /// Should be called at the kafka layer to account for bytes sent via kafka
@@ -132,4 +138,20 @@ static const auto usage_excluded_topics = std::to_array(
    model::kafka_audit_logging_topic,
    model::topic("__redpanda_e2e_probe")});
 
+/// True if the bytes of produce and fetch requests to the topic are not
+/// accounted for. Called for every topic of every produce and fetch request.
+inline bool is_usage_excluded_topic(const model::topic& topic) {
+    // all the excluded topics start with an underscore, skip the comparisons
+    // for the topics that don't
+    const auto& name = topic();
+    if (name.empty() || name[0] != '_') {
+        return false;
+    }
+    return std::find(
+             usage_excluded_topics.cbegin(),
+             usage_excluded_topics.cend(),
+             topic)
+           != usage_excluded_topics.cend();
+}
+
 } // namespace kafka
@@ -289,6 +289,49 @@ private:
     std::vector<record_header> _headers{};
 };
 
+/// \brief the fields of a record that indexing and filtering need, without
+/// the value and the headers. Parsing one out of a batch copies only the key;
+/// value and header bytes are skipped where they lie in the batch, so readers
+/// that look at keys and offsets don't pay for materializing whole records.
+class record_view {
+public:
+    record_view() = default;
+    record_view(
+      int32_t size_bytes,
+      record_attributes attributes,
+      int64_t timestamp_delta,
+      int32_t offset_delta,
+      int32_t key_size,
+      iobuf key,
+      int32_t value_size)
+      : _size_bytes(size_bytes)
+      , _attributes(attributes)
+      , _timestamp_delta(timestamp_delta)
+      , _offset_delta(offset_delta)
+      , _key_size(key_size)
+      , _key(std::move(key))
+      , _val_size(value_size) {}
+
+    int32_t size_bytes() const { return _size_bytes; }
+    record_attributes attributes() const { return _attributes; }
+    int64_t timestamp_delta() const { return _timestamp_delta; }
+    int32_t offset_delta() const { return _offset_delta; }
+    int32_t key_size() const { return _key_size; }
+    const iobuf& key() const { return _key; }
+    bool has_key() const { return _key_size >= 0; }
+    int32_t value_size() const { return _val_size; }
+    bool has_value() const { return _val_size >= 0; }
+
+private:
+    int32_t _size_bytes{0};
+    record_attributes _attributes;
+    int64_t _timestamp_delta{0};
+    int32_t _offset_delta{0};
+    int32_t _key_size{-1};
+    iobuf _key;
+    int32_t _val_size{-1};
+};
+
 class record_batch_attributes final {
 public:
     static constexpr uint16_t compression_mask = 0x7;
@@ -657,6 +700,9 @@ public:
 
     model::record next();
 
+    /// Like next() but only copies the key of the record out of the batch.
+    model::record_view next_view();
+
     static record_batch_iterator create(const model::record_batch& b);
 
 private:
@@ -845,6 +891,26 @@ public:
         }
     }
 
+    /**
+     * Iterate over record views: like `for_each_record(..)` but only the keys
+     * are copied out of the batch, values and headers are skipped.
+     */
+    template<typename Func>
+    void for_each_record_view(Func f) const {
+        auto it = record_batch_iterator::create(*this);
+        while (it.has_next()) {
+            if constexpr (std::is_void_v<
+                            std::invoke_result_t<Func, model::record_view>>) {
+                f(it.next_view());
+            } else {
+                ss::stop_iteration s = f(it.next_view());
+                if (s == ss::stop_iteration::yes) {
+                    return;
+                }
+            }
+        }
+    }
+
     /**
      * Materialize records.
      *
@@ -942,6 +1008,27 @@ for_each_record(const model::record_batch& batch, Func&& f) {
       });
 }
 
+/**
+ * Futurized `record_batch::for_each_record_view(..)`: iterates over records
+ * without copying their values and headers out of the batch.
+ */
+template<typename Func>
+inline ss::future<>
+for_each_record_view(const model::record_batch& batch, Func&& f) {
+    return ss::do_with(
+      record_batch_iterator::create(batch),
+      record_view{},
+      [f = std::forward<Func>(f)](
+        record_batch_iterator& it, record_view& r) mutable {
+          return ss::do_until(
+            [&it]() { return !it.has_next(); },
+            [&it, &r, f = std::forward<Func>(f)]() {
+                r = it.next_view();
+                return ss::futurize_invoke(f, r);
+            });
+      });
+}
+
 class record_batch_crc_checker {
 public:
     explicit record_batch_crc_checker(bool verify_internal_header = true)
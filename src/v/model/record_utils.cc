@@ -13,6 +13,10 @@
 #include "model/record.h"
 #include "utils/vint.h"
 
+#include <fmt/format.h>
+
+#include <exception>
+#include <stdexcept>
 #include <type_traits>
 
 namespace model {
@@ -174,6 +178,104 @@ model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser) {
       });
 }
 
+static int64_t skip_blob(iobuf_const_parser& parser) {
+    auto [length, _] = parser.read_varlong();
+    if (length > 0) {
+        parser.skip(length);
+    }
+    return length;
+}
+
+static void skip_record_headers(iobuf_const_parser& parser) {
+    auto [header_count, _] = parser.read_varlong();
+    if (header_count < 0) [[unlikely]] {
+        throw std::out_of_range(
+          fmt::format("Invalid record header count: {}", header_count));
+    }
+    for (int64_t i = 0; i < header_count; ++i) {
+        skip_blob(parser); // header key
+        skip_blob(parser); // header value
+    }
+}
+
+model::record_view
+parse_one_record_view_from_buffer(iobuf_const_parser& parser) {
+    auto [record_size, attr] = parse_record_meta_from_buffer(parser);
+    auto [timestamp_delta, tv] = parser.read_varlong();
+    auto [offset_delta, ov] = parser.read_varlong();
+    auto [key_length, kv] = parser.read_varlong();
+    iobuf key;
+    if (key_length > 0) {
+        key = parser.copy(key_length);
+    }
+    auto value_length = skip_blob(parser);
+    skip_record_headers(parser);
+    return model::record_view(
+      record_size,
+      model::record_attributes(attr),
+      static_cast<int64_t>(timestamp_delta),
+      static_cast<int32_t>(offset_delta),
+      static_cast<int32_t>(key_length),
+      std::move(key),
+      static_cast<int32_t>(value_length));
+}
+
+static void skip_one_record_from_buffer(iobuf_const_parser& parser) {
+    parse_record_meta_from_buffer(parser);
+    parser.read_varlong(); // timestamp delta
+    parser.read_varlong(); // offset delta
+    skip_blob(parser);     // key
+    skip_blob(parser);     // value
+    skip_record_headers(parser);
+}
+
+void validate_records(const iobuf& records, int32_t record_count) {
+    iobuf_const_parser parser(records);
+    for (int32_t i = 0; i < record_count; ++i) {
+        skip_one_record_from_buffer(parser);
+    }
+    // same as record_batch_iterator, an empty batch isn't checked
+    if (record_count > 0 && parser.bytes_left()) [[unlikely]] {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          parser.bytes_left()));
+    }
+}
+
+void crc_and_validate_records(
+  crc::crc32c& crc, const iobuf& records, int32_t record_count) {
+    // every fragment is added to the crc as soon as the parser is past it,
+    // while it's still in cache from reading the records in it
+    auto frag = records.begin();
+    size_t crc_size = 0;
+    auto extend_up_to = [&](size_t position) {
+        while (frag != records.end() && crc_size + frag->size() <= position) {
+            crc.extend(frag->get(), frag->size());
+            crc_size += frag->size();
+            ++frag;
+        }
+    };
+    std::exception_ptr ex;
+    try {
+        iobuf_const_parser parser(records);
+        for (int32_t i = 0; i < record_count; ++i) {
+            skip_one_record_from_buffer(parser);
+            extend_up_to(parser.bytes_consumed());
+        }
+        if (record_count > 0 && parser.bytes_left()) [[unlikely]] {
+            throw std::out_of_range(fmt::format(
+              "Record iteration stopped with {} bytes remaining",
+              parser.bytes_left()));
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    extend_up_to(records.size_bytes());
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
 static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
     auto vb = vint::to_bytes(v);
     b.append(vb.data(), vb.size());
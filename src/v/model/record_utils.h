@@ -19,6 +19,7 @@ namespace model {
 struct record_batch_header;
 class record_batch;
 class record;
+class record_view;
 
 void crc_record_batch_header(crc::crc32c&, const record_batch_header&);
 
@@ -32,6 +33,22 @@ uint32_t internal_header_only_crc(const record_batch_header&);
 
 model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
+/// \brief parses the record at the parser position, copying only its key, and
+/// leaves the parser past the value and headers.
+model::record_view
+parse_one_record_view_from_buffer(iobuf_const_parser& parser);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
+/// \brief checks that `records` holds exactly `record_count` well formed
+/// uncompressed records, like iterating them would, but without copying their
+/// keys, values and headers out. Throws std::out_of_range otherwise.
+void validate_records(const iobuf& records, int32_t record_count);
+
+/// \brief validate_records() and crc_extend_iobuf() in a single pass over
+/// `records`. The crc is extended with all of them even when they turn out to
+/// be malformed, so that a corrupted batch can still be told apart from a
+/// malformed one.
+void crc_and_validate_records(
+  crc::crc32c& crc, const iobuf& records, int32_t record_count);
+
 } // namespace model
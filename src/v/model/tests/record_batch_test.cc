@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "hashing/crc32c.h"
 #include "model/record.h"
 #include "model/record_utils.h"
 #include "model/tests/random_batch.h"
@@ -91,6 +92,32 @@ SEASTAR_THREAD_TEST_CASE(iterator) {
     BOOST_TEST(!it.has_next());
 }
 
+SEASTAR_THREAD_TEST_CASE(view_iterator) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+
+    auto it = model::record_batch_iterator::create(b);
+    auto view_it = model::record_batch_iterator::create(b);
+    while (it.has_next()) {
+        BOOST_TEST(view_it.has_next());
+        model::record r = it.next();
+        model::record_view v = view_it.next_view();
+        BOOST_TEST(v.size_bytes() == r.size_bytes());
+        BOOST_TEST(v.attributes() == r.attributes());
+        BOOST_TEST(v.timestamp_delta() == r.timestamp_delta());
+        BOOST_TEST(v.offset_delta() == r.offset_delta());
+        BOOST_TEST(v.key_size() == r.key_size());
+        BOOST_TEST(v.key() == r.key());
+        BOOST_TEST(v.value_size() == r.value_size());
+    }
+    BOOST_TEST(!view_it.has_next());
+
+    int32_t visited = 0;
+    b.for_each_record_view([&visited](model::record_view v) {
+        BOOST_TEST(v.offset_delta() == visited++);
+    });
+    BOOST_TEST(visited == b.record_count());
+}
+
 SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     auto b = model::test::make_random_batch(model::offset(0), 1, false);
     auto buf = b.data().copy();
@@ -106,3 +133,45 @@ SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     BOOST_TEST(it.has_next());
     BOOST_REQUIRE_THROW(it.next(), std::out_of_range);
 }
+
+SEASTAR_THREAD_TEST_CASE(validate_records) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    BOOST_REQUIRE_NO_THROW(
+      model::validate_records(b.data(), b.record_count()));
+
+    // too many records claimed
+    BOOST_REQUIRE_THROW(
+      model::validate_records(b.data(), b.record_count() + 1),
+      std::out_of_range);
+
+    // bytes left after the last record
+    auto buf = b.data().copy();
+    constexpr std::string_view extra_data = "foobar";
+    buf.append(extra_data.data(), extra_data.size());
+    BOOST_REQUIRE_THROW(
+      model::validate_records(buf, b.record_count()), std::out_of_range);
+
+    // records cut short
+    buf = b.data().copy();
+    buf.trim_back(1);
+    BOOST_REQUIRE_THROW(
+      model::validate_records(buf, b.record_count()), std::out_of_range);
+}
+
+SEASTAR_THREAD_TEST_CASE(crc_and_validate_records) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    auto expected = crc::crc32c();
+    crc_extend_iobuf(expected, b.data());
+
+    auto crc = crc::crc32c();
+    BOOST_REQUIRE_NO_THROW(
+      model::crc_and_validate_records(crc, b.data(), b.record_count()));
+    BOOST_REQUIRE_EQUAL(crc.value(), expected.value());
+
+    // the crc still covers all the bytes when the records are malformed
+    crc = crc::crc32c();
+    BOOST_REQUIRE_THROW(
+      model::crc_and_validate_records(crc, b.data(), b.record_count() + 1),
+      std::out_of_range);
+    BOOST_REQUIRE_EQUAL(crc.value(), expected.value());
+}
@@ -10,21 +10,32 @@
 #include "net/batched_output_stream.h"
 
 #include "base/likely.h"
+#include "base/units.h"
 #include "base/vassert.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/scattered_message.hh>
+#include <seastar/core/temporary_buffer.hh>
+#include <seastar/net/packet.hh>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o,
+  size_t cache,
+  bool coalesce_fragments,
+  std::chrono::microseconds cork_window)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _coalesce_fragments(coalesce_fragments)
+  , _cork_window(cork_window) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
@@ -36,27 +47,114 @@ already_closed_error(ss::scattered_message<char>& msg) {
       batched_output_stream_closed(msg.size()));
 }
 
-ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
+// Largest TLS record payload (RFC 8446 section 5.1)
+static constexpr size_t max_tls_record_size = 16_KiB;
+// Fragments at least this large are passed through without a copy
+static constexpr size_t min_uncoalesced_fragment_size = 4_KiB;
+
+/**
+ * Copies runs of small fragments into buffers of up to one TLS record, large
+ * fragments are kept as they are. Packets of at most one record are left
+ * alone, the TLS layer linearizes those itself.
+ */
+static ss::net::packet coalesce_small_fragments(ss::net::packet p) {
+    if (p.nr_frags() <= 1 || p.len() <= max_tls_record_size) {
+        return p;
+    }
+    auto frags = p.fragments();
+    // keeps the fragments passed through alive
+    auto original = ss::make_object_deleter(std::move(p));
+
+    ss::net::packet out;
+    ss::temporary_buffer<char> buf;
+    size_t used = 0;
+    auto append_buf = [&out, &buf, &used] {
+        if (used > 0) {
+            buf.trim(used);
+            out = ss::net::packet(std::move(out), std::move(buf));
+        }
+        buf = {};
+        used = 0;
+    };
+    for (const auto& f : frags) {
+        if (f.size >= min_uncoalesced_fragment_size) {
+            append_buf();
+            out = ss::net::packet(std::move(out), f, original.share());
+            continue;
+        }
+        size_t copied = 0;
+        while (copied < f.size) {
+            if (used == buf.size()) {
+                append_buf();
+                buf = ss::temporary_buffer<char>(max_tls_record_size);
+            }
+            const auto n = std::min(f.size - copied, buf.size() - used);
+            std::copy_n(f.base + copied, n, buf.get_write() + used);
+            copied += n;
+            used += n;
+        }
+    }
+    append_buf();
+    return out;
+}
+
+ss::future<bool> batched_output_stream::write(
+  ss::scattered_message<char> msg, more_pending more) {
     if (unlikely(_closed)) {
         return already_closed_error(msg);
     }
     return ss::with_semaphore(
-      *_write_sem, 1, [this, v = std::move(msg)]() mutable {
+      *_write_sem, 1, [this, more, v = std::move(msg)]() mutable {
           if (unlikely(_closed)) {
               return already_closed_error(v);
           }
           const size_t vbytes = v.size();
-          return _out.write(std::move(v)).then([this, vbytes] {
+          auto f = _coalesce_fragments
+                     ? _out.write(
+                         coalesce_small_fragments(std::move(v).release()))
+                     : _out.write(std::move(v));
+          return f.then([this, vbytes, more] {
               _unflushed_bytes += vbytes;
-              if (
-                _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
+              if (_unflushed_bytes >= _cache_size) {
                   return do_flush().then([] { return true; });
               }
-              return ss::make_ready_future<bool>(false);
+              if (_write_sem->waiters() > 0) {
+                  // the next writer flushes
+                  return ss::make_ready_future<bool>(false);
+              }
+              if (more && _cork_window.count() > 0) {
+                  arm_cork_timer();
+                  return ss::make_ready_future<bool>(false);
+              }
+              return do_flush().then([] { return true; });
           });
       });
 }
+
+void batched_output_stream::arm_cork_timer() {
+    if (_cork_timer.armed()) {
+        // the cork bounds the delay of the oldest unflushed message
+        return;
+    }
+    _cork_timer.set_callback([this] {
+        // stop() cancels the timer and then waits on the semaphore, so the
+        // stream outlives this flush. A failure is seen by the next writer.
+        ssx::background = ss::with_semaphore(
+                            *_write_sem,
+                            1,
+                            [this] {
+                                if (_closed) {
+                                    return ss::make_ready_future<>();
+                                }
+                                return do_flush();
+                            })
+                            .handle_exception([](const std::exception_ptr&) {});
+    });
+    _cork_timer.arm(_cork_window);
+}
+
 ss::future<> batched_output_stream::do_flush() {
+    _cork_timer.cancel();
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
     }
@@ -71,6 +169,7 @@ ss::future<> batched_output_stream::stop() {
         return ss::make_ready_future<>();
     }
     _closed = true;
+    _cork_timer.cancel();
 
     if (_cache_size == 0) {
         // A default-initialized batched_output_stream has a default
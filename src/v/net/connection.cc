@@ -137,14 +137,19 @@ connection::connection(
   server_probe& p,
   std::optional<size_t> in_max_buffer_size,
   bool tls_enabled,
-  ss::logger* log)
+  ss::logger* log,
+  std::chrono::microseconds cork_window)
   : addr(a)
   , _hook(hook)
   , _name(std::move(name))
   , _fd(std::move(f))
   , _local_addr(_fd.local_address())
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      _fd.output(),
+      batched_output_stream::default_max_unflushed_bytes,
+      tls_enabled,
+      cork_window)
   , _probe(p)
   , _tls_enabled(tls_enabled)
   , _log(log) {
@@ -177,9 +182,10 @@ ss::future<> connection::shutdown() {
     return _out.stop();
 }
 
-ss::future<> connection::write(ss::scattered_message<char> msg) {
+ss::future<> connection::write(
+  ss::scattered_message<char> msg, batched_output_stream::more_pending more) {
     _probe.add_bytes_sent(msg.size());
-    return _out.write(std::move(msg)).discard_result();
+    return _out.write(std::move(msg), more).discard_result();
 }
 
 } // namespace net
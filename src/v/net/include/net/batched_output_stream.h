@@ -12,10 +12,14 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/vassert.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/bool_class.hh>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -43,14 +47,30 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * For TLS streams, small fragments of a message can be coalesced before
+ * they reach the TLS layer. The TLS layer encrypts each fragment of a large
+ * message as a record of its own, so many small fragments would otherwise
+ * each pay the record framing, cipher setup and syscall cost.
+ *
+ * Writers that know more messages will follow shortly (e.g. a server with
+ * further requests of the connection in flight) can pass a hint which, with
+ * a non-zero cork window, defers the flush by up to that window. Messages
+ * written in the meantime are handed to the kernel together by the flush,
+ * as a single writev with one iovec per fragment, instead of one syscall
+ * per message.
  */
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
+    using more_pending = ss::bool_class<struct more_pending_tag>;
 
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      bool coalesce_fragments = false,
+      std::chrono::microseconds cork_window = {});
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
@@ -58,7 +78,13 @@ public:
       , _cache_size(o._cache_size)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
-      , _closed(o._closed) {}
+      , _coalesce_fragments(o._coalesce_fragments)
+      , _cork_window(o._cork_window)
+      , _closed(o._closed) {
+        // the cork timer callback refers to `this`, streams are only moved
+        // before their first write
+        vassert(!o._cork_timer.armed(), "moved a corked output stream");
+    }
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
             this->~batched_output_stream();
@@ -74,14 +100,17 @@ public:
      *
      * Writes the scattered message to the underlying output stream, flushing if
      * this is the only (last) writer trying to write to this stream or if the
-     * _cache_size has been reached.
+     * _cache_size has been reached. When the caller hints that more messages
+     * are pending the flush is instead deferred by up to the cork window.
      *
      * @param msg the message to write to the underlying stream
+     * @param more whether the caller expects to write more messages soon
      * @return ss::future<bool> a future which resolves when the flush, if any,
      * completes with the wrapped value indicating wheter a flush occurred on
      * this write (true) or not (false)
      */
-    ss::future<bool> write(ss::scattered_message<char> msg);
+    ss::future<bool> write(
+      ss::scattered_message<char> msg, more_pending more = more_pending::no);
     ss::future<> flush();
 
     /// \brief calls output_stream<char>::close()
@@ -92,11 +121,15 @@ public:
 
 private:
     ss::future<> do_flush();
+    void arm_cork_timer();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
+    bool _coalesce_fragments{false};
+    std::chrono::microseconds _cork_window{0};
+    ss::timer<> _cork_timer;
     bool _closed = false;
 };
 } // namespace net
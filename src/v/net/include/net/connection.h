@@ -44,7 +44,8 @@ public:
       server_probe& p,
       std::optional<size_t> in_max_buffer_size,
       bool tls_enabled,
-      ss::logger*);
+      ss::logger*,
+      std::chrono::microseconds cork_window = {});
     ~connection() noexcept;
     connection(const connection&) = delete;
     connection& operator=(const connection&) = delete;
@@ -53,7 +54,10 @@ public:
 
     const ss::sstring& name() const { return _name; }
     ss::input_stream<char>& input() { return _in; }
-    ss::future<> write(ss::scattered_message<char> msg);
+    ss::future<> write(
+      ss::scattered_message<char> msg,
+      batched_output_stream::more_pending more
+      = batched_output_stream::more_pending::no);
     ss::future<> shutdown();
     void shutdown_input();
     const ss::socket_address& local_address() const noexcept {
@@ -28,6 +28,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <chrono>
 #include <list>
 #include <optional>
 #include <type_traits>
@@ -85,6 +86,9 @@ struct server_configuration {
     std::optional<int> tcp_recv_buf;
     std::optional<int> tcp_send_buf;
     std::optional<size_t> stream_recv_buf;
+    // upper bound on deferring a response flush while further requests of
+    // the connection are in flight, zero flushes every response
+    std::chrono::microseconds cork_window{0};
     net::metrics_disabled disable_metrics = net::metrics_disabled::no;
     net::public_metrics_disabled disable_public_metrics
       = net::public_metrics_disabled::no;
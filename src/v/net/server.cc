@@ -264,7 +264,8 @@ ss::future<ss::stop_iteration> server::accept_finish(
       *_probe,
       cfg.stream_recv_buf,
       tls_enabled,
-      &_log);
+      &_log,
+      cfg.cork_window);
     vlog(
       _log.trace,
       "{} - Incoming connection from {} on \"{}\"",
@@ -378,7 +379,8 @@ std::ostream& operator<<(std::ostream& o, const server_configuration& c) {
       << ", listen_backlog:" << c.listen_backlog
       << ", tcp_recv_buf:" << c.tcp_recv_buf
       << ", tcp_send_buf:" << c.tcp_send_buf
-      << ", stream_recv_buf:" << c.stream_recv_buf;
+      << ", stream_recv_buf:" << c.stream_recv_buf
+      << ", cork_window:" << c.cork_window.count() << "us";
     return o << "}";
 }
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "net/batched_output_stream.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/core/scattered_message.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+using more_pending = net::batched_output_stream::more_pending;
+
+namespace {
+
+// counts the puts reaching the sink, each of which is one syscall for a
+// socket
+struct counting_sink final : ss::data_sink_impl {
+    explicit counting_sink(size_t& puts)
+      : puts(puts) {}
+    ss::future<> put(ss::net::packet) final {
+        ++puts;
+        return ss::now();
+    }
+    ss::future<> put(std::vector<ss::temporary_buffer<char>>) final {
+        ++puts;
+        return ss::now();
+    }
+    ss::future<> put(ss::temporary_buffer<char>) final {
+        ++puts;
+        return ss::now();
+    }
+    ss::future<> flush() final { return ss::now(); }
+    ss::future<> close() final { return ss::now(); }
+    size_t& puts;
+};
+
+net::batched_output_stream
+make_stream(size_t& puts, std::chrono::microseconds cork_window) {
+    return net::batched_output_stream(
+      ss::output_stream<char>(
+        ss::data_sink(std::make_unique<counting_sink>(puts)), 64_KiB),
+      net::batched_output_stream::default_max_unflushed_bytes,
+      false,
+      cork_window);
+}
+
+ss::scattered_message<char> make_msg() {
+    ss::scattered_message<char> msg;
+    msg.append(ss::sstring(100, 'x'));
+    return msg;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(flushes_every_write_without_cork) {
+    size_t puts = 0;
+    auto out = make_stream(puts, 0us);
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(out.write(make_msg(), more_pending::yes).get());
+    }
+    BOOST_REQUIRE_EQUAL(puts, 3);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(corked_writes_flush_together) {
+    size_t puts = 0;
+    auto out = make_stream(puts, 1ms);
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(!out.write(make_msg(), more_pending::yes).get());
+    }
+    BOOST_REQUIRE_EQUAL(puts, 0);
+    // the cork window bounds the delay
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE_EQUAL(puts, 1);
+    out.stop().get();
+    BOOST_REQUIRE_EQUAL(puts, 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(last_pending_write_uncorks) {
+    size_t puts = 0;
+    auto out = make_stream(puts, 1s);
+    BOOST_REQUIRE(!out.write(make_msg(), more_pending::yes).get());
+    BOOST_REQUIRE(!out.write(make_msg(), more_pending::yes).get());
+    BOOST_REQUIRE(out.write(make_msg(), more_pending::no).get());
+    BOOST_REQUIRE_EQUAL(puts, 1);
+    out.stop().get();
+    BOOST_REQUIRE_EQUAL(puts, 1);
+}
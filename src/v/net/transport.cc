@@ -67,7 +67,10 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
         // Never implicitly destroy a live output stream here: output streams
         // are only safe to destroy after/during stop()
         vassert(!_out.is_valid(), "destroyed output_stream without stopping");
-        _out = net::batched_output_stream(_fd->output());
+        _out = net::batched_output_stream(
+          _fd->output(),
+          net::batched_output_stream::default_max_unflushed_bytes,
+          _creds != nullptr);
     } catch (...) {
         auto e = std::current_exception();
         if (auto* p = _probe.value_or(nullptr); p != nullptr) {
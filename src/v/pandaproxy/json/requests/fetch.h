@@ -12,6 +12,8 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/units.h"
+#include "bytes/iostream.h"
 #include "json/writer.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
@@ -23,8 +25,12 @@
 #include "pandaproxy/json/types.h"
 #include "storage/parser_utils.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
 
+#include <exception>
+
 namespace pandaproxy::json {
 
 template<>
@@ -92,15 +98,20 @@ public:
     explicit rjson_serialize_impl(serialization_format fmt)
       : _fmt(fmt) {}
 
-    template<typename Buffer>
-    bool
-    operator()(::json::iobuf_writer<Buffer>& w, kafka::fetch_response&& res) {
-        // Eager check for errors
+    ///\brief Throw if any partition of the response has an error.
+    static void check_errors(kafka::fetch_response& res) {
         for (auto& v : res) {
             if (v.partition_response->error_code != kafka::error_code::none) {
                 throw serialize_error(v.partition_response->error_code);
             }
         }
+    }
+
+    template<typename Buffer>
+    bool
+    operator()(::json::iobuf_writer<Buffer>& w, kafka::fetch_response&& res) {
+        // Eager check for errors
+        check_errors(res);
 
         w.StartArray();
         for (auto& v : res) {
@@ -149,4 +160,78 @@ private:
     serialization_format _fmt;
 };
 
+namespace impl {
+
+inline ss::future<> write_binary_fetch_response(
+  kafka::fetch_response res, ss::output_stream<char> os, size_t flush_bytes) {
+    std::exception_ptr ex;
+    try {
+        ::json::chunked_buffer buf;
+        ::json::iobuf_writer<::json::chunked_buffer> w(buf);
+        w.StartArray();
+        for (auto& v : res) {
+            auto r = std::move(*v.partition_response);
+            model::topic_partition_view tpv(
+              v.partition->name, r.partition_index);
+            while (r.records && !r.records->empty()) {
+                auto adapter = r.records->consume_batch();
+                if (
+                  !adapter.batch
+                  || adapter.batch->header().attrs.is_control()) {
+                    continue;
+                }
+
+                auto batch = std::move(*adapter.batch);
+                if (batch.compressed()) {
+                    batch = co_await storage::internal::decompress_batch(
+                      std::move(batch));
+                }
+
+                // Base64 encoding can't fail, so neither can the records
+                auto rjs = rjson_serialize_impl<model::record>(
+                  serialization_format::binary_v2, tpv, batch.base_offset());
+                batch.for_each_record([&rjs, &w](model::record record) {
+                    rjs(w, std::move(record));
+                });
+
+                if (buf.GetSize() >= flush_bytes) {
+                    co_await write_iobuf_to_output_stream(
+                      std::move(buf).as_iobuf(), os);
+                }
+            }
+        }
+        w.EndArray();
+        co_await write_iobuf_to_output_stream(std::move(buf).as_iobuf(), os);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await os.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+} // namespace impl
+
+///\brief Stream a binary_v2 fetch response into the body of a reply.
+///
+/// Records are encoded a batch at a time, and written to the body whenever
+/// `flush_bytes` have been buffered, so the encoded response is never held in
+/// memory all at once.
+///
+/// Errors in the response are thrown before the body writer is returned, as
+/// they can't change the status of the reply once the body has started. The
+/// json_v2 format may find invalid records part way through, so it must be
+/// serialized up front instead.
+inline ss::noncopyable_function<ss::future<>(ss::output_stream<char>&& os)>
+as_binary_fetch_body_writer(
+  kafka::fetch_response&& res, size_t flush_bytes = 128_KiB) {
+    rjson_serialize_impl<kafka::fetch_response>::check_errors(res);
+    return [res{std::move(res)},
+            flush_bytes](ss::output_stream<char>&& os) mutable {
+        return impl::write_binary_fetch_response(
+          std::move(res), std::move(os), flush_bytes);
+    };
+}
+
 } // namespace pandaproxy::json
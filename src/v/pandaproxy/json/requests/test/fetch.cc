@@ -10,6 +10,8 @@
 #include "pandaproxy/json/requests/fetch.h"
 
 #include "base/seastarx.h"
+#include "bytes/iobuf_parser.h"
+#include "bytes/iostream.h"
 #include "container/fragmented_vector.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
@@ -93,3 +95,37 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_streaming) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::StringBuffer str_buf;
+    ::json::iobuf_writer<::json::StringBuffer> w(str_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      w, make_fetch_response(tps, model::offset{42}, 3));
+
+    // Flush after every batch, the body must match the buffered response
+    iobuf body;
+    auto writer = ppj::as_binary_fetch_body_writer(
+      make_fetch_response(tps, model::offset{42}, 3), 1);
+    writer(make_iobuf_ref_output_stream(body)).get();
+
+    iobuf_parser p{std::move(body)};
+    BOOST_REQUIRE_EQUAL(
+      p.read_string(p.bytes_left()),
+      std::string_view(str_buf.GetString(), str_buf.GetSize()));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_streaming_error) {
+    model::topic_partition tp{model::topic{"topic"}, model::partition_id{1}};
+    auto res = make_fetch_response({tp}, model::offset{0}, 1);
+    res.data.topics[0].partitions[0].error_code
+      = kafka::error_code::offset_out_of_range;
+
+    BOOST_REQUIRE_THROW(
+      ppj::as_binary_fetch_body_writer(std::move(res)), ppj::serialize_error);
+}
@@ -55,6 +55,9 @@ client_ptr kafka_client_cache::make_client(
         cfg.sasl_mechanism.set_value(std::move(user.sasl_mechanism));
         cfg.scram_username.set_value(std::move(user.name));
         cfg.scram_password.set_value(std::move(user.pass));
+        // There's a client per user, most of which only ever talk to a few
+        // leaders, so don't hold a connection to every broker for each one.
+        cfg.lazy_broker_connections.set_value(true);
     }
 
     return ss::make_lw_shared<kafka::client::client>(
@@ -50,6 +50,20 @@ namespace {
 
 using server = proxy::server;
 
+using body_writer
+  = ss::noncopyable_function<ss::future<>(ss::output_stream<char>&&)>;
+
+body_writer fetch_body_writer(
+  json::serialization_format res_fmt, kafka::fetch_response res) {
+    if (res_fmt == json::serialization_format::binary_v2) {
+        return ppj::as_binary_fetch_body_writer(std::move(res));
+    }
+    ::json::chunked_buffer buf;
+    ::json::iobuf_writer<::json::chunked_buffer> w(buf);
+    ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
+    return json::as_body_writer(std::move(buf).as_iobuf());
+}
+
 } // namespace
 
 ss::future<server::reply_t>
@@ -144,16 +158,11 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
           return client
             .fetch_partition(std::move(tp), offset, max_bytes, timeout)
             .then([res_fmt](kafka::fetch_response res) {
-                ::json::chunked_buffer buf;
-                ::json::iobuf_writer<::json::chunked_buffer> w(buf);
-
-                ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-                return buf;
+                return fetch_body_writer(res_fmt, std::move(res));
             });
       })
-      .then([res_fmt, rp = std::move(rp)](auto buf) mutable {
-          rp.rep->write_body(
-            "json", json::as_body_writer(std::move(buf).as_iobuf()));
+      .then([res_fmt, rp = std::move(rp)](auto body) mutable {
+          rp.rep->write_body("json", std::move(body));
           rp.mime_type = res_fmt;
           return std::move(rp);
       });
@@ -390,13 +399,8 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
           return client.consumer_fetch(group_id, name, timeout, max_bytes)
             .then([res_fmt, rp{std::move(rp)}](auto res) mutable {
-                ::json::chunked_buffer buf;
-                ::json::iobuf_writer<::json::chunked_buffer> w(buf);
-
-                ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-
                 rp.rep->write_body(
-                  "json", json::as_body_writer(std::move(buf).as_iobuf()));
+                  "json", fetch_body_writer(res_fmt, std::move(res)));
                 rp.mime_type = res_fmt;
                 return std::move(rp);
             });
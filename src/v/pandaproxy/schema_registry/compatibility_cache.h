@@ -0,0 +1,196 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "hashing/xx.h"
+#include "pandaproxy/schema_registry/types.h"
+
+#include <seastar/core/future.hh>
+
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index/tag.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <optional>
+#include <tuple>
+
+namespace pandaproxy::schema_registry {
+
+///\brief Cache the work of compatibility checks.
+///
+/// Checking a new schema against the versions of a subject parses every
+/// version and compares it with the new schema. Clients commonly retry a
+/// registration or check the same schema before registering it, and
+/// transitive levels check every version each time, so both the parsed
+/// versions and the result of each pairwise check are remembered.
+///
+/// Entries are keyed by the id of the stored schema, which must be
+/// invalidated if the definition of the id changes. The cache holds parsed
+/// schemas so it must only be used on the shard that it was created on.
+class compatibility_cache {
+public:
+    ///\brief The fingerprint of a definition that hasn't been stored yet.
+    struct fingerprint {
+        uint64_t hash;
+        size_t size;
+        schema_type type;
+
+        explicit fingerprint(const canonical_schema_definition& def) {
+            incremental_xxhash64 h;
+            for (const auto& frag : def.raw()()) {
+                h.update(frag.get(), frag.size());
+            }
+            for (const auto& ref : def.refs()) {
+                h.update_all(ref.name.size(), ref.sub().size());
+                h.update(ref.name);
+                h.update(ref.sub());
+                h.update(ref.version());
+            }
+            hash = h.digest();
+            size = def.raw()().size_bytes();
+            type = def.type();
+        }
+
+        auto view() const { return std::tie(hash, size, type); }
+        friend bool operator==(const fingerprint& l, const fingerprint& r) {
+            return l.view() == r.view();
+        }
+    };
+
+    ///\brief The direction of a check between a stored schema and a new one.
+    enum class reader { stored, proposed };
+
+    explicit compatibility_cache(size_t capacity)
+      : _capacity{capacity} {}
+
+    ss::future<> stop() { return ss::now(); }
+
+    std::optional<valid_schema> get_valid_schema(schema_id id) {
+        auto& map = _schemas.get<underlying_map>();
+        auto it = map.find(id);
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        auto& list = _schemas.get<underlying_list>();
+        list.relocate(list.begin(), _schemas.project<underlying_list>(it));
+        return it->schema;
+    }
+
+    void put_valid_schema(schema_id id, valid_schema schema) {
+        auto& list = _schemas.get<underlying_list>();
+        auto [it, inserted] = list.emplace_front(
+          schema_entry{.id = id, .schema = std::move(schema)});
+        if (inserted && list.size() > _capacity) {
+            list.pop_back();
+        }
+    }
+
+    std::optional<bool>
+    get_compatible(schema_id id, reader r, const fingerprint& proposed) {
+        auto& map = _results.get<underlying_map>();
+        auto it = map.find(result_key{id, r, proposed});
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        auto& list = _results.get<underlying_list>();
+        list.relocate(list.begin(), _results.project<underlying_list>(it));
+        return it->compatible;
+    }
+
+    void put_compatible(
+      schema_id id, reader r, const fingerprint& proposed, bool compatible) {
+        auto& list = _results.get<underlying_list>();
+        auto [it, inserted] = list.emplace_front(result_entry{
+          .key = result_key{id, r, proposed}, .compatible = compatible});
+        if (inserted && list.size() > _capacity) {
+            list.pop_back();
+        }
+    }
+
+    ///\brief Drop everything, for when a schema that may be referenced by
+    /// others is removed.
+    void clear() {
+        _schemas.clear();
+        _results.clear();
+    }
+
+    ///\brief Drop everything that was derived from the schema with `id`.
+    void invalidate(schema_id id) {
+        _schemas.get<underlying_map>().erase(id);
+        auto& results = _results.get<underlying_map>();
+        auto [b, e] = results.equal_range(id, result_key::id_less{});
+        results.erase(b, e);
+    }
+
+private:
+    struct underlying_list {};
+    struct underlying_map {};
+
+    struct schema_entry {
+        schema_id id;
+        valid_schema schema;
+    };
+
+    struct result_key {
+        schema_id id;
+        reader r;
+        fingerprint proposed;
+
+        auto view() const {
+            return std::tuple_cat(std::tie(id, r), proposed.view());
+        }
+
+        friend bool operator<(const result_key& l, const result_key& r) {
+            return l.view() < r.view();
+        }
+
+        struct id_less {
+            bool operator()(const result_key& l, schema_id r) const {
+                return l.id < r;
+            }
+            bool operator()(schema_id l, const result_key& r) const {
+                return l < r.id;
+            }
+        };
+    };
+
+    struct result_entry {
+        result_key key;
+        bool compatible;
+    };
+
+    using schemas_t = boost::multi_index::multi_index_container<
+      schema_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<schema_entry, schema_id, &schema_entry::id>>>>;
+
+    using results_t = boost::multi_index::multi_index_container<
+      result_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<result_entry, result_key, &result_entry::key>>>>;
+
+    size_t _capacity;
+    schemas_t _schemas;
+    results_t _results;
+};
+
+} // namespace pandaproxy::schema_registry
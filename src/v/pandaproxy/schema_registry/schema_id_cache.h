@@ -24,6 +24,8 @@
 #include <boost/multi_index_container.hpp>
 
 #include <iterator>
+#include <optional>
+#include <tuple>
 #include <utility>
 
 namespace pandaproxy::schema_registry {
@@ -69,11 +71,72 @@ public:
         }
     }
 
+    ///\brief Identifies a batch from an idempotent producer, along with the
+    /// validation settings of its topic.
+    ///
+    /// Producers resend a batch verbatim when they don't see a response, so a
+    /// batch that has already been found to be valid doesn't need to have
+    /// each of its records validated again.
+    struct batch_key {
+        model::topic topic;
+        int64_t producer_id;
+        int16_t producer_epoch;
+        int32_t base_sequence;
+        int32_t last_offset_delta;
+        int32_t crc;
+        // std::nullopt when the field isn't validated.
+        std::optional<subject_name_strategy> key_sns;
+        std::optional<subject_name_strategy> val_sns;
+
+        auto view() const {
+            return std::tie(
+              topic,
+              producer_id,
+              producer_epoch,
+              base_sequence,
+              last_offset_delta,
+              crc,
+              key_sns,
+              val_sns);
+        }
+
+        friend bool operator<(const batch_key& lhs, const batch_key& rhs) {
+            return lhs.view() < rhs.view();
+        }
+    };
+
+    bool has_valid_batch(const batch_key& key) {
+        auto& map = _batches.get<underlying_map>();
+        auto it = map.find(key);
+        bool has = it != map.end();
+        if (has) {
+            auto& list = _batches.get<underlying_list>();
+            list.relocate(list.begin(), _batches.project<underlying_list>(it));
+        }
+        return has;
+    }
+
+    void put_valid_batch(batch_key key) {
+        auto& list = _batches.get<underlying_list>();
+        auto [it, i] = list.emplace_front(std::move(key));
+        if (i) {
+            shrink_to_capacity();
+        }
+    }
+
     size_t invalidate(model::topic_view topic) {
         auto& map = _cache.get<underlying_map>();
         auto [b, e] = map.equal_range(topic, entry::topic_less{});
         auto count = std::distance(b, e);
         map.erase(b, e);
+        auto& batches = _batches.get<underlying_list>();
+        for (auto it = batches.begin(); it != batches.end();) {
+            if (model::topic_view(it->topic) == topic) {
+                it = batches.erase(it);
+            } else {
+                ++it;
+            }
+        }
         return count;
     }
 
@@ -84,6 +147,10 @@ private:
         if (list.size() > _capacity()) {
             list.resize(_capacity());
         }
+        auto& batches = _batches.get<underlying_list>();
+        if (batches.size() > _capacity()) {
+            batches.resize(_capacity());
+        }
     }
 
     struct entry {
@@ -153,7 +220,16 @@ private:
           boost::multi_index::identity<entry>,
           entry::less>>>;
 
+    using batches_t = boost::multi_index::multi_index_container<
+      batch_key,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::identity<batch_key>>>>;
+
     underlying_t _cache;
+    batches_t _batches;
     config::binding<size_t> _capacity;
 };
 
@@ -17,6 +17,7 @@
 #include "hashing/xx.h"
 #include "pandaproxy/logger.h"
 #include "pandaproxy/schema_registry/avro.h"
+#include "pandaproxy/schema_registry/compatibility_cache.h"
 #include "pandaproxy/schema_registry/error.h"
 #include "pandaproxy/schema_registry/errors.h"
 #include "pandaproxy/schema_registry/exceptions.h"
@@ -60,6 +61,9 @@ bool check_compatible(const valid_schema& reader, const valid_schema& writer) {
     });
 }
 
+// The number of parsed schemas and of compatibility results kept per shard
+constexpr size_t compatibility_cache_capacity = 1000;
+
 constexpr auto set_accumulator =
   [](store::schema_id_set acc, store::schema_id_set refs) {
       acc.insert(refs.begin(), refs.end());
@@ -70,10 +74,16 @@ constexpr auto set_accumulator =
 
 ss::future<> sharded_store::start(is_mutable mut, ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start(mut);
+    co_await _store.start(mut);
+    co_await _replica.start();
+    co_await _compat_cache.start(compatibility_cache_capacity);
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _compat_cache.stop();
+    co_await _replica.stop();
+    co_await _store.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema, normalize norm) {
@@ -266,15 +276,18 @@ ss::future<bool> sharded_store::upsert(
 }
 
 ss::future<bool> sharded_store::has_schema(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).has_value();
-      });
+    co_return _replica.local().get(id).has_value();
 }
 
 ss::future<> sharded_store::delete_schema(schema_id id) {
-    return _store.invoke_on(
+    co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id](store& s) { s.delete_schema(id); });
+    co_await _replica.invoke_on_all(
+      _smp_opts, [id](schema_replica& r) { r.erase(id); });
+    // Other schemas may have been parsed or checked against this one through
+    // their references.
+    co_await _compat_cache.invoke_on_all(
+      _smp_opts, [](compatibility_cache& c) { c.clear(); });
 }
 
 ss::future<subject_schema>
@@ -312,10 +325,11 @@ sharded_store::has_schema(canonical_schema schema, include_deleted inc_del) {
 
 ss::future<canonical_schema_definition>
 sharded_store::get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = _replica.local().get(id);
+    if (!def.has_value()) {
+        throw as_exception(not_found(id));
+    }
+    co_return std::move(def).value();
 }
 
 ss::future<chunked_vector<subject_version>>
@@ -354,10 +368,7 @@ ss::future<subject_schema> sharded_store::get_subject_schema(
           return s.get_subject_version_id(sub, version, inc_del).value();
       });
 
-    auto def = co_await _store.invoke_on(
-      shard_for(v_id.id), _smp_opts, [id{v_id.id}](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = co_await get_schema_definition(v_id.id);
 
     co_return subject_schema{
       .schema = {sub, std::move(def)},
@@ -623,6 +634,13 @@ sharded_store::clear_compatibility(seq_marker marker, subject sub) {
 ss::future<bool>
 sharded_store::upsert_schema(schema_id id, canonical_schema_definition def) {
     co_await maybe_update_max_schema_id(id);
+    // Each shard takes its own copy, so that the definition is never freed on
+    // another shard.
+    co_await _replica.invoke_on_all(
+      _smp_opts,
+      [id, &def](schema_replica& r) { r.upsert(id, def.copy()); });
+    co_await _compat_cache.invoke_on_all(
+      _smp_opts, [id](compatibility_cache& c) { c.invalidate(id); });
     co_return co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id, def{std::move(def)}](store& s) mutable {
           return s.upsert_schema(id, std::move(def));
@@ -740,7 +758,19 @@ ss::future<bool> sharded_store::is_compatible(
         ver_it = versions.begin();
     }
 
-    auto new_valid = co_await make_valid_schema(std::move(new_schema));
+    const bool backward = compat == compatibility_level::backward
+                          || compat == compatibility_level::backward_transitive
+                          || compat == compatibility_level::full
+                          || compat == compatibility_level::full_transitive;
+    const bool forward = compat == compatibility_level::forward
+                         || compat == compatibility_level::forward_transitive
+                         || compat == compatibility_level::full
+                         || compat == compatibility_level::full_transitive;
+
+    using reader = compatibility_cache::reader;
+    const compatibility_cache::fingerprint proposed{new_schema.def()};
+    // Only parsed if there's a check that hasn't been cached
+    std::optional<valid_schema> new_valid;
 
     auto is_compat = true;
     for (; is_compat && ver_it != versions.end(); ++ver_it) {
@@ -748,29 +778,47 @@ ss::future<bool> sharded_store::is_compatible(
             continue;
         }
 
-        auto old_schema = co_await get_subject_schema(
-          sub, ver_it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(
-          std::move(old_schema.schema));
-
-        if (
-          compat == compatibility_level::backward
-          || compat == compatibility_level::backward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(new_valid, old_valid);
-        }
-        if (
-          compat == compatibility_level::forward
-          || compat == compatibility_level::forward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(old_valid, new_valid);
+        for (auto r : {reader::proposed, reader::stored}) {
+            if (
+              !is_compat || (r == reader::proposed && !backward)
+              || (r == reader::stored && !forward)) {
+                continue;
+            }
+            auto cached = _compat_cache.local().get_compatible(
+              ver_it->id, r, proposed);
+            if (cached.has_value()) {
+                is_compat = *cached;
+                continue;
+            }
+
+            if (!new_valid.has_value()) {
+                new_valid.emplace(
+                  co_await make_valid_schema(new_schema.share()));
+            }
+            auto old_valid = co_await get_valid_schema(
+              sub, ver_it->version, ver_it->id);
+            is_compat = r == reader::proposed
+                          ? check_compatible(*new_valid, old_valid)
+                          : check_compatible(old_valid, *new_valid);
+            _compat_cache.local().put_compatible(
+              ver_it->id, r, proposed, is_compat);
         }
     }
     co_return is_compat;
 }
 
+ss::future<valid_schema> sharded_store::get_valid_schema(
+  const subject& sub, schema_version version, schema_id id) {
+    if (auto cached = _compat_cache.local().get_valid_schema(id); cached) {
+        co_return std::move(cached).value();
+    }
+    auto schema = co_await get_subject_schema(
+      sub, version, include_deleted::no);
+    auto valid = co_await make_valid_schema(std::move(schema.schema));
+    _compat_cache.local().put_valid_schema(id, valid);
+    co_return valid;
+}
+
 void sharded_store::check_mode_mutability(force f) const {
     _store.local().check_mode_mutability(f).value();
 }
@@ -12,14 +12,46 @@
 #pragma once
 
 #include "container/fragmented_vector.h"
+#include "pandaproxy/schema_registry/compatibility_cache.h"
 #include "pandaproxy/schema_registry/types.h"
 
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/btree_map.h>
+
+#include <optional>
+
 namespace pandaproxy::schema_registry {
 
 class store;
 
+///\brief A copy of every schema definition, kept on each shard.
+///
+/// Serializers fetch schemas by id far more often than they're written, so
+/// lookups by id are served from the local shard rather than from the shard
+/// that owns the id. Writes are applied to every shard before they complete.
+class schema_replica {
+public:
+    std::optional<canonical_schema_definition> get(schema_id id) const {
+        auto it = _schemas.find(id);
+        if (it == _schemas.end()) {
+            return std::nullopt;
+        }
+        return it->second.share();
+    }
+
+    void upsert(schema_id id, canonical_schema_definition def) {
+        _schemas.insert_or_assign(id, std::move(def));
+    }
+
+    void erase(schema_id id) { _schemas.erase(id); }
+
+    ss::future<> stop() { return ss::now(); }
+
+private:
+    absl::btree_map<schema_id, canonical_schema_definition> _schemas;
+};
+
 ///\brief Dispatch requests to shards based on a a hash of the
 /// subject or schema_id
 class sharded_store {
@@ -205,8 +237,15 @@ private:
 
     ss::future<schema_id> project_schema_id();
 
+    ///\brief Parse the schema of a subject version, or reuse the parse from an
+    /// earlier compatibility check.
+    ss::future<valid_schema>
+    get_valid_schema(const subject& sub, schema_version version, schema_id id);
+
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<schema_replica> _replica;
+    ss::sharded<compatibility_cache> _compat_cache;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
@@ -0,0 +1,83 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/schema_registry/compatibility_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace pps = pandaproxy::schema_registry;
+
+using reader = pps::compatibility_cache::reader;
+using fingerprint = pps::compatibility_cache::fingerprint;
+
+const pps::canonical_schema_definition def1{
+  R"({"type":"string"})", pps::schema_type::avro};
+const pps::canonical_schema_definition def2{
+  R"({"type":"int"})", pps::schema_type::avro};
+const pps::canonical_schema_definition def1_json{
+  R"({"type":"string"})", pps::schema_type::json};
+const pps::canonical_schema_definition def1_ref{
+  R"({"type":"string"})",
+  pps::schema_type::avro,
+  {{"name", pps::subject{"sub"}, pps::schema_version{1}}}};
+
+const pps::schema_id s_id1{1};
+const pps::schema_id s_id2{2};
+const pps::schema_id s_id3{3};
+
+BOOST_AUTO_TEST_CASE(test_compatibility_cache_fingerprint) {
+    BOOST_REQUIRE(fingerprint{def1} == fingerprint{def1.share()});
+    BOOST_REQUIRE(!(fingerprint{def1} == fingerprint{def2}));
+    BOOST_REQUIRE(!(fingerprint{def1} == fingerprint{def1_json}));
+    BOOST_REQUIRE(!(fingerprint{def1} == fingerprint{def1_ref}));
+}
+
+BOOST_AUTO_TEST_CASE(test_compatibility_cache_results) {
+    pps::compatibility_cache c{2};
+    const fingerprint f1{def1};
+    const fingerprint f2{def2};
+
+    c.put_compatible(s_id1, reader::proposed, f1, true);
+    c.put_compatible(s_id1, reader::stored, f1, false);
+
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::proposed, f1) == true);
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::stored, f1) == false);
+    BOOST_REQUIRE(!c.get_compatible(s_id1, reader::proposed, f2).has_value());
+    BOOST_REQUIRE(!c.get_compatible(s_id2, reader::proposed, f1).has_value());
+
+    // Should evict the least recently used result
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::proposed, f1).has_value());
+    c.put_compatible(s_id2, reader::proposed, f1, true);
+    BOOST_REQUIRE(!c.get_compatible(s_id1, reader::stored, f1).has_value());
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::proposed, f1).has_value());
+    BOOST_REQUIRE(c.get_compatible(s_id2, reader::proposed, f1).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(test_compatibility_cache_invalidate) {
+    pps::compatibility_cache c{16};
+    const fingerprint f1{def1};
+    const fingerprint f2{def2};
+
+    for (auto id : {s_id1, s_id2, s_id3}) {
+        c.put_compatible(id, reader::proposed, f1, true);
+        c.put_compatible(id, reader::stored, f2, true);
+    }
+
+    c.invalidate(s_id2);
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::proposed, f1).has_value());
+    BOOST_REQUIRE(c.get_compatible(s_id1, reader::stored, f2).has_value());
+    BOOST_REQUIRE(!c.get_compatible(s_id2, reader::proposed, f1).has_value());
+    BOOST_REQUIRE(!c.get_compatible(s_id2, reader::stored, f2).has_value());
+    BOOST_REQUIRE(c.get_compatible(s_id3, reader::proposed, f1).has_value());
+    BOOST_REQUIRE(c.get_compatible(s_id3, reader::stored, f2).has_value());
+
+    c.clear();
+    BOOST_REQUIRE(!c.get_compatible(s_id1, reader::proposed, f1).has_value());
+    BOOST_REQUIRE(!c.get_compatible(s_id3, reader::stored, f2).has_value());
+}
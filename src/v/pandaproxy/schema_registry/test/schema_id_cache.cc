@@ -112,3 +112,41 @@ BOOST_AUTO_TEST_CASE(test_schema_id_cache_invalidate) {
     BOOST_REQUIRE(c.has(tp3, key, record_name, s_id2, {}));
     BOOST_REQUIRE(c.has(tp3, key, topic_record_name, s_id3, {}));
 }
+
+BOOST_AUTO_TEST_CASE(test_schema_id_cache_valid_batches) {
+    pps::schema_id_cache c{config::mock_binding(size_t(2))};
+
+    auto make_key = [](model::topic_view tp, int32_t seq) {
+        return pps::schema_id_cache::batch_key{
+          .topic = model::topic{tp},
+          .producer_id = 1,
+          .producer_epoch = 0,
+          .base_sequence = seq,
+          .last_offset_delta = 9,
+          .crc = 42,
+          .key_sns = std::nullopt,
+          .val_sns = topic_name};
+    };
+
+    c.put_valid_batch(make_key(tp1, 0));
+    c.put_valid_batch(make_key(tp2, 0));
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp1, 0)));
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp2, 0)));
+
+    // Different validation settings
+    auto k = make_key(tp1, 0);
+    k.val_sns = record_name;
+    BOOST_REQUIRE(!c.has_valid_batch(k));
+
+    // Should evict tp1, tp2 was used most recently
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp2, 0)));
+    c.put_valid_batch(make_key(tp3, 0));
+    BOOST_REQUIRE(!c.has_valid_batch(make_key(tp1, 0)));
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp2, 0)));
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp3, 0)));
+
+    // Invalidation drops the batches of the topic
+    BOOST_REQUIRE_EQUAL(c.invalidate(tp2), 0);
+    BOOST_REQUIRE(!c.has_valid_batch(make_key(tp2, 0)));
+    BOOST_REQUIRE(c.has_valid_batch(make_key(tp3, 0)));
+}
@@ -131,3 +131,44 @@ SEASTAR_THREAD_TEST_CASE(test_sharded_store_find_unordered) {
     BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{1});
     BOOST_REQUIRE_EQUAL(res.version, ver1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_schema_replica) {
+    pps::sharded_store store;
+    store.start(pps::is_mutable::yes, ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::schema_version ver1{1};
+    const pps::schema_id id{1};
+    const pps::subject sub{"simple.proto"};
+
+    store
+      .upsert(
+        pps::seq_marker{
+          std::nullopt, std::nullopt, ver1, pps::seq_marker_key_type::schema},
+        pps::canonical_schema{sub, simple.share()},
+        id,
+        ver1,
+        pps::is_deleted::no)
+      .get();
+
+    // Every shard serves the schema from its own replica
+    ss::smp::invoke_on_all([&store, id]() {
+        return store.get_schema_definition(id).then(
+          [](pps::canonical_schema_definition def) {
+              BOOST_REQUIRE(def == simple);
+          });
+    }).get();
+
+    store.delete_subject_version(sub, ver1, pps::force::yes).get();
+
+    ss::smp::invoke_on_all([&store, id]() {
+        return store.has_schema(id).then(
+          [](bool has) { BOOST_REQUIRE(!has); });
+    }).get();
+    BOOST_REQUIRE_EXCEPTION(
+      store.get_schema_definition(id).get(),
+      pps::exception,
+      [](const pps::exception& e) {
+          return e.code() == pps::error_code::schema_id_not_found;
+      });
+}
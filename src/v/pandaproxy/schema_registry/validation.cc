@@ -35,12 +35,16 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 #include <iterator>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 
 namespace pandaproxy::schema_registry {
@@ -73,7 +77,7 @@ auto make_subject(
     }
 };
 
-std::vector<int32_t> get_proto_offsets(iobuf_parser& p) {
+std::vector<int32_t> get_proto_offsets(iobuf_parser_base& p) {
     // The encoding is a length, followed by indexes into the file or message.
     // Each number is a zigzag encoded integer.
     std::vector<int32_t> offsets;
@@ -135,6 +139,17 @@ ss::future<std::optional<ss::sstring>> get_record_name(
     co_return std::nullopt;
 }
 
+// The verdicts for the schemas that have been validated in a batch, so that
+// each schema is only validated once per batch rather than once per record.
+struct batch_verdicts {
+    // Schemas that aren't protobuf only depend on their id.
+    absl::flat_hash_map<std::pair<field, schema_id>, bool> by_id;
+    // Protobuf schemas also depend on the message offsets.
+    absl::flat_hash_set<schema_id> protobuf_ids;
+    using offsets_key = std::tuple<field, schema_id, std::vector<int32_t>>;
+    absl::flat_hash_map<offsets_key, bool> by_offsets;
+};
+
 template<typename T>
 T combine(
   pandaproxy::schema_registry::schema_id_validation_mode mode,
@@ -188,9 +203,12 @@ public:
           subject_name_strategy::topic_name)} {}
 
     auto validate_field(
-      field field, model::topic topic, subject_name_strategy sns, iobuf buf)
-      -> ss::future<bool> {
-        iobuf_parser parser(std::move(buf));
+      field field,
+      const model::topic& topic,
+      subject_name_strategy sns,
+      const iobuf& buf,
+      batch_verdicts& verdicts) -> ss::future<bool> {
+        iobuf_const_parser parser(buf);
 
         if (parser.bytes_left() < 5) {
             vlog(
@@ -215,6 +233,53 @@ public:
 
         auto id = schema_id{parser.consume_be_type<int32_t>()};
 
+        // Records in a batch tend to share a few schemas, so reuse the verdict
+        // for any schema that has already been validated in this batch.
+        if (!verdicts.protobuf_ids.contains(id)) {
+            auto it = verdicts.by_id.find({field, id});
+            if (it != verdicts.by_id.end()) {
+                co_return it->second;
+            }
+        } else {
+            iobuf_const_parser offsets_parser(buf);
+            offsets_parser.skip(parser.bytes_consumed());
+            auto it = verdicts.by_offsets.find(
+              {field, id, get_proto_offsets(offsets_parser)});
+            if (it != verdicts.by_offsets.end()) {
+                co_return it->second;
+            }
+        }
+
+        auto verdict = co_await do_validate_field(
+          field, topic, sns, id, parser);
+        if (!verdict.is_protobuf) {
+            verdicts.by_id.emplace(std::make_pair(field, id), verdict.valid);
+        } else {
+            verdicts.protobuf_ids.insert(id);
+            if (verdict.proto_offsets) {
+                verdicts.by_offsets.emplace(
+                  std::make_tuple(
+                    field, id, std::move(*verdict.proto_offsets)),
+                  verdict.valid);
+            }
+        }
+        co_return verdict.valid;
+    }
+
+    struct field_verdict {
+        bool valid;
+        bool is_protobuf{false};
+        std::optional<std::vector<int32_t>> proto_offsets;
+    };
+
+    // Validate a field whose schema id hasn't been seen in this batch yet,
+    // `parser` is positioned just after the schema id.
+    auto do_validate_field(
+      field field,
+      const model::topic& topic,
+      subject_name_strategy sns,
+      schema_id id,
+      iobuf_parser_base& parser) -> ss::future<field_verdict> {
         // Optimistically check the cache in case just the id matches
         // This is true for Avro with TopicNameStrategy
         if (_api->_schema_id_cache.local().has(
@@ -225,7 +290,7 @@ public:
               topic(),
               to_string_view(field));
             _api->_schema_id_validation_probe.local().hit();
-            co_return true;
+            co_return field_verdict{.valid = true};
         }
 
         // Determine the schema type
@@ -239,7 +304,7 @@ public:
               topic(),
               to_string_view(field),
               ex.message());
-            co_return false;
+            co_return field_verdict{.valid = false};
         }
 
         std::optional<std::vector<int32_t>> proto_offsets;
@@ -251,7 +316,7 @@ public:
                   "validating: topic: {}, field: {}, invalid protobuf offsets",
                   topic(),
                   to_string_view(field));
-                co_return false;
+                co_return field_verdict{.valid = false, .is_protobuf = true};
             }
 
             if (_api->_schema_id_cache.local().has(
@@ -262,7 +327,10 @@ public:
                   topic(),
                   to_string_view(field));
                 _api->_schema_id_validation_probe.local().hit();
-                co_return true;
+                co_return field_verdict{
+                  .valid = true,
+                  .is_protobuf = true,
+                  .proto_offsets = std::move(offsets)};
             }
 
             proto_offsets.emplace(std::move(offsets));
@@ -276,7 +344,10 @@ public:
               "validating: topic: {}, field: {}, unable to extract record_name",
               topic(),
               to_string_view(field));
-            co_return false;
+            co_return field_verdict{
+              .valid = false,
+              .is_protobuf = proto_offsets.has_value(),
+              .proto_offsets = std::move(proto_offsets)};
         }
 
         auto sub = make_subject(sns, topic, field, *record_name);
@@ -290,14 +361,20 @@ public:
               sub,
               id,
               has_id);
-            co_return false;
+            co_return field_verdict{
+              .valid = false,
+              .is_protobuf = proto_offsets.has_value(),
+              .proto_offsets = std::move(proto_offsets)};
         }
 
         _api->_schema_id_cache.local().put(
-          topic, field, sns, id, std::move(proto_offsets));
+          topic, field, sns, id, proto_offsets);
         _api->_schema_id_validation_probe.local().miss();
-        co_return true;
-    };
+        co_return field_verdict{
+          .valid = true,
+          .is_protobuf = proto_offsets.has_value(),
+          .proto_offsets = std::move(proto_offsets)};
+    }
 
     ss::future<bool> validate(const model::record_batch& batch) {
         if (
@@ -306,29 +383,30 @@ public:
             co_return true;
         }
 
-        auto key_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_key_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::key,
-              _topic,
-              _record_key_subject_name_strategy,
-              record.key().copy());
-        };
-
-        auto value_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_value_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
+        const auto& header = batch.header();
+        std::optional<schema_id_cache::batch_key> batch_key;
+        if (header.producer_id >= 0) {
+            batch_key.emplace(schema_id_cache::batch_key{
+              .topic = _topic,
+              .producer_id = header.producer_id,
+              .producer_epoch = header.producer_epoch,
+              .base_sequence = header.base_sequence,
+              .last_offset_delta = header.last_offset_delta,
+              .crc = header.crc,
+              .key_sns = _record_key_schema_id_validation
+                           ? std::make_optional(
+                             _record_key_subject_name_strategy)
+                           : std::nullopt,
+              .val_sns = _record_value_schema_id_validation
+                           ? std::make_optional(
+                             _record_value_subject_name_strategy)
+                           : std::nullopt,
+            });
+            if (_api->_schema_id_cache.local().has_valid_batch(*batch_key)) {
+                _api->_schema_id_validation_probe.local().hit();
+                co_return true;
             }
-            return validate_field(
-              field::val,
-              _topic,
-              _record_value_subject_name_strategy,
-              record.value().copy());
-        };
+        }
 
         const model::record_batch& b = batch;
         std::optional<const model::record_batch> u;
@@ -339,18 +417,37 @@ public:
             _api->_schema_id_validation_probe.local().decompressed();
         }
 
-        bool valid{true};
-        co_await model::for_each_record(
-          compressed ? u.value() : b,
-          [&valid, k{std::move(key_is_valid)}, v{std::move(value_is_valid)}](
-            const model::record& r) {
-              return k(r)
-                .then([&r, v{std::move(v)}](bool k) {
-                    return k ? v(r) : ss::make_ready_future<bool>(false);
-                })
-                .then([&valid](bool v) { valid = v; });
-          });
-        co_return valid;
+        batch_verdicts verdicts;
+        auto it = model::record_batch_iterator::create(compressed ? *u : b);
+        while (it.has_next()) {
+            auto r = it.next();
+            co_await ss::coroutine::maybe_yield();
+            if (
+              _record_key_schema_id_validation
+              && !co_await validate_field(
+                field::key,
+                _topic,
+                _record_key_subject_name_strategy,
+                r.key(),
+                verdicts)) {
+                co_return false;
+            }
+            if (
+              _record_value_schema_id_validation
+              && !co_await validate_field(
+                field::val,
+                _topic,
+                _record_value_subject_name_strategy,
+                r.value(),
+                verdicts)) {
+                co_return false;
+            }
+        }
+        if (batch_key) {
+            _api->_schema_id_cache.local().put_valid_batch(
+              *std::move(batch_key));
+        }
+        co_return true;
     }
 
     ss::future<bool> validate(const data_t& data) {
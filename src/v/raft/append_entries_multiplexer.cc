@@ -0,0 +1,203 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/append_entries_multiplexer.h"
+
+#include "raft/errc.h"
+#include "raft/logger.h"
+#include "raft/raftgen_service.h"
+#include "rpc/connection_cache.h"
+#include "serde/async.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/when_all.hh>
+
+#include <vector>
+
+namespace raft {
+
+append_entries_multiplexer::append_entries_multiplexer(
+  model::node_id self,
+  ss::sharded<rpc::connection_cache>& cache,
+  features::feature_table& features,
+  config::binding<size_t> max_bytes)
+  : _self(self)
+  , _connection_cache(cache)
+  , _features(features)
+  , _max_bytes(std::move(max_bytes)) {}
+
+bool append_entries_multiplexer::enabled() const {
+    return _max_bytes() > 0 && !_gate.is_closed()
+           && _features.is_active(features::feature::raft_append_entries_batch);
+}
+
+ss::future<result<append_entries_reply>>
+append_entries_multiplexer::append_entries(
+  model::node_id n, append_entries_request&& r, rpc::client_opts opts) {
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<result<append_entries_reply>>(
+          make_error_code(errc::append_entries_dispatch_error));
+    }
+    auto& q = _queues[n];
+    pending_request p{.opts = std::move(opts)};
+    auto f = p.reply.get_future();
+    // chained so that requests are queued in the order they were made, no
+    // matter how long encoding each of them takes
+    q.encoded = q.encoded.then_wrapped(
+      [this,
+       n,
+       &q,
+       r = std::move(r),
+       p = std::move(p),
+       holder = _gate.hold()](ss::future<> prev) mutable {
+          prev.ignore_ready_future();
+          return enqueue(n, q, std::move(r), std::move(p));
+      });
+    return f;
+}
+
+ss::future<> append_entries_multiplexer::enqueue(
+  model::node_id n,
+  node_queue& q,
+  append_entries_request r,
+  pending_request p) {
+    try {
+        co_await serde::write_async(
+          p.encoded, append_entries_request_serde_wrapper(std::move(r)));
+    } catch (...) {
+        vlog(
+          raftlog.warn,
+          "Error while encoding append entries request to {}: {}",
+          n,
+          std::current_exception());
+        p.reply.set_value(
+          make_error_code(errc::append_entries_dispatch_error));
+        co_return;
+    }
+    q.requests.push_back(std::move(p));
+    schedule_dispatch(n, q);
+}
+
+void append_entries_multiplexer::schedule_dispatch(
+  model::node_id n, node_queue& q) {
+    if (q.dispatch_scheduled) {
+        return;
+    }
+    q.dispatch_scheduled = true;
+    ssx::spawn_with_gate(_gate, [this, n, &q] {
+        // let the requests of tasks that are ready to run join the batch
+        return ss::yield().then([this, n, &q] {
+            q.dispatch_scheduled = false;
+            return dispatch(n, q);
+        });
+    });
+}
+
+ss::future<> append_entries_multiplexer::dispatch(
+  model::node_id n, node_queue& q) {
+    const auto max_bytes = _max_bytes();
+    std::vector<ss::future<>> sent;
+    while (!q.requests.empty()) {
+        ss::chunked_fifo<pending_request> batch;
+        size_t bytes = 0;
+        while (!q.requests.empty()) {
+            const auto next = q.requests.front().encoded.size_bytes();
+            if (!batch.empty() && bytes + next > max_bytes) {
+                break;
+            }
+            bytes += next;
+            batch.push_back(std::move(q.requests.front()));
+            q.requests.pop_front();
+        }
+        // sends are started in order and run concurrently
+        sent.push_back(send(n, std::move(batch)));
+    }
+    co_await ss::when_all_succeed(sent.begin(), sent.end());
+}
+
+ss::future<> append_entries_multiplexer::send(
+  model::node_id n, ss::chunked_fifo<pending_request> batch) {
+    append_entries_batch_request req;
+    req.requests.reserve(batch.size());
+    auto timeout = batch.front().opts.timeout;
+    // requests to one node share the compression setting, so the batch
+    // inherits the one of its first request
+    const auto compression = batch.front().opts.compression;
+    const auto min_compression_bytes
+      = batch.front().opts.min_compression_bytes;
+    for (auto& p : batch) {
+        req.requests.push_back(std::move(p.encoded));
+        if (p.opts.timeout.timeout_at() < timeout.timeout_at()) {
+            timeout = p.opts.timeout;
+        }
+    }
+
+    result<append_entries_batch_reply> reply{
+      make_error_code(errc::append_entries_dispatch_error)};
+    try {
+        reply = co_await _connection_cache.local()
+                  .with_node_client<raftgen_client_protocol>(
+                    _self,
+                    ss::this_shard_id(),
+                    n,
+                    timeout,
+                    [req = std::move(req),
+                     timeout,
+                     compression,
+                     min_compression_bytes](
+                      raftgen_client_protocol client) mutable {
+                        return client
+                          .append_entries_batch(
+                            std::move(req),
+                            rpc::client_opts(
+                              timeout, compression, min_compression_bytes))
+                          .then(&rpc::get_ctx_data<append_entries_batch_reply>);
+                    });
+    } catch (...) {
+        vlog(
+          raftlog.warn,
+          "Error while sending append entries batch to {}: {}",
+          n,
+          std::current_exception());
+    }
+
+    if (reply && reply.value().replies.size() != batch.size()) {
+        vlog(
+          raftlog.error,
+          "Append entries batch to {} has {} replies, expected {}",
+          n,
+          reply.value().replies.size(),
+          batch.size());
+        reply = make_error_code(errc::append_entries_dispatch_error);
+    }
+    size_t i = 0;
+    for (auto& p : batch) {
+        if (reply) {
+            p.reply.set_value(std::move(reply.value().replies[i++]));
+        } else {
+            p.reply.set_value(reply.error());
+        }
+    }
+}
+
+ss::future<> append_entries_multiplexer::stop() {
+    co_await _gate.close();
+    // requests queued once dispatches could no longer be scheduled
+    for (auto& [n, q] : _queues) {
+        co_await std::move(q.encoded);
+        while (!q.requests.empty()) {
+            q.requests.front().reply.set_value(
+              make_error_code(errc::append_entries_dispatch_error));
+            q.requests.pop_front();
+        }
+    }
+}
+
+} // namespace raft
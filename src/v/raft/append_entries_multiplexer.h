@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/outcome.h"
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "features/feature_table.h"
+#include "model/metadata.h"
+#include "raft/types.h"
+#include "rpc/fwd.h"
+#include "rpc/types.h"
+
+#include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sharded.hh>
+
+#include <absl/container/node_hash_map.h>
+
+namespace raft {
+
+/**
+ * Combines the append_entries requests that the raft groups of a shard send
+ * to the same node into append_entries_batch RPCs.
+ *
+ * Heartbeats are already multiplexed by the heartbeat_manager, but with many
+ * low throughput partitions sharing the same brokers the per request overhead
+ * of replication dominates: most append_entries requests carry a handful of
+ * small batches. Requests made to a node are encoded in the order they were
+ * made and queued, and the queue is dispatched once the tasks that are ready
+ * to run had a chance to add to it, so batching doesn't add timer based
+ * latency. A dispatched RPC carries at most `max_bytes` of encoded requests,
+ * or a single larger one. The follower handles each request of a batch like
+ * a request sent on its own and replies for each of them.
+ *
+ * Owned by the group_manager and used by its rpc_client_protocol, one per
+ * shard.
+ */
+class append_entries_multiplexer {
+public:
+    append_entries_multiplexer(
+      model::node_id self,
+      ss::sharded<rpc::connection_cache>&,
+      features::feature_table&,
+      config::binding<size_t> max_bytes);
+
+    append_entries_multiplexer(const append_entries_multiplexer&) = delete;
+    append_entries_multiplexer& operator=(const append_entries_multiplexer&)
+      = delete;
+    append_entries_multiplexer(append_entries_multiplexer&&) = delete;
+    append_entries_multiplexer& operator=(append_entries_multiplexer&&)
+      = delete;
+    ~append_entries_multiplexer() noexcept = default;
+
+    /// False if requests should be sent individually: batching is disabled
+    /// or not supported by all nodes of the cluster yet.
+    bool enabled() const;
+
+    ss::future<result<append_entries_reply>>
+    append_entries(model::node_id, append_entries_request&&, rpc::client_opts);
+
+    ss::future<> stop();
+
+private:
+    struct pending_request {
+        iobuf encoded;
+        // kept until the request is replied to, holds the caller's units
+        rpc::client_opts opts;
+        ss::promise<result<append_entries_reply>> reply;
+    };
+
+    struct node_queue {
+        ss::chunked_fifo<pending_request> requests;
+        // encoding of the requests made to the node, in order
+        ss::future<> encoded = ss::now();
+        bool dispatch_scheduled{false};
+    };
+
+    ss::future<> enqueue(
+      model::node_id, node_queue&, append_entries_request, pending_request);
+    void schedule_dispatch(model::node_id, node_queue&);
+    ss::future<> dispatch(model::node_id, node_queue&);
+    ss::future<> send(model::node_id, ss::chunked_fifo<pending_request>);
+
+    model::node_id _self;
+    ss::sharded<rpc::connection_cache>& _connection_cache;
+    features::feature_table& _features;
+    config::binding<size_t> _max_bytes;
+    // entries are never erased, the number of nodes is small
+    absl::node_hash_map<model::node_id, node_queue> _queues;
+    ss::gate _gate;
+};
+
+} // namespace raft
@@ -26,6 +26,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/errc.h"
 #include "raft/group_configuration.h"
+#include "raft/heartbeat_manager.h"
 #include "raft/logger.h"
 #include "raft/recovery_stm.h"
 #include "raft/replicate_entries_stm.h"
@@ -36,7 +37,9 @@
 #include "reflection/adl.h"
 #include "rpc/types.h"
 #include "ssx/future-util.h"
+#include "ssx/sformat.h"
 #include "storage/api.h"
+#include "storage/fs_utils.h"
 #include "storage/kvstore.h"
 #include "storage/ntp_config.h"
 #include "storage/snapshot.h"
@@ -48,6 +51,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/metrics.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/util/defer.hh>
 
@@ -84,6 +88,12 @@ struct fmt::formatter<raft::consensus::vote_state> final
 
 namespace raft {
 
+namespace {
+// the leader lease is shorter than the election timeout by this fraction of
+// it
+constexpr int leader_lease_clock_drift_margin = 10;
+} // namespace
+
 std::vector<model::record_batch_type>
 offset_translator_batch_types(const model::ntp& ntp) {
     if (ntp.ns == model::kafka_namespace) {
@@ -124,8 +134,11 @@ consensus::consensus(
   , _fstats(
       _self,
       config::shard_local_cfg()
-        .raft_max_concurrent_append_requests_per_follower())
-  , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
+        .raft_max_concurrent_append_requests_per_follower.bind())
+  , _batcher(
+      this,
+      config::shard_local_cfg().raft_replicate_batch_window_size(),
+      config::shard_local_cfg().raft_replicate_batch_max_flush_delay_ms.bind())
   , _event_manager(this)
   , _probe(std::make_unique<probe>())
   , _ctxlog(group, _log->config().ntp())
@@ -254,7 +267,17 @@ clock_type::time_point consensus::majority_heartbeat() const {
         }
 
         if (auto it = _fstats.find(rni); it != _fstats.end()) {
-            return it->second.last_received_reply_timestamp;
+            const auto& meta = it->second;
+            if (
+              _heartbeat_manager != nullptr
+              && meta.holds_quiescence_lease(
+                clock_type::now(), _heartbeat_manager->quiescence_lease())) {
+                // quiesced followers only reply to node level heartbeats
+                return std::max(
+                  meta.last_received_reply_timestamp,
+                  _heartbeat_manager->last_node_reply(rni.id()));
+            }
+            return meta.last_received_reply_timestamp;
         }
 
         // if we do not know the follower state yet i.e. we have
@@ -263,6 +286,59 @@ clock_type::time_point consensus::majority_heartbeat() const {
     });
 }
 
+bool consensus::use_leader_lease() const {
+    return config::shard_local_cfg().raft_enable_leader_lease()
+           && _features.is_active(features::feature::raft_leader_lease);
+}
+
+void consensus::set_append_entries_compression(rpc::client_opts& opts) const {
+    switch (config::shard_local_cfg().raft_replication_compression()) {
+    case model::compression::zstd:
+        opts.compression = rpc::compression_type::zstd;
+        break;
+    case model::compression::lz4:
+        // older nodes can not decode lz4, fall back to zstd until the whole
+        // cluster is upgraded
+        opts.compression = _features.is_active(
+                             features::feature::rpc_lz4_compression)
+                             ? rpc::compression_type::lz4
+                             : rpc::compression_type::zstd;
+        break;
+    default:
+        opts.compression = rpc::compression_type::none;
+        break;
+    }
+}
+
+clock_type::time_point consensus::leader_lease_expiry() const {
+    if (
+      !is_leader() || _transferring_leadership || _leader_lease_revoked
+      || !use_leader_lease()) {
+        return clock_type::time_point::min();
+    }
+    /**
+     * A follower doesn't vote for another candidate for an election timeout
+     * after it last heard from the leader, so no other leader can be elected
+     * until an election timeout passed since the time a majority of voters
+     * acknowledged requests sent at. A fraction of the timeout is left as a
+     * margin for the clocks of the nodes advancing at different rates.
+     */
+    const auto acked = config().quorum_match([this](vnode rni) {
+        if (rni == _self) {
+            return clock_type::now();
+        }
+        if (auto it = _fstats.find(rni); it != _fstats.end()) {
+            return it->second.lease_ack_sent_at;
+        }
+        return clock_type::time_point::min();
+    });
+    if (acked == clock_type::time_point::min()) {
+        return acked;
+    }
+    const auto timeout = _jit.base_duration();
+    return acked + timeout - timeout / leader_lease_clock_drift_margin;
+}
+
 void consensus::shutdown_input() {
     if (likely(!_as.abort_requested())) {
         _vote_timeout.cancel();
@@ -296,6 +372,7 @@ ss::future<xshard_transfer_state> consensus::stop() {
         co_await _snapshot_writer->close();
         _snapshot_writer.reset();
     }
+    co_await abort_segment_transfer();
     /**
      * Clear metrics after consensus instance is stopped.
      */
@@ -465,10 +542,20 @@ consensus::success_reply consensus::update_follower_index(
     }
 
     if (reply.result == reply_result::success) {
+        // the follower accepted a request sent after the lease probe
+        if (
+          idx.lease_probe_seq != follower_req_seq{}
+          && seq >= idx.lease_probe_seq) {
+            idx.lease_acknowledged(idx.lease_probe_sent_at);
+            idx.lease_probe_seq = follower_req_seq{};
+        }
         successfull_append_entries_reply(idx, std::move(reply));
         return success_reply::yes;
     } else {
         idx.expected_log_end_offset = model::offset{};
+        // requests pipelined behind the rejected one expect the follower log
+        // to contain its entries, stop the ones that were not yet sent
+        idx.last_rejected_sent_seq = idx.last_sent_seq;
     }
 
     if (idx.is_recovering) {
@@ -660,6 +747,19 @@ void consensus::dispatch_recovery(follower_index_metadata& idx) {
 
 ss::future<result<model::offset>> consensus::linearizable_barrier() {
     using ret_t = result<model::offset>;
+    /**
+     * A leader holding a lease knows that no other leader could have
+     * committed entries, its commit index already covers all the entries
+     * acknowledged to clients.
+     */
+    if (leader_lease_expiry() > clock_type::now()) {
+        _probe->linearizable_barrier_lease();
+        vlog(
+          _ctxlog.trace,
+          "Linearizable offset from leader lease: {}",
+          _commit_index);
+        co_return ret_t(_commit_index);
+    }
     ssx::semaphore_units u;
     try {
         u = co_await _op_lock.get_units();
@@ -908,12 +1008,22 @@ ss::future<model::record_batch_reader> consensus::make_reader(
     });
 }
 
+clock_type::time_point consensus::leader_heartbeat() const {
+    if (
+      _quiesced_until > clock_type::now() && _leader_id
+      && _heartbeat_manager != nullptr) {
+        return std::max(
+          _hbeat, _heartbeat_manager->last_node_heartbeat(_leader_id->id()));
+    }
+    return _hbeat;
+}
+
 bool consensus::should_skip_vote(bool ignore_heartbeat) {
     bool skip_vote = false;
 
     if (likely(!ignore_heartbeat)) {
         auto last_election = clock_type::now() - _jit.base_duration();
-        skip_vote |= (_hbeat > last_election); // nothing to do.
+        skip_vote |= (leader_heartbeat() > last_election); // nothing to do.
     }
 
     skip_vote |= _vstate == vote_state::leader; // already a leader
@@ -1750,6 +1860,9 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
         // Look up follower stats for the requester
         if (auto it = _fstats.find(r.node_id); it != _fstats.end()) {
             auto& fstats = it->second;
+            // a follower asking for votes is no longer quiesced (e.g. it was
+            // restarted), make sure it receives heartbeats again
+            fstats.quiesced_seq = follower_req_seq{};
             if (fstats.heartbeats_failed) {
                 vlog(
                   _ctxlog.debug,
@@ -1772,9 +1885,22 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
     // timeout duration When the vote was requested because of leadership
     // transfer grant the vote immediately.
     auto prev_election = clock_type::now() - _jit.base_duration();
+    auto last_leader_heartbeat = leader_heartbeat();
+    if (config::shard_local_cfg().raft_enable_leader_lease()) {
+        // this replica may have acknowledged the leader right before it was
+        // restarted or moved, the leader lease relies on it not granting
+        // votes for an election timeout after that
+        last_leader_heartbeat = std::max(
+          last_leader_heartbeat, _instantiated_at);
+    }
+    // a vote granted in an earlier term doesn't say anything about the
+    // current leader, unless the candidate is that leader
+    const bool voted_for_candidate
+      = r.node_id == _voted_for
+        && (r.term == _term || _leader_id == r.node_id);
     if (
-      _hbeat > prev_election && !r.leadership_transfer
-      && r.node_id != _voted_for) {
+      last_leader_heartbeat > prev_election && !r.leadership_transfer
+      && !voted_for_candidate) {
         vlog(
           _ctxlog.trace,
           "Already heard from the leader, not granting vote to node {}",
@@ -1901,6 +2027,8 @@ consensus::do_append_entries(append_entries_request&& r) {
     reply.result = reply_result::failure;
     reply.may_recover = _follower_recovery_state
                         && _follower_recovery_state->is_active();
+    // a quiescing heartbeat quiesces the follower again once it is handled
+    _quiesced_until = clock_type::time_point::min();
 
     _probe->append_request();
 
@@ -2473,6 +2601,233 @@ ss::future<install_snapshot_reply> consensus::finish_snapshot(
       });
 }
 
+ss::future<transfer_segment_reply>
+consensus::transfer_segment(transfer_segment_request&& r) {
+    return with_gate(_bg, [this, r = std::move(r)]() mutable {
+        return _op_lock
+          .with([this, r = std::move(r)]() mutable {
+              return do_transfer_segment(std::move(r));
+          })
+          .handle_exception_type([this](const ss::broken_semaphore&) {
+              return transfer_segment_reply{.term = _term, .success = false};
+          });
+    });
+}
+
+ss::future<transfer_segment_reply>
+consensus::do_transfer_segment(transfer_segment_request r) {
+    vlog(_ctxlog.trace, "received transfer_segment request: {}", r);
+
+    const auto lstats = _log->offsets();
+    transfer_segment_reply reply{
+      .term = _term,
+      .success = false,
+      .last_dirty_log_index = lstats.dirty_offset,
+      .last_flushed_log_index = _flushed_offset,
+    };
+    reply.target_node_id = r.node_id;
+    reply.node_id = _self;
+
+    if (unlikely(is_request_target_node_invalid("transfer_segment", r))) {
+        co_return reply;
+    }
+
+    if (r.term < _term) {
+        co_return reply;
+    }
+
+    // no need to trigger timeout
+    _hbeat = clock_type::now();
+
+    // request received from new leader
+    do_step_down("transfer_segment_received");
+    if (r.term > _term) {
+        _term = r.term;
+        _voted_for = {};
+        maybe_update_leader(r.source_node());
+        co_return co_await do_transfer_segment(std::move(r));
+    }
+    maybe_update_leader(r.source_node());
+
+    /**
+     * The segment is appended to the log as a whole, the log must end right
+     * before its base offset with the entry the leader has there. Otherwise
+     * the leader replicates batches to truncate or fill the log first.
+     */
+    if (
+      r.base_offset != model::next_offset(lstats.dirty_offset)
+      || r.prev_log_index != lstats.dirty_offset
+      || get_term(r.prev_log_index) != r.prev_log_term) {
+        vlog(
+          _ctxlog.debug,
+          "rejecting transfer of segment with base offset {}, log offsets: {}",
+          r.base_offset,
+          lstats);
+        co_await abort_segment_transfer();
+        co_return reply;
+    }
+
+    // Each file starts with a chunk at offset 0, the index files first and
+    // the data file last
+    if (r.file_offset == 0) {
+        if (
+          !_segment_transfer || r.file == segment_file_type::index
+          || _segment_transfer->base_offset != r.base_offset
+          || _segment_transfer->segment_term != r.segment_term) {
+            co_await abort_segment_transfer();
+            if (r.file != segment_file_type::index) {
+                co_return reply;
+            }
+            _segment_transfer.emplace(segment_transfer{
+              .base_offset = r.base_offset,
+              .segment_term = r.segment_term,
+              .file = r.file,
+            });
+        } else if (
+          _segment_transfer->output || r.file <= _segment_transfer->file) {
+            co_await abort_segment_transfer();
+            co_return reply;
+        }
+
+        storage::segment_full_path path(
+          _log->config(),
+          r.base_offset,
+          r.segment_term,
+          storage::record_version_type::v1);
+        ss::sstring final_path;
+        switch (r.file) {
+        case segment_file_type::index:
+            final_path = path.to_index().string();
+            break;
+        case segment_file_type::compaction_index:
+            final_path = path.to_compacted_index().string();
+            break;
+        case segment_file_type::data:
+            final_path = path.string();
+            break;
+        }
+        auto staged_path = ssx::sformat("{}.staging", final_path);
+        auto f = co_await ss::open_file_dma(
+          staged_path,
+          ss::open_flags::wo | ss::open_flags::create
+            | ss::open_flags::truncate);
+        _segment_transfer->files.emplace_back(
+          std::move(staged_path), std::move(final_path));
+        _segment_transfer->output.emplace(
+          co_await ss::make_file_output_stream(std::move(f)));
+        _segment_transfer->file = r.file;
+        _segment_transfer->bytes_received = 0;
+    }
+
+    if (
+      !_segment_transfer || !_segment_transfer->output
+      || _segment_transfer->base_offset != r.base_offset
+      || _segment_transfer->file != r.file
+      || _segment_transfer->bytes_received != r.file_offset) {
+        // Out of order request? Ignore and answer with success=false.
+        co_return reply;
+    }
+
+    size_t chunk_size = r.chunk.size_bytes();
+    co_await write_iobuf_to_output_stream(
+      std::move(r.chunk), *_segment_transfer->output);
+    _segment_transfer->bytes_received += chunk_size;
+    reply.bytes_stored = _segment_transfer->bytes_received;
+
+    if (!r.done) {
+        reply.success = true;
+        co_return reply;
+    }
+
+    co_await _segment_transfer->output->flush();
+    co_await _segment_transfer->output->close();
+    _segment_transfer->output.reset();
+
+    if (r.file != segment_file_type::data) {
+        reply.success = true;
+        co_return reply;
+    }
+
+    co_return co_await finish_segment_transfer(std::move(r), reply);
+}
+
+ss::future<transfer_segment_reply> consensus::finish_segment_transfer(
+  transfer_segment_request r, transfer_segment_reply reply) {
+    auto transfer = std::exchange(_segment_transfer, std::nullopt);
+    storage::segment_full_path path(
+      _log->config(),
+      transfer->base_offset,
+      transfer->segment_term,
+      storage::record_version_type::v1);
+
+    std::exception_ptr error;
+    try {
+        // index files are renamed first, a data file is never left without
+        // them
+        for (auto& [staged_path, final_path] : transfer->files) {
+            co_await ss::rename_file(staged_path, final_path);
+        }
+        co_await ss::sync_directory(_log->config().work_directory());
+        co_await _log->adopt_segment(path);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    if (error) {
+        vlog(
+          _ctxlog.warn,
+          "unable to adopt transferred segment {} - {}",
+          path,
+          error);
+        for (auto& [staged_path, final_path] : transfer->files) {
+            co_await ss::remove_file(final_path).handle_exception(
+              [](std::exception_ptr) {});
+            co_await ss::remove_file(staged_path).handle_exception(
+              [](std::exception_ptr) {});
+        }
+        reply.bytes_stored = 0;
+        co_return reply;
+    }
+
+    // the segment may contain configuration batches
+    auto st = co_await details::read_bootstrap_state(
+      _log, transfer->base_offset, _as);
+    if (st.config_batches_seen() > 0) {
+        co_await _configuration_manager.add(
+          std::move(st).release_configurations());
+    }
+    update_follower_stats(_configuration_manager.get_latest());
+
+    // transferred files were flushed before they were renamed
+    const auto lstats = _log->offsets();
+    _flushed_offset = lstats.dirty_offset;
+    vlog(
+      _ctxlog.info,
+      "adopted transferred segment {}, log offsets: {}",
+      path,
+      lstats);
+    maybe_update_follower_commit_idx(r.commit_index);
+
+    reply.success = true;
+    reply.last_dirty_log_index = lstats.dirty_offset;
+    reply.last_flushed_log_index = _flushed_offset;
+    co_return reply;
+}
+
+ss::future<> consensus::abort_segment_transfer() {
+    if (!_segment_transfer) {
+        co_return;
+    }
+    auto transfer = std::exchange(_segment_transfer, std::nullopt);
+    if (transfer->output) {
+        co_await transfer->output->close().handle_exception(
+          [](std::exception_ptr) {});
+    }
+    for (auto& [staged_path, _] : transfer->files) {
+        co_await ss::remove_file(staged_path).handle_exception(
+          [](std::exception_ptr) {});
+    }
+}
+
 ss::future<> consensus::write_snapshot(write_snapshot_cfg cfg) {
     auto holder = _bg.hold();
     model::offset last_included_index = cfg.last_included_index;
@@ -2912,6 +3267,22 @@ protocol_metadata consensus::meta() const {
 void consensus::update_node_append_timestamp(vnode id) {
     if (auto it = _fstats.find(id); it != _fstats.end()) {
         it->second.last_sent_append_entries_req_timestamp = clock_type::now();
+        // the append ends quiescence on the follower
+        it->second.quiesced_seq = follower_req_seq{};
+    }
+}
+
+void consensus::heartbeat_acknowledged(
+  vnode id, clock_type::time_point sent_at) {
+    if (auto it = _fstats.find(id); it != _fstats.end()) {
+        it->second.lease_acknowledged(sent_at);
+    }
+}
+
+void consensus::follower_quiesced(vnode id, follower_req_seq seq) {
+    if (auto it = _fstats.find(id); it != _fstats.end()) {
+        it->second.quiesced_seq = seq;
+        it->second.quiesced_at = clock_type::now();
     }
 }
 void consensus::maybe_update_node_reply_timestamp(vnode id) {
@@ -3105,6 +3476,9 @@ consensus::do_maybe_update_leader_commit_idx(ssx::semaphore_units u) {
             maybe_update_last_visible_index(_commit_index);
         }
         maybe_update_last_visible_index(_commit_index);
+        if (_heartbeat_manager) {
+            _heartbeat_manager->commit_index_advanced(_group);
+        }
         return maybe_commit_configuration(std::move(u));
     }
     return ss::now();
@@ -3397,9 +3771,16 @@ consensus::do_transfer_leadership(transfer_leadership_request req) {
     }
 
     // no explicit node was requested. choose the most up to date follower
+    // that can become a leader
     if (!target) {
+        const auto& cfg = _configuration_manager.get_latest();
         auto it = std::max_element(
-          _fstats.begin(), _fstats.end(), [](const auto& a, const auto& b) {
+          _fstats.begin(),
+          _fstats.end(),
+          [&cfg](const auto& a, const auto& b) {
+              if (cfg.is_witness(a.first) != cfg.is_witness(b.first)) {
+                  return cfg.is_witness(a.first);
+              }
               return a.second.last_dirty_log_index
                      < b.second.last_dirty_log_index;
           });
@@ -3451,6 +3832,15 @@ consensus::do_transfer_leadership(transfer_leadership_request req) {
           make_error_code(errc::not_voter));
     }
 
+    if (conf.is_witness(*target_rni)) {
+        vlog(
+          _ctxlog.warn,
+          "Cannot transfer leadership to node {} which is a witness",
+          *target_rni);
+        return seastar::make_ready_future<std::error_code>(
+          make_error_code(errc::not_voter));
+    }
+
     vlog(
       _ctxlog.info,
       "Starting leadership transfer from {} to {} in term {}",
@@ -3552,6 +3942,9 @@ consensus::do_transfer_leadership(transfer_leadership_request req) {
                 .group = _group,
                 .term = _term,
               };
+              // the target campaigns right away and its peers grant votes
+              // to it without waiting for an election timeout
+              _leader_lease_revoked = true;
 
               auto timeout
                 = raft::clock_type::now()
@@ -3922,13 +4315,13 @@ std::optional<uint8_t> consensus::get_under_replicated() const {
     }
 
     uint8_t count = 0;
+    const auto offsets = _log->offsets();
+    const auto liveness_timeout
+      = std::chrono::duration_cast<std::chrono::milliseconds>(
+        _jit.base_duration());
     for (const auto& f : _fstats) {
         auto f_metrics = build_follower_metrics(
-          f.first.id(),
-          _log->offsets(),
-          std::chrono::duration_cast<std::chrono::milliseconds>(
-            _jit.base_duration()),
-          f.second);
+          f.first.id(), offsets, liveness_timeout, f.second);
         if (f_metrics.under_replicated) {
             count += 1;
         }
@@ -3985,6 +4378,8 @@ reply_result consensus::lightweight_heartbeat(
     }
 
     _hbeat = clock_type::now();
+    // the leader stopped treating this follower as quiesced
+    _quiesced_until = clock_type::time_point::min();
     return reply_result::success;
 }
 ss::future<full_heartbeat_reply> consensus::full_heartbeat(
@@ -4010,6 +4405,8 @@ ss::future<full_heartbeat_reply> consensus::full_heartbeat(
     /**
      * IMPORTANT: do not use request reference after the scheduling point
      */
+    const bool quiesce = hb_data.quiesce;
+    const auto leader_dirty_offset = hb_data.prev_log_index;
     append_entries_reply r = co_await append_entries(append_entries_request(
       source_vnode,
       target_vnode,
@@ -4036,6 +4433,21 @@ ss::future<full_heartbeat_reply> consensus::full_heartbeat(
       .last_term_base_offset = r.last_term_base_offset,
       .may_recover = r.may_recover,
     };
+    /**
+     * The leader asks an idle follower to quiesce, the follower agrees when
+     * its log matches the leader's. Until the lease expires node level
+     * heartbeats from the leader node are enough to keep it from starting an
+     * election.
+     */
+    if (
+      quiesce && _heartbeat_manager != nullptr
+      && r.result == reply_result::success
+      && r.last_dirty_log_index == leader_dirty_offset
+      && !(_follower_recovery_state && _follower_recovery_state->is_active())) {
+        _quiesced_until = clock_type::now()
+                          + _heartbeat_manager->quiescence_lease();
+        reply.data.quiesced = true;
+    }
     co_return reply;
 }
 void consensus::reset_last_sent_protocol_meta(const vnode& node) {
@@ -127,9 +127,23 @@ public:
     ss::future<append_entries_reply> append_entries(append_entries_request&& r);
     ss::future<install_snapshot_reply>
     install_snapshot(install_snapshot_request&& r);
+    ss::future<transfer_segment_reply>
+    transfer_segment(transfer_segment_request&& r);
 
     ss::future<timeout_now_reply> timeout_now(timeout_now_request&& r);
 
+    /**
+     * Returns the offset from which the leader has to replicate the log of a
+     * lagging follower, the entries before it being available elsewhere, e.g.
+     * in cloud storage. Not set or nullopt if the whole log is replicated.
+     */
+    using follower_recovery_start_offset_fn
+      = ss::noncopyable_function<std::optional<model::offset>()>;
+    void set_follower_recovery_start_offset_fn(
+      follower_recovery_start_offset_fn f) {
+        _follower_recovery_start_offset = std::move(f);
+    }
+
     /// This method adds member to a group
     ss::future<std::error_code>
       add_group_member(model::broker, model::revision_id);
@@ -207,6 +221,9 @@ public:
     group_configuration config() const;
     const model::ntp& ntp() const { return _log->config().ntp(); }
     clock_type::time_point last_heartbeat() const { return _hbeat; };
+    /// True if the leader quiesced the heartbeats of this follower, it then
+    /// relies on node level heartbeats from the leader node.
+    bool is_quiesced() const { return _quiesced_until > clock_type::now(); }
     clock_type::time_point became_leader_at() const {
         return _became_leader_at;
     };
@@ -558,6 +575,11 @@ private:
     do_append_entries(append_entries_request&&);
     ss::future<install_snapshot_reply>
     do_install_snapshot(install_snapshot_request r);
+    ss::future<transfer_segment_reply>
+    do_transfer_segment(transfer_segment_request r);
+    ss::future<transfer_segment_reply>
+      finish_segment_transfer(transfer_segment_request, transfer_segment_reply);
+    ss::future<> abort_segment_transfer();
     ss::future<> do_start(std::optional<xshard_transfer_state>);
 
     ss::future<result<replicate_result>> dispatch_replicate(
@@ -613,6 +635,13 @@ private:
     ss::future<> do_maybe_update_leader_commit_idx(ssx::semaphore_units);
 
     clock_type::time_point majority_heartbeat() const;
+    /// last time the leader was heard from, node level heartbeats from the
+    /// leader node count while the follower is quiesced
+    clock_type::time_point leader_heartbeat() const;
+    /// time until which no other node can be elected leader, min() if the
+    /// leader doesn't hold a lease
+    clock_type::time_point leader_lease_expiry() const;
+    bool use_leader_lease() const;
     /*
      * Start an election. When leadership transfer is requested, the election is
      * started immediately, and the vote request will contain a flag that
@@ -631,6 +660,8 @@ private:
 
     void arm_vote_timeout();
     void update_node_append_timestamp(vnode);
+    void follower_quiesced(vnode, follower_req_seq);
+    void heartbeat_acknowledged(vnode, clock_type::time_point sent_at);
     void maybe_update_node_reply_timestamp(vnode);
 
     void update_follower_stats(const group_configuration&);
@@ -770,6 +801,10 @@ private:
           features::feature::raft_append_entries_serde);
     }
 
+    /// Sets the configured wire compression on the options of an append
+    /// entries request carrying data.
+    void set_append_entries_compression(rpc::client_opts&) const;
+
     // Called when during processing of an append_entries request we realize
     // that we need recovery or that the leader is already recovering us.
     // Will initialize or update _follower_recovery_state.
@@ -823,9 +858,16 @@ private:
     vnode _voted_for;
     std::optional<vnode> _leader_id;
     bool _transferring_leadership{false};
+    /// set once a timeout_now request was sent in the current term, its
+    /// target may be elected without waiting for the lease to expire
+    bool _leader_lease_revoked{false};
 
     /// useful for when we are not the leader
     clock_type::time_point _hbeat = clock_type::now(); // is max() iff leader
+    /// the follower is quiesced until then, see heartbeat_manager
+    clock_type::time_point _quiesced_until = clock_type::time_point::min();
+    /// set while the group is registered with a heartbeat_manager
+    heartbeat_manager* _heartbeat_manager{nullptr};
     clock_type::time_point _became_leader_at = clock_type::now();
     clock_type::time_point _instantiated_at = clock_type::now();
 
@@ -895,6 +937,20 @@ private:
     model::offset _received_snapshot_index;
     size_t _received_snapshot_bytes = 0;
 
+    // used to track the closed leader segment transferred to this follower,
+    // its files are staged next to the log and renamed once all are received
+    struct segment_transfer {
+        model::offset base_offset;
+        model::term_id segment_term;
+        segment_file_type file;
+        uint64_t bytes_received{0};
+        std::optional<ss::output_stream<char>> output;
+        // staged and final paths of the files received so far
+        std::vector<std::pair<ss::sstring, ss::sstring>> files;
+    };
+    std::optional<segment_transfer> _segment_transfer;
+    follower_recovery_start_offset_fn _follower_recovery_start_offset;
+
     /**
      * We keep an index of the most recent entry replicated with quorum
      * consistency level and flush to ensure they are not visible until
@@ -47,6 +47,10 @@ public:
           model::node_id, install_snapshot_request&&, rpc::client_opts)
           = 0;
 
+        virtual ss::future<result<transfer_segment_reply>> transfer_segment(
+          model::node_id, transfer_segment_request&&, rpc::client_opts)
+          = 0;
+
         virtual ss::future<result<timeout_now_reply>>
         timeout_now(model::node_id, timeout_now_request&&, rpc::client_opts)
           = 0;
@@ -101,6 +105,14 @@ public:
           target_node, std::move(r), std::move(opts));
     }
 
+    ss::future<result<transfer_segment_reply>> transfer_segment(
+      model::node_id target_node,
+      transfer_segment_request&& r,
+      rpc::client_opts opts) {
+        return _impl->transfer_segment(
+          target_node, std::move(r), std::move(opts));
+    }
+
     ss::future<result<timeout_now_reply>> timeout_now(
       model::node_id target_node,
       timeout_now_request&& r,
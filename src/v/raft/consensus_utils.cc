@@ -17,6 +17,7 @@
 #include "model/record.h"
 #include "model/record_utils.h"
 #include "model/timestamp.h"
+#include "raft/consensus.h"
 #include "raft/group_configuration.h"
 #include "raft/logger.h"
 #include "raft/types.h"
@@ -32,6 +33,7 @@
 #include "storage/ntp_config.h"
 #include "storage/offset_translator.h"
 #include "storage/offset_translator_state.h"
+#include "storage/parser_utils.h"
 #include "storage/record_batch_builder.h"
 #include "storage/record_batch_utils.h"
 #include "storage/segment_utils.h"
@@ -333,6 +335,25 @@ remove_persistent_state(raft::group_id group, storage::kvstore& kvs) {
     co_await ss::when_all_succeed(std::move(remove_futures));
 }
 
+bool voted_for_self(
+  raft::group_id group, model::node_id self, storage::kvstore& kvs) {
+    auto value = kvs.get(
+      storage::kvstore::key_space::consensus,
+      serialize_group_key(group, metadata_key::voted_for));
+    if (!value) {
+        return false;
+    }
+    try {
+        auto config = reflection::adl<consensus::voted_for_configuration>{}
+                        .from(std::move(*value));
+        return config.voted_for.id() == self;
+    } catch (...) {
+        // older encoding, see consensus::read_voted_for. this is only used as
+        // a hint, so don't bother with the fallback.
+        return false;
+    }
+}
+
 // Return previous offset. This is different from
 // model::prev_offset because it returns -1 for offset 0.
 // The model::offset{} is a special case since the result
@@ -461,4 +482,75 @@ ss::future<> bootstrap_pre_existing_partition(
       initial_nodes);
 }
 
+namespace {
+bool is_witness_stripped(const model::record_batch& batch) {
+    return batch.header().type == model::record_batch_type::raft_data;
+}
+
+model::record_batch make_witness_batch(const model::record_batch& batch) {
+    const auto& hdr = batch.header();
+    model::record_batch_header new_hdr;
+    new_hdr.type = model::record_batch_type::compaction_placeholder;
+    new_hdr.base_offset = hdr.base_offset;
+    new_hdr.last_offset_delta = hdr.last_offset_delta;
+    new_hdr.first_timestamp = hdr.first_timestamp;
+    new_hdr.max_timestamp = hdr.max_timestamp;
+    new_hdr.ctx = hdr.ctx;
+    auto no_records = iobuf{};
+    storage::internal::reset_size_checksum_metadata(new_hdr, no_records);
+    return model::record_batch(
+      new_hdr, std::move(no_records), model::record_batch::tag_ctor_ng{});
+}
+
+class witness_reader : public model::record_batch_reader::impl {
+public:
+    using data_t = model::record_batch_reader::data_t;
+    using foreign_data_t = model::record_batch_reader::foreign_data_t;
+    using storage_t = model::record_batch_reader::storage_t;
+
+    explicit witness_reader(model::record_batch_reader r)
+      : _source(std::move(r).release()) {}
+
+    bool is_end_of_stream() const final { return _source->is_end_of_stream(); }
+
+    ss::future<storage_t>
+    do_load_slice(model::timeout_clock::time_point tout) final {
+        return _source->do_load_slice(tout).then([](storage_t ret) {
+            data_t batches;
+            if (likely(std::holds_alternative<data_t>(ret))) {
+                auto& d = std::get<data_t>(ret);
+                batches.reserve(d.size());
+                for (auto& b : d) {
+                    batches.push_back(
+                      is_witness_stripped(b) ? make_witness_batch(b)
+                                             : std::move(b));
+                }
+            } else {
+                // batches of a foreign slice are copied to this shard
+                auto& d = std::get<foreign_data_t>(ret);
+                batches.reserve(d.buffer->size() - d.index);
+                for (auto i = d.index; i < d.buffer->size(); ++i) {
+                    const auto& b = (*d.buffer)[i];
+                    batches.push_back(
+                      is_witness_stripped(b) ? make_witness_batch(b)
+                                             : b.copy());
+                }
+            }
+            return storage_t(std::move(batches));
+        });
+    }
+
+    void print(std::ostream& os) final {
+        fmt::print(os, "{{witness reader}}");
+    }
+
+private:
+    std::unique_ptr<model::record_batch_reader::impl> _source;
+};
+} // namespace
+
+model::record_batch_reader make_witness_reader(model::record_batch_reader r) {
+    return model::make_record_batch_reader<witness_reader>(std::move(r));
+}
+
 } // namespace raft::details
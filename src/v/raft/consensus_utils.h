@@ -196,6 +196,13 @@ ss::future<> copy_persistent_state(
  */
 ss::future<> remove_persistent_state(raft::group_id, storage::kvstore&);
 
+/**
+ * returns true if the raft persistent state in the kvstore records a vote for
+ * `self`, i.e. this node was the leader, or a candidate, in the latest term
+ * that it knows of.
+ */
+bool voted_for_self(raft::group_id, model::node_id self, storage::kvstore&);
+
 /// Creates persitent state for pre-existing partition (stored in S3 bucket).
 ///
 /// The function is supposed to be called before creating a raft group with the
@@ -213,4 +220,9 @@ ss::future<> bootstrap_pre_existing_partition(
   model::term_id last_included_term,
   std::vector<model::broker> initial_nodes,
   ss::lw_shared_ptr<storage::offset_translator_state> ot_state);
+
+/// Replaces data batches with header only placeholder batches covering the
+/// same offsets with the same term, what witness replicas store. Other batch
+/// types, small and needed by raft and the offset translator, are kept.
+model::record_batch_reader make_witness_reader(model::record_batch_reader);
 } // namespace raft::details
@@ -55,10 +55,14 @@ void coordinated_recovery_throttle::token_bucket::reset_capacity(
 }
 
 coordinated_recovery_throttle::coordinated_recovery_throttle(
-  config::binding<size_t> rate_binding, config::binding<bool> use_static)
+  config::binding<size_t> rate_binding,
+  config::binding<bool> use_static,
+  config::binding<uint16_t> priority_share)
   : _rate_binding(std::move(rate_binding))
   , _use_static_allocation(std::move(use_static))
-  , _throttler(fair_rate_per_shard()) {
+  , _priority_share(std::move(priority_share))
+  , _throttler(fair_rate_per_shard())
+  , _priority_throttler(0) {
     if (ss::this_shard_id() == _coordinator_shard) {
         _coordinator.set_callback([this] {
             ssx::spawn_with_gate(_gate, [this] {
@@ -77,13 +81,13 @@ void coordinated_recovery_throttle::setup_metrics() {
           prometheus_sanitize::metrics_name("raft:recovery"),
           {sm::make_gauge(
              "partition_movement_available_bandwidth",
-             [this] { return _throttler.available(); },
+             [this] { return available(); },
              sm::description(
                "Bandwidth available for partition movement. bytes/sec")),
 
            sm::make_gauge(
              "partition_movement_assigned_bandwidth",
-             [this] { return _throttler.last_reset_capacity(); },
+             [this] { return last_reset_capacity(); },
              sm::description(
                "Bandwidth assigned for partition movement in last "
                "tick. bytes/sec"))});
@@ -98,14 +102,13 @@ void coordinated_recovery_throttle::setup_metrics() {
            // possible.
            sm::make_gauge(
              "partition_movement_available_bandwidth",
-             [this] { return _throttler.available(); },
+             [this] { return available(); },
              sm::description(
                "Bandwidth available for partition movement. bytes/sec")),
            sm::make_gauge(
              "partition_movement_consumed_bandwidth",
              [this] {
-                 return _throttler.last_reset_capacity()
-                        - _throttler.available();
+                 return last_reset_capacity() - available();
              },
              sm::description(
                "Bandwidth consumed for partition movement. bytes/sec"))});
@@ -120,7 +123,10 @@ void coordinated_recovery_throttle::arm_coordinator_timer() {
     }
 }
 
-void coordinated_recovery_throttle::shutdown() { _throttler.shutdown(); }
+void coordinated_recovery_throttle::shutdown() {
+    _throttler.shutdown();
+    _priority_throttler.shutdown();
+}
 
 ss::future<> coordinated_recovery_throttle::start() {
     vlog(raftlog.info, "Starting recovery throttle, rate: {}", _rate_binding());
@@ -143,14 +149,31 @@ size_t coordinated_recovery_throttle::required_capacity() const {
     // RPCs, an admitted request in the current period highly likely
     // implies a next request soon. So we retain this periods worth
     // of capacity just in case.
-    return _throttler.waiting_bytes() + _throttler.admitted_bytes();
+    return _throttler.required_capacity()
+           + _priority_throttler.required_capacity();
+}
+
+void coordinated_recovery_throttle::reset_capacity(size_t new_capacity) {
+    const auto high_required = _priority_throttler.required_capacity();
+    const auto normal_required = _throttler.required_capacity();
+    // Each class gets what it needs up to its share, then the spare capacity
+    // goes to the high priority class first. When neither needs anything the
+    // whole capacity sits in the normal bucket, like with a single bucket.
+    auto high = std::min(high_required, new_capacity * _priority_share() / 100);
+    auto normal = std::min(normal_required, new_capacity - high);
+    auto spare = new_capacity - high - normal;
+    auto high_extra = std::min(spare, high_required - high);
+    high += high_extra;
+    normal += spare - high_extra;
+    _priority_throttler.reset_capacity(high);
+    _throttler.reset_capacity(normal);
 }
 
 ss::future<>
 coordinated_recovery_throttle::reset_capacity_all_shards(size_t new_capacity) {
     co_await container().invoke_on_all(
       [new_capacity](coordinated_recovery_throttle& local) {
-          local._throttler.reset_capacity(new_capacity);
+          local.reset_capacity(new_capacity);
       });
 }
 
@@ -158,7 +181,7 @@ ss::future<> coordinated_recovery_throttle::reset_capacity_on_shard(
   ss::shard_id shard, size_t new_capacity) {
     co_await container().invoke_on(
       shard, [new_capacity](coordinated_recovery_throttle& local) {
-          local._throttler.reset_capacity(new_capacity);
+          local.reset_capacity(new_capacity);
       });
 }
 
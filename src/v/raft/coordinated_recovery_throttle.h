@@ -20,6 +20,10 @@
 
 namespace raft {
 
+/// Recovery of the high priority class is guaranteed a configurable share of
+/// the recovery rate when both classes compete for it.
+enum class recovery_priority : int8_t { normal, high };
+
 /// A recovery throttle that coordinates the total available rate across shards.
 /// Coordination is done by shard 0. The intent of the coordination is to
 /// saturate the available node recovery rate (bandwidth). This is achieved by
@@ -30,12 +34,17 @@ namespace raft {
 /// In order to guarantee fairness, each shard always has access to its fair
 /// share of bandwidth (= total_available/num_shards). Any unused portion of
 /// this fair share is redistributed among the busy shards.
+
+/// Within a shard the capacity is split between a bucket per priority class.
+/// The high priority class gets up to its configured share of it if needed
+/// and whatever a class leaves unused is given to the other one.
 class coordinated_recovery_throttle
   : public ss::peering_sharded_service<coordinated_recovery_throttle> {
 public:
     explicit coordinated_recovery_throttle(
       config::binding<size_t> /* node capacity in bytes per sec*/,
-      config::binding<bool> /* use static rate allocation*/);
+      config::binding<bool> /* use static rate allocation*/,
+      config::binding<uint16_t> /* high priority share in percent*/);
     coordinated_recovery_throttle(const coordinated_recovery_throttle&)
       = delete;
     coordinated_recovery_throttle&
@@ -54,13 +63,26 @@ public:
     /// A test helper to step through the ticks.
     ss::future<> tick_for_testing() { return do_coordinate_tick(); }
 
-    ss::future<> throttle(size_t size, ss::abort_source& as) {
-        return _throttler.throttle(size, as);
+    ss::future<> throttle(
+      size_t size,
+      ss::abort_source& as,
+      recovery_priority priority = recovery_priority::normal) {
+        return bucket(priority).throttle(size, as);
     }
 
-    size_t available() const { return _throttler.available(); }
-    size_t waiting_bytes() const { return _throttler.waiting_bytes(); }
-    size_t admitted_bytes() const { return _throttler.admitted_bytes(); }
+    size_t available() const {
+        return _throttler.available() + _priority_throttler.available();
+    }
+    size_t waiting_bytes() const {
+        return _throttler.waiting_bytes() + _priority_throttler.waiting_bytes();
+    }
+    size_t admitted_bytes() const {
+        return _throttler.admitted_bytes()
+               + _priority_throttler.admitted_bytes();
+    }
+    size_t available(recovery_priority priority) const {
+        return bucket(priority).available();
+    }
 
     void setup_metrics();
 
@@ -86,6 +108,9 @@ private:
         }
         size_t available() const { return _sem.current(); }
         size_t last_reset_capacity() const { return _last_reset_capacity; }
+        size_t required_capacity() const {
+            return _waiting_bytes + _admitted_bytes_since_last_reset;
+        }
 
     private:
         ssx::named_semaphore<> _sem;
@@ -104,6 +129,23 @@ private:
         return _rate_binding() / ss::smp::count;
     }
 
+    token_bucket& bucket(recovery_priority priority) {
+        return priority == recovery_priority::high ? _priority_throttler
+                                                   : _throttler;
+    }
+    const token_bucket& bucket(recovery_priority priority) const {
+        return priority == recovery_priority::high ? _priority_throttler
+                                                   : _throttler;
+    }
+
+    size_t last_reset_capacity() const {
+        return _throttler.last_reset_capacity()
+               + _priority_throttler.last_reset_capacity();
+    }
+
+    /// Splits the shard capacity between the priority class buckets.
+    void reset_capacity(size_t /* new capacity*/);
+
     /// Helpers to reset capacity on all/specific shard to the passed capacity.
     /// Used by the coordinator.
     ss::future<> reset_capacity_all_shards(size_t /* new capacity*/);
@@ -129,7 +171,9 @@ private:
     // Allocates fair share to all shards. A fall back option for issues
     // with dynamic allocation.
     config::binding<bool> _use_static_allocation;
+    config::binding<uint16_t> _priority_share;
     token_bucket _throttler;
+    token_bucket _priority_throttler;
     ss::gate _gate;
     ss::timer<clock_t> _coordinator;
 
@@ -13,6 +13,8 @@
 
 #include <absl/container/node_hash_map.h>
 
+#include <algorithm>
+
 namespace raft {
 void follower_stats::update_with_configuration(const group_configuration& cfg) {
     cfg.for_each_broker_id([this](const vnode& rni) {
@@ -52,7 +54,8 @@ follower_stats::get_append_entries_unit(vnode id) {
     if (auto it = _queues.find(id); it != _queues.end()) {
         return it->second.get_append_entries_unit();
     }
-    auto [it, _] = _queues.emplace(id, _max_concurrent_append_entries);
+    auto [it, _] = _queues.emplace(
+      id, std::max<uint32_t>(_max_concurrent_append_entries(), 1));
 
     return it->second.get_append_entries_unit();
 }
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "base/vassert.h"
+#include "config/property.h"
 #include "raft/follower_queue.h"
 #include "raft/types.h"
 
@@ -26,9 +27,11 @@ public:
     using const_iterator = container_t::const_iterator;
     using value_type = container_t::value_type;
 
-    explicit follower_stats(vnode self, uint32_t max_concurrent_append_entries)
+    follower_stats(
+      vnode self, config::binding<uint32_t> max_concurrent_append_entries)
       : _self(self)
-      , _max_concurrent_append_entries(max_concurrent_append_entries) {}
+      , _max_concurrent_append_entries(
+          std::move(max_concurrent_append_entries)) {}
 
     const follower_index_metadata& get(vnode n) const {
         auto it = _followers.find(n);
@@ -85,7 +88,9 @@ public:
 private:
     friend std::ostream& operator<<(std::ostream&, const follower_stats&);
     vnode _self;
-    uint32_t _max_concurrent_append_entries;
+    // applied to a follower's queue when it is created, queues are removed
+    // when idle so a change is picked up as soon as the follower catches up
+    config::binding<uint32_t> _max_concurrent_append_entries;
     container_t _followers;
     absl::node_hash_map<vnode, follower_queue> _queues;
 };
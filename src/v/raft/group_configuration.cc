@@ -235,6 +235,11 @@ bool group_nodes::contains(const vnode& id) const {
     return l_it != learners.cend();
 }
 
+bool group_nodes::is_witness(const vnode& id) const {
+    return std::find(witnesses.cbegin(), witnesses.cend(), id)
+           != witnesses.cend();
+}
+
 std::optional<vnode> group_nodes::find(model::node_id id) const {
     auto v_it = std::find_if(
       voters.cbegin(), voters.cend(), [id](const vnode& rni) {
@@ -336,7 +341,15 @@ bool group_configuration::is_voter(vnode id) const {
     return old_it != _old->voters.cend();
 }
 
+bool group_configuration::is_witness(vnode id) const {
+    return _current.is_witness(id) || (_old && _old->is_witness(id));
+}
+
 bool group_configuration::is_allowed_to_request_votes(vnode id) const {
+    // witnesses have no data to serve as a leader
+    if (is_witness(id)) {
+        return false;
+    }
     // either current voter
     auto it = std::find(_current.voters.cbegin(), _current.voters.cend(), id);
 
@@ -1248,7 +1261,11 @@ std::ostream& operator<<(std::ostream& o, const group_configuration& c) {
 }
 
 std::ostream& operator<<(std::ostream& o, const group_nodes& n) {
-    fmt::print(o, "{{voters: {}, learners: {}}}", n.voters, n.learners);
+    fmt::print(o, "{{voters: {}, learners: {}", n.voters, n.learners);
+    if (!n.witnesses.empty()) {
+        fmt::print(o, ", witnesses: {}", n.witnesses);
+    }
+    fmt::print(o, "}}");
     return o;
 }
 
@@ -90,18 +90,25 @@ enum class configuration_state : uint8_t { simple, transitional, joint };
 std::ostream& operator<<(std::ostream& o, configuration_state t);
 
 struct group_nodes
-  : serde::envelope<group_nodes, serde::version<0>, serde::compat_version<0>> {
+  : serde::envelope<group_nodes, serde::version<1>, serde::compat_version<0>> {
     std::vector<vnode> voters;
     std::vector<vnode> learners;
+    /**
+     * Voters that take part in elections and acknowledge appends but store
+     * only the headers of data batches. A witness never becomes a leader. It
+     * is not serialized in configuration versions older than v_6.
+     */
+    std::vector<vnode> witnesses;
 
     bool contains(const vnode&) const;
+    bool is_witness(const vnode&) const;
 
     std::optional<vnode> find(model::node_id) const;
 
     friend std::ostream& operator<<(std::ostream&, const group_nodes&);
     friend bool operator==(const group_nodes&, const group_nodes&) = default;
 
-    auto serde_fields() { return std::tie(voters, learners); }
+    auto serde_fields() { return std::tie(voters, learners, witnesses); }
 };
 
 struct configuration_update
@@ -212,6 +219,11 @@ public:
      */
     bool is_voter(vnode) const;
 
+    /**
+     * Check if node is a witness voter, storing only batch headers
+     */
+    bool is_witness(vnode) const;
+
     /**
      * Check if node with given id is allowed to request for votes
      */
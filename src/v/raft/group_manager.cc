@@ -35,14 +35,23 @@ group_manager::group_manager(
   ss::sharded<features::feature_table>& feature_table)
   : _self(self)
   , _raft_sg(raft_sg)
-  , _client(make_rpc_client_protocol(self, clients))
   , _configuration(cfg())
+  , _append_entries_multiplexer(
+      self,
+      clients,
+      feature_table.local(),
+      _configuration.append_entries_batch_max_bytes)
+  , _client(
+      make_rpc_client_protocol(self, clients, &_append_entries_multiplexer))
   , _heartbeats(
       _configuration.heartbeat_interval,
       _client,
       _self,
       _configuration.heartbeat_timeout,
       _configuration.enable_lw_heartbeat,
+      _configuration.enable_quiescence,
+      _configuration.quiescence_lease,
+      _configuration.enable_eager_commit_propagation,
       feature_table.local())
   , _storage(storage.local())
   , _recovery_throttle(recovery_throttle.local())
@@ -94,12 +103,14 @@ ss::future<> group_manager::stop() {
         f = f.then([this] { return _heartbeats.stop(); });
     }
 
-    return f.then([this] {
-        return ss::parallel_for_each(
-          _groups, [](ss::lw_shared_ptr<consensus> raft) {
-              return raft->stop().discard_result();
-          });
-    });
+    return f
+      .then([this] {
+          return ss::parallel_for_each(
+            _groups, [](ss::lw_shared_ptr<consensus> raft) {
+                return raft->stop().discard_result();
+            });
+      })
+      .then([this] { return _append_entries_multiplexer.stop(); });
 }
 void group_manager::set_ready() {
     _is_ready = true;
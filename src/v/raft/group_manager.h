@@ -13,6 +13,7 @@
 #include "config/property.h"
 #include "metrics/metrics.h"
 #include "model/metadata.h"
+#include "raft/append_entries_multiplexer.h"
 #include "raft/heartbeat_manager.h"
 #include "raft/notification.h"
 #include "raft/recovery_memory_quota.h"
@@ -42,12 +43,16 @@ public:
         config::binding<std::chrono::milliseconds> heartbeat_timeout;
         config::binding<std::chrono::milliseconds> raft_io_timeout_ms;
         config::binding<bool> enable_lw_heartbeat;
+        config::binding<bool> enable_quiescence;
+        config::binding<std::chrono::milliseconds> quiescence_lease;
+        config::binding<bool> enable_eager_commit_propagation;
         config::binding<size_t> recovery_concurrency_per_shard;
         config::binding<std::chrono::milliseconds> election_timeout_ms;
         config::binding<model::write_caching_mode> write_caching;
         config::binding<std::chrono::milliseconds> write_caching_flush_ms;
         config::binding<std::optional<size_t>> write_caching_flush_bytes;
         config::binding<bool> enable_longest_log_detection;
+        config::binding<size_t> append_entries_batch_max_bytes;
     };
     using config_provider_fn = ss::noncopyable_function<configuration()>;
 
@@ -95,6 +100,12 @@ public:
         return _recovery_scheduler.get_status();
     }
 
+    model::node_id self() const { return _self; }
+
+    void node_heartbeat_received(model::node_id source) {
+        _heartbeats.node_heartbeat_received(source);
+    }
+
 private:
     void trigger_leadership_notification(raft::leadership_status);
     void setup_metrics();
@@ -109,8 +120,9 @@ private:
       std::vector<model::broker>, model::revision_id) const;
     model::node_id _self;
     ss::scheduling_group _raft_sg;
-    raft::consensus_client_protocol _client;
     configuration _configuration;
+    raft::append_entries_multiplexer _append_entries_multiplexer;
+    raft::consensus_client_protocol _client;
     raft::heartbeat_manager _heartbeats;
     ss::gate _gate;
     std::vector<ss::lw_shared_ptr<raft::consensus>> _groups;
@@ -43,6 +43,15 @@ ss::logger hbeatlog{"r/heartbeat"};
 using consensus_ptr = heartbeat_manager::consensus_ptr;
 using consensus_set = heartbeat_manager::consensus_set;
 
+namespace {
+// number of heartbeat intervals without appends to the follower after which
+// it may be quiesced
+constexpr int quiescence_idle_heartbeats = 10;
+// commit index updates within this window are sent in a single round of
+// heartbeats
+constexpr auto commit_heartbeat_delay = std::chrono::milliseconds(5);
+} // namespace
+
 heartbeat_manager::follower_request_meta::follower_request_meta(
   consensus_ptr ptr,
   follower_req_seq seq,
@@ -54,10 +63,36 @@ heartbeat_manager::follower_request_meta::follower_request_meta(
   , follower_vnode(target)
   , append_guard(c->track_append_inflight(follower_vnode)) {}
 
+heartbeat_manager::hb_pair heartbeat_manager::make_full_heartbeat(
+  const consensus_ptr& r,
+  vnode id,
+  follower_index_metadata& follower_metadata,
+  const protocol_metadata& raft_metadata,
+  bool quiesce) {
+    r->_probe->full_heartbeat();
+    auto const seq_id = follower_metadata.next_follower_sequence();
+
+    follower_metadata.last_sent_protocol_meta = raft_metadata;
+    return {
+      group_heartbeat{
+        .group = r->group(),
+        .data = heartbeat_request_data{
+          .source_revision = r->_self.revision(),
+          .target_revision = id.revision(),
+          .commit_index = raft_metadata.commit_index,
+          .term = raft_metadata.term,
+          .prev_log_index = raft_metadata.prev_log_index,
+          .prev_log_term = raft_metadata.prev_log_term,
+          .last_visible_index = raft_metadata.last_visible_index,
+          .quiesce = quiesce,
+        },
+      },
+      heartbeat_manager::follower_request_meta(
+        r, seq_id, raft_metadata.prev_log_index, id)};
+}
+
 ss::future<heartbeat_manager::heartbeat_requests>
 heartbeat_manager::requests_for_range() {
-    using hb_pair
-      = std::pair<group_heartbeat, heartbeat_manager::follower_request_meta>;
     absl::node_hash_map<model::node_id, ss::chunked_fifo<hb_pair>>
       pending_beats;
 
@@ -70,7 +105,8 @@ heartbeat_manager::requests_for_range() {
     // that we should tear down their TCP connection before next heartbeat
     absl::flat_hash_set<model::node_id> reconnect_nodes;
 
-    const auto last_heartbeat = clock_type::now() - _heartbeat_interval();
+    const auto now = clock_type::now();
+    const auto last_heartbeat = now - _heartbeat_interval();
     for (auto& r : _consensus_groups) {
         if (!r->is_elected_leader()) {
             continue;
@@ -80,7 +116,7 @@ heartbeat_manager::requests_for_range() {
           counter,
           r->_fstats.begin(),
           r->_fstats.end(),
-          [this, r, last_heartbeat, &pending_beats, &reconnect_nodes](
+          [this, r, now, last_heartbeat, &pending_beats, &reconnect_nodes](
             follower_stats::value_type& p) {
               auto& [id, follower_metadata] = p;
               if (
@@ -109,10 +145,20 @@ heartbeat_manager::requests_for_range() {
                 .group = r->group(),
               };
               const auto raft_metadata = r->meta();
+              const bool full_heartbeat_needed = needs_full_heartbeat(
+                follower_metadata, raft_metadata, r->flushed_offset());
+              if (
+                _enable_quiescence() && !full_heartbeat_needed
+                && follower_metadata.is_quiesced(now, _quiescence_lease())) {
+                  // the request to the node, even if it ends up empty, is
+                  // enough to keep the follower from starting an election
+                  vlog(r->_ctxlog.trace, "[{}] heartbeat quiesced", id);
+                  return;
+              }
+              const bool quiesce = should_quiesce(
+                *r, follower_metadata, raft_metadata, now);
               if (
-                _enable_lw_heartbeat()
-                && !needs_full_heartbeat(
-                  follower_metadata, raft_metadata, r->flushed_offset())) {
+                _enable_lw_heartbeat() && !quiesce && !full_heartbeat_needed) {
                   r->_probe->lw_heartbeat();
                   // we do not fill the dirty offset and follower request
                   // sequence here as those fields are not used to process
@@ -123,24 +169,13 @@ heartbeat_manager::requests_for_range() {
                       r, raft::follower_req_seq{}, model::offset{}, id));
                   return;
               }
-              vlog(r->_ctxlog.trace, "[{}] full heartbeat", id);
-              r->_probe->full_heartbeat();
-              auto const seq_id = follower_metadata.next_follower_sequence();
-
-              follower_metadata.last_sent_protocol_meta = raft_metadata;
-              group_beat.data = heartbeat_request_data{
-                .source_revision = r->_self.revision(),
-                .target_revision = id.revision(),
-                .commit_index = raft_metadata.commit_index,
-                .term = raft_metadata.term,
-                .prev_log_index = raft_metadata.prev_log_index,
-                .prev_log_term = raft_metadata.prev_log_term,
-                .last_visible_index = raft_metadata.last_visible_index,
-              };
-              it->second.emplace_back(
-                group_beat,
-                heartbeat_manager::follower_request_meta(
-                  r, seq_id, raft_metadata.prev_log_index, id));
+              vlog(
+                r->_ctxlog.trace,
+                "[{}] full heartbeat, quiesce: {}",
+                id,
+                quiesce);
+              it->second.push_back(make_full_heartbeat(
+                r, id, follower_metadata, raft_metadata, quiesce));
 
               if (r->should_reconnect_follower(follower_metadata)) {
                   reconnect_nodes.insert(id.id());
@@ -169,7 +204,7 @@ heartbeat_manager::requests_for_range() {
               req.add(hb);
           });
 
-        reqs.emplace_back(p.first, std::move(req), std::move(meta_map));
+        reqs.emplace_back(p.first, std::move(req), std::move(meta_map), now);
     }
 
     co_return heartbeat_requests{
@@ -206,20 +241,74 @@ bool heartbeat_manager::needs_full_heartbeat(
            || leader_flushed_offset != f_meta.last_flushed_log_index;
 }
 
+bool heartbeat_manager::should_quiesce(
+  const consensus& c,
+  const follower_index_metadata& f_meta,
+  const protocol_metadata& p_meta,
+  clock_type::time_point now) const {
+    if (!_enable_quiescence() || f_meta.is_quiesced(now, _quiescence_lease())) {
+        return false;
+    }
+    const auto idle_since = now
+                            - quiescence_idle_heartbeats
+                                * _heartbeat_interval();
+    /**
+     * Only a follower that acknowledged everything the leader has, including
+     * the commit index, and that didn't receive appends for a while is
+     * quiesced. Anything sent to the follower afterwards ends quiescence as
+     * it advances the follower request sequence.
+     */
+    return !f_meta.has_inflight_appends() && !f_meta.is_learner
+           && !f_meta.is_recovering
+           && f_meta.last_sent_seq == f_meta.last_successful_received_seq
+           && f_meta.last_sent_protocol_meta == p_meta
+           && f_meta.last_flushed_log_index == p_meta.prev_log_index
+           && p_meta.commit_index == p_meta.prev_log_index
+           && f_meta.last_sent_append_entries_req_timestamp < idle_since
+           && c.config().get_state() == configuration_state::simple;
+}
+
+void heartbeat_manager::node_heartbeat_received(model::node_id source) {
+    _node_heartbeats[source] = clock_type::now();
+}
+
+clock_type::time_point
+heartbeat_manager::last_node_heartbeat(model::node_id n) const {
+    auto it = _node_heartbeats.find(n);
+    return it == _node_heartbeats.end() ? clock_type::time_point::min()
+                                        : it->second;
+}
+
+clock_type::time_point
+heartbeat_manager::last_node_reply(model::node_id n) const {
+    auto it = _node_replies.find(n);
+    return it == _node_replies.end() ? clock_type::time_point::min()
+                                     : it->second;
+}
+
 heartbeat_manager::heartbeat_manager(
   config::binding<std::chrono::milliseconds> interval,
   consensus_client_protocol proto,
   model::node_id self,
   config::binding<std::chrono::milliseconds> heartbeat_timeout,
   config::binding<bool> enable_lw_heartbeat,
+  config::binding<bool> enable_quiescence,
+  config::binding<std::chrono::milliseconds> quiescence_lease,
+  config::binding<bool> enable_eager_commit_propagation,
   features::feature_table& ft)
   : _heartbeat_interval(std::move(interval))
   , _heartbeat_timeout(std::move(heartbeat_timeout))
   , _client_protocol(std::move(proto))
   , _self(self)
   , _enable_lw_heartbeat(std::move(enable_lw_heartbeat))
+  , _enable_quiescence(std::move(enable_quiescence))
+  , _quiescence_lease(std::move(quiescence_lease))
+  , _enable_eager_commit_propagation(
+      std::move(enable_eager_commit_propagation))
   , _feature_table(ft) {
     _heartbeat_timer.set_callback([this] { dispatch_heartbeats(); });
+    _commit_heartbeat_timer.set_callback(
+      [this] { dispatch_commit_heartbeats(); });
 }
 
 ss::future<>
@@ -266,11 +355,12 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat r) {
                    512))
                .then([node = r.target,
                       groups = std::move(r.meta_map),
+                      sent_at = r.sent_at,
                       gate = std::move(gate),
                       this](result<heartbeat_reply_v2> ret) mutable {
                    // this will happen after RPC client will return and resume
                    // sending heartbeats to follower
-                   process_reply(node, groups, std::move(ret));
+                   process_reply(node, groups, sent_at, std::move(ret));
                });
     // fail fast to make sure that not lagging nodes will be able to receive
     // hearteats
@@ -289,6 +379,7 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat r) {
 void heartbeat_manager::process_reply(
   model::node_id n,
   const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+  clock_type::time_point sent_at,
   result<heartbeat_reply_v2> r) {
     if (!r) {
         vlog(
@@ -334,8 +425,12 @@ void heartbeat_manager::process_reply(
         return;
     }
     auto& reply = r.value();
-    reply.for_each_lw_reply([this, n, target = reply.target(), &groups](
-                              group_id group, reply_result result) {
+    _node_replies[n] = clock_type::now();
+    reply.for_each_lw_reply([this,
+                             n,
+                             target = reply.target(),
+                             sent_at,
+                             &groups](group_id group, reply_result result) {
         auto it = _consensus_groups.find(group);
         if (it == _consensus_groups.end()) {
             vlog(
@@ -398,6 +493,8 @@ void heartbeat_manager::process_reply(
 
         consensus->update_heartbeat_status(
           meta_it->second.follower_vnode, true);
+        consensus->heartbeat_acknowledged(
+          meta_it->second.follower_vnode, sent_at);
     });
 
     for (auto& m : reply.full_replies()) {
@@ -454,6 +551,11 @@ void heartbeat_manager::process_reply(
         consensus->update_heartbeat_status(
           meta_it->second.follower_vnode, true);
 
+        if (m.result == reply_result::success && m.data.quiesced) {
+            consensus->follower_quiesced(
+              meta_it->second.follower_vnode, meta_it->second.seq);
+        }
+
         consensus->process_append_entries_reply(
           n,
           result<append_entries_reply>(append_entries_reply{
@@ -598,10 +700,82 @@ void heartbeat_manager::dispatch_heartbeats() {
     _hbeat = clock_type::now();
 }
 
+void heartbeat_manager::commit_index_advanced(raft::group_id g) {
+    if (!_enable_eager_commit_propagation() || _bghbeats.is_closed()) {
+        return;
+    }
+    _commit_advanced.insert(g);
+    if (!_commit_heartbeat_timer.armed()) {
+        _commit_heartbeat_timer.arm(commit_heartbeat_delay);
+    }
+}
+
+void heartbeat_manager::dispatch_commit_heartbeats() {
+    // not serialized with the periodic heartbeats, the groups are looked up
+    // by id and the follower state is only touched without yielding
+    ssx::background = ssx::spawn_with_gate_then(_bghbeats, [this] {
+                          return do_dispatch_commit_heartbeats();
+                      }).handle_exception([](const std::exception_ptr& e) {
+        vlog(hbeatlog.warn, "Error dispatching commit heartbeats - {}", e);
+    });
+}
+
+ss::future<> heartbeat_manager::do_dispatch_commit_heartbeats() {
+    std::vector<raft::group_id> groups(
+      _commit_advanced.begin(), _commit_advanced.end());
+    _commit_advanced.clear();
+
+    absl::node_hash_map<model::node_id, ss::chunked_fifo<hb_pair>>
+      pending_beats;
+    ssx::async_counter counter;
+    co_await ssx::async_for_each_counter(
+      counter,
+      groups.begin(),
+      groups.end(),
+      [this, &pending_beats](raft::group_id g) {
+          auto it = _consensus_groups.find(g);
+          if (it == _consensus_groups.end() || !(*it)->is_elected_leader()) {
+              return;
+          }
+          auto r = *it;
+          const auto raft_metadata = r->meta();
+          for (auto& [id, follower_metadata] : r->_fstats) {
+              /**
+               * Followers with an append in flight learn the commit index
+               * from the next append, the others from a full heartbeat, the
+               * same one the next heartbeat interval would send them.
+               */
+              if (!needs_full_heartbeat(
+                    follower_metadata, raft_metadata, r->flushed_offset())) {
+                  continue;
+              }
+              vlog(r->_ctxlog.trace, "[{}] commit index heartbeat", id);
+              pending_beats[id.id()].push_back(make_full_heartbeat(
+                r, id, follower_metadata, raft_metadata, false));
+          }
+      });
+
+    const auto now = clock_type::now();
+    std::vector<node_heartbeat> reqs;
+    reqs.reserve(pending_beats.size());
+    for (auto& [node, beats] : pending_beats) {
+        absl::node_hash_map<raft::group_id, follower_request_meta> meta_map;
+        meta_map.reserve(beats.size());
+        heartbeat_request_v2 req(_self, node);
+        for (auto& [hb, follower_meta] : beats) {
+            meta_map.emplace(hb.group, std::move(follower_meta));
+            req.add(hb);
+        }
+        reqs.emplace_back(node, std::move(req), std::move(meta_map), now);
+    }
+    co_await send_heartbeats(std::move(reqs));
+}
+
 ss::future<> heartbeat_manager::deregister_group(group_id g) {
     return _lock.with([this, g] {
         auto it = _consensus_groups.find(g);
         vassert(it != _consensus_groups.end(), "group not found: {}", g);
+        (*it)->_heartbeat_manager = nullptr;
         _consensus_groups.erase(it);
     });
 }
@@ -615,6 +789,7 @@ heartbeat_manager::register_group(ss::lw_shared_ptr<consensus> ptr) {
           "double registration of group: {}:{}",
           ptr->ntp(),
           ptr->group());
+        ptr->_heartbeat_manager = this;
     });
 }
 
@@ -624,6 +799,7 @@ ss::future<> heartbeat_manager::start() {
 }
 ss::future<> heartbeat_manager::stop() {
     _heartbeat_timer.cancel();
+    _commit_heartbeat_timer.cancel();
     return _bghbeats.close();
 }
 
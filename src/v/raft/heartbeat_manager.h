@@ -24,6 +24,7 @@
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 #include <boost/container/flat_set.hpp>
@@ -111,16 +112,21 @@ public:
         node_heartbeat(
           model::node_id t,
           heartbeat_request_v2 req,
-          absl::node_hash_map<raft::group_id, follower_request_meta> seqs)
+          absl::node_hash_map<raft::group_id, follower_request_meta> seqs,
+          clock_type::time_point sent_at)
           : target(t)
           , request(std::move(req))
-          , meta_map(std::move(seqs)) {}
+          , meta_map(std::move(seqs))
+          , sent_at(sent_at) {}
 
         model::node_id target;
         heartbeat_request_v2 request;
         // each raft group has its own follower metadata hence we need map to
         // track a sequence per group
         absl::node_hash_map<raft::group_id, follower_request_meta> meta_map;
+        // the request is sent at or after this time, followers acknowledging
+        // it heard from the leader since
+        clock_type::time_point sent_at;
     };
 
     heartbeat_manager(
@@ -129,17 +135,51 @@ public:
       model::node_id self_node_id,
       config::binding<std::chrono::milliseconds> heartbeat_timeout,
       config::binding<bool> enable_lw_heartbeats,
+      config::binding<bool> enable_quiescence,
+      config::binding<std::chrono::milliseconds> quiescence_lease,
+      config::binding<bool> enable_eager_commit_propagation,
       features::feature_table& features);
 
     ss::future<> register_group(ss::lw_shared_ptr<consensus>);
     ss::future<> deregister_group(raft::group_id);
 
+    /**
+     * Quiescence
+     *
+     * Followers of an idle group that are up to date with the leader may be
+     * quiesced: the leader stops sending them heartbeats of the group for a
+     * lease and the followers accept any heartbeat request from the leader
+     * node, even one that carries no group at all, as a proof that the
+     * leader is alive. The leader in turn counts any successful reply from
+     * the follower node. With many idle groups per node this replaces the
+     * per group heartbeats with one request per node and interval.
+     */
+    void node_heartbeat_received(model::node_id source);
+    clock_type::time_point last_node_heartbeat(model::node_id) const;
+    clock_type::time_point last_node_reply(model::node_id) const;
+    clock_type::duration quiescence_lease() const {
+        return _quiescence_lease();
+    }
+
+    /**
+     * Called by the leader of a group when its commit index advances.
+     *
+     * Followers otherwise learn the new commit index with the next append or
+     * heartbeat, up to a heartbeat interval later, which delays the visibility
+     * of records to consumers fetching from them. When eager propagation is
+     * enabled the groups that advanced within a short window are sent a full
+     * heartbeat to the followers that have no append in flight.
+     */
+    void commit_index_advanced(raft::group_id);
+
     ss::future<> start();
     ss::future<> stop();
 
     bool is_stopped() const { return _bghbeats.is_closed(); }
 
 private:
+    using hb_pair = std::pair<group_heartbeat, follower_request_meta>;
+
     struct heartbeat_requests {
         /// Requests to dispatch.  Can include request to self.
         std::vector<heartbeat_manager::node_heartbeat> requests;
@@ -150,12 +190,14 @@ private:
     };
 
     void dispatch_heartbeats();
+    void dispatch_commit_heartbeats();
 
     clock_type::time_point next_heartbeat_timeout();
 
     /// \brief unprotected, must be used inside the gate & semaphore
 
     ss::future<> do_dispatch_heartbeats();
+    ss::future<> do_dispatch_commit_heartbeats();
     ss::future<> send_heartbeats(std::vector<node_heartbeat>);
 
     /// \brief sends a batch to one node
@@ -166,6 +208,12 @@ private:
       const protocol_metadata& leader_protocol_metadata,
       model::offset leader_flushed_offset) const;
 
+    bool should_quiesce(
+      const consensus&,
+      const follower_index_metadata& follower_metadata,
+      const protocol_metadata& leader_protocol_metadata,
+      clock_type::time_point now) const;
+
     /// \brief notifies the consensus groups about append_entries log offsets
     /// \param n the physical node that owns heart beats
     /// \param groups raft groups managed by \param n
@@ -178,6 +226,7 @@ private:
     void process_reply(
       model::node_id n,
       const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+      clock_type::time_point sent_at,
       result<heartbeat_reply_v2> result);
 
     consensus_ptr validate_heartbeat_reply(
@@ -187,6 +236,15 @@ private:
       group_id group,
       reply_result status);
 
+    /// \brief builds a full heartbeat for the follower and records it as the
+    /// last protocol metadata sent to it
+    hb_pair make_full_heartbeat(
+      const consensus_ptr&,
+      vnode follower,
+      follower_index_metadata& follower_metadata,
+      const protocol_metadata& leader_protocol_metadata,
+      bool quiesce);
+
     ss::future<heartbeat_requests> requests_for_range();
     // private members
 
@@ -203,6 +261,18 @@ private:
     consensus_client_protocol _client_protocol;
     model::node_id _self;
     config::binding<bool> _enable_lw_heartbeat;
+    config::binding<bool> _enable_quiescence;
+    config::binding<std::chrono::milliseconds> _quiescence_lease;
+    config::binding<bool> _enable_eager_commit_propagation;
+    /// groups whose commit index advanced since the last commit heartbeats
+    absl::flat_hash_set<raft::group_id> _commit_advanced;
+    timer_type _commit_heartbeat_timer;
     features::feature_table& _feature_table;
+    /// last heartbeat request received from a node / last successful reply
+    /// to a heartbeat request sent to a node, entries are never erased, the
+    /// number of nodes is small
+    absl::flat_hash_map<model::node_id, clock_type::time_point>
+      _node_heartbeats;
+    absl::flat_hash_map<model::node_id, clock_type::time_point> _node_replies;
 };
 } // namespace raft
@@ -201,7 +201,7 @@ void for_each_column(Func f, const C&... values) {
 struct heartbeat_request_data
   : serde::envelope<
       heartbeat_request_data,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::revision_id source_revision;
     model::revision_id target_revision;
@@ -210,6 +210,9 @@ struct heartbeat_request_data
     model::offset prev_log_index;
     model::term_id prev_log_term;
     model::offset last_visible_index;
+    // asks the follower to stop expecting heartbeats of the group for the
+    // quiescence lease, as long as the leader node keeps heart beating
+    bool quiesce = false;
 
     auto serde_fields() {
         return std::tie(
@@ -219,7 +222,8 @@ struct heartbeat_request_data
           term,
           prev_log_index,
           prev_log_term,
-          last_visible_index);
+          last_visible_index,
+          quiesce);
     }
 
     friend bool
@@ -230,7 +234,7 @@ struct heartbeat_request_data
 struct heartbeat_reply_data
   : serde::envelope<
       heartbeat_reply_data,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::revision_id source_revision;
     model::revision_id target_revision;
@@ -241,6 +245,8 @@ struct heartbeat_reply_data
     model::offset last_term_base_offset;
 
     bool may_recover = false;
+    // the follower entered quiescence requested by the heartbeat
+    bool quiesced = false;
 
     auto serde_fields() {
         return std::tie(
@@ -250,7 +256,8 @@ struct heartbeat_reply_data
           last_flushed_log_index,
           last_dirty_log_index,
           last_term_base_offset,
-          may_recover);
+          may_recover,
+          quiesced);
     }
 
     friend bool
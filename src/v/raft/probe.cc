@@ -151,6 +151,24 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _replicate_batch_flushed; },
           sm::description("Number of replicate batch flushes"),
           labels),
+        sm::make_gauge(
+          "replicate_batch_flush_delay_us",
+          [this] { return _replicate_batch_flush_delay.count(); },
+          sm::description("Delay applied to the last replicate batch flush "
+                          "by the adaptive batching policy"),
+          labels),
+        sm::make_gauge(
+          "replicate_append_latency_us",
+          [this] { return _replicate_append_latency.count(); },
+          sm::description("Moving average of the time it takes to append a "
+                          "replicate batch to the leader log"),
+          labels),
+        sm::make_gauge(
+          "replicate_quorum_latency_us",
+          [this] { return _replicate_quorum_latency.count(); },
+          sm::description("Moving average of the time it takes a majority of "
+                          "replicas to append a replicate batch"),
+          labels),
         sm::make_counter(
           "lightweight_heartbeat_requests",
           [this] { return _lw_heartbeat_requests; },
@@ -162,6 +180,12 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _full_heartbeat_requests; },
           sm::description("Number of full heartbeats sent by the leader"),
           labels),
+        sm::make_counter(
+          "linearizable_barrier_leases",
+          [this] { return _linearizable_barrier_leases; },
+          sm::description(
+            "Number of linearizable barriers served from the leader lease"),
+          labels),
       },
       {},
       {sm::shard_label, sm::label("partition")});
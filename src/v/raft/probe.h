@@ -16,6 +16,7 @@
 #include <seastar/core/metrics.hh>
 #include <seastar/core/metrics_registration.hh>
 
+#include <chrono>
 #include <cstdint>
 namespace raft {
 class probe {
@@ -46,6 +47,14 @@ public:
     void log_flushed() { ++_log_flushes; }
 
     void replicate_batch_flushed() { ++_replicate_batch_flushed; }
+    void replicate_batch_flush_delay(std::chrono::microseconds d) {
+        _replicate_batch_flush_delay = d;
+    }
+    void replicate_latencies(
+      std::chrono::microseconds append, std::chrono::microseconds quorum) {
+        _replicate_append_latency = append;
+        _replicate_quorum_latency = quorum;
+    }
     void recovery_append_request() { ++_recovery_requests; }
     void configuration_update() { ++_configuration_updates; }
 
@@ -63,6 +72,7 @@ public:
 
     void full_heartbeat() { ++_full_heartbeat_requests; }
     void lw_heartbeat() { ++_lw_heartbeat_requests; }
+    void linearizable_barrier_lease() { ++_linearizable_barrier_leases; }
 
     void clear() {
         _metrics.clear();
@@ -80,6 +90,9 @@ private:
     uint64_t _replicate_requests_done = 0;
     uint64_t _log_flushes = 0;
     uint64_t _replicate_batch_flushed = 0;
+    std::chrono::microseconds _replicate_batch_flush_delay{0};
+    std::chrono::microseconds _replicate_append_latency{0};
+    std::chrono::microseconds _replicate_quorum_latency{0};
     uint32_t _log_truncations = 0;
     uint32_t _configuration_updates = 0;
     uint64_t _recovery_requests = 0;
@@ -89,6 +102,7 @@ private:
     uint64_t _recovery_request_error = 0;
     uint64_t _full_heartbeat_requests = 0;
     uint64_t _lw_heartbeat_requests = 0;
+    uint64_t _linearizable_barrier_leases = 0;
 
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
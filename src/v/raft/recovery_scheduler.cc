@@ -10,6 +10,7 @@
 #include "raft/recovery_scheduler.h"
 
 #include "base/vassert.h"
+#include "config/configuration.h"
 #include "metrics/prometheus_sanitize.h"
 #include "raft/consensus.h"
 #include "raft/types.h"
@@ -145,6 +146,20 @@ static bool is_internal(const model::ntp& ntp) {
            || (ntp.ns == model::kafka_namespace && ntp.tp.topic == model::kafka_consumer_offsets_topic);
 }
 
+recovery_priority recovery_priority_of(const model::ntp& ntp) {
+    if (is_internal(ntp)) {
+        return recovery_priority::high;
+    }
+    if (ntp.ns != model::kafka_namespace) {
+        return recovery_priority::normal;
+    }
+    const auto& topics
+      = config::shard_local_cfg().raft_recovery_priority_topics();
+    return std::ranges::find(topics, ntp.tp.topic()) != topics.end()
+             ? recovery_priority::high
+             : recovery_priority::normal;
+}
+
 void recovery_scheduler_base::add(follower_recovery_state& frs) {
     if (frs.ntp() == model::controller_ntp) {
         frs._is_active = true;
@@ -228,7 +243,7 @@ void recovery_scheduler_base::activate_some() {
         }
 
         // ordinary user partition needing recovery
-        int priority = 0;
+        int priority = 1;
 
         if (is_internal(frs.ntp())) {
             // internal partitions get higher priority as we want them fully
@@ -245,7 +260,12 @@ void recovery_scheduler_base::activate_some() {
                 // learners to fully recover before removing other replicas and
                 // thus they don't conribute to the number of under-replicated
                 // partitions)
-                priority = 1;
+                priority = 2;
+            } else if (
+              recovery_priority_of(frs.ntp()) == recovery_priority::high) {
+                // partitions of the topics configured as critical regain their
+                // full replication factor before the bulk of user partitions
+                priority = 0;
             }
         }
 
@@ -14,6 +14,7 @@
 #include "container/intrusive_list_helpers.h"
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
+#include "raft/coordinated_recovery_throttle.h"
 #include "raft/fwd.h"
 #include "seastar/core/gate.hh"
 #include "seastar/core/lowres_clock.hh"
@@ -25,6 +26,12 @@ namespace raft {
 
 class recovery_scheduler_base;
 
+/**
+ * Internal partitions and partitions of `raft_recovery_priority_topics` are
+ * recovered with high priority.
+ */
+recovery_priority recovery_priority_of(const model::ntp&);
+
 /**
  * Summarized state of a recovery_scheduler.  Use merge()
  * across statuses from all shards to get a total node state.
@@ -98,7 +105,8 @@ private:
  *
  * This class is responsible for limiting the number of recoveries
  * done to a single shard (and therefore to a single node) at once, and
- * prioritizing them to recover important metadata before bulk data.
+ * prioritizing them to recover important metadata and topics configured in
+ * `raft_recovery_priority_topics` before bulk data.
  *
  * It is split into a "base" class that contains most of the logic, and
  * then specialized into a subclass that contains timing code, so that the
@@ -11,6 +11,8 @@
 
 #include "base/outcome_future_utils.h"
 #include "bytes/iostream.h"
+#include "config/configuration.h"
+#include "features/feature_table.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "raft/consensus.h"
@@ -19,13 +21,17 @@
 #include "raft/logger.h"
 #include "raft/raftgen_service.h"
 #include "ssx/sformat.h"
+#include "storage/segment.h"
+#include "storage/segment_set.h"
 #include "storage/snapshot.h"
 #include "utils/human.h"
 
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/io_priority_class.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/with_scheduling_group.hh>
 
@@ -151,6 +157,10 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
           });
         co_return;
     }
+    // whole closed segments missing on the follower are sent as files
+    if (auto seg = segment_to_transfer(follower_next_offset); seg) {
+        co_return co_await transfer_segment(std::move(seg), iopc, is_learner);
+    }
     // acquire read memory:
     auto read_memory_units = co_await _memory_quota.acquire_read_memory();
     auto reader = co_await read_range_for_recovery(
@@ -165,6 +175,11 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
         co_return;
     }
 
+    if (_ptr->_configuration_manager.get_latest().is_witness(_node_id)) {
+        // witness stores only headers of data batches, don't send the data
+        *reader = details::make_witness_reader(std::move(*reader));
+    }
+
     auto flush = should_flush(follower_committed_match_index);
     if (flush == flush_after_append::yes) {
         _recovered_bytes_since_flush = 0;
@@ -217,12 +232,12 @@ recovery_stm::required_snapshot_type recovery_stm::get_required_snapshot_type(
      * use greater than (not greater than or equal) while the other branch is
      * comparing next index with last included snapshot offset
      */
-    if (
-      follower_metadata.is_learner && _ptr->get_learner_start_offset()
-      && follower_metadata.next_index < *_ptr->get_learner_start_offset()) {
-        // current snapshot moved beyond configured learner start offset, we can
-        // use current snapshot instead creating a new on demand one
-        if (*_ptr->get_learner_start_offset() <= _ptr->last_snapshot_index()) {
+    const auto start_offset = on_demand_snapshot_start_offset(
+      follower_metadata);
+    if (start_offset && follower_metadata.next_index < *start_offset) {
+        // current snapshot moved beyond the start offset, we can use current
+        // snapshot instead creating a new on demand one
+        if (*start_offset <= _ptr->last_snapshot_index()) {
             return required_snapshot_type::current;
         }
         return required_snapshot_type::on_demand;
@@ -232,6 +247,36 @@ recovery_stm::required_snapshot_type recovery_stm::get_required_snapshot_type(
     return required_snapshot_type::none;
 }
 
+std::optional<model::offset> recovery_stm::on_demand_snapshot_start_offset(
+  const follower_index_metadata& follower_metadata) const {
+    if (follower_metadata.is_learner) {
+        return _ptr->get_learner_start_offset();
+    }
+    /**
+     * Voters lagging far behind skip the entries that are available in cloud
+     * storage, so that they don't have to be read from the leader disk. The
+     * follower reads them from cloud storage when they are requested.
+     */
+    const auto min_lag
+      = config::shard_local_cfg().raft_recovery_cloud_storage_min_lag_bytes();
+    if (!min_lag || !_ptr->_follower_recovery_start_offset) {
+        return std::nullopt;
+    }
+    const auto start_offset = _ptr->_follower_recovery_start_offset();
+    if (
+      !start_offset || *start_offset <= follower_metadata.next_index
+      || *start_offset > model::next_offset(_ptr->committed_offset())) {
+        return std::nullopt;
+    }
+    const auto lag = _ptr->_log->size_bytes_after_offset(
+                       follower_metadata.next_index)
+                     - _ptr->_log->size_bytes_after_offset(*start_offset);
+    if (lag < *min_lag) {
+        return std::nullopt;
+    }
+    return start_offset;
+}
+
 ss::future<std::optional<model::record_batch_reader>>
 recovery_stm::read_range_for_recovery(
   model::offset start_offset,
@@ -296,7 +341,7 @@ recovery_stm::read_range_for_recovery(
               size,
               _ptr->_recovery_throttle->get().available());
             co_await _ptr->_recovery_throttle->get()
-              .throttle(size, _ptr->_as)
+              .throttle(size, _ptr->_as, recovery_priority_of(_ptr->ntp()))
               .handle_exception_type([this](const ss::broken_semaphore&) {
                   vlog(_ctxlog.info, "Recovery throttling has stopped");
               });
@@ -430,14 +475,21 @@ ss::future<> recovery_stm::handle_install_snapshot_reply(
 }
 
 ss::future<> recovery_stm::install_snapshot(required_snapshot_type s_type) {
-    const auto learner_start_offset = _ptr->get_learner_start_offset();
     // open reader if not yet available
     if (!_snapshot_reader) {
-        if (
-          s_type == required_snapshot_type::on_demand
-          && learner_start_offset > _ptr->start_offset()) {
+        std::optional<model::offset> start_offset;
+        if (s_type == required_snapshot_type::on_demand) {
+            auto meta = get_follower_meta();
+            if (!meta) {
+                // stop recovery when node was removed
+                _stop_requested = true;
+                co_return;
+            }
+            start_offset = on_demand_snapshot_start_offset(*meta.value());
+        }
+        if (start_offset > _ptr->start_offset()) {
             co_await take_on_demand_snapshot(
-              model::prev_offset(*learner_start_offset));
+              model::prev_offset(*start_offset));
         } else {
             co_await open_current_snapshot();
         }
@@ -511,6 +563,232 @@ recovery_stm::take_on_demand_snapshot(model::offset last_included_offset) {
       });
 }
 
+ss::lw_shared_ptr<storage::segment>
+recovery_stm::segment_to_transfer(model::offset follower_next_offset) const {
+    if (
+      _segment_transfer_failed
+      || _ptr->_configuration_manager.get_latest().is_witness(_node_id)
+      || !config::shard_local_cfg().raft_recovery_segment_transfer_enabled()
+      || !_ptr->_features.is_active(
+        features::feature::raft_segment_transfer_recovery)) {
+        return nullptr;
+    }
+    const auto& segments = _ptr->_log->segments();
+    auto it = segments.lower_bound(follower_next_offset);
+    // the last segment is always recovered with batches, it may still be
+    // appended to
+    if (it == segments.end() || std::next(it) == segments.end()) {
+        return nullptr;
+    }
+    const auto& seg = *it;
+    if (
+      seg->offsets().get_base_offset() != follower_next_offset
+      || seg->has_appender() || seg->is_tombstone()) {
+        return nullptr;
+    }
+    return seg;
+}
+
+ss::future<> recovery_stm::transfer_segment(
+  ss::lw_shared_ptr<storage::segment> seg,
+  ss::io_priority_class iopc,
+  bool is_learner) {
+    // prevents the segment from being removed or rewritten while its files
+    // are read
+    auto lock = co_await seg->read_lock();
+    if (seg->is_tombstone() || is_recovery_finished()) {
+        co_return;
+    }
+
+    const auto base_offset = seg->offsets().get_base_offset();
+    const auto prev_log_idx = model::prev_offset(base_offset);
+    model::term_id prev_log_term;
+    if (prev_log_idx > _ptr->_last_snapshot_index) {
+        prev_log_term = _ptr->_log->get_term(prev_log_idx).value_or(
+          model::term_id{});
+    } else if (prev_log_idx == _ptr->_last_snapshot_index) {
+        prev_log_term = _ptr->_last_snapshot_term;
+    } else if (prev_log_idx >= model::offset(0)) {
+        // no entry for prev_log_idx, will fallback to install snapshot on next
+        // iteration
+        _segment_transfer_failed = true;
+        co_return;
+    }
+
+    const auto& path = seg->path();
+    std::vector<std::pair<segment_file_type, ss::sstring>> files;
+    files.emplace_back(segment_file_type::index, path.to_index().string());
+    auto compaction_index = path.to_compacted_index().string();
+    if (co_await ss::file_exists(compaction_index)) {
+        files.emplace_back(
+          segment_file_type::compaction_index, std::move(compaction_index));
+    }
+    files.emplace_back(segment_file_type::data, path.string());
+
+    _base_batch_offset = base_offset;
+    _last_batch_offset = seg->offsets().get_dirty_offset();
+    vlog(
+      _ctxlog.info,
+      "transferring segment {} with offsets [{},{}], size: {}",
+      path,
+      _base_batch_offset,
+      _last_batch_offset,
+      human::bytes(seg->size_bytes()));
+
+    transfer_segment_request req{
+      .target_node_id = _node_id,
+      .term = _term,
+      .group = _ptr->group(),
+      .node_id = _ptr->_self,
+      .prev_log_index = prev_log_idx,
+      .prev_log_term = prev_log_term,
+      .base_offset = base_offset,
+      .segment_term = seg->offsets().get_term(),
+      .commit_index = std::min(_last_batch_offset, _committed_offset),
+    };
+
+    for (auto& [type, name] : files) {
+        auto f = co_await ss::open_file_dma(name, ss::open_flags::ro);
+        const auto size = co_await f.size();
+        ss::file_input_stream_options opts;
+        opts.io_priority_class = iopc;
+        auto input = ss::make_file_input_stream(std::move(f), opts);
+
+        req.file = type;
+        std::exception_ptr error;
+        bool sent = false;
+        try {
+            sent = co_await send_segment_file(req, input, size, is_learner);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        co_await input.close();
+        if (error) {
+            vlog(
+              _ctxlog.warn,
+              "error transferring segment {} file {} - {}",
+              path,
+              type,
+              error);
+            _segment_transfer_failed = true;
+            co_return;
+        }
+        if (!sent) {
+            co_return;
+        }
+    }
+}
+
+ss::future<bool> recovery_stm::send_segment_file(
+  const transfer_segment_request& tmpl,
+  ss::input_stream<char>& input,
+  uint64_t size,
+  bool is_learner) {
+    uint64_t sent_bytes = 0;
+    do {
+        if (is_recovery_finished()) {
+            co_return false;
+        }
+        auto read_memory_units = co_await _memory_quota.acquire_read_memory();
+        auto chunk = co_await read_iobuf_exactly(
+          input, read_memory_units.count());
+        const auto chunk_size = chunk.size_bytes();
+        if (is_learner && _ptr->_recovery_throttle) {
+            co_await _ptr->_recovery_throttle->get()
+              .throttle(
+                chunk_size, _ptr->_as, recovery_priority_of(_ptr->ntp()))
+              .handle_exception_type([this](const ss::broken_semaphore&) {
+                  vlog(_ctxlog.info, "Recovery throttling has stopped");
+              });
+        }
+
+        transfer_segment_request req{
+          .target_node_id = tmpl.target_node_id,
+          .term = tmpl.term,
+          .group = tmpl.group,
+          .node_id = tmpl.node_id,
+          .prev_log_index = tmpl.prev_log_index,
+          .prev_log_term = tmpl.prev_log_term,
+          .base_offset = tmpl.base_offset,
+          .segment_term = tmpl.segment_term,
+          .file = tmpl.file,
+          .file_offset = sent_bytes,
+          .chunk = std::move(chunk),
+          .done = sent_bytes + chunk_size >= size,
+          .commit_index = tmpl.commit_index,
+        };
+        sent_bytes += chunk_size;
+        const bool done = req.done;
+        if (done && req.file == segment_file_type::data) {
+            auto meta = get_follower_meta();
+            if (!meta) {
+                _stop_requested = true;
+                co_return false;
+            }
+            (*meta)->expected_log_end_offset = _last_batch_offset;
+        }
+
+        vlog(_ctxlog.trace, "sending transfer_segment request: {}", req);
+        auto append_guard = _ptr->track_append_inflight(_node_id);
+        auto reply = co_await _ptr->_client_protocol.transfer_segment(
+          _node_id.id(),
+          std::move(req),
+          rpc::client_opts(append_entries_timeout()));
+        if (!handle_transfer_segment_reply(
+              tmpl,
+              done,
+              sent_bytes,
+              _ptr->validate_reply_target_node(
+                "transfer_segment", std::move(reply), _node_id.id()))) {
+            co_return false;
+        }
+    } while (sent_bytes < size);
+    co_return true;
+}
+
+bool recovery_stm::handle_transfer_segment_reply(
+  const transfer_segment_request& req,
+  bool done,
+  uint64_t bytes_sent,
+  result<transfer_segment_reply> reply) {
+    vlog(_ctxlog.trace, "received transfer_segment reply: {}", reply);
+    if (reply.has_error()) {
+        _ptr->get_probe().recovery_request_error();
+        _segment_transfer_failed = true;
+        return false;
+    }
+    if (reply.value().term > _ptr->_term) {
+        // heartbeats will make the leader step down, stop recovery
+        _stop_requested = true;
+        return false;
+    }
+    if (!reply.value().success || reply.value().bytes_stored != bytes_sent) {
+        vlog(
+          _ctxlog.info,
+          "follower refused segment with base offset {}, falling back to "
+          "batch recovery",
+          req.base_offset);
+        _segment_transfer_failed = true;
+        return false;
+    }
+    if (!done || req.file != segment_file_type::data) {
+        return true;
+    }
+
+    auto meta = get_follower_meta();
+    if (!meta) {
+        _stop_requested = true;
+        return false;
+    }
+    // segment adopted by the follower, continue with recovery
+    (*meta)->last_dirty_log_index = reply.value().last_dirty_log_index;
+    (*meta)->last_flushed_log_index = reply.value().last_flushed_log_index;
+    (*meta)->match_index = reply.value().last_dirty_log_index;
+    (*meta)->next_index = model::next_offset(
+      reply.value().last_dirty_log_index);
+    return true;
+}
+
 ss::future<> recovery_stm::replicate(
   model::record_batch_reader&& reader,
   flush_after_append flush,
@@ -644,6 +922,7 @@ ss::future<result<append_entries_reply>> recovery_stm::dispatch_append_entries(
     _ptr->_probe->recovery_append_request();
 
     rpc::client_opts opts(append_entries_timeout());
+    _ptr->set_append_entries_compression(opts);
     opts.resource_units = ss::make_foreign(
       ss::make_lw_shared<std::vector<ssx::semaphore_units>>(std::move(units)));
 
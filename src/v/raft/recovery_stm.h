@@ -15,6 +15,7 @@
 #include "raft/fwd.h"
 #include "raft/recovery_memory_quota.h"
 #include "raft/types.h"
+#include "storage/fwd.h"
 #include "storage/snapshot.h"
 #include "utils/prefix_logger.h"
 
@@ -75,8 +76,26 @@ private:
     ss::future<> take_on_demand_snapshot(model::offset);
     ss::future<iobuf> read_snapshot_chunk();
     ss::future<> close_snapshot_reader();
+
+    ss::lw_shared_ptr<storage::segment>
+      segment_to_transfer(model::offset) const;
+    ss::future<> transfer_segment(
+      ss::lw_shared_ptr<storage::segment>, ss::io_priority_class, bool);
+    ss::future<bool> send_segment_file(
+      const transfer_segment_request&,
+      ss::input_stream<char>&,
+      uint64_t,
+      bool);
+    bool handle_transfer_segment_reply(
+      const transfer_segment_request&,
+      bool,
+      uint64_t,
+      result<transfer_segment_reply>);
+
     required_snapshot_type get_required_snapshot_type(
       const follower_index_metadata& follower_metadata) const;
+    std::optional<model::offset>
+    on_demand_snapshot_start_offset(const follower_index_metadata&) const;
     bool is_recovery_finished();
     flush_after_append should_flush(model::offset) const;
     consensus* _ptr;
@@ -102,6 +121,9 @@ private:
     bool _stop_requested = false;
     recovery_memory_quota& _memory_quota;
     size_t _recovered_bytes_since_flush = 0;
+    // set when a segment transfer failed, the rest of the recovery replicates
+    // batches
+    bool _segment_transfer_failed = false;
 };
 
 } // namespace raft
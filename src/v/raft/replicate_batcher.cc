@@ -15,6 +15,7 @@
 #include "raft/types.h"
 #include "ssx/future-util.h"
 
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
@@ -24,11 +25,55 @@
 
 namespace raft {
 using namespace std::chrono_literals; // NOLINT
-replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
+
+namespace {
+// weight of the history, samples are taken one per window
+constexpr double latency_ema_alpha = 0.8;
+constexpr size_t latency_ema_windows = 8;
+
+std::chrono::microseconds ema_sample_to_us(double ms) {
+    return std::chrono::microseconds(static_cast<int64_t>(ms * 1000));
+}
+} // namespace
+
+replicate_batcher::replicate_batcher(
+  consensus* ptr,
+  size_t cache_size,
+  config::binding<std::chrono::milliseconds> max_flush_delay)
   : _ptr(ptr)
+  , _max_flush_delay(std::move(max_flush_delay))
+  , _last_arrival(latency_clock::now())
+  // until there is some history requests are considered infrequent and
+  // replication instant, so nothing is held back
+  , _arrival_interval(latency_ema_alpha, 1s, latency_ema_windows)
+  , _append_latency(latency_ema_alpha, 0s, latency_ema_windows)
+  , _replication_latency(latency_ema_alpha, 0s, latency_ema_windows)
   , _max_batch_size_sem(cache_size, "raft/repl-batch")
   , _max_batch_size(cache_size) {}
 
+void replicate_batcher::record_arrival() {
+    const auto now = latency_clock::now();
+    _arrival_interval.tick();
+    _arrival_interval.update(now - _last_arrival);
+    _last_arrival = now;
+}
+
+std::chrono::microseconds replicate_batcher::flush_delay() {
+    const auto max_delay = std::chrono::duration_cast<std::chrono::microseconds>(
+      _max_flush_delay());
+    if (max_delay <= 0us) {
+        return 0us;
+    }
+    const auto window = std::min(
+      max_delay, ema_sample_to_us(_replication_latency.sample()) / 4);
+    // by Little's law window / arrival interval more requests are expected
+    // to arrive while the first one waits, don't wait for less than one
+    if (ema_sample_to_us(_arrival_interval.sample()) >= window) {
+        return 0us;
+    }
+    return window;
+}
+
 replicate_stages replicate_batcher::replicate(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader r,
@@ -51,6 +96,7 @@ replicate_batcher::cache_and_wait_for_result(
     try {
         auto holder = _bg.hold();
         item = co_await do_cache(expected_term, std::move(r), opts);
+        record_arrival();
 
         // now request is already enqueued, we can release first
         // stage future
@@ -65,10 +111,26 @@ replicate_batcher::cache_and_wait_for_result(
          * replicate batcher stop method
          *
          */
+        /**
+         * The flush delay only pays off for acks=all requests, which wait for
+         * the replication round trip anyway. acks=1 and acks=0 requests are
+         * acknowledged right after the leader append, so holding them back
+         * would add the delay to their latency directly. Such requests flush
+         * immediately and cut short a delay that is already pending.
+         */
+        const bool relaxed = opts.consistency
+                             != consistency_level::quorum_ack;
         if (!_flush_pending) {
             _flush_pending = true;
-            ssx::background = ssx::spawn_with_gate_then(_bg, [this]() {
-                return _lock.get_units()
+            const auto delay = relaxed ? 0us : flush_delay();
+            _ptr->_probe->replicate_batch_flush_delay(delay);
+            ssx::background = ssx::spawn_with_gate_then(_bg, [this, delay]() {
+                auto wait = delay > 0us
+                              ? _flush_delay_cv.wait(delay).handle_exception_type(
+                                  [](const ss::condition_variable_timed_out&) {})
+                              : ss::now();
+                return std::move(wait)
+                  .then([this] { return _lock.get_units(); })
                   .then([this](auto units) {
                       return flush(std::move(units), false);
                   })
@@ -83,6 +145,8 @@ replicate_batcher::cache_and_wait_for_result(
                         e);
                   });
             });
+        } else if (relaxed) {
+            _flush_delay_cv.signal();
         }
     } catch (...) {
         // exception in caching phase
@@ -94,6 +158,7 @@ replicate_batcher::cache_and_wait_for_result(
 }
 
 ss::future<> replicate_batcher::stop() {
+    _flush_delay_cv.broadcast();
     return _bg.close().then([this] {
         // we keep a lock here to make sure that all inflight requests have
         // finished already
@@ -327,7 +392,12 @@ ss::future<> replicate_batcher::do_flush(
       _ptr, std::move(req), std::move(seqs));
     try {
         auto holder = _bg.hold();
+        const auto started = latency_clock::now();
         auto leader_result = co_await stm->apply(std::move(u));
+        if (leader_result) {
+            _append_latency.tick();
+            _append_latency.update(latency_clock::now() - started);
+        }
 
         /**
          * First phase, if leader result has error just propagate error
@@ -350,9 +420,19 @@ ss::future<> replicate_batcher::do_flush(
          */
         if (leader_result) {
             (void)stm->wait_for_majority()
-              .then([holder = std::move(holder),
+              .then([this,
+                     started,
+                     holder = std::move(holder),
                      notifications = std::move(notifications)](
                       result<replicate_result> quorum_result) mutable {
+                  if (quorum_result) {
+                      _replication_latency.tick();
+                      _replication_latency.update(
+                        latency_clock::now() - started);
+                      _ptr->_probe->replicate_latencies(
+                        ema_sample_to_us(_append_latency.sample()),
+                        ema_sample_to_us(_replication_latency.sample()));
+                  }
                   propagate_result(
                     quorum_result, notifications, [](const item_ptr& item) {
                         return item->get_consistency_level()
@@ -71,6 +71,7 @@ replicate_entries_stm::send_append_entries_request(
     vlog(_ctxlog.trace, "Sending append entries request {} to {}", _meta, n);
 
     auto opts = rpc::client_opts(append_entries_timeout());
+    _ptr->set_append_entries_compression(opts);
     opts.resource_units = ss::make_foreign<ss::lw_shared_ptr<units_t>>(_units);
 
     auto f = _ptr->_fstats.get_append_entries_unit(n).then_wrapped(
@@ -88,6 +89,18 @@ replicate_entries_stm::send_append_entries_request(
                 make_error_code(errc::append_entries_dispatch_error));
           }
           auto u = f.get();
+          if (should_drop_queued_request(n)) {
+              vlog(
+                _ctxlog.trace,
+                "Dropping append entries request {} to {} - follower "
+                "rejected a preceding request",
+                _meta,
+                n);
+              u.return_all();
+              _ptr->_fstats.return_append_entries_units(n);
+              return ss::make_ready_future<result<append_entries_reply>>(
+                make_error_code(errc::append_entries_dispatch_error));
+          }
 
           return _ptr->_client_protocol
             .append_entries(
@@ -132,6 +145,10 @@ ss::future<> replicate_entries_stm::dispatch_remote_append_entries(vnode id) {
       id);
     return share_batches()
       .then([this, id](model::record_batch_reader batches) mutable {
+          if (_ptr->_configuration_manager.get_latest().is_witness(id)) {
+              // witness stores only headers of data batches
+              batches = details::make_witness_reader(std::move(batches));
+          }
           return send_append_entries_request(id, std::move(batches));
       })
       .then([this, id](result<append_entries_reply> reply) {
@@ -253,6 +270,25 @@ inline bool replicate_entries_stm::should_skip_follower_request(vnode id) {
     return false;
 }
 
+/**
+ * Requests to a follower are pipelined, up to the follower queue capacity of
+ * them being in flight at once, each one expecting the follower to have
+ * appended the entries of the preceding ones. Once the follower rejects one
+ * of them the requests still waiting for a slot in the queue can not succeed
+ * either, dropping them frees the pipeline for recovery right away instead
+ * of after a round trip per request.
+ */
+bool replicate_entries_stm::should_drop_queued_request(vnode id) {
+    auto it = _ptr->_fstats.find(id);
+    if (it == _ptr->_fstats.end()) {
+        return false;
+    }
+    auto seq_it = _followers_seq.find(id);
+    vassert(
+      seq_it != _followers_seq.end(), "No follower sequence found for {}", id);
+    return seq_it->second <= it->second.last_rejected_sent_seq;
+}
+
 ss::future<result<replicate_result>> replicate_entries_stm::apply(units_t u) {
     // first append lo leader log, no flushing
     auto cfg = _ptr->config();
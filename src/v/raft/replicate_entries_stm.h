@@ -108,6 +108,7 @@ private:
     result<replicate_result>
       process_result(raft::errc, model::offset, model::term_id);
     bool should_skip_follower_request(vnode);
+    bool should_drop_queued_request(vnode);
     clock_type::time_point append_entries_timeout();
     /// This append will happen under the lock
     ss::future<result<storage::append_result>> append_to_self();
@@ -33,7 +33,8 @@ ss::future<result<vote_reply>> rpc_client_protocol::vote(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.vote(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<vote_reply>);
-      });
+      },
+      rpc::connection_class::priority);
 }
 
 ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
@@ -41,6 +42,11 @@ ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
   append_entries_request&& r,
   rpc::client_opts opts,
   bool use_all_serde_encoding) {
+    if (
+      likely(use_all_serde_encoding) && _multiplexer
+      && _multiplexer->enabled()) {
+        return _multiplexer->append_entries(n, std::move(r), std::move(opts));
+    }
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -73,7 +79,8 @@ ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.heartbeat(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<heartbeat_reply>);
-      });
+      },
+      rpc::connection_class::priority);
 }
 ss::future<result<heartbeat_reply_v2>> rpc_client_protocol::heartbeat_v2(
   model::node_id n, heartbeat_request_v2&& r, rpc::client_opts opts) {
@@ -87,7 +94,8 @@ ss::future<result<heartbeat_reply_v2>> rpc_client_protocol::heartbeat_v2(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.heartbeat_v2(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<heartbeat_reply_v2>);
-      });
+      },
+      rpc::connection_class::priority);
 }
 
 ss::future<result<install_snapshot_reply>>
@@ -106,6 +114,22 @@ rpc_client_protocol::install_snapshot(
       });
 }
 
+ss::future<result<transfer_segment_reply>>
+rpc_client_protocol::transfer_segment(
+  model::node_id n, transfer_segment_request&& r, rpc::client_opts opts) {
+    auto timeout = opts.timeout;
+    return _connection_cache.local().with_node_client<raftgen_client_protocol>(
+      _self,
+      ss::this_shard_id(),
+      n,
+      timeout,
+      [r = std::move(r),
+       opts = std::move(opts)](raftgen_client_protocol client) mutable {
+          return client.transfer_segment(std::move(r), std::move(opts))
+            .then(&rpc::get_ctx_data<transfer_segment_reply>);
+      });
+}
+
 ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
   model::node_id n, timeout_now_request&& r, rpc::client_opts opts) {
     auto timeout = opts.timeout;
@@ -118,7 +142,8 @@ ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.timeout_now(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<timeout_now_reply>);
-      });
+      },
+      rpc::connection_class::priority);
 }
 
 ss::future<> rpc_client_protocol::reset_backoff(model::node_id n) {
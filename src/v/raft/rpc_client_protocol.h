@@ -12,6 +12,7 @@
 #pragma once
 
 #include "model/metadata.h"
+#include "raft/append_entries_multiplexer.h"
 #include "raft/consensus_client_protocol.h"
 #include "raft/types.h"
 #include "rpc/fwd.h"
@@ -21,10 +22,15 @@ namespace raft {
 /// Raft client protocol implementation underlied by RPC connections cache
 class rpc_client_protocol final : public consensus_client_protocol::impl {
 public:
+    /// If `multiplexer` is set, append entries requests are sent through it
+    /// whenever it is enabled. It must outlive the protocol.
     explicit rpc_client_protocol(
-      model::node_id self, ss::sharded<rpc::connection_cache>& cache)
+      model::node_id self,
+      ss::sharded<rpc::connection_cache>& cache,
+      append_entries_multiplexer* multiplexer = nullptr)
       : _self(self)
-      , _connection_cache(cache) {}
+      , _connection_cache(cache)
+      , _multiplexer(multiplexer) {}
 
     ss::future<result<vote_reply>>
     vote(model::node_id, vote_request&&, rpc::client_opts) final;
@@ -44,6 +50,9 @@ public:
     ss::future<result<install_snapshot_reply>> install_snapshot(
       model::node_id, install_snapshot_request&&, rpc::client_opts) final;
 
+    ss::future<result<transfer_segment_reply>> transfer_segment(
+      model::node_id, transfer_segment_request&&, rpc::client_opts) final;
+
     ss::future<result<timeout_now_reply>>
     timeout_now(model::node_id, timeout_now_request&&, rpc::client_opts) final;
 
@@ -57,12 +66,15 @@ public:
 private:
     model::node_id _self;
     ss::sharded<rpc::connection_cache>& _connection_cache;
+    append_entries_multiplexer* _multiplexer;
 };
 
 inline consensus_client_protocol make_rpc_client_protocol(
-  model::node_id self, ss::sharded<rpc::connection_cache>& clients) {
+  model::node_id self,
+  ss::sharded<rpc::connection_cache>& clients,
+  append_entries_multiplexer* multiplexer = nullptr) {
     return raft::make_consensus_client_protocol<raft::rpc_client_protocol>(
-      self, clients);
+      self, clients, multiplexer);
 }
 
 } // namespace raft
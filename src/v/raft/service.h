@@ -13,15 +13,19 @@
 
 #include "base/likely.h"
 #include "base/seastarx.h"
+#include "bytes/iobuf_parser.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
 #include "raft/raftgen_service.h"
 #include "raft/types.h"
+#include "serde/async.h"
 
 #include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/timed_out_error.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/core/with_timeout.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
@@ -32,8 +36,10 @@
 namespace raft {
 // clang-format off
 template<typename ConsensusManager>
-concept RaftGroupManager = requires(ConsensusManager m, group_id g) {
+concept RaftGroupManager = requires(
+  ConsensusManager m, group_id g, model::node_id n) {
     { m.consensus_for(g) } -> std::same_as<ss::lw_shared_ptr<consensus>>;
+    { m.node_heartbeat_received(n) } -> std::same_as<void>;
 };
 
 template<typename ShardLookup>
@@ -112,6 +118,10 @@ public:
     heartbeat_v2(heartbeat_request_v2 r, rpc::streaming_context&) final {
         const auto source = r.source();
         const auto target = r.target();
+        // quiesced followers take any heartbeat request from the leader node,
+        // even an empty one, as a proof that the leader is alive
+        co_await _group_manager.invoke_on_all(
+          [source](ConsensusManager& m) { m.node_heartbeat_received(source); });
         auto grouped = group_hbeats_by_shard(std::move(r));
 
         std::vector<ss::future<shard_heartbeat_replies>> futures;
@@ -195,6 +205,63 @@ public:
         });
     }
 
+    ss::future<append_entries_batch_reply> append_entries_batch(
+      append_entries_batch_request r, rpc::streaming_context&) final {
+        co_await _probe.append_entries();
+
+        // Requests are decoded and dispatched in order, so that the requests
+        // of a group reach its shard in the order they were made.
+        std::vector<raft::group_id> groups;
+        std::vector<ss::future<append_entries_reply>> dispatched;
+        groups.reserve(r.requests.size());
+        dispatched.reserve(r.requests.size());
+        std::exception_ptr decode_error;
+        for (auto& encoded : r.requests) {
+            std::optional<append_entries_request> request;
+            try {
+                iobuf_parser parser(std::move(encoded));
+                request = (co_await serde::read_async<
+                             append_entries_request_serde_wrapper>(parser))
+                            .release();
+            } catch (...) {
+                decode_error = std::current_exception();
+                break;
+            }
+            const raft::group_id gr = request->target_group();
+            groups.push_back(gr);
+            dispatched.push_back(dispatch_request(
+              append_entries_request::make_foreign(std::move(*request)),
+              [gr]() { return make_missing_group_reply(gr); },
+              [](append_entries_request&& req, consensus_ptr c) {
+                  return c->append_entries(std::move(req));
+              }));
+        }
+
+        auto results = co_await ss::when_all(
+          dispatched.begin(), dispatched.end());
+        if (decode_error) {
+            for (auto& f : results) {
+                f.ignore_ready_future();
+            }
+            std::rethrow_exception(decode_error);
+        }
+
+        append_entries_batch_reply reply;
+        reply.replies.reserve(results.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i].failed()) {
+                // like a request that timed out on this node, the leader
+                // ignores the reply and sends the request again
+                results[i].ignore_ready_future();
+                reply.replies.push_back(append_entries_reply{
+                  .group = groups[i], .result = reply_result::timeout});
+            } else {
+                reply.replies.push_back(results[i].get());
+            }
+        }
+        co_return reply;
+    }
+
     [[gnu::always_inline]] ss::future<install_snapshot_reply> install_snapshot(
       install_snapshot_request r, rpc::streaming_context&) final {
         return _probe.install_snapshot().then([this,
@@ -209,6 +276,20 @@ public:
         });
     }
 
+    [[gnu::always_inline]] ss::future<transfer_segment_reply> transfer_segment(
+      transfer_segment_request r, rpc::streaming_context&) final {
+        return _probe.transfer_segment().then([this,
+                                               r = std::move(r)]() mutable {
+            return dispatch_request(
+              transfer_segment_request_foreign_wrapper(std::move(r)),
+              &service::make_failed_transfer_segment_reply,
+              [](
+                transfer_segment_request_foreign_wrapper&& r, consensus_ptr c) {
+                  return c->transfer_segment(r.copy());
+              });
+        });
+    }
+
     [[gnu::always_inline]] ss::future<timeout_now_reply>
     timeout_now(timeout_now_request r, rpc::streaming_context&) final {
         return _probe.timeout_now().then([this, r = std::move(r)]() mutable {
@@ -276,6 +357,13 @@ private:
             .term = model::term_id{}, .bytes_stored = 0, .success = false});
     }
 
+    static ss::future<transfer_segment_reply>
+    make_failed_transfer_segment_reply() {
+        return ss::make_ready_future<transfer_segment_reply>(
+          transfer_segment_reply{
+            .term = model::term_id{}, .bytes_stored = 0, .success = false});
+    }
+
     static ss::future<append_entries_reply>
     make_missing_group_reply(raft::group_id group) {
         return ss::make_ready_future<append_entries_reply>(append_entries_reply{
@@ -50,6 +50,12 @@ public:
      * method it will be retried with the same record batch.
      */
     virtual ss::future<> apply(const model::record_batch&) = 0;
+    /**
+     * Batches of types the state machine is not interested in are not passed
+     * to `apply()`, the state machine next offset is advanced past them
+     * instead. By default all batches are applied.
+     */
+    virtual bool applies_to(model::record_batch_type) const { return true; }
     /**
      * This function will be called every time a snapshot is applied in apply
      * fiber. Snapshot will contain only a data specific for this state machine
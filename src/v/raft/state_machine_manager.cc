@@ -139,7 +139,9 @@ batch_applicator::apply_to_stm(
             co_return applied_successfully::no;
         }
 
-        co_await state.stm_entry->stm->apply(batch);
+        if (state.stm_entry->stm->applies_to(batch.header().type)) {
+            co_await state.stm_entry->stm->apply(batch);
+        }
         state.stm_entry->stm->set_next(model::next_offset(last_offset));
         co_return applied_successfully::yes;
     } catch (...) {
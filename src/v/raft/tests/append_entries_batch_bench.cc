@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "model/record_batch_reader.h"
+#include "model/tests/random_batch.h"
+#include "raft/types.h"
+#include "serde/async.h"
+#include "serde/serde.h"
+#include "test_utils/randoms.h"
+
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/log.hh>
+
+#include <vector>
+
+namespace {
+static ss::logger aelog("ae-batch-perf");
+}
+
+/*
+ * Many groups replicating a small batch each to the same follower: one
+ * append_entries RPC per group, against one append_entries_batch RPC.
+ */
+struct fixture {
+    static constexpr size_t groups = 10000;
+
+    fixture() {
+        batches.reserve(groups);
+        for (size_t i = 0; i < groups; ++i) {
+            batches.push_back(
+              model::test::make_random_batches(model::offset(0), 1, false)
+                .get());
+        }
+    }
+
+    std::vector<raft::append_entries_request> make_requests() {
+        std::vector<raft::append_entries_request> ret;
+        ret.reserve(groups);
+        for (size_t i = 0; i < groups; ++i) {
+            ss::circular_buffer<model::record_batch> copy;
+            for (const auto& b : batches[i]) {
+                copy.push_back(b.copy());
+            }
+            ret.emplace_back(
+              raft::vnode(model::node_id(1), model::revision_id(1)),
+              raft::vnode(model::node_id(2), model::revision_id(1)),
+              raft::protocol_metadata{
+                .group = raft::group_id(i),
+                .commit_index = tests::random_named_int<model::offset>(),
+                .term = model::term_id(1),
+                .prev_log_index = tests::random_named_int<model::offset>(),
+                .prev_log_term = model::term_id(1),
+                .last_visible_index = tests::random_named_int<model::offset>(),
+              },
+              model::make_memory_record_batch_reader(std::move(copy)));
+        }
+        return ret;
+    }
+
+    ~fixture() {
+        aelog.info(
+          "average RPCs per run: {}, average bytes per run: {}",
+          static_cast<double>(rpcs) / cnt,
+          static_cast<double>(sz) / cnt);
+    }
+
+    std::vector<ss::circular_buffer<model::record_batch>> batches;
+    size_t cnt = 0;
+    size_t rpcs = 0;
+    size_t sz = 0;
+};
+
+PERF_TEST_C(fixture, test_append_entries_per_group) {
+    auto requests = make_requests();
+    perf_tests::start_measuring_time();
+    for (auto& r : requests) {
+        iobuf buffer;
+        co_await serde::write_async(
+          buffer, raft::append_entries_request_serde_wrapper(std::move(r)));
+        sz += buffer.size_bytes();
+        ++rpcs;
+    }
+    perf_tests::stop_measuring_time();
+    cnt++;
+}
+
+PERF_TEST_C(fixture, test_append_entries_batch) {
+    auto requests = make_requests();
+    perf_tests::start_measuring_time();
+    raft::append_entries_batch_request batch;
+    batch.requests.reserve(requests.size());
+    for (auto& r : requests) {
+        iobuf encoded;
+        co_await serde::write_async(
+          encoded, raft::append_entries_request_serde_wrapper(std::move(r)));
+        batch.requests.push_back(std::move(encoded));
+    }
+    iobuf buffer;
+    serde::write(buffer, std::move(batch));
+    perf_tests::stop_measuring_time();
+    sz += buffer.size_bytes();
+    ++rpcs;
+    cnt++;
+}
+
+PERF_TEST_C(fixture, test_append_entries_batch_decode) {
+    auto requests = make_requests();
+    raft::append_entries_batch_request batch;
+    batch.requests.reserve(requests.size());
+    for (auto& r : requests) {
+        iobuf encoded;
+        co_await serde::write_async(
+          encoded, raft::append_entries_request_serde_wrapper(std::move(r)));
+        batch.requests.push_back(std::move(encoded));
+    }
+    auto buffer = serde::to_iobuf(std::move(batch));
+
+    perf_tests::start_measuring_time();
+    auto decoded = serde::from_iobuf<raft::append_entries_batch_request>(
+      std::move(buffer));
+    for (auto& encoded : decoded.requests) {
+        iobuf_parser parser(std::move(encoded));
+        auto req = co_await serde::read_async<
+          raft::append_entries_request_serde_wrapper>(parser);
+        perf_tests::do_not_optimize(req);
+    }
+    perf_tests::stop_measuring_time();
+    ++rpcs;
+    cnt++;
+}
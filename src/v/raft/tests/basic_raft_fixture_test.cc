@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -828,3 +829,217 @@ TEST_F_CORO(raft_fixture, leadership_transfer_delay) {
     ASSERT_LE_CORO(election_time * 1.0, transfer_time * tolerance_multiplier);
     ASSERT_GE_CORO(election_time * 1.0, transfer_time / tolerance_multiplier);
 }
+
+TEST_F_CORO(raft_fixture, test_recovery_with_segment_transfer) {
+    config::shard_local_cfg().raft_recovery_segment_transfer_enabled.set_value(
+      true);
+    co_await create_simple_group(3);
+    co_await stop_node(model::node_id(2), remove_data_dir::yes);
+
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    // a few closed segments followed by the open one
+    model::offset last_offset;
+    for (int i = 0; i < 4; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(10, 10, 128),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+        last_offset = result.value().last_offset;
+        if (i < 3) {
+            co_await leader_node.raft()->log()->force_roll(
+              ss::default_priority_class());
+        }
+    }
+
+    auto& new_n2 = add_node(model::node_id(2), model::revision_id(0));
+    co_await new_n2.init_and_start(all_vnodes());
+    co_await wait_for_committed_offset(last_offset, 10s);
+    co_await assert_logs_equal();
+
+    // closed segments were adopted as they are, batch recovery would have
+    // appended all of them to a single segment
+    ASSERT_EQ_CORO(
+      new_n2.raft()->log()->segment_count(),
+      leader_node.raft()->log()->segment_count());
+}
+
+TEST_F_CORO(raft_fixture, test_lagging_follower_skips_offloaded_entries) {
+    config::shard_local_cfg()
+      .raft_recovery_cloud_storage_min_lag_bytes.set_value(
+        std::make_optional<size_t>(1));
+    co_await create_simple_group(3);
+    co_await stop_node(model::node_id(2), remove_data_dir::yes);
+
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    auto first = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(first.has_value());
+    auto second = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(second.has_value());
+
+    // pretend that the first range is available in cloud storage
+    const auto start_offset = model::next_offset(first.value().last_offset);
+    leader_node.raft()->set_follower_recovery_start_offset_fn(
+      [start_offset] { return std::make_optional(start_offset); });
+
+    auto& new_n2 = add_node(model::node_id(2), model::revision_id(0));
+    co_await new_n2.init_and_start(all_vnodes());
+    co_await wait_for_committed_offset(second.value().last_offset, 10s);
+
+    // only the tail of the log was replicated to the follower
+    ASSERT_EQ_CORO(new_n2.raft()->start_offset(), start_offset);
+    ASSERT_EQ_CORO(
+      new_n2.raft()->dirty_offset(), leader_node.raft()->dirty_offset());
+}
+
+TEST_F_CORO(raft_fixture, test_idle_group_quiescence) {
+    config::shard_local_cfg().raft_enable_quiescence.set_value(true);
+    config::shard_local_cfg().raft_quiescence_lease_ms.set_value(
+      std::chrono::milliseconds(2s));
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    const auto term = leader_node.raft()->term();
+
+    auto all_followers_quiesced = [this, leader] {
+        for (const auto& [id, n] : nodes()) {
+            if (id != leader && !n->raft()->is_quiesced()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    co_await tests::cooperative_spin_wait_with_timeout(
+      10s, all_followers_quiesced);
+
+    // leadership is stable across a few quiescence lease renewals
+    co_await ss::sleep(5s);
+    ASSERT_EQ_CORO(leader_node.raft()->term(), term);
+    ASSERT_TRUE_CORO(leader_node.raft()->is_leader());
+    for (const auto& [_, n] : nodes()) {
+        ASSERT_EQ_CORO(n->raft()->get_leader_id(), leader);
+    }
+
+    // appends end quiescence
+    result = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    ASSERT_EQ_CORO(leader_node.raft()->term(), term);
+    co_await wait_for_committed_offset(result.value().last_offset, 10s);
+    co_await assert_logs_equal();
+}
+
+TEST_F_CORO(raft_fixture, test_eager_commit_propagation) {
+    config::shard_local_cfg().raft_enable_eager_commit_propagation.set_value(
+      true);
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    for (int i = 0; i < 10; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(10, 10, 128),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+
+        // the followers learn the commit index without another append
+        co_await tests::cooperative_spin_wait_with_timeout(
+          5s, [this, committed = result.value().last_offset] {
+              for (const auto& [_, n] : nodes()) {
+                  if (n->raft()->committed_offset() < committed) {
+                      return false;
+                  }
+              }
+              return true;
+          });
+    }
+    co_await assert_logs_equal();
+}
+
+TEST_F_CORO(raft_fixture, test_linearizable_barrier_with_leader_lease) {
+    config::shard_local_cfg().raft_enable_leader_lease.set_value(true);
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    // let the followers acknowledge a few heartbeats
+    co_await ss::sleep(500ms);
+
+    // a barrier confirming leadership with the followers would be stuck
+    leader_node.on_dispatch([](model::node_id, raft::msg_type t) {
+        if (t == raft::msg_type::append_entries) {
+            return ss::sleep(5s);
+        }
+        return ss::now();
+    });
+    const auto started = clock_type::now();
+    auto barrier = co_await leader_node.raft()->linearizable_barrier();
+    ASSERT_TRUE_CORO(barrier.has_value());
+    ASSERT_GE_CORO(barrier.value(), result.value().last_offset);
+    ASSERT_TRUE_CORO(clock_type::now() - started < 1s);
+}
+
+TEST_F_CORO(raft_fixture, test_witness_stores_only_batch_headers) {
+    for (auto id = 0; id < 3; ++id) {
+        add_node(model::node_id(id), model::revision_id(0));
+    }
+    const auto witness = node(model::node_id(2)).get_vnode();
+    group_nodes initial_nodes{.voters = all_vnodes()};
+    initial_nodes.witnesses.push_back(witness);
+    for (auto& [_, n] : nodes()) {
+        co_await n->initialise(
+          group_configuration(
+            initial_nodes, model::revision_id(0), std::nullopt));
+        co_await n->start(std::nullopt);
+    }
+
+    auto leader = co_await wait_for_leader(10s);
+    ASSERT_NE_CORO(leader, witness.id());
+    auto& leader_node = node(leader);
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches(10, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    co_await wait_for_committed_offset(result.value().last_offset, 10s);
+
+    // the witness log covers the same offsets without any data
+    auto& witness_node = node(witness.id());
+    ASSERT_EQ_CORO(
+      witness_node.raft()->dirty_offset(), leader_node.raft()->dirty_offset());
+    auto reader = co_await witness_node.raft()->make_reader(
+      storage::log_reader_config(
+        witness_node.raft()->start_offset(),
+        witness_node.raft()->dirty_offset(),
+        ss::default_priority_class()));
+    auto batches = co_await model::consume_reader_to_memory(
+      std::move(reader), model::no_timeout);
+    ASSERT_FALSE_CORO(batches.empty());
+    for (const auto& b : batches) {
+        ASSERT_NE_CORO(b.header().type, model::record_batch_type::raft_data);
+    }
+
+    // the witness can not take over leadership
+    auto reply = co_await leader_node.raft()->transfer_leadership(
+      transfer_leadership_request{
+        .group = leader_node.raft()->group(),
+        .target = witness.id(),
+      });
+    ASSERT_EQ_CORO(reply.result, errc::not_voter);
+
+    // the remaining full replica is elected with the vote of the witness
+    co_await stop_node(leader);
+    auto new_leader = co_await wait_for_leader(10s);
+    ASSERT_NE_CORO(new_leader, witness.id());
+}
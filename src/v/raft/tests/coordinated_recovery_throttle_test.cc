@@ -27,6 +27,7 @@ struct test_fixture {
     // test logic simple.
     static constexpr size_t initial_rate_per_shard = 420;
     static constexpr std::chrono::seconds timeout{5};
+    static constexpr uint16_t priority_share_percent = 75;
 
     test_fixture() {
         BOOST_REQUIRE_GT(ss::smp::count, 1);
@@ -38,12 +39,15 @@ struct test_fixture {
         // coordinator_tick(). That gives more control over the test state.
         _config_rate.start(ss::smp::count * initial_rate_per_shard).get();
         _config_use_static.start(false).get();
+        _config_priority_share.start(priority_share_percent).get();
         _throttler
           .start(
             ss::sharded_parameter(
               [this] { return _config_rate.local().bind(); }),
             ss::sharded_parameter(
-              [this] { return _config_use_static.local().bind(); }))
+              [this] { return _config_use_static.local().bind(); }),
+            ss::sharded_parameter(
+              [this] { return _config_priority_share.local().bind(); }))
           .get();
         check_available_all_shards(initial_rate_per_shard);
     }
@@ -53,6 +57,7 @@ struct test_fixture {
         _throttler.stop().get();
         _config_rate.stop().get();
         _config_use_static.stop().get();
+        _config_priority_share.stop().get();
         _as.stop().get();
     }
 
@@ -63,6 +68,12 @@ struct test_fixture {
           .get();
     }
 
+    void use_static_allocation() {
+        _config_use_static
+          .invoke_on_all([](auto& local) mutable { local.update(true); })
+          .get();
+    }
+
     throttler& local() { return _throttler.local(); }
 
     ss::future<std::vector<size_t>> all_available() {
@@ -116,6 +127,7 @@ struct test_fixture {
     ss::sharded<ss::abort_source> _as{};
     ss::sharded<config::mock_property<size_t>> _config_rate;
     ss::sharded<config::mock_property<bool>> _config_use_static;
+    ss::sharded<config::mock_property<uint16_t>> _config_priority_share;
     ss::sharded<throttler> _throttler;
 };
 
@@ -266,3 +278,52 @@ FIXTURE_TEST(throttler_rate_update, test_fixture) {
         }).get();
     }
 }
+
+FIXTURE_TEST(throttler_priority_classes, test_fixture) {
+    using raft::recovery_priority;
+    // Keep the shard capacity at the fair rate, the split between the
+    // priority classes is local to the shard.
+    use_static_allocation();
+    // Both classes want way more than the capacity of the shard.
+    auto demand = initial_rate_per_shard * 4;
+    auto normal_f = local().throttle(
+      demand, _as.local(), recovery_priority::normal);
+    auto high_f = local().throttle(
+      demand, _as.local(), recovery_priority::high);
+
+    wait_until(
+      [this, demand] { return local().waiting_bytes() == 2 * demand; });
+
+    // The high priority class gets its share, the normal class the rest.
+    coordinator_tick().get();
+
+    auto expected_high = initial_rate_per_shard * priority_share_percent / 100;
+    BOOST_REQUIRE_EQUAL(
+      local().available(recovery_priority::high), expected_high);
+    BOOST_REQUIRE_EQUAL(
+      local().available(recovery_priority::normal),
+      initial_rate_per_shard - expected_high);
+
+    local().shutdown();
+    BOOST_REQUIRE_THROW(normal_f.get(), ss::broken_semaphore);
+    BOOST_REQUIRE_THROW(high_f.get(), ss::broken_semaphore);
+}
+
+FIXTURE_TEST(throttler_priority_spare_capacity, test_fixture) {
+    using raft::recovery_priority;
+    use_static_allocation();
+    // Only the high priority class needs bandwidth, it gets all of it.
+    auto demand = initial_rate_per_shard * 4;
+    auto high_f = local().throttle(
+      demand, _as.local(), recovery_priority::high);
+    wait_until([this, demand] { return local().waiting_bytes() == demand; });
+
+    coordinator_tick().get();
+
+    BOOST_REQUIRE_EQUAL(
+      local().available(recovery_priority::high), initial_rate_per_shard);
+    BOOST_REQUIRE_EQUAL(local().available(recovery_priority::normal), 0);
+
+    local().shutdown();
+    BOOST_REQUIRE_THROW(high_f.get(), ss::broken_semaphore);
+}
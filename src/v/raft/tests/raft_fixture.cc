@@ -164,6 +164,8 @@ ss::future<> channel::dispatch_loop() {
                 auto req = co_await serde::read_async<heartbeat_request_v2>(
                   req_parser);
                 heartbeat_reply_v2 reply(raft()->self().id(), req.source());
+                _node->get_heartbeat_manager().node_heartbeat_received(
+                  req.source());
 
                 for (auto& hb : req.full_heartbeats()) {
                     auto resp = co_await raft()->full_heartbeat(
@@ -192,6 +194,15 @@ ss::future<> channel::dispatch_loop() {
                 msg.resp_data.set_value(std::move(resp_buf));
                 break;
             }
+            case msg_type::transfer_segment: {
+                auto req = co_await serde::read_async<transfer_segment_request>(
+                  req_parser);
+                auto resp = co_await raft()->transfer_segment(std::move(req));
+                iobuf resp_buf;
+                co_await serde::write_async(resp_buf, std::move(resp));
+                msg.resp_data.set_value(std::move(resp_buf));
+                break;
+            }
             case msg_type::timeout_now: {
                 auto req = co_await serde::read_async<timeout_now_request>(
                   req_parser);
@@ -270,6 +281,8 @@ static constexpr msg_type map_msg_type() {
         return msg_type::timeout_now;
     } else if constexpr (std::is_same_v<ReqT, transfer_leadership_request>) {
         return msg_type::transfer_leadership;
+    } else if constexpr (std::is_same_v<ReqT, transfer_segment_request>) {
+        return msg_type::transfer_segment;
     }
     __builtin_unreachable();
 }
@@ -344,6 +357,13 @@ in_memory_test_protocol::install_snapshot(
       id, std::move(req));
 }
 
+ss::future<result<transfer_segment_reply>>
+in_memory_test_protocol::transfer_segment(
+  model::node_id id, transfer_segment_request&& req, rpc::client_opts) {
+    return dispatch<transfer_segment_request, transfer_segment_reply>(
+      id, std::move(req));
+}
+
 ss::future<result<timeout_now_reply>> in_memory_test_protocol::timeout_now(
   model::node_id id, timeout_now_request&& req, rpc::client_opts) {
     return dispatch<timeout_now_request, timeout_now_reply>(id, std::move(req));
@@ -408,17 +428,28 @@ raft_node_instance::raft_node_instance(
 
 ss::future<>
 raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
+    return initialise(
+      raft::group_configuration(std::move(initial_nodes), _revision));
+}
+
+ss::future<>
+raft_node_instance::initialise(raft::group_configuration initial_cfg) {
     _hb_manager = std::make_unique<heartbeat_manager>(
       config::mock_binding<std::chrono::milliseconds>(_election_timeout() / 10),
       consensus_client_protocol(_protocol),
       _id,
       config::mock_binding<std::chrono::milliseconds>(1000ms),
       config::mock_binding<bool>(true),
+      config::shard_local_cfg().raft_enable_quiescence.bind(),
+      config::shard_local_cfg().raft_quiescence_lease_ms.bind(),
+      config::shard_local_cfg().raft_enable_eager_commit_propagation.bind(),
       _features.local());
     co_await _hb_manager->start();
 
     co_await _recovery_throttle.start(
-      config::mock_binding<size_t>(100_MiB), config::mock_binding<bool>(false));
+      config::mock_binding<size_t>(100_MiB),
+      config::mock_binding<bool>(false),
+      config::mock_binding<uint16_t>(80));
     co_await _recovery_throttle.invoke_on_all(
       &coordinated_recovery_throttle::start);
 
@@ -440,7 +471,7 @@ raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
     _raft = ss::make_lw_shared<consensus>(
       _id,
       test_group,
-      raft::group_configuration(std::move(initial_nodes), _revision),
+      std::move(initial_cfg),
       timeout_jitter(_election_timeout),
       log,
       scheduling_config(
@@ -784,6 +815,9 @@ std::ostream& operator<<(std::ostream& o, msg_type type) {
     case msg_type::transfer_leadership:
         o << "transfer_leadership";
         return o;
+    case msg_type::transfer_segment:
+        o << "transfer_segment";
+        return o;
     }
 }
 
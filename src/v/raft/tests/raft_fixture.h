@@ -62,6 +62,7 @@ enum class msg_type {
     install_snapshot,
     timeout_now,
     transfer_leadership,
+    transfer_segment,
 };
 
 struct msg {
@@ -122,6 +123,9 @@ public:
     ss::future<result<install_snapshot_reply>> install_snapshot(
       model::node_id, install_snapshot_request&&, rpc::client_opts) final;
 
+    ss::future<result<transfer_segment_reply>> transfer_segment(
+      model::node_id, transfer_segment_request&&, rpc::client_opts) final;
+
     ss::future<result<timeout_now_reply>>
     timeout_now(model::node_id, timeout_now_request&&, rpc::client_opts) final;
 
@@ -197,6 +201,7 @@ public:
 
     // Initialise the node instance and create the consensus instance
     ss::future<> initialise(std::vector<raft::vnode> initial_nodes);
+    ss::future<> initialise(raft::group_configuration initial_cfg);
 
     // Start the node instance with an optionally provided state machine builder
     ss::future<>
@@ -244,6 +249,8 @@ public:
 
     ss::shared_ptr<in_memory_test_protocol> get_protocol() { return _protocol; }
 
+    heartbeat_manager& get_heartbeat_manager() { return *_hb_manager; }
+
 private:
     model::node_id _id;
     model::revision_id _revision;
@@ -63,6 +63,7 @@ inline static const raft::replicate_options
 using consensus_ptr = ss::lw_shared_ptr<raft::consensus>;
 struct test_raft_manager {
     consensus_ptr consensus_for(raft::group_id) { return c; };
+    void node_heartbeat_received(model::node_id) {}
     consensus_ptr c = nullptr;
 };
 
@@ -156,6 +157,10 @@ struct raft_node {
             ss::sharded_parameter([] {
                 return config::shard_local_cfg()
                   .raft_recovery_throttle_disable_dynamic_mode.bind();
+            }),
+            ss::sharded_parameter([] {
+                return config::shard_local_cfg()
+                  .raft_recovery_priority_bandwidth_percent.bind();
             }))
           .get();
 
@@ -226,6 +231,9 @@ struct raft_node {
           config::mock_binding<std::chrono::milliseconds>(
             heartbeat_interval * 20),
           config::mock_binding<bool>(true),
+          config::mock_binding<bool>(false),
+          config::mock_binding<std::chrono::milliseconds>(30s),
+          config::mock_binding<bool>(false),
           feature_table.local());
         hbeats->start().get0();
         hbeats->register_group(consensus).get();
@@ -58,7 +58,9 @@ struct simple_raft_fixture {
         _recovery_throttle
           .start(
             ss::sharded_parameter([] { return config::mock_binding(100_MiB); }),
-            ss::sharded_parameter([] { return config::mock_binding(false); }))
+            ss::sharded_parameter([] { return config::mock_binding(false); }),
+            ss::sharded_parameter(
+              [] { return config::mock_binding<uint16_t>(80); }))
           .get();
 
         _feature_table.start().get();
@@ -80,6 +82,11 @@ struct simple_raft_fixture {
                   .raft_io_timeout_ms
                   = config::mock_binding<std::chrono::milliseconds>(30s),
                   .enable_lw_heartbeat = config::mock_binding<bool>(true),
+                  .enable_quiescence = config::mock_binding<bool>(false),
+                  .quiescence_lease
+                  = config::mock_binding<std::chrono::milliseconds>(30s),
+                  .enable_eager_commit_propagation = config::mock_binding<bool>(
+                    false),
                   .recovery_concurrency_per_shard
                   = config::mock_binding<size_t>(64),
                   .election_timeout_ms = config::mock_binding(10ms),
@@ -89,7 +96,9 @@ struct simple_raft_fixture {
                   .write_caching_flush_bytes
                   = config::mock_binding<std::optional<size_t>>(std::nullopt),
                   .enable_longest_log_detection = config::mock_binding<bool>(
-                    true)};
+                    true),
+                  .append_entries_batch_max_bytes
+                  = config::mock_binding<size_t>(128_KiB)};
             },
             [] {
                 return raft::recovery_memory_quota::configuration{
@@ -75,6 +75,25 @@ struct local_snapshot_stm : public simple_kv {
     };
 };
 
+// State machine only interested in data batches
+struct data_only_kv : public simple_kv {
+    static constexpr std::string_view name = "data_only_kv";
+    explicit data_only_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    bool applies_to(model::record_batch_type type) const override {
+        return type == model::record_batch_type::raft_data;
+    }
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        vassert(
+          batch.header().type == model::record_batch_type::raft_data,
+          "batch {} is not expected to be applied",
+          batch.header());
+        co_await simple_kv::apply(batch);
+    }
+};
+
 // State machine that induces lag from the tip of
 // of the log
 class slow_kv : public simple_kv {
@@ -141,6 +160,34 @@ TEST_F_CORO(state_machine_fixture, test_basic_apply) {
     }
 }
 
+TEST_F_CORO(state_machine_fixture, test_apply_filtered_by_batch_type) {
+    create_nodes();
+    std::vector<ss::shared_ptr<simple_kv>> stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        auto kv_stm = builder.create_stm<simple_kv>(*node);
+        auto data_kv_stm = builder.create_stm<data_only_kv>(*node);
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+        stms.push_back(kv_stm);
+        stms.push_back(ss::dynamic_pointer_cast<simple_kv>(data_kv_stm));
+    }
+
+    auto expected = co_await build_random_state(1000);
+
+    co_await wait_for_apply();
+    auto committed_offset = co_await with_leader(
+      10s, [](raft_node_instance& node) {
+          return node.raft()->committed_offset();
+      });
+
+    for (auto& stm : stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+        // skipped batches still advance the state machine
+        ASSERT_GE_CORO(stm->last_applied_offset(), committed_offset);
+    }
+}
+
 TEST_F_CORO(state_machine_fixture, test_snapshot_with_bg_fibers) {
     create_nodes();
     std::vector<ss::shared_ptr<simple_kv>> stms;
@@ -620,3 +620,65 @@ SEASTAR_THREAD_TEST_CASE(append_entries_request_serde_wrapper_serde) {
       .consume(checking_consumer(std::move(batches_result)), model::no_timeout)
       .get0();
 }
+
+SEASTAR_THREAD_TEST_CASE(append_entries_batch_roundtrip) {
+    raft::append_entries_batch_request batch;
+    raft::append_entries_batch_reply batch_reply;
+    for (int i = 0; i < 10; ++i) {
+        auto batches
+          = model::test::make_random_batches(model::offset(0), 2, false).get();
+        raft::append_entries_request req(
+          raft::vnode(model::node_id(1), model::revision_id(10)),
+          raft::vnode(model::node_id(2), model::revision_id(20)),
+          raft::protocol_metadata{
+            .group = raft::group_id(i),
+            .commit_index = model::offset(100),
+            .term = model::term_id(10),
+            .prev_log_index = model::offset(99),
+            .prev_log_term = model::term_id(9),
+            .last_visible_index = model::offset(100),
+            .dirty_offset = model::offset(99),
+          },
+          model::make_memory_record_batch_reader(std::move(batches)));
+        iobuf encoded;
+        serde::write_async(
+          encoded, raft::append_entries_request_serde_wrapper(std::move(req)))
+          .get();
+        batch.requests.push_back(std::move(encoded));
+
+        batch_reply.replies.push_back(raft::append_entries_reply{
+          .target_node_id = raft::vnode(
+            model::node_id(1), model::revision_id(10)),
+          .node_id = raft::vnode(model::node_id(2), model::revision_id(20)),
+          .group = raft::group_id(i),
+          .term = model::term_id(10),
+          .last_flushed_log_index = model::offset(101),
+          .last_dirty_log_index = model::offset(101),
+          .result = raft::reply_result::success,
+        });
+    }
+
+    auto buf = serde::to_iobuf(std::move(batch));
+    auto decoded = serde::from_iobuf<raft::append_entries_batch_request>(
+      std::move(buf));
+    BOOST_REQUIRE_EQUAL(decoded.requests.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        // each element decodes like a request sent on its own
+        iobuf_parser parser(std::move(decoded.requests[i]));
+        auto req
+          = serde::read_async<raft::append_entries_request_serde_wrapper>(
+              parser)
+              .get()
+              .release();
+        BOOST_REQUIRE_EQUAL(req.target_group(), raft::group_id(i));
+        auto read = model::consume_reader_to_memory(
+                      std::move(req).release_batches(), model::no_timeout)
+                      .get();
+        BOOST_REQUIRE_EQUAL(read.size(), 2);
+    }
+
+    const auto expected = batch_reply.replies.copy();
+    auto decoded_reply = serde::from_iobuf<raft::append_entries_batch_reply>(
+      serde::to_iobuf(std::move(batch_reply)));
+    BOOST_REQUIRE(decoded_reply.replies == expected);
+}
@@ -140,6 +140,10 @@ void follower_index_metadata::reset() {
     last_sent_seq = follower_req_seq{0};
     last_received_seq = follower_req_seq{0};
     last_successful_received_seq = follower_req_seq{0};
+    last_rejected_sent_seq = follower_req_seq{0};
+    quiesced_seq = follower_req_seq{0};
+    lease_probe_seq = follower_req_seq{0};
+    lease_ack_sent_at = {};
     inflight_append_request_count = 0;
     last_sent_protocol_meta.reset();
 }
@@ -167,6 +171,22 @@ std::ostream& operator<<(std::ostream& o, const append_entries_reply& r) {
     return o;
 }
 
+std::ostream&
+operator<<(std::ostream& o, const append_entries_batch_request& r) {
+    size_t bytes = 0;
+    for (const auto& req : r.requests) {
+        bytes += req.size_bytes();
+    }
+    fmt::print(o, "{{requests: {}, bytes: {}}}", r.requests.size(), bytes);
+    return o;
+}
+
+std::ostream&
+operator<<(std::ostream& o, const append_entries_batch_reply& r) {
+    fmt::print(o, "{{replies: {}}}", r.replies.size());
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const vote_request& r) {
     fmt::print(
       o,
@@ -187,7 +207,8 @@ std::ostream& operator<<(std::ostream& o, const follower_index_metadata& i) {
       "{{node_id: {}, last_flushed_log_index: {}, last_dirty_log_index: {}, "
       "match_index: {}, next_index: {}, expected_log_end_offset: {}, "
       "heartbeats_failed: {}, last_sent_seq: {}, last_received_seq: {}, "
-      "last_successful_received_seq: {}, is_learner: {}, is_recovering: {}}}",
+      "last_successful_received_seq: {}, last_rejected_sent_seq: {}, "
+      "is_learner: {}, is_recovering: {}}}",
       i.node_id,
       i.last_flushed_log_index,
       i.last_dirty_log_index,
@@ -198,6 +219,7 @@ std::ostream& operator<<(std::ostream& o, const follower_index_metadata& i) {
       i.last_sent_seq,
       i.last_received_seq,
       i.last_successful_received_seq,
+      i.last_rejected_sent_seq,
       i.is_learner,
       i.is_recovering);
     return o;
@@ -303,6 +325,55 @@ std::ostream& operator<<(std::ostream& o, const install_snapshot_request& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, segment_file_type t) {
+    switch (t) {
+    case segment_file_type::index:
+        return o << "index";
+    case segment_file_type::compaction_index:
+        return o << "compaction_index";
+    case segment_file_type::data:
+        return o << "data";
+    }
+    return o << "unknown";
+}
+
+std::ostream& operator<<(std::ostream& o, const transfer_segment_request& r) {
+    fmt::print(
+      o,
+      "{{term: {}, group: {}, target_node_id: {}, node_id: {}, "
+      "prev_log_index: {}, prev_log_term: {}, base_offset: {}, "
+      "segment_term: {}, file: {}, file_offset: {}, chunk_size: {}, done: {}, "
+      "commit_index: {}}}",
+      r.term,
+      r.group,
+      r.target_node_id,
+      r.node_id,
+      r.prev_log_index,
+      r.prev_log_term,
+      r.base_offset,
+      r.segment_term,
+      r.file,
+      r.file_offset,
+      r.chunk.size_bytes(),
+      r.done,
+      r.commit_index);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const transfer_segment_reply& r) {
+    fmt::print(
+      o,
+      "{{term: {}, target_node_id: {}, bytes_stored: {}, success: {}, "
+      "last_dirty_log_index: {}, last_flushed_log_index: {}}}",
+      r.term,
+      r.target_node_id,
+      r.bytes_stored,
+      r.success,
+      r.last_dirty_log_index,
+      r.last_flushed_log_index);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const install_snapshot_reply& r) {
     fmt::print(
       o,
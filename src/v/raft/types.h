@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "container/fragmented_vector.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "raft/fundamental.h"
@@ -19,7 +20,9 @@
 #include "reflection/adl.h"
 #include "serde/rw/bool_class.h"
 #include "serde/rw/envelope.h"
+#include "serde/rw/iobuf.h"
 #include "serde/rw/scalar.h"
+#include "serde/rw/vector.h"
 #include "utils/named_type.h"
 
 #include <seastar/core/condition-variable.hh>
@@ -83,7 +86,33 @@ struct follower_index_metadata {
         return inflight_append_request_count > 0;
     }
 
-    follower_req_seq next_follower_sequence() { return ++last_sent_seq; }
+    follower_req_seq next_follower_sequence() {
+        ++last_sent_seq;
+        if (lease_probe_seq == follower_req_seq{}) {
+            lease_probe_seq = last_sent_seq;
+            lease_probe_sent_at = clock_type::now();
+        }
+        return last_sent_seq;
+    }
+
+    void lease_acknowledged(clock_type::time_point sent_at) {
+        lease_ack_sent_at = std::max(lease_ack_sent_at, sent_at);
+    }
+
+    // true while the follower may still hold the lease it granted when it
+    // last acknowledged quiescence
+    bool holds_quiescence_lease(
+      clock_type::time_point now, clock_type::duration lease) const {
+        return quiesced_seq != follower_req_seq{} && quiesced_at + lease > now;
+    }
+    // true if the follower acknowledged quiescence and no request was sent to
+    // it since, the lease granted with quiescence is renewed after half of it
+    // elapsed
+    bool is_quiesced(
+      clock_type::time_point now, clock_type::duration lease) const {
+        return quiesced_seq == last_sent_seq
+               && holds_quiescence_lease(now, lease / 2);
+    }
 
     static bool is_first_request(follower_req_seq seq) { return seq() == 1; }
 
@@ -158,6 +187,23 @@ struct follower_index_metadata {
     follower_req_seq last_received_seq{0};
     // sequence number of last received successfull append entries request
     follower_req_seq last_successful_received_seq{0};
+    // value of `last_sent_seq` when the follower last rejected an append
+    // entries request. Requests up to this sequence that are still waiting
+    // for a slot in the follower queue were built on top of the rejected one
+    // and are dropped instead of being sent, recovery takes over from there.
+    follower_req_seq last_rejected_sent_seq{0};
+    // sequence of the heartbeat with which the follower acknowledged
+    // quiescence of the group and the time the acknowledgement was received,
+    // reset when appends are sent to the follower
+    follower_req_seq quiesced_seq{0};
+    clock_type::time_point quiesced_at;
+    // leader lease bookkeeping: the first request sent after the last
+    // acknowledged one with the time it was sent, and the time at which the
+    // last request the follower acknowledged was sent. The follower won't
+    // vote for another candidate for an election timeout after that.
+    follower_req_seq lease_probe_seq{0};
+    clock_type::time_point lease_probe_sent_at;
+    clock_type::time_point lease_ack_sent_at;
     bool is_learner = true;
     bool is_recovering = false;
 
@@ -356,6 +402,40 @@ struct append_entries_reply
     }
 };
 
+/// Append entries requests of many groups bound for the same node, see
+/// append_entries_multiplexer. Each element is an encoded
+/// append_entries_request_serde_wrapper, the follower replies for each of
+/// them in order.
+struct append_entries_batch_request
+  : serde::envelope<
+      append_entries_batch_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    chunked_vector<iobuf> requests;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const append_entries_batch_request& r);
+
+    auto serde_fields() { return std::tie(requests); }
+};
+
+struct append_entries_batch_reply
+  : serde::envelope<
+      append_entries_batch_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    chunked_vector<append_entries_reply> replies;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const append_entries_batch_reply& r);
+
+    auto serde_fields() { return std::tie(replies); }
+};
+
 struct heartbeat_metadata {
     protocol_metadata meta;
     vnode node_id;
@@ -629,6 +709,155 @@ struct install_snapshot_reply
     }
 };
 
+/**
+ * Files of a segment transferred with transfer_segment requests. The data file
+ * is sent last, its last chunk completes the transfer.
+ */
+enum class segment_file_type : uint8_t {
+    index = 0,
+    compaction_index = 1,
+    data = 2,
+};
+
+std::ostream& operator<<(std::ostream&, segment_file_type);
+
+/**
+ * Chunk of a file of a closed leader segment. Used to recover followers by
+ * copying whole segments instead of replicating their batches, the follower
+ * adopts the segment once all of its files were received.
+ */
+struct transfer_segment_request
+  : serde::envelope<
+      transfer_segment_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    // node id to validate on receiver
+    vnode target_node_id;
+    // leader’s term
+    model::term_id term;
+    // target group
+    raft::group_id group;
+    // leader id so follower can redirect clients
+    vnode node_id;
+    // entry preceding the segment, the follower log must end with it
+    model::offset prev_log_index;
+    model::term_id prev_log_term;
+    // the segment files are named after its base offset and term
+    model::offset base_offset;
+    model::term_id segment_term;
+    segment_file_type file = segment_file_type::data;
+    // byte offset where chunk is positioned in the file
+    uint64_t file_offset = 0;
+    // file chunk, raw bytes
+    iobuf chunk;
+    // true if this is the last chunk of the file
+    bool done = false;
+    // leader commit index, applied once the segment is adopted
+    model::offset commit_index;
+
+    raft::group_id target_group() const { return group; }
+    vnode source_node() const { return node_id; }
+    vnode target_node() const { return target_node_id; }
+    friend std::ostream&
+    operator<<(std::ostream&, const transfer_segment_request&);
+
+    friend bool
+    operator==(const transfer_segment_request&, const transfer_segment_request&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(
+          target_node_id,
+          term,
+          group,
+          node_id,
+          prev_log_index,
+          prev_log_term,
+          base_offset,
+          segment_term,
+          file,
+          file_offset,
+          chunk,
+          done,
+          commit_index);
+    }
+};
+
+class transfer_segment_request_foreign_wrapper {
+public:
+    using ptr_t = ss::foreign_ptr<std::unique_ptr<transfer_segment_request>>;
+
+    explicit transfer_segment_request_foreign_wrapper(
+      transfer_segment_request&& req)
+      : _ptr(ss::make_foreign(
+        std::make_unique<transfer_segment_request>(std::move(req)))) {}
+
+    transfer_segment_request copy() const {
+        // make copy on target core
+        return transfer_segment_request{
+          .target_node_id = _ptr->target_node_id,
+          .term = _ptr->term,
+          .group = _ptr->group,
+          .node_id = _ptr->node_id,
+          .prev_log_index = _ptr->prev_log_index,
+          .prev_log_term = _ptr->prev_log_term,
+          .base_offset = _ptr->base_offset,
+          .segment_term = _ptr->segment_term,
+          .file = _ptr->file,
+          .file_offset = _ptr->file_offset,
+          .chunk = _ptr->chunk.copy(),
+          .done = _ptr->done,
+          .commit_index = _ptr->commit_index};
+    }
+    raft::group_id target_group() const { return _ptr->target_group(); }
+    vnode target_node() const { return _ptr->target_node_id; }
+
+private:
+    ptr_t _ptr;
+};
+
+struct transfer_segment_reply
+  : serde::envelope<
+      transfer_segment_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    // node id to validate on receiver
+    vnode target_node_id;
+    // current term, for leader to update itself
+    model::term_id term;
+    // bytes of the file of the request stored by the follower, the leader
+    // continues from there
+    uint64_t bytes_stored = 0;
+    // false if the follower can't accept the segment, the leader falls back
+    // to replicating its batches
+    bool success = false;
+    // replying node
+    vnode node_id;
+    // follower log state, after adopting the segment if it was completed
+    model::offset last_dirty_log_index;
+    model::offset last_flushed_log_index;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const transfer_segment_reply&);
+
+    friend bool
+    operator==(const transfer_segment_reply&, const transfer_segment_reply&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(
+          target_node_id,
+          term,
+          bytes_stored,
+          success,
+          node_id,
+          last_dirty_log_index,
+          last_flushed_log_index);
+    }
+};
+
 /**
  * Configuration describing snapshot that is going to be taken at current node.
  */
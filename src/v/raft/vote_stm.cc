@@ -416,6 +416,7 @@ ss::future<> vote_stm::update_vote_state(ssx::semaphore_units u) {
     // reset target priority
     _ptr->_target_priority = voter_priority::max();
     _ptr->_became_leader_at = clock_type::now();
+    _ptr->_leader_lease_revoked = false;
     // Set last heartbeat timestamp to max as we are the leader
     _ptr->_hbeat = clock_type::time_point::max();
     vlog(_ctxlog.info, "becoming the leader term:{}", term);
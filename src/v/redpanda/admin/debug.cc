@@ -423,6 +423,13 @@ void admin_server::register_debug_routes() {
         -> ss::future<ss::json::json_return_type> {
           return cpu_profile_handler(std::move(req));
       });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::reactor_stalls,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return reactor_stalls_handler(std::move(req));
+      });
     register_route<superuser>(
       ss::httpd::debug_json::set_storage_failure_injection_enabled,
       [](std::unique_ptr<ss::http::request> req) {
@@ -451,6 +458,13 @@ void admin_server::register_debug_routes() {
           return get_local_storage_usage_handler(std::move(req));
       });
 
+    register_route<user>(
+      seastar::httpd::debug_json::get_storage_recovery,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return get_storage_recovery_handler(std::move(req));
+      });
+
     request_handler_fn unsafe_reset_metadata_handler = [this](
                                                          auto req, auto reply) {
         return unsafe_reset_metadata(std::move(req), std::move(reply));
@@ -494,12 +508,10 @@ void admin_server::register_debug_routes() {
 
 using admin::apply_validator;
 
-ss::future<ss::json::json_return_type>
-admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
-    vlog(adminlog.info, "Request to sampled cpu profile");
-
+namespace {
+std::optional<size_t> parse_shard_param(const ss::http::request& req) {
     std::optional<size_t> shard_id;
-    if (auto e = req->get_query_param("shard"); !e.empty()) {
+    if (auto e = req.get_query_param("shard"); !e.empty()) {
         try {
             shard_id = boost::lexical_cast<size_t>(e);
         } catch (const boost::bad_lexical_cast&) {
@@ -516,6 +528,23 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
               "Shard id too high, max shard id is {}", *max_shard_id));
         }
     }
+    return shard_id;
+}
+
+ss::httpd::debug_json::cpu_profile_sample
+to_json(const resources::cpu_profiler::sample& sample) {
+    ss::httpd::debug_json::cpu_profile_sample s;
+    s.occurrences = sample.occurrences;
+    s.user_backtrace = sample.user_backtrace;
+    return s;
+}
+} // namespace
+
+ss::future<ss::json::json_return_type>
+admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
+    vlog(adminlog.info, "Request to sampled cpu profile");
+
+    auto shard_id = parse_shard_param(*req);
 
     std::optional<std::chrono::milliseconds> wait_ms;
     if (auto e = req->get_query_param("wait_ms"); !e.empty()) {
@@ -552,11 +581,38 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
             ret.dropped_samples = profile.dropped_samples;
 
             for (auto& sample : profile.samples) {
-                ss::httpd::debug_json::cpu_profile_sample s;
-                s.occurrences = sample.occurrences;
-                s.user_backtrace = sample.user_backtrace;
+                ret.samples.push(to_json(sample));
+            }
+            return ret;
+        }));
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::reactor_stalls_handler(std::unique_ptr<ss::http::request> req) {
+    vlog(adminlog.info, "Request to recorded reactor stalls");
+
+    auto shard_id = parse_shard_param(*req);
+    auto stalls = co_await _cpu_profiler.local().stalls(shard_id);
 
-                ret.samples.push(s);
+    co_return co_await ss::make_ready_future<ss::json::json_return_type>(
+      ss::json::stream_range_as_array(
+        lw_shared_container(std::move(stalls)),
+        [](const resources::cpu_profiler::shard_stalls& shard) {
+            ss::httpd::debug_json::reactor_stalls_shard ret;
+            ret.shard_id = shard.shard;
+            ret.total_stalls = shard.total_stalls;
+            for (const auto& stall : shard.stalls) {
+                ss::httpd::debug_json::reactor_stall s;
+                s.timestamp = stall.timestamp.time_since_epoch() / 1ms;
+                s.scheduling_group = stall.scheduling_group;
+                s.user_backtrace = stall.user_backtrace;
+                ret.stalls.push(s);
+            }
+            for (const auto& sample : shard.top_backtraces) {
+                ret.top_backtraces.push(to_json(sample));
+            }
+            for (const auto& sample : shard.surrounding_samples) {
+                ret.surrounding_samples.push(to_json(sample));
             }
             return ret;
         }));
@@ -770,6 +826,26 @@ admin_server::get_local_storage_usage_handler(
     co_return ret;
 }
 
+ss::future<ss::json::json_return_type>
+admin_server::get_storage_recovery_handler(std::unique_ptr<ss::http::request>) {
+    auto progress = co_await _controller->get_storage().map_reduce0(
+      [](storage::api& api) {
+          return api.resources().get_recovery_progress();
+      },
+      storage::recovery_progress{},
+      [](storage::recovery_progress acc, const storage::recovery_progress& p) {
+          acc += p;
+          return acc;
+      });
+
+    seastar::httpd::debug_json::storage_recovery ret;
+    ret.pending_high_priority = progress.pending_high;
+    ret.pending = progress.pending_high + progress.pending_normal;
+    ret.active = progress.active;
+    ret.completed = progress.completed;
+    co_return ret;
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_partition_state_handler(
   std::unique_ptr<ss::http::request> req) {
@@ -2818,10 +2818,12 @@ admin_server::self_test_start_handler(std::unique_ptr<ss::http::request> req) {
                     r.ntos.push_back(cluster::netcheck_opts::from_json(obj));
                 } else if (test_type == "cloud") {
                     r.ctos.push_back(cluster::cloudcheck_opts::from_json(obj));
+                } else if (test_type == "kafka") {
+                    r.ktos.push_back(cluster::kafkacheck_opts::from_json(obj));
                 } else {
                     throw ss::httpd::bad_param_exception(
                       "Unknown self_test 'type', valid options are 'disk', "
-                      "'network', or 'cloud'.");
+                      "'network', 'cloud', or 'kafka'.");
                 }
             }
         } else {
@@ -3315,6 +3317,37 @@ fragmented_vector<cluster_partition_info> topic2cluster_partitions(
     return ret;
 }
 
+/**
+ * Parses a `<namespace>/<topic>/<partition>` pagination cursor.
+ */
+model::ntp parse_partition_cursor(std::string_view cursor) {
+    auto bad_cursor = [cursor] {
+        return ss::httpd::bad_request_exception(fmt::format(
+          "Invalid partition cursor {}, expected "
+          "<namespace>/<topic>/<partition>",
+          cursor));
+    };
+    auto first = cursor.find('/');
+    auto last = cursor.rfind('/');
+    if (
+      first == std::string_view::npos || first == 0 || last == first
+      || last == first + 1) {
+        throw bad_cursor();
+    }
+    model::partition_id::type id{};
+    auto id_str = cursor.substr(last + 1);
+    auto [ptr, ec] = std::from_chars(
+      id_str.data(), id_str.data() + id_str.size(), id);
+    if (
+      ec != std::errc{} || ptr != id_str.data() + id_str.size() || id < 0) {
+        throw bad_cursor();
+    }
+    return {
+      model::ns(ss::sstring(cursor.substr(0, first))),
+      model::topic(ss::sstring(cursor.substr(first + 1, last - first - 1))),
+      model::partition_id(id)};
+}
+
 } // namespace
 
 ss::future<ss::json::json_return_type>
@@ -3327,6 +3360,19 @@ admin_server::get_cluster_partitions_handler(
 
     bool with_internal = get_boolean_query_param(*req, "with_internal");
 
+    // Optional pagination. Partitions are listed by namespace, topic and
+    // partition id, a client asks for the next page by passing the last
+    // partition it got as `start_after`.
+    auto limit = get_integer_query_param(*req, "limit");
+    if (limit && *limit == 0) {
+        throw ss::httpd::bad_request_exception("limit must be positive");
+    }
+    std::optional<model::ntp> start_after;
+    if (auto it = req->query_parameters.find("start_after");
+        it != req->query_parameters.end()) {
+        start_after = parse_partition_cursor(it->second);
+    }
+
     const auto& topics_state = _controller->get_topics_state().local();
 
     fragmented_vector<model::topic_namespace> topics;
@@ -3335,6 +3381,11 @@ admin_server::get_cluster_partitions_handler(
             if (!with_internal && !model::is_user_topic(ns_tp)) {
                 continue;
             }
+            if (
+              start_after
+              && ns_tp < model::topic_namespace_view(*start_after)) {
+                continue;
+            }
             topics.push_back(ns_tp);
         }
     };
@@ -3363,10 +3414,27 @@ admin_server::get_cluster_partitions_handler(
           topics_state.get_topic_disabled_set(ns_tp),
           disabled_filter);
 
-        std::move(
-          topic_partitions.begin(),
-          topic_partitions.end(),
-          std::back_inserter(partitions));
+        auto first = topic_partitions.begin();
+        if (
+          start_after
+          && ns_tp == model::topic_namespace_view(*start_after)) {
+            first = std::upper_bound(
+              topic_partitions.begin(),
+              topic_partitions.end(),
+              start_after->tp.partition,
+              [](model::partition_id id, const cluster_partition_info& p) {
+                  return id < p.id;
+              });
+        }
+        for (auto it = first; it != topic_partitions.end(); ++it) {
+            if (limit && partitions.size() >= *limit) {
+                break;
+            }
+            partitions.push_back(std::move(*it));
+        }
+        if (limit && partitions.size() >= *limit) {
+            break;
+        }
 
         co_await ss::coroutine::maybe_yield();
     }
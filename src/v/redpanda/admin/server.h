@@ -611,6 +611,8 @@ private:
       get_partition_state_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_local_storage_usage_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      get_storage_recovery_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_disk_stat_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
@@ -619,6 +621,8 @@ private:
     // Debug routes
     ss::future<ss::json::json_return_type>
       cpu_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      reactor_stalls_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_local_offsets_translated_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
@@ -71,6 +71,7 @@
 #include "cluster/types.h"
 #include "compression/async_stream_zstd.h"
 #include "compression/lz4_decompression_buffers.h"
+#include "compression/offload.h"
 #include "compression/stream_zstd.h"
 #include "config/configuration.h"
 #include "config/endpoint_tls_config.h"
@@ -86,6 +87,7 @@
 #include "kafka/server/group_manager.h"
 #include "kafka/server/group_router.h"
 #include "kafka/server/group_tx_tracker_stm.h"
+#include "kafka/server/produce_latency_controller.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "kafka/server/quota_manager.h"
 #include "kafka/server/rm_group_frontend.h"
@@ -885,6 +887,9 @@ void application::check_environment() {
     storage::directories::initialize(
       config::node().data_directory().as_sstring())
       .get();
+    if (auto cold_dir = config::node().cold_data_directory(); cold_dir) {
+        storage::directories::initialize(*cold_dir).get();
+    }
     cloud_storage::cache::initialize(config::node().cloud_storage_cache_path())
       .get();
 
@@ -1148,7 +1153,7 @@ static storage::kvstore_config kvstore_config_from_global_config(
 static storage::log_config manager_config_from_global_config(
   scheduling_groups& sgs,
   std::optional<storage::file_sanitize_config> sanitizer_config) {
-    return storage::log_config(
+    auto cfg = storage::log_config(
       config::node().data_directory().as_sstring(),
       config::shard_local_cfg().log_segment_size.bind(),
       config::shard_local_cfg().compacted_log_segment_size.bind(),
@@ -1171,6 +1176,8 @@ static storage::log_config manager_config_from_global_config(
       config::shard_local_cfg().readers_cache_eviction_timeout_ms(),
       sgs.compaction_sg(),
       std::move(sanitizer_config));
+    cfg.cold_dir = config::node().cold_data_directory();
+    return cfg;
 }
 
 static storage::backlog_controller_config compaction_controller_config(
@@ -1219,6 +1226,40 @@ static storage::backlog_controller_config compaction_controller_config(
       config::shard_local_cfg().compaction_ctrl_max_shares());
 }
 
+/// Quantile of the produce latency held under
+/// `kafka_produce_latency_target_ms`.
+static constexpr double produce_latency_quantile = 0.99;
+
+static storage::backlog_controller_config
+make_produce_latency_controller_config(std::chrono::milliseconds target) {
+    // The quantile of the produce latency, in microseconds, is normalized so
+    // that the target is 100. The controller is proportional only: catch-up
+    // reads get minimum shares at or above the target, and shares grow
+    // linearly up to the maximum as the latency goes to zero. An integral
+    // part would wind up while the latency stays well under the target and
+    // be slow to react to a spike afterwards.
+    static constexpr int64_t normalized_setpoint = 100;
+    static constexpr int min_shares = 10;
+    static constexpr int max_shares = 1000;
+    const int64_t setpoint
+      = std::chrono::duration_cast<std::chrono::microseconds>(target).count();
+    const int64_t normalization = std::max<int64_t>(
+      setpoint / normalized_setpoint, 1);
+    const auto iopc = priority_manager::local().kafka_catchup_read_priority();
+    return {
+      static_cast<double>(max_shares) / normalized_setpoint,
+      0,
+      0,
+      normalization,
+      setpoint,
+      static_cast<int>(iopc.get_shares()),
+      std::chrono::seconds(1),
+      std::nullopt,
+      iopc,
+      min_shares,
+      max_shares};
+}
+
 static storage::backlog_controller_config
 make_upload_controller_config(ss::scheduling_group sg) {
     // This settings are similar to compaction_controller_config.
@@ -1284,7 +1325,8 @@ void application::wire_up_runtime_services(
     if (wasm_data_transforms_enabled()) {
         syschecks::systemd_message("Starting wasm runtime").get();
         auto base_runtime = wasm::runtime::create_default(
-          _schema_registry.get());
+          _schema_registry.get(),
+          config::node().wasm_compilation_cache_path());
         construct_single_service(_wasm_runtime, std::move(base_runtime));
 
         syschecks::systemd_message("Starting data transforms").get();
@@ -1377,6 +1419,10 @@ void application::wire_up_redpanda_services(
         ss::sharded_parameter([] {
             return config::shard_local_cfg()
               .raft_recovery_throttle_disable_dynamic_mode.bind();
+        }),
+        ss::sharded_parameter([] {
+            return config::shard_local_cfg()
+              .raft_recovery_priority_bandwidth_percent.bind();
         }))
       .get();
 
@@ -1398,6 +1444,13 @@ void application::wire_up_redpanda_services(
               = config::shard_local_cfg().raft_io_timeout_ms.bind(),
               .enable_lw_heartbeat
               = config::shard_local_cfg().raft_enable_lw_heartbeat.bind(),
+              .enable_quiescence
+              = config::shard_local_cfg().raft_enable_quiescence.bind(),
+              .quiescence_lease
+              = config::shard_local_cfg().raft_quiescence_lease_ms.bind(),
+              .enable_eager_commit_propagation
+              = config::shard_local_cfg()
+                  .raft_enable_eager_commit_propagation.bind(),
               .recovery_concurrency_per_shard
               = config::shard_local_cfg()
                   .raft_recovery_concurrency_per_shard.bind(),
@@ -1414,6 +1467,9 @@ void application::wire_up_redpanda_services(
               .enable_longest_log_detection
               = config::shard_local_cfg()
                   .raft_enable_longest_log_detection.bind(),
+              .append_entries_batch_max_bytes
+              = config::shard_local_cfg()
+                  .raft_append_entries_batch_max_bytes.bind(),
             };
         },
         [] {
@@ -1670,6 +1726,7 @@ void application::wire_up_redpanda_services(
       std::ref(local_monitor),
       std::ref(_connection_cache),
       std::ref(cloud_storage_api),
+      std::ref(partition_manager),
       sched_groups.self_test_sg())
       .get();
 
@@ -2028,6 +2085,8 @@ void application::wire_up_redpanda_services(
 
               c.stream_recv_buf
                 = config::shard_local_cfg().kafka_rpc_server_stream_recv_buf;
+              c.cork_window = std::chrono::microseconds(
+                config::shard_local_cfg().kafka_rpc_server_cork_window_us());
               auto& tls_config = config::node().kafka_api_tls.value();
               for (const auto& ep : config::node().kafka_api()) {
                   ss::shared_ptr<ss::tls::server_credentials> credentials
@@ -2113,6 +2172,7 @@ void application::wire_up_redpanda_services(
         &kafka_cfg,
         smp_service_groups.kafka_smp_sg(),
         sched_groups.fetch_sg(),
+        sched_groups.produce_compression_sg(),
         std::ref(metadata_cache),
         std::ref(controller->get_topics_frontend()),
         std::ref(controller->get_config_frontend()),
@@ -2144,6 +2204,16 @@ void application::wire_up_redpanda_services(
         sched_groups.compaction_sg(),
         priority_manager::local().compaction_priority()))
       .get();
+    if (auto target
+        = config::shard_local_cfg().kafka_produce_latency_target_ms();
+        target) {
+        construct_service(
+          _produce_latency_controller,
+          std::ref(_kafka_server),
+          produce_latency_quantile,
+          make_produce_latency_controller_config(*target))
+          .get();
+    }
 }
 
 ss::future<> application::set_proxy_config(ss::sstring name, std::any val) {
@@ -2173,6 +2243,33 @@ void application::trigger_abort_source() {
       .get();
 }
 
+void application::wire_up_and_start_compression_offload() {
+    auto min_bytes = config::shard_local_cfg().compression_offload_min_bytes();
+    if (!min_bytes) {
+        return;
+    }
+    construct_single_service(compression_worker);
+    compression_worker->start({.name = "compress"}).get();
+    compression::offload_compressor::config cfg{
+      .min_bytes = *min_bytes,
+      .max_concurrency
+      = config::shard_local_cfg().compression_offload_max_concurrency(),
+      .zstd_decompress_workspace_bytes
+      = config::shard_local_cfg().zstd_decompress_workspace_bytes(),
+    };
+    ss::smp::invoke_on_all([this, cfg] {
+        return compression::initialize_offload_compressor(
+          *compression_worker, cfg);
+    }).get();
+    _deferred.emplace_back([] {
+        ss::smp::invoke_on_all(compression::reset_offload_compressor).get();
+    });
+    vlog(
+      _log.info,
+      "Offloading compression of payloads of at least {} bytes",
+      *min_bytes);
+}
+
 void application::wire_up_and_start_crypto_services() {
     construct_single_service(thread_worker);
     thread_worker->start({.name = "worker"}).get();
@@ -2459,6 +2556,7 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
 
     // Bootstrap services.
     wire_up_and_start_crypto_services();
+    wire_up_and_start_compression_offload();
     wire_up_bootstrap_services();
     start_bootstrap_services();
 
@@ -2617,6 +2715,7 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           .heap_memory = {
             .per_core_pool_size_bytes = cluster.data_transforms_per_core_memory_reservation.value(),
             .per_engine_memory_limit = cluster.data_transforms_per_function_memory_limit.value(),
+            .huge_pages = cluster.data_transforms_huge_pages.value(),
           },
           .stack_memory = {
             .debug_host_stack_usage = false,
@@ -2907,6 +3006,9 @@ void application::start_runtime_services(
     _archival_upload_controller
       .invoke_on_all(&archival::upload_controller::start)
       .get();
+    _produce_latency_controller
+      .invoke_on_all(&kafka::produce_latency_controller::start)
+      .get();
 
     for (const auto& m : _migrators) {
         m->start(controller->get_abort_source().local());
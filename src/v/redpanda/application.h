@@ -176,6 +176,7 @@ public:
     std::unique_ptr<cluster::controller> controller;
 
     std::unique_ptr<ssx::singleton_thread_worker> thread_worker;
+    std::unique_ptr<ssx::sharded_thread_worker> compression_worker;
 
     ss::sharded<crypto::ossl_context_service> ossl_context_service;
     ss::sharded<kafka::server> _kafka_server;
@@ -207,6 +208,7 @@ private:
     // Constructs and starts the services required to provide cryptographic
     // algorithm support to Redpanda
     void wire_up_and_start_crypto_services();
+    void wire_up_and_start_compression_offload();
 
     // Constructs services across shards required to get bootstrap metadata.
     void wire_up_bootstrap_services();
@@ -309,6 +311,7 @@ private:
     std::unique_ptr<pandaproxy::schema_registry::api> _schema_registry;
     ss::sharded<storage::compaction_controller> _compaction_controller;
     ss::sharded<archival::upload_controller> _archival_upload_controller;
+    ss::sharded<kafka::produce_latency_controller> _produce_latency_controller;
     std::unique_ptr<monitor_unsafe_log_flag> _monitor_unsafe_log_flag;
     ss::sharded<archival::purger> _archival_purger;
 
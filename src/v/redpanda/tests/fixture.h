@@ -150,6 +150,7 @@ public:
             &configs,
             app.smp_service_groups.kafka_smp_sg(),
             app.sched_groups.fetch_sg(),
+            app.sched_groups.produce_compression_sg(),
             std::ref(app.metadata_cache),
             std::ref(app.controller->get_topics_frontend()),
             std::ref(app.controller->get_config_frontend()),
@@ -800,7 +801,8 @@ public:
           config::mock_property<uint32_t>(100_MiB).bind(),
           config::mock_property<std::vector<ss::sstring>>({"produce", "fetch"})
             .bind<std::vector<bool>>(
-              &kafka::server::convert_api_names_to_key_bitmap));
+              &kafka::server::convert_api_names_to_key_bitmap),
+          0);
     }
 
     template<typename RequestType>
@@ -23,11 +23,59 @@
 #include <seastar/core/sleep.hh>
 #include <seastar/util/later.hh>
 
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <chrono>
 #include <iterator>
+#include <utility>
 
 namespace resources {
 
+namespace {
+std::vector<cpu_profiler::sample>
+to_sorted_samples(absl::node_hash_map<ss::simple_backtrace, size_t> counts) {
+    std::vector<cpu_profiler::sample> results;
+    results.reserve(counts.size());
+    for (auto& [backtrace, occurrences] : counts) {
+        results.emplace_back(ssx::sformat("{}", backtrace), occurrences);
+    }
+    std::sort(results.begin(), results.end(), [](const auto& a, const auto& b) {
+        return a.occurrences > b.occurrences;
+    });
+    return results;
+}
+
+// Called from the stall detector's signal handler, so it only formats into a
+// stack buffer and writes it out, like seastar's own report does.
+void write_stall_report(
+  ss::scheduling_group sg, const ss::simple_backtrace& bt) noexcept {
+    std::array<char, 4096> buf;
+    size_t len = 0;
+    auto append = [&buf, &len](auto&&... args) {
+        auto r = fmt::format_to_n(
+          buf.data() + len,
+          buf.size() - len,
+          std::forward<decltype(args)>(args)...);
+        len = std::min(buf.size(), len + r.size);
+    };
+    append(
+      "Reactor stalled on shard {} in scheduling group {}. Backtrace:",
+      ss::this_shard_id(),
+      std::string_view(sg.name()));
+    for (const auto& f : bt.frames()) {
+        if (f.so->name.empty()) {
+            append(" {:#x}", f.addr);
+        } else {
+            append(" {}+{:#x}", std::string_view(f.so->name), f.addr);
+        }
+    }
+    append("\n");
+    [[maybe_unused]] auto r = ::write(STDERR_FILENO, buf.data(), len);
+}
+} // namespace
+
 cpu_profiler::cpu_profiler(
   config::binding<bool>&& enabled,
   config::binding<std::chrono::milliseconds>&& sample_period)
@@ -46,6 +94,14 @@ cpu_profiler::cpu_profiler(
     }
 }
 
+cpu_profiler::~cpu_profiler() {
+    // The stall detector must not call into a destroyed profiler
+    if (_recording_stalls) {
+        ss::engine().set_stall_detector_report_function(
+          std::move(_previous_stall_report));
+    }
+}
+
 ss::future<> cpu_profiler::start() {
     on_sample_period_change();
     on_enabled_change();
@@ -58,6 +114,7 @@ ss::future<> cpu_profiler::stop() {
     _query_timer.cancel();
     co_await _gate.close();
     ss::engine().set_cpu_profiler_enabled(false);
+    update_stall_recording();
 }
 
 ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
@@ -140,6 +197,111 @@ void cpu_profiler::poll_samples() {
       dropped_samples, std::move(results_buffer), ss::lowres_clock::now());
 }
 
+void cpu_profiler::record_stall() noexcept {
+    auto n = _stalls_recorded.load(std::memory_order_relaxed);
+    auto& slot = _stall_slots[n % number_of_recorded_stalls];
+    slot.at = ss::lowres_clock::now();
+    slot.timestamp = ss::lowres_system_clock::now();
+    slot.sg = ss::current_scheduling_group();
+    slot.backtrace = ss::current_backtrace_tasklocal();
+    _stalls_recorded.store(n + 1, std::memory_order_release);
+
+    if (_previous_stall_report) {
+        _previous_stall_report();
+    } else {
+        write_stall_report(slot.sg, slot.backtrace);
+    }
+}
+
+void cpu_profiler::update_stall_recording() {
+    const bool record = !_gate.is_closed() && is_enabled();
+    if (record == _recording_stalls) {
+        return;
+    }
+    _recording_stalls = record;
+    if (record) {
+        _previous_stall_report
+          = ss::engine().get_stall_detector_report_function();
+        ss::engine().set_stall_detector_report_function(
+          [this] { record_stall(); });
+    } else {
+        ss::engine().set_stall_detector_report_function(
+          std::exchange(_previous_stall_report, {}));
+    }
+}
+
+cpu_profiler::shard_stalls cpu_profiler::shard_stall_results() const {
+    // A stall may be recorded while the slots are being copied, only keep
+    // the ones that can't have been overwritten in the meantime.
+    const auto before = _stalls_recorded.load(std::memory_order_acquire);
+    std::vector<stall_slot> slots;
+    const auto retained = std::min(before, number_of_recorded_stalls);
+    slots.reserve(retained);
+    for (size_t i = 0; i < retained; ++i) {
+        slots.push_back(
+          _stall_slots[(before - 1 - i) % number_of_recorded_stalls]);
+    }
+    const auto after = _stalls_recorded.load(std::memory_order_acquire);
+    const auto overwritten = std::min(after - before, slots.size());
+    slots.resize(slots.size() - overwritten);
+
+    shard_stalls result{.shard = ss::this_shard_id(), .total_stalls = after};
+    absl::node_hash_map<ss::simple_backtrace, size_t> backtraces;
+    absl::node_hash_map<ss::simple_backtrace, size_t> surrounding;
+    std::vector<const profiler_result*> windows;
+    for (const auto& slot : slots) {
+        result.stalls.push_back(stall{
+          .timestamp = slot.timestamp,
+          .scheduling_group = slot.sg.name(),
+          .user_backtrace = ssx::sformat("{}", slot.backtrace)});
+        backtraces[slot.backtrace]++;
+
+        // The samples taken during the stall are in the first buffer polled
+        // after it.
+        const profiler_result* window = nullptr;
+        for (const auto& results_buffer : _results_buffers) {
+            if (results_buffer.polled_time >= slot.at) {
+                window = &results_buffer;
+            }
+        }
+        if (
+          window != nullptr
+          && std::find(windows.begin(), windows.end(), window)
+               == windows.end()) {
+            windows.push_back(window);
+            for (const auto& s : window->samples) {
+                surrounding[s.user_backtrace]++;
+            }
+        }
+    }
+    result.top_backtraces = to_sorted_samples(std::move(backtraces));
+    result.surrounding_samples = to_sorted_samples(std::move(surrounding));
+    return result;
+}
+
+ss::future<std::vector<cpu_profiler::shard_stalls>>
+cpu_profiler::stalls(std::optional<ss::shard_id> shard_id) {
+    if (_gate.is_closed()) {
+        co_return std::vector<shard_stalls>{};
+    }
+    auto holder = _gate.hold();
+
+    std::vector<shard_stalls> results{};
+    if (shard_id) {
+        results.push_back(co_await container().invoke_on(
+          shard_id.value(), [](auto& s) { return s.shard_stall_results(); }));
+    } else {
+        results = co_await container().map_reduce0(
+          [](auto& s) { return s.shard_stall_results(); },
+          std::vector<shard_stalls>{},
+          [](std::vector<shard_stalls> results, shard_stalls shard_result) {
+              results.push_back(std::move(shard_result));
+              return results;
+          });
+    }
+    co_return results;
+}
+
 bool cpu_profiler::is_enabled() const {
     auto currently_overriden = _override_enabled > 0;
     return _enabled() || currently_overriden;
@@ -155,6 +317,7 @@ void cpu_profiler::on_enabled_change() {
     }
 
     ss::engine().set_cpu_profiler_enabled(is_enabled());
+    update_stall_recording();
     _query_timer.cancel();
 
     if (is_enabled()) {
@@ -18,6 +18,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/internal/cpu_profiler.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/timer.hh>
@@ -25,9 +26,12 @@
 
 #include <absl/container/node_hash_map.h>
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <functional>
 
 namespace resources {
 
@@ -35,6 +39,11 @@ namespace resources {
  * The `cpu_profiler` service polls traces from seastar at fixed intervals.
  * It then aggregates the traces and provides methods for other services
  * to view them.
+ *
+ * While it is enabled, it also records the reactor stalls reported by
+ * seastar's stall detector, with the backtrace and scheduling group of the
+ * stalled task, so that the most recent stalls of each shard can be inspected
+ * together with the samples collected around them.
  */
 class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
     // The number of results buffers to retain. Each of these buffers
@@ -47,6 +56,9 @@ class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
     // activity.
     static constexpr size_t number_of_results_buffers{10};
 
+    // The number of stalls to retain, per shard.
+    static constexpr size_t number_of_recorded_stalls{32};
+
 public:
     struct sample {
         ss::sstring user_backtrace;
@@ -63,8 +75,33 @@ public:
         std::vector<sample> samples;
     };
 
+    struct stall {
+        ss::lowres_system_clock::time_point timestamp;
+        ss::sstring scheduling_group;
+        ss::sstring user_backtrace;
+    };
+
+    struct shard_stalls {
+        ss::shard_id shard;
+        // Total number of stalls reported on the shard, including the ones
+        // that aren't retained anymore.
+        size_t total_stalls;
+        // Retained stalls, most recent first.
+        std::vector<stall> stalls;
+        // Backtraces of the retained stalls, most frequent first.
+        std::vector<sample> top_backtraces;
+        // Profiler samples from the polling windows containing the retained
+        // stalls, most frequent first. Empty if the profiler is disabled.
+        std::vector<sample> surrounding_samples;
+    };
+
     cpu_profiler(
       config::binding<bool>&&, config::binding<std::chrono::milliseconds>&&);
+    cpu_profiler(const cpu_profiler&) = delete;
+    cpu_profiler& operator=(const cpu_profiler&) = delete;
+    cpu_profiler(cpu_profiler&&) = delete;
+    cpu_profiler& operator=(cpu_profiler&&) = delete;
+    ~cpu_profiler();
 
     ss::future<> start();
     ss::future<> stop();
@@ -89,6 +126,13 @@ public:
     ss::future<std::vector<shard_samples>> collect_results_for_period(
       std::chrono::milliseconds timeout, std::optional<ss::shard_id> shard_id);
 
+    // Collects `shard_stall_results()` for each shard in a node.
+    ss::future<std::vector<shard_stalls>>
+    stalls(std::optional<ss::shard_id> shard_id);
+
+    // Returns the stalls recorded on the shard this function is called on.
+    shard_stalls shard_stall_results() const;
+
 private:
     // impl for the above
     ss::future<>
@@ -121,6 +165,24 @@ private:
 
     void poll_samples();
 
+    // Stalls are recorded from the stall detector's signal handler, so slots
+    // are preallocated and written without allocating. `_stalls_recorded`
+    // is only incremented once a slot is fully written.
+    struct stall_slot {
+        ss::lowres_clock::time_point at;
+        ss::lowres_system_clock::time_point timestamp;
+        ss::scheduling_group sg;
+        ss::simple_backtrace backtrace;
+    };
+    std::array<stall_slot, number_of_recorded_stalls> _stall_slots;
+    std::atomic<size_t> _stalls_recorded{0};
+    // The report function installed before ours, called after recording.
+    std::function<void()> _previous_stall_report;
+    bool _recording_stalls{false};
+
+    void record_stall() noexcept;
+    void update_stall_recording();
+
     void on_enabled_change();
     void on_sample_period_change();
 
@@ -39,6 +39,8 @@ public:
         _self_test = co_await ss::create_scheduling_group("self_test", 100);
         _fetch = co_await ss::create_scheduling_group("fetch", 1000);
         _transforms = co_await ss::create_scheduling_group("transforms", 100);
+        _produce_compression = co_await ss::create_scheduling_group(
+          "produce_compression", 100);
     }
 
     ss::future<> destroy_groups() {
@@ -54,6 +56,7 @@ public:
         co_await destroy_scheduling_group(_self_test);
         co_await destroy_scheduling_group(_fetch);
         co_await destroy_scheduling_group(_transforms);
+        co_await destroy_scheduling_group(_produce_compression);
     }
 
     ss::scheduling_group admin_sg() { return _admin; }
@@ -82,6 +85,15 @@ public:
      * use all the CPU.
      */
     ss::scheduling_group fetch_sg() { return _fetch; }
+    /**
+     * @brief Scheduling group in which produced batches are recompressed.
+     *
+     * Compressing batches the clients didn't compress is optional work, with
+     * fewer shares it doesn't take CPU from request processing.
+     */
+    ss::scheduling_group produce_compression_sg() {
+        return _produce_compression;
+    }
 
     std::vector<std::reference_wrapper<const ss::scheduling_group>>
     all_scheduling_groups() const {
@@ -98,7 +110,8 @@ public:
           std::cref(_node_status),
           std::cref(_self_test),
           std::cref(_fetch),
-          std::cref(_transforms)};
+          std::cref(_transforms),
+          std::cref(_produce_compression)};
     }
 
 private:
@@ -116,4 +129,5 @@ private:
     ss::scheduling_group _self_test;
     ss::scheduling_group _fetch;
     ss::scheduling_group _transforms;
+    ss::scheduling_group _produce_compression;
 };
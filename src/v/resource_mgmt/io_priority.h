@@ -23,6 +23,9 @@ public:
     ss::io_priority_class raft_priority() { return _raft_priority; }
     ss::io_priority_class controller_priority() { return _controller_priority; }
     ss::io_priority_class kafka_read_priority() { return _kafka_read_priority; }
+    ss::io_priority_class kafka_catchup_read_priority() {
+        return _kafka_catchup_read_priority;
+    }
     ss::io_priority_class wasm_read_priority() { return _wasm_read_priority; }
     ss::io_priority_class compaction_priority() { return _compaction_priority; }
     ss::io_priority_class raft_learner_recovery_priority() {
@@ -47,6 +50,11 @@ private:
           ss::io_priority_class::register_one("controller", 1000))
       , _kafka_read_priority(
           ss::io_priority_class::register_one("kafka_read", 1000))
+      // Kafka reads far behind the tip of a partition. These mostly miss the
+      // batch cache and can be large, so they get fewer shares than appends
+      // and tail reads to keep them from filling up the device queue.
+      , _kafka_catchup_read_priority(
+          ss::io_priority_class::register_one("kafka_catchup_read", 200))
       , _wasm_read_priority(
           ss::io_priority_class::register_one("wasm_read", 500))
       , _compaction_priority(
@@ -66,6 +74,7 @@ private:
     ss::io_priority_class _raft_priority;
     ss::io_priority_class _controller_priority;
     ss::io_priority_class _kafka_read_priority;
+    ss::io_priority_class _kafka_catchup_read_priority;
     ss::io_priority_class _wasm_read_priority;
     ss::io_priority_class _compaction_priority;
     ss::io_priority_class _raft_learner_recovery_priority;
@@ -85,6 +94,10 @@ inline ss::io_priority_class kafka_read_priority() {
     return priority_manager::local().kafka_read_priority();
 }
 
+inline ss::io_priority_class kafka_catchup_read_priority() {
+    return priority_manager::local().kafka_catchup_read_priority();
+}
+
 inline ss::io_priority_class wasm_read_priority() {
     return priority_manager::local().wasm_read_priority();
 }
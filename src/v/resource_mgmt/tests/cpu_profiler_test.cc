@@ -58,6 +58,37 @@ SEASTAR_THREAD_TEST_CASE(test_cpu_profiler) {
     BOOST_TEST(results.samples.size() >= 1);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_cpu_profiler_records_stalls) {
+    resources::cpu_profiler cp(
+      config::mock_binding(true), config::mock_binding(2ms));
+    cp.start().get();
+
+    auto notify_ms = ss::engine().get_blocked_reactor_notify_ms();
+    ss::engine().update_blocked_reactor_notify_ms(10ms);
+    // Stall the reactor without yielding.
+    auto end_time = std::chrono::steady_clock::now() + 100ms;
+    while (std::chrono::steady_clock::now() < end_time) {
+    }
+    ss::engine().update_blocked_reactor_notify_ms(notify_ms);
+
+    auto results = cp.shard_stall_results();
+    BOOST_REQUIRE_GE(results.total_stalls, 1);
+    BOOST_REQUIRE(!results.stalls.empty());
+    BOOST_REQUIRE_EQUAL(results.stalls.front().scheduling_group, "main");
+    BOOST_REQUIRE(!results.top_backtraces.empty());
+
+    cp.stop().get();
+
+    // Stalls aren't recorded once the profiler is stopped.
+    ss::engine().update_blocked_reactor_notify_ms(10ms);
+    end_time = std::chrono::steady_clock::now() + 100ms;
+    while (std::chrono::steady_clock::now() < end_time) {
+    }
+    ss::engine().update_blocked_reactor_notify_ms(notify_ms);
+    BOOST_REQUIRE_EQUAL(
+      cp.shard_stall_results().total_stalls, results.total_stalls);
+}
+
 SEASTAR_TEST_CASE(test_cpu_profiler_enable_override) {
     // Ensure that overrides to the profiler will enable it and collect samples
     // for the specified period of time.
@@ -13,6 +13,7 @@
 
 #include "config/configuration.h"
 #include "rpc/rpc_utils.h"
+#include "ssx/sformat.h"
 
 namespace rpc {
 ss::future<> connection_set::try_add_or_update(
@@ -39,6 +40,15 @@ ss::future<> connection_set::try_add_or_update(
       .disable_metrics = net::metrics_disabled(
         config::shard_local_cfg().disable_metrics),
       .version = get_default_transport_version()};
+    if (config::shard_local_cfg().rpc_client_priority_connection()) {
+        // a label of its own keeps the metrics of the two connections apart
+        auto label = connection_cache_label(
+          _label ? ssx::sformat("{}_priority", (*_label)()) : "priority");
+        _priority_connections.emplace(
+          node,
+          ss::make_lw_shared<rpc::reconnect_transport>(
+            config, backoff, std::move(label), node));
+    }
     auto trans = ss::make_lw_shared<rpc::reconnect_transport>(
       std::move(config), std::move(backoff), _label, node);
 
@@ -46,6 +56,12 @@ ss::future<> connection_set::try_add_or_update(
 }
 
 ss::future<> connection_set::remove(model::node_id n) {
+    if (auto it = _priority_connections.find(n);
+        it != _priority_connections.end()) {
+        auto ptr = it->second;
+        _priority_connections.erase(it);
+        co_await ptr->stop();
+    }
     auto it = _connections.find(n);
     if (it == _connections.end()) {
         co_return;
@@ -62,10 +78,15 @@ ss::future<> connection_set::remove(model::node_id n) {
 
 ss::future<> connection_set::remove_all() {
     auto connections = std::exchange(_connections, {});
+    auto priority_connections = std::exchange(_priority_connections, {});
     co_await parallel_for_each(connections, [](auto& it) {
         auto& [_, cli] = it;
         return cli->stop();
     });
+    co_await parallel_for_each(priority_connections, [](auto& it) {
+        auto& [_, cli] = it;
+        return cli->stop();
+    });
     connections.clear();
 }
 
@@ -78,6 +99,11 @@ void connection_set::reset_client_backoff(model::node_id node_id) {
     }
     auto recon_transport = conn_it->second;
     recon_transport->reset_backoff();
+
+    if (auto it = _priority_connections.find(node_id);
+        it != _priority_connections.end()) {
+        it->second->reset_backoff();
+    }
 }
 
 } // namespace rpc
@@ -125,7 +125,8 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       timeout_spec connection_timeout,
-      Func&& f) {
+      Func&& f,
+      connection_class cls = connection_class::data) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
 
         if (is_shutting_down()) {
@@ -145,10 +146,11 @@ public:
            node_id,
            connection_timeout,
            shard,
+           cls,
            f = std::forward<Func>(f)]() mutable {
               return container().invoke_on(
                 *shard,
-                [node_id, f = std::forward<Func>(f), connection_timeout](
+                [node_id, f = std::forward<Func>(f), connection_timeout, cls](
                   connection_cache& cache) mutable {
                     if (cache.is_shutting_down()) {
                         return ss::futurize<ret_t>::convert(
@@ -156,7 +158,7 @@ public:
                     }
 
                     return cache._cache.with_node_client<Protocol, Func>(
-                      node_id, connection_timeout, std::forward<Func>(f));
+                      node_id, connection_timeout, std::forward<Func>(f), cls);
                 });
           });
     }
@@ -168,13 +170,15 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       Timeout connection_timeout,
-      Func&& f) {
+      Func&& f,
+      connection_class cls = connection_class::data) {
         return with_node_client<Protocol, Func>(
           self,
           src_shard,
           node_id,
           timeout_spec::from_either(connection_timeout),
-          std::forward<Func>(f));
+          std::forward<Func>(f),
+          cls);
     }
 
     /// If a reconnect_transport is in a backed-off state, reset
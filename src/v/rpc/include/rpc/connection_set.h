@@ -88,11 +88,18 @@ public:
     template<typename Protocol, typename Func>
     requires requires(Func&& f, Protocol proto) { f(proto); }
     auto with_node_client(
-      model::node_id node_id, timeout_spec connection_timeout, Func&& f) {
+      model::node_id node_id,
+      timeout_spec connection_timeout,
+      Func&& f,
+      connection_class cls = connection_class::data) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
-        auto conn_it = _connections.find(node_id);
+        const bool use_priority = cls == connection_class::priority
+                                  && _priority_connections.contains(node_id);
+        const auto& connections = use_priority ? _priority_connections
+                                               : _connections;
+        auto conn_it = connections.find(node_id);
 
-        if (conn_it == _connections.end()) {
+        if (conn_it == connections.end()) {
             // No client available
             return ss::futurize<ret_t>::convert(
               rpc::make_error_code(errc::missing_node_rpc_client));
@@ -119,11 +126,15 @@ public:
     template<typename Protocol, typename Func, RpcDurationOrPoint Timeout>
     requires requires(Func&& f, Protocol proto) { f(proto); }
     auto with_node_client(
-      model::node_id node_id, Timeout connection_timeout, Func&& f) {
+      model::node_id node_id,
+      Timeout connection_timeout,
+      Func&& f,
+      connection_class cls = connection_class::data) {
         return with_node_client<Protocol, Func>(
           node_id,
           timeout_spec::from_either(connection_timeout),
-          std::forward<Func>(f));
+          std::forward<Func>(f),
+          cls);
     }
 
     /// If a reconnect_transport is in a backed-off state, reset
@@ -136,6 +147,9 @@ private:
     using underlying = std::unordered_map<model::node_id, transport_ptr>;
 
     underlying _connections;
+    // Connections for connection_class::priority requests, only present when
+    // rpc_client_priority_connection was set when the node was added
+    underlying _priority_connections;
     transport_version _default_transport_version{transport_version::v2};
     std::optional<connection_cache_label> _label;
 };
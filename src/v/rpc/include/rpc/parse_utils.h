@@ -16,6 +16,7 @@
 #include "base/vlog.h"
 #include "bytes/iostream.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "hashing/xx.h"
 #include "reflection/async_adl.h"
 #include "rpc/logger.h"
@@ -285,6 +286,12 @@ ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
             iobuf_fut = zstd_inst.uncompress(std::move(io));
             break;
         }
+        case compression_type::lz4:
+            iobuf_fut = ss::futurize_invoke([&io] {
+                return compression::compressor::uncompress(
+                  io, compression::type::lz4);
+            });
+            break;
         default:
             iobuf_fut = ss::make_exception_future<iobuf>(std::runtime_error(
               fmt::format("no compression supported. header: {}", h)));
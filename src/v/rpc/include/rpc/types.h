@@ -165,14 +165,26 @@ using connection_cache_label
 enum class compression_type : uint8_t {
     none = 0,
     zstd,
+    lz4,
     min = none,
-    max = zstd,
+    max = lz4,
+};
+
+/// Selects which of the connections to a peer a request is sent on
+enum class connection_class : uint8_t {
+    /// Replication, recovery and all other requests
+    data = 0,
+    /// Small latency sensitive requests like heartbeats and votes. Sent on a
+    /// dedicated connection, when there is one, so they never wait behind a
+    /// large request on the same socket.
+    priority,
 };
 
 struct negotiation_frame {
     int8_t version = 0;
     /// \brief 0 - no compression
     ///        1 - zstd
+    ///        2 - lz4
     compression_type compression = compression_type::none;
 };
 
@@ -11,6 +11,7 @@
 #include "bytes/iobuf.h"
 #include "bytes/scattered_message.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "hashing/xx.h"
 #include "reflection/adl.h"
 #include "rpc/types.h"
@@ -25,6 +26,9 @@ iobuf header_as_iobuf(const header& h) {
       "Header size must be known and exact");
     return b;
 }
+// fragments smaller than this are merged before sending
+static constexpr size_t small_fragment_size = 1024;
+
 /// \brief used to send the bytes down the wire
 /// we re-compute the header-checksum on every call
 ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
@@ -37,9 +41,19 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
       && rpc::compression_type::zstd == hdr.compression) {
         auto& zstd_inst = compression::async_stream_zstd_instance();
         out_buf = co_await zstd_inst.compress(std::move(out_buf));
+    } else if (
+      out_buf.size_bytes() >= _min_compression_bytes
+      && rpc::compression_type::lz4 == hdr.compression) {
+        // lz4 is cheap enough to run inline, it trades some ratio for a
+        // fraction of the zstd cpu cost on the replication path
+        out_buf = compression::compressor::compress(
+          out_buf, compression::type::lz4);
     } else {
         // didn't meet min requirements
         hdr.compression = rpc::compression_type::none;
+        // payloads assembled from many small record batches are mostly tiny
+        // fragments, merge them before they are hashed and turned into iovecs
+        out_buf.coalesce_small_fragments(small_fragment_size);
     }
     incremental_xxhash64 h;
     auto in = iobuf::iterator_consumer(out_buf.cbegin(), out_buf.cend());
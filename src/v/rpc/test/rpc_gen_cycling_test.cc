@@ -587,6 +587,16 @@ FIXTURE_TEST(rpc_mixed_compression, rpc_integration_fixture) {
                       0 /*min bytes compress*/))
                   .get0();
     BOOST_REQUIRE_EQUAL(echo_resp.value().data.str, data);
+    BOOST_TEST_MESSAGE("Calling echo method *WITH* lz4 compression");
+    echo_resp = client
+                  .echo(
+                    echo::echo_req{.str = data},
+                    rpc::client_opts(
+                      rpc::timeout_spec::none,
+                      rpc::compression_type::lz4,
+                      0 /*min bytes compress*/))
+                  .get0();
+    BOOST_REQUIRE_EQUAL(echo_resp.value().data.str, data);
 
     // close resources
     client.stop().get();
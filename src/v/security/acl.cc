@@ -155,6 +155,9 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
 
 std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
   const std::vector<acl_binding_filter>& filters, bool dry_run) {
+    if (!dry_run) {
+        ++_generation;
+    }
     // the pair<filter, size_t> is used to record the index of the filter in the
     // input so that returned set of matching binding is organized in the same
     // order as the input filters. this is a property needed by the kafka api.
@@ -272,6 +275,7 @@ ss::future<fragmented_vector<acl_binding>> acl_store::all_bindings() const {
 ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
+    ++_generation;
     _acls.clear();
     return ss::do_for_each(
              bindings,
@@ -280,7 +284,8 @@ acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
-      });
+      })
+      .finally([this] { ++_generation; });
 }
 
 std::ostream& operator<<(std::ostream& os, acl_operation op) {
@@ -33,6 +33,7 @@ public:
     ~acl_store() noexcept = default;
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
+        ++_generation;
         for (auto& binding : bindings) {
             auto& entries = _acls[binding.pattern()];
             entries.insert(binding.entry());
@@ -61,6 +62,10 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    // Changes whenever the bindings may have changed, so that anything derived
+    // from them can be invalidated.
+    uint64_t generation() const { return _generation; }
+
 private:
     /*
      * resource pattern ordering:
@@ -85,6 +90,7 @@ private:
     using container_type = absl::
       btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>;
     container_type _acls;
+    uint64_t _generation{0};
 
     /**
      * WARNING: The view returned by this function contains iterators into a
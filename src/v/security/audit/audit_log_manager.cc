@@ -835,6 +835,15 @@ bool audit_log_manager::report_redpanda_app_event(is_started app_started) {
         : application_lifecycle::activity_id::stop);
 }
 
+void audit_log_manager::maybe_drain_early() {
+    const auto used = _max_queue_size_bytes
+                      - static_cast<size_t>(
+                        _queue_bytes_sem.available_units());
+    if (used >= _max_queue_size_bytes / 2 && _drain_timer.armed()) {
+        _drain_timer.rearm(ss::timer<>::clock::now());
+    }
+}
+
 ss::future<> audit_log_manager::drain() {
     if (_queue.empty()) {
         co_return;
@@ -852,9 +861,8 @@ ss::future<> audit_log_manager::drain() {
     while (!records_seq.empty()) {
         auto first = records_seq.extract(records_seq.begin());
         auto audit_msg = std::move(first.value()).release();
-        auto as_json = audit_msg->to_json();
         iobuf b;
-        b.append(as_json.c_str(), as_json.size());
+        b.append(audit_msg->to_json().release());
         essences.push_back(
           kafka::client::record_essence{.value = std::move(b)});
         co_await ss::maybe_yield();
@@ -226,6 +226,10 @@ private:
       const model::topic&) const;
 
     ss::future<> drain();
+    /// Drain right away once the queue is half full instead of waiting for
+    /// the drain interval, so that a burst of unique events doesn't exhaust
+    /// the queue and fail the requests that are being audited
+    void maybe_drain_early();
     ss::future<> pause();
     ss::future<> resume();
 
@@ -262,6 +266,7 @@ private:
               _queue_bytes_sem.available_units());
             list.push_back(
               audit_msg(hash_key, std::move(msg), std::move(*units)));
+            maybe_drain_early();
         } else {
             vlog(
               adtlog.trace, "Incrementing count of event {}", it->ocsf_msg());
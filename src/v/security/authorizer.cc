@@ -159,13 +159,59 @@ std::ostream& operator<<(std::ostream& os, const auth_result& a) {
     return os;
 }
 
+const auth_result*
+authorizer::find_decision(const detail::authz_decision_key_view& key) const {
+    if (
+      _decisions_acl_generation != store().generation()
+      || _decisions_role_generation != _role_store->generation()) {
+        _decisions.clear();
+        _decisions_acl_generation = store().generation();
+        _decisions_role_generation = _role_store->generation();
+        return nullptr;
+    }
+    auto it = _decisions.find(key);
+    return it == _decisions.end() ? nullptr : &it->second;
+}
+
+void authorizer::cache_decision(
+  const detail::authz_decision_key_view& key, const auth_result& r) const {
+    if (_decisions.size() >= max_cached_decisions) {
+        // Decisions are cheap to recompute compared with tracking recency on
+        // every authorization, so start again rather than evict one by one.
+        _decisions.clear();
+    }
+    _decisions.emplace(
+      detail::authz_decision_key{
+        .type = key.type,
+        .name = ss::sstring{key.name},
+        .operation = key.operation,
+        .principal = key.principal,
+        .host = key.host,
+      },
+      r);
+}
+
 template<typename T>
 auth_result authorizer::authorized(
   const T& resource_name,
   acl_operation operation,
   const acl_principal& principal,
   const acl_host& host) const {
-    auth_result r = do_authorized(resource_name, operation, principal, host);
+    const detail::authz_decision_key_view key{
+      .type = get_resource_type<T>(),
+      .name = resource_name(),
+      .operation = operation,
+      .principal = principal,
+      .host = host,
+    };
+    auth_result r = [&] {
+        if (const auto* cached = find_decision(key); cached != nullptr) {
+            return *cached;
+        }
+        auto r = do_authorized(resource_name, operation, principal, host);
+        cache_decision(key, r);
+        return r;
+    }();
     _probe->record_authz_result(
       r.is_authorized() ? authz_result::allow
       : r.empty_matches ? authz_result::empty
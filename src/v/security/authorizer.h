@@ -22,9 +22,12 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
+#include <absl/hash/hash.h>
 
 #include <iosfwd>
+#include <string_view>
 
 namespace security {
 
@@ -179,6 +182,53 @@ struct auth_result {
     }
 };
 
+namespace detail {
+
+/*
+ * Key of a cached authorization decision. Lookups use the view so that a hit
+ * doesn't need to copy the resource name or the principal.
+ */
+struct authz_decision_key {
+    resource_type type;
+    ss::sstring name;
+    acl_operation operation;
+    acl_principal principal;
+    acl_host host;
+};
+
+struct authz_decision_key_view {
+    resource_type type;
+    std::string_view name;
+    acl_operation operation;
+    const acl_principal& principal;
+    const acl_host& host;
+};
+
+struct authz_decision_key_hash {
+    using is_transparent = void;
+    template<typename K>
+    size_t operator()(const K& k) const {
+        return absl::HashOf(
+          k.type,
+          std::string_view{k.name},
+          k.operation,
+          static_cast<const acl_principal_base&>(k.principal),
+          k.host);
+    }
+};
+
+struct authz_decision_key_eq {
+    using is_transparent = void;
+    template<typename L, typename R>
+    bool operator()(const L& l, const R& r) const {
+        return l.type == r.type && std::string_view{l.name} == r.name
+               && l.operation == r.operation && l.principal == r.principal
+               && l.host == r.host;
+    }
+};
+
+} // namespace detail
+
 /*
  * Primary interface for request authorization and management of ACLs.
  *
@@ -189,6 +239,15 @@ struct auth_result {
  * perform any operation. When authorization occurs if the assocaited principal
  * is found in the set of superusers then its request will be permitted. If the
  * principal is not a superuser then normal ACL authorization applies.
+ *
+ * decision cache
+ * ==============
+ *
+ * Requests such as metadata authorize the same principal against the same
+ * resources over and over, and evaluating the ACLs includes a scan of the
+ * prefixed patterns. Decisions are cached per shard, and the cache is dropped
+ * whenever the ACLs, the roles or the superusers change. Cached results refer
+ * to ACL entries in the store, which is only safe because of that.
  */
 class authorizer final {
 public:
@@ -240,7 +299,19 @@ public:
     acl_store& store() &;
     const acl_store& store() const&;
 
+    // The maximum number of decisions that are cached
+    static constexpr size_t max_cached_decisions = 10000;
+
 private:
+    /*
+     * Return the cached decision, or nullptr if it has to be computed. Any
+     * decisions made before a change to the ACLs or roles are dropped.
+     */
+    const auth_result*
+    find_decision(const detail::authz_decision_key_view& key) const;
+    void cache_decision(
+      const detail::authz_decision_key_view& key, const auth_result& r) const;
+
     template<typename T>
     auth_result do_authorized(
       const T& resource_name,
@@ -269,6 +340,7 @@ private:
         // in any case involve constructing a set to do a comparison
         // between old and new.
         _superusers.clear();
+        _decisions.clear();
         for (const auto& username : _superusers_conf()) {
             auto principal = acl_principal(principal_type::user, username);
             vlog(seclog.info, "Registered superuser account: {}", principal);
@@ -280,6 +352,17 @@ private:
     // operation, an empty match result is ALWAYS unauthorized.
     allow_empty_matches _allow_empty_matches;
     const role_store* _role_store;
+
+    mutable absl::flat_hash_map<
+      detail::authz_decision_key,
+      auth_result,
+      detail::authz_decision_key_hash,
+      detail::authz_decision_key_eq>
+      _decisions;
+    // The generations of the ACLs and roles that the decisions are based on
+    mutable uint64_t _decisions_acl_generation{0};
+    mutable uint64_t _decisions_role_generation{0};
+
     class probe;
     std::unique_ptr<probe> _probe;
 };
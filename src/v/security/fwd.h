@@ -25,6 +25,7 @@ class role_store;
 
 namespace oidc {
 
+struct authentication_data;
 class jws;
 class jwt;
 class service;
@@ -107,6 +107,11 @@ public:
 
     result<authentication_data>
     authenticate(std::string_view bearer_token) const {
+        if (auto cached = _service.find_authenticated(bearer_token);
+            cached != nullptr) {
+            return *cached;
+        }
+
         auto jws = oidc::jws::make(ss::sstring{bearer_token});
         if (jws.has_error()) {
             vlog(
@@ -123,7 +128,7 @@ public:
             return issuer.assume_error();
         }
 
-        return oidc::authenticate(
+        auto res = oidc::authenticate(
           jws.assume_value(),
           _service.get_verifier(),
           _service.get_principal_mapping_rule(),
@@ -131,6 +136,10 @@ public:
           _service.audience(),
           _service.clock_skew_tolerance(),
           ss::lowres_system_clock::now());
+        if (res.has_value()) {
+            _service.cache_authenticated(bearer_token, res.assume_value());
+        }
+        return res;
     }
 
 private:
@@ -11,6 +11,7 @@
 
 #include "config/configuration.h"
 #include "config/tls_config.h"
+#include "hashing/secure.h"
 #include "http/client.h"
 #include "metrics/metrics.h"
 #include "metrics/prometheus_sanitize.h"
@@ -18,6 +19,7 @@
 #include "security/exceptions.h"
 #include "security/jwt.h"
 #include "security/logger.h"
+#include "security/oidc_authenticator.h"
 #include "security/oidc_principal_mapping.h"
 #include "security/oidc_url_parser.h"
 #include "ssx/future-util.h"
@@ -169,6 +171,8 @@ struct service::impl {
         _discovery_url.watch([this]() {
             ssx::spawn_with_gate(_gate, [this] { return update(); });
         });
+        _token_audience.watch([this]() { _authenticated.clear(); });
+        _clock_skew_tolerance.watch([this]() { _authenticated.clear(); });
         _mapping.watch([this]() { update_rule(); });
         update_rule();
         _jwks_refresh_interval.watch([this]() {
@@ -278,7 +282,11 @@ struct service::impl {
         }
         measure.success();
 
-        _issuer.emplace(metadata.assume_value().issuer());
+        auto issuer = metadata.assume_value().issuer();
+        if (!_issuer.has_value() || std::string_view{*_issuer} != issuer) {
+            _authenticated.clear();
+            _issuer.emplace(issuer);
+        }
     }
 
     ss::future<> update_jwks() {
@@ -323,6 +331,7 @@ struct service::impl {
               res.assume_error(), "Error updating keys");
         }
 
+        _authenticated.clear();
         arm_duration = _jwks_refresh_interval();
     }
 
@@ -331,9 +340,16 @@ struct service::impl {
             vlog(seclog.error, "Rule failed to parse: {}", _mapping());
         } else {
             _rule = std::move(r).assume_value();
+            _authenticated.clear();
         }
     }
 
+    static hash_sha256::digest_type token_digest(std::string_view token) {
+        hash_sha256 h;
+        h.update(token);
+        return h.reset();
+    }
+
     ss::future<ss::sstring> make_request(parsed_url url) {
         auto is_https = url.scheme == "https";
         std::optional<ss::sstring> tls_host;
@@ -408,6 +424,10 @@ struct service::impl {
     ss::timer<ss::lowres_clock> _jwks_refresh;
     ss::shared_ptr<ss::tls::certificate_credentials> _creds;
     absl::flat_hash_map<ss::sstring, std::unique_ptr<probe>> _probes;
+    // Keyed by a digest of the token, the token itself is never kept.
+    absl::flat_hash_map<hash_sha256::digest_type, authentication_data>
+      _authenticated;
+    static constexpr size_t max_authenticated_tokens = 1000;
 };
 
 service::service(
@@ -450,6 +470,30 @@ principal_mapping_rule const& service::get_principal_mapping_rule() const {
     return _impl->_rule;
 }
 
+authentication_data const*
+service::find_authenticated(std::string_view bearer_token) const {
+    auto it = _impl->_authenticated.find(impl::token_digest(bearer_token));
+    if (it == _impl->_authenticated.end()) {
+        return nullptr;
+    }
+    auto now = ss::lowres_system_clock::now();
+    if (it->second.expiry + _impl->_clock_skew_tolerance() < now) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void service::cache_authenticated(
+  std::string_view bearer_token, authentication_data const& data) {
+    auto& authenticated = _impl->_authenticated;
+    if (authenticated.size() >= impl::max_authenticated_tokens) {
+        // Expired tokens are never looked up again, so start over rather than
+        // tracking their age.
+        authenticated.clear();
+    }
+    authenticated.insert_or_assign(impl::token_digest(bearer_token), data);
+}
+
 ss::future<> service::refresh_keys() { return _impl->update_jwks(); }
 
 } // namespace security::oidc
@@ -46,6 +46,16 @@ public:
     result<std::string_view> issuer() const;
     std::chrono::seconds clock_skew_tolerance() const;
 
+    /// \brief The result of authenticating a token that hasn't expired yet.
+    ///
+    /// Clients send the same bearer token with every request, so verified
+    /// tokens are remembered until the keys, issuer, audience or principal
+    /// mapping that they were checked against change.
+    authentication_data const*
+    find_authenticated(std::string_view bearer_token) const;
+    void cache_authenticated(
+      std::string_view bearer_token, authentication_data const&);
+
     ss::future<> refresh_keys();
 
 private:
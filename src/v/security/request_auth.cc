@@ -127,11 +127,24 @@ request_auth_result request_authenticator::do_authenticate(
             const auto& cred = cred_opt.value();
             ss::sstring sasl_mechanism;
             bool is_valid{false};
-            if (security::scram_sha256::validate_password(
-                  password,
-                  cred.stored_key(),
-                  cred.salt(),
-                  cred.iterations())) {
+            const auto digest = [&] {
+                hash_sha256 h;
+                h.update(cred.salt());
+                h.update(password());
+                return h.reset();
+            }();
+            auto verified = _verified_passwords.find(username());
+            if (
+              verified != _verified_passwords.end()
+              && verified->second.digest == digest
+              && verified->second.stored_key == cred.stored_key()) {
+                is_valid = true;
+                sasl_mechanism = verified->second.sasl_mechanism;
+            } else if (security::scram_sha256::validate_password(
+                         password,
+                         cred.stored_key(),
+                         cred.salt(),
+                         cred.iterations())) {
                 is_valid = true;
                 sasl_mechanism = security::scram_sha256_authenticator::name;
             } else if (security::scram_sha512::validate_password(
@@ -152,6 +165,17 @@ request_auth_result request_authenticator::do_authenticate(
                   std::move(username), "Unauthorized");
             } else {
                 vlog(logger.trace, "Authenticated user {}", username);
+                if (
+                  verified == _verified_passwords.end()
+                  && _verified_passwords.size() >= max_verified_passwords) {
+                    _verified_passwords.clear();
+                }
+                _verified_passwords.insert_or_assign(
+                  username(),
+                  verified_password{
+                    .digest = digest,
+                    .stored_key = cred.stored_key(),
+                    .sasl_mechanism = sasl_mechanism});
                 const auto& superusers = _superusers();
                 auto found = std::find(
                   superusers.begin(), superusers.end(), username);
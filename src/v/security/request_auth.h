@@ -12,13 +12,17 @@
 #pragma once
 
 #include "cluster/fwd.h"
+#include "bytes/bytes.h"
 #include "config/property.h"
+#include "hashing/secure.h"
 #include "security/fwd.h"
 #include "security/types.h"
 
 #include <seastar/http/exception.hh>
 #include <seastar/http/request.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 class unauthorized_user_exception : public ss::httpd::base_exception {
 public:
     unauthorized_user_exception(
@@ -130,9 +134,24 @@ private:
       security::credential_store const& cred_store,
       bool require_auth);
 
+    /**
+     * Basic auth checks the password against the stored SCRAM credential on
+     * every request, which costs thousands of HMAC iterations. Passwords that
+     * were verified are remembered by a salted digest, never in the clear,
+     * and are trusted for as long as the user's credential is unchanged.
+     */
+    struct verified_password {
+        hash_sha256::digest_type digest;
+        bytes stored_key;
+        ss::sstring sasl_mechanism;
+    };
+
+    static constexpr size_t max_verified_passwords = 1000;
+
     cluster::controller* _controller{nullptr};
     config::binding<bool> _require_auth;
     config::binding<std::vector<ss::sstring>> _superusers;
+    absl::flat_hash_map<ss::sstring, verified_password> _verified_passwords;
 };
 
 inline constexpr std::string_view authz_basic_prefix = "Basic ";
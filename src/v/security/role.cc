@@ -88,6 +88,7 @@ std::optional<role> role_store::get(const role_name& name) const {
 }
 
 bool role_store::remove(const role_name& name) {
+    ++_generation;
     absl::c_for_each(
       _members_store, [&name](members_store_type::value_type& e) {
           e.second.erase(role_name_view{name});
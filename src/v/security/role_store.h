@@ -100,6 +100,7 @@ public:
     bool put(role_name name, const T& role) {
         auto [it, inserted] = _roles.insert(std::move(name));
         if (inserted) {
+            ++_generation;
             for (const auto& m : role) {
                 _members_store[m].emplace(*it);
             }
@@ -120,11 +121,15 @@ public:
     bool remove(const role_name& name);
     bool contains(const role_name& name) const { return _roles.contains(name); }
     void clear() {
+        ++_generation;
         _members_store.clear();
         _roles.clear();
     }
     size_t size() const { return _roles.size(); }
 
+    // Changes whenever role membership may have changed.
+    uint64_t generation() const { return _generation; }
+
     // Retrieve a list of role_names that satisfy some predicate
     //
     // e.g.:
@@ -155,6 +160,7 @@ public:
 private:
     members_store_type _members_store;
     role_set_type _roles;
+    uint64_t _generation{0};
 };
 
 } // namespace security
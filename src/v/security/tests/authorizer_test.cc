@@ -210,6 +210,38 @@ BOOST_AUTO_TEST_CASE(authz_allow_all) {
     BOOST_REQUIRE(!result.empty_matches);
 }
 
+BOOST_AUTO_TEST_CASE(authz_cached_decisions_follow_acl_changes) {
+    acl_principal user(principal_type::user, "user");
+    acl_host host("192.0.4.4");
+    auto auth = make_test_instance();
+
+    acl_entry allow_read(
+      user, acl_wildcard_host, acl_operation::read, acl_permission::allow);
+    resource_pattern resource(
+      resource_type::topic, default_topic(), pattern_type::literal);
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(resource, allow_read);
+
+    // Repeated checks are answered from the decision cache, which must be
+    // dropped whenever the bindings change.
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE(
+          !auth.authorized(default_topic, acl_operation::read, user, host));
+    }
+
+    auth.add_bindings(bindings);
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE(
+          auth.authorized(default_topic, acl_operation::read, user, host));
+    }
+
+    std::vector<acl_binding_filter> filters;
+    filters.emplace_back(resource, allow_read);
+    auth.remove_bindings(filters);
+    BOOST_REQUIRE(
+      !auth.authorized(default_topic, acl_operation::read, user, host));
+}
+
 BOOST_AUTO_TEST_CASE(authz_super_user_allow) {
     acl_principal user1(principal_type::user, "superuser1");
     acl_principal user2(principal_type::user, "superuser2");
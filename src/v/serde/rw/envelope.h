@@ -15,12 +15,174 @@
 #include "serde/envelope_for_each_field.h"
 #include "serde/read_header.h"
 #include "serde/rw/rw.h"
+#include "serde/serde_is_enum.h"
 #include "serde/serde_size_t.h"
+#include "utils/named_type.h"
 
+#include <array>
+#include <bit>
+#include <cstring>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace serde {
 
+namespace detail {
+
+/**
+ * Fixed size fields are encoded as their little endian representation
+ * without any framing, so the layout of a run of consecutive ones is known
+ * at compile time. Envelopes encode such runs through a stack buffer: one
+ * append to the iobuf on write and one copy out of the parser on read,
+ * instead of a call per field. Fields of any other type keep their generic
+ * encoding.
+ *
+ * flat_field<T>::size is the encoded size of T when it is a fixed size
+ * field, 0 otherwise. Only types whose generic encoding is exactly that
+ * representation qualify, so the wire format does not change.
+ */
+template<typename T>
+struct flat_field {
+    static constexpr size_t size = 0;
+};
+
+template<typename T>
+requires(
+  std::is_integral_v<T> || std::is_same_v<T, float>
+  || std::is_same_v<T, double>)
+struct flat_field<T> {
+    static_assert(!std::is_same_v<T, bool> || sizeof(bool) == sizeof(int8_t));
+    static constexpr size_t size = sizeof(T);
+};
+
+template<typename T, typename Tag, typename IsConstexpr>
+struct flat_field<::detail::base_named_type<T, Tag, IsConstexpr>>
+  : flat_field<T> {};
+
+template<typename T>
+requires(flat_field<T>::size > 0 && std::is_arithmetic_v<T>)
+void write_flat_field(char* dst, T t) {
+    if constexpr (std::is_same_v<T, bool>) {
+        auto const v = static_cast<int8_t>(t);
+        std::memcpy(dst, &v, sizeof(v));
+    } else if constexpr (sizeof(T) == 1) {
+        std::memcpy(dst, &t, sizeof(t));
+    } else if constexpr (std::is_same_v<T, float>) {
+        auto const v = htole32(std::bit_cast<std::uint32_t>(t));
+        std::memcpy(dst, &v, sizeof(v));
+    } else if constexpr (std::is_same_v<T, double>) {
+        auto const v = htole64(std::bit_cast<std::uint64_t>(t));
+        std::memcpy(dst, &v, sizeof(v));
+    } else {
+        auto const v = ss::cpu_to_le(t);
+        std::memcpy(dst, &v, sizeof(v));
+    }
+}
+
+template<typename T, typename Tag, typename IsConstexpr>
+void write_flat_field(
+  char* dst, const ::detail::base_named_type<T, Tag, IsConstexpr>& t) {
+    write_flat_field(dst, static_cast<T>(t));
+}
+
+template<typename T>
+requires(flat_field<T>::size > 0 && std::is_arithmetic_v<T>)
+void read_flat_field(const char* src, T& t) {
+    if constexpr (std::is_same_v<T, bool>) {
+        int8_t v{};
+        std::memcpy(&v, src, sizeof(v));
+        t = (v != 0);
+    } else if constexpr (sizeof(T) == 1) {
+        std::memcpy(&t, src, sizeof(t));
+    } else if constexpr (std::is_same_v<T, float>) {
+        std::uint32_t v{};
+        std::memcpy(&v, src, sizeof(v));
+        t = std::bit_cast<float>(le32toh(v));
+    } else if constexpr (std::is_same_v<T, double>) {
+        std::uint64_t v{};
+        std::memcpy(&v, src, sizeof(v));
+        t = std::bit_cast<double>(le64toh(v));
+    } else {
+        T v{};
+        std::memcpy(&v, src, sizeof(v));
+        t = ss::le_to_cpu(v);
+    }
+}
+
+template<typename T, typename Tag, typename IsConstexpr>
+void read_flat_field(
+  const char* src, ::detail::base_named_type<T, Tag, IsConstexpr>& t) {
+    T v{};
+    read_flat_field(src, v);
+    t = ::detail::base_named_type<T, Tag, IsConstexpr>{v};
+}
+
+/// Longest run of fixed size fields encoded through the stack buffer, longer
+/// runs are split on write and read field by field on read
+inline constexpr size_t max_flat_run_size = 128;
+
+class flat_run_writer {
+public:
+    explicit flat_run_writer(iobuf& out)
+      : _out(out) {}
+
+    template<typename T>
+    void append(const T& t) {
+        constexpr auto n = flat_field<T>::size;
+        if (_used + n > _buf.size()) {
+            flush();
+        }
+        write_flat_field(_buf.data() + _used, t);
+        _used += n;
+    }
+
+    void flush() {
+        if (_used > 0) {
+            _out.append(_buf.data(), _used);
+            _used = 0;
+        }
+    }
+
+private:
+    iobuf& _out;
+    std::array<char, max_flat_run_size> _buf;
+    size_t _used{0};
+};
+
+template<typename T>
+auto envelope_fields(T& t) {
+    if constexpr (inherits_from_envelope<T>) {
+        return envelope_to_tuple(t);
+    } else {
+        return reflection::to_tuple(t);
+    }
+}
+
+template<typename Tuple, size_t... I>
+consteval auto flat_run_sizes(std::index_sequence<I...>) {
+    std::array<size_t, sizeof...(I)> runs{
+      flat_field<std::decay_t<std::tuple_element_t<I, Tuple>>>::size...};
+    for (size_t i = runs.size(); i-- > 0;) {
+        if (runs[i] > 0 && i + 1 < runs.size()) {
+            runs[i] += runs[i + 1];
+        }
+    }
+    return runs;
+}
+
+/// For every field of T, the encoded size of the run of fixed size fields
+/// starting at it, or 0 when the field is not fixed size.
+template<typename T>
+consteval auto envelope_flat_runs() {
+    using fields_t = decltype(envelope_fields(std::declval<T&>()));
+    return flat_run_sizes<fields_t>(
+      std::make_index_sequence<std::tuple_size_v<fields_t>>{});
+}
+
+} // namespace detail
+
+
 template<typename T>
 concept has_serde_write = requires(T t, iobuf& out) { t.serde_write(out); };
 
@@ -63,8 +225,35 @@ void tag_invoke(
     if constexpr (has_serde_read<Type>) {
         t.serde_read(in, h);
     } else {
+        [[maybe_unused]] static constexpr auto flat_runs
+          = detail::envelope_flat_runs<Type>();
+        [[maybe_unused]] std::array<char, detail::max_flat_run_size> run_buf;
+        [[maybe_unused]] const char* run_pos = nullptr;
+        [[maybe_unused]] size_t run_left = 0;
+        size_t field_idx = 0;
         envelope_for_each_field(t, [&](auto& f) {
             using FieldType = std::decay_t<decltype(f)>;
+            [[maybe_unused]] const auto idx = field_idx++;
+            if constexpr (detail::flat_field<FieldType>::size > 0) {
+                if (run_left == 0) {
+                    // a run cut short by the end of the envelope (an older
+                    // version of it) is read field by field below
+                    const auto run = flat_runs[idx];
+                    if (
+                      run <= run_buf.size()
+                      && in.bytes_left() >= h._bytes_left_limit + run) {
+                        in.consume_to(run, run_buf.data());
+                        run_pos = run_buf.data();
+                        run_left = run;
+                    }
+                }
+                if (run_left > 0) {
+                    detail::read_flat_field(run_pos, f);
+                    run_pos += detail::flat_field<FieldType>::size;
+                    run_left -= detail::flat_field<FieldType>::size;
+                    return true;
+                }
+            }
             if (h._bytes_left_limit == in.bytes_left()) {
                 return false;
             }
@@ -106,8 +295,17 @@ void tag_invoke(tag_t<write_tag>, iobuf& out, T t) {
     if constexpr (has_serde_write<Type>) {
         t.serde_write(out);
     } else {
-        envelope_for_each_field(
-          t, [&out](auto& f) { write(out, std::move(f)); });
+        detail::flat_run_writer run_writer(out);
+        envelope_for_each_field(t, [&out, &run_writer](auto& f) {
+            using FieldType = std::decay_t<decltype(f)>;
+            if constexpr (detail::flat_field<FieldType>::size > 0) {
+                run_writer.append(f);
+            } else {
+                run_writer.flush();
+                write(out, std::move(f));
+            }
+        });
+        run_writer.flush();
     }
 
     auto const written_size = out.size_bytes() - size_before;
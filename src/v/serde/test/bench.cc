@@ -93,3 +93,76 @@ PERF_TEST(big_10mb, serialize) {
 PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
+
+// Shaped like the raft protocol metadata sent with every append entries and
+// heartbeat request: a run of fixed size fields only.
+struct raft_metadata_t
+  : public serde::
+      envelope<raft_metadata_t, serde::version<0>, serde::compat_version<0>> {
+    model::node_id node{1};
+    int64_t group{2};
+    model::offset commit_index{3};
+    model::term_id term{4};
+    model::offset prev_log_index{5};
+    model::term_id prev_log_term{6};
+    model::offset last_visible_index{7};
+    model::offset dirty_offset{8};
+    bool flush{true};
+};
+
+// Fixed size fields with a variable length one in the middle, like the
+// partition entries of a health report.
+struct partition_status_t
+  : public serde::envelope<
+      partition_status_t,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    int32_t id{1};
+    model::term_id term{2};
+    std::optional<model::node_id> leader_id{model::node_id{3}};
+    int64_t revision_id{4};
+    size_t size_bytes{5};
+    uint8_t leader_flags{6};
+    std::optional<size_t> reclaimable_size_bytes{7};
+};
+
+template<typename T>
+void serialize_many(size_t count) {
+    auto o = iobuf();
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < count; ++i) {
+        serde::write(o, T{});
+    }
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+}
+
+template<typename T>
+void deserialize_many(size_t count) {
+    auto o = iobuf();
+    for (size_t i = 0; i < count; ++i) {
+        serde::write(o, T{});
+    }
+    auto p = iobuf_parser(std::move(o));
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < count; ++i) {
+        perf_tests::do_not_optimize(serde::read<T>(p));
+    }
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(raft_metadata_1k, serialize) {
+    serialize_many<raft_metadata_t>(1000);
+}
+
+PERF_TEST(raft_metadata_1k, deserialize) {
+    deserialize_many<raft_metadata_t>(1000);
+}
+
+PERF_TEST(partition_status_1k, serialize) {
+    serialize_many<partition_status_t>(1000);
+}
+
+PERF_TEST(partition_status_1k, deserialize) {
+    deserialize_many<partition_status_t>(1000);
+}
@@ -233,6 +233,64 @@ SEASTAR_THREAD_TEST_CASE(envelope_test_buffer_too_short) {
     BOOST_CHECK_THROW(serde::read<test_msg1_new>(parser), std::exception);
 }
 
+struct flat_msg_v1
+  : serde::envelope<flat_msg_v1, serde::version<1>, serde::compat_version<0>> {
+    bool operator==(const flat_msg_v1&) const = default;
+
+    int32_t _a;
+    int64_t _b;
+};
+
+struct flat_msg_v2
+  : serde::envelope<flat_msg_v2, serde::version<2>, serde::compat_version<0>> {
+    bool operator==(const flat_msg_v2&) const = default;
+
+    int32_t _a;
+    int64_t _b;
+    bool _c{false};
+    named_type<int16_t, struct flat_msg_tag> _d{-1};
+    ss::sstring _e;
+    double _f{0.5};
+};
+
+SEASTAR_THREAD_TEST_CASE(envelope_flat_fields_test) {
+    // runs of fixed size fields must encode exactly like field by field
+    const auto msg = flat_msg_v2{
+      ._a = -3, ._b = 1LL << 40, ._c = true, ._d{7}, ._e = "abc", ._f = 1.25};
+    auto expected = iobuf();
+    serde::write(expected, msg._a);
+    serde::write(expected, msg._b);
+    serde::write(expected, msg._c);
+    serde::write(expected, msg._d);
+    serde::write(expected, msg._e);
+    serde::write(expected, msg._f);
+
+    auto b = serde::to_iobuf(flat_msg_v2(msg));
+    const auto header = serde::envelope_header_size;
+    BOOST_REQUIRE_EQUAL(b.size_bytes(), header + expected.size_bytes());
+    b.trim_front(header);
+    BOOST_REQUIRE(b == expected);
+
+    BOOST_CHECK(
+      serde::from_iobuf<flat_msg_v2>(serde::to_iobuf(flat_msg_v2(msg)))
+      == msg);
+
+    // an older version ends in the middle of a run
+    auto old = serde::from_iobuf<flat_msg_v2>(
+      serde::to_iobuf(flat_msg_v1{._a = 1, ._b = 2}));
+    BOOST_CHECK_EQUAL(old._a, 1);
+    BOOST_CHECK_EQUAL(old._b, 2);
+    BOOST_CHECK_EQUAL(old._c, false);
+    BOOST_CHECK_EQUAL(old._d(), -1);
+    BOOST_CHECK_EQUAL(old._f, 0.5);
+
+    // and a newer version has more fields than the run
+    auto newer = serde::from_iobuf<flat_msg_v1>(
+      serde::to_iobuf(flat_msg_v2(msg)));
+    BOOST_CHECK_EQUAL(newer._a, -3);
+    BOOST_CHECK_EQUAL(newer._b, 1LL << 40);
+}
+
 SEASTAR_THREAD_TEST_CASE(vector_test) {
     auto b = iobuf();
 
@@ -14,5 +14,6 @@
 namespace ssx {
 
 class singleton_thread_worker;
+class sharded_thread_worker;
 
 } // namespace ssx
@@ -38,11 +38,13 @@ public:
       , _feature_table(feature_table) {}
 
     ss::future<> start() {
+        _resources.segment_index_budget().setup_metrics();
         _kvstore = std::make_unique<kvstore>(
           _kv_conf_cb(), ss::this_shard_id(), _resources, _feature_table);
         return _kvstore->start().then([this] {
             _log_mgr = std::make_unique<log_manager>(
               _log_conf_cb(), kvs(), _resources, _feature_table);
+            _log_mgr->setup_metrics();
             return _log_mgr->start();
         });
     }
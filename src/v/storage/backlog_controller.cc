@@ -30,7 +30,7 @@ backlog_controller_config::backlog_controller_config(
   int64_t sp,
   int initial_shares,
   std::chrono::milliseconds interval,
-  ss::scheduling_group sg,
+  std::optional<ss::scheduling_group> sg,
   ss::io_priority_class iop,
   int min,
   int max)
@@ -127,7 +127,9 @@ ss::future<> backlog_controller::update() {
 
 ss::future<> backlog_controller::set() {
     vlog(_log.debug, "updating shares {}", _current_shares);
-    _scheduling_group.set_shares(static_cast<float>(_current_shares));
+    if (_scheduling_group) {
+        _scheduling_group->set_shares(static_cast<float>(_current_shares));
+    }
     return _io_priority.update_shares(_current_shares);
 }
 
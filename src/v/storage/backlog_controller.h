@@ -17,6 +17,8 @@
 #include <seastar/core/timer.hh>
 #include <seastar/util/log.hh>
 
+#include <optional>
+
 namespace storage {
 struct backlog_controller_config {
     backlog_controller_config(
@@ -27,7 +29,7 @@ struct backlog_controller_config {
       int64_t setpoint,
       int initial_shares,
       std::chrono::milliseconds sampling_interval,
-      ss::scheduling_group sg,
+      std::optional<ss::scheduling_group> sg,
       ss::io_priority_class iopc,
       int min_shares,
       int max_shares);
@@ -39,7 +41,8 @@ struct backlog_controller_config {
     int64_t setpoint;
     int initial_shares;
     std::chrono::milliseconds sampling_interval;
-    ss::scheduling_group scheduling_group;
+    // Only the shares of the I/O priority class are controlled if not set
+    std::optional<ss::scheduling_group> scheduling_group;
     ss::io_priority_class io_priority;
     int min_shares;
     int max_shares;
@@ -115,7 +118,7 @@ private:
     std::chrono::milliseconds _sampling_interval;
     ss::timer<> _sampling_timer;
     // controlled resources
-    ss::scheduling_group _scheduling_group;
+    std::optional<ss::scheduling_group> _scheduling_group;
     ss::io_priority_class _io_priority;
     // state
     int64_t _current_backlog{0};
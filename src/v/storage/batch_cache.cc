@@ -171,7 +171,8 @@ batch_cache::entry batch_cache::put(
 
     if (static_cast<size_t>(input.size_bytes()) > range::range_size) {
         auto r = new range(index, input, dirty);
-        _lru.push_back(*r);
+        _small.push_back(*r);
+        ++_small_ranges;
         _size_bytes += r->memory_size();
         return entry(0, r->weak_from_this());
     }
@@ -180,7 +181,8 @@ batch_cache::entry batch_cache::put(
       !index._small_batches_range || !index._small_batches_range->valid()
       || !index._small_batches_range->fits(input)) {
         auto r = new range(index);
-        _lru.push_back(*r);
+        _small.push_back(*r);
+        ++_small_ranges;
         _size_bytes += r->memory_size();
         index._small_batches_range = r->weak_from_this();
     }
@@ -197,7 +199,7 @@ batch_cache::entry batch_cache::put(
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
-      _size_bytes == 0 && _lru.empty(),
+      _size_bytes == 0 && empty(),
       "Detected incorrect batch_cache accounting. {}",
       *this);
 }
@@ -214,11 +216,40 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
-        _lru.erase_and_dispose(
-          _lru.iterator_to(*p), [](range* e) { delete e; });
+        remove_from_queue(*p);
+        delete p.get(); // NOLINT
     }
 }
 
+batch_cache::range_list::iterator batch_cache::reclaim_range(
+  range_list& queue,
+  range_list::iterator it,
+  range_list& reclaimed,
+  size_t& reclaimed_bytes) {
+    // if entry is empty it will be disposed by other reclaim caller
+    if (unlikely(it->empty())) {
+        return ++it;
+    }
+    // reclaim the batch's record data
+    reclaimed_bytes += it->memory_size();
+    it->_arena.clear();
+
+    /*
+     * if the owning index is locked invalidate the range but leave it on
+     * the queue for deferred deletion so as to not invalidate any open
+     * iterators on the index.
+     */
+    if (unlikely(it->_index.locked())) {
+        it->invalidate();
+        return ++it;
+    }
+
+    // collect the entries that will be fully removed
+    --(it->_in_main ? _main_ranges : _small_ranges);
+    return queue.erase_and_dispose(
+      it, [&reclaimed](range* e) { reclaimed.push_back(*e); });
+}
+
 size_t batch_cache::reclaim(size_t size) {
     // update the available_memory low-water mark: this is a good place to do
     // this because under memory pressure the reclaimer will be called
@@ -258,41 +289,71 @@ size_t batch_cache::reclaim(size_t size) {
      * index still exists even though the batch data was removed.
      */
     size_t reclaimed = 0;
-    intrusive_list<range, &range::_hook> reclaimed_ranges;
+    range_list reclaimed_ranges;
 
-    for (auto it = _lru.begin(); it != _lru.end();) {
-        if (reclaimed >= _reclaim_size) {
-            break;
+    auto done = [&] { return reclaimed >= _reclaim_size; };
+    // skip any range that has a live reference or unpersisted data.
+    auto skip = [](const range& r) { return r.pinned() || !r.clean(); };
+
+    /*
+     * probationary queue: ranges hit since admission are promoted, the rest
+     * are freed. only runs while the queue holds its share of the cache, so
+     * that a burst of one-off reads is what gets evicted first.
+     */
+    if (
+      _small_ranges * 100
+      >= (_small_ranges + _main_ranges) * small_queue_percent) {
+        for (auto it = _small.begin(); it != _small.end() && !done();) {
+            if (unlikely(skip(*it))) {
+                ++it;
+                continue;
+            }
+            if (it->valid() && it->_frequency > 0) {
+                auto& r = *it++;
+                remove_from_queue(r);
+                r._frequency = 0;
+                r._in_main = true;
+                _main.push_back(r);
+                ++_main_ranges;
+                continue;
+            }
+            it = reclaim_range(_small, it, reclaimed_ranges, reclaimed);
         }
+    }
 
-        // skip any range that has a live reference.
-        if (unlikely(it->pinned() || !it->clean())) {
+    /*
+     * main queue: ranges with remaining hits are given another round at the
+     * tail. every range is visited at most max_frequency + 1 times.
+     */
+    size_t visits = _main_ranges * (max_frequency + 1);
+    for (auto it = _main.begin(); it != _main.end() && !done() && visits > 0;
+         --visits) {
+        if (unlikely(skip(*it))) {
             ++it;
             continue;
         }
-        // if entry is empty it will be disposed by other reclaim caller
-        if (unlikely(it->empty())) {
+        if (it->valid() && it->_frequency > 0) {
+            auto& r = *it++;
+            --r._frequency;
+            r._hook.unlink();
+            _main.push_back(r);
             continue;
         }
-        // reclaim the batch's record data
-        reclaimed += it->memory_size();
-        it->_arena.clear();
+        it = reclaim_range(_main, it, reclaimed_ranges, reclaimed);
+    }
 
-        /*
-         * if the owning index is locked invalidate the range but leave it on
-         * the lru list for deferred deletion so as to not invalidate any open
-         * iterators on the index.
-         */
-        if (unlikely(it->_index.locked())) {
-            it->invalidate();
-            ++it;
-            continue;
+    /*
+     * if the policy didn't free enough, fall back to freeing whatever can be
+     * freed, oldest first, since the request comes from memory pressure.
+     */
+    for (auto* queue : {&_small, &_main}) {
+        for (auto it = queue->begin(); it != queue->end() && !done();) {
+            if (unlikely(skip(*it))) {
+                ++it;
+                continue;
+            }
+            it = reclaim_range(*queue, it, reclaimed_ranges, reclaimed);
         }
-
-        // collect the entries that will be fully removed
-        it = _lru.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
-            reclaimed_ranges.push_back(*e);
-        });
     }
 
     /*
@@ -520,11 +581,10 @@ operator<<(std::ostream& os, const batch_cache::reclaim_options& opts) {
 }
 
 std::ostream& operator<<(std::ostream& o, const batch_cache& b) {
-    // NOTE: intrusive list have a O(N) for size.
-    // Do _not_ print size of _lru
     return o << "{is_reclaiming:" << b.is_memory_reclaiming()
              << ", size_bytes: " << b._size_bytes
-             << ", lru_empty:" << b._lru.empty() << "}";
+             << ", small_ranges:" << b._small_ranges
+             << ", main_ranges:" << b._main_ranges << "}";
 }
 std::ostream&
 operator<<(std::ostream& o, const batch_cache_index::read_result& c) {
@@ -39,7 +39,7 @@ class batch_cache_index;
 
 /**
  * The batch cache system consists of two components. The `batch_cache` is a
- * global (per-shard) LRU cache of batches stored in memory. The second
+ * global (per-shard) cache of batches stored in memory. The second
  * component is the `batch_cache_index` which presents an offset-based index
  * into the global cache.
  *
@@ -58,7 +58,21 @@ class batch_cache_index;
  * example, a batch cache index is created for each log segment, all of which
  * share the same LRU cache.
  *
- * The LRU cache serves as an entry point for the Seastar memory reclaimer.
+ * Eviction policy
+ * ===============
+ *
+ * The cache follows S3-FIFO rather than LRU so that a single consumer scanning
+ * a large backlog cannot flush the ranges tailing consumers depend on. Ranges
+ * are admitted into a small probationary FIFO queue. A hit only bumps a small
+ * per-range frequency counter. When the small queue holds at least
+ * `small_queue_percent` of the ranges, reclaim starts there: ranges that were
+ * hit while on probation move to the main queue, the others are freed. The
+ * main queue is a FIFO with reinsertion: ranges with a non-zero frequency are
+ * given another round (with their frequency decremented) and the others are
+ * freed. A scan touches each of its ranges at most once before they fall out
+ * of the small queue, so it only ever competes for the probationary space.
+ *
+ * The cache serves as an entry point for the Seastar memory reclaimer.
  * During a low-memory event Seastar may make an upcall to the LRU cache to free
  * memory. When memory is reclaimed cache entries are invalidated. Since this
  * occurs asynchronously, callers must check that their entries are valid before
@@ -102,6 +116,10 @@ class batch_cache_index;
 class batch_cache {
     /// Minimum size reclaimed in low-memory situations.
     static constexpr size_t min_reclaim_size = 128U << 10U;
+    /// Target share of ranges in the probationary queue.
+    static constexpr size_t small_queue_percent = 10;
+    /// Saturation point of the per-range hit counter.
+    static constexpr uint8_t max_frequency = 3;
 
     using reclaimer = ss::memory::reclaimer;
     using reclaim_scope = ss::memory::reclaimer_scope;
@@ -258,6 +276,10 @@ public:
         model::offset _max_dirty_offset;
 
         size_t _size = 0;
+        // hits since admission or the last pass of the reclaimer
+        uint8_t _frequency{0};
+        // false while the range is on probation in the small queue
+        bool _in_main{false};
         intrusive_list_hook _hook;
         batch_cache_index& _index;
     };
@@ -313,13 +335,13 @@ public:
     ss::future<> stop() { return _background_reclaimer.stop(); }
 
     /// Returns true if the cache is empty, and false otherwise.
-    bool empty() const { return _lru.empty(); }
+    bool empty() const { return _small.empty() && _main.empty(); }
 
     /// Removes all entries from the cache.
     void clear() { reclaim(std::numeric_limits<size_t>::max()); }
 
     /**
-     * Copies a batch into the LRU cache.
+     * Copies a batch into the cache.
      * Copying is needed to release memory references of underlying tempbufs.
      *
      * The returned weak_ptr will be invalidated if its memory is reclaimed. To
@@ -346,10 +368,8 @@ public:
      * Notify the cache that the specified range was recently used.
      */
     void touch(range_ptr& e) {
-        if (e) {
-            auto p = e.get();
-            p->_hook.unlink();
-            _lru.push_back(*p);
+        if (e && e->_frequency < max_frequency) {
+            ++e->_frequency;
         }
     }
 
@@ -441,7 +461,31 @@ private:
                               : reclaim_result::reclaimed_nothing;
     }
 
-    intrusive_list<range, &range::_hook> _lru;
+    using range_list = intrusive_list<range, &range::_hook>;
+
+    /*
+     * Frees the data of the range at `it` and either removes it from `queue`
+     * onto `reclaimed` or, if its index is locked, invalidates it in place.
+     * Returns the iterator following the range.
+     */
+    range_list::iterator reclaim_range(
+      range_list& queue,
+      range_list::iterator it,
+      range_list& reclaimed,
+      size_t& reclaimed_bytes);
+
+    void remove_from_queue(range& r) {
+        r._hook.unlink();
+        --(r._in_main ? _main_ranges : _small_ranges);
+    }
+
+    // probationary queue, where ranges are admitted
+    range_list _small;
+    // ranges that were hit while on probation
+    range_list _main;
+    // intrusive lists do not track their size
+    size_t _small_ranges{0};
+    size_t _main_ranges{0};
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
@@ -18,6 +18,7 @@
 #include "storage/logger.h"
 #include "utils/to_string.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/future-util.hh>
@@ -32,6 +33,29 @@
 
 namespace storage::internal {
 
+ss::future<std::pair<compacted_index::entry, size_t>>
+read_compacted_index_entry(ss::input_stream<char>& in) {
+    auto size_buf = co_await ::read_iobuf_exactly(in, sizeof(uint16_t));
+    size_t bytes_read = size_buf.size_bytes();
+    iobuf_parser size_parser(std::move(size_buf));
+    const size_t entry_size = reflection::adl<uint16_t>{}.from(size_parser);
+
+    auto b = co_await ::read_iobuf_exactly(in, entry_size);
+    bytes_read += b.size_bytes();
+    iobuf_parser p(std::move(b));
+    auto type = reflection::adl<uint8_t>{}.from(p);
+    auto [offset, _1] = p.read_varlong();
+    auto [delta, _2] = p.read_varlong();
+    auto key = compaction_key(p.read_bytes(p.bytes_left()));
+    co_return std::make_pair(
+      compacted_index::entry(
+        compacted_index::entry_type(type),
+        std::move(key),
+        model::offset(offset),
+        delta),
+      bytes_read);
+}
+
 compacted_index_chunk_reader::compacted_index_chunk_reader(
   segment_full_path path,
   ss::file in,
@@ -215,27 +239,11 @@ compacted_index_chunk_reader::load_slice(model::timeout_clock::time_point t) {
                             || next_mem_use > _max_chunk_memory;
                  },
                  [&slice, this] {
-                     return ::read_iobuf_exactly(*_cursor, sizeof(uint16_t))
-                       .then([this](iobuf b) {
-                           _byte_index += b.size_bytes();
-                           iobuf_parser p(std::move(b));
-                           const size_t entry_size
-                             = reflection::adl<uint16_t>{}.from(p);
-                           return ::read_iobuf_exactly(*_cursor, entry_size);
-                       })
-                       .then([this, &slice](iobuf b) {
-                           _byte_index += b.size_bytes();
-                           iobuf_parser p(std::move(b));
-                           auto type = reflection::adl<uint8_t>{}.from(p);
-                           auto [offset, _1] = p.read_varlong();
-                           auto [delta, _2] = p.read_varlong();
-                           auto bytes = p.read_bytes(p.bytes_left());
-                           auto key = compaction_key(std::move(bytes));
-                           slice.push_back(compacted_index::entry(
-                             compacted_index::entry_type(type),
-                             std::move(key),
-                             model::offset(offset),
-                             delta));
+                     return read_compacted_index_entry(*_cursor).then(
+                       [this, &slice](
+                         std::pair<compacted_index::entry, size_t> e) {
+                           _byte_index += e.second;
+                           slice.push_back(std::move(e.first));
                        });
                  })
           .then([&slice] {
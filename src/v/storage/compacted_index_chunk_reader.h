@@ -17,9 +17,15 @@
 #include <seastar/core/iostream.hh>
 
 #include <optional>
+#include <utility>
 namespace storage::internal {
 using namespace storage; // NOLINT
 
+/// \brief reads the entry at the position of `in`, returns it along with the
+/// number of bytes it took in the file
+ss::future<std::pair<compacted_index::entry, size_t>>
+read_compacted_index_entry(ss::input_stream<char>& in);
+
 /// \brief this class loads up slices in chunks tracking memory usage
 ///
 class compacted_index_chunk_reader final : public compacted_index_reader::impl {
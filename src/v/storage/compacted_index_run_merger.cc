@@ -0,0 +1,223 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/compacted_index_run_merger.h"
+
+#include "base/units.h"
+#include "storage/compacted_index.h"
+#include "storage/compacted_index_chunk_reader.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <exception>
+#include <queue>
+#include <vector>
+
+namespace storage::internal {
+
+namespace {
+
+constexpr size_t min_run_buffer_size = 4_KiB;
+constexpr size_t max_run_buffer_size = 128_KiB;
+
+struct run {
+    size_t position;
+    size_t size{0};
+    uint32_t natural_index;
+};
+
+ss::input_stream<char> make_stream(
+  ss::file f,
+  size_t position,
+  size_t size,
+  size_t buffer_size,
+  ss::io_priority_class pc) {
+    ss::file_input_stream_options options;
+    options.buffer_size = buffer_size;
+    options.io_priority_class = pc;
+    options.read_ahead = 1;
+    return ss::make_file_input_stream(
+      std::move(f), position, size, std::move(options));
+}
+
+/// Splits the index into its sorted runs: a new run starts wherever a key is
+/// smaller than the one before it.
+ss::future<std::optional<std::vector<run>>> find_runs(
+  ss::file f, size_t data_size, ss::io_priority_class pc, size_t max_runs) {
+    std::vector<run> runs;
+    runs.push_back(run{.position = 0, .natural_index = 0});
+    auto in = make_stream(f, 0, data_size, max_run_buffer_size, pc);
+    std::exception_ptr ex;
+    try {
+        std::optional<compaction_key> prev;
+        size_t position = 0;
+        uint32_t natural_index = 0;
+        while (position < data_size) {
+            auto [e, size] = co_await read_compacted_index_entry(in);
+            if (size == 0) {
+                break;
+            }
+            if (prev && e.key < *prev) {
+                runs.back().size = position - runs.back().position;
+                if (runs.size() == max_runs) {
+                    break;
+                }
+                runs.push_back(
+                  run{.position = position, .natural_index = natural_index});
+            }
+            prev = std::move(e.key);
+            position += size;
+            ++natural_index;
+            co_await ss::coroutine::maybe_yield();
+        }
+        runs.back().size = position - runs.back().position;
+        if (position < data_size) {
+            runs.clear();
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await in.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    if (runs.empty()) {
+        co_return std::nullopt;
+    }
+    co_return runs;
+}
+
+/// Reads the entries of a single run, in order.
+struct run_cursor {
+    run_cursor(ss::input_stream<char> stream, const run& r)
+      : in(std::move(stream))
+      , bytes_left(r.size)
+      , next_natural_index(r.natural_index) {}
+
+    ss::future<> advance() {
+        head = std::nullopt;
+        if (bytes_left == 0) {
+            co_return;
+        }
+        auto [e, size] = co_await read_compacted_index_entry(in);
+        if (size == 0) {
+            bytes_left = 0;
+            co_return;
+        }
+        bytes_left -= std::min(size, bytes_left);
+        head.emplace(std::move(e));
+        natural_index = next_natural_index++;
+    }
+
+    ss::input_stream<char> in;
+    size_t bytes_left;
+    uint32_t next_natural_index;
+    std::optional<compacted_index::entry> head;
+    uint32_t natural_index{0};
+};
+
+ss::future<roaring::Roaring> merge_runs(std::vector<run_cursor>& cursors) {
+    // min-heap on (key, natural index), so that the entries of a key come
+    // out in the order they were written in
+    auto greater = [&cursors](size_t a, size_t b) {
+        const auto& ea = *cursors[a].head;
+        const auto& eb = *cursors[b].head;
+        if (ea.key != eb.key) {
+            return eb.key < ea.key;
+        }
+        return cursors[b].natural_index < cursors[a].natural_index;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heap(
+      greater);
+    for (size_t i = 0; i < cursors.size(); ++i) {
+        co_await cursors[i].advance();
+        if (cursors[i].head) {
+            heap.push(i);
+        }
+    }
+
+    roaring::Roaring to_keep;
+    std::optional<compaction_key> key;
+    model::offset latest;
+    uint32_t latest_index = 0;
+    while (!heap.empty()) {
+        const auto i = heap.top();
+        heap.pop();
+        auto& c = cursors[i];
+        auto& e = *c.head;
+        const model::offset o = e.offset + model::offset(e.delta);
+        if (!key || e.key != *key) {
+            if (key) {
+                to_keep.add(latest_index);
+            }
+            key = std::move(e.key);
+            latest = o;
+            latest_index = c.natural_index;
+        } else if (o > latest) {
+            // same as the reducer, the first of the latest entries is kept
+            latest = o;
+            latest_index = c.natural_index;
+        }
+        co_await c.advance();
+        if (c.head) {
+            heap.push(i);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    if (key) {
+        to_keep.add(latest_index);
+    }
+    to_keep.shrinkToFit();
+    co_return to_keep;
+}
+
+} // namespace
+
+ss::future<std::optional<roaring::Roaring>> merge_entries_to_keep(
+  ss::file f,
+  size_t data_size,
+  ss::io_priority_class pc,
+  size_t max_memory) {
+    const size_t max_runs = std::max<size_t>(
+      1, max_memory / min_run_buffer_size);
+    auto runs = co_await find_runs(f, data_size, pc, max_runs);
+    if (!runs) {
+        co_return std::nullopt;
+    }
+
+    const size_t buffer_size = std::clamp(
+      max_memory / runs->size(), min_run_buffer_size, max_run_buffer_size);
+    std::vector<run_cursor> cursors;
+    cursors.reserve(runs->size());
+    for (const auto& r : *runs) {
+        cursors.emplace_back(
+          make_stream(f, r.position, r.size, buffer_size, pc), r);
+    }
+
+    std::optional<roaring::Roaring> to_keep;
+    std::exception_ptr ex;
+    try {
+        to_keep = co_await merge_runs(cursors);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    for (auto& c : cursors) {
+        co_await c.in.close();
+    }
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return to_keep;
+}
+
+} // namespace storage::internal
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+
+#include <roaring/roaring.hh>
+
+#include <optional>
+
+namespace storage::internal {
+
+/// \brief exact, bounded memory alternative to `compaction_key_reducer`.
+///
+/// `spill_key_index` writes its entries as runs sorted by key. This finds the
+/// runs of the first `data_size` bytes of the index in `f` and merges them,
+/// so that all the entries of a key are seen together and only the latest one
+/// is kept, whatever the number of keys. Returns the natural indices of the
+/// entries to keep, like `natural_index_of_entries_to_keep`, or std::nullopt
+/// if merging the runs would need more than `max_memory` of read buffers
+/// (e.g. the index predates sorted spills).
+ss::future<std::optional<roaring::Roaring>> merge_entries_to_keep(
+  ss::file f,
+  size_t data_size,
+  ss::io_priority_class,
+  size_t max_memory);
+
+} // namespace storage::internal
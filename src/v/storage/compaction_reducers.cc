@@ -11,6 +11,7 @@
 
 #include "base/vlog.h"
 #include "compression/compression.h"
+#include "config/configuration.h"
 #include "model/record.h"
 #include "model/record_batch_types.h"
 #include "model/record_utils.h"
@@ -275,17 +276,26 @@ copy_data_segment_reducer::filter(model::record_batch batch) {
 }
 
 ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
-  model::compression original, model::record_batch b) {
+  model::compression original,
+  model::record_batch b,
+  std::optional<model::record_batch> compressed) {
     using stop_t = ss::stop_iteration;
     auto to_copy = co_await filter(std::move(b));
     if (to_copy == std::nullopt) {
         co_return stop_t::no;
     }
+    // filtering either returns the input batch, or one with fewer records
+    // (possibly a placeholder with none).
+    const bool unchanged = compressed.has_value()
+                           && to_copy->header().type
+                                == compressed->header().type
+                           && to_copy->record_count()
+                                == compressed->record_count();
     bool compactible_batch = is_compactible(to_copy.value());
     if (_compacted_idx && compactible_batch) {
-        co_await model::for_each_record(
+        co_await model::for_each_record_view(
           to_copy.value(),
-          [&batch = to_copy.value(), this](const model::record& r) {
+          [&batch = to_copy.value(), this](const model::record_view& r) {
               auto& hdr = batch.header();
               return _compacted_idx->index(
                 hdr.type,
@@ -295,12 +305,19 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
                 r.offset_delta());
           });
     }
-    auto batch = co_await compress_batch(original, std::move(to_copy.value()));
+    // an unchanged batch is written back as it was read, there is no need to
+    // compress it again
+    auto batch = unchanged ? std::move(compressed.value())
+                           : co_await compress_batch(
+                             original, std::move(to_copy.value()));
     auto const start_pos = _appender->file_byte_offset();
     auto const header_size = batch.header().size_bytes;
     _acc += header_size;
     // do not set broker_timestamp in this index, leave the operation to the
     // caller who has more context
+    const bool user_data = _internal_topic
+                           || batch.header().type
+                                == model::record_batch_type::raft_data;
     if (_idx.maybe_index(
           _acc,
           32_KiB,
@@ -310,11 +327,28 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
           batch.header().first_timestamp,
           batch.header().max_timestamp,
           std::nullopt,
-          _internal_topic
-            || batch.header().type == model::record_batch_type::raft_data,
+          user_data,
           compactible_batch ? batch.header().record_count : 0)) {
         _acc = 0;
     }
+    if (user_data) {
+        _time_acc += header_size;
+        if (_idx.maybe_index_batch_time(
+              _time_acc,
+              config::shard_local_cfg().storage_time_index_step_bytes(),
+              !_time_skipped,
+              start_pos,
+              batch.base_offset(),
+              batch.header().first_timestamp,
+              batch.header().max_timestamp)) {
+            _time_acc = 0;
+            _time_skipped = false;
+        } else {
+            _time_skipped = true;
+        }
+    }
+    _idx.maybe_add_translator_gap(
+      batch.header().type, batch.base_offset(), batch.last_offset());
     co_await _appender->append(batch);
     vassert(
       _appender->file_byte_offset() == start_pos + header_size,
@@ -337,9 +371,10 @@ copy_data_segment_reducer::operator()(model::record_batch b) {
     if (!b.compressed()) {
         co_return co_await filter_and_append(comp, std::move(b));
     }
-    auto batch = co_await decompress_batch(std::move(b));
+    // keep the compressed batch around in case it doesn't change
+    auto batch = co_await decompress_batch(std::as_const(b));
 
-    co_return co_await filter_and_append(comp, std::move(batch));
+    co_return co_await filter_and_append(comp, std::move(batch), std::move(b));
 }
 
 ss::future<ss::stop_iteration>
@@ -359,12 +394,12 @@ index_rebuilder_reducer::operator()(model::record_batch&& b) {
 
 ss::future<> index_rebuilder_reducer::do_index(model::record_batch&& b) {
     return ss::do_with(std::move(b), [this](model::record_batch& b) {
-        return model::for_each_record(
+        return model::for_each_record_view(
           b,
           [this,
            bt = b.header().type,
            ctrl = b.header().attrs.is_control(),
-           o = b.base_offset()](model::record& r) {
+           o = b.base_offset()](const model::record_view& r) {
               return _w->index(bt, ctrl, r.key(), o, r.offset_delta());
           });
     });
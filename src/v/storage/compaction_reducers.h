@@ -143,8 +143,12 @@ public:
     storage::index_state end_of_stream() { return std::move(_idx); }
 
 private:
-    ss::future<ss::stop_iteration>
-      filter_and_append(model::compression, model::record_batch);
+    /// `compressed` is the batch as read from the segment, if it was
+    /// compressed; it is written back as is when filtering keeps every record.
+    ss::future<ss::stop_iteration> filter_and_append(
+      model::compression,
+      model::record_batch,
+      std::optional<model::record_batch> compressed = std::nullopt);
 
     ss::future<> maybe_keep_offset(
       const model::record_batch&,
@@ -169,6 +173,10 @@ private:
     compacted_index_writer* _compacted_idx;
     index_state _idx;
     size_t _acc{0};
+    // user data bytes since the last batch time index entry, and whether a
+    // user data batch was left out of the batch time index since then
+    size_t _time_acc{0};
+    bool _time_skipped{false};
 
     /// We need to know if this is an internal topic to inform whether to
     /// index on non-raft-data batches
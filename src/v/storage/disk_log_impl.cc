@@ -650,141 +650,165 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
       map.max_offset());
 
     auto segment_modify_lock = co_await _segment_rewrite_lock.get_units();
-    for (auto& seg : segs) {
-        if (cfg.asrc) {
-            cfg.asrc->check();
-        }
-        if (seg->offsets().get_base_offset() > map.max_offset()) {
-            // The map was built from newest to oldest segments within this
-            // sliding range. If we see a new segment whose offsets are all
-            // higher than those indexed, it may be because the segment is
-            // entirely comprised of non-data batches. Mark it as compacted so
-            // we can progress through compactions.
-            seg->mark_as_finished_windowed_compaction();
-            vlog(
-              gclog.debug,
-              "[{}] treating segment as compacted, offsets fall above highest "
-              "indexed key {}, likely because they are non-data batches: {}",
-              config().ntp(),
-              map.max_offset(),
-              seg->filename());
-            continue;
-        }
-        if (!seg->may_have_compactible_records()) {
-            // All data records are already compacted away. Skip to avoid a
-            // needless rewrite.
-            seg->mark_as_finished_windowed_compaction();
-            vlog(
-              gclog.trace,
-              "[{}] treating segment as compacted, either all non-data "
-              "records or the only record is a data record: {}",
-              config().ntp(),
-              seg->filename());
-            continue;
-        }
-        // TODO: implement a segment replacement strategy such that each term
-        // tries to write only one segment (or more if the term had a large
-        // amount of data), rather than replacing N segments with N segments.
-        const auto tmpname = seg->reader().path().to_compaction_staging();
-        const auto cmp_idx_tmpname = tmpname.to_compacted_index();
-        auto staging_to_clean = scoped_file_tracker{
-          cfg.files_to_cleanup, {tmpname, cmp_idx_tmpname}};
-
-        auto appender = co_await internal::make_segment_appender(
-          tmpname,
-          segment_appender::write_behind_memory
-            / internal::chunks().chunk_size(),
-          std::nullopt,
-          cfg.iopc,
-          resources(),
-          cfg.sanitizer_config);
-
-        auto cmp_idx_name = seg->path().to_compacted_index();
-        auto compacted_idx_writer = make_file_backed_compacted_index(
-          cmp_idx_tmpname, cfg.iopc, true, resources(), cfg.sanitizer_config);
+    // The map is read-only from here on and each segment is rewritten into
+    // its own staging files, so several segments can be deduplicated at once
+    // to overlap their reads, decompression and writes. The first failure
+    // stops new rewrites from starting and is rethrown once in-flight ones
+    // complete, as with the sequential loop.
+    const auto parallelism = std::max<size_t>(
+      1, config::shard_local_cfg().log_compaction_rewrite_parallelism());
+    std::exception_ptr rewrite_eptr;
+    co_await ss::max_concurrent_for_each(
+      segs, parallelism, [&](ss::lw_shared_ptr<segment>& seg) -> ss::future<> {
+          if (rewrite_eptr) {
+              co_return;
+          }
+          try {
+              co_await deduplicate_and_replace_segment(cfg, map, seg);
+          } catch (...) {
+              if (!rewrite_eptr) {
+                  rewrite_eptr = std::current_exception();
+              }
+          }
+      });
+    if (rewrite_eptr) {
+        std::rethrow_exception(rewrite_eptr);
+    }
+    _last_compaction_window_start_offset = idx_start_offset;
+    co_return true;
+}
 
+ss::future<> disk_log_impl::deduplicate_and_replace_segment(
+  const compaction_config& cfg,
+  const key_offset_map& map,
+  ss::lw_shared_ptr<segment> seg) {
+    if (cfg.asrc) {
+        cfg.asrc->check();
+    }
+    if (seg->offsets().get_base_offset() > map.max_offset()) {
+        // The map was built from newest to oldest segments within this
+        // sliding range. If we see a new segment whose offsets are all
+        // higher than those indexed, it may be because the segment is
+        // entirely comprised of non-data batches. Mark it as compacted so
+        // we can progress through compactions.
+        seg->mark_as_finished_windowed_compaction();
         vlog(
           gclog.debug,
-          "[{}] Deduplicating data from segment {} to {}: {}",
+          "[{}] treating segment as compacted, offsets fall above highest "
+          "indexed key {}, likely because they are non-data batches: {}",
           config().ntp(),
-          seg->path(),
-          tmpname,
-          seg);
-        auto initial_generation_id = seg->get_generation_id();
-        std::exception_ptr eptr;
-        index_state new_idx;
-        try {
-            new_idx = co_await deduplicate_segment(
-              cfg,
-              map,
-              seg,
-              *appender,
-              compacted_idx_writer,
-              *_probe,
-              storage::internal::should_apply_delta_time_offset(_feature_table),
-              _feature_table);
-
-        } catch (...) {
-            eptr = std::current_exception();
-        }
-        // We must close the segment apender
-        co_await compacted_idx_writer.close();
-        co_await appender->close();
-        if (eptr) {
-            std::rethrow_exception(eptr);
-        }
-
+          map.max_offset(),
+          seg->filename());
+        co_return;
+    }
+    if (!seg->may_have_compactible_records()) {
+        // All data records are already compacted away. Skip to avoid a
+        // needless rewrite.
+        seg->mark_as_finished_windowed_compaction();
         vlog(
-          gclog.debug,
-          "[{}] Replacing segment {} with {}",
+          gclog.trace,
+          "[{}] treating segment as compacted, either all non-data "
+          "records or the only record is a data record: {}",
           config().ntp(),
-          seg->path(),
-          tmpname);
-
-        auto rdr_holder = co_await _readers_cache->evict_segment_readers(seg);
-        auto write_lock = co_await seg->write_lock();
-        if (initial_generation_id != seg->get_generation_id()) {
-            throw std::runtime_error(fmt::format(
-              "Aborting compaction of segment: {}, segment was mutated "
-              "while compacting",
-              seg->path()));
-        }
-        if (seg->is_closed()) {
-            throw segment_closed_exception();
-        }
-        const auto size_before = seg->size_bytes();
-        const auto size_after = appender->file_byte_offset();
+          seg->filename());
+        co_return;
+    }
+    // TODO: implement a segment replacement strategy such that each term
+    // tries to write only one segment (or more if the term had a large
+    // amount of data), rather than replacing N segments with N segments.
+    const auto tmpname = seg->reader().path().to_compaction_staging();
+    const auto cmp_idx_tmpname = tmpname.to_compacted_index();
+    auto staging_to_clean = scoped_file_tracker{
+      cfg.files_to_cleanup, {tmpname, cmp_idx_tmpname}};
 
-        // Clear our indexes before swapping the data files (note, the new
-        // compaction index was opened with the truncate option above).
-        co_await seg->index().drop_all_data();
+    auto appender = co_await internal::make_segment_appender(
+      tmpname,
+      segment_appender::write_behind_memory / internal::chunks().chunk_size(),
+      std::nullopt,
+      cfg.iopc,
+      resources(),
+      cfg.sanitizer_config);
 
-        // Rename the data file.
-        co_await internal::do_swap_data_file_handles(
-          tmpname, seg, cfg, *_probe);
+    auto cmp_idx_name = seg->path().to_compacted_index();
+    auto compacted_idx_writer = make_file_backed_compacted_index(
+      cmp_idx_tmpname, cfg.iopc, true, resources(), cfg.sanitizer_config);
 
-        // Persist the state of our indexes in their new names.
-        seg->index().swap_index_state(std::move(new_idx));
-        seg->force_set_commit_offset_from_index();
-        seg->release_batch_cache_index();
-        co_await seg->index().flush();
-        co_await ss::rename_file(
-          cmp_idx_tmpname.string(), cmp_idx_name.string());
+    vlog(
+      gclog.debug,
+      "[{}] Deduplicating data from segment {} to {}: {}",
+      config().ntp(),
+      seg->path(),
+      tmpname,
+      seg);
+    auto initial_generation_id = seg->get_generation_id();
+    std::exception_ptr eptr;
+    index_state new_idx;
+    try {
+        new_idx = co_await deduplicate_segment(
+          cfg,
+          map,
+          seg,
+          *appender,
+          compacted_idx_writer,
+          *_probe,
+          storage::internal::should_apply_delta_time_offset(_feature_table),
+          _feature_table);
 
-        seg->mark_as_finished_windowed_compaction();
-        _probe->segment_compacted();
-        _probe->add_compaction_removed_bytes(
-          ssize_t(size_before) - ssize_t(size_after));
-
-        compaction_result res(size_before, size_after);
-        _compaction_ratio.update(res.compaction_ratio());
-        seg->advance_generation();
-        staging_to_clean.clear();
-        vlog(
-          gclog.debug, "[{}] Final compacted segment {}", config().ntp(), seg);
+    } catch (...) {
+        eptr = std::current_exception();
     }
-    _last_compaction_window_start_offset = idx_start_offset;
-    co_return true;
+    // We must close the segment apender
+    co_await compacted_idx_writer.close();
+    co_await appender->close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+
+    vlog(
+      gclog.debug,
+      "[{}] Replacing segment {} with {}",
+      config().ntp(),
+      seg->path(),
+      tmpname);
+
+    auto rdr_holder = co_await _readers_cache->evict_segment_readers(seg);
+    auto write_lock = co_await seg->write_lock();
+    if (initial_generation_id != seg->get_generation_id()) {
+        throw std::runtime_error(fmt::format(
+          "Aborting compaction of segment: {}, segment was mutated "
+          "while compacting",
+          seg->path()));
+    }
+    if (seg->is_closed()) {
+        throw segment_closed_exception();
+    }
+    const auto size_before = seg->size_bytes();
+    const auto size_after = appender->file_byte_offset();
+
+    // Clear our indexes before swapping the data files (note, the new
+    // compaction index was opened with the truncate option above).
+    co_await seg->index().drop_all_data();
+
+    // Rename the data file.
+    co_await internal::do_swap_data_file_handles(tmpname, seg, cfg, *_probe);
+
+    // Persist the state of our indexes in their new names.
+    seg->index().swap_index_state(std::move(new_idx));
+    seg->force_set_commit_offset_from_index();
+    seg->release_batch_cache_index();
+    co_await seg->index().flush();
+    co_await ss::rename_file(cmp_idx_tmpname.string(), cmp_idx_name.string());
+
+    seg->mark_as_finished_windowed_compaction();
+    _probe->segment_compacted();
+    _probe->add_compaction_removed_bytes(
+      ssize_t(size_before) - ssize_t(size_after));
+
+    compaction_result res(size_before, size_after);
+    _compaction_ratio.update(res.compaction_ratio());
+    seg->advance_generation();
+    staging_to_clean.clear();
+    vlog(gclog.debug, "[{}] Final compacted segment {}", config().ntp(), seg);
 }
 
 std::optional<std::pair<segment_set::iterator, segment_set::iterator>>
@@ -1178,6 +1202,11 @@ ss::future<> disk_log_impl::housekeeping(housekeeping_config cfg) {
      */
     auto new_start_offset = co_await do_gc(cfg.gc);
 
+    /*
+     * move closed segments past the hot tier limits to the cold data directory
+     */
+    co_await demote_cold_segments(cfg.compact.iopc);
+
     /*
      * comapction. could factor out into a public interface like gc/retention if
      * there is a need to run it separately.
@@ -1213,6 +1242,89 @@ ss::future<> disk_log_impl::housekeeping(housekeeping_config cfg) {
     _probe->set_compaction_ratio(_compaction_ratio.get());
 }
 
+ss::future<> disk_log_impl::demote_cold_segments(ss::io_priority_class iopc) {
+    const auto& cold_dir = _manager.config().cold_dir;
+    const auto max_age
+      = config::shard_local_cfg().storage_cold_tier_segment_age_ms();
+    const auto hot_bytes
+      = config::shard_local_cfg().storage_hot_tier_partition_bytes();
+    // compaction rewrites segment files in place, which would pull them back
+    // into the hot tier right away
+    if (
+      !cold_dir.has_value() || config().is_compacted() || _segs.size() < 2
+      || (!max_age.has_value() && !hot_bytes.has_value())) {
+        co_return;
+    }
+
+    const auto retention_cfg = time_based_retention_cfg::make(
+      _feature_table.local());
+    const auto age_cutoff = max_age.has_value()
+                              ? model::timestamp(
+                                  model::timestamp::now().value()
+                                  - max_age->count())
+                              : model::timestamp::min();
+
+    // pick the candidates up front: demotion has scheduling points and the
+    // segment set may change underneath it. the head segment always stays.
+    std::vector<ss::lw_shared_ptr<segment>> candidates;
+    size_t bytes_from_head = _segs.back()->size_bytes();
+    for (auto it = std::next(_segs.rbegin()); it != _segs.rend(); ++it) {
+        const auto& seg = *it;
+        bytes_from_head += seg->size_bytes();
+        if (seg->is_demoted() || seg->has_appender() || seg->is_tombstone()) {
+            continue;
+        }
+        const bool over_budget = hot_bytes.has_value()
+                                 && bytes_from_head > *hot_bytes;
+        const bool too_old = max_age.has_value()
+                             && seg->index().retention_timestamp(retention_cfg)
+                                  < age_cutoff;
+        if (over_budget || too_old) {
+            candidates.push_back(seg);
+        }
+    }
+
+    for (auto& seg : candidates) {
+        if (_compaction_as.abort_requested()) {
+            co_return;
+        }
+        // the read lock keeps the segment from being closed, truncated or
+        // removed while its file is copied
+        auto lock = co_await seg->read_lock();
+        if (seg->is_closed() || seg->is_tombstone() || seg->has_appender()) {
+            continue;
+        }
+        const auto& path = seg->reader().path();
+        try {
+            // segments demoted before a restart are only links on disk
+            if (co_await internal::cold_segment_target(path)) {
+                seg->mark_as_demoted();
+                continue;
+            }
+            auto cold_path = path.with_base_dir(*cold_dir);
+            co_await internal::demote_segment_file(
+              path, std::filesystem::path(cold_path), iopc);
+        } catch (...) {
+            vlog(
+              stlog.warn,
+              "[{}] Unable to demote segment {} to {}: {}",
+              config().ntp(),
+              path,
+              *cold_dir,
+              std::current_exception());
+            co_return;
+        }
+        seg->mark_as_demoted();
+        seg->clear_cached_disk_usage();
+        vlog(
+          stlog.info,
+          "[{}] Demoted segment {} to {}",
+          config().ntp(),
+          path,
+          *cold_dir);
+    }
+}
+
 ss::future<> disk_log_impl::do_compact(
   compaction_config compact_cfg,
   std::optional<model::offset> new_start_offset) {
@@ -1689,6 +1801,63 @@ ss::future<> disk_log_impl::force_roll(ss::io_priority_class iopc) {
       });
 }
 
+ss::future<> disk_log_impl::adopt_segment(segment_full_path path) {
+    vassert(!_closed, "adopt_segment on closed log - {}", *this);
+    auto roll_lock_holder = co_await _segments_rolling_lock.get_units();
+    auto ofs = offsets();
+    auto next_offset = model::next_offset(ofs.dirty_offset);
+    if (ofs.dirty_offset < model::offset(0)) {
+        next_offset = std::max(ofs.start_offset, model::offset(0));
+    }
+    if (path.get_base_offset() != next_offset) {
+        throw std::invalid_argument(fmt::format(
+          "Can not adopt segment {} into log {}, expected base offset {}",
+          path,
+          config().ntp(),
+          next_offset));
+    }
+
+    auto seg = co_await _manager.open_log_segment(
+      config(),
+      path,
+      config::shard_local_cfg().storage_read_buffer_size(),
+      config::shard_local_cfg().storage_read_readahead_count());
+    bool valid = false;
+    try {
+        valid = co_await seg->materialize_index();
+    } catch (...) {
+        vlog(
+          stlog.warn,
+          "Error materializing index of adopted segment {} - {}",
+          path,
+          std::current_exception());
+    }
+    if (
+      !valid || seg->offsets().get_base_offset() != next_offset
+      || seg->offsets().get_dirty_offset() < next_offset) {
+        co_await seg->close();
+        throw std::runtime_error(fmt::format(
+          "Segment {} can not be adopted, index valid: {}, offsets: {}",
+          path,
+          valid,
+          seg->offsets()));
+    }
+
+    if (!_segs.empty() && _segs.back()->has_appender()) {
+        co_await _segs.back()->release_appender(_readers_cache.get());
+    }
+    co_await remove_empty_segments();
+    if (config().is_compacted()) {
+        seg->mark_as_compacted_segment();
+    }
+    vlog(stlog.info, "Adopted segment {}", seg);
+    _probe->add_initial_segment(*seg);
+    _segs.add(std::move(seg));
+    _probe->segment_created();
+    _stm_manager->make_snapshot_in_background();
+    co_await _offset_translator.sync_with_log(*this, _compaction_as);
+}
+
 ss::future<> disk_log_impl::maybe_roll_unlocked(
   model::term_id t, model::offset next_offset, ss::io_priority_class iopc) {
     vassert(
@@ -1954,6 +2123,7 @@ disk_log_impl::offset_range_size(
     }
 
     // Left subscan
+    co_await segments.front()->index().ensure_materialized();
     auto ix_left = segments.front()->index().find_nearest(first);
     if (ix_left.has_value()) {
         // We have found an index entry.
@@ -1979,6 +2149,7 @@ disk_log_impl::offset_range_size(
       io_priority);
 
     // Right subscan
+    co_await segments.back()->index().ensure_materialized();
     auto ix_right = segments.back()->index().find_nearest(last);
     if (ix_right.has_value()) {
         vlog(
@@ -2129,6 +2300,7 @@ disk_log_impl::offset_range_size(
         // segment end. When we subsequently creating uploads using this method
         // only the first upload will have to do scanning to find the
         // offset.
+        co_await first_segment->index().ensure_materialized();
         auto ix_res = first_segment->index().find_nearest(first);
 
         first_segment_file_pos = co_await get_file_offset(
@@ -2337,8 +2509,17 @@ disk_log_impl::make_reader(log_reader_config config) {
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(timequery_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
-    return _lock_mngr.range_lock(config).then(
-      [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
+    return _lock_mngr.range_lock(config)
+      .then([](std::unique_ptr<lock_manager::lease> lease) {
+          if (lease->range.empty()) {
+              return ss::make_ready_future<std::unique_ptr<lock_manager::lease>>(
+                std::move(lease));
+          }
+          auto& idx = (*lease->range.begin())->index();
+          return idx.ensure_materialized().then(
+            [lease = std::move(lease)]() mutable { return std::move(lease); });
+      })
+      .then([this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
           auto start_offset = cfg.min_offset;
 
           if (!lease->range.empty()) {
@@ -2347,7 +2528,23 @@ disk_log_impl::make_reader(timequery_config config) {
 
               // The index (and hence, binary search) is used only if the
               // timestamps on the batches are monotonically increasing.
-              if (segment->index().batch_timestamps_are_monotonic()) {
+              if (auto match = segment->index().find_batch_time(cfg.time);
+                  match.has_value()) {
+                  // the batch time index is denser, and only ever points at
+                  // or before the batch holding the answer
+                  index_entry = segment_index::entry{
+                    .offset = match->offset,
+                    .timestamp = match->timestamp,
+                    .filepos = match->position,
+                  };
+                  vlog(
+                    stlog.debug,
+                    "Used batch time index to find batch for timestamp {}: "
+                    "offset={} with ts={}",
+                    cfg.time,
+                    index_entry->offset,
+                    index_entry->timestamp);
+              } else if (segment->index().batch_timestamps_are_monotonic()) {
                   index_entry = segment->index().find_nearest(cfg.time);
                   vlog(
                     stlog.debug,
@@ -2440,12 +2637,57 @@ disk_log_impl::index_lower_bound(model::offset o) const {
     return std::nullopt;
 }
 
+ss::future<std::optional<timequery_result>>
+disk_log_impl::index_timequery(const timequery_config& cfg) {
+    // the batch time index of internal topics covers every batch type, so
+    // its answers only hold for data batches of user topics
+    if (cfg.type_filter != model::record_batch_type::raft_data) {
+        co_return std::nullopt;
+    }
+    auto lease = co_await _lock_mngr.range_lock(cfg);
+    if (lease->range.empty()) {
+        co_return std::nullopt;
+    }
+    const auto& segment = *lease->range.begin();
+    if (segment->reader().path().is_internal_topic()) {
+        co_return std::nullopt;
+    }
+    co_await segment->index().ensure_materialized();
+    auto match = segment->index().find_batch_time(cfg.time);
+    if (
+      !match.has_value() || !match->exact || match->offset < cfg.min_offset
+      || match->offset > cfg.max_offset) {
+        co_return std::nullopt;
+    }
+    vlog(
+      stlog.debug,
+      "Answered timequery for ts={} from the batch time index of {}: "
+      "offset={} with ts={}",
+      cfg.time,
+      segment->reader().filename(),
+      match->offset,
+      match->timestamp);
+    co_return timequery_result(match->offset, match->timestamp);
+}
+
 ss::future<std::optional<timequery_result>>
 disk_log_impl::timequery(timequery_config cfg) {
     vassert(!_closed, "timequery on closed log - {}", *this);
     if (_segs.empty()) {
         return ss::make_ready_future<std::optional<timequery_result>>();
     }
+    return index_timequery(cfg).then(
+      [this, cfg](std::optional<timequery_result> indexed) {
+          if (indexed.has_value()) {
+              return ss::make_ready_future<std::optional<timequery_result>>(
+                indexed);
+          }
+          return scan_timequery(cfg);
+      });
+}
+
+ss::future<std::optional<timequery_result>>
+disk_log_impl::scan_timequery(timequery_config cfg) {
     return make_reader(cfg).then([cfg](model::record_batch_reader reader) {
         return model::consume_reader_to_memory(
                  std::move(reader), model::no_timeout)
@@ -137,6 +137,7 @@ public:
     void bg_checkpoint_offset_translator();
 
     ss::future<> force_roll(ss::io_priority_class) override;
+    ss::future<> adopt_segment(segment_full_path) override;
 
     probe& get_probe() override { return *_probe; }
     model::term_id term() const;
@@ -243,6 +244,13 @@ private:
     // Returns if the update actually took place.
     ss::future<bool> update_start_offset(model::offset o);
 
+    // Rewrites `seg` without the records superseded by keys in `map` and
+    // swaps the result in place of the segment's data and indices.
+    ss::future<> deduplicate_and_replace_segment(
+      const compaction_config&,
+      const key_offset_map&,
+      ss::lw_shared_ptr<segment>);
+
     ss::future<compaction_result> compact_adjacent_segments(
       std::pair<segment_set::iterator, segment_set::iterator>,
       storage::compaction_config cfg);
@@ -250,6 +258,13 @@ private:
     find_compaction_range(const compaction_config&);
 
     ss::future<std::optional<model::offset>> do_gc(gc_config);
+    /// Answers a timequery from the batch time index without reading the
+    /// segment, if the index is conclusive.
+    ss::future<std::optional<timequery_result>>
+    index_timequery(const timequery_config&);
+    ss::future<std::optional<timequery_result>>
+      scan_timequery(timequery_config);
+    ss::future<> demote_cold_segments(ss::io_priority_class);
     ss::future<> do_compact(
       compaction_config, std::optional<model::offset> new_start_offset);
 
@@ -0,0 +1,85 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/flush_coordinator.h"
+
+#include "ssx/future-util.h"
+
+#include <seastar/core/do_with.hh>
+#include <seastar/core/loop.hh>
+
+#include <chrono>
+
+namespace storage {
+
+flush_coordinator::flush_coordinator(config::binding<uint32_t> window_us)
+  : _window_us(std::move(window_us)) {
+    _timer.set_callback([this] { dispatch(); });
+    _window_us.watch([this] {
+        if (_window_us() == 0) {
+            _timer.cancel();
+            dispatch();
+        }
+    });
+}
+
+flush_coordinator::~flush_coordinator() noexcept {
+    _timer.cancel();
+    // release any waiters, dispatched flushes don't refer back to this
+    dispatch();
+}
+
+ss::future<> flush_coordinator::flush(ss::file& f) {
+    ++_flushes;
+    if (_window_us() == 0) {
+        ++_syncs;
+        ++_batches;
+        return f.flush();
+    }
+
+    auto [it, inserted] = _pending_index.try_emplace(&f, _pending.size());
+    if (inserted) {
+        _pending.emplace_back(f);
+    }
+    auto& waiters = _pending[it->second].waiters;
+    waiters.emplace_back();
+    auto fut = waiters.back().get_future();
+    if (!_timer.armed()) {
+        _timer.arm(std::chrono::microseconds(_window_us()));
+    }
+    return fut;
+}
+
+void flush_coordinator::dispatch() {
+    if (_pending.empty()) {
+        return;
+    }
+    ++_batches;
+    _syncs += _pending.size();
+    _pending_index.clear();
+    ssx::background = ss::do_with(
+      std::exchange(_pending, {}), [](chunked_vector<pending_flush>& batch) {
+          return ss::parallel_for_each(batch, [](pending_flush& p) {
+              return p.file.flush().then_wrapped([&p](ss::future<> f) {
+                  if (f.failed()) {
+                      auto e = f.get_exception();
+                      for (auto& w : p.waiters) {
+                          w.set_exception(e);
+                      }
+                  } else {
+                      for (auto& w : p.waiters) {
+                          w.set_value();
+                      }
+                  }
+              });
+          });
+      });
+}
+
+} // namespace storage
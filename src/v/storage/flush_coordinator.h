@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "container/fragmented_vector.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/timer.hh>
+
+#include <cstdint>
+#include <vector>
+
+namespace storage {
+
+/**
+ * Shard-wide coordinator of segment flushes.
+ *
+ * With many low throughput partitions per shard every acks=all produce
+ * request ends up in its own fdatasync. When a coalescing window is
+ * configured, flushes requested by segment appenders are held for at most
+ * that long and then dispatched together, so that they reach the io
+ * subsystem in a single batch and all waiters are released as a group.
+ * Flushes requested through the same file object within one window share
+ * a single fdatasync.
+ *
+ * With a zero window flushes are issued immediately.
+ *
+ * Owned by storage_resources, one instance per shard.
+ */
+class flush_coordinator {
+public:
+    explicit flush_coordinator(config::binding<uint32_t> window_us);
+    flush_coordinator(const flush_coordinator&) = delete;
+    flush_coordinator& operator=(const flush_coordinator&) = delete;
+    flush_coordinator(flush_coordinator&&) = delete;
+    flush_coordinator& operator=(flush_coordinator&&) = delete;
+    ~flush_coordinator() noexcept;
+
+    /// Flush `f`, resolving once all writes to it completed before the call
+    /// are durable. The file object identifies the caller: it must stay at
+    /// the same address until the returned future resolves.
+    ss::future<> flush(ss::file& f);
+
+    /// Number of flushes requested
+    uint64_t flushes() const { return _flushes; }
+    /// Number of fdatasync calls issued
+    uint64_t syncs() const { return _syncs; }
+    /// Number of groups flushes were dispatched in
+    uint64_t batches() const { return _batches; }
+
+private:
+    struct pending_flush {
+        explicit pending_flush(ss::file f)
+          : file(std::move(f)) {}
+
+        ss::file file;
+        std::vector<ss::promise<>> waiters;
+    };
+
+    void dispatch();
+
+    config::binding<uint32_t> _window_us;
+    chunked_vector<pending_flush> _pending;
+    // index of pending flushes by the address of the requesting file object
+    absl::flat_hash_map<const ss::file*, size_t> _pending_index;
+    ss::timer<> _timer;
+    uint64_t _flushes{0};
+    uint64_t _syncs{0};
+    uint64_t _batches{0};
+};
+
+} // namespace storage
@@ -127,6 +127,14 @@ segment_full_path segment_full_path::to_staging() const {
     }
 }
 
+segment_full_path segment_full_path::with_base_dir(ss::sstring base_dir) const {
+    vassert(
+      !override_path.has_value(), "Cannot rebase mock path {}", *override_path);
+    auto copy = *this;
+    copy.dir_part.base_dir = std::move(base_dir);
+    return copy;
+}
+
 std::ostream& operator<<(std::ostream& o, const partition_path& p) {
     o << ss::format("{}_{}", p.ntp.path(), p.revision_id);
     return o;
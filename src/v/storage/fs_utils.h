@@ -139,6 +139,12 @@ public:
     segment_full_path to_compaction_staging() const;
     segment_full_path to_staging() const;
 
+    /**
+     * The same file under a different data directory, e.g. the location a
+     * segment is demoted to in the cold data directory.
+     */
+    segment_full_path with_base_dir(ss::sstring base_dir) const;
+
     /**
      * Hydrate the metadata into a fully qualified filesystem path.
      */
@@ -24,6 +24,7 @@
 #include "serde/rw/scalar.h"
 #include "serde/rw/vector.h"
 #include "serde/serde_exception.h"
+#include "serde/serde_size_t.h"
 #include "storage/index_state_serde_compat.h"
 #include "storage/logger.h"
 #include "utils/to_string.h"
@@ -31,6 +32,7 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <optional>
 
 namespace storage {
@@ -42,6 +44,14 @@ index_state index_state::make_empty_index(offset_delta_time with_offset) {
     return idx;
 }
 
+void index_state::maybe_add_translator_gap(
+  model::record_batch_type type, model::offset base, model::offset last) {
+    static const auto types = model::offset_translator_batch_types();
+    if (std::find(types.begin(), types.end(), type) != types.end()) {
+        add_translator_gap(base, last);
+    }
+}
+
 bool index_state::maybe_index(
   size_t accumulator,
   size_t step,
@@ -124,6 +134,114 @@ bool index_state::maybe_index(
     return retval;
 }
 
+bool index_state::maybe_index_batch_time(
+  size_t accumulator,
+  size_t step,
+  bool follows_previous,
+  size_t starting_position_in_file,
+  model::offset batch_base_offset,
+  model::timestamp first_timestamp,
+  model::timestamp last_timestamp) {
+    // without the time offset negative deltas can't be represented, and
+    // lookups would have to second guess every entry
+    if (!batch_time_index || with_offset == offset_delta_time::no) {
+        return false;
+    }
+    if (!batch_time_index->empty() && accumulator < step) {
+        return false;
+    }
+    const auto first_delta = first_timestamp() - base_timestamp();
+    const auto max_delta = last_timestamp() - base_timestamp();
+    const auto representable = [](model::timestamp::type delta) {
+        return delta >= offset_time_index::delta_time_min
+               && delta <= offset_time_index::delta_time_max;
+    };
+    if (!representable(first_delta) || !representable(max_delta)) {
+        return false;
+    }
+    batch_time_index->push_back(batch_time_entry{
+      // We know that a segment cannot be > 4GB
+      .relative_offset = static_cast<uint32_t>(
+        batch_base_offset() - base_offset()),
+      .relative_first_timestamp
+      = offset_time_index{model::timestamp(first_delta), with_offset}
+          .raw_value(),
+      .relative_max_timestamp
+      = offset_time_index{model::timestamp(max_delta), with_offset}.raw_value(),
+      .position = starting_position_in_file,
+      .follows_previous = follows_previous,
+    });
+    return true;
+}
+
+void index_state::truncate_batch_time_index(model::offset new_max_offset) {
+    if (!batch_time_index) {
+        return;
+    }
+    while (!batch_time_index->empty()
+           && base_offset() + batch_time_index->back().relative_offset
+                > new_max_offset()) {
+        batch_time_index->pop_back();
+    }
+}
+
+std::optional<index_state::batch_time_match>
+index_state::find_batch_time(model::timestamp ts) const {
+    if (
+      !batch_time_index || batch_time_index->empty()
+      || !batch_timestamps_are_monotonic
+      || with_offset == offset_delta_time::no) {
+        return std::nullopt;
+    }
+    const auto to_timestamp = [this](uint32_t raw) {
+        return model::timestamp(
+          base_timestamp() + model::timestamp::type(raw)
+          - offset_time_index::offset);
+    };
+
+    // with monotonic batch timestamps the max timestamps are sorted, so this
+    // is the first indexed batch a reader wouldn't skip
+    const auto needle
+      = offset_time_index{model::timestamp(ts() - base_timestamp()), with_offset}
+          .raw_value();
+    auto it = std::lower_bound(
+      batch_time_index->begin(),
+      batch_time_index->end(),
+      needle,
+      [](const batch_time_entry& e, uint32_t v) {
+          return e.relative_max_timestamp < v;
+      });
+    if (it == batch_time_index->end()) {
+        return std::nullopt;
+    }
+
+    if (!it->follows_previous) {
+        // the answer may be in a batch that wasn't indexed, one of those
+        // following the previous entry. the first entry always follows.
+        if (it == batch_time_index->begin()) {
+            return std::nullopt;
+        }
+        it = std::prev(it);
+        return batch_time_match{
+          .offset = model::offset(it->relative_offset + base_offset()),
+          .timestamp = to_timestamp(it->relative_first_timestamp),
+          .position = it->position,
+          .exact = false,
+        };
+    }
+
+    // every user data batch before this one has a max timestamp below `ts`,
+    // so the first record of this batch is the answer unless `ts` falls
+    // inside of the batch
+    const auto first = to_timestamp(it->relative_first_timestamp);
+    return batch_time_match{
+      .offset = model::offset(it->relative_offset + base_offset()),
+      .timestamp = first,
+      .position = it->position,
+      .exact = first >= ts,
+    };
+}
+
 std::ostream& operator<<(std::ostream& o, const index_state& s) {
     return o << "{header_bitflags:" << s.bitflags
              << ", base_offset:" << s.base_offset
@@ -136,12 +254,34 @@ std::ostream& operator<<(std::ostream& o, const index_state& s) {
              << ", non_data_timestamps:" << s.non_data_timestamps
              << ", broker_timestamp:" << s.broker_timestamp
              << ", num_compactible_records_appended:"
-             << s.num_compactible_records_appended << ", index("
+             << s.num_compactible_records_appended << ", translator_gaps:"
+             << (s.translator_gaps ? fmt::format("{}", s.translator_gaps->size())
+                                   : "unknown")
+             << ", batch_time_index:"
+             << (s.batch_time_index
+                   ? fmt::format("{}", s.batch_time_index->size())
+                   : "unknown")
+             << ", index("
              << s.relative_offset_index.size() << ","
              << s.relative_time_index.size() << "," << s.position_index.size()
              << ")}";
 }
 
+index_state::column_layout
+index_state::column_layout::for_entries(size_t entries) {
+    constexpr size_t count_size = sizeof(serde::serde_size_t);
+    // envelope header, size of the nested blob, bitflags, base and max
+    // offsets and timestamps
+    constexpr size_t header_size = serde::envelope_header_size + count_size
+                                   + sizeof(uint32_t) + 4 * sizeof(int64_t);
+    column_layout l{};
+    l.relative_offsets = header_size + count_size;
+    l.relative_times = l.relative_offsets + entries * sizeof(uint32_t)
+                       + count_size;
+    l.positions = l.relative_times + entries * sizeof(uint32_t) + count_size;
+    return l;
+}
+
 void index_state::serde_write(iobuf& out) const {
     using serde::write;
 
@@ -159,6 +299,14 @@ void index_state::serde_write(iobuf& out) const {
     write(tmp, non_data_timestamps);
     write(tmp, broker_timestamp);
     write(tmp, num_compactible_records_appended);
+    write(
+      tmp,
+      translator_gaps ? std::make_optional(translator_gaps->copy())
+                      : std::nullopt);
+    write(
+      tmp,
+      batch_time_index ? std::make_optional(batch_time_index->copy())
+                       : std::nullopt);
 
     crc::crc32c crc;
     crc_extend_iobuf(crc, tmp);
@@ -185,6 +333,8 @@ void read_nested(
         in.skip(sizeof(int8_t));
         st = serde_compat::index_state_serde::decode(in);
         st.batch_timestamps_are_monotonic = false;
+        st.translator_gaps = std::nullopt;
+        st.batch_time_index = std::nullopt;
         return;
     }
 
@@ -232,6 +382,13 @@ void read_nested(
     read_nested(p, st.relative_time_index, 0U);
     read_nested(p, st.position_index, 0U);
 
+    if (hdr._version < index_state::translator_gaps_version) {
+        st.translator_gaps = std::nullopt;
+    }
+    if (hdr._version < index_state::batch_time_index_version) {
+        st.batch_time_index = std::nullopt;
+    }
+
     if (hdr._version < index_state::monotonic_timestamps_version) {
         st.batch_timestamps_are_monotonic = false;
         return;
@@ -255,6 +412,12 @@ void read_nested(
     } else {
         st.num_compactible_records_appended = std::nullopt;
     }
+    if (hdr._version >= index_state::translator_gaps_version) {
+        read_nested(p, st.translator_gaps, 0U);
+    }
+    if (hdr._version >= index_state::batch_time_index_version) {
+        read_nested(p, st.batch_time_index, 0U);
+    }
 }
 
 } // namespace storage
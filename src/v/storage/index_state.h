@@ -15,6 +15,7 @@
 #include "container/fragmented_vector.h"
 #include "features/feature_table.h"
 #include "model/fundamental.h"
+#include "model/record_batch_types.h"
 #include "model/timestamp.h"
 #include "serde/envelope.h"
 
@@ -73,6 +74,46 @@ private:
     friend struct index_state;
 };
 
+/// Offsets of a batch that offset translation skips, i.e. of a batch with one
+/// of the model::offset_translator_batch_types().
+struct translator_gap
+  : serde::
+      envelope<translator_gap, serde::version<0>, serde::compat_version<0>> {
+    model::offset base_offset;
+    model::offset last_offset;
+
+    friend bool operator==(const translator_gap&, const translator_gap&)
+      = default;
+
+    auto serde_fields() { return std::tie(base_offset, last_offset); }
+};
+
+/// A user data batch recorded in the batch time index. Timestamps are
+/// offset_time_index raw values relative to the segment base timestamp.
+struct batch_time_entry
+  : serde::
+      envelope<batch_time_entry, serde::version<0>, serde::compat_version<0>> {
+    uint32_t relative_offset{0};
+    uint32_t relative_first_timestamp{0};
+    uint32_t relative_max_timestamp{0};
+    uint64_t position{0};
+    // no user data batch was left out between the previous entry (or the
+    // start of the segment) and this one
+    bool follows_previous{false};
+
+    friend bool operator==(const batch_time_entry&, const batch_time_entry&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(
+          relative_offset,
+          relative_first_timestamp,
+          relative_max_timestamp,
+          position,
+          follows_previous);
+    }
+};
+
 /* Fileformat:
    1 byte  - version
    4 bytes - size - does not include the version or size
@@ -89,15 +130,33 @@ private:
    1 byte  - batch_timestamps_are_monotonic
    1 byte  - with_offset
    1 byte  - non_data_timestamps
+   ...
+   [] translator_gaps
+   [] batch_time_index
  */
 struct index_state
-  : serde::envelope<index_state, serde::version<7>, serde::compat_version<4>> {
+  : serde::envelope<index_state, serde::version<9>, serde::compat_version<4>> {
     static constexpr auto monotonic_timestamps_version = 5;
     static constexpr auto broker_timestamp_version = 6;
     static constexpr auto num_compactible_records_version = 7;
+    static constexpr auto translator_gaps_version = 8;
+    static constexpr auto batch_time_index_version = 9;
 
     static index_state make_empty_index(offset_delta_time with_offset);
 
+    /// File positions of the lookup columns of a serde encoded index with
+    /// `entries` entries. The columns follow the fixed size header fields,
+    /// which have not changed since the first serde version, so the layout
+    /// holds for any serde version of the file (but not the compat format).
+    struct column_layout {
+        // each column is prefixed by its element count
+        size_t relative_offsets;
+        size_t relative_times;
+        size_t positions;
+
+        static column_layout for_entries(size_t entries);
+    };
+
     index_state() = default;
 
     index_state(index_state&&) noexcept = default;
@@ -119,9 +178,13 @@ struct index_state
     model::timestamp max_timestamp{0};
 
     /// breaking indexes into their own has a 6x latency reduction
-    fragmented_vector<uint32_t> relative_offset_index;
-    fragmented_vector<uint32_t> relative_time_index;
-    fragmented_vector<uint64_t> position_index;
+    ///
+    /// chunked_vector grows like a std::vector up to the max fragment size,
+    /// so lightly populated indices (the common case with many partitions)
+    /// only pay for what they hold instead of a full fragment per column.
+    chunked_vector<uint32_t> relative_offset_index;
+    chunked_vector<uint32_t> relative_time_index;
+    chunked_vector<uint64_t> position_index;
 
     // flag indicating whether the maximum timestamp on the batches
     // of this segment are monontonically increasing.
@@ -148,10 +211,37 @@ struct index_state
     // support this field, and we can't conclude anything.
     std::optional<size_t> num_compactible_records_appended{0};
 
+    // Every batch in the segment that offset translation skips, in offset
+    // order. Lets the offset translator catch up with the log without reading
+    // it. Such batches are rare (raft configuration, archival metadata, ...),
+    // so unlike the columns above this is never evicted.
+    //
+    // std::nullopt if this index was written in a version that didn't track
+    // them, in which case the segment has to be read instead.
+    std::optional<chunked_vector<translator_gap>> translator_gaps{
+      chunked_vector<translator_gap>{}};
+
+    // User data batches indexed by timestamp at a configurable density,
+    // usually much denser than the columns above, so that timequeries can be
+    // answered from the index alone. Evicted together with the columns above.
+    //
+    // std::nullopt if this index was written in a version that didn't have
+    // it, in which case timequeries use the columns above.
+    std::optional<chunked_vector<batch_time_entry>> batch_time_index{
+      chunked_vector<batch_time_entry>{}};
+
     size_t size() const { return relative_offset_index.size(); }
 
     bool empty() const { return relative_offset_index.empty(); }
 
+    /// Approximate number of bytes of heap memory held by the index columns.
+    size_t memory_size() const {
+        return relative_offset_index.memory_size()
+               + relative_time_index.memory_size()
+               + position_index.memory_size()
+               + (batch_time_index ? batch_time_index->memory_size() : 0);
+    }
+
     void add_entry(
       uint32_t relative_offset, offset_time_index relative_time, uint64_t pos) {
         relative_offset_index.push_back(relative_offset);
@@ -166,6 +256,15 @@ struct index_state
             non_data_timestamps = false;
         }
     }
+    // drops the last n entries in one pass over each column
+    void pop_back_n(size_t n) {
+        relative_offset_index.pop_back_n(n);
+        relative_time_index.pop_back_n(n);
+        position_index.pop_back_n(n);
+        if (empty()) {
+            non_data_timestamps = false;
+        }
+    }
     std::tuple<uint32_t, offset_time_index, uint64_t>
     get_entry(size_t i) const {
         return {
@@ -178,6 +277,9 @@ struct index_state
         relative_offset_index.shrink_to_fit();
         relative_time_index.shrink_to_fit();
         position_index.shrink_to_fit();
+        if (batch_time_index) {
+            batch_time_index->shrink_to_fit();
+        }
     }
 
     std::optional<std::tuple<uint32_t, offset_time_index, uint64_t>>
@@ -189,11 +291,11 @@ struct index_state
           std::end(relative_time_index),
           idx.raw_value(),
           std::less<uint32_t>{});
-        if (it == relative_offset_index.end()) {
+        if (it == relative_time_index.end()) {
             return std::nullopt;
         }
 
-        const auto dist = std::distance(relative_offset_index.begin(), it);
+        const auto dist = std::distance(relative_time_index.begin(), it);
 
         // lower_bound will place us on the first batch in the index that has
         // 'max_timestamp' greater than 'ts'. Since not every batch is indexed,
@@ -206,6 +308,62 @@ struct index_state
         return get_entry(dist > 0 ? dist - 1 : 0);
     }
 
+    void add_translator_gap(model::offset base, model::offset last) {
+        if (translator_gaps) {
+            translator_gaps->push_back(
+              translator_gap{.base_offset = base, .last_offset = last});
+        }
+    }
+
+    /// Records the batch as a translator gap if it has one of the
+    /// model::offset_translator_batch_types().
+    void maybe_add_translator_gap(
+      model::record_batch_type, model::offset base, model::offset last);
+
+    /// Drops the translator gaps of batches above `new_max_offset`.
+    void truncate_translator_gaps(model::offset new_max_offset) {
+        if (!translator_gaps) {
+            return;
+        }
+        while (!translator_gaps->empty()
+               && translator_gaps->back().base_offset > new_max_offset) {
+            translator_gaps->pop_back();
+        }
+    }
+
+    /// Adds a user data batch to the batch time index if it is the first one
+    /// in the segment, or if `accumulator`, the user data bytes appended since
+    /// the previous entry including this batch, reached `step`. Callers pass
+    /// `follows_previous` false once they appended a user data batch that
+    /// wasn't indexed. Returns true if an entry was added. Must be called
+    /// after maybe_index().
+    bool maybe_index_batch_time(
+      size_t accumulator,
+      size_t step,
+      bool follows_previous,
+      size_t starting_position_in_file,
+      model::offset batch_base_offset,
+      model::timestamp first_timestamp,
+      model::timestamp last_timestamp);
+
+    /// Drops the batch time index entries of batches above `new_max_offset`.
+    void truncate_batch_time_index(model::offset new_max_offset);
+
+    struct batch_time_match {
+        model::offset offset;
+        model::timestamp timestamp;
+        uint64_t position;
+        // `offset` is the first user data record with a timestamp at or
+        // after the queried one, reading the segment would not change it
+        bool exact;
+    };
+
+    /// Looks the timestamp up in the batch time index. Returns the batch to
+    /// start reading from, or std::nullopt if the index can't tell, e.g.
+    /// because batch timestamps are not monotonic.
+    std::optional<batch_time_match>
+    find_batch_time(model::timestamp ts) const;
+
     bool maybe_index(
       size_t accumulator,
       size_t step,
@@ -243,7 +401,13 @@ private:
       , with_offset(o.with_offset)
       , non_data_timestamps(o.non_data_timestamps)
       , broker_timestamp(o.broker_timestamp)
-      , num_compactible_records_appended(o.num_compactible_records_appended) {}
+      , num_compactible_records_appended(o.num_compactible_records_appended)
+      , translator_gaps(
+          o.translator_gaps ? std::make_optional(o.translator_gaps->copy())
+                            : std::nullopt)
+      , batch_time_index(
+          o.batch_time_index ? std::make_optional(o.batch_time_index->copy())
+                             : std::nullopt) {}
 };
 
 } // namespace storage
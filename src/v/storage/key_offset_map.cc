@@ -10,6 +10,9 @@
  */
 #include "storage/key_offset_map.h"
 
+#include <bit>
+#include <cstring>
+
 namespace storage {
 
 simple_key_offset_map::simple_key_offset_map(std::optional<size_t> max_keys)
@@ -253,4 +256,173 @@ hash_key_offset_map::hash_key(const compaction_key& key) const {
     }
 }
 
+uint32_t bucketed_hash_key_offset_map::bucket::match(uint16_t tag) const {
+    // compare the four 16 bit tags in one go: lanes equal to the tag become
+    // zero after the xor and are then picked out with the usual zero-lane
+    // trick. lanes above a zero lane may be reported spuriously because of
+    // the borrow, so each candidate is confirmed against the tag below.
+    static constexpr uint64_t lsb = 0x0001'0001'0001'0001ULL;
+    static constexpr uint64_t msb = 0x8000'8000'8000'8000ULL;
+    uint64_t word;
+    std::memcpy(&word, tags.data(), sizeof(word));
+    const auto x = word ^ (lsb * tag);
+    auto candidates = (x - lsb) & ~x & msb;
+    uint32_t mask = 0;
+    while (candidates != 0) {
+        const auto slot = static_cast<size_t>(std::countr_zero(candidates))
+                          / 16;
+        if (tags[slot] == tag) {
+            mask |= 1U << slot;
+        }
+        candidates &= candidates - 1;
+    }
+    return mask;
+}
+
+std::tuple<bucketed_hash_key_offset_map::find_result, size_t, size_t>
+bucketed_hash_key_offset_map::find(const hashed_key& key) const {
+    ++search_count_;
+    const auto num_buckets = buckets_.size();
+    for (size_t i = 0; i < num_buckets; ++i) {
+        ++probe_count_;
+        const auto b = (key.bucket + i) % num_buckets;
+        const auto& bkt = buckets_[b];
+        for (auto mask = bkt.match(key.tag); mask != 0; mask &= mask - 1) {
+            const auto slot = static_cast<size_t>(std::countr_zero(mask));
+            if (bkt.residuals[slot] == key.residual) {
+                return {find_result::found, b, slot};
+            }
+        }
+        // slots are never freed, so a bucket with a free slot ends the probe
+        // sequence of every key whose home bucket comes before it.
+        if (const auto empty = bkt.match(empty_tag); empty != 0) {
+            return {
+              find_result::empty_slot,
+              b,
+              static_cast<size_t>(std::countr_zero(empty))};
+        }
+    }
+    return {find_result::no_slot, 0, 0};
+}
+
+seastar::future<std::optional<model::offset>>
+bucketed_hash_key_offset_map::get(const compaction_key& key) const {
+    if (buckets_.empty()) {
+        return seastar::make_ready_future<std::optional<model::offset>>(
+          std::nullopt);
+    }
+    const auto [res, b, slot] = find(hash_key(key));
+    if (res != find_result::found) {
+        return seastar::make_ready_future<std::optional<model::offset>>(
+          std::nullopt);
+    }
+    return seastar::make_ready_future<std::optional<model::offset>>(
+      buckets_[b].offsets[slot]);
+}
+
+seastar::future<bool> bucketed_hash_key_offset_map::put(
+  const compaction_key& key, model::offset offset) {
+    if (buckets_.empty()) {
+        return seastar::make_ready_future<bool>(false);
+    }
+    const auto hashed = hash_key(key);
+    const auto [res, b, slot] = find(hashed);
+    auto& bkt = buckets_[b];
+    switch (res) {
+    case find_result::found:
+        if (offset > bkt.offsets[slot]) {
+            bkt.offsets[slot] = offset;
+            max_offset_ = std::max(max_offset_, offset);
+        }
+        return seastar::make_ready_future<bool>(true);
+    case find_result::empty_slot:
+        if (size_ >= capacity_) {
+            return seastar::make_ready_future<bool>(false);
+        }
+        bkt.tags[slot] = hashed.tag;
+        bkt.residuals[slot] = hashed.residual;
+        bkt.offsets[slot] = offset;
+        ++size_;
+        max_offset_ = std::max(max_offset_, offset);
+        return seastar::make_ready_future<bool>(true);
+    case find_result::no_slot:
+        return seastar::make_ready_future<bool>(false);
+    }
+    __builtin_unreachable();
+}
+
+model::offset bucketed_hash_key_offset_map::max_offset() const {
+    return max_offset_;
+}
+
+size_t bucketed_hash_key_offset_map::size() const { return size_; }
+size_t bucketed_hash_key_offset_map::capacity() const { return capacity_; }
+
+seastar::future<>
+bucketed_hash_key_offset_map::initialize(size_t size_bytes) {
+    co_await fragmented_vector_clear_async(buckets_);
+    while (buckets_.memory_size() < size_bytes) {
+        for (size_t i = 0; i < buckets_.elements_per_fragment(); ++i) {
+            buckets_.push_back(bucket{});
+        }
+        if (seastar::need_preempt()) {
+            co_await seastar::maybe_yield();
+        }
+    }
+    size_ = 0;
+    max_offset_ = model::offset{};
+    const auto slots = buckets_.size() * bucket_width;
+    if (slots > 0) {
+        capacity_ = std::max(
+          size_t(1),
+          static_cast<size_t>(static_cast<double>(slots) * max_load_factor));
+    } else {
+        capacity_ = 0;
+    }
+    search_count_ = 0;
+    probe_count_ = 0;
+}
+
+seastar::future<> bucketed_hash_key_offset_map::reset() {
+    co_await fragmented_vector_fill_async(buckets_, bucket{});
+    size_ = 0;
+    max_offset_ = model::offset{};
+    search_count_ = 0;
+    probe_count_ = 0;
+}
+
+double bucketed_hash_key_offset_map::hit_rate() const {
+    if (probe_count_ == 0) {
+        return 1.0;
+    }
+    return static_cast<double>(search_count_)
+           / static_cast<double>(probe_count_);
+}
+
+bucketed_hash_key_offset_map::hashed_key
+bucketed_hash_key_offset_map::hash_key(const compaction_key& key) const {
+    hash_type::digest_type digest;
+    try {
+        hasher_.update(key);
+        digest = hasher_.reset();
+    } catch (...) {
+        hasher_.reset();
+        throw;
+    }
+
+    // the home bucket, the tag and the residual are taken from disjoint
+    // bytes of the digest so that they are independent of each other.
+    hashed_key ret{};
+    auto it = digest.data();
+    std::memcpy(&ret.bucket, it, sizeof(ret.bucket));
+    it += sizeof(ret.bucket);
+    std::memcpy(&ret.tag, it, sizeof(ret.tag));
+    it += sizeof(ret.tag);
+    std::memcpy(ret.residual.data(), it, ret.residual.size());
+    if (ret.tag == empty_tag) {
+        ret.tag = 1;
+    }
+    return ret;
+}
+
 } // namespace storage
@@ -189,4 +189,103 @@ private:
     mutable size_t probe_count_{0};
 };
 
+/**
+ * A key_offset_map with the same semantics as hash_key_offset_map, but laid
+ * out to index more keys per byte and to touch a single cache line per probe.
+ *
+ * The table is an array of 64 byte buckets of 4 slots each. A slot stores a
+ * 16 bit tag, 48 more bits of the key hash and the offset, for 16 bytes per
+ * key compared to 40 bytes in hash_key_offset_map. A lookup hashes to a home
+ * bucket, compares all 4 tags of the bucket with one 64 bit word operation and
+ * only compares the remaining hash bits of slots whose tag matches. A bucket
+ * with a free slot terminates the probe sequence; otherwise the search moves
+ * on to the next bucket.
+ *
+ * Two keys are only confused if they share a home bucket and the same 64 bits
+ * of hash, which is negligible for any key count that fits in memory.
+ *
+ * Like hash_key_offset_map this container has no capacity until
+ * `initialize(size_bytes)` is called, and `initialize(0)` should be used to
+ * release large instances without stalling the reactor.
+ */
+class bucketed_hash_key_offset_map final : public key_offset_map {
+    static constexpr double max_load_factor = 0.95;
+
+public:
+    seastar::future<std::optional<model::offset>>
+    get(const compaction_key& key) const override;
+
+    seastar::future<bool>
+    put(const compaction_key& key, model::offset offset) override;
+
+    model::offset max_offset() const override;
+
+    size_t size() const override;
+    size_t capacity() const override;
+
+    /**
+     * Reset the map to have capacity \p size_bytes. Destroys all existing
+     * data in the map.
+     */
+    seastar::future<> initialize(size_t size_bytes);
+
+    /**
+     * Clear all entries without changing the capacity of the container.
+     */
+    seastar::future<> reset();
+
+    /**
+     * The ratio of hash table searches to the number of buckets visited.
+     */
+    double hit_rate() const;
+
+private:
+    using hash_type = hash_sha256;
+    static constexpr size_t bucket_width = 4;
+    static constexpr uint16_t empty_tag = 0;
+
+    using residual_type = std::array<uint8_t, 6>;
+
+    struct hashed_key {
+        uint64_t bucket;
+        uint16_t tag;
+        residual_type residual;
+    };
+
+    struct alignas(64) bucket {
+        std::array<uint16_t, bucket_width> tags{};
+        std::array<residual_type, bucket_width> residuals{};
+        std::array<model::offset, bucket_width> offsets{};
+
+        /// Bitmask of the slots whose tag is equal to \p tag.
+        uint32_t match(uint16_t tag) const;
+    };
+    static_assert(sizeof(bucket) == 64);
+
+    enum class find_result {
+        found,
+        // not found, slot is where the key would be inserted
+        empty_slot,
+        // not found and there isn't a free slot in the table
+        no_slot,
+    };
+
+    /**
+     * Look up \p key and return the bucket and slot of either the key or the
+     * first free slot in its probe sequence.
+     */
+    std::tuple<find_result, size_t, size_t> find(const hashed_key&) const;
+
+    hashed_key hash_key(const compaction_key&) const;
+
+    mutable hash_type hasher_;
+    chunked_vector<bucket> buckets_;
+
+    size_t size_{0};
+    model::offset max_offset_;
+    size_t capacity_{0};
+    mutable size_t search_count_{0};
+    mutable size_t probe_count_{0};
+};
+
 } // namespace storage
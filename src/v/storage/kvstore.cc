@@ -35,6 +35,28 @@ static ss::logger lg("kvstore");
 
 namespace storage {
 
+static std::string_view key_space_name(kvstore::key_space ks) {
+    switch (ks) {
+    case kvstore::key_space::testing:
+        return "testing";
+    case kvstore::key_space::consensus:
+        return "consensus";
+    case kvstore::key_space::storage:
+        return "storage";
+    case kvstore::key_space::controller:
+        return "controller";
+    case kvstore::key_space::offset_translator:
+        return "offset_translator";
+    case kvstore::key_space::usage:
+        return "usage";
+    case kvstore::key_space::stms:
+        return "stms";
+    case kvstore::key_space::shard_placement:
+        return "shard_placement";
+    }
+    return "unknown";
+}
+
 kvstore::kvstore(
   kvstore_config kv_conf,
   ss::shard_id shard,
@@ -48,6 +70,8 @@ kvstore::kvstore(
       std::filesystem::path(_ntpc.work_directory()),
       simple_snapshot_manager::default_snapshot_filename,
       ss::default_priority_class())
+  , _consensus_commit_interval(
+      config::shard_local_cfg().kvstore_consensus_flush_interval.bind())
   , _timer([this] { _sem.signal(); }) {
     if (_conf.sanitizer_config) {
         _ntp_sanitizer_config = _conf.sanitizer_config->get_config_for_ntp(
@@ -91,6 +115,24 @@ ss::future<> kvstore::start() {
               [this] { return _db.size(); },
               ss::metrics::description("Number of keys in the database")),
           });
+
+        auto key_space_label = ss::metrics::label("key_space");
+        std::vector<ss::metrics::metric_definition> latency_defs;
+        latency_defs.reserve(key_space_count);
+        for (size_t i = 0; i < key_space_count; ++i) {
+            auto ks = static_cast<key_space>(i);
+            latency_defs.push_back(ss::metrics::make_histogram(
+              "write_latency_us",
+              [this, ks] {
+                  return _probe.write_latency_for(ks)
+                    .internal_histogram_logform();
+              },
+              ss::metrics::description(
+                "Latency of durably writing an entry, by key space"),
+              {key_space_label(ss::sstring(key_space_name(ks)))}));
+        }
+        _probe.metrics.add_group(
+          prometheus_sanitize::metrics_name("storage:kvstore"), latency_defs);
     }
 
     return recover()
@@ -135,6 +177,7 @@ ss::future<> kvstore::stop() {
     // it starts these ops begin cancelled would be ops that arrived between the
     // start of a flush and this service being stopped.
     for (auto& op : _ops) {
+        op.latency->cancel();
         op.done.set_exception(ss::gate_closed_exception());
     }
     _ops.clear();
@@ -193,15 +236,28 @@ ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
 
     key = make_spaced_key(ks, key);
     return ss::with_gate(
-      _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
-          auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
-              _timer.arm(_conf.commit_interval());
+      _gate,
+      [this, ks, key = std::move(key), value = std::move(value)]() mutable {
+          auto& w = _ops.emplace_back(
+            std::move(key),
+            std::move(value),
+            _probe.write_latency_for(ks).auto_measure());
+          // flush no later than the deadline of the most urgent pending op
+          auto deadline = ss::timer<>::clock::now() + commit_interval(ks);
+          if (!_timer.armed() || deadline < _timer.get_timeout()) {
+              _timer.rearm(deadline);
           }
           return w.done.get_future();
       });
 }
 
+std::chrono::milliseconds kvstore::commit_interval(key_space ks) const {
+    if (ks == key_space::consensus) {
+        return std::min(_consensus_commit_interval(), _conf.commit_interval());
+    }
+    return _conf.commit_interval();
+}
+
 ss::future<> kvstore::for_each(
   key_space ks,
   ss::noncopyable_function<void(bytes_view, const iobuf&)> visitor) {
@@ -285,6 +341,7 @@ ss::future<> kvstore::flush_and_apply_ops() {
       .then([this, last_offset, ops = std::move(ops)](auto units) mutable {
           for (auto& op : ops) {
               apply_op(std::move(op.key), std::move(op.value), units);
+              op.latency.reset();
               op.done.set_value();
           }
           _next_offset = last_offset + model::offset(1);
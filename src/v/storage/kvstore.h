@@ -21,6 +21,7 @@
 #include "storage/segment_set.h"
 #include "storage/snapshot.h"
 #include "storage/types.h"
+#include "utils/log_hist.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
@@ -28,6 +29,8 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/timer.hh>
 
+#include <array>
+
 namespace storage {
 
 /**
@@ -50,6 +53,12 @@ namespace storage {
  * flushed to disk. Once the flush is complete the operations are applied to the
  * in-memory cache, and the associated promise is resolved.
  *
+ * The commit interval depends on the key space of the operation: writes to
+ * latency sensitive key spaces (raft consensus metadata) use their own,
+ * typically shorter, interval so that they are not held back by the cadence
+ * chosen for bulk writes. Whichever pending operation has the earliest
+ * deadline determines when the next flush happens.
+ *
  * Concurrency
  * ===========
  *
@@ -104,6 +113,8 @@ public:
         shard_placement = 7,
         /* your sub-system here */
     };
+    static constexpr size_t key_space_count
+      = static_cast<size_t>(key_space::shard_placement) + 1;
 
     explicit kvstore(
       kvstore_config kv_conf,
@@ -148,6 +159,10 @@ private:
     simple_snapshot_manager _snap;
     bool _started{false};
 
+    config::binding<std::chrono::milliseconds> _consensus_commit_interval;
+
+    using hist_t = log_hist_internal;
+
     /**
      * Database operation. A std::nullopt value is a deletion.
      */
@@ -155,10 +170,16 @@ private:
         bytes key;
         std::optional<iobuf> value;
         ss::promise<> done;
+        // records the time from submission until the op is durable
+        std::unique_ptr<hist_t::measurement> latency;
 
-        op(bytes&& key, std::optional<iobuf>&& value)
+        op(
+          bytes&& key,
+          std::optional<iobuf>&& value,
+          std::unique_ptr<hist_t::measurement> latency)
           : key(std::move(key))
-          , value(std::move(value)) {}
+          , value(std::move(value))
+          , latency(std::move(latency)) {}
     };
 
     /*
@@ -178,6 +199,7 @@ private:
     std::optional<ntp_sanitizer_config> _ntp_sanitizer_config;
 
     ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
+    std::chrono::milliseconds commit_interval(key_space ks) const;
     void apply_op(
       bytes key, std::optional<iobuf> value, ssx::semaphore_units const&);
     ss::future<> flush_and_apply_ops();
@@ -239,6 +261,12 @@ private:
         uint64_t entries_removed{0};
         size_t cached_bytes{0};
 
+        std::array<hist_t, key_space_count> write_latency;
+
+        hist_t& write_latency_for(key_space ks) {
+            return write_latency.at(static_cast<size_t>(ks));
+        }
+
         metrics::internal_metric_groups metrics;
     };
 
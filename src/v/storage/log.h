@@ -210,6 +210,15 @@ public:
     // roll immediately with the current term.
     virtual ss::future<> force_roll(ss::io_priority_class) = 0;
 
+    /*
+     * Appends a closed segment whose files were written to their final
+     * location in the partition directory by other means, e.g. copied from
+     * another replica. The segment must start at the next offset of the log,
+     * the active segment, if any, is rolled. Throws if the segment can't be
+     * opened or its index isn't valid, the log is left unchanged then.
+     */
+    virtual ss::future<> adopt_segment(segment_full_path) = 0;
+
     virtual probe& get_probe() = 0;
 
     /*
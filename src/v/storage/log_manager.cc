@@ -12,6 +12,7 @@
 #include "base/likely.h"
 #include "base/vlog.h"
 #include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/timestamp.h"
@@ -32,6 +33,7 @@
 #include "storage/segment_appender.h"
 #include "storage/segment_index.h"
 #include "storage/segment_reader.h"
+#include "storage/segment_scrubber.h"
 #include "storage/segment_set.h"
 #include "storage/segment_utils.h"
 #include "storage/storage_resources.h"
@@ -43,11 +45,14 @@
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/map_reduce.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/print.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/core/with_scheduling_group.hh>
 #include <seastar/coroutine/maybe_yield.hh>
@@ -56,9 +61,11 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/file.hh>
 
+#include <absl/container/btree_map.h>
 #include <boost/algorithm/string/predicate.hpp>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <filesystem>
@@ -143,7 +150,12 @@ log_manager::log_manager(
   , _feature_table(feature_table)
   , _jitter(_config.compaction_interval())
   , _trigger_gc_jitter(0s, 5s)
-  , _batch_cache(_config.reclaim_opts) {
+  , _batch_cache(_config.reclaim_opts)
+  , _segment_pool(
+      std::filesystem::path(_config.base_dir),
+      config::shard_local_cfg().storage_segment_pool_size.bind(),
+      _resources,
+      _config.compaction_sg) {
     _config.compaction_interval.watch([this]() {
         _jitter = simple_time_jitter<ss::lowres_clock>{
           _config.compaction_interval()};
@@ -151,6 +163,35 @@ log_manager::log_manager(
     });
 }
 
+void log_manager::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:batch_cache"),
+      {
+        sm::make_gauge(
+          "size_bytes",
+          [this] { return _batch_cache.size_bytes(); },
+          sm::description("Bytes of record batches held in the batch cache")),
+      });
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:local_scrubber"),
+      {
+        sm::make_counter(
+          "bytes_read",
+          [this] { return _scrubbed_bytes; },
+          sm::description("Bytes of segments read by the local scrubber")),
+        sm::make_counter(
+          "corrupted_ranges",
+          [this] { return _scrub_corrupted_ranges; },
+          sm::description(
+            "Ranges of batches the local scrubber found to fail their "
+            "checksum")),
+      });
+}
+
 ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
     auto clean_segment = co_await log->close();
 
@@ -171,11 +212,16 @@ ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
 }
 
 ss::future<> log_manager::start() {
+    co_await _segment_pool.start();
     if (unlikely(config::shard_local_cfg()
                    .log_disable_housekeeping_for_tests.value())) {
         co_return;
     }
     ssx::spawn_with_gate(_gate, [this] { return housekeeping(); });
+    ssx::spawn_with_gate(_gate, [this] {
+        return ss::with_scheduling_group(
+          _config.compaction_sg, [this] { return scrub(); });
+    });
     co_return;
 }
 
@@ -184,6 +230,7 @@ ss::future<> log_manager::stop() {
     _housekeeping_sem.broken();
 
     co_await _gate.close();
+    co_await _segment_pool.stop();
     co_await ss::coroutine::parallel_for_each(
       _logs, [this](logs_type::value_type& entry) {
           return clean_close(entry.second->handle);
@@ -249,7 +296,7 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
       && is_not_set(_logs_list.front().flags, bflags::compacted)) {
         auto compaction_mem_bytes
           = memory_groups().compaction_reserved_memory();
-        auto compaction_map = std::make_unique<hash_key_offset_map>();
+        auto compaction_map = std::make_unique<bucketed_hash_key_offset_map>();
         co_await compaction_map->initialize(compaction_mem_bytes);
         _compaction_hash_key_map = std::move(compaction_map);
     }
@@ -287,6 +334,194 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
     }
 }
 
+ss::future<> log_manager::gc_by_reclaimable_size() {
+    /*
+     * build a schedule of partitions to gc ordered by amount of estimated
+     * reclaimable space. since logs may be asynchronously deleted doing this
+     * safely is tricky.
+     */
+    absl::btree_multimap<size_t, model::ntp, std::greater<>> ntp_by_gc_size;
+
+    /*
+     * first we build a collection of ntp's as their estimated reclaimable disk
+     * space. the loop and disk_usage() are safe against concurrent log
+     * removals.
+     */
+    for (auto& log_meta : _logs_list) {
+        /*
+         * applying segment.ms will make reclaimable data from the active
+         * segment visible.
+         */
+        co_await log_meta.handle->apply_segment_ms();
+        if (!log_meta.link.is_linked()) {
+            continue;
+        }
+
+        auto ntp = log_meta.handle->config().ntp();
+        auto usage = co_await log_meta.handle->disk_usage(
+          gc_config(lowest_ts_to_retain(), _config.retention_bytes()));
+
+        /*
+         * NOTE: this estimate is for local retention policy only. for a policy
+         * that considers removing data uploaded to the cloud, this estimate is
+         * available in `usage.reclaim.available`.
+         */
+        ntp_by_gc_size.emplace(usage.reclaim.retention, std::move(ntp));
+    }
+
+    /*
+     * Since we don't hold on to a per-log gate after we've recorded it in the
+     * container above, we need to lookup the ntp by name in the official log
+     * registry to avoid problems with concurrent removals since the log
+     * interface does not tolerate ops on closed logs.
+     *
+     * Each gc waits for the prefix truncation of the partition to be
+     * replicated. Collecting the logs one at a time makes space recovery as
+     * slow as the sum of these round trips on a shard with many partitions,
+     * while collecting all of them at once is a burst of raft writes. Logs
+     * are collected a few at a time, largest reclaimable size first.
+     */
+    const auto concurrency = std::max<size_t>(
+      1, config::shard_local_cfg().space_management_max_log_concurrency());
+    co_await ss::max_concurrent_for_each(
+      ntp_by_gc_size, concurrency, [this](const auto& candidate) {
+          auto log = get(candidate.second);
+          if (!log) {
+              return ss::now();
+          }
+          return log
+            ->gc(gc_config(lowest_ts_to_retain(), _config.retention_bytes()))
+            .finally([log] {});
+      });
+}
+
+ss::future<> log_manager::scrub() {
+    // how often to check whether scrubbing got enabled
+    static constexpr auto disabled_poll_interval = 1min;
+    while (!_abort_source.abort_requested()) {
+        try {
+            // a checkpoint means that a pass was interrupted by a restart
+            std::optional<model::ntp> resume_after;
+            auto checkpoint = _kvstore.get(
+              kvstore::key_space::storage, internal::scrub_checkpoint_key());
+            if (checkpoint) {
+                resume_after = serde::from_iobuf<
+                                 internal::scrub_checkpoint_value>(
+                                 std::move(checkpoint.value()))
+                                 .ntp;
+            } else {
+                co_await ss::sleep_abortable<ss::lowres_clock>(
+                  config::shard_local_cfg().storage_scrub_interval_ms().value_or(
+                    disabled_poll_interval),
+                  _abort_source);
+            }
+            if (!config::shard_local_cfg().storage_scrub_interval_ms()) {
+                if (resume_after) {
+                    co_await ss::sleep_abortable<ss::lowres_clock>(
+                      disabled_poll_interval, _abort_source);
+                }
+                continue;
+            }
+            co_await scrub_pass(std::move(resume_after));
+        } catch (...) {
+            // shutdown errors may come from a partition shutting down, keep
+            // going until the log manager stops
+            auto e = std::current_exception();
+            if (!ssx::is_shutdown_exception(e)) {
+                vlog(stlog.warn, "Error scrubbing local segments: {}", e);
+            }
+        }
+    }
+}
+
+ss::future<> log_manager::scrub_pass(std::optional<model::ntp> resume_after) {
+    // Logs are scrubbed a few at a time. The read rate is shared by all of
+    // them and reads use the low priority of compaction, so the scrubber
+    // only gets the disk time that appends and consumers leave.
+    static constexpr size_t max_log_concurrency = 4;
+
+    std::vector<model::ntp> ntps;
+    ntps.reserve(_logs.size());
+    for (const auto& [ntp, _] : _logs) {
+        ntps.push_back(ntp);
+    }
+    std::sort(ntps.begin(), ntps.end());
+    auto it = resume_after
+                ? std::upper_bound(ntps.begin(), ntps.end(), *resume_after)
+                : ntps.begin();
+    vlog(
+      stlog.info,
+      "Scrubbing the closed segments of {} logs",
+      std::distance(it, ntps.end()));
+
+    token_bucket<> budget(
+      config::shard_local_cfg().storage_scrub_bytes_per_sec(),
+      "storage::local_scrubber");
+    while (it != ntps.end()) {
+        auto last = std::next(
+          it,
+          std::min<ptrdiff_t>(
+            max_log_concurrency, std::distance(it, ntps.end())));
+        co_await ss::coroutine::parallel_for_each(
+          it, last, [this, &budget](const model::ntp& ntp) {
+              return scrub_log(ntp, budget).handle_exception(
+                [&ntp](const std::exception_ptr& e) {
+                    // e.g. the log was removed while it was scrubbed
+                    vlogl(
+                      stlog,
+                      ssx::is_shutdown_exception(e) ? ss::log_level::debug
+                                                    : ss::log_level::warn,
+                      "[{}] Error scrubbing log: {}",
+                      ntp,
+                      e);
+                });
+          });
+        if (_abort_source.abort_requested()) {
+            co_return;
+        }
+        co_await _kvstore.put(
+          kvstore::key_space::storage,
+          internal::scrub_checkpoint_key(),
+          serde::to_iobuf(
+            internal::scrub_checkpoint_value{.ntp = *std::prev(last)}));
+        it = last;
+    }
+    co_await _kvstore.remove(
+      kvstore::key_space::storage, internal::scrub_checkpoint_key());
+}
+
+ss::future<>
+log_manager::scrub_log(const model::ntp& ntp, token_bucket<>& budget) {
+    auto log = get(ntp);
+    if (!log) {
+        co_return;
+    }
+    // the active segment is still written to, its tail isn't flushed
+    std::vector<ss::lw_shared_ptr<segment>> segments;
+    for (const auto& seg : log->segments()) {
+        if (!seg->has_appender()) {
+            segments.push_back(seg);
+        }
+    }
+    for (auto& seg : segments) {
+        if (_abort_source.abort_requested()) {
+            co_return;
+        }
+        auto result = co_await scrub_segment(
+          seg, _config.compaction_priority, &budget, _abort_source);
+        _scrubbed_bytes += result.bytes;
+        for (const auto& range : result.corrupted) {
+            ++_scrub_corrupted_ranges;
+            vlog(
+              stlog.error,
+              "[{}] Corrupted batches in segment {}: {}",
+              ntp,
+              seg->reader().filename(),
+              range);
+        }
+    }
+}
+
 ss::future<> log_manager::housekeeping() {
     while (!_gate.is_closed()) {
         try {
@@ -358,55 +593,7 @@ ss::future<> log_manager::housekeeping_loop() {
             // it is expected that callers set the flag whenever they want the
             // next round of housekeeping to priortize gc.
             _gc_triggered = false;
-
-            /*
-             * build a schedule of partitions to gc ordered by amount of
-             * estimated reclaimable space. since logs may be asynchronously
-             * deleted doing this safely is tricky.
-             */
-            absl::btree_map<size_t, model::ntp, std::greater<>> ntp_by_gc_size;
-
-            /*
-             * first we build a collection of ntp's as their estimated
-             * reclaimable disk space. the loop and disk_usage() are safe
-             * against concurrent log removals.
-             */
-            for (auto& log_meta : _logs_list) {
-                /*
-                 * applying segment.ms will make reclaimable data from the
-                 * active segment visible.
-                 */
-                co_await log_meta.handle->apply_segment_ms();
-                if (!log_meta.link.is_linked()) {
-                    continue;
-                }
-
-                auto ntp = log_meta.handle->config().ntp();
-                auto usage = co_await log_meta.handle->disk_usage(
-                  gc_config(lowest_ts_to_retain(), _config.retention_bytes()));
-
-                /*
-                 * NOTE: this estimate is for local retention policy only. for a
-                 * policy that considers removing data uploaded to the cloud,
-                 * this estimate is available in `usage.reclaim.available`.
-                 */
-                ntp_by_gc_size.emplace(usage.reclaim.retention, std::move(ntp));
-            }
-
-            /*
-             * Since we don't hold on to a per-log gate after we've recorded it
-             * in the container above, we need to lookup the ntp by name in the
-             * official log registry to avoid problems with concurrent removals
-             * since the log interface does not tolerate ops on closed logs.
-             */
-            for (const auto& candidate : ntp_by_gc_size) {
-                auto log = get(candidate.second);
-                if (!log) {
-                    continue;
-                }
-                co_await log->gc(
-                  gc_config(lowest_ts_to_retain(), _config.retention_bytes()));
-            }
+            co_await gc_by_reclaimable_size();
         }
 
         /*
@@ -457,6 +644,11 @@ ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
 
     auto ntp_sanitizer_cfg = _config.maybe_get_ntp_sanitizer_config(ntp.ntp());
 
+    // a pooled file renamed into place is opened as if it had just been
+    // created
+    co_await _segment_pool.take(
+      segment_full_path(ntp, base_offset, term, version));
+
     co_return co_await make_segment(
       ntp,
       base_offset,
@@ -471,6 +663,22 @@ ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
       std::move(ntp_sanitizer_cfg));
 }
 
+ss::future<ss::lw_shared_ptr<segment>> log_manager::open_log_segment(
+  const ntp_config& ntp,
+  segment_full_path path,
+  size_t read_buf_size,
+  unsigned read_ahead) {
+    auto gate_holder = _gate.hold();
+    co_return co_await open_segment(
+      std::move(path),
+      create_cache(ntp.cache_enabled()),
+      read_buf_size,
+      read_ahead,
+      _resources,
+      _feature_table,
+      _config.maybe_get_ntp_sanitizer_config(ntp.ntp()));
+}
+
 std::optional<batch_cache_index>
 log_manager::create_cache(with_cache ntp_cache_enabled) {
     if (unlikely(
@@ -485,7 +693,8 @@ log_manager::create_cache(with_cache ntp_cache_enabled) {
 ss::future<ss::shared_ptr<log>> log_manager::manage(
   ntp_config cfg,
   raft::group_id group,
-  std::vector<model::record_batch_type> translator_batch_types) {
+  std::vector<model::record_batch_type> translator_batch_types,
+  recovery_priority priority) {
     auto gate = _gate.hold();
     if (!translator_batch_types.empty()) {
         // Sanity check to avoid multiple logs overwriting each others'
@@ -495,7 +704,7 @@ ss::future<ss::shared_ptr<log>> log_manager::manage(
           "When configured to translate offsets, must supply a valid group id");
     }
 
-    auto units = co_await _resources.get_recovery_units();
+    auto units = co_await _resources.get_recovery_units(priority);
     co_return co_await do_manage(
       std::move(cfg), group, std::move(translator_batch_types));
 }
@@ -785,6 +994,7 @@ int64_t log_manager::compaction_backlog() const {
 
 std::ostream& operator<<(std::ostream& o, const log_config& c) {
     o << "{base_dir:" << c.base_dir
+      << ", cold_dir:" << c.cold_dir.value_or("nullopt")
       << ", max_segment.size:" << c.max_segment_size()
       << ", file_sanitize_config:" << c.file_config << ", retention_bytes:";
     if (c.retention_bytes()) {
@@ -16,6 +16,7 @@
 #include "config/property.h"
 #include "container/intrusive_list_helpers.h"
 #include "features/feature_table.h"
+#include "metrics/metrics.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "random/simple_time_jitter.h"
@@ -25,10 +26,12 @@
 #include "storage/log.h"
 #include "storage/log_housekeeping_meta.h"
 #include "storage/ntp_config.h"
+#include "storage/segment_file_pool.h"
 #include "storage/storage_resources.h"
 #include "storage/types.h"
 #include "storage/version.h"
 #include "utils/mutex.h"
+#include "utils/token_bucket.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/circular_buffer.hh>
@@ -114,6 +117,11 @@ struct log_config {
       = std::chrono::seconds(30);
     ss::scheduling_group compaction_sg;
 
+    // Secondary directory that closed segments are demoted to by
+    // housekeeping. Demoted segments stay reachable from base_dir through a
+    // symbolic link, so nothing else needs to know about the cold tier.
+    std::optional<ss::sstring> cold_dir;
+
     // Used for testing. Configuration object for creating
     // sanitizing or erroring file wrappers.
     std::optional<file_sanitize_config> file_config;
@@ -171,10 +179,16 @@ public:
       storage_resources&,
       ss::sharded<features::feature_table>&) noexcept;
 
+    /**
+     * Recovers (or creates) the log. The number of logs recovered
+     * concurrently on a shard is bounded by storage_max_concurrent_replay;
+     * high priority logs are admitted ahead of normal priority ones.
+     */
     ss::future<ss::shared_ptr<log>> manage(
       ntp_config,
       raft::group_id = raft::group_id{},
-      std::vector<model::record_batch_type> translator_batch_types = {});
+      std::vector<model::record_batch_type> translator_batch_types = {},
+      recovery_priority = recovery_priority::normal);
 
     ss::future<> shutdown(model::ntp);
 
@@ -211,11 +225,21 @@ public:
       unsigned read_ahead,
       record_version_type = record_version_type::v1);
 
+    /// Opens an existing, closed segment of the ntp, e.g. one whose files
+    /// were copied from another replica.
+    ss::future<ss::lw_shared_ptr<segment>> open_log_segment(
+      const ntp_config&,
+      segment_full_path,
+      size_t read_buffer_size,
+      unsigned read_ahead);
+
     const log_config& config() const { return _config; }
 
     /// Returns the number of managed logs.
     size_t size() const { return _logs.size(); }
 
+    void setup_metrics();
+
     /// Returns the log for the specified ntp.
     ss::shared_ptr<log> get(const model::ntp& ntp) {
         if (auto it = _logs.find(ntp); it != _logs.end()) {
@@ -235,6 +259,8 @@ public:
 
     storage_resources& resources() { return _resources; }
 
+    segment_file_pool& segment_pool() { return _segment_pool; }
+
     /*
      * Return disk usage information for all logs managed on the current core.
      */
@@ -278,6 +304,17 @@ private:
     ss::future<> async_clear_logs();
 
     ss::future<> housekeeping_scan(model::timestamp);
+    // Applies retention to every log, largest reclaimable size first
+    ss::future<> gc_by_reclaimable_size();
+
+    /**
+     * \brief local scrubbing: periodically reads the closed segments of every
+     *        log and validates the checksums of their batches
+     */
+    ss::future<> scrub();
+    // Scrubs the logs in ntp order, starting after `resume_after` if set
+    ss::future<> scrub_pass(std::optional<model::ntp> resume_after);
+    ss::future<> scrub_log(const model::ntp&, token_bucket<>&);
 
     log_config _config;
     kvstore& _kvstore;
@@ -288,12 +325,16 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
+    segment_file_pool _segment_pool;
 
     // Hash key-map to use across multiple compactions to reuse reserved memory
     // rather than reallocating repeatedly.
-    std::unique_ptr<hash_key_offset_map> _compaction_hash_key_map;
+    std::unique_ptr<bucketed_hash_key_offset_map> _compaction_hash_key_map;
     ss::gate _gate;
     ss::abort_source _abort_source;
+    uint64_t _scrubbed_bytes{0};
+    uint64_t _scrub_corrupted_ranges{0};
+    metrics::internal_metric_groups _metrics;
 
     friend std::ostream& operator<<(std::ostream&, const log_manager&);
 
@@ -243,6 +243,9 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
         _probe.add_bytes_read(cache_read.memory_usage);
         _probe.add_cached_bytes_read(cache_read.memory_usage);
         _probe.add_cached_batches_read(cache_read.batches.size());
+        if (!cache_read.batches.empty()) {
+            _probe.batch_cache_hit();
+        }
         co_return result<records_t>(std::move(cache_read.batches));
     }
 
@@ -256,6 +259,9 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
         co_return result<records_t>(records_t{});
     }
 
+    if (!_config.skip_batch_cache) {
+        _probe.batch_cache_miss();
+    }
     if (!_iterator) {
         _iterator = co_await initialize(timeout, cache_read.next_cached_batch);
     }
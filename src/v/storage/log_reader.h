@@ -183,6 +183,20 @@ public:
      */
     model::offset next_read_lower_bound() const { return _config.start_offset; }
 
+    /**
+     * Indicates if reader can serve a read starting at given offset by skipping
+     * forward over batches of the segment it is currently positioned in. This
+     * lets the readers cache reuse a reader when consumer skipped a few
+     * offsets (e.g. aborted transactional batches) since the previous fetch.
+     */
+    bool can_fast_forward_to(model::offset o) const {
+        if (!is_reusable() || o < _config.start_offset) {
+            return false;
+        }
+        return o
+               <= (*_iterator.current_reader_seg)->offsets().get_dirty_offset();
+    }
+
     /**
      * Base offset of first locked segment in read lock lease
      */
@@ -40,6 +40,11 @@ ss::future<> file::append(iobuf buf) {
     }
 }
 
+ss::future<> file::flush() {
+    vassert(pager_, "file has been closed");
+    return pager_->flush();
+}
+
 ss::future<> file::close() {
     vassert(pager_, "file has been closed");
     auto pager = std::move(pager_);
@@ -47,8 +47,8 @@ public:
     // Appends the given iobuf to the file.
     ss::future<> append(iobuf);
 
-    // TODO(awong): implement.
-    ss::future<> flush() { return ss::make_ready_future(); }
+    // Makes all data appended so far durable.
+    ss::future<> flush();
 
     // Stops remaing IO to the file and closes the handle.
     ss::future<> close();
@@ -187,3 +187,31 @@ TEST_F(ActiveSegmentTest, TestApplySegmentMsEmpty) {
     write_random_batches(log, 1).get();
     ASSERT_EQ(1, log->segment_count());
 }
+
+TEST_F(ActiveSegmentTest, TestFlush) {
+    auto* log = make_log(128_MiB, tristate<std::chrono::milliseconds>{});
+    log->flush().get();
+    write_random_batches(log, 10).get();
+    log->flush().get();
+    ASSERT_EQ(1, log->segment_count());
+}
+
+TEST_F(ActiveSegmentTest, TestPrefixTruncate) {
+    auto* log = make_log(128, tristate<std::chrono::milliseconds>{});
+
+    // One segment per batch.
+    auto batches = write_random_batches(log, 10).get();
+    ASSERT_EQ(10, log->segment_count());
+
+    // Truncating inside a segment keeps it.
+    log->prefix_truncate(batches[3].base_offset()).get();
+    ASSERT_EQ(7, log->segment_count());
+    log->prefix_truncate(batches[3].last_offset()).get();
+    ASSERT_EQ(7, log->segment_count());
+
+    // The active segment is never removed.
+    log->prefix_truncate(model::next_offset(batches.back().last_offset()))
+      .get();
+    ASSERT_EQ(1, log->segment_count());
+    ASSERT_TRUE(log->has_active_segment());
+}
@@ -146,6 +146,30 @@ ss::future<> versioned_log::append(model::record_batch b) {
     active_seg_->next_offset = next;
 }
 
+ss::future<> versioned_log::flush() {
+    auto lock = co_await active_segment_lock_.get_units();
+    // Rolled segments are flushed when they are rolled.
+    if (has_active_segment()) {
+        co_await active_seg_->segment_file->flush();
+    }
+}
+
+ss::future<> versioned_log::prefix_truncate(model::offset new_start) {
+    auto lock = co_await active_segment_lock_.get_units();
+    while (!segs_.empty() && segs_.front()->offsets.max() < new_start) {
+        auto seg = std::move(segs_.front());
+        segs_.pop_front();
+        const auto path = seg->segment_file->filepath();
+        vlog(
+          log.debug,
+          "Removing segment file {} below new start offset {}",
+          path.c_str(),
+          new_start);
+        co_await seg->segment_file->close();
+        co_await file_mgr_.remove_file(path);
+    }
+}
+
 size_t versioned_log::segment_count() const {
     return segs_.size() + (active_seg_ ? 1 : 0);
 }
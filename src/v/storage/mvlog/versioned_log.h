@@ -84,9 +84,17 @@ public:
     // doesn't exist or if past the configured segment size. Upon returning,
     // the record batch will be visible to new readers, though may not be
     // persisted to disk.
-    // TODO(awong): implement flushing.
     ss::future<> append(model::record_batch);
 
+    // Makes all appended record batches durable.
+    ss::future<> flush();
+
+    // Removes the readonly segments whose records are all below the given
+    // offset. Truncation is at segment granularity: records below the offset
+    // that share a segment with later records, or that are in the active
+    // segment, are kept.
+    ss::future<> prefix_truncate(model::offset new_start);
+
     // Checks whether the segment rolling deadline has passed for the active
     // segment, e.g. as specified by the segment.ms property. If so, rolls the
     // segment, leaving the log without an active segment.
@@ -103,6 +103,7 @@ ss::future<result<offset_to_file_pos_result>> convert_begin_offset_to_file_pos(
   model::timestamp base_timestamp,
   ss::io_priority_class io_priority,
   should_fail_on_missing_offset fail_on_missing_offset) {
+    co_await segment->index().ensure_materialized();
     auto ix_begin = segment->index().find_nearest(begin_inclusive);
     size_t scan_from = ix_begin ? ix_begin->filepos : 0;
     model::offset sto = ix_begin ? ix_begin->offset
@@ -185,6 +186,7 @@ ss::future<result<offset_to_file_pos_result>> convert_end_offset_to_file_pos(
     // of the segment.
     // Lookup the index, if the index is available and some value is found
     // use it as a starting point otherwise, start from the beginning.
+    co_await segment->index().ensure_materialized();
     auto ix_end = segment->index().find_nearest(end_inclusive);
     size_t fsize = segment->reader().file_size();
 
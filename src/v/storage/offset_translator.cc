@@ -12,10 +12,13 @@
 #include "storage/offset_translator.h"
 
 #include "base/vlog.h"
+#include "model/record_batch_types.h"
 #include "reflection/adl.h"
 #include "storage/api.h"
 #include "storage/kvstore.h"
 #include "storage/logger.h"
+#include "storage/segment.h"
+#include "storage/segment_set.h"
 #include "storage/storage_resources.h"
 
 #include <seastar/core/coroutine.hh>
@@ -190,6 +193,8 @@ ss::future<> offset_translator::sync_with_log(
         co_await _checkpoint_lock.with([this] { return do_checkpoint(); });
     }
 
+    sync_with_segment_indices(log.segments());
+
     // Read the log to insert the remaining entries into map.
     model::offset start_offset = model::next_offset(_highest_known_offset);
 
@@ -238,6 +243,45 @@ ss::future<> offset_translator::sync_with_log(
     co_await maybe_checkpoint();
 }
 
+void offset_translator::sync_with_segment_indices(const segment_set& segs) {
+    // the indices only know about the default set of skipped batch types
+    if (_filtered_types != model::offset_translator_batch_types()) {
+        return;
+    }
+
+    const auto initial_highest_known_offset = _highest_known_offset;
+    for (const auto& seg : segs) {
+        const auto& index = seg->index();
+        if (index.max_offset() <= _highest_known_offset) {
+            continue;
+        }
+        // stop at the first segment the index can't vouch for, the rest is
+        // read from the log
+        if (
+          !index.translator_gaps().has_value()
+          || index.base_offset() > model::next_offset(_highest_known_offset)
+          || index.max_offset() != seg->offsets().get_dirty_offset()) {
+            break;
+        }
+        for (const auto& gap : index.translator_gaps().value()) {
+            if (gap.base_offset > _highest_known_offset) {
+                _state->add_gap(gap.base_offset, gap.last_offset);
+                ++_map_version;
+            }
+        }
+        _highest_known_offset = index.max_offset();
+    }
+
+    if (_highest_known_offset != initial_highest_known_offset) {
+        vlog(
+          _logger.debug,
+          "synced with segment indices from {} to {}, state: {}",
+          initial_highest_known_offset,
+          _highest_known_offset,
+          _state);
+    }
+}
+
 ss::future<> offset_translator::truncate(model::offset offset) {
     if (_filtered_types.empty()) {
         co_return;
@@ -127,6 +127,10 @@ public:
 private:
     ss::future<> do_checkpoint();
 
+    /// Catches up with the log using the translator gaps recorded in the
+    /// segment indices, for as long as they are available.
+    void sync_with_segment_indices(const segment_set&);
+
 private:
     std::vector<model::record_batch_type> _filtered_types;
     ss::lw_shared_ptr<storage::offset_translator_state> _state;
@@ -31,6 +31,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <array>
 #include <exception>
 
 namespace storage {
@@ -138,15 +139,21 @@ static ss::future<result<model::record_batch_header>> read_header_impl(
         }
         co_return parser_errc::input_stream_not_enough_bytes;
     }
-    // check if iobuf is filled is zeros, this means that we are reading
+    // linearize once so that the zero check, the field decoding and the
+    // header crc all operate on the same contiguous bytes
+    std::array<char, model::packed_record_batch_header_size> raw;
+    iobuf::iterator_consumer in(b.cbegin(), b.cend());
+    in.consume_to(raw.size(), raw.data());
+
+    // check if the header is filled with zeros, this means that we are reading
     // fallocated range filled with zeros
-    if (unlikely(storage::internal::is_zero(b))) {
+    if (unlikely(storage::internal::is_zero(raw.data(), raw.size()))) {
         // happens when we fallocate the file
         co_return parser_errc::fallocated_file_read_zero_bytes_for_header;
     }
-    auto header = batch_header_from_disk_iobuf(std::move(b));
+    auto header = batch_header_from_disk_bytes(raw.data());
 
-    if (auto computed_crc = model::internal_header_only_crc(header);
+    if (auto computed_crc = header_only_crc_from_disk_bytes(raw.data());
         unlikely(header.header_crc != computed_crc)) {
         if (!recovery) {
             vlog(
@@ -109,6 +109,17 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _cached_batches_read; },
           sm::description("Total number of cached batches read"),
           labels),
+        sm::make_counter(
+          "batch_cache_hits",
+          [this] { return _batch_cache_hits; },
+          sm::description("Number of reads served from the batch cache"),
+          labels),
+        sm::make_counter(
+          "batch_cache_misses",
+          [this] { return _batch_cache_misses; },
+          sm::description(
+            "Number of reads that missed the batch cache and went to disk"),
+          labels),
         sm::make_counter(
           "log_segments_created",
           [this] { return _log_segments_created; },
@@ -218,7 +229,13 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
         sm::make_counter(
           "cache_hits",
           [this] { return _cache_hits; },
-          sm::description("Reader cache hits"),
+          sm::description("Reader cache hits with exactly matching offset"),
+          labels),
+        sm::make_counter(
+          "cache_range_hits",
+          [this] { return _cache_range_hits; },
+          sm::description(
+            "Reader cache hits served by fast forwarding a cached reader"),
           labels),
         sm::make_counter(
           "cache_misses",
@@ -99,6 +99,8 @@ public:
     void add_cached_batches_read(uint32_t batches) {
         _cached_batches_read += batches;
     }
+    void batch_cache_hit() { ++_batch_cache_hits; }
+    void batch_cache_miss() { ++_batch_cache_misses; }
 
     void batch_parse_error() { ++_batch_parse_errors; }
 
@@ -131,6 +133,8 @@ private:
     uint64_t _batches_written = 0;
     uint64_t _batches_read = 0;
     uint64_t _cached_batches_read = 0;
+    uint64_t _batch_cache_hits = 0;
+    uint64_t _batch_cache_misses = 0;
 
     uint32_t _segment_compacted = 0;
     uint32_t _corrupted_compaction_index = 0;
@@ -112,26 +112,37 @@ readers_cache::get_reader(const log_reader_config& cfg) {
     vlog(stlog.trace, "{} - trying to get reader for: {}", _ntp, cfg);
     uncounted_intrusive_list<entry, &entry::_hook> to_evict;
     /**
-     * We use linear search since _readers intrusive list is small.
+     * We use linear search since _readers intrusive list is small. An exact
+     * offset match is preferred, otherwise we fall back to the closest reader
+     * that can fast forward to the requested offset within its current segment.
      */
     auto it = _readers.begin();
+    auto range_match = _readers.end();
     while (it != _readers.end()) {
         const auto is_valid = it->reader->is_reusable() && it->valid;
-        // TODO: think about relaxing this equality condition
-        const auto offset_matches = it->reader->next_read_lower_bound()
-                                    == cfg.start_offset;
         // if invalid we will dispose this entry in background
         if (!is_valid) {
             it = _readers.erase_and_dispose(
               it, [&to_evict](entry* e) { to_evict.push_back(*e); });
             continue;
         }
-        if (offset_matches && is_valid) {
+        if (it->reader->next_read_lower_bound() == cfg.start_offset) {
             // found matching reader
             break;
         }
+        if (
+          it->reader->can_fast_forward_to(cfg.start_offset)
+          && (range_match == _readers.end()
+              || range_match->reader->next_read_lower_bound()
+                   < it->reader->next_read_lower_bound())) {
+            range_match = it;
+        }
         ++it;
     }
+    const bool exact_match = it != _readers.end();
+    if (!exact_match) {
+        it = range_match;
+    }
     /**
      * dispose unused readers in background
      */
@@ -142,9 +153,19 @@ readers_cache::get_reader(const log_reader_config& cfg) {
         return std::nullopt;
     }
     auto& e = *it;
-    vlog(stlog.trace, "{} - reader cache hit for: {}", _ntp, cfg);
-    it->reader->reset_config(cfg);
-    _probe.cache_hit();
+    vlog(
+      stlog.trace,
+      "{} - reader cache {} hit for: {}, reader lower bound: {}",
+      _ntp,
+      exact_match ? "exact" : "range",
+      cfg,
+      e.reader->next_read_lower_bound());
+    e.reader->reset_config(cfg);
+    if (exact_match) {
+        _probe.cache_hit();
+    } else {
+        _probe.cache_range_hit();
+    }
 
     // we use cached_reader wrapper to track reader usage, when cached_reader is
     // destroyed we unlock reader and trigger eviction
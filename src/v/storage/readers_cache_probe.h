@@ -14,6 +14,7 @@ public:
     void reader_added() { _readers_added++; }
     void reader_evicted() { _readers_evicted++; }
     void cache_hit() { _cache_hits++; }
+    void cache_range_hit() { _cache_range_hits++; }
     void cache_miss() { _cache_misses++; }
     void clear() { _metrics.clear(); }
 
@@ -24,6 +25,7 @@ private:
     uint64_t _readers_evicted{0};
     uint64_t _cache_misses{0};
     uint64_t _cache_hits{0};
+    uint64_t _cache_range_hits{0};
 
     metrics::internal_metric_groups _metrics;
 };
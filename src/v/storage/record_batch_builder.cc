@@ -15,8 +15,12 @@
 #include "model/timeout_clock.h"
 #include "storage/parser_utils.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/smp.hh>
 
+#include <array>
+#include <cstring>
+
 namespace storage {
 
 record_batch_builder::record_batch_builder(
@@ -31,28 +35,72 @@ record_batch_builder& record_batch_builder::add_raw_kv(
     return add_raw_kw(std::move(key), std::move(value), {});
 }
 
+namespace {
+/// Size of a key or a value as encoded in a record, -1 for null
+int32_t encoded_size(const std::optional<iobuf>& b) {
+    return b ? static_cast<int32_t>(b->size_bytes()) : -1;
+}
+
+void append_copy(iobuf& out, const iobuf& in) {
+    for (const auto& f : in) {
+        out.append(f.get(), f.size());
+    }
+}
+} // namespace
+
+/*
+ * Records are serialized straight into the records buffer, without building
+ * a model::record first. The size of the record is known upfront, so the
+ * space for the whole record is reserved at once, and the fields between the
+ * variable length ones are encoded on the stack and appended together rather
+ * than with one append per varint.
+ */
 record_batch_builder& record_batch_builder::add_raw_kw(
   std::optional<iobuf>&& key,
   std::optional<iobuf>&& value,
   std::vector<model::record_header> headers) {
-    auto sr = serialized_record{
-      std::move(key), std::move(value), std::move(headers)};
-    auto rec_sz = record_size(_offset_delta, sr);
-    auto kz = sr.encoded_key_size;
-    auto vz = sr.encoded_value_size;
-    auto r = model::record(
-      rec_sz,
-      model::record_attributes{},
-      0,
-      _offset_delta,
-      kz,
-      std::move(sr.key),
-      vz,
-      std::move(sr.value),
-      std::move(sr.headers));
-    ++_offset_delta;
-    model::append_record_to_buffer(_records, r);
+    const auto key_size = encoded_size(key);
+    const auto value_size = encoded_size(value);
+    const auto size = record_size(_offset_delta, key_size, value_size, headers);
+
+    // size, attributes, timestamp delta, offset delta and key size
+    std::array<uint8_t, (4 * vint::max_length) + 1> prefix{};
+    auto* out = prefix.data();
+    out += vint::serialize(size, out);
+    const auto attrs = ss::cpu_to_be(model::record_attributes{}.value());
+    std::memcpy(out, &attrs, sizeof(attrs));
+    out += sizeof(attrs);
+    out += vint::serialize(0, out);
+    out += vint::serialize(_offset_delta, out);
+    out += vint::serialize(key_size, out);
+
+    const auto prefix_size = static_cast<size_t>(out - prefix.data());
+    _records.reserve_memory(vint::vint_size(size) + size);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _records.append(reinterpret_cast<const char*>(prefix.data()), prefix_size);
+    if (key) {
+        append_copy(_records, *key);
+    }
 
+    std::array<uint8_t, vint::max_length> vint_buf{};
+    auto append_vint = [this, &vint_buf](int64_t v) {
+        const auto len = vint::serialize(v, vint_buf.data());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _records.append(reinterpret_cast<const char*>(vint_buf.data()), len);
+    };
+    append_vint(value_size);
+    if (value) {
+        append_copy(_records, *value);
+    }
+    append_vint(static_cast<int64_t>(headers.size()));
+    for (const auto& h : headers) {
+        append_vint(h.key_size());
+        append_copy(_records, h.key());
+        append_vint(h.value_size());
+        append_copy(_records, h.value());
+    }
+
+    ++_offset_delta;
     return *this;
 }
 
@@ -119,16 +167,19 @@ model::record_batch_header record_batch_builder::build_header() const {
 }
 
 uint32_t record_batch_builder::record_size(
-  int32_t offset_delta, const serialized_record& r) {
-    uint32_t size = sizeof(model::record_attributes::type)  // attributes
-                    + zero_vint_size                        // timestamp delta
-                    + vint::vint_size(offset_delta)         // offset_delta
-                    + vint::vint_size(r.encoded_key_size)   // key size
-                    + r.key.size_bytes()                    // key
-                    + vint::vint_size(r.encoded_value_size) // value size
-                    + r.value.size_bytes()                  // value
-                    + vint::vint_size(r.headers.size());    // headers size
-    for (const auto& h : r.headers) {
+  int32_t offset_delta,
+  int32_t key_size,
+  int32_t value_size,
+  const std::vector<model::record_header>& headers) {
+    uint32_t size = sizeof(model::record_attributes::type) // attributes
+                    + zero_vint_size                       // timestamp delta
+                    + vint::vint_size(offset_delta)        // offset_delta
+                    + vint::vint_size(key_size)            // key size
+                    + std::max(key_size, 0)                // key
+                    + vint::vint_size(value_size)          // value size
+                    + std::max(value_size, 0)              // value
+                    + vint::vint_size(headers.size());     // headers size
+    for (const auto& h : headers) {
         size += vint::vint_size(h.key_size()) + h.key().size_bytes()
                 + vint::vint_size(h.value_size()) + h.value().size_bytes();
     }
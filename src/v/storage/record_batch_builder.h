@@ -54,36 +54,13 @@ public:
 
 private:
     static constexpr int64_t zero_vint_size = vint::vint_size(0);
-    struct serialized_record {
-        serialized_record(
-          std::optional<iobuf> k,
-          std::optional<iobuf> v,
-          std::vector<model::record_header> hdrs
-          = std::vector<model::record_header>())
-          : headers(std::move(hdrs)) {
-            if (k) {
-                key = std::move(*k);
-                encoded_key_size = key.size_bytes();
-            } else {
-                encoded_key_size = -1;
-            }
-            if (likely(v)) {
-                value = std::move(*v);
-                encoded_value_size = value.size_bytes();
-            } else {
-                encoded_value_size = -1;
-            }
-        }
-
-        iobuf key;
-        int32_t encoded_key_size;
-        iobuf value;
-        int32_t encoded_value_size;
-        std::vector<model::record_header> headers;
-    };
 
     model::record_batch_header build_header() const;
-    uint32_t record_size(int32_t offset_delta, const serialized_record& r);
+    static uint32_t record_size(
+      int32_t offset_delta,
+      int32_t key_size,
+      int32_t value_size,
+      const std::vector<model::record_header>&);
 
     model::record_batch_type _batch_type;
     model::offset _base_offset;
@@ -9,9 +9,14 @@
 
 #include "storage/record_batch_utils.h"
 
+#include "hashing/crc32c.h"
 #include "model/record.h"
 #include "reflection/adl.h"
 
+#include <seastar/core/byteorder.hh>
+
+#include <array>
+
 namespace storage {
 
 iobuf batch_header_to_disk_iobuf(const model::record_batch_header& h) {
@@ -39,46 +44,79 @@ iobuf batch_header_to_disk_iobuf(const model::record_batch_header& h) {
     return b;
 }
 
-model::record_batch_header batch_header_from_disk_iobuf(iobuf b) {
-    iobuf_parser parser(std::move(b));
-    auto header_crc = reflection::adl<uint32_t>{}.from(parser);
-    auto sz = reflection::adl<int32_t>{}.from(parser);
-    using offset_t = model::offset::type;
-    auto off = model::offset(reflection::adl<offset_t>{}.from(parser));
-    auto type = reflection::adl<model::record_batch_type>{}.from(parser);
-    auto crc = reflection::adl<int32_t>{}.from(parser);
+namespace {
+
+// Field offsets within the packed on-disk header.
+constexpr size_t header_crc_offset = 0;
+constexpr size_t size_bytes_offset = 4;
+constexpr size_t base_offset_offset = 8;
+constexpr size_t type_offset = 16;
+constexpr size_t crc_offset = 17;
+constexpr size_t attrs_offset = 21;
+constexpr size_t last_offset_delta_offset = 23;
+constexpr size_t first_timestamp_offset = 27;
+constexpr size_t max_timestamp_offset = 35;
+constexpr size_t producer_id_offset = 43;
+constexpr size_t producer_epoch_offset = 51;
+constexpr size_t base_sequence_offset = 53;
+constexpr size_t record_count_offset = 57;
+static_assert(
+  record_count_offset + sizeof(int32_t)
+  == model::packed_record_batch_header_size);
+
+template<typename T>
+T load(const char* data, size_t offset) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return ss::read_le<T>(data + offset);
+}
+
+} // namespace
+
+model::record_batch_header batch_header_from_disk_bytes(const char* data) {
+    using type_t = std::underlying_type_t<model::record_batch_type>;
     using attr_t = model::record_batch_attributes::type;
-    auto attrs = model::record_batch_attributes(
-      reflection::adl<attr_t>{}.from(parser));
-    auto delta = reflection::adl<int32_t>{}.from(parser);
     using tmstmp_t = model::timestamp::type;
-    auto first = model::timestamp(reflection::adl<tmstmp_t>{}.from(parser));
-    auto max = model::timestamp(reflection::adl<tmstmp_t>{}.from(parser));
-    auto producer_id = reflection::adl<int64_t>{}.from(parser);
-    auto producer_epoch = reflection::adl<int16_t>{}.from(parser);
-    auto base_sequence = reflection::adl<int32_t>{}.from(parser);
-    auto record_count = reflection::adl<int32_t>{}.from(parser);
-    vassert(
-      parser.bytes_consumed() == model::packed_record_batch_header_size,
-      "Error in header parsing. Must consume:{} bytes, but consumed:{}",
-      model::packed_record_batch_header_size,
-      parser.bytes_consumed());
     auto hdr = model::record_batch_header{
-      .header_crc = header_crc,
-      .size_bytes = sz,
-      .base_offset = off,
-      .type = type,
-      .crc = crc,
-      .attrs = attrs,
-      .last_offset_delta = delta,
-      .first_timestamp = first,
-      .max_timestamp = max,
-      .producer_id = producer_id,
-      .producer_epoch = producer_epoch,
-      .base_sequence = base_sequence,
-      .record_count = record_count};
+      .header_crc = load<uint32_t>(data, header_crc_offset),
+      .size_bytes = load<int32_t>(data, size_bytes_offset),
+      .base_offset = model::offset(
+        load<model::offset::type>(data, base_offset_offset)),
+      .type = model::record_batch_type(load<type_t>(data, type_offset)),
+      .crc = load<int32_t>(data, crc_offset),
+      .attrs = model::record_batch_attributes(
+        load<attr_t>(data, attrs_offset)),
+      .last_offset_delta = load<int32_t>(data, last_offset_delta_offset),
+      .first_timestamp = model::timestamp(
+        load<tmstmp_t>(data, first_timestamp_offset)),
+      .max_timestamp = model::timestamp(
+        load<tmstmp_t>(data, max_timestamp_offset)),
+      .producer_id = load<int64_t>(data, producer_id_offset),
+      .producer_epoch = load<int16_t>(data, producer_epoch_offset),
+      .base_sequence = load<int32_t>(data, base_sequence_offset),
+      .record_count = load<int32_t>(data, record_count_offset)};
     hdr.ctx.owner_shard = ss::this_shard_id();
     return hdr;
 }
 
+uint32_t header_only_crc_from_disk_bytes(const char* data) {
+    crc::crc32c c;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    c.extend(
+      data + size_bytes_offset,
+      model::packed_record_batch_header_size - size_bytes_offset);
+    return c.value();
+}
+
+model::record_batch_header batch_header_from_disk_iobuf(iobuf b) {
+    vassert(
+      b.size_bytes() == model::packed_record_batch_header_size,
+      "Error in header parsing. Must consume:{} bytes, but got:{}",
+      model::packed_record_batch_header_size,
+      b.size_bytes());
+    std::array<char, model::packed_record_batch_header_size> buf;
+    iobuf::iterator_consumer in(b.cbegin(), b.cend());
+    in.consume_to(buf.size(), buf.data());
+    return batch_header_from_disk_bytes(buf.data());
+}
+
 } // namespace storage
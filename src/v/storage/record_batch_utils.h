@@ -22,4 +22,13 @@ namespace storage {
 iobuf batch_header_to_disk_iobuf(const model::record_batch_header& h);
 model::record_batch_header batch_header_from_disk_iobuf(iobuf b);
 
+// Decodes a header from exactly model::packed_record_batch_header_size
+// contiguous bytes in the on-disk layout using fixed-offset loads.
+model::record_batch_header batch_header_from_disk_bytes(const char* data);
+
+// Computes the header-only crc directly over the on-disk bytes. Equivalent to
+// model::internal_header_only_crc() of the decoded header, since the on-disk
+// layout is the little-endian concatenation of the covered fields.
+uint32_t header_only_crc_from_disk_bytes(const char* data);
+
 } // namespace storage
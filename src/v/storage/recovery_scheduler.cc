@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/recovery_scheduler.h"
+
+#include "base/vassert.h"
+
+#include <seastar/core/semaphore.hh>
+
+#include <algorithm>
+
+namespace storage {
+
+void recovery_scheduler::permit::release() noexcept {
+    if (auto s = std::exchange(_s, nullptr); s != nullptr) {
+        s->release();
+    }
+}
+
+recovery_scheduler::recovery_scheduler(size_t capacity) noexcept
+  : _capacity(std::max(capacity, size_t{1})) {}
+
+recovery_scheduler::~recovery_scheduler() noexcept {
+    vassert(_active == 0, "{} recoveries still hold a permit", _active);
+    for (auto& waiters : _waiters) {
+        for (auto& w : waiters) {
+            w.set_exception(ss::broken_semaphore());
+        }
+    }
+}
+
+ss::future<recovery_scheduler::permit>
+recovery_scheduler::admit(recovery_priority p) {
+    auto& waiters = _waiters.at(static_cast<size_t>(p));
+    // don't overtake anyone already waiting at this or a higher priority
+    bool queued_ahead = false;
+    for (size_t i = 0; i <= static_cast<size_t>(p); ++i) {
+        queued_ahead |= !_waiters.at(i).empty();
+    }
+    if (_active < _capacity && !queued_ahead) {
+        ++_active;
+        return ss::make_ready_future<permit>(permit(this));
+    }
+    auto& w = waiters.emplace_back();
+    return w.get_future();
+}
+
+void recovery_scheduler::set_capacity(size_t capacity) noexcept {
+    _capacity = std::max(capacity, size_t{1});
+    admit_waiters();
+}
+
+recovery_progress recovery_scheduler::progress() const noexcept {
+    return {
+      .pending_high
+      = _waiters.at(static_cast<size_t>(recovery_priority::high)).size(),
+      .pending_normal
+      = _waiters.at(static_cast<size_t>(recovery_priority::normal)).size(),
+      .active = _active,
+      .completed = _completed,
+    };
+}
+
+void recovery_scheduler::release() noexcept {
+    --_active;
+    ++_completed;
+    admit_waiters();
+}
+
+void recovery_scheduler::admit_waiters() noexcept {
+    for (auto& waiters : _waiters) {
+        while (_active < _capacity && !waiters.empty()) {
+            ++_active;
+            waiters.front().set_value(permit(this));
+            waiters.pop_front();
+        }
+    }
+}
+
+} // namespace storage
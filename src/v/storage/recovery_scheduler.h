@@ -0,0 +1,108 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+
+#include <seastar/core/future.hh>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+namespace storage {
+
+/// Order in which logs waiting to be recovered are admitted.
+enum class recovery_priority : int8_t {
+    // e.g. partitions this node was (or was becoming) the leader of
+    high = 0,
+    normal = 1,
+};
+
+/// Snapshot of the state of log recovery on a shard.
+struct recovery_progress {
+    size_t pending_high{0};
+    size_t pending_normal{0};
+    size_t active{0};
+    size_t completed{0};
+
+    recovery_progress& operator+=(const recovery_progress& o) {
+        pending_high += o.pending_high;
+        pending_normal += o.pending_normal;
+        active += o.active;
+        completed += o.completed;
+        return *this;
+    }
+};
+
+/**
+ * Admission control for log recovery (log_manager::manage).
+ *
+ * At most `capacity` logs are recovered concurrently. Waiters are admitted in
+ * FIFO order within a priority, and all high priority waiters are admitted
+ * before any normal priority ones, so that a partition that is needed soon
+ * does not queue behind thousands of cold ones after an unclean restart.
+ */
+class recovery_scheduler {
+public:
+    /// Holds a recovery slot, released on destruction.
+    class permit {
+    public:
+        permit() = default;
+        explicit permit(recovery_scheduler* s) noexcept
+          : _s(s) {}
+        permit(const permit&) = delete;
+        permit& operator=(const permit&) = delete;
+        permit(permit&& o) noexcept
+          : _s(std::exchange(o._s, nullptr)) {}
+        permit& operator=(permit&& o) noexcept {
+            if (this != &o) {
+                release();
+                _s = std::exchange(o._s, nullptr);
+            }
+            return *this;
+        }
+        ~permit() noexcept { release(); }
+
+    private:
+        void release() noexcept;
+
+        recovery_scheduler* _s{nullptr};
+    };
+
+    explicit recovery_scheduler(size_t capacity) noexcept;
+    recovery_scheduler(const recovery_scheduler&) = delete;
+    recovery_scheduler& operator=(const recovery_scheduler&) = delete;
+    recovery_scheduler(recovery_scheduler&&) = delete;
+    recovery_scheduler& operator=(recovery_scheduler&&) = delete;
+    ~recovery_scheduler() noexcept;
+
+    ss::future<permit> admit(recovery_priority);
+
+    void set_capacity(size_t capacity) noexcept;
+
+    recovery_progress progress() const noexcept;
+
+private:
+    void release() noexcept;
+    void admit_waiters() noexcept;
+
+    size_t _capacity;
+    size_t _active{0};
+    size_t _completed{0};
+    // indexed by recovery_priority
+    std::array<std::deque<ss::promise<permit>>, 2> _waiters;
+};
+
+} // namespace storage
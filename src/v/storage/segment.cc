@@ -41,6 +41,7 @@
 #include <optional>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace storage {
 
@@ -65,6 +66,8 @@ segment::segment(
   , _first_write(std::nullopt) {
     if (_appender) {
         _appender->set_callbacks(&_appender_callbacks);
+    } else {
+        _idx.attach_budget(_resources.segment_index_budget());
     }
 }
 
@@ -198,11 +201,24 @@ ss::future<size_t> segment::remove_persistent_state() {
      * isn't compactible, because compaction can be enabled or disabled at
      * runtime. if the index doesn't exist, it's silently ignored.
      */
-    const auto rm = std::to_array<std::filesystem::path>({
+    auto rm = std::vector<std::filesystem::path>{
       reader().path(),
       index().path(),
       reader().path().to_compacted_index(),
-    });
+    };
+
+    /*
+     * the data file of a demoted segment is a link into the cold data
+     * directory, and the file it points to has to be removed too.
+     */
+    try {
+        if (auto cold = co_await internal::cold_segment_target(reader().path());
+            cold.has_value()) {
+            rm.push_back(std::move(*cold));
+        }
+    } catch (const std::exception& e) {
+        vlog(stlog.info, "error resolving {}: {}", reader().path(), e);
+    }
 
     co_return co_await ss::map_reduce(
       rm,
@@ -240,6 +256,8 @@ ss::future<> segment::do_release_appender(
           return appender->close()
             .then([this] { return _idx.flush(); })
             .then([this, &compacted_index] {
+                // no more appends, the index may now be evicted
+                _idx.attach_budget(_resources.segment_index_budget());
                 if (compacted_index) {
                     return compacted_index->close();
                 }
@@ -462,12 +480,12 @@ void segment::cache_truncate(model::offset offset) {
 ss::future<> segment::do_compaction_index_batch(const model::record_batch& b) {
     vassert(!b.compressed(), "wrong method. Call compact_index_batch. {}", b);
     auto& w = compaction_index();
-    return model::for_each_record(
+    return model::for_each_record_view(
       b,
       [o = b.base_offset(),
        batch_type = b.header().type,
        is_control_batch = b.header().attrs.is_control(),
-       &w](const model::record& r) {
+       &w](const model::record_view& r) {
           return w.index(
             batch_type, is_control_batch, r.key(), o, r.offset_delta());
       });
@@ -642,17 +660,19 @@ ss::future<append_result> segment::append(model::record_batch&& b) {
 ss::future<segment_reader_handle>
 segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     check_segment_not_closed("offset_data_stream()");
-    auto nearest = _idx.find_nearest(o);
-    size_t position = 0;
-    if (nearest) {
-        position = nearest->filepos;
-    }
+    return _idx.find_nearest_paged(o).then(
+      [this, iopc](std::optional<segment_index::entry> nearest) {
+          size_t position = 0;
+          if (nearest) {
+              position = nearest->filepos;
+          }
 
-    // This could be a corruption (bad index) or a runtime defect (bad file
-    // size) (https://github.com/redpanda-data/redpanda/issues/2101)
-    vassert(position < size_bytes(), "Index points beyond file size");
+          // This could be a corruption (bad index) or a runtime defect (bad
+          // file size) (https://github.com/redpanda-data/redpanda/issues/2101)
+          vassert(position < size_bytes(), "Index points beyond file size");
 
-    return _reader->data_stream(position, iopc);
+          return _reader->data_stream(position, iopc);
+      });
 }
 
 void segment::advance_stable_offset(size_t filepos) {
@@ -705,6 +725,7 @@ std::ostream& operator<<(std::ostream& o, const segment& h) {
       << ", compacted_segment=" << h.is_compacted_segment()
       << ", finished_self_compaction=" << h.finished_self_compaction()
       << ", finished_windowed_compaction=" << h.finished_windowed_compaction()
+      << ", demoted=" << h.is_demoted()
       << ", generation=" << h.get_generation_id() << ", reader=";
     if (h._reader) {
         o << *h._reader;
@@ -770,7 +791,7 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
     }
 
     auto rdr = std::make_unique<segment_reader>(
-      path, buf_size, read_ahead, ntp_sanitizer_config);
+      path, buf_size, read_ahead, ntp_sanitizer_config, &resources);
     co_await rdr->load_size();
 
     auto idx = segment_index(
@@ -118,6 +118,7 @@ public:
         mark_tombstone = 1U << 2U,
         closed = 1U << 3U,
         finished_windowed_compaction = 1U << 4U,
+        demoted = 1U << 5U,
     };
 
 public:
@@ -191,6 +192,9 @@ public:
     bool finished_self_compaction() const;
     void mark_as_finished_windowed_compaction();
     bool finished_windowed_compaction() const;
+    /// \brief the data file is known to live in the cold data directory
+    void mark_as_demoted();
+    bool is_demoted() const;
     /// \brief used for compaction, to reset the tracker from index
     void force_set_commit_offset_from_index();
 
@@ -464,6 +468,10 @@ inline bool segment::finished_windowed_compaction() const {
     return (_flags & bitflags::finished_windowed_compaction)
            == bitflags::finished_windowed_compaction;
 }
+inline void segment::mark_as_demoted() { _flags |= bitflags::demoted; }
+inline bool segment::is_demoted() const {
+    return (_flags & bitflags::demoted) == bitflags::demoted;
+}
 inline std::optional<std::reference_wrapper<batch_cache_index>>
 segment::cache() {
     using ret_t = std::optional<std::reference_wrapper<batch_cache_index>>;
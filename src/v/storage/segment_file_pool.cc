@@ -0,0 +1,144 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/segment_file_pool.h"
+
+#include "base/vlog.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+#include "storage/segment_utils.h"
+#include "storage/storage_resources.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/core/with_scheduling_group.hh>
+#include <seastar/util/file.hh>
+
+#include <fmt/format.h>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace storage {
+
+segment_file_pool::segment_file_pool(
+  const std::filesystem::path& base_dir,
+  config::binding<size_t> pool_size,
+  storage_resources& resources,
+  ss::scheduling_group sg) noexcept
+  : _dir(base_dir / directory_name / fmt::format("{}", ss::this_shard_id()))
+  , _pool_size(std::move(pool_size))
+  , _resources(resources)
+  , _sg(sg) {
+    _pool_size.watch([this] { _refill_cv.signal(); });
+}
+
+ss::future<> segment_file_pool::start() {
+    // files left over from a previous run are not tracked, start afresh
+    if (co_await ss::file_exists(_dir.string())) {
+        co_await ss::recursive_remove_directory(_dir);
+    }
+    ssx::spawn_with_gate(_gate, [this] {
+        return ss::with_scheduling_group(_sg, [this] { return refill(); });
+    });
+}
+
+ss::future<> segment_file_pool::stop() {
+    _as.request_abort();
+    _refill_cv.broken();
+    co_await _gate.close();
+    // pooled files are removed on next start
+    _ready.clear();
+}
+
+ss::future<bool> segment_file_pool::take(const std::filesystem::path& path) {
+    if (_ready.empty() || _gate.is_closed()) {
+        co_return false;
+    }
+    auto holder = _gate.hold();
+    auto src = std::move(_ready.front());
+    _ready.pop_front();
+    _refill_cv.signal();
+
+    // never replace an existing file, e.g. a segment that is being recovered
+    if (co_await ss::file_exists(path.string())) {
+        _ready.push_front(std::move(src));
+        co_return false;
+    }
+    try {
+        co_await ss::rename_file(src.string(), path.string());
+        co_return true;
+    } catch (...) {
+        vlog(
+          stlog.warn,
+          "Unable to move pooled segment file {} to {}: {}",
+          src,
+          path,
+          std::current_exception());
+    }
+    co_await ss::remove_file(src.string()).handle_exception([](auto) {});
+    co_return false;
+}
+
+ss::future<> segment_file_pool::refill() {
+    while (!_as.abort_requested()) {
+        if (_ready.size() >= _pool_size()) {
+            try {
+                co_await _refill_cv.wait();
+            } catch (const ss::broken_condition_variable&) {
+                co_return;
+            }
+            continue;
+        }
+        try {
+            co_await create_one();
+        } catch (...) {
+            auto e = std::current_exception();
+            if (ssx::is_shutdown_exception(e)) {
+                co_return;
+            }
+            vlog(stlog.warn, "Unable to preallocate segment file: {}", e);
+            // back off, e.g. when the disk is full
+            try {
+                co_await ss::sleep_abortable(5s, _as);
+            } catch (const ss::sleep_aborted&) {
+                co_return;
+            }
+        }
+    }
+}
+
+ss::future<> segment_file_pool::create_one() {
+    if (_next_id == 0) {
+        co_await ss::recursive_touch_directory(_dir.string());
+    }
+    auto path = _dir / fmt::format("{}.log", _next_id++);
+    auto f = co_await internal::make_writer_handle(path, std::nullopt, true);
+    std::exception_ptr ep;
+    try {
+        // same extent the appender reserves first, without growing the
+        // logical size of the file
+        auto step = _resources.get_falloc_step(std::nullopt);
+        if (step > 0) {
+            co_await f.allocate(0, step);
+        }
+    } catch (...) {
+        ep = std::current_exception();
+    }
+    co_await f.close();
+    if (ep) {
+        co_await ss::remove_file(path.string()).handle_exception([](auto) {});
+        std::rethrow_exception(ep);
+    }
+    _ready.push_back(std::move(path));
+}
+
+} // namespace storage
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/scheduling.hh>
+
+#include <deque>
+#include <filesystem>
+
+namespace storage {
+
+class storage_resources;
+
+/**
+ * Per-shard pool of created and preallocated segment files.
+ *
+ * Creating a segment file on log roll and fallocating its first extent are
+ * metadata heavy filesystem operations that otherwise run on the append path
+ * of the partition. A background fiber keeps up to `pool_size` empty files
+ * with their first fallocation step reserved in a private directory of the
+ * data directory, and rolling a segment renames one of them into place.
+ *
+ * The files have a logical size of zero, so a pooled file is
+ * indistinguishable from a freshly created one. Files left over from a
+ * previous run are removed on start.
+ */
+class segment_file_pool {
+public:
+    static constexpr auto directory_name = ".segment_pool";
+
+    segment_file_pool(
+      const std::filesystem::path& base_dir,
+      config::binding<size_t> pool_size,
+      storage_resources&,
+      ss::scheduling_group) noexcept;
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /**
+     * Move a pooled file to `path`. Returns false if no file could be
+     * provided, in which case the caller creates the file as usual.
+     */
+    ss::future<bool> take(const std::filesystem::path& path);
+
+    /// Number of files ready to be taken
+    size_t ready() const { return _ready.size(); }
+
+private:
+    ss::future<> refill();
+    ss::future<> create_one();
+
+    std::filesystem::path _dir;
+    config::binding<size_t> _pool_size;
+    storage_resources& _resources;
+    ss::scheduling_group _sg;
+    std::deque<std::filesystem::path> _ready;
+    ss::condition_variable _refill_cv;
+    ss::abort_source _as;
+    ss::gate _gate;
+    uint64_t _next_id{0};
+};
+
+} // namespace storage
@@ -10,9 +10,12 @@
 #include "storage/segment_index.h"
 
 #include "base/vassert.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/timestamp.h"
+#include "serde/serde_size_t.h"
 #include "storage/index_state.h"
+#include "storage/index_state_serde_compat.h"
 #include "storage/logger.h"
 #include "storage/segment_utils.h"
 
@@ -20,12 +23,14 @@
 #include <seastar/core/fstream.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/seastar.hh>
+#include <seastar/core/byteorder.hh>
 
 #include <bits/stdint-uintn.h>
 #include <boost/container/container_fwd.hpp>
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <array>
 
 namespace storage {
 
@@ -92,14 +97,228 @@ void segment_index::reset() {
     _state.base_offset = base;
 
     _acc = 0;
+    _time_acc = 0;
+    _time_skipped = false;
+    _evicted = false;
 }
 
 void segment_index::swap_index_state(index_state&& o) {
     _needs_persistence = true;
     _acc = 0;
+    _time_acc = 0;
+    _time_skipped = false;
+    _evicted = false;
     std::swap(_state, o);
 }
 
+void segment_index::evict() {
+    vassert(can_evict(), "Evicting index that can't be evicted: {}", *this);
+    _evicted_entries = _state.size();
+    _state.relative_offset_index = {};
+    _state.relative_time_index = {};
+    _state.position_index = {};
+    if (_state.batch_time_index) {
+        _state.batch_time_index = chunked_vector<batch_time_entry>{};
+    }
+    _evicted = true;
+}
+
+ss::future<> segment_index::ensure_materialized() {
+    auto* budget = _budget_entry.budget();
+    if (_evicted) {
+        if (budget) {
+            budget->record_miss();
+        }
+        co_await rehydrate();
+    } else if (budget) {
+        budget->record_hit();
+    }
+    // the index may have been detached (e.g. moved) while rehydrating
+    if (budget && _budget_entry.budget() == budget) {
+        budget->touch(*this);
+    }
+}
+
+ss::future<> segment_index::rehydrate() {
+    std::optional<index_state> st;
+    try {
+        st = co_await ss::with_file(open(), [](ss::file f) {
+            return f.size().then([f](uint64_t size) mutable {
+                return f.dma_read_bulk<char>(0, size).then(
+                  [](ss::temporary_buffer<char> buf) {
+                      iobuf b;
+                      b.append(std::move(buf));
+                      return serde::from_iobuf<index_state>(std::move(b));
+                  });
+            });
+        });
+    } catch (...) {
+        // Lookups keep working against the empty index by scanning from the
+        // start of the segment, so this is not fatal.
+        vlog(
+          stlog.warn,
+          "Failed to re-read evicted index {}: {}",
+          _path,
+          std::current_exception());
+        co_return;
+    }
+
+    // The index could have been rehydrated or replaced while we were
+    // reading, in which case the in-memory state is authoritative.
+    if (!_evicted) {
+        co_return;
+    }
+    _state.relative_offset_index = std::move(st->relative_offset_index);
+    _state.relative_time_index = std::move(st->relative_time_index);
+    _state.position_index = std::move(st->position_index);
+    _state.batch_time_index = std::move(st->batch_time_index);
+    _evicted = false;
+}
+
+ss::future<std::optional<segment_index::entry>>
+segment_index::find_nearest_paged(model::offset o) {
+    auto* budget = _budget_entry.budget();
+    if (
+      !_evicted || _paging_failed || budget == nullptr
+      || !budget->page_cache_enabled()) {
+        co_await ensure_materialized();
+        co_return find_nearest(o);
+    }
+    if (o < _state.base_offset || _evicted_entries == 0) {
+        co_return std::nullopt;
+    }
+
+    const auto page_cache_id = _budget_entry.page_cache_id();
+    std::optional<ss::file> f;
+    std::optional<entry> result;
+    std::exception_ptr ex;
+    try {
+        result = co_await find_nearest_on_disk(o, page_cache_id, f);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    if (f) {
+        co_await f->close().handle_exception([](std::exception_ptr) {});
+    }
+
+    // The index could have been rehydrated, truncated or replaced while we
+    // were reading, in which case only the in-memory state is authoritative.
+    if (
+      ex || !_evicted || _budget_entry.budget() != budget
+      || _budget_entry.page_cache_id() != page_cache_id) {
+        if (ex) {
+            vlog(
+              stlog.debug,
+              "Paged lookup in evicted index {} failed, re-reading it: {}",
+              _path,
+              ex);
+            _paging_failed = true;
+        }
+        co_await ensure_materialized();
+        co_return find_nearest(o);
+    }
+    budget->touch(*this);
+    co_return result;
+}
+
+ss::future<std::optional<segment_index::entry>>
+segment_index::find_nearest_on_disk(
+  model::offset o, uint64_t page_cache_id, std::optional<ss::file>& f) {
+    const auto n = _evicted_entries;
+    const auto layout = index_state::column_layout::for_entries(n);
+
+    // Make sure that the file has the layout we expect: the compat format
+    // starts with a smaller version byte, and the column sizes must match
+    // the index that was evicted.
+    const auto version = co_await read_paged<uint8_t>(0, page_cache_id, f);
+    const auto count_size = sizeof(serde::serde_size_t);
+    const auto offsets_count = co_await read_paged<serde::serde_size_t>(
+      layout.relative_offsets - count_size, page_cache_id, f);
+    const auto positions_count = co_await read_paged<serde::serde_size_t>(
+      layout.positions - count_size, page_cache_id, f);
+    if (
+      version <= serde_compat::index_state_serde::ondisk_version
+      || offsets_count != n || positions_count != n) {
+        throw std::runtime_error(fmt::format(
+          "unexpected index file layout: version {}, {}/{} entries, expected "
+          "{}",
+          version,
+          offsets_count,
+          positions_count,
+          n));
+    }
+
+    // std::lower_bound over the on-disk relative offset column, followed by
+    // the same step back as find_nearest()
+    const uint32_t needle = o() - _state.base_offset();
+    size_t lo = 0;
+    size_t len = n;
+    while (len > 0) {
+        const auto half = len / 2;
+        const auto v = co_await read_paged<uint32_t>(
+          layout.relative_offsets + (lo + half) * sizeof(uint32_t),
+          page_cache_id,
+          f);
+        if (v < needle) {
+            lo += half + 1;
+            len -= half + 1;
+        } else {
+            len = half;
+        }
+    }
+    size_t i = std::min(lo, n - 1);
+    auto relative_offset = co_await read_paged<uint32_t>(
+      layout.relative_offsets + i * sizeof(uint32_t), page_cache_id, f);
+    if (relative_offset > needle) {
+        if (i == 0) {
+            co_return std::nullopt;
+        }
+        --i;
+        relative_offset = co_await read_paged<uint32_t>(
+          layout.relative_offsets + i * sizeof(uint32_t), page_cache_id, f);
+    }
+
+    const auto relative_time = co_await read_paged<uint32_t>(
+      layout.relative_times + i * sizeof(uint32_t), page_cache_id, f);
+    const auto position = co_await read_paged<uint64_t>(
+      layout.positions + i * sizeof(uint64_t), page_cache_id, f);
+    co_return translate_index_entry(
+      _state,
+      {relative_offset,
+       offset_time_index{relative_time, _state.with_offset},
+       position});
+}
+
+template<typename T>
+ss::future<T> segment_index::read_paged(
+  size_t pos, uint64_t page_cache_id, std::optional<ss::file>& f) {
+    constexpr auto page_size = segment_index_budget::page_size;
+    auto* budget = _budget_entry.budget();
+    std::array<char, sizeof(T)> raw{};
+    size_t copied = 0;
+    // a value may straddle two pages
+    while (copied < raw.size()) {
+        const auto page = (pos + copied) / page_size;
+        auto buf = budget->find_page(page_cache_id, page);
+        if (!buf) {
+            if (!f) {
+                f = co_await open();
+            }
+            buf = co_await f->dma_read_bulk<char>(page * page_size, page_size);
+            budget->insert_page(page_cache_id, page, buf->share());
+        }
+        const auto in_page = (pos + copied) % page_size;
+        if (in_page >= buf->size()) {
+            throw std::out_of_range(fmt::format(
+              "index read at {} beyond end of file", pos + copied));
+        }
+        const auto len = std::min(raw.size() - copied, buf->size() - in_page);
+        std::copy_n(buf->get() + in_page, len, raw.data() + copied);
+        copied += len;
+    }
+    co_return ss::read_le<T>(raw.data());
+}
+
 // helper for segment_index::maybe_track, converts betwen optional-wrapped
 // broker_timestamp_t and model::timestamp
 constexpr auto to_optional_model_timestamp(std::optional<broker_timestamp_t> in)
@@ -117,6 +336,7 @@ void segment_index::maybe_track(
   const model::record_batch_header& hdr,
   std::optional<broker_timestamp_t> new_broker_ts,
   size_t filepos) {
+    vassert(!_evicted, "Appending to an evicted index: {}", *this);
     _acc += hdr.size_bytes;
 
     _state.update_batch_timestamps_are_monotonic(
@@ -124,6 +344,8 @@ void segment_index::maybe_track(
     _last_batch_max_timestamp = std::max(
       hdr.first_timestamp, hdr.max_timestamp);
 
+    const bool user_data = path().is_internal_topic()
+                           || hdr.type == model::record_batch_type::raft_data;
     if (_state.maybe_index(
           _acc,
           _step,
@@ -133,11 +355,28 @@ void segment_index::maybe_track(
           hdr.first_timestamp,
           hdr.max_timestamp,
           to_optional_model_timestamp(new_broker_ts),
-          path().is_internal_topic()
-            || hdr.type == model::record_batch_type::raft_data,
+          user_data,
           internal::is_compactible(hdr) ? hdr.record_count : 0)) {
         _acc = 0;
     }
+    if (user_data) {
+        _time_acc += hdr.size_bytes;
+        if (_state.maybe_index_batch_time(
+              _time_acc,
+              config::shard_local_cfg().storage_time_index_step_bytes(),
+              !_time_skipped,
+              filepos,
+              hdr.base_offset,
+              hdr.first_timestamp,
+              hdr.max_timestamp)) {
+            _time_acc = 0;
+            _time_skipped = false;
+        } else {
+            _time_skipped = true;
+        }
+    }
+    _state.maybe_add_translator_gap(
+      hdr.type, hdr.base_offset, hdr.last_offset());
     _needs_persistence = true;
 }
 
@@ -226,6 +465,7 @@ ss::future<> segment_index::truncate(
     if (new_max_offset < _state.base_offset) {
         co_return;
     }
+    co_await ensure_materialized();
     const uint32_t i = new_max_offset() - _state.base_offset();
     auto it = std::lower_bound(
       std::begin(_state.relative_offset_index),
@@ -235,13 +475,16 @@ ss::future<> segment_index::truncate(
 
     if (it != _state.relative_offset_index.end()) {
         _needs_persistence = true;
-        int remove_back_elems = std::distance(
-          it, _state.relative_offset_index.end());
-        while (remove_back_elems-- > 0) {
-            _state.pop_back();
-        }
+        _state.pop_back_n(
+          std::distance(it, _state.relative_offset_index.end()));
     }
 
+    _state.truncate_translator_gaps(new_max_offset);
+    _state.truncate_batch_time_index(new_max_offset);
+    // batches between the last remaining entry and the new end of the segment
+    // may not have been indexed
+    _time_skipped = true;
+
     if (new_max_offset < _state.max_offset) {
         _needs_persistence = true;
         if (_state.empty()) {
@@ -277,6 +520,10 @@ ss::future<bool> segment_index::materialize_index_from_file(ss::file f) {
     b.append(std::move(buf));
     try {
         _state = serde::from_iobuf<index_state>(std::move(b));
+        _evicted = false;
+        if (auto* budget = _budget_entry.budget(); budget) {
+            budget->touch(*this);
+        }
         co_return true;
     } catch (const serde::serde_exception& ex) {
         vlog(
@@ -305,12 +552,18 @@ ss::future<> segment_index::flush() {
     // it is a good time to free speculatively allocated memory.
     _state.shrink_to_fit();
 
+    // The state is serialized once the file is open: keep the index budget
+    // from dropping it in the meantime.
+    _flush_in_progress = true;
     return with_file(open(), [this](ss::file backing_file) {
-        return flush_to_file(std::move(backing_file));
-    });
+               return flush_to_file(std::move(backing_file));
+           })
+      .finally([this] { _flush_in_progress = false; });
 }
 
 ss::future<> segment_index::flush_to_file(ss::file backing_file) {
+    // the file is rewritten in the current format
+    _paging_failed = false;
     co_await backing_file.truncate(0);
     auto out = co_await ss::make_file_output_stream(std::move(backing_file));
 
@@ -324,7 +577,8 @@ ss::future<> segment_index::flush_to_file(ss::file backing_file) {
 std::ostream& operator<<(std::ostream& o, const segment_index& i) {
     return o << "{file:" << i.path() << ", offsets:" << i.base_offset()
              << ", index:" << i._state << ", step:" << i._step
-             << ", needs_persistence:" << i._needs_persistence << "}";
+             << ", needs_persistence:" << i._needs_persistence
+             << ", evicted:" << i._evicted << "}";
 }
 std::ostream& operator<<(std::ostream& o, const segment_index_ptr& i) {
     if (i) {
@@ -10,6 +10,7 @@
  */
 
 #pragma once
+#include "base/vassert.h"
 #include "features/feature_table.h"
 #include "model/fundamental.h"
 #include "model/record.h"
@@ -17,6 +18,7 @@
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/index_state.h"
+#include "storage/segment_index_budget.h"
 #include "storage/types.h"
 
 #include <seastar/core/file.hh>
@@ -153,6 +155,12 @@ public:
       size_t filepos);
     std::optional<entry> find_nearest(model::offset);
     std::optional<entry> find_nearest(model::timestamp);
+    /// Timestamp lookup in the batch time index, see
+    /// index_state::find_batch_time.
+    std::optional<index_state::batch_time_match>
+    find_batch_time(model::timestamp t) const {
+        return _state.find_batch_time(t);
+    }
     /// Find entry by file offset (the value may overshoot or find precise
     /// match)
     std::optional<entry> find_above_size_bytes(size_t distance);
@@ -168,6 +176,12 @@ public:
     auto num_compactible_records_appended() const {
         return _state.num_compactible_records_appended;
     }
+    /// Batches in the segment skipped by offset translation, see
+    /// index_state::translator_gaps.
+    const std::optional<chunked_vector<translator_gap>>&
+    translator_gaps() const {
+        return _state.translator_gaps;
+    }
     model::offset base_offset() const { return _state.base_offset; }
     model::offset max_offset() const { return _state.max_offset; }
     model::timestamp max_timestamp() const { return _state.max_timestamp; }
@@ -197,6 +211,31 @@ public:
     }
 
     ss::future<bool> materialize_index();
+
+    /// Attach this index to the shard-wide index memory budget. Must only be
+    /// called once the owning segment stops appending, since an attached
+    /// index may have its columns evicted.
+    void attach_budget(segment_index_budget& budget) { budget.attach(*this); }
+    void detach_budget() { _budget_entry.detach(); }
+
+    /// True if the lookup columns were dropped by the index budget. Header
+    /// fields remain valid, but the find_* methods only see an empty index
+    /// (which callers already treat as "scan from the segment start") until
+    /// ensure_materialized() is called.
+    bool is_evicted() const { return _evicted; }
+
+    /// Make the lookup columns resident again if they were evicted, and mark
+    /// the index as recently used. Call this before find_* on paths where a
+    /// precise lookup matters.
+    ss::future<> ensure_materialized();
+
+    /// find_nearest(model::offset) for read paths that only need a single
+    /// lookup. An evicted index is not made resident: the lookup reads the
+    /// few pages of the `.base_index` file it needs through the index
+    /// budget's page cache. Falls back to ensure_materialized() when the
+    /// page cache is disabled or the file can't be paged.
+    ss::future<std::optional<entry>> find_nearest_paged(model::offset);
+
     ss::future<> flush();
     ss::future<> truncate(model::offset, model::timestamp);
 
@@ -215,7 +254,10 @@ public:
     void reset();
     void swap_index_state(index_state&&);
     bool needs_persistence() const { return _needs_persistence; }
-    index_state release_index_state() && { return std::move(_state); }
+    index_state release_index_state() && {
+        vassert(!_evicted, "Releasing an evicted index state: {}", _path);
+        return std::move(_state);
+    }
 
     /*
      * Get the on-disk device usage size of the index.
@@ -226,11 +268,29 @@ public:
 private:
     ss::future<bool> materialize_index_from_file(ss::file);
     ss::future<> flush_to_file(ss::file);
+    ss::future<> rehydrate();
+
+    /// The in-memory state may be dropped only if it matches the file.
+    bool can_evict() const {
+        return !_evicted && !_state.empty() && !_needs_persistence
+               && !_flush_in_progress;
+    }
+    void evict();
+
+    ss::future<std::optional<entry>> find_nearest_on_disk(
+      model::offset, uint64_t page_cache_id, std::optional<ss::file>&);
+    template<typename T>
+    ss::future<T> read_paged(
+      size_t pos, uint64_t page_cache_id, std::optional<ss::file>&);
 
     segment_full_path _path;
     size_t _step;
     std::reference_wrapper<ss::sharded<features::feature_table>> _feature_table;
     size_t _acc{0};
+    // user data bytes since the last batch time index entry, and whether a
+    // user data batch was left out of the batch time index since then
+    size_t _time_acc{0};
+    bool _time_skipped{false};
     bool _needs_persistence{false};
     index_state _state;
     std::optional<ntp_sanitizer_config> _sanitizer_config;
@@ -244,6 +304,14 @@ private:
 
     model::timestamp _last_batch_max_timestamp;
 
+    bool _evicted{false};
+    // number of entries of the index when it was evicted, and whether the
+    // file turned out not to be pageable (e.g. it uses the compat format)
+    size_t _evicted_entries{0};
+    bool _paging_failed{false};
+    bool _flush_in_progress{false};
+    segment_index_budget::entry _budget_entry;
+
     /** Constructor with mock file content for unit testing */
     segment_index(
       segment_full_path path,
@@ -259,6 +327,7 @@ private:
     friend class offset_index_utils_fixture;
     friend class log_replayer_fixture;
     friend class segment_index_observer;
+    friend class segment_index_budget;
 
     friend std::ostream& operator<<(std::ostream&, const segment_index&);
 };
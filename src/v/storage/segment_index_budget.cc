@@ -0,0 +1,187 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/segment_index_budget.h"
+
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
+#include "storage/logger.h"
+#include "storage/segment_index.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace storage {
+
+void segment_index_budget::entry::detach() noexcept {
+    if (_budget) {
+        _budget->remove(*this);
+    }
+    _budget = nullptr;
+    _owner = nullptr;
+}
+
+segment_index_budget::segment_index_budget(
+  config::binding<std::optional<size_t>> max_bytes,
+  config::binding<size_t> max_page_bytes)
+  : _max_bytes(std::move(max_bytes))
+  , _max_page_bytes(std::move(max_page_bytes)) {
+    _max_bytes.watch([this] { maybe_evict(nullptr); });
+    _max_page_bytes.watch([this] { maybe_evict_pages(); });
+}
+
+segment_index_budget::~segment_index_budget() noexcept {
+    for (auto* list : {&_lru, &_evicted}) {
+        while (!list->empty()) {
+            auto& e = list->front();
+            e.detach();
+        }
+    }
+}
+
+void segment_index_budget::remove(entry& e) noexcept {
+    _resident_bytes -= e._bytes;
+    e._bytes = 0;
+    e._hook.unlink();
+}
+
+void segment_index_budget::attach(segment_index& idx) {
+    auto& e = idx._budget_entry;
+    if (e._budget == this) {
+        return;
+    }
+    e.detach();
+    e._budget = this;
+    e._owner = &idx;
+    e._page_cache_id = ++_next_page_cache_id;
+    touch(idx);
+}
+
+void segment_index_budget::touch(segment_index& idx) {
+    auto& e = idx._budget_entry;
+    if (e._budget != this) {
+        return;
+    }
+    remove(e);
+    if (idx.is_evicted()) {
+        _evicted.push_back(e);
+        return;
+    }
+    e._bytes = idx._state.memory_size();
+    _resident_bytes += e._bytes;
+    _lru.push_back(e);
+    maybe_evict(&idx);
+}
+
+void segment_index_budget::maybe_evict(const segment_index* keep) {
+    const auto max_bytes = _max_bytes();
+    if (!max_bytes.has_value()) {
+        return;
+    }
+    auto it = _lru.begin();
+    while (_resident_bytes > *max_bytes && it != _lru.end()) {
+        auto& e = *it++;
+        if (e._owner == keep || !e._owner->can_evict()) {
+            continue;
+        }
+        vlog(stlog.trace, "Evicting segment index {}", e._owner->path());
+        remove(e);
+        e._owner->evict();
+        e._page_cache_id = ++_next_page_cache_id;
+        _evicted.push_back(e);
+        ++_evictions;
+    }
+}
+
+std::optional<ss::temporary_buffer<char>>
+segment_index_budget::find_page(uint64_t page_cache_id, size_t page) {
+    auto it = _pages.find(page_key{page_cache_id, page});
+    if (it == _pages.end()) {
+        ++_page_misses;
+        return std::nullopt;
+    }
+    ++_page_hits;
+    auto& p = it->second;
+    p.hook.unlink();
+    _page_lru.push_back(p);
+    return p.data.share();
+}
+
+void segment_index_budget::insert_page(
+  uint64_t page_cache_id, size_t page, ss::temporary_buffer<char> data) {
+    if (!page_cache_enabled()) {
+        return;
+    }
+    const page_key key{page_cache_id, page};
+    auto [it, inserted] = _pages.try_emplace(key);
+    auto& p = it->second;
+    if (!inserted) {
+        // two lookups raced on the same page
+        _page_bytes -= p.data.size();
+        p.hook.unlink();
+    }
+    p.key = key;
+    p.data = std::move(data);
+    _page_bytes += p.data.size();
+    _page_lru.push_back(p);
+    maybe_evict_pages();
+}
+
+void segment_index_budget::maybe_evict_pages() {
+    while (_page_bytes > _max_page_bytes() && !_page_lru.empty()) {
+        auto& p = _page_lru.front();
+        _page_bytes -= p.data.size();
+        // erasing the node unlinks it from the lru
+        _pages.erase(p.key);
+    }
+}
+
+void segment_index_budget::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:segment_index"),
+      {
+        sm::make_gauge(
+          "resident_bytes",
+          [this] { return _resident_bytes; },
+          sm::description(
+            "Bytes held in memory by indices of read-only segments")),
+        sm::make_counter(
+          "hits",
+          [this] { return _hits; },
+          sm::description("Segment index lookups served from memory")),
+        sm::make_counter(
+          "misses",
+          [this] { return _misses; },
+          sm::description(
+            "Segment index lookups that had to re-read the index from disk")),
+        sm::make_counter(
+          "evictions",
+          [this] { return _evictions; },
+          sm::description("Segment indices dropped from memory")),
+        sm::make_gauge(
+          "page_cache_bytes",
+          [this] { return _page_bytes; },
+          sm::description(
+            "Bytes held in memory by cached pages of evicted index files")),
+        sm::make_counter(
+          "page_hits",
+          [this] { return _page_hits; },
+          sm::description(
+            "Evicted index file pages served from the page cache")),
+        sm::make_counter(
+          "page_misses",
+          [this] { return _page_misses; },
+          sm::description("Evicted index file pages read from disk")),
+      });
+}
+
+} // namespace storage
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "container/intrusive_list_helpers.h"
+#include "metrics/metrics.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace storage {
+
+class segment_index;
+
+/**
+ * Shard-wide memory budget for the lookup columns of read-only segment
+ * indices.
+ *
+ * Segments that are no longer appended to attach their segment_index to the
+ * budget. Attached indices are kept in LRU order of their lookups, and when
+ * the resident size of the attached indices exceeds the configured limit the
+ * least recently used ones have their columns dropped. An evicted index keeps
+ * its header (offset and timestamp bounds, flags) so that segment level
+ * metadata stays available, and its columns are re-read from the
+ * `.base_index` file by segment_index::ensure_materialized().
+ *
+ * When no limit is configured nothing is ever evicted, but lookups are still
+ * counted so that the hit/miss probes can be used to size the budget.
+ *
+ * Offset lookups on the read path don't need the whole index back: the budget
+ * also keeps a separately bounded LRU cache of fixed size pages of the index
+ * files of evicted indices, see segment_index::find_nearest_paged(). Pages are
+ * keyed by an id handed out each time an index is evicted or attached, so
+ * pages of an index that was rehydrated or rewritten since are never found
+ * again and just age out.
+ *
+ * Owned by storage_resources, one instance per shard.
+ */
+class segment_index_budget {
+public:
+    /**
+     * Per-index bookkeeping, embedded in segment_index.
+     *
+     * Moving an index detaches both the source and the destination: the
+     * owning segment re-attaches the index once it knows that the index is
+     * read-only.
+     */
+    class entry {
+    public:
+        entry() = default;
+        entry(const entry&) = delete;
+        entry& operator=(const entry&) = delete;
+        entry(entry&& o) noexcept { o.detach(); }
+        entry& operator=(entry&& o) noexcept {
+            if (this != &o) {
+                detach();
+                o.detach();
+            }
+            return *this;
+        }
+        ~entry() noexcept { detach(); }
+
+        segment_index_budget* budget() const { return _budget; }
+        uint64_t page_cache_id() const { return _page_cache_id; }
+        void detach() noexcept;
+
+    private:
+        friend class segment_index_budget;
+
+        intrusive_list_hook _hook;
+        segment_index_budget* _budget{nullptr};
+        segment_index* _owner{nullptr};
+        size_t _bytes{0};
+        uint64_t _page_cache_id{0};
+    };
+
+    // pages are aligned so that each is a single dma read
+    static constexpr size_t page_size = 4096;
+
+    segment_index_budget(
+      config::binding<std::optional<size_t>> max_bytes,
+      config::binding<size_t> max_page_bytes);
+    segment_index_budget(const segment_index_budget&) = delete;
+    segment_index_budget& operator=(const segment_index_budget&) = delete;
+    segment_index_budget(segment_index_budget&&) = delete;
+    segment_index_budget& operator=(segment_index_budget&&) = delete;
+    ~segment_index_budget() noexcept;
+
+    /// Start tracking `idx` as the most recently used index.
+    void attach(segment_index& idx);
+
+    /// Mark `idx` as the most recently used index and update its accounted
+    /// size, evicting other indices if the budget is exceeded.
+    void touch(segment_index& idx);
+
+    void record_hit() { ++_hits; }
+    void record_miss() { ++_misses; }
+
+    bool page_cache_enabled() const { return _max_page_bytes() > 0; }
+
+    /// Page `page` of the index file of the index with the given page cache
+    /// id, if it is cached. Counts a page hit or miss.
+    std::optional<ss::temporary_buffer<char>>
+    find_page(uint64_t page_cache_id, size_t page);
+
+    /// Cache a page read after find_page() missed.
+    void insert_page(
+      uint64_t page_cache_id, size_t page, ss::temporary_buffer<char> data);
+
+    size_t resident_bytes() const { return _resident_bytes; }
+    size_t page_bytes() const { return _page_bytes; }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+    uint64_t evictions() const { return _evictions; }
+    uint64_t page_hits() const { return _page_hits; }
+    uint64_t page_misses() const { return _page_misses; }
+
+    void setup_metrics();
+
+private:
+    void maybe_evict(const segment_index* keep);
+    void maybe_evict_pages();
+    void remove(entry&) noexcept;
+
+    using list_t = intrusive_list<entry, &entry::_hook>;
+
+    using page_key = std::pair<uint64_t, size_t>;
+    struct cached_page {
+        page_key key;
+        ss::temporary_buffer<char> data;
+        intrusive_list_hook hook;
+    };
+
+    config::binding<std::optional<size_t>> _max_bytes;
+    // attached indices with resident columns, least recently used first
+    list_t _lru;
+    // attached indices whose columns have been evicted
+    list_t _evicted;
+    size_t _resident_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _evictions{0};
+
+    config::binding<size_t> _max_page_bytes;
+    absl::node_hash_map<page_key, cached_page> _pages;
+    // least recently used first
+    intrusive_list<cached_page, &cached_page::hook> _page_lru;
+    size_t _page_bytes{0};
+    uint64_t _next_page_cache_id{0};
+    uint64_t _page_hits{0};
+    uint64_t _page_misses{0};
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace storage
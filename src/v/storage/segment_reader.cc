@@ -14,6 +14,7 @@
 #include "ssx/future-util.h"
 #include "storage/logger.h"
 #include "storage/segment_utils.h"
+#include "storage/storage_resources.h"
 
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
@@ -27,11 +28,42 @@ segment_reader::segment_reader(
   segment_full_path path,
   size_t buffer_size,
   unsigned read_ahead,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config) noexcept
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  storage_resources* resources) noexcept
   : _path(std::move(path))
   , _buffer_size(buffer_size)
   , _read_ahead(read_ahead)
-  , _sanitizer_config(std::move(ntp_sanitizer_config)) {}
+  , _sanitizer_config(std::move(ntp_sanitizer_config))
+  , _resources(resources) {}
+
+ss::file_input_stream_options segment_reader::stream_options(
+  ss::io_priority_class pc, segment_reader_handle& handle) {
+    ss::file_input_stream_options options;
+    options.buffer_size = _buffer_size;
+    options.io_priority_class = pc;
+    options.read_ahead = _read_ahead;
+    if (_resources == nullptr || _read_ahead == 0) {
+        return options;
+    }
+    /*
+     * With a history the stream starts with a single read in flight and
+     * grows towards `read_ahead` reads while the data it prefetches is
+     * consumed, i.e. while the access is sequential, and backs off when
+     * prefetched data goes unused. Its worst case footprint is reserved up
+     * front. Readers that don't fit in the shard budget read one buffer at a
+     * time rather than wait.
+     */
+    auto units = _resources->read_ahead_try_take_bytes(
+      _buffer_size * _read_ahead);
+    if (!units) {
+        options.read_ahead = 0;
+        return options;
+    }
+    handle._read_ahead_units = std::move(*units);
+    options.dynamic_adjustments
+      = ss::make_lw_shared<ss::file_input_stream_history>();
+    return options;
+}
 
 segment_reader::~segment_reader() noexcept {
     if (!_streams.empty() || _data_file_refcount > 0) {
@@ -74,16 +106,11 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
 
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
     ss::gate::holder guard{_gate};
 
     auto handle = co_await get();
     handle.set_stream(make_file_input_stream(
-      _data_file, pos, _file_size - pos, std::move(options)));
+      _data_file, pos, _file_size - pos, stream_options(pc, handle)));
     co_return std::move(handle);
 }
 
@@ -155,15 +182,13 @@ ss::future<segment_reader_handle> segment_reader::data_stream(
       pos_begin,
       pos_end,
       *this);
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
     ss::gate::holder guard{_gate};
     auto handle = co_await get();
     handle.set_stream(make_file_input_stream(
-      _data_file, pos_begin, pos_end - pos_begin, std::move(options)));
+      _data_file,
+      pos_begin,
+      pos_end - pos_begin,
+      stream_options(pc, handle)));
     co_return handle;
 }
 
@@ -215,6 +240,7 @@ ss::future<> segment_reader_handle::close() {
         co_await _stream.value().close();
         _stream = std::nullopt;
     }
+    _read_ahead_units.return_all();
     _hook.unlink();
 
     if (_parent) {
@@ -236,6 +262,7 @@ void segment_reader_handle::operator=(segment_reader_handle&& rhs) noexcept {
     }
     _stream = std::exchange(rhs._stream, std::nullopt);
     _parent = std::exchange(rhs._parent, nullptr);
+    _read_ahead_units = std::move(rhs._read_ahead_units);
     _hook.swap_nodes(rhs._hook);
 }
 
@@ -14,6 +14,7 @@
 #include "base/seastarx.h"
 #include "container/intrusive_list_helpers.h"
 #include "model/fundamental.h"
+#include "ssx/semaphore.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/types.h"
@@ -59,12 +60,16 @@ private:
     // created to just stat() a file for example.
     std::optional<ss::input_stream<char>> _stream;
 
+    // Read-ahead memory charged to storage_resources for the stream.
+    ssx::semaphore_units _read_ahead_units;
+
 public:
     explicit segment_reader_handle(segment_reader* parent);
 
     segment_reader_handle(segment_reader_handle&& rhs) noexcept {
         _stream = std::exchange(rhs._stream, std::nullopt);
         _parent = std::exchange(rhs._parent, nullptr);
+        _read_ahead_units = std::move(rhs._read_ahead_units);
         _hook.swap_nodes(rhs._hook);
     }
 
@@ -114,8 +119,8 @@ public:
       segment_full_path filename,
       size_t buffer_size,
       unsigned read_ahead,
-      std::optional<ntp_sanitizer_config> ntp_sanitizer_config
-      = std::nullopt) noexcept;
+      std::optional<ntp_sanitizer_config> ntp_sanitizer_config = std::nullopt,
+      storage_resources* resources = nullptr) noexcept;
     ~segment_reader() noexcept;
     segment_reader(segment_reader&&) = delete;
     segment_reader& operator=(segment_reader&&) = delete;
@@ -134,6 +139,9 @@ public:
 
     bool empty() const { return _file_size == 0; }
 
+    /// resources read-ahead buffers are charged to, if any
+    storage_resources* resources() const { return _resources; }
+
     /// close the underlying file handle
     ss::future<> close();
 
@@ -169,6 +177,7 @@ private:
     size_t _buffer_size{0};
     unsigned _read_ahead{0};
     std::optional<ntp_sanitizer_config> _sanitizer_config;
+    storage_resources* _resources{nullptr};
 
     // Keeps track of operations that cannot be pre-empted by close()
     ss::gate _gate;
@@ -178,6 +187,11 @@ private:
     // Signal destruction of a segment_reader_handle
     ss::future<> put();
 
+    // Options for a stream of `handle`, charging its read-ahead buffers to
+    // `_resources` when set.
+    ss::file_input_stream_options
+    stream_options(ss::io_priority_class, segment_reader_handle& handle);
+
     friend class segment_reader_handle;
     friend std::ostream& operator<<(std::ostream&, const segment_reader&);
 };
@@ -0,0 +1,165 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/segment_scrubber.h"
+
+#include "base/vlog.h"
+#include "hashing/crc32c.h"
+#include "model/record.h"
+#include "model/record_utils.h"
+#include "storage/logger.h"
+#include "storage/parser.h"
+#include "storage/segment.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <fmt/format.h>
+
+namespace storage {
+
+namespace {
+
+class scrubbing_consumer final : public batch_consumer {
+public:
+    scrubbing_consumer(
+      segment_scrub_result& result,
+      std::optional<model::offset>& last_offset,
+      token_bucket<>* budget,
+      ss::abort_source& as)
+      : _result(result)
+      , _last_offset(last_offset)
+      , _budget(budget)
+      , _as(as) {}
+
+    consume_result
+    accept_batch_start(const model::record_batch_header&) const final {
+        return batch_consumer::consume_result::accept_batch;
+    }
+
+    void skip_batch_start(model::record_batch_header, size_t, size_t) final {}
+
+    void consume_batch_start(
+      model::record_batch_header header,
+      size_t physical_base_offset,
+      size_t size_on_disk) final {
+        _header = header;
+        _physical_base_offset = physical_base_offset;
+        _size_on_disk = size_on_disk;
+        _crc = crc::crc32c();
+        model::crc_record_batch_header(_crc, header);
+    }
+
+    void consume_records(iobuf&& records) final {
+        crc_extend_iobuf(_crc, records);
+    }
+
+    ss::future<stop_parser> consume_batch_end() final {
+        ++_result.batches;
+        _result.bytes += _size_on_disk;
+        _last_offset = _header.last_offset();
+        // crc is calculated as a uint32_t but because of kafka we carry around
+        // a signed type in the batch structure
+        if ((uint32_t)_header.crc != _crc.value()) {
+            auto& corrupted = _result.corrupted;
+            if (
+              !corrupted.empty()
+              && model::next_offset(corrupted.back().last_offset)
+                   == _header.base_offset) {
+                corrupted.back().last_offset = _header.last_offset();
+            } else {
+                corrupted.push_back({
+                  .base_offset = _header.base_offset,
+                  .last_offset = _header.last_offset(),
+                  .file_pos = _physical_base_offset,
+                });
+            }
+        }
+        if (_budget) {
+            co_await _budget->throttle(_size_on_disk, _as);
+        }
+        co_return stop_parser(_as.abort_requested());
+    }
+
+    void print(std::ostream& os) const final {
+        fmt::print(os, "storage::scrubbing_consumer");
+    }
+
+private:
+    segment_scrub_result& _result;
+    std::optional<model::offset>& _last_offset;
+    token_bucket<>* _budget;
+    ss::abort_source& _as;
+    model::record_batch_header _header;
+    size_t _physical_base_offset{0};
+    size_t _size_on_disk{0};
+    crc::crc32c _crc;
+};
+
+} // namespace
+
+ss::future<segment_scrub_result> scrub_segment(
+  ss::lw_shared_ptr<segment> seg,
+  ss::io_priority_class prio,
+  token_bucket<>* budget,
+  ss::abort_source& as) {
+    auto lock = co_await seg->read_lock();
+    segment_scrub_result result;
+    if (seg->is_closed()) {
+        co_return result;
+    }
+    const auto committed = seg->offsets().get_committed_offset();
+    std::optional<model::offset> last_offset;
+    auto parser = continuous_batch_parser(
+      std::make_unique<scrubbing_consumer>(result, last_offset, budget, as),
+      co_await seg->reader().data_stream(0, prio));
+    std::exception_ptr e;
+    try {
+        co_await parser.consume();
+    } catch (...) {
+        e = std::current_exception();
+    }
+    co_await parser.close();
+    if (e) {
+        std::rethrow_exception(e);
+    }
+    if (as.abort_requested()) {
+        co_return result;
+    }
+
+    // whatever follows a batch the parser could not make sense of is
+    // unreadable, even if its own crc would be fine
+    const auto next = last_offset ? model::next_offset(*last_offset)
+                                  : seg->offsets().get_base_offset();
+    if (next <= committed) {
+        vlog(
+          stlog.debug,
+          "Scrubbing {} stopped at {} with {}",
+          seg->reader().filename(),
+          next,
+          parser.error());
+        result.corrupted.push_back({
+          .base_offset = next,
+          .last_offset = committed,
+          .file_pos = result.bytes,
+        });
+    }
+    co_return result;
+}
+
+std::ostream& operator<<(std::ostream& o, const corrupted_range& r) {
+    fmt::print(
+      o,
+      "{{base_offset: {}, last_offset: {}, file_pos: {}}}",
+      r.base_offset,
+      r.last_offset,
+      r.file_pos);
+    return o;
+}
+
+} // namespace storage
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/fundamental.h"
+#include "storage/fwd.h"
+#include "utils/token_bucket.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <vector>
+
+namespace storage {
+
+/// A range of batches of a segment that failed their checksum.
+struct corrupted_range {
+    model::offset base_offset;
+    model::offset last_offset;
+    // position of the first corrupted batch in the segment file
+    size_t file_pos{0};
+
+    friend std::ostream& operator<<(std::ostream&, const corrupted_range&);
+};
+
+struct segment_scrub_result {
+    size_t bytes{0};
+    size_t batches{0};
+    std::vector<corrupted_range> corrupted;
+};
+
+/**
+ * Reads a closed segment from disk and validates the crc of every batch,
+ * reporting the ranges of batches that fail it. Bit rot is otherwise only
+ * found when a consumer or a follower happens to read the batch.
+ *
+ * The segment is read with `prio` and, if given, the bytes read are throttled
+ * by `budget`. A batch whose header is damaged stops the parser, so everything
+ * from it up to the end of the segment is reported as corrupted.
+ *
+ * Holds a read lock of the segment, so it is not removed or replaced by
+ * compaction while it is scrubbed.
+ */
+ss::future<segment_scrub_result> scrub_segment(
+  ss::lw_shared_ptr<segment>,
+  ss::io_priority_class prio,
+  token_bucket<>* budget,
+  ss::abort_source& as);
+
+} // namespace storage
@@ -53,6 +53,10 @@ struct segment_ordering {
 segment_set::segment_set(segment_set::underlying_t segs)
   : _handles(std::move(segs)) {
     std::sort(_handles.begin(), _handles.end(), segment_ordering{});
+    _base_offsets.reserve(_handles.size());
+    for (const auto& h : _handles) {
+        _base_offsets.push_back(h->offsets().get_base_offset());
+    }
 }
 
 segment_set::~segment_set() noexcept = default;
@@ -69,62 +73,58 @@ void segment_set::add(ss::lw_shared_ptr<segment> h) {
           *h,
           *this);
     }
+    _base_offsets.push_back(h->offsets().get_base_offset());
     _handles.emplace_back(std::move(h));
 }
 
-void segment_set::pop_back() { _handles.pop_back(); }
-void segment_set::pop_front() { _handles.pop_front(); }
+void segment_set::pop_back() {
+    _handles.pop_back();
+    _base_offsets.pop_back();
+}
+void segment_set::pop_front() {
+    _handles.pop_front();
+    _base_offsets.pop_front();
+}
 void segment_set::erase(iterator begin, iterator end) {
+    auto first = std::next(
+      _base_offsets.begin(), std::distance(_handles.begin(), begin));
+    auto last = std::next(first, std::distance(begin, end));
     _handles.erase(begin, end);
+    _base_offsets.erase(first, last);
 }
 
-template<typename Iterator>
-struct needle_in_range {
-    bool operator()(Iterator ptr, model::offset o) {
-        auto& s = **ptr;
-        if (s.empty()) {
-            return false;
-        }
-        // must use max_offset
-        return o <= s.offsets().get_dirty_offset()
-               && o >= s.offsets().get_base_offset();
-    }
-};
-
-template<typename Iterator, typename Needle>
-Iterator segments_lower_bound(Iterator begin, Iterator end, Needle needle) {
-    if (std::distance(begin, end) == 0) {
-        return end;
-    }
-    auto it = std::lower_bound(begin, end, needle, segment_ordering{});
-    if (it == end) {
-        it = std::prev(it);
-    }
-    if (needle_in_range<Iterator>()(it, needle)) {
-        return it;
+std::optional<size_t> segment_set::find_offset(model::offset o) const {
+    if (_base_offsets.empty() || o < _base_offsets.front()) {
+        return std::nullopt;
     }
-    if (std::distance(begin, it) > 0) {
-        it = std::prev(it);
+    // Last segment with a base offset not above `o`. The loop runs a fixed
+    // number of iterations for a given size and the select compiles to a
+    // conditional move, so the search doesn't stall on mispredicted branches.
+    size_t idx = 0;
+    size_t len = _base_offsets.size();
+    while (len > 1) {
+        const auto half = len / 2;
+        idx = _base_offsets[idx + half] <= o ? idx + half : idx;
+        len -= half;
     }
-    if (needle_in_range<Iterator>()(it, needle)) {
-        return it;
+    // Offsets are inclusive and segments don't overlap, so `o` can only be in
+    // this segment, unless it is past its end or the segment is empty.
+    const auto& s = *_handles[idx];
+    if (s.empty() || o > s.offsets().get_dirty_offset()) {
+        return std::nullopt;
     }
-    return end;
+    return idx;
 }
 
-/// lower_bound returns the element that is _strictly_ greater than or equal
-/// to bucket->dirty_offset() - see comparator above because our offsets are
-/// _inclusive_ we must check the previous iterator in the case that we are at
-/// the end, we also check the last element.
 segment_set::iterator segment_set::lower_bound(model::offset offset) {
-    return segments_lower_bound(
-      std::begin(_handles), std::end(_handles), offset);
+    auto idx = find_offset(offset);
+    return idx ? std::next(_handles.begin(), *idx) : _handles.end();
 }
 
 segment_set::const_iterator
 segment_set::lower_bound(model::offset offset) const {
-    return segments_lower_bound(
-      std::cbegin(_handles), std::cend(_handles), offset);
+    auto idx = find_offset(offset);
+    return idx ? std::next(_handles.cbegin(), *idx) : _handles.cend();
 }
 // Lower bound for timestamp based indexing
 //
@@ -428,10 +428,13 @@ static ss::future<segment_set::underlying_t> open_segments(
                     return ss::now();
                 }
                 /*
-                 * Skip non-regular files (including links)
+                 * Skip non-regular files. Links are kept: segments demoted
+                 * to the cold data directory are reached through one.
                  */
                 if (
-                  !seg.type || *seg.type != ss::directory_entry_type::regular) {
+                  !seg.type
+                  || (*seg.type != ss::directory_entry_type::regular
+                      && *seg.type != ss::directory_entry_type::link)) {
                     return ss::make_ready_future<>();
                 }
 
@@ -21,6 +21,7 @@
 #include <seastar/core/sharded.hh>
 
 #include <deque>
+#include <optional>
 
 namespace storage {
 /*
@@ -89,7 +90,15 @@ public:
     const_iterator end() const { return _handles.end(); }
 
 private:
+    /// Index of the segment that `o` falls in, if any
+    std::optional<size_t> find_offset(model::offset o) const;
+
     underlying_t _handles;
+    // Base offsets of the segments in `_handles`, at the same positions. Base
+    // offsets never change once a segment is created, so offset lookups can
+    // search this contiguous array instead of chasing a pointer to every
+    // segment they visit, which matters for logs with many segments.
+    ss::circular_buffer<model::offset> _base_offsets;
 
     friend std::ostream& operator<<(std::ostream&, const segment_set&);
 };
@@ -23,6 +23,7 @@
 #include "ssx/future-util.h"
 #include "storage/chunk_cache.h"
 #include "storage/compacted_index.h"
+#include "storage/compacted_index_run_merger.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
 #include "storage/file_sanitizer.h"
@@ -42,6 +43,7 @@
 #include <seastar/core/do_with.hh>
 #include <seastar/core/file-types.hh>
 #include <seastar/core/file.hh>
+#include <seastar/core/fstream.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/reactor.hh>
@@ -58,7 +60,9 @@
 #include <fmt/format.h>
 #include <roaring/roaring.hh>
 
+#include <filesystem>
 #include <optional>
+#include <system_error>
 
 namespace storage::internal {
 using namespace storage; // NOLINT
@@ -271,13 +275,41 @@ ss::future<> copy_filtered_entries(
       });
 }
 
+/// Merges the sorted runs of the index when there are few enough of them,
+/// which is exact however many keys there are. Falls back to the reducer,
+/// which has to keep some duplicates once its map is full.
+static ss::future<roaring::Roaring> entries_to_keep(
+  compacted_index_reader reader, const compaction_config& cfg) {
+    auto footer = co_await reader.load_footer();
+    auto f = co_await make_reader_handle(reader.path(), cfg.sanitizer_config);
+    std::optional<roaring::Roaring> merged;
+    std::exception_ptr ex;
+    try {
+        merged = co_await merge_entries_to_keep(
+          f,
+          footer.size,
+          cfg.iopc,
+          compaction_key_reducer::default_max_memory_usage);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    if (merged) {
+        co_return std::move(*merged);
+    }
+    co_return co_await natural_index_of_entries_to_keep(reader);
+}
+
 static ss::future<> do_write_clean_compacted_index(
   compacted_index_reader reader,
   compaction_config cfg,
   storage_resources& resources) {
     const auto tmpname = std::filesystem::path(
       fmt::format("{}.staging", reader.path()));
-    auto bitmap = co_await natural_index_of_entries_to_keep(reader);
+    auto bitmap = co_await entries_to_keep(reader, cfg);
     auto staging_to_clean = scoped_file_tracker{
       cfg.files_to_cleanup, {tmpname}};
     auto truncating_writer = make_file_backed_compacted_index(
@@ -484,7 +516,13 @@ ss::future<> do_swap_data_file_handles(
       "swapping compacted segment temp file {} with the segment {}",
       old_name,
       s->reader().filename());
+    // the compacted file replaces the symbolic link of a demoted segment, so
+    // the copy in the cold data directory has to go with it
+    auto cold_target = co_await cold_segment_target(s->reader().path());
     co_await ss::rename_file(old_name, s->reader().filename());
+    if (cold_target.has_value()) {
+        co_await ss::remove_file(cold_target->string());
+    }
     // the on disk file is changing so clear the size cache
     s->clear_cached_disk_usage();
 
@@ -492,7 +530,8 @@ ss::future<> do_swap_data_file_handles(
       s->reader().path(),
       config::shard_local_cfg().storage_read_buffer_size(),
       config::shard_local_cfg().storage_read_readahead_count(),
-      cfg.sanitizer_config);
+      cfg.sanitizer_config,
+      s->reader().resources());
     co_await r->load_size();
 
     // update partition size probe
@@ -501,6 +540,64 @@ ss::future<> do_swap_data_file_handles(
     pb.add_initial_segment(*s.get());
 }
 
+ss::future<std::optional<std::filesystem::path>>
+cold_segment_target(const std::filesystem::path& path) {
+    auto type = co_await ss::file_type(path.string(), ss::follow_symlink::no);
+    if (type != ss::directory_entry_type::link) {
+        co_return std::nullopt;
+    }
+    std::error_code ec;
+    auto target = std::filesystem::read_symlink(path, ec);
+    if (ec) {
+        throw std::filesystem::filesystem_error(
+          "Unable to read segment link", path, ec);
+    }
+    co_return target;
+}
+
+ss::future<> demote_segment_file(
+  const std::filesystem::path& path,
+  const std::filesystem::path& cold_path,
+  ss::io_priority_class iopc) {
+    co_await ss::recursive_touch_directory(cold_path.parent_path().string());
+
+    // copy to a staging name first so that a crash never leaves a partial
+    // file under the name a link may point to
+    const auto cold_staging = std::filesystem::path(
+      fmt::format("{}.staging", cold_path.string()));
+    auto src = co_await ss::open_file_dma(path.string(), ss::open_flags::ro);
+    auto dst = co_await ss::open_file_dma(
+      cold_staging.string(),
+      ss::open_flags::create | ss::open_flags::truncate | ss::open_flags::wo);
+    ss::file_input_stream_options in_opts;
+    in_opts.io_priority_class = iopc;
+    ss::file_output_stream_options out_opts;
+    out_opts.io_priority_class = iopc;
+    auto in = ss::make_file_input_stream(std::move(src), in_opts);
+    auto out = co_await ss::make_file_output_stream(std::move(dst), out_opts);
+    co_await ss::copy(in, out)
+      .then([&out] { return out.flush(); })
+      .finally([&in, &out] {
+          return in.close().finally([&out] { return out.close(); });
+      });
+    co_await ss::rename_file(cold_staging.string(), cold_path.string());
+    co_await ss::sync_directory(cold_path.parent_path().string());
+
+    // rename the new link over the data file so that the segment is reachable
+    // under its name at every point in time
+    const auto link_staging = std::filesystem::path(
+      fmt::format("{}.cold_link", path.string()));
+    std::error_code ec;
+    std::filesystem::remove(link_staging, ec);
+    std::filesystem::create_symlink(cold_path, link_staging, ec);
+    if (ec) {
+        throw std::filesystem::filesystem_error(
+          "Unable to link demoted segment", cold_path, link_staging, ec);
+    }
+    co_await ss::rename_file(link_staging.string(), path.string());
+    co_await ss::sync_directory(path.parent_path().string());
+}
+
 /**
  * Executes segment compaction, returns size of compacted segment or an empty
  * optional if segment wasn't compacted
@@ -794,7 +891,8 @@ make_concatenated_segment(
       path,
       config::shard_local_cfg().storage_read_buffer_size(),
       config::shard_local_cfg().storage_read_readahead_count(),
-      cfg.sanitizer_config);
+      cfg.sanitizer_config,
+      &resources);
     co_await reader->load_size();
 
     // build an empty index for the segment
@@ -1039,6 +1137,12 @@ bytes clean_segment_key(model::ntp ntp) {
     return iobuf_to_bytes(buf);
 }
 
+bytes scrub_checkpoint_key() {
+    iobuf buf;
+    reflection::serialize(buf, kvstore_key_type::scrub_checkpoint);
+    return iobuf_to_bytes(buf);
+}
+
 offset_delta_time should_apply_delta_time_offset(
   ss::sharded<features::feature_table>& feature_table) {
     return offset_delta_time{
@@ -190,6 +190,20 @@ ss::future<> do_swap_data_file_handles(
   storage::compaction_config,
   probe&);
 
+/// If the segment data file at `path` is a symbolic link left behind by
+/// demote_segment_file, returns the file in the cold data directory it points
+/// to.
+ss::future<std::optional<std::filesystem::path>>
+cold_segment_target(const std::filesystem::path& path);
+
+/// Copies the data file of a closed segment to `cold_path` and atomically
+/// replaces the original with a symbolic link to the copy. Readers that have
+/// the file open keep reading the original inode until they close it.
+ss::future<> demote_segment_file(
+  const std::filesystem::path& path,
+  const std::filesystem::path& cold_path,
+  ss::io_priority_class iopc);
+
 // Generates a random jitter percentage [as a fraction] with in the passed
 // percents range.
 float random_jitter(jitter_percents);
@@ -198,10 +212,13 @@ float random_jitter(jitter_percents);
 enum class kvstore_key_type : int8_t {
     start_offset = 0,
     clean_segment = 1,
+    scrub_checkpoint = 2,
 };
 
 bytes start_offset_key(model::ntp ntp);
 bytes clean_segment_key(model::ntp ntp);
+// one per shard, not per ntp
+bytes scrub_checkpoint_key();
 
 struct clean_segment_value
   : serde::envelope<
@@ -211,6 +228,17 @@ struct clean_segment_value
     ss::sstring segment_name;
 };
 
+// The last log of the current local scrubbing pass that has been scrubbed.
+// Logs are scrubbed in ntp order, so a pass interrupted by a restart resumes
+// after it.
+struct scrub_checkpoint_value
+  : serde::envelope<
+      scrub_checkpoint_value,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::ntp ntp;
+};
+
 inline bool
 is_compactible_control_batch(const model::record_batch_type batch_type) {
     // Control batches in consumer offsets are special compared to
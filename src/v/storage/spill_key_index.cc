@@ -26,6 +26,7 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <exception>
 using namespace std::chrono_literals;
 
@@ -108,36 +109,34 @@ ss::future<> spill_key_index::add_key(compaction_key b, value_type v) {
     if (
       (take_result.checkpoint_hint && expected_size > min_index_size)
       || expected_size >= _max_mem) {
-        f = ss::do_until(
-          [this, entry_size, min_index_size] {
-              size_t total_mem = idx_mem_usage() + _keys_mem_usage + entry_size;
-
-              // Instance-local capacity check
-              bool local_ok = total_mem < _max_mem;
-
-              // Shard-wide capacity check
-              bool global_ok = _resources.compaction_index_bytes_available()
-                               || total_mem < min_index_size;
-
-              // Stop condition: none of our size thresholds must be violated
-              return _midx.empty() || (local_ok && global_ok);
-          },
-          [this] {
-              /**
-               * Evict first entry, we use hash function that guarante good
-               * randomness so evicting first entry is actually evicting a
-               * pseudo random elemnent
-               */
-              auto node = _midx.extract(_midx.begin());
-
-              return ss::do_with(
-                node.key(),
-                node.mapped(),
-                [this](const bytes& k, value_type o) {
-                    release_entry_memory(k);
-                    return spill(compacted_index::entry_type::key, k, o);
-                });
-          });
+        // Spill in bulk, down to half of the budget, so that every spill is a
+        // sorted run long enough for readers to merge cheaply.
+        const size_t spill_target = _max_mem / 2;
+        spill_run_t run;
+        while (!_midx.empty()) {
+            size_t total_mem = idx_mem_usage() + _keys_mem_usage + entry_size;
+
+            // Instance-local capacity check
+            bool local_ok = total_mem < spill_target;
+
+            // Shard-wide capacity check
+            bool global_ok = _resources.compaction_index_bytes_available()
+                             || total_mem < min_index_size;
+
+            // Stop condition: none of our size thresholds must be violated
+            if (local_ok && global_ok) {
+                break;
+            }
+            /**
+             * Evict first entry, we use hash function that guarante good
+             * randomness so evicting first entry is actually evicting a
+             * pseudo random elemnent
+             */
+            auto node = _midx.extract(_midx.begin());
+            release_entry_memory(node.key());
+            run.emplace_back(std::move(node.key()), node.mapped());
+        }
+        f = spill_run(std::move(run));
     }
 
     return f.then([this, entry_size, b = std::move(b), v]() mutable {
@@ -254,20 +253,24 @@ ss::future<> spill_key_index::append(compacted_index::entry e) {
     });
 }
 
+ss::future<> spill_key_index::spill_run(spill_run_t run) {
+    std::sort(run.begin(), run.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (const auto& [k, v] : run) {
+        co_await spill(compacted_index::entry_type::key, k, v);
+    }
+}
+
 ss::future<> spill_key_index::drain_all_keys() {
-    return ss::do_until(
-      [this] {
-          // stop condition
-          return _midx.empty();
-      },
-      [this] {
-          auto node = _midx.extract(_midx.begin());
-          release_entry_memory(node.key());
-          return ss::do_with(
-            node.key(), node.mapped(), [this](const bytes& k, value_type o) {
-                return spill(compacted_index::entry_type::key, k, o);
-            });
-      });
+    spill_run_t run;
+    run.reserve(_midx.size());
+    while (!_midx.empty()) {
+        auto node = _midx.extract(_midx.begin());
+        release_entry_memory(node.key());
+        run.emplace_back(std::move(node.key()), node.mapped());
+    }
+    return spill_run(std::move(run));
 }
 
 void spill_key_index::set_flag(compacted_index::footer_flags f) {
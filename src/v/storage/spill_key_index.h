@@ -28,6 +28,10 @@
 
 #include <absl/container/node_hash_map.h>
 #include <absl/hash/hash.h>
+
+#include <utility>
+#include <vector>
+
 namespace storage::internal {
 using namespace storage; // NOLINT
 class spill_key_index final : public compacted_index_writer::impl {
@@ -117,7 +121,11 @@ private:
 
     ss::future<> maybe_open();
     ss::future<> open();
+    /// Entries evicted from the map together, spilled sorted by key
+    using spill_run_t = std::vector<std::pair<compaction_key, value_type>>;
+
     ss::future<> drain_all_keys();
+    ss::future<> spill_run(spill_run_t);
     ss::future<> add_key(compaction_key, value_type);
     ss::future<> spill(compacted_index::entry_type, bytes_view, value_type);
 
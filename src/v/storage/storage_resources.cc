@@ -33,6 +33,8 @@ storage_resources::storage_resources(
   , _global_target_replay_bytes(target_replay_bytes)
   , _max_concurrent_replay(max_concurrent_replay)
   , _compaction_index_mem_limit(compaction_index_memory)
+  , _read_ahead_mem_limit(
+      config::shard_local_cfg().storage_read_readahead_memory.bind())
   , _append_chunk_size(internal::chunks().chunk_size())
   , _offset_translator_dirty_bytes(
       _global_target_replay_bytes() / ss::smp::count)
@@ -40,10 +42,16 @@ storage_resources::storage_resources(
       _global_target_replay_bytes() / ss::smp::count)
   , _stm_dirty_bytes(_global_target_replay_bytes() / ss::smp::count)
   , _compaction_index_bytes(_compaction_index_mem_limit())
-  , _inflight_recovery(
+  , _recovery_scheduler(
       std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
   , _inflight_close_flush(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1})) {
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+  , _read_ahead_bytes(_read_ahead_mem_limit())
+  , _segment_index_budget(
+      config::shard_local_cfg().storage_segment_index_memory.bind(),
+      config::shard_local_cfg().storage_segment_index_page_cache_memory.bind())
+  , _flush_coordinator(
+      config::shard_local_cfg().storage_flush_coalesce_window_us.bind()) {
     // Register notifications on configuration changes
     _global_target_replay_bytes.watch([this]() {
         auto v = per_shard_target_replay_bytes(_global_target_replay_bytes());
@@ -61,13 +69,16 @@ storage_resources::storage_resources(
         // total concurrent replay count.
         v = std::max(v, uint64_t{1});
 
-        _inflight_recovery.set_capacity(v);
+        _recovery_scheduler.set_capacity(v);
         _inflight_close_flush.set_capacity(v);
     });
 
     _compaction_index_mem_limit.watch([this] {
         _compaction_index_bytes.set_capacity(_compaction_index_mem_limit());
     });
+    _read_ahead_mem_limit.watch([this] {
+        _read_ahead_bytes.set_capacity(_read_ahead_mem_limit());
+    });
 }
 
 // Unit test convenience for tests that want to control the falloc step
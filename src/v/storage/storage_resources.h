@@ -14,6 +14,9 @@
 #include "base/units.h"
 #include "config/property.h"
 #include "ssx/semaphore.h"
+#include "storage/flush_coordinator.h"
+#include "storage/recovery_scheduler.h"
+#include "storage/segment_index_budget.h"
 #include "utils/adjustable_semaphore.h"
 
 #include <cstdint>
@@ -71,18 +74,40 @@ public:
         return _compaction_index_bytes.current() > 0;
     }
 
-    ss::future<ssx::semaphore_units> get_recovery_units() {
-        return _inflight_recovery.get_units(1);
+    ss::future<recovery_scheduler::permit>
+    get_recovery_units(recovery_priority p) {
+        return _recovery_scheduler.admit(p);
+    }
+
+    recovery_progress get_recovery_progress() const {
+        return _recovery_scheduler.progress();
     }
 
     ss::future<ssx::semaphore_units> get_close_flush_units() {
         return _inflight_close_flush.get_units(1);
     }
 
+    /**
+     * Try to reserve memory for the read-ahead buffers of a segment reader
+     * stream. Never waits: a reader that doesn't fit reads without it.
+     */
+    std::optional<ssx::semaphore_units>
+    read_ahead_try_take_bytes(size_t bytes) {
+        return _read_ahead_bytes.try_get_units(bytes);
+    }
+
     ss::future<ssx::semaphore_units> get_compaction_compression_units() {
         return _inflight_compaction_compression.get_units(1);
     }
 
+    storage::segment_index_budget& segment_index_budget() {
+        return _segment_index_budget;
+    }
+
+    storage::flush_coordinator& flush_coordinator() {
+        return _flush_coordinator;
+    }
+
     /**
      * An adjustable_semaphore will set checkpoint_hint whenever its units
      * are exhausted, but this can happen with pathological frequency if
@@ -111,6 +136,7 @@ private:
     config::binding<uint64_t> _global_target_replay_bytes;
     config::binding<uint64_t> _max_concurrent_replay;
     config::binding<uint64_t> _compaction_index_mem_limit;
+    config::binding<size_t> _read_ahead_mem_limit;
     size_t _append_chunk_size;
 
     // A lower bound on how many units a caller must have to be
@@ -145,8 +171,8 @@ private:
     adjustable_semaphore _compaction_index_bytes{0};
 
     // How many logs may be recovered (via log_manager::manage)
-    // concurrently?
-    adjustable_semaphore _inflight_recovery{0};
+    // concurrently, and in which order?
+    storage::recovery_scheduler _recovery_scheduler{1};
 
     // How many logs may be flushed during segment close concurrently?
     // (e.g. when we shut down and ask everyone to flush)
@@ -156,6 +182,16 @@ private:
     // memory footprint compared with the batch's original size, we must
     // limit how many of these we do in parallel.
     adjustable_semaphore _inflight_compaction_compression{1};
+
+    // How much memory may segment reader streams on this shard hold in
+    // read-ahead buffers?
+    adjustable_semaphore _read_ahead_bytes{0};
+
+    // Memory limit for the indices of segments that are no longer appended
+    // to, see segment_index_budget.
+    storage::segment_index_budget _segment_index_budget;
+
+    storage::flush_coordinator _flush_coordinator;
 };
 
 } // namespace storage
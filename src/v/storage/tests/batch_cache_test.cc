@@ -52,7 +52,7 @@ public:
     batch_cache_test_fixture()
       : cache(opts) {}
 
-    auto& get_lru() { return cache._lru; };
+    auto& get_lru() { return cache._small; };
     ~batch_cache_test_fixture() { cache.stop().get(); }
 
     storage::batch_cache cache;
@@ -171,6 +171,39 @@ SEASTAR_THREAD_TEST_CASE(touch) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(scan_resistance) {
+    static storage::batch_cache::reclaim_options opts = {
+      .growth_window = std::chrono::milliseconds(3000),
+      .stable_window = std::chrono::milliseconds(10000),
+      .min_size = 1,
+      .max_size = 1,
+    };
+    storage::batch_cache cache(opts);
+    auto stop = ss::defer([&cache] { cache.stop().get(); });
+    storage::batch_cache_index index(cache);
+
+    // a range read by a tailing consumer
+    auto hot = cache.put(index, make_batch(10), is_dirty_entry::no);
+    cache.touch(hot.range());
+
+    // followed by a scan that reads each range once
+    std::vector<storage::batch_cache::entry> scan;
+    for (int i = 0; i < 20; ++i) {
+        auto batch = make_random_batch(40_KiB, model::offset(i + 1));
+        scan.push_back(cache.put(index, batch, is_dirty_entry::no));
+    }
+
+    // an lru would evict the hot range first since every scanned range was
+    // inserted after it was last used.
+    for (size_t i = 0; i < scan.size(); ++i) {
+        cache.reclaim(1);
+    }
+    BOOST_CHECK(hot.range());
+    for (auto& e : scan) {
+        BOOST_CHECK(!e.range());
+    }
+}
+
 FIXTURE_TEST(index_get_empty, batch_cache_test_fixture) {
     storage::batch_cache_index index(cache);
 
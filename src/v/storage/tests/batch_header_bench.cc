@@ -0,0 +1,121 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "model/record.h"
+#include "model/record_utils.h"
+#include "model/tests/random_batch.h"
+#include "storage/parser.h"
+#include "storage/record_batch_utils.h"
+#include "storage/segment_reader.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <array>
+
+namespace {
+
+/*
+ * Consumer that accepts every batch and discards the records, so the parser
+ * benchmark measures header decoding, validation and stream handling only.
+ */
+class counting_consumer final : public storage::batch_consumer {
+public:
+    consume_result
+    accept_batch_start(const model::record_batch_header&) const override {
+        return consume_result::accept_batch;
+    }
+    void consume_batch_start(
+      model::record_batch_header, size_t, size_t) override {}
+    void skip_batch_start(model::record_batch_header, size_t, size_t) override {
+    }
+    void consume_records(iobuf&&) override {}
+    ss::future<stop_parser> consume_batch_end() override {
+        return ss::make_ready_future<stop_parser>(stop_parser::no);
+    }
+    void print(std::ostream& os) const override { os << "counting_consumer"; }
+};
+
+} // namespace
+
+class batch_header_bench {
+public:
+    static constexpr int num_batches = 1000;
+
+    batch_header_bench() {
+        auto batches = model::test::make_random_batches(
+                         model::test::record_batch_spec{
+                           .offset = model::offset(0),
+                           .allow_compression = false,
+                           .count = num_batches,
+                           .records = 1})
+                         .get();
+        for (auto& b : batches) {
+            auto hdr = storage::batch_header_to_disk_iobuf(b.header());
+            segment.append(hdr.copy());
+            segment.append(b.data().copy());
+            headers.push_back(std::move(hdr));
+        }
+    }
+
+    // Field by field decoding from an iobuf followed by the per-field crc.
+    size_t decode_per_field() {
+        perf_tests::start_measuring_time();
+        for (const auto& h : headers) {
+            auto hdr = storage::batch_header_from_disk_iobuf(h.copy());
+            perf_tests::do_not_optimize(model::internal_header_only_crc(hdr));
+        }
+        perf_tests::stop_measuring_time();
+        return headers.size();
+    }
+
+    // Fixed-offset decoding and a single crc over the raw bytes.
+    size_t decode_fixed_offset() {
+        perf_tests::start_measuring_time();
+        for (const auto& h : headers) {
+            std::array<char, model::packed_record_batch_header_size> raw;
+            iobuf::iterator_consumer in(h.cbegin(), h.cend());
+            in.consume_to(raw.size(), raw.data());
+            auto hdr = storage::batch_header_from_disk_bytes(raw.data());
+            perf_tests::do_not_optimize(hdr);
+            perf_tests::do_not_optimize(
+              storage::header_only_crc_from_disk_bytes(raw.data()));
+        }
+        perf_tests::stop_measuring_time();
+        return headers.size();
+    }
+
+    // End to end parse of a segment-like buffer of consecutive batches.
+    ss::future<size_t> parse() {
+        storage::continuous_batch_parser parser(
+          std::make_unique<counting_consumer>(),
+          storage::segment_reader_handle(
+            make_iobuf_input_stream(segment.copy())));
+        perf_tests::start_measuring_time();
+        auto res = co_await parser.consume();
+        perf_tests::stop_measuring_time();
+        co_await parser.close();
+        vassert(res.has_value(), "parse failed: {}", res.error());
+        co_return num_batches;
+    }
+
+private:
+    std::vector<iobuf> headers;
+    iobuf segment;
+};
+
+PERF_TEST_F(batch_header_bench, decode_per_field) { return decode_per_field(); }
+
+PERF_TEST_F(batch_header_bench, decode_fixed_offset) {
+    return decode_fixed_offset();
+}
+
+PERF_TEST_F(batch_header_bench, parse) { return parse(); }
@@ -260,6 +260,33 @@ TEST_F(CompactionFixtureTest, TestDedupeMultiPass) {
     ASSERT_NO_FATAL_FAILURE(check_records(cardinality, num_segments - 1).get());
 }
 
+// Test that rewriting several segments of the window concurrently yields the
+// same result as the sequential rewrite.
+TEST_F(CompactionFixtureTest, TestDedupeParallelRewrite) {
+    test_local_cfg.get("log_compaction_rewrite_parallelism")
+      .set_value(size_t{4});
+    constexpr auto num_segments = 10;
+    constexpr auto total_records = 100;
+    constexpr auto cardinality = 10;
+    size_t records_per_segment = total_records / num_segments;
+    generate_data(num_segments, cardinality, records_per_segment).get();
+
+    ss::abort_source never_abort;
+    auto& disk_log = dynamic_cast<storage::disk_log_impl&>(*log);
+    storage::compaction_config cfg(
+      disk_log.segments().back()->offsets().get_base_offset(),
+      ss::default_priority_class(),
+      never_abort,
+      std::nullopt,
+      cardinality);
+    disk_log.sliding_window_compact(cfg).get();
+
+    ASSERT_EQ(num_segments, log->segment_count() - 1);
+    auto summary_after = dir_summary().get();
+    ASSERT_NO_FATAL_FAILURE(summary_after.check_clean(num_segments));
+    ASSERT_NO_FATAL_FAILURE(check_records(cardinality, num_segments - 1).get());
+}
+
 class CompactionFixtureBatchSizeParamTest
   : public CompactionFixtureTest
   , public ::testing::WithParamInterface<size_t> {};
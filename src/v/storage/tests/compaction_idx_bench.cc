@@ -7,12 +7,15 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "bytes/random.h"
 #include "model/fundamental.h"
 #include "random/generators.h"
 #include "storage/compacted_index.h"
 #include "storage/compaction_reducers.h"
+#include "storage/key_offset_map.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/testing/perf_tests.hh>
@@ -41,3 +44,62 @@ PERF_TEST_F(reducer_bench, compaction_key_reducer_test) {
         perf_tests::stop_measuring_time();
     });
 }
+
+/*
+ * Compares the key-offset maps used by sliding window compaction. Each
+ * iteration inserts (or looks up) a fixed set of keys in a map sized to the
+ * same memory budget, so the results reflect both probe cost and how well
+ * each layout copes with the resulting load factor.
+ */
+template<typename Map>
+class key_offset_map_bench {
+public:
+    static constexpr size_t memory = 16_MiB;
+    static constexpr size_t num_keys = 200'000;
+
+    key_offset_map_bench() {
+        map.initialize(memory).get();
+        keys.reserve(num_keys);
+        for (size_t i = 0; i < num_keys; ++i) {
+            keys.emplace_back(random_generators::get_bytes(20));
+        }
+    }
+
+    ss::future<size_t> put_all() {
+        co_await map.reset();
+        perf_tests::start_measuring_time();
+        model::offset o{0};
+        for (const auto& key : keys) {
+            co_await map.put(key, o++);
+        }
+        perf_tests::stop_measuring_time();
+        co_return keys.size();
+    }
+
+    ss::future<size_t> get_all() {
+        if (map.size() == 0) {
+            model::offset o{0};
+            for (const auto& key : keys) {
+                co_await map.put(key, o++);
+            }
+        }
+        perf_tests::start_measuring_time();
+        for (const auto& key : keys) {
+            perf_tests::do_not_optimize(co_await map.get(key));
+        }
+        perf_tests::stop_measuring_time();
+        co_return keys.size();
+    }
+
+    Map map;
+    std::vector<storage::compaction_key> keys;
+};
+
+using hash_map_bench = key_offset_map_bench<storage::hash_key_offset_map>;
+using bucketed_map_bench
+  = key_offset_map_bench<storage::bucketed_hash_key_offset_map>;
+
+PERF_TEST_F(hash_map_bench, put) { return put_all(); }
+PERF_TEST_F(hash_map_bench, get) { return get_all(); }
+PERF_TEST_F(bucketed_map_bench, put) { return put_all(); }
+PERF_TEST_F(bucketed_map_bench, get) { return get_all(); }
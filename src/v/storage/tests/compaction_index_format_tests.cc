@@ -16,6 +16,7 @@
 #include "reflection/adl.h"
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_reader.h"
+#include "storage/compacted_index_run_merger.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
 #include "storage/fs_utils.h"
@@ -358,6 +359,59 @@ FIXTURE_TEST(index_filtered_copy_tests, compacted_topic_fixture) {
     }
 }
 
+FIXTURE_TEST(merge_sorted_runs, compacted_topic_fixture) {
+    tmpbuf_file::store_t index_data;
+    // small enough for the keys to be spilled in many sorted runs
+    auto idx = make_dummy_compacted_index(index_data, 16_KiB, resources);
+
+    constexpr int distinct_keys = 2000;
+    std::vector<bytes> keys;
+    keys.reserve(distinct_keys);
+    for (int i = 0; i < distinct_keys; ++i) {
+        keys.push_back(random_generators::get_bytes(32));
+    }
+    auto bt = tests::random_batch_type();
+    for (int i = 0; i < 5 * distinct_keys; ++i) {
+        const auto& key = keys[random_generators::get_int(distinct_keys - 1)];
+        idx.index(bt, false, bytes(key), model::offset(i), 0).get();
+    }
+    idx.close().get();
+
+    auto rdr = storage::make_file_backed_compacted_reader(
+      storage::segment_full_path::mock("dummy name"),
+      ss::file(ss::make_shared(tmpbuf_file(index_data))),
+      ss::default_priority_class(),
+      32_KiB);
+    rdr.verify_integrity().get();
+    auto footer = rdr.load_footer().get();
+
+    // enough memory for the reducer to be exact
+    rdr.reset();
+    auto expected = rdr
+                      .consume(
+                        storage::internal::compaction_key_reducer(64_MiB),
+                        model::no_timeout)
+                      .get();
+
+    auto merged = storage::internal::merge_entries_to_keep(
+                    ss::file(ss::make_shared(tmpbuf_file(index_data))),
+                    footer.size,
+                    ss::default_priority_class(),
+                    1_MiB)
+                    .get();
+    BOOST_REQUIRE(merged.has_value());
+    BOOST_REQUIRE(merged.value() == expected);
+
+    // not enough memory to merge the runs
+    auto too_many_runs = storage::internal::merge_entries_to_keep(
+                           ss::file(ss::make_shared(tmpbuf_file(index_data))),
+                           footer.size,
+                           ss::default_priority_class(),
+                           4_KiB)
+                           .get();
+    BOOST_REQUIRE(!too_many_runs.has_value());
+}
+
 namespace storage {
 
 struct index_footer_v1 {
@@ -7,6 +7,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstring>
+
 static storage::index_state make_random_index_state(
   storage::offset_delta_time apply_offset = storage::offset_delta_time::yes) {
     auto st = storage::index_state::make_empty_index(apply_offset);
@@ -24,6 +26,25 @@ static storage::index_state make_random_index_state(
             st.broker_timestamp = model::timestamp(
               random_generators::get_int<int64_t>());
         }
+        const auto gaps = random_generators::get_int(0, 10);
+        for (auto i = 0; i < gaps; ++i) {
+            auto base = model::offset(random_generators::get_int<int64_t>());
+            st.add_translator_gap(base, base);
+        }
+        const auto timed = random_generators::get_int(0, 100);
+        for (auto i = 0; i < timed; ++i) {
+            st.batch_time_index->push_back(storage::batch_time_entry{
+              .relative_offset = random_generators::get_int<uint32_t>(),
+              .relative_first_timestamp = random_generators::get_int<uint32_t>(),
+              .relative_max_timestamp = random_generators::get_int<uint32_t>(),
+              .position = random_generators::get_int<uint64_t>(),
+              .follows_previous = random_generators::get_int(0, 1) == 1,
+            });
+        }
+    } else {
+        // older indices didn't track them
+        st.translator_gaps = std::nullopt;
+        st.batch_time_index = std::nullopt;
     }
 
     const auto n = random_generators::get_int(1, 10000);
@@ -37,7 +58,7 @@ static storage::index_state make_random_index_state(
     }
 
     if (apply_offset == storage::offset_delta_time::no) {
-        fragmented_vector<uint32_t> time_index;
+        chunked_vector<uint32_t> time_index;
         for (auto i = 0; i < n; ++i) {
             time_index.push_back(random_generators::get_int<uint32_t>());
         }
@@ -244,3 +265,176 @@ BOOST_AUTO_TEST_CASE(offset_time_index_test) {
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(small_index_memory_footprint) {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    BOOST_REQUIRE_EQUAL(st.memory_size(), 0);
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        st.add_entry(
+          i,
+          storage::offset_time_index{
+            model::timestamp{i}, storage::offset_delta_time::yes},
+          i * 4096);
+    }
+    st.shrink_to_fit();
+
+    // a handful of entries must not pin a full fragment per column
+    BOOST_REQUIRE_LT(st.memory_size(), 1024);
+
+    // decoded indices are sized exactly to their contents
+    auto output = serde::from_iobuf<storage::index_state>(
+      serde::to_iobuf(st.copy()));
+    BOOST_REQUIRE_EQUAL(output, st);
+    BOOST_REQUIRE_LT(output.memory_size(), 1024);
+}
+
+BOOST_AUTO_TEST_CASE(find_entry_past_end) {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    for (uint32_t i = 0; i < 10; ++i) {
+        st.add_entry(
+          i * 10,
+          storage::offset_time_index{
+            model::timestamp{i * 100}, storage::offset_delta_time::yes},
+          i * 4096);
+    }
+
+    BOOST_REQUIRE(!st.find_entry(model::timestamp{10000}).has_value());
+
+    auto e = st.find_entry(model::timestamp{250});
+    BOOST_REQUIRE(e.has_value());
+    BOOST_REQUIRE_EQUAL(std::get<0>(*e), 20);
+}
+
+BOOST_AUTO_TEST_CASE(find_batch_time) {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    st.base_offset = model::offset(100);
+
+    // ten batches of ten records, 1000 bytes each, with record timestamps
+    // [1000 * i, 1000 * i + 900]. with a step of 2500 bytes every third batch
+    // is indexed
+    size_t acc = 0;
+    bool skipped = false;
+    for (int i = 0; i < 10; ++i) {
+        const auto base = model::offset(100 + i * 10);
+        const auto first = model::timestamp(1000 * i);
+        const auto last = model::timestamp(1000 * i + 900);
+        st.maybe_index(
+          1000,
+          32768,
+          i * 1000,
+          base,
+          model::offset(100 + i * 10 + 9),
+          first,
+          last,
+          std::nullopt,
+          true,
+          0);
+        acc += 1000;
+        if (st.maybe_index_batch_time(
+              acc, 2500, !skipped, i * 1000, base, first, last)) {
+            acc = 0;
+            skipped = false;
+        } else {
+            skipped = true;
+        }
+    }
+    // batches 0, 3, 6, 9
+    BOOST_REQUIRE_EQUAL(st.batch_time_index->size(), 4);
+
+    // before the first batch: answered by the first batch
+    auto m = st.find_batch_time(model::timestamp(-5));
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE(m->exact);
+    BOOST_REQUIRE_EQUAL(m->offset, model::offset(100));
+    BOOST_REQUIRE_EQUAL(m->timestamp, model::timestamp(0));
+
+    // inside of the first batch: start reading there
+    m = st.find_batch_time(model::timestamp(500));
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE(!m->exact);
+    BOOST_REQUIRE_EQUAL(m->offset, model::offset(100));
+
+    // batches 1 and 2 weren't indexed, start from batch 0
+    m = st.find_batch_time(model::timestamp(1500));
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE(!m->exact);
+    BOOST_REQUIRE_EQUAL(m->offset, model::offset(100));
+    BOOST_REQUIRE_EQUAL(m->position, 0);
+
+    // past the last indexed batch
+    BOOST_REQUIRE(!st.find_batch_time(model::timestamp(10000)).has_value());
+
+    // nothing left out before batch 4 when every batch is indexed
+    st.batch_time_index->clear();
+    acc = 0;
+    skipped = false;
+    for (int i = 0; i < 10; ++i) {
+        const auto base = model::offset(100 + i * 10);
+        acc += 1000;
+        BOOST_REQUIRE(st.maybe_index_batch_time(
+          acc,
+          0,
+          !skipped,
+          i * 1000,
+          base,
+          model::timestamp(1000 * i),
+          model::timestamp(1000 * i + 900)));
+        acc = 0;
+    }
+    m = st.find_batch_time(model::timestamp(3950));
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE(m->exact);
+    BOOST_REQUIRE_EQUAL(m->offset, model::offset(140));
+    BOOST_REQUIRE_EQUAL(m->timestamp, model::timestamp(4000));
+    BOOST_REQUIRE_EQUAL(m->position, 4000);
+
+    // truncation drops the entries of removed batches
+    st.truncate_batch_time_index(model::offset(139));
+    BOOST_REQUIRE_EQUAL(st.batch_time_index->size(), 4);
+    BOOST_REQUIRE(!st.find_batch_time(model::timestamp(3950)).has_value());
+
+    // not usable once batch timestamps go backwards
+    st.update_batch_timestamps_are_monotonic(false);
+    BOOST_REQUIRE(!st.find_batch_time(model::timestamp(-5)).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(serde_column_layout) {
+    for (int i = 0; i < 10; ++i) {
+        auto input = make_random_index_state();
+        const auto n = input.size();
+        const auto expected = input.copy();
+        const auto buf = iobuf_to_bytes(serde::to_iobuf(std::move(input)));
+        const auto layout = storage::index_state::column_layout::for_entries(n);
+
+        auto read_u32 = [&buf](size_t pos) {
+            uint32_t v = 0;
+            std::memcpy(&v, buf.data() + pos, sizeof(v));
+            return v;
+        };
+        auto read_u64 = [&buf](size_t pos) {
+            uint64_t v = 0;
+            std::memcpy(&v, buf.data() + pos, sizeof(v));
+            return v;
+        };
+
+        BOOST_REQUIRE_EQUAL(read_u32(layout.relative_offsets - 4), n);
+        BOOST_REQUIRE_EQUAL(read_u32(layout.relative_times - 4), n);
+        BOOST_REQUIRE_EQUAL(read_u32(layout.positions - 4), n);
+        BOOST_REQUIRE_LE(layout.positions + n * sizeof(uint64_t), buf.size());
+        for (size_t j = 0; j < n; j += 97) {
+            BOOST_REQUIRE_EQUAL(
+              read_u32(layout.relative_offsets + j * sizeof(uint32_t)),
+              expected.relative_offset_index[j]);
+            BOOST_REQUIRE_EQUAL(
+              read_u32(layout.relative_times + j * sizeof(uint32_t)),
+              expected.relative_time_index[j]);
+            BOOST_REQUIRE_EQUAL(
+              read_u64(layout.positions + j * sizeof(uint64_t)),
+              expected.position_index[j]);
+        }
+    }
+}
@@ -37,8 +37,16 @@ public:
     default_sized_hash_key_offset_map() { initialize(1_MiB).get(); }
 };
 
-using test_types = ::testing::
-  Types<storage::simple_key_offset_map, default_sized_hash_key_offset_map>;
+class default_sized_bucketed_hash_key_offset_map
+  : public storage::bucketed_hash_key_offset_map {
+public:
+    default_sized_bucketed_hash_key_offset_map() { initialize(1_MiB).get(); }
+};
+
+using test_types = ::testing::Types<
+  storage::simple_key_offset_map,
+  default_sized_hash_key_offset_map,
+  default_sized_bucketed_hash_key_offset_map>;
 
 TYPED_TEST_SUITE(KeyOffsetMapTest, test_types);
 
@@ -261,3 +269,34 @@ TEST(HashKeyOffsetMapTest, Initialize) {
         ASSERT_EQ(val.value(), model::offset(99));
     }
 }
+
+TEST(BucketedHashKeyOffsetMapTest, FitsMoreKeysPerByte) {
+    storage::hash_key_offset_map hash_map;
+    hash_map.initialize(1_MiB).get();
+    storage::bucketed_hash_key_offset_map bucketed_map;
+    bucketed_map.initialize(1_MiB).get();
+
+    // 16 bytes per slot compared to 40 for the full digest map
+    EXPECT_GE(bucketed_map.capacity(), 2 * hash_map.capacity());
+
+    // and the extra capacity is usable
+    size_t count = 0;
+    for (;; ++count) {
+        const auto key = fmt::format("key-{}", count);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        if (!bucketed_map.put(ck, model::offset(count)).get()) {
+            break;
+        }
+    }
+    EXPECT_EQ(count, bucketed_map.capacity());
+    for (size_t i = 0; i < count; ++i) {
+        const auto key = fmt::format("key-{}", i);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        const auto val = bucketed_map.get(ck).get();
+        ASSERT_TRUE(val.has_value());
+        ASSERT_EQ(val.value(), model::offset(i));
+    }
+    const auto missing = fmt::format("key-{}", count);
+    storage::compaction_key ck(bytes(missing.begin(), missing.end()));
+    EXPECT_EQ(bucketed_map.get(ck).get(), std::nullopt);
+}
@@ -37,6 +37,14 @@ public:
           _kv_config, ss::this_shard_id(), resources, _feature_table);
     }
 
+    std::unique_ptr<storage::kvstore>
+    make_kvstore(std::chrono::milliseconds commit_interval) {
+        auto cfg = _kv_config;
+        cfg.commit_interval = config::mock_binding(commit_interval);
+        return std::make_unique<storage::kvstore>(
+          std::move(cfg), ss::this_shard_id(), resources, _feature_table);
+    }
+
     ~kvstore_test_fixture() {
         _feature_table.stop().get();
         cleanup_store().get();
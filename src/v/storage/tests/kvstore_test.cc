@@ -16,6 +16,7 @@
 #include "test_utils/fixture.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/with_timeout.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/file.hh>
 
@@ -200,3 +201,36 @@ FIXTURE_TEST(kvstore, kvstore_test_fixture) {
     }
     kvs->stop().get();
 }
+
+FIXTURE_TEST(kvstore_consensus_flush_interval, kvstore_test_fixture) {
+    using namespace std::chrono_literals;
+    set_configuration("disable_metrics", true);
+    set_configuration("kvstore_consensus_flush_interval", 0ms);
+
+    // bulk writes are held back for a long time...
+    auto kvs = make_kvstore(1h);
+    kvs->start().get();
+
+    auto bulk = kvs->put(
+      storage::kvstore::key_space::offset_translator,
+      random_generators::get_bytes(10),
+      bytes_to_iobuf(random_generators::get_bytes(100)));
+
+    // ...but consensus writes are not
+    auto key = random_generators::get_bytes(10);
+    auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+    ss::with_timeout(
+      ss::lowres_clock::now() + 30s,
+      kvs->put(storage::kvstore::key_space::consensus, key, value.copy()))
+      .get();
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::consensus, key).value() == value);
+
+    // and the bulk write that was queued ahead of it went out in the same
+    // flush
+    BOOST_REQUIRE(bulk.available());
+    bulk.get();
+
+    kvs->stop().get();
+    set_configuration("kvstore_consensus_flush_interval", 10ms);
+}
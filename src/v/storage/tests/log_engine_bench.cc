@@ -0,0 +1,154 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "model/fundamental.h"
+#include "model/tests/random_batch.h"
+#include "storage/directories.h"
+#include "storage/mvlog/versioned_log.h"
+#include "storage/ntp_config.h"
+#include "storage/tests/utils/disk_log_builder.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+/*
+ * Runs the same workloads against the production disk_log_impl and the
+ * experimental mvlog::versioned_log, to compare the cost of an acks=all style
+ * append + flush and of prefix truncation between the two designs.
+ *
+ * Each engine is driven through the same small interface: append a batch,
+ * flush, roll the active segment, prefix truncate.
+ */
+namespace {
+
+constexpr int appends_per_run = 100;
+constexpr int segments_per_run = 20;
+
+class disk_log_engine {
+public:
+    disk_log_engine()
+      : _builder(storage::log_config(
+          storage::random_dir(), 128_MiB, ss::default_priority_class())) {
+        _builder.start().get();
+    }
+    disk_log_engine(const disk_log_engine&) = delete;
+    disk_log_engine& operator=(const disk_log_engine&) = delete;
+    ~disk_log_engine() { _builder.stop().get(); }
+
+    ss::future<> append(model::record_batch b) {
+        return _builder.add_batch(
+          std::move(b),
+          storage::append_config(),
+          storage::disk_log_builder::should_flush_after::no);
+    }
+    ss::future<> flush() { return _builder.get_log()->flush(); }
+    ss::future<> roll(model::offset base) { return _builder.add_segment(base); }
+    ss::future<> prefix_truncate(model::offset o) {
+        return _builder.get_log()->truncate_prefix(
+          storage::truncate_prefix_config(o, ss::default_priority_class()));
+    }
+
+private:
+    storage::disk_log_builder _builder;
+};
+
+class mvlog_engine {
+public:
+    mvlog_engine()
+      : _base_dir(storage::random_dir()) {
+        storage::directories::initialize(_base_dir).get();
+        auto overrides
+          = std::make_unique<storage::ntp_config::default_overrides>();
+        overrides->segment_size = 128_MiB;
+        // rolls are explicit, see roll()
+        overrides->segment_ms = tristate<std::chrono::milliseconds>{0ms};
+        storage::ntp_config cfg(
+          storage::log_builder_ntp(), _base_dir, std::move(overrides));
+        storage::directories::initialize(cfg.work_directory()).get();
+        _log = std::make_unique<storage::experimental::mvlog::versioned_log>(
+          std::move(cfg));
+    }
+    mvlog_engine(const mvlog_engine&) = delete;
+    mvlog_engine& operator=(const mvlog_engine&) = delete;
+    ~mvlog_engine() {
+        _log->close().get();
+        std::filesystem::remove_all(std::filesystem::path(_base_dir));
+    }
+
+    ss::future<> append(model::record_batch b) {
+        return _log->append(std::move(b));
+    }
+    ss::future<> flush() { return _log->flush(); }
+    ss::future<> roll(model::offset) { return _log->apply_segment_ms(); }
+    ss::future<> prefix_truncate(model::offset o) {
+        return _log->prefix_truncate(o);
+    }
+
+private:
+    ss::sstring _base_dir;
+    std::unique_ptr<storage::experimental::mvlog::versioned_log> _log;
+};
+
+template<typename Engine>
+class log_engine_bench {
+public:
+    // Appends batches one by one, making each durable before the next.
+    ss::future<size_t> append_flush() {
+        auto batches = co_await make_batches(appends_per_run);
+        perf_tests::start_measuring_time();
+        for (auto& b : batches) {
+            co_await _engine.append(std::move(b));
+            co_await _engine.flush();
+        }
+        perf_tests::stop_measuring_time();
+        co_return appends_per_run;
+    }
+
+    // Writes one batch per segment, then removes all but the last segment.
+    ss::future<size_t> prefix_truncate() {
+        auto batches = co_await make_batches(segments_per_run);
+        const auto new_start = batches.back().base_offset();
+        for (auto& b : batches) {
+            co_await _engine.roll(b.base_offset());
+            co_await _engine.append(std::move(b));
+        }
+        co_await _engine.flush();
+        perf_tests::start_measuring_time();
+        co_await _engine.prefix_truncate(new_start);
+        perf_tests::stop_measuring_time();
+        co_return segments_per_run - 1;
+    }
+
+private:
+    ss::future<ss::circular_buffer<model::record_batch>> make_batches(int n) {
+        auto batches = co_await model::test::make_random_batches(
+          _next_offset, n, false);
+        _next_offset = model::next_offset(batches.back().last_offset());
+        co_return batches;
+    }
+
+    Engine _engine;
+    model::offset _next_offset{0};
+};
+
+using disk_log_bench = log_engine_bench<disk_log_engine>;
+using mvlog_bench = log_engine_bench<mvlog_engine>;
+
+} // namespace
+
+PERF_TEST_F(disk_log_bench, append_flush) { return append_flush(); }
+PERF_TEST_F(mvlog_bench, append_flush) { return append_flush(); }
+
+PERF_TEST_F(disk_log_bench, prefix_truncate) { return prefix_truncate(); }
+PERF_TEST_F(mvlog_bench, prefix_truncate) { return prefix_truncate(); }
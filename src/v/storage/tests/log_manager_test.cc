@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/random.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_utils.h"
 #include "model/tests/random_batch.h"
@@ -20,6 +21,7 @@
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_reader.h"
+#include "test_utils/async.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -144,3 +146,63 @@ SEASTAR_THREAD_TEST_CASE(test_can_load_logs) {
     BOOST_CHECK(
       file_exists(seg4->reader().filename() + ".cannotrecover").get0());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_segment_roll_uses_pooled_file) {
+    config::shard_local_cfg().storage_segment_pool_size.set_value(size_t{2});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().storage_segment_pool_size.reset();
+    });
+    auto conf = make_config();
+
+    ss::sharded<features::feature_table> feature_table;
+    feature_table.start().get();
+    feature_table
+      .invoke_on_all(
+        [](features::feature_table& f) { f.testing_activate_all(); })
+      .get();
+
+    storage::api store(
+      [conf]() {
+          return storage::kvstore_config(
+            1_MiB,
+            config::mock_binding(10ms),
+            conf.base_dir,
+            storage::make_sanitized_file_config());
+      },
+      [conf]() { return conf; },
+      feature_table);
+    store.start().get();
+    auto stop_kvstore = ss::defer([&store, &feature_table] {
+        store.stop().get();
+        feature_table.stop().get();
+    });
+    auto& m = store.log_mgr();
+    auto& pool = m.segment_pool();
+    tests::cooperative_spin_wait_with_timeout(
+      10s, [&pool] { return pool.ready() == 2; })
+      .get();
+
+    auto ntp = config_from_ntp(model::ntp("ns", "pooled", 0));
+    directories::initialize(ntp.work_directory()).get();
+    auto seg = m.make_log_segment(
+                  ntp,
+                  model::offset(10),
+                  model::term_id(1),
+                  ss::default_priority_class(),
+                  default_segment_readahead_size,
+                  default_segment_readahead_count)
+                 .get0();
+    BOOST_REQUIRE_LT(pool.ready(), 2);
+    // the pooled file is empty, the segment behaves as a new one
+    BOOST_REQUIRE_EQUAL(seg->size_bytes(), 0);
+    write_batches(seg);
+    seg->close().get();
+
+    m.manage(config_from_ntp(ntp.ntp())).get();
+    BOOST_CHECK_EQUAL(m.get(ntp.ntp())->segment_count(), 1);
+
+    // the pool is refilled in the background
+    tests::cooperative_spin_wait_with_timeout(
+      10s, [&pool] { return pool.ready() == 2; })
+      .get();
+}
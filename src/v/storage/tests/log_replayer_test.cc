@@ -20,6 +20,7 @@
 #include "storage/segment.h"
 #include "storage/segment_index.h"
 #include "storage/segment_reader.h"
+#include "storage/segment_scrubber.h"
 #include "storage/storage_resources.h"
 
 #include <seastar/core/reactor.hh>
@@ -230,3 +231,41 @@ SEASTAR_THREAD_TEST_CASE(test_reset_index) {
     storage::stlog.info("Recovered segment:{}", ctx._seg);
     BOOST_CHECK(ctx._seg->index().needs_persistence());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_scrub_clean_segment) {
+    log_replayer_fixture ctx;
+    auto batches = model::test::make_random_batches(model::offset(1), 10).get();
+    ctx.write(batches);
+    ss::abort_source as;
+    auto result = storage::scrub_segment(
+                    ctx._seg, ss::default_priority_class(), nullptr, as)
+                    .get();
+    BOOST_CHECK_EQUAL(result.batches, 10);
+    BOOST_CHECK_EQUAL(result.bytes, ctx._seg->appender().file_byte_offset());
+    BOOST_CHECK(result.corrupted.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_scrub_reports_corrupted_batches) {
+    log_replayer_fixture ctx;
+    auto batches = model::test::make_random_batches(model::offset(1), 10).get();
+    // two adjacent corrupted batches are reported as a single range
+    batches[3].header().crc = 10;
+    batches[4].header().crc = 10;
+    batches[8].header().crc = 10;
+    ctx.write(batches);
+    ss::abort_source as;
+    auto result = storage::scrub_segment(
+                    ctx._seg, ss::default_priority_class(), nullptr, as)
+                    .get();
+    // the parser doesn't stop at batches with a bad payload crc
+    BOOST_CHECK_EQUAL(result.batches, 10);
+    BOOST_REQUIRE_EQUAL(result.corrupted.size(), 2);
+    BOOST_CHECK_EQUAL(
+      result.corrupted[0].base_offset, batches[3].base_offset());
+    BOOST_CHECK_EQUAL(
+      result.corrupted[0].last_offset, batches[4].last_offset());
+    BOOST_CHECK_EQUAL(
+      result.corrupted[1].base_offset, batches[8].base_offset());
+    BOOST_CHECK_EQUAL(
+      result.corrupted[1].last_offset, batches[8].last_offset());
+}
@@ -14,6 +14,7 @@
 #include "config/configuration.h"
 #include "random/generators.h"
 #include "storage/chunk_cache.h"
+#include "storage/flush_coordinator.h"
 #include "storage/segment_appender.h"
 #include "storage/storage_resources.h"
 
@@ -613,3 +614,70 @@ SEASTAR_THREAD_TEST_CASE(test_fallocate_size) {
         run_test_fallocate_size(fallocate_size);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_flush_coordinator_groups_flushes) {
+    auto first = open_file("test_flush_coordinator_1.log");
+    auto second = open_file("test_flush_coordinator_2.log");
+    auto close = ss::defer([&first, &second] {
+        first.close().get();
+        second.close().get();
+    });
+
+    storage::flush_coordinator coordinator(
+      config::mock_binding<uint32_t>(1000));
+
+    // flushes requested within the window are issued together and the
+    // repeated flush of the first file shares its fdatasync
+    auto f1 = coordinator.flush(first);
+    auto f2 = coordinator.flush(second);
+    auto f3 = coordinator.flush(first);
+    ss::when_all_succeed(std::move(f1), std::move(f2), std::move(f3)).get();
+
+    BOOST_REQUIRE_EQUAL(coordinator.flushes(), 3);
+    BOOST_REQUIRE_EQUAL(coordinator.syncs(), 2);
+    BOOST_REQUIRE_EQUAL(coordinator.batches(), 1);
+
+    // a flush after the group was dispatched starts a new one
+    coordinator.flush(first).get();
+    BOOST_REQUIRE_EQUAL(coordinator.syncs(), 3);
+    BOOST_REQUIRE_EQUAL(coordinator.batches(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_can_append_with_flush_coalescing) {
+    config::shard_local_cfg().storage_flush_coalesce_window_us.set_value(
+      uint32_t{1000});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().storage_flush_coalesce_window_us.reset();
+    });
+    storage::storage_resources resources(
+      config::mock_binding<size_t>(16_KiB));
+
+    std::vector<ss::sstring> names{
+      "test_flush_coalescing_1.log", "test_flush_coalescing_2.log"};
+    std::vector<std::unique_ptr<segment_appender>> appenders;
+    for (const auto& name : names) {
+        appenders.push_back(std::make_unique<segment_appender>(
+          make_segment_appender(open_file(name), resources)));
+    }
+    auto close = ss::defer([&appenders] {
+        for (auto& a : appenders) {
+            a->close().get();
+        }
+    });
+
+    auto data = make_random_data(10_KiB);
+    std::vector<ss::future<>> flushes;
+    for (auto& a : appenders) {
+        a->append(data).get();
+        flushes.push_back(a->flush());
+    }
+    ss::when_all_succeed(flushes.begin(), flushes.end()).get();
+
+    auto& coordinator = resources.flush_coordinator();
+    BOOST_REQUIRE_GE(coordinator.flushes(), appenders.size());
+    BOOST_REQUIRE_LE(coordinator.batches(), coordinator.syncs());
+    for (auto& a : appenders) {
+        BOOST_REQUIRE_EQUAL(access(*a).inflight_dispatched(), 0);
+        BOOST_REQUIRE_EQUAL(a->file_byte_offset(), data.size_bytes());
+    }
+}
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 #include "model/record_utils.h"
@@ -21,10 +22,12 @@
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_reader.h"
+#include "storage/storage_resources.h"
 #include "utils/disk_log_builder.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
 
 using namespace storage; // NOLINT
 
@@ -293,6 +296,44 @@ SEASTAR_THREAD_TEST_CASE(test_does_not_read_past_max_offset) {
     check_batches(res, batches);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_read_ahead_charged_to_resources) {
+    disk_log_builder b;
+    b | start() | add_segment(0);
+    auto batches = model::test::make_random_batches(model::offset(0), 20).get();
+    write(std::move(batches), b);
+    auto& seg = b.get_log_segments().front();
+
+    // one reader stream takes the whole read-ahead budget, so the second
+    // falls back to reading one buffer at a time. both must read the same.
+    constexpr size_t buffer_size = 4096;
+    constexpr unsigned read_ahead = 4;
+    config::shard_local_cfg().storage_read_readahead_memory.set_value(
+      buffer_size * read_ahead);
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().storage_read_readahead_memory.reset();
+    });
+    storage::storage_resources resources;
+    storage::segment_reader reader(
+      seg->reader().path(), buffer_size, read_ahead, std::nullopt, &resources);
+    reader.load_size().get();
+    BOOST_REQUIRE_GT(reader.file_size(), 0);
+
+    auto first = reader.data_stream(0, ss::default_priority_class()).get();
+    auto second = reader.data_stream(0, ss::default_priority_class()).get();
+    auto first_data = first.stream().read_exactly(reader.file_size()).get();
+    auto second_data = second.stream().read_exactly(reader.file_size()).get();
+    BOOST_REQUIRE_EQUAL(first_data.size(), reader.file_size());
+    BOOST_REQUIRE(first_data == second_data);
+
+    // closing the first stream returns its reservation
+    first.close().get();
+    BOOST_REQUIRE(
+      resources.read_ahead_try_take_bytes(buffer_size * read_ahead));
+    second.close().get();
+    reader.close().get();
+    b | stop();
+}
+
 SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     const auto a = random_generators::gen_alphanum_string(1024);
     const auto b = bytes("abc");
@@ -318,3 +359,27 @@ SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     zero.append(zeros.data(), zeros.size());
     BOOST_REQUIRE_EQUAL(storage::internal::is_zero(zero), true);
 }
+
+SEASTAR_THREAD_TEST_CASE(disk_header_fixed_offset_decode_test) {
+    auto batches = model::test::make_random_batches(model::offset(0), 20)
+                     .get();
+    for (const auto& batch : batches) {
+        auto expected = batch.header();
+        auto buf = storage::batch_header_to_disk_iobuf(expected);
+        auto linearized = iobuf_to_bytes(buf);
+        const auto* raw = reinterpret_cast<const char*>(linearized.data());
+
+        auto decoded = storage::batch_header_from_disk_bytes(raw);
+        BOOST_REQUIRE_EQUAL(decoded, expected);
+        // operator== does not cover these
+        BOOST_REQUIRE_EQUAL(decoded.type, expected.type);
+        BOOST_REQUIRE_EQUAL(decoded.producer_id, expected.producer_id);
+        BOOST_REQUIRE_EQUAL(decoded.producer_epoch, expected.producer_epoch);
+        BOOST_REQUIRE_EQUAL(decoded.base_sequence, expected.base_sequence);
+        BOOST_REQUIRE_EQUAL(
+          storage::header_only_crc_from_disk_bytes(raw),
+          model::internal_header_only_crc(expected));
+        BOOST_REQUIRE_EQUAL(
+          storage::batch_header_from_disk_iobuf(std::move(buf)), expected);
+    }
+}
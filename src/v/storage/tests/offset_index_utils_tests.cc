@@ -36,6 +36,15 @@ public:
 
     ~offset_index_utils_fixture() { _feature_table.stop().get(); }
 
+    storage::segment_index_ptr make_index(tmpbuf_file::store_t& data) {
+        return std::unique_ptr<segment_index>(new segment_index(
+          segment_full_path::mock("In memory iobuf"),
+          ss::file(ss::make_shared(tmpbuf_file(data))),
+          _base_offset,
+          storage::segment_index::default_data_buffer_step,
+          _feature_table));
+    }
+
     ss::future<> start() {
         return _feature_table.start().then([this]() {
             return _feature_table.invoke_on_all(
@@ -176,3 +185,123 @@ FIXTURE_TEST(bucket_truncate, offset_index_utils_fixture) {
         BOOST_REQUIRE(bool(!p));
     }
 }
+
+FIXTURE_TEST(index_budget_eviction, offset_index_utils_fixture) {
+    start().get();
+
+    constexpr auto step = storage::segment_index::default_data_buffer_step;
+    for (uint32_t i = 0; i < 16; ++i) {
+        _idx->maybe_track(
+          modify_get(_base_offset + model::offset(i * 10), step),
+          std::nullopt,
+          i * step);
+    }
+    _idx->flush().get();
+
+    tmpbuf_file::store_t other_data;
+    auto other = make_index(other_data);
+    other->maybe_track(modify_get(_base_offset, step), std::nullopt, 0);
+    other->flush().get();
+
+    storage::segment_index_budget budget(
+      config::mock_binding<std::optional<size_t>>(size_t{1}),
+      config::mock_binding<size_t>(size_t{0}));
+
+    // the most recently used index is never evicted
+    _idx->attach_budget(budget);
+    BOOST_REQUIRE(!_idx->is_evicted());
+
+    // attaching another index takes the budget over its limit
+    other->attach_budget(budget);
+    BOOST_REQUIRE(_idx->is_evicted());
+    BOOST_REQUIRE(!other->is_evicted());
+    BOOST_REQUIRE_EQUAL(budget.evictions(), 1);
+
+    // header fields survive eviction, lookups fall back to the segment start
+    BOOST_REQUIRE_EQUAL(_idx->max_offset(), model::offset(150));
+    BOOST_REQUIRE(!_idx->find_nearest(model::offset(55)).has_value());
+
+    _idx->ensure_materialized().get();
+    BOOST_REQUIRE(!_idx->is_evicted());
+    BOOST_REQUIRE_EQUAL(budget.misses(), 1);
+    index_entry_expect(50, 5 * step);
+
+    // rehydrating made the other index the least recently used one
+    BOOST_REQUIRE(other->is_evicted());
+    BOOST_REQUIRE_EQUAL(budget.evictions(), 2);
+
+    _idx->ensure_materialized().get();
+    BOOST_REQUIRE_EQUAL(budget.hits(), 1);
+}
+
+FIXTURE_TEST(index_budget_paged_lookup, offset_index_utils_fixture) {
+    start().get();
+
+    // enough entries for the offset column to span several pages
+    constexpr auto step = storage::segment_index::default_data_buffer_step;
+    constexpr uint32_t entries = 4000;
+    for (uint32_t i = 0; i < entries; ++i) {
+        _idx->maybe_track(
+          modify_get(_base_offset + model::offset(i * 10), step),
+          std::nullopt,
+          i * step);
+    }
+    _idx->flush().get();
+
+    std::vector<model::offset> queries{
+      model::offset(0),
+      model::offset(5),
+      model::offset(10),
+      model::offset(12345),
+      model::offset(entries * 10 - 10),
+      model::offset(entries * 10 + 100)};
+    std::vector<std::optional<segment_index::entry>> expected;
+    for (auto o : queries) {
+        expected.push_back(_idx->find_nearest(o));
+    }
+
+    tmpbuf_file::store_t other_data;
+    auto other = make_index(other_data);
+    other->maybe_track(modify_get(_base_offset, step), std::nullopt, 0);
+    other->flush().get();
+
+    storage::segment_index_budget budget(
+      config::mock_binding<std::optional<size_t>>(size_t{1}),
+      config::mock_binding<size_t>(
+        size_t{16} * storage::segment_index_budget::page_size));
+    _idx->attach_budget(budget);
+    other->attach_budget(budget);
+    BOOST_REQUIRE(_idx->is_evicted());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto e = _idx->find_nearest_paged(queries[i]).get();
+        BOOST_REQUIRE_EQUAL(e.has_value(), expected[i].has_value());
+        if (e) {
+            BOOST_REQUIRE_EQUAL(e->offset, expected[i]->offset);
+            BOOST_REQUIRE_EQUAL(e->timestamp, expected[i]->timestamp);
+            BOOST_REQUIRE_EQUAL(e->filepos, expected[i]->filepos);
+        }
+        // paged lookups don't make the index resident
+        BOOST_REQUIRE(_idx->is_evicted());
+    }
+    BOOST_REQUIRE_EQUAL(budget.misses(), 0);
+    BOOST_REQUIRE_GT(budget.page_misses(), 0);
+    BOOST_REQUIRE_GT(budget.page_hits(), 0);
+    BOOST_REQUIRE_LE(
+      budget.page_bytes(),
+      size_t{16} * storage::segment_index_budget::page_size);
+
+    // the same lookup again is served from cached pages only
+    const auto misses = budget.page_misses();
+    _idx->find_nearest_paged(queries[3]).get();
+    BOOST_REQUIRE_EQUAL(budget.page_misses(), misses);
+
+    // without a page cache the index is rehydrated instead
+    storage::segment_index_budget no_pages(
+      config::mock_binding<std::optional<size_t>>(size_t{1}),
+      config::mock_binding<size_t>(size_t{0}));
+    _idx->attach_budget(no_pages);
+    auto e = _idx->find_nearest_paged(queries[3]).get();
+    BOOST_REQUIRE(!_idx->is_evicted());
+    BOOST_REQUIRE_EQUAL(e->filepos, expected[3]->filepos);
+}
@@ -9,6 +9,7 @@
 
 #include "bytes/random.h"
 #include "model/fundamental.h"
+#include "model/record_batch_types.h"
 #include "raft/fundamental.h"
 #include "random/generators.h"
 #include "storage/api.h"
@@ -17,6 +18,7 @@
 #include "storage/log_manager.h"
 #include "storage/offset_translator.h"
 #include "storage/record_batch_builder.h"
+#include "storage/segment.h"
 #include "test_utils/fixture.h"
 
 #include <seastar/core/coroutine.hh>
@@ -689,3 +691,51 @@ FIXTURE_TEST(test_moving_persistent_state, base_fixture) {
     BOOST_REQUIRE_EQUAL(map.has_value(), false);
     BOOST_REQUIRE_EQUAL(highest_known_offset.has_value(), false);
 }
+
+FIXTURE_TEST(test_sync_with_segment_indices, base_fixture) {
+    auto log = _api.local()
+                 .log_mgr()
+                 .manage(storage::ntp_config(test_ntp, _test_dir))
+                 .get();
+
+    auto append = [&log](model::record_batch_type type) {
+        ss::circular_buffer<model::record_batch> batches;
+        batches.push_back(create_batch(type, model::offset(0)));
+        auto appender = log->make_appender(storage::log_append_config{
+          .should_fsync = storage::log_append_config::fsync::no,
+          .io_priority = ss::default_priority_class(),
+          .timeout = model::no_timeout});
+        model::make_memory_record_batch_reader(std::move(batches))
+          .for_each_ref(std::move(appender), model::no_timeout)
+          .get();
+    };
+
+    // data @ 0, config @ 1, data @ 2 | config @ 3, data @ 4
+    append(model::record_batch_type::raft_data);
+    append(model::record_batch_type::raft_configuration);
+    append(model::record_batch_type::raft_data);
+    log->force_roll(ss::default_priority_class()).get();
+    append(model::record_batch_type::raft_configuration);
+    append(model::record_batch_type::raft_data);
+    log->flush().get();
+
+    BOOST_REQUIRE_EQUAL(log->segment_count(), 2);
+    for (const auto& seg : log->segments()) {
+        const auto& gaps = seg->index().translator_gaps();
+        BOOST_REQUIRE(gaps.has_value());
+        BOOST_REQUIRE_EQUAL(gaps->size(), 1);
+    }
+
+    storage::offset_translator tr{
+      model::offset_translator_batch_types(),
+      raft::group_id(0),
+      test_ntp,
+      _api.local()};
+    tr.start(storage::offset_translator::must_reset::yes).get();
+    tr.sync_with_log(*log, std::nullopt).get();
+
+    validate_translation(tr, model::offset(0), model::offset(0));
+    validate_translation(tr, model::offset(2), model::offset(1));
+    validate_translation(tr, model::offset(4), model::offset(2));
+    BOOST_REQUIRE_EQUAL(tr.state()->last_gap_offset(), model::offset(3));
+}
@@ -78,7 +78,17 @@ struct readers_cache_test_fixture : seastar_test {
           nullptr);
     }
 
-    segment_ptr make_segment(model::offset base_offset) {
+    segment_ptr make_segment(
+      model::offset base_offset,
+      std::optional<model::offset> dirty_offset = std::nullopt) {
+        storage::segment::offset_tracker tracker(model::term_id(0), base_offset);
+        if (dirty_offset) {
+            tracker.set_offsets(
+              storage::segment::offset_tracker::committed_offset_t{
+                *dirty_offset},
+              storage::segment::offset_tracker::stable_offset_t{*dirty_offset},
+              storage::segment::offset_tracker::dirty_offset_t{*dirty_offset});
+        }
         segment_index idx(
           segment_full_path::mock("mocked"),
           base_offset,
@@ -86,7 +96,7 @@ struct readers_cache_test_fixture : seastar_test {
           features,
           std::nullopt);
         return ss::make_lw_shared<storage::segment>(
-          storage::segment::offset_tracker(model::term_id(0), base_offset),
+          tracker,
           nullptr,
           std::move(idx),
           nullptr,
@@ -233,3 +243,40 @@ TEST_F(readers_cache_test_fixture, test_size_based_eviction) {
     RPTEST_REQUIRE_EVENTUALLY(
       5s, [&] { return cache.get_stats().cached_readers == 9; });
 }
+
+TEST_F(readers_cache_test_fixture, test_range_match_within_segment) {
+    readers_cache cache = make_cache(30s, make_max_size_property(10));
+
+    auto close = ss::defer([&cache] { cache.stop().get(); });
+
+    ss::circular_buffer<segment_ptr> set;
+    set.push_back(make_segment(model::offset(0), model::offset(100)));
+    cache.put(make_reader(std::move(set)));
+    EXPECT_EQ(cache.get_stats().cached_readers, 1);
+
+    auto make_cfg = [](int64_t start) {
+        return log_reader_config(
+          model::offset(start),
+          model::offset::max(),
+          ss::default_priority_class());
+    };
+
+    // requested offset is past the segment the reader is positioned in
+    EXPECT_FALSE(cache.get_reader(make_cfg(101)).has_value());
+
+    // reader positioned at 0 can skip forward to serve a read starting at 10
+    {
+        auto reader = cache.get_reader(make_cfg(10));
+        ASSERT_TRUE(reader.has_value());
+        EXPECT_EQ(cache.get_stats().in_use_readers, 1);
+    }
+    EXPECT_EQ(cache.get_stats().in_use_readers, 0);
+    EXPECT_EQ(cache.get_stats().cached_readers, 1);
+
+    // readers never move backward
+    EXPECT_FALSE(cache.get_reader(make_cfg(5)).has_value());
+
+    // exact match on the offset reader was reset to
+    auto reader = cache.get_reader(make_cfg(10));
+    EXPECT_TRUE(reader.has_value());
+}
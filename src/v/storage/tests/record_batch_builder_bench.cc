@@ -0,0 +1,67 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "model/record.h"
+#include "random/generators.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+namespace {
+
+iobuf make_payload(size_t size) {
+    auto s = random_generators::gen_alphanum_string(size);
+    iobuf b;
+    b.append(s.data(), s.size());
+    return b;
+}
+
+/*
+ * Builds a batch of small records, the shape of the batches produced
+ * internally (controller commands, consumer offsets, audit events). Returns
+ * the number of records so the result reads as time per record.
+ */
+size_t build_batch(
+  size_t records, size_t key_size, size_t value_size, size_t headers) {
+    const auto key = make_payload(key_size);
+    const auto value = make_payload(value_size);
+
+    perf_tests::start_measuring_time();
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (size_t i = 0; i < records; ++i) {
+        std::vector<model::record_header> hdrs;
+        hdrs.reserve(headers);
+        for (size_t h = 0; h < headers; ++h) {
+            hdrs.emplace_back(
+              key.size_bytes(), key.copy(), value.size_bytes(), value.copy());
+        }
+        builder.add_raw_kw(key.copy(), value.copy(), std::move(hdrs));
+    }
+    auto batch = std::move(builder).build();
+    perf_tests::stop_measuring_time();
+
+    perf_tests::do_not_optimize(batch);
+    return records;
+}
+
+} // namespace
+
+PERF_TEST(record_batch_builder, small_records) {
+    return build_batch(1000, 16, 64, 0);
+}
+
+PERF_TEST(record_batch_builder, small_records_with_headers) {
+    return build_batch(1000, 16, 64, 2);
+}
+
+PERF_TEST(record_batch_builder, large_records) {
+    return build_batch(100, 16, 4096, 0);
+}
@@ -12,6 +12,7 @@
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
 #include "storage/record_batch_builder.h"
@@ -144,3 +145,75 @@ SEASTAR_THREAD_TEST_CASE(serialize_deserialize_then_cmp) {
     });
     BOOST_CHECK_EQUAL(sample_data, sample_output);
 }
+
+SEASTAR_THREAD_TEST_CASE(records_encoded_like_model_records) {
+    auto to_iobuf = [](std::string_view s) {
+        iobuf b;
+        b.append(s.data(), s.size());
+        return b;
+    };
+    struct kv {
+        std::optional<ss::sstring> key;
+        std::optional<ss::sstring> value;
+        std::vector<std::pair<ss::sstring, ss::sstring>> headers;
+    };
+    std::vector<kv> input{
+      {std::nullopt, std::nullopt, {}},
+      {"", "", {}},
+      {"key", std::nullopt, {{"h", ""}}},
+      {std::nullopt, random_generators::gen_alphanum_string(300), {}},
+      {"k", "v", {{"a", "b"}, {"header", "value"}}},
+    };
+
+    storage::record_batch_builder rbb(
+      model::record_batch_type::raft_data, model::offset(0));
+    iobuf expected;
+    int32_t delta = 0;
+    for (const auto& r : input) {
+        auto opt_iobuf = [&](const std::optional<ss::sstring>& s) {
+            return s ? std::make_optional(to_iobuf(*s)) : std::nullopt;
+        };
+        auto make_headers = [&] {
+            std::vector<model::record_header> hdrs;
+            for (const auto& [k, v] : r.headers) {
+                hdrs.emplace_back(
+                  k.size(), to_iobuf(k), v.size(), to_iobuf(v));
+            }
+            return hdrs;
+        };
+        rbb.add_raw_kw(opt_iobuf(r.key), opt_iobuf(r.value), make_headers());
+
+        auto key = opt_iobuf(r.key);
+        auto value = opt_iobuf(r.value);
+        auto hdrs = make_headers();
+        const int32_t key_size = key ? key->size_bytes() : -1;
+        const int32_t value_size = value ? value->size_bytes() : -1;
+        int32_t size = sizeof(model::record_attributes::type)
+                       + vint::vint_size(0) + vint::vint_size(delta)
+                       + vint::vint_size(key_size)
+                       + std::max(key_size, 0) + vint::vint_size(value_size)
+                       + std::max(value_size, 0)
+                       + vint::vint_size(hdrs.size());
+        for (const auto& h : hdrs) {
+            size += vint::vint_size(h.key_size()) + h.key_size()
+                    + vint::vint_size(h.value_size()) + h.value_size();
+        }
+        model::append_record_to_buffer(
+          expected,
+          model::record(
+            size,
+            model::record_attributes{},
+            0,
+            delta,
+            key_size,
+            key ? std::move(*key) : iobuf{},
+            value_size,
+            value ? std::move(*value) : iobuf{},
+            std::move(hdrs)));
+        ++delta;
+    }
+
+    auto rb = std::move(rbb).build();
+    BOOST_REQUIRE_EQUAL(rb.record_count(), input.size());
+    BOOST_REQUIRE(rb.data() == expected);
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/recovery_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+using namespace storage;
+
+TEST(RecoverySchedulerTest, TestBoundedConcurrency) {
+    recovery_scheduler s(2);
+    auto p1 = s.admit(recovery_priority::normal);
+    auto p2 = s.admit(recovery_priority::normal);
+    auto p3 = s.admit(recovery_priority::normal);
+    ASSERT_TRUE(p1.available());
+    ASSERT_TRUE(p2.available());
+    ASSERT_FALSE(p3.available());
+    ASSERT_EQ(s.progress().active, 2);
+    ASSERT_EQ(s.progress().pending_normal, 1);
+
+    // releasing a permit admits the next waiter
+    { auto done = p1.get(); }
+    ASSERT_TRUE(p3.available());
+    ASSERT_EQ(s.progress().active, 2);
+    ASSERT_EQ(s.progress().pending_normal, 0);
+    ASSERT_EQ(s.progress().completed, 1);
+
+    { auto done = p2.get(); }
+    { auto done = p3.get(); }
+    ASSERT_EQ(s.progress().active, 0);
+    ASSERT_EQ(s.progress().completed, 3);
+}
+
+TEST(RecoverySchedulerTest, TestHighPriorityFirst) {
+    recovery_scheduler s(1);
+    auto running = s.admit(recovery_priority::normal);
+    auto normal = s.admit(recovery_priority::normal);
+    auto high = s.admit(recovery_priority::high);
+    ASSERT_EQ(s.progress().pending_high, 1);
+    ASSERT_EQ(s.progress().pending_normal, 1);
+
+    // the high priority waiter overtakes the normal one queued before it
+    { auto done = running.get(); }
+    ASSERT_TRUE(high.available());
+    ASSERT_FALSE(normal.available());
+
+    // and a new normal waiter doesn't overtake the queued one
+    { auto done = high.get(); }
+    ASSERT_TRUE(normal.available());
+    auto later = s.admit(recovery_priority::normal);
+    ASSERT_FALSE(later.available());
+    { auto done = normal.get(); }
+    ASSERT_TRUE(later.available());
+    { auto done = later.get(); }
+}
+
+TEST(RecoverySchedulerTest, TestSetCapacity) {
+    recovery_scheduler s(1);
+    std::vector<ss::future<recovery_scheduler::permit>> permits;
+    for (int i = 0; i < 3; ++i) {
+        permits.push_back(s.admit(recovery_priority::normal));
+    }
+    ASSERT_EQ(s.progress().active, 1);
+
+    s.set_capacity(3);
+    ASSERT_EQ(s.progress().active, 3);
+    for (auto& p : permits) {
+        ASSERT_TRUE(p.available());
+        auto done = p.get();
+    }
+    ASSERT_EQ(s.progress().completed, 3);
+}
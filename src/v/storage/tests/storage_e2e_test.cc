@@ -25,6 +25,7 @@
 #include "storage/batch_cache.h"
 #include "storage/log_manager.h"
 #include "storage/ntp_config.h"
+#include "storage/parser_utils.h"
 #include "storage/record_batch_builder.h"
 #include "storage/segment_utils.h"
 #include "storage/tests/common.h"
@@ -4732,3 +4733,135 @@ FIXTURE_TEST(test_offset_range_size_incremental, storage_test_fixture) {
         }
     }
 };
+
+FIXTURE_TEST(
+  test_compaction_keeps_unchanged_compressed_batches, storage_test_fixture) {
+    auto cfg = default_log_config(test_dir);
+    storage::log_manager mgr = make_log_manager(cfg);
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+    auto ntp = model::ntp("default", "test", 0);
+    using overrides_t = storage::ntp_config::default_overrides;
+    overrides_t ov;
+    ov.cleanup_policy_bitflags = model::cleanup_policy_bitflags::compaction;
+    storage::ntp_config ntp_cfg(
+      ntp, mgr.config().base_dir, std::make_unique<overrides_t>(ov));
+    auto log = mgr.manage(std::move(ntp_cfg)).get();
+
+    // records have random keys, so compaction has nothing to remove
+    ss::circular_buffer<model::record_batch> batches;
+    std::vector<model::record_batch_header> written;
+    model::offset o{0};
+    for (int i = 0; i < 10; ++i) {
+        auto b = storage::internal::compress_batch(
+                   model::compression::zstd,
+                   model::test::make_random_batch(o, 10, false))
+                   .get();
+        o = model::next_offset(b.last_offset());
+        written.push_back(b.header());
+        batches.push_back(std::move(b));
+    }
+    auto appender = log->make_appender(storage::log_append_config{
+      .should_fsync = storage::log_append_config::fsync::no,
+      .io_priority = ss::default_priority_class(),
+      .timeout = model::no_timeout});
+    model::make_memory_record_batch_reader(std::move(batches))
+      .for_each_ref(std::move(appender), model::no_timeout)
+      .get();
+    log->force_roll(ss::default_priority_class()).get();
+
+    ss::abort_source as;
+    log
+      ->housekeeping(storage::housekeeping_config(
+        model::timestamp::min(),
+        std::nullopt,
+        model::offset::max(),
+        ss::default_priority_class(),
+        as))
+      .get();
+
+    // compaction wrote the batches back as they were, without recompressing
+    auto read = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(read.size(), written.size());
+    for (size_t i = 0; i < read.size(); ++i) {
+        BOOST_REQUIRE(read[i].compressed());
+        BOOST_REQUIRE_EQUAL(read[i].header().crc, written[i].crc);
+        BOOST_REQUIRE_EQUAL(
+          read[i].header().size_bytes, written[i].size_bytes);
+    }
+}
+
+FIXTURE_TEST(test_demote_segments_to_cold_dir, storage_test_fixture) {
+    const ss::sstring cold_dir = test_dir + "_cold";
+    auto cleanup_cold = ss::defer([&cold_dir] {
+        config::shard_local_cfg().storage_hot_tier_partition_bytes.reset();
+        ss::recursive_remove_directory(std::filesystem::path(cold_dir))
+          .handle_exception([](std::exception_ptr) {})
+          .get();
+    });
+    // everything but the head segment is over the hot tier budget
+    config::shard_local_cfg().storage_hot_tier_partition_bytes.set_value(
+      std::make_optional<size_t>(0));
+
+    auto cfg = default_log_config(test_dir);
+    cfg.cold_dir = cold_dir;
+    auto ntp = model::ntp("default", "test", 0);
+    std::vector<model::record_batch_header> headers;
+    std::vector<std::filesystem::path> demoted;
+    {
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+        auto log = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir))
+                     .get();
+        for (int i = 0; i < 3; ++i) {
+            auto appended = append_random_batches(log, 2);
+            headers.insert(headers.end(), appended.begin(), appended.end());
+            log->force_roll(ss::default_priority_class()).get();
+        }
+
+        ss::abort_source as;
+        log
+          ->housekeeping(storage::housekeeping_config(
+            model::timestamp::min(),
+            std::nullopt,
+            model::offset::max(),
+            ss::default_priority_class(),
+            as))
+          .get();
+
+        const auto& segs = log->segments();
+        BOOST_REQUIRE_EQUAL(segs.size(), 4);
+        for (size_t i = 0; i < segs.size(); ++i) {
+            const auto& path = segs[i]->reader().path();
+            auto type = ss::file_type(
+                          path.string(), ss::follow_symlink::no)
+                          .get();
+            const bool is_head = i + 1 == segs.size();
+            BOOST_REQUIRE_EQUAL(segs[i]->is_demoted(), !is_head);
+            BOOST_REQUIRE(
+              type
+              == (is_head ? ss::directory_entry_type::regular
+                          : ss::directory_entry_type::link));
+            if (!is_head) {
+                auto cold_path = std::filesystem::path(
+                  path.with_base_dir(cold_dir));
+                BOOST_REQUIRE(ss::file_exists(cold_path.string()).get());
+                demoted.push_back(cold_path);
+            }
+        }
+        BOOST_REQUIRE_EQUAL(
+          read_and_validate_all_batches(log).size(), headers.size());
+    }
+
+    // demoted segments are loaded through their links after a restart, and
+    // removing the log removes their cold copies
+    storage::log_manager mgr = make_log_manager(cfg);
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+    auto log = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir))
+                 .get();
+    BOOST_REQUIRE_EQUAL(
+      read_and_validate_all_batches(log).size(), headers.size());
+    mgr.remove(ntp).get();
+    for (const auto& path : demoted) {
+        BOOST_REQUIRE(!ss::file_exists(path.string()).get());
+    }
+}
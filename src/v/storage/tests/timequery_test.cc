@@ -421,3 +421,45 @@ FIXTURE_TEST(timequery_clamp, log_builder_fixture) {
 
     b | stop();
 }
+
+FIXTURE_TEST(timequery_batch_time_index, log_builder_fixture) {
+    using namespace storage; // NOLINT
+
+    b | start();
+
+    // 100 batches of 10 records with timestamps equal to their offsets. the
+    // batches are small enough that not all of them are in the batch time
+    // index, so queries hit both the index and the segment.
+    b | add_segment(0);
+    for (auto offset = 0; offset < 1000; offset += 10) {
+        b
+          | add_batch(make_random_batch(
+            model::offset(offset), model::timestamp(offset), 10, false));
+    }
+
+    const auto& segs = b.get_log_segments();
+    BOOST_TEST(segs.front()->index().find_batch_time(model::timestamp(0)));
+
+    auto log = b.get_log();
+    for (auto ts = 0; ts < 1000; ++ts) {
+        for (auto filter :
+             {std::make_optional(model::record_batch_type::raft_data),
+              std::optional<model::record_batch_type>{}}) {
+            BOOST_TEST_INFO_SCOPE(
+              fmt::format("ts: {}, filter: {}", ts, filter.has_value()));
+            storage::timequery_config config(
+              log->offsets().start_offset,
+              model::timestamp(ts),
+              log->offsets().dirty_offset,
+              ss::default_priority_class(),
+              filter);
+
+            auto res = log->timequery(config).get0();
+            BOOST_TEST(res);
+            BOOST_TEST(res->time == model::timestamp(ts));
+            BOOST_TEST(res->offset == model::offset(ts));
+        }
+    }
+
+    b | stop();
+}
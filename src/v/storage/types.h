@@ -469,7 +469,7 @@ struct compaction_config {
       ss::abort_source& as,
       std::optional<ntp_sanitizer_config> san_cfg = std::nullopt,
       std::optional<size_t> max_keys = std::nullopt,
-      hash_key_offset_map* key_map = nullptr,
+      bucketed_hash_key_offset_map* key_map = nullptr,
       scoped_file_tracker::set_t* to_clean = nullptr)
       : max_collectible_offset(max_collect_offset)
       , iopc(p)
@@ -491,7 +491,7 @@ struct compaction_config {
     std::optional<size_t> key_offset_map_max_keys;
 
     // Hash key-offset map to reuse across compactions.
-    hash_key_offset_map* hash_key_map;
+    bucketed_hash_key_offset_map* hash_key_map;
 
     // Set of intermediary files added by compactions that need to be removed,
     // e.g. because they were leftover from an aborted compaction.
@@ -517,7 +517,7 @@ struct housekeeping_config {
       ss::io_priority_class p,
       ss::abort_source& as,
       std::optional<ntp_sanitizer_config> san_cfg = std::nullopt,
-      hash_key_offset_map* key_map = nullptr)
+      bucketed_hash_key_offset_map* key_map = nullptr)
       : compact(
         max_collect_offset, p, as, std::move(san_cfg), std::nullopt, key_map)
       , gc(upper, max_bytes_in_log) {}
@@ -433,12 +433,12 @@ private:
 
 class rpc_offset_committer : public offset_committer {
 public:
-    explicit rpc_offset_committer(rpc::client* client)
+    explicit rpc_offset_committer(ss::sharded<rpc::client>* client)
       : _client(client) {}
 
     ss::future<result<model::partition_id, cluster::errc>>
     find_coordinator(model::transform_offsets_key key) override {
-        return _client->find_coordinator(key);
+        return _client->local().find_coordinator(key);
     }
 
     ss::future<cluster::errc> batch_commit(
@@ -446,11 +446,19 @@ public:
       absl::btree_map<
         model::transform_offsets_key,
         model::transform_offsets_value> batch) override {
-        return _client->batch_offset_commit(coordinator, std::move(batch));
+        // Every core commits the offsets for a coordinator through the same
+        // core, so that the commits from all of the cores are coalesced into
+        // a single request to the coordinator.
+        auto shard = static_cast<ss::shard_id>(coordinator()) % ss::smp::count;
+        return _client->invoke_on(
+          shard,
+          [coordinator, batch = std::move(batch)](rpc::client& c) mutable {
+              return c.batch_offset_commit(coordinator, std::move(batch));
+          });
     }
 
 private:
-    rpc::client* _client;
+    ss::sharded<rpc::client>* _client;
 };
 
 } // namespace
@@ -514,7 +522,7 @@ ss::future<> service::start() {
 
     _batcher = std::make_unique<commit_batcher<ss::lowres_clock>>(
       config::shard_local_cfg().data_transforms_commit_interval_ms.bind(),
-      std::make_unique<rpc_offset_committer>(&_rpc_client->local()));
+      std::make_unique<rpc_offset_committer>(_rpc_client));
 
     size_t read_buffer_percent
       = config::shard_local_cfg()
@@ -558,7 +566,15 @@ ss::future<> service::start() {
 
 void service::register_notifications() {
     auto plugin_notif_id = _plugin_frontend->local().register_for_updates(
-      [this](model::transform_id id) { _manager->on_plugin_change(id); });
+      [this](model::transform_id id) {
+          _manager->on_plugin_change(id);
+          // Factories are only created on a single shard, so only precompile
+          // there.
+          if (ss::this_shard_id() == 0) {
+              ssx::spawn_with_gate(
+                _gate, [this, id] { return precompile_transform(id); });
+          }
+      });
     _notification_cleanups.emplace_back([this, plugin_notif_id] {
         _plugin_frontend->local().unregister_for_updates(plugin_notif_id);
     });
@@ -819,6 +835,33 @@ service::get_factory(model::transform_metadata meta) {
     co_return ss::make_foreign(factory);
 }
 
+ss::future<> service::precompile_transform(model::transform_id id) {
+    auto meta = _plugin_frontend->local().lookup_transform(id);
+    // Nothing to do if the transform was deleted or already has a factory.
+    if (!meta || _runtime->get_cached_factory(*meta)) {
+        co_return;
+    }
+    auto result = co_await _rpc_client->local().load_wasm_binary(
+      meta->source_ptr, wasm_binary_timeout);
+    if (result.has_error()) {
+        vlog(
+          tlog.debug,
+          "unable to load wasm binary to precompile transform {}: {}",
+          meta->name,
+          cluster::error_category().message(int(result.error())));
+        co_return;
+    }
+    auto fut = co_await ss::coroutine::as_future(
+      _runtime->precompile(std::move(result).value()));
+    if (fut.failed()) {
+        vlog(
+          tlog.warn,
+          "unable to precompile transform {}: {}",
+          meta->name,
+          fut.get_exception());
+    }
+}
+
 ss::future<model::cluster_transform_report>
 service::compute_node_local_report() {
     co_return co_await container().map_reduce0(
@@ -129,6 +129,10 @@ private:
 
     ss::future<> cleanup_wasm_binary(uuid_t);
 
+    // Compile a newly deployed transform's module ahead of time, so the
+    // compiled module is already cached when processors start.
+    ss::future<> precompile_transform(model::transform_id);
+
     ss::future<ss::optimized_optional<ss::shared_ptr<wasm::engine>>>
       create_engine(model::transform_metadata);
 
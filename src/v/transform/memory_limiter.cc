@@ -157,6 +157,21 @@ void memory_limiter::release(size_t amount) {
     _available = std::min(saturating_add(amount, _available), _max);
     notify();
 }
+void memory_limiter::grow(size_t amount) {
+    _max = saturating_add(_max, amount);
+    _available = saturating_add(_available, amount);
+    notify();
+}
+size_t memory_limiter::shrink(size_t amount) {
+    if (!_waiters.empty()) {
+        return 0;
+    }
+    amount = std::min(amount, _available);
+    _max -= amount;
+    _available -= amount;
+    return amount;
+}
+bool memory_limiter::has_waiters() const { return !_waiters.empty(); }
 size_t memory_limiter::max_memory() const { return _max; }
 size_t memory_limiter::used_memory() const { return _max - _available; }
 size_t memory_limiter::available_memory() const { return _available; }
@@ -106,6 +106,25 @@ public:
      */
     void release(size_t amount);
 
+    /**
+     * Increase the maximum memory of this limiter by `amount`, freeing any
+     * waiters that now fit.
+     */
+    void grow(size_t amount);
+
+    /**
+     * Decrease the maximum memory of this limiter by up to `amount`, taking
+     * only memory that is currently available.
+     *
+     * Nothing is taken while there are waiters, as they may be waiting for an
+     * amount that would no longer fit under the reduced limit.
+     *
+     * @returns the amount the limit was actually reduced by.
+     */
+    size_t shrink(size_t amount);
+
+    // If there are fibers waiting for memory from this limiter.
+    bool has_waiters() const;
     // The maximum memory that this limiter can provide access too.
     size_t max_memory() const;
     // The amount of currently used memory for this limiter.
@@ -41,13 +41,24 @@ void probe::setup_metrics(const model::transform_metadata& meta) {
         sm::description("The number of transform failures"),
         labels)
         .aggregate({sm::shard_label}));
+    metric_defs.emplace_back(
+      sm::make_gauge(
+        "read_buffer_bytes",
+        [this] { return _read_buffer_bytes; },
+        sm::description(
+          "The number of bytes read from the input topic that are buffered "
+          "waiting to be transformed"),
+        labels)
+        .aggregate({sm::shard_label}));
 
     auto output_topic_label = sm::label("output_topic");
     _lag.reserve(meta.output_topics.size());
     _write_bytes.reserve(meta.output_topics.size());
+    _write_buffer_bytes.reserve(meta.output_topics.size());
     for (size_t i = 0; i < meta.output_topics.size(); ++i) {
         _lag.push_back(0);
         _write_bytes.push_back(0);
+        _write_buffer_bytes.push_back(0);
         std::vector<sm::label_instance> output_topic_labels = labels;
         output_topic_labels.push_back(
           output_topic_label(meta.output_topics[i].tp()));
@@ -67,6 +78,15 @@ void probe::setup_metrics(const model::transform_metadata& meta) {
             sm::description("The number of bytes output by the transform"),
             output_topic_labels)
             .aggregate({sm::shard_label}));
+        metric_defs.emplace_back(
+          sm::make_gauge(
+            "write_buffer_bytes",
+            [this, i] { return _write_buffer_bytes[i]; },
+            sm::description(
+              "The number of bytes output by the transform that are buffered "
+              "waiting to be written to the output topic"),
+            output_topic_labels)
+            .aggregate({sm::shard_label}));
     }
 
     auto state_label = sm::label("state");
@@ -103,5 +123,12 @@ void probe::state_change(processor_state_change change) {
 void probe::report_lag(model::output_topic_index idx, int64_t delta) {
     _lag.at(idx()) += delta;
 }
+void probe::report_read_buffer_usage(int64_t delta) {
+    _read_buffer_bytes += delta;
+}
+void probe::report_write_buffer_usage(
+  model::output_topic_index idx, int64_t delta) {
+    _write_buffer_bytes.at(idx()) += delta;
+}
 
 } // namespace transform
@@ -34,6 +34,8 @@ public:
     void increment_failure();
     void state_change(processor_state_change);
     void report_lag(model::output_topic_index, int64_t delta);
+    void report_read_buffer_usage(int64_t delta);
+    void report_write_buffer_usage(model::output_topic_index, int64_t delta);
 
 private:
     friend class ProcessorTestFixture;
@@ -42,6 +44,8 @@ private:
     std::vector<uint64_t> _write_bytes;
     uint64_t _failures = 0;
     std::vector<uint64_t> _lag;
+    uint64_t _read_buffer_bytes = 0;
+    std::vector<uint64_t> _write_buffer_bytes;
     absl::flat_hash_map<model::transform_report::processor::state, uint64_t>
       _processor_state;
 };
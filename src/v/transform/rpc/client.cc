@@ -630,9 +630,42 @@ ss::future<cluster::errc> client::batch_offset_commit(
   model::partition_id coordinator,
   absl::btree_map<model::transform_offsets_key, model::transform_offsets_value>
     kvs) {
-    return retry([coordinator, kvs = std::move(kvs), this] {
-        return batch_offset_commit_once(coordinator, kvs);
-    });
+    auto holder = _gate.hold();
+    auto& pending = _pending_offset_commits[coordinator];
+    if (!pending) {
+        pending = std::make_unique<pending_offset_commit>();
+    }
+    for (const auto& [k, v] : kvs) {
+        pending->kvs.insert_or_assign(k, v);
+    }
+    auto committed = pending->committed.get_shared_future();
+    if (_offset_commits_in_flight.insert(coordinator).second) {
+        ssx::spawn_with_gate(_gate, [this, coordinator] {
+            return flush_offset_commits(coordinator);
+        });
+    }
+    co_return co_await std::move(committed);
+}
+
+ss::future<> client::flush_offset_commits(model::partition_id coordinator) {
+    while (true) {
+        auto it = _pending_offset_commits.find(coordinator);
+        if (it == _pending_offset_commits.end()) {
+            break;
+        }
+        auto pending = std::move(it->second);
+        _pending_offset_commits.erase(it);
+        auto fut = co_await ss::coroutine::as_future<cluster::errc>(
+          retry([this, coordinator, &kvs = pending->kvs] {
+              return batch_offset_commit_once(coordinator, kvs);
+          }));
+        if (fut.failed()) {
+            pending->committed.set_exception(fut.get_exception());
+        } else {
+            pending->committed.set_value(fut.get());
+        }
+    }
+    _offset_commits_in_flight.erase(coordinator);
 }
 
 ss::future<cluster::errc> client::batch_offset_commit_once(
@@ -25,8 +25,11 @@
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/shared_future.hh>
 
+#include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 #include <memory>
 #include <type_traits>
@@ -113,6 +116,9 @@ public:
 
     /**
      * Batch commit a group of offsets that all belong to a given coordinator.
+     *
+     * Commits for a coordinator that arrive while a previous one is in flight
+     * are coalesced into a single request once it completes.
      */
     ss::future<cluster::errc> batch_offset_commit(
       model::partition_id coordinator,
@@ -201,6 +207,7 @@ private:
 
     ss::future<result<model::partition_id, cluster::errc>>
       find_coordinator_once(model::transform_offsets_key);
+    ss::future<> flush_offset_commits(model::partition_id coordinator);
     ss::future<cluster::errc> batch_offset_commit_once(
       model::partition_id coordinator,
       absl::btree_map<
@@ -263,6 +270,22 @@ private:
     ss::sharded<local_service>* _local_service;
     ss::abort_source _as;
     ss::gate _gate;
+    /**
+     * Offsets waiting for the in flight commit to their coordinator, all of
+     * the waiting callers share the result of the next commit.
+     */
+    struct pending_offset_commit {
+        absl::btree_map<
+          model::transform_offsets_key,
+          model::transform_offsets_value>
+          kvs;
+        ss::shared_promise<cluster::errc> committed;
+    };
+    absl::flat_hash_map<
+      model::partition_id,
+      std::unique_ptr<pending_offset_commit>>
+      _pending_offset_commits;
+    absl::flat_hash_set<model::partition_id> _offset_commits_in_flight;
     mutex _wasm_binary_max_size_updater_mu{
       "client::wasm_binary_max_size_updater"};
     config::binding<size_t> _max_wasm_binary_size;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "model/fundamental.h"
+#include "model/ktp.h"
 #include "model/record_batch_reader.h"
 #include "model/transform.h"
 #include "transform/rpc/deps.h"
@@ -17,8 +18,11 @@
 #include "transform/rpc/serde.h"
 
 #include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/node_hash_map.h>
+
 #include <memory>
 
 namespace transform::rpc {
@@ -34,6 +38,8 @@ public:
       std::unique_ptr<partition_manager> partition_manager,
       std::unique_ptr<reporter>);
 
+    ss::future<> stop();
+
     ss::future<ss::chunked_fifo<transformed_topic_data_result>> produce(
       ss::chunked_fifo<transformed_topic_data> topic_data,
       model::timeout_clock::duration timeout);
@@ -70,13 +76,34 @@ private:
       ss::chunked_fifo<model::record_batch>,
       model::timeout_clock::duration);
 
+    ss::future<result<model::offset, cluster::errc>> coalesced_produce(
+      model::ktp,
+      ss::chunked_fifo<model::record_batch>,
+      model::timeout_clock::duration);
+    ss::future<> flush_produce_queue(model::ktp);
+
     ss::future<result<model::wasm_binary_iobuf, cluster::errc>>
       consume_wasm_binary_reader(
         model::record_batch_reader, model::timeout_clock::duration);
 
+    struct pending_produce {
+        ss::chunked_fifo<model::record_batch> batches;
+        model::timeout_clock::duration timeout;
+        ss::promise<result<model::offset, cluster::errc>> done;
+    };
+    // Produce requests from this shard for a single partition. While a
+    // replicate call for the partition is in flight, new requests queue up
+    // here and are written together by the next replicate call.
+    struct produce_queue {
+        ss::chunked_fifo<pending_produce> pending;
+        bool flushing = false;
+    };
+
     std::unique_ptr<topic_metadata_cache> _metadata_cache;
     std::unique_ptr<partition_manager> _partition_manager;
     std::unique_ptr<reporter> _reporter;
+    absl::node_hash_map<model::ktp, produce_queue> _produce_queues;
+    ss::gate _gate;
 };
 
 /**
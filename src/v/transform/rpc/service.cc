@@ -11,6 +11,7 @@
 
 #include "transform/rpc/service.h"
 
+#include "base/vassert.h"
 #include "cluster/types.h"
 #include "kafka/server/partition_proxy.h"
 #include "model/ktp.h"
@@ -22,6 +23,7 @@
 #include "model/transform.h"
 #include "raft/errc.h"
 #include "resource_mgmt/io_priority.h"
+#include "ssx/future-util.h"
 #include "storage/record_batch_builder.h"
 #include "storage/types.h"
 #include "transform/rpc/deps.h"
@@ -34,8 +36,11 @@
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/coroutine/switch_to.hh>
 
+#include <algorithm>
+
 #include <iterator>
 #include <memory>
 #include <system_error>
@@ -99,6 +104,8 @@ local_service::local_service(
   , _partition_manager(std::move(partition_manager))
   , _reporter(std::move(reporter)) {}
 
+ss::future<> local_service::stop() { co_await _gate.close(); }
+
 ss::future<ss::chunked_fifo<transformed_topic_data_result>>
 local_service::produce(
   ss::chunked_fifo<transformed_topic_data> topic_data,
@@ -126,7 +133,8 @@ local_service::produce(
 ss::future<transformed_topic_data_result> local_service::produce(
   transformed_topic_data data, model::timeout_clock::duration timeout) {
     auto ktp = model::ktp(data.tp.topic, data.tp.partition);
-    auto result = co_await produce(ktp, std::move(data.batches), timeout);
+    auto result = co_await coalesced_produce(
+      std::move(ktp), std::move(data.batches), timeout);
     auto ec = result.has_error() ? result.error() : cluster::errc::success;
     co_return transformed_topic_data_result(data.tp, ec);
 }
@@ -154,8 +162,14 @@ ss::future<result<model::offset, cluster::errc>> local_service::produce(
             co_return cluster::errc::invalid_request;
         }
     }
-    auto rdr = model::make_foreign_fragmented_memory_record_batch_reader(
-      std::move(batches));
+    // Batches produced by a transform on the output partition's shard skip
+    // the foreign wrapper, which exists to free the batches on their origin
+    // shard.
+    auto rdr = *shard == ss::this_shard_id()
+                 ? model::make_fragmented_memory_record_batch_reader(
+                     std::move(batches))
+                 : model::make_foreign_fragmented_memory_record_batch_reader(
+                     std::move(batches));
     // TODO: schema validation
     co_return co_await _partition_manager->invoke_on_shard(
       *shard,
@@ -174,6 +188,76 @@ ss::future<result<model::offset, cluster::errc>> local_service::produce(
       });
 }
 
+ss::future<result<model::offset, cluster::errc>>
+local_service::coalesced_produce(
+  model::ktp ktp,
+  ss::chunked_fifo<model::record_batch> batches,
+  model::timeout_clock::duration timeout) {
+    if (_gate.is_closed()) {
+        co_return cluster::errc::shutting_down;
+    }
+    auto& queue = _produce_queues[ktp];
+    queue.pending.push_back({.batches = std::move(batches), .timeout = timeout});
+    auto done = queue.pending.back().done.get_future();
+    if (!queue.flushing) {
+        queue.flushing = true;
+        ssx::spawn_with_gate(_gate, [this, ktp = std::move(ktp)]() mutable {
+            return flush_produce_queue(std::move(ktp));
+        });
+    }
+    co_return co_await std::move(done);
+}
+
+ss::future<> local_service::flush_produce_queue(model::ktp ktp) {
+    auto it = _produce_queues.find(ktp);
+    vassert(it != _produce_queues.end(), "missing produce queue for {}", ktp);
+    // node_hash_map keeps the queue at a stable address across suspensions.
+    auto& queue = it->second;
+    while (!queue.pending.empty()) {
+        auto inflight = std::exchange(queue.pending, {});
+        ss::chunked_fifo<model::record_batch> batches;
+        std::vector<int64_t> record_counts;
+        record_counts.reserve(inflight.size());
+        int64_t total_records = 0;
+        auto timeout = inflight.front().timeout;
+        for (auto& request : inflight) {
+            int64_t records = 0;
+            for (auto& batch : request.batches) {
+                records += batch.record_count();
+                batches.push_back(std::move(batch));
+            }
+            record_counts.push_back(records);
+            total_records += records;
+            timeout = std::min(timeout, request.timeout);
+        }
+        auto fut = co_await ss::coroutine::as_future(
+          produce(ktp, std::move(batches), timeout));
+        if (fut.failed()) {
+            auto ex = fut.get_exception();
+            for (auto& request : inflight) {
+                request.done.set_exception(ex);
+            }
+            continue;
+        }
+        auto r = fut.get();
+        if (r.has_error()) {
+            for (auto& request : inflight) {
+                request.done.set_value(r.error());
+            }
+            continue;
+        }
+        // The batches of a single replicate call are assigned contiguous
+        // offsets, so each request's last offset is found by counting back
+        // the records that were appended after it.
+        auto remaining = total_records;
+        for (size_t i = 0; auto& request : inflight) {
+            remaining -= record_counts[i++];
+            request.done.set_value(r.value() - model::offset(remaining));
+        }
+    }
+    _produce_queues.erase(it);
+}
+
 ss::future<result<stored_wasm_binary_metadata, cluster::errc>>
 local_service::store_wasm_binary(
   model::wasm_binary_iobuf data, model::timeout_clock::duration timeout) {
@@ -50,6 +50,7 @@
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/net/socket_defs.hh>
 #include <seastar/util/noncopyable_function.hh>
 
@@ -954,6 +955,25 @@ TEST_P(TransformRpcTest, ClientCanProduce) {
     EXPECT_EQ(leader_batches(ntp), batches);
 }
 
+TEST_P(TransformRpcTest, ClientCanProduceConcurrently) {
+    auto ntp = make_ntp("foo");
+    create_topic(model::topic_namespace(ntp.ns, ntp.tp.topic));
+    elect_leader(ntp, leader_node());
+    constexpr size_t num_producers = 8;
+    std::vector<ss::future<cluster::errc>> futures;
+    futures.reserve(num_producers);
+    for (size_t i = 0; i < num_producers; ++i) {
+        futures.push_back(
+          client()->produce(ntp.tp, record_batches::make().underlying));
+    }
+    for (auto& ec : ss::when_all_succeed(futures.begin(), futures.end()).get()) {
+        EXPECT_EQ(ec, cluster::errc::success)
+          << cluster::error_category().message(int(ec));
+    }
+    EXPECT_THAT(non_leader_batches(ntp), IsEmpty());
+    EXPECT_THAT(leader_batches(ntp), SizeIs(num_producers));
+}
+
 auto MaxBatchSizeIs(size_t size) {
     return Field(
       &cluster::topic_configuration::properties,
@@ -1075,6 +1095,43 @@ TEST_P(TransformRpcTest, TestTransformOffsetRPCs) {
     }
 }
 
+TEST_P(TransformRpcTest, TestConcurrentOffsetCommits) {
+    create_topic(model::transform_offsets_nt, 1);
+    model::ntp ntp(
+      model::kafka_internal_namespace,
+      model::transform_offsets_topic,
+      model::partition_id(0));
+    elect_leader(ntp, leader_node());
+    constexpr int32_t num_commits = 20;
+
+    std::vector<ss::future<cluster::errc>> commits;
+    commits.reserve(num_commits);
+    for (int32_t i = 0; i < num_commits; ++i) {
+        model::transform_offsets_key key;
+        key.id = model::transform_id(i % 2);
+        key.partition = model::partition_id(i);
+        commits.push_back(client()->batch_offset_commit(
+          model::partition_id(0),
+          {{key, model::transform_offsets_value{.offset = kafka::offset(i)}}}));
+    }
+    auto results
+      = ss::when_all_succeed(commits.begin(), commits.end()).get();
+    for (auto ec : results) {
+        EXPECT_EQ(ec, cluster::errc::success);
+    }
+
+    auto offsets = client()->list_committed_offsets().get().value();
+    EXPECT_EQ(offsets.size(), num_commits);
+    for (int32_t i = 0; i < num_commits; ++i) {
+        model::transform_offsets_key key;
+        key.id = model::transform_id(i % 2);
+        key.partition = model::partition_id(i);
+        auto it = offsets.find(key);
+        ASSERT_NE(it, offsets.end());
+        EXPECT_EQ(it->second.offset, kafka::offset(i));
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
   WorksLocallyAndRemotely,
   TransformRpcTest,
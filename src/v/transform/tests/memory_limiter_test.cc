@@ -11,6 +11,7 @@
 
 #include "test_utils/async.h"
 #include "transform/memory_limiter.h"
+#include "transform/transform_processor.h"
 
 #include <seastar/core/abort_source.hh>
 
@@ -150,6 +151,66 @@ TEST(MemoryLimiter, AlreadyAborted) {
     EXPECT_THROW(limiter.acquire(6, &as).get(), ss::abort_requested_exception);
 }
 
+TEST(MemoryLimiter, GrowWakesWaiters) {
+    ss::abort_source as;
+    memory_limiter limiter(10);
+    limiter.acquire(8, &as).get();
+    auto fut = limiter.acquire(5, &as);
+    tests::drain_task_queue().get();
+    EXPECT_FALSE(fut.available());
+    limiter.grow(3);
+    fut.get();
+    EXPECT_EQ(limiter.max_memory(), 13);
+    EXPECT_EQ(limiter.available_memory(), 0);
+}
+
+TEST(MemoryLimiter, ShrinkOnlyTakesAvailable) {
+    ss::abort_source as;
+    memory_limiter limiter(10);
+    limiter.acquire(6, &as).get();
+    EXPECT_EQ(limiter.shrink(8), 4);
+    EXPECT_EQ(limiter.max_memory(), 6);
+    EXPECT_EQ(limiter.available_memory(), 0);
+    limiter.release(6);
+    EXPECT_EQ(limiter.available_memory(), 6);
+    limiter.acquire(6, &as).get();
+    auto waiter = limiter.acquire(1, &as);
+    tests::drain_task_queue().get();
+    EXPECT_TRUE(limiter.has_waiters());
+    EXPECT_EQ(limiter.shrink(1), 0);
+    limiter.release(6);
+    waiter.get();
+    EXPECT_FALSE(limiter.has_waiters());
+}
+
+TEST(MemoryLimits, RebalancesTowardBlockedSide) {
+    ss::abort_source as;
+    memory_limits limits({.read = 100, .write = 100});
+    auto& read = limits.read_buffer_semaphore;
+    auto& write = limits.write_buffer_semaphore;
+    read.acquire(100, &as).get();
+    auto blocked = read.acquire(50, &as);
+    tests::drain_task_queue().get();
+    // Each step moves 1/20th of the total budget.
+    limits.rebalance();
+    EXPECT_EQ(read.max_memory(), 110);
+    EXPECT_EQ(write.max_memory(), 90);
+    for (int i = 0; i < 10; ++i) {
+        limits.rebalance();
+    }
+    blocked.get();
+    // The write side never drops below half of its configured size.
+    EXPECT_EQ(read.max_memory(), 150);
+    EXPECT_EQ(write.max_memory(), 50);
+    read.release(150);
+    // Once no one is blocked the budgets return to their configured sizes.
+    for (int i = 0; i < 10; ++i) {
+        limits.rebalance();
+    }
+    EXPECT_EQ(read.max_memory(), 100);
+    EXPECT_EQ(write.max_memory(), 100);
+}
+
 // NOLINTEND(*-magic-*)
 
 } // namespace
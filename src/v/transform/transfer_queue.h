@@ -18,7 +18,6 @@
 #include <seastar/core/semaphore.hh>
 
 #include <algorithm>
-#include <numeric>
 #include <optional>
 
 namespace transform {
@@ -75,6 +74,10 @@ public:
             co_return;
         }
         _entries.push_back(std::move(entry));
+        // The limiter's maximum can change while entries are queued, so keep
+        // track of exactly what was acquired for each entry.
+        _acquired.push_back(mem);
+        _memory_usage += mem;
         _cond_var.signal();
     }
 
@@ -91,8 +94,10 @@ public:
         }
         T entry = std::move(_entries.front());
         _entries.pop_front();
-        _memory_limiter->release(
-          std::min(entry.memory_usage(), _memory_limiter->max_memory()));
+        size_t mem = _acquired.front();
+        _acquired.pop_front();
+        _memory_usage -= mem;
+        _memory_limiter->release(mem);
         _cond_var.signal();
         co_return entry;
     }
@@ -109,7 +114,7 @@ public:
         if (as->abort_requested()) {
             co_return ss::chunked_fifo<T, items_per_chunk>{};
         }
-        _memory_limiter->release(memory_usage());
+        release_all();
         _cond_var.signal();
         co_return std::exchange(_entries, {});
     }
@@ -118,10 +123,16 @@ public:
      * Remove all entries from this queue.
      */
     void clear() noexcept {
-        _memory_limiter->release(memory_usage());
+        release_all();
         _entries.clear();
     }
 
+    /**
+     * The amount of memory acquired from the limiter by the entries currently
+     * in this queue.
+     */
+    size_t memory_usage() const { return _memory_usage; }
+
 private:
     ss::future<> wait_for_non_empty(ss::abort_source* as) noexcept {
         auto sub = as->subscribe([this]() noexcept { _cond_var.signal(); });
@@ -132,15 +143,14 @@ private:
         }
     }
 
-    size_t memory_usage() const {
-        size_t sum = 0;
-        for (const auto& entry : _entries) {
-            sum += entry.memory_usage();
-        }
-        return sum;
+    void release_all() noexcept {
+        _memory_limiter->release(std::exchange(_memory_usage, 0));
+        _acquired.clear();
     }
 
     ss::chunked_fifo<T, items_per_chunk> _entries;
+    ss::chunked_fifo<size_t, items_per_chunk> _acquired;
+    size_t _memory_usage = 0;
     ss::condition_variable _cond_var;
     memory_limiter* _memory_limiter;
 };
@@ -260,6 +260,7 @@ manager<ClockType>::manager(
           vlog(tlog.error, "unexpected transform manager error: {}", ex);
       })
   , _memory_limits(std::move(memory_limits))
+  , _rebalance_timer([this] { _memory_limits->rebalance(); })
   , _registry(std::move(r))
   , _processors(std::make_unique<processor_table<ClockType>>())
   , _processor_factory(std::move(f)) {}
@@ -269,12 +270,15 @@ manager<ClockType>::~manager() = default;
 
 template<typename ClockType>
 ss::future<> manager<ClockType>::start() {
+    constexpr auto rebalance_interval = std::chrono::seconds(1);
+    _rebalance_timer.arm_periodic(rebalance_interval);
     return ss::now();
 }
 
 template<typename ClockType>
 ss::future<> manager<ClockType>::stop() {
     vlog(tlog.info, "Stopping transform manager...");
+    _rebalance_timer.cancel();
     co_await _queue.shutdown();
     co_await _processors->clear();
     vlog(tlog.info, "Stopped transform manager.");
@@ -22,6 +22,7 @@
 #include <seastar/core/manual_clock.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
 #include <seastar/util/bool_class.hh>
 
 #include <absl/container/flat_hash_set.h>
@@ -159,6 +160,8 @@ private:
     model::node_id _self;
     ssx::work_queue _queue;
     std::unique_ptr<memory_limits> _memory_limits;
+    // Periodically moves buffer memory toward the bottlenecked stage.
+    ss::timer<ClockType> _rebalance_timer;
     std::unique_ptr<registry> _registry;
     std::unique_ptr<processor_table<ClockType>> _processors;
     std::unique_ptr<processor_factory> _processor_factory;
@@ -28,6 +28,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/queue.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/variant_utils.hh>
 
 #include <algorithm>
@@ -84,6 +85,32 @@ class processor_shutdown_exception : public std::exception {
 
 } // namespace
 
+void memory_limits::rebalance() {
+    // Move at most 1/20th of the total budget each time we're called so that
+    // the budgets don't thrash on short bursts.
+    constexpr size_t step_divisor = 20;
+    const size_t step = (_base.read + _base.write) / step_divisor;
+    auto shift =
+      [step](memory_limiter* from, size_t floor, memory_limiter* to) {
+          size_t max = from->max_memory();
+          if (max <= floor) {
+              return;
+          }
+          to->grow(from->shrink(std::min(step, max - floor)));
+      };
+    bool read_blocked = read_buffer_semaphore.has_waiters();
+    bool write_blocked = write_buffer_semaphore.has_waiters();
+    if (read_blocked && !write_blocked) {
+        shift(&write_buffer_semaphore, _base.write / 2, &read_buffer_semaphore);
+    } else if (write_blocked && !read_blocked) {
+        shift(&read_buffer_semaphore, _base.read / 2, &write_buffer_semaphore);
+    } else if (read_buffer_semaphore.max_memory() > _base.read) {
+        shift(&read_buffer_semaphore, _base.read, &write_buffer_semaphore);
+    } else if (write_buffer_semaphore.max_memory() > _base.write) {
+        shift(&write_buffer_semaphore, _base.write, &read_buffer_semaphore);
+    }
+}
+
 processor::processor(
   model::transform_id id,
   model::ntp ntp,
@@ -113,6 +140,7 @@ processor::processor(
       "expected the same number of output topics and sinks");
     _outputs.reserve(outputs.size());
     _last_reported_lag.reserve(outputs.size());
+    _last_reported_write_buffer_usage.reserve(outputs.size());
     for (size_t i : boost::irange(outputs.size())) {
         _outputs.emplace(
           outputs[i].tp,
@@ -122,6 +150,7 @@ processor::processor(
               &mem_limits->write_buffer_semaphore),
             .sink = std::move(sinks[i])});
         _last_reported_lag.push_back(0);
+        _last_reported_write_buffer_usage.push_back(0);
     }
     _default_output = &_outputs.at(outputs.front().tp);
     // The processor needs to protect against multiple stops (or calling stop
@@ -184,6 +213,7 @@ ss::future<> processor::stop() {
     for (const auto& [_, output] : _outputs) {
         report_lag(output.index, 0);
     }
+    report_buffer_usage();
 }
 
 ss::future<> processor::poll_sleep() {
@@ -300,6 +330,7 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
         }
         offset = kafka::next_offset(*last_offset);
         vlog(_logger.trace, "consumed up to offset {}", offset);
+        report_buffer_usage();
     }
 }
 
@@ -335,6 +366,7 @@ ss::future<> processor::run_transform_loop() {
         for (auto& [_, output] : _outputs) {
             co_await output.queue.push({offset}, &_as);
         }
+        report_buffer_usage();
     }
 }
 
@@ -349,6 +381,13 @@ ss::future<> processor::run_all_producers(
       });
 }
 
+// The output of a producer loop iteration: the (optional) batch to write and
+// the input offset that is fully processed once it is written.
+struct processor::staged_output {
+    std::optional<model::record_batch> batch;
+    kafka::offset offset;
+};
+
 ss::future<> processor::run_producer_loop(
   model::output_topic_index index,
   transfer_queue<transformed_output>* queue,
@@ -363,57 +402,111 @@ ss::future<> processor::run_producer_loop(
     // to suppress records until we've reached the previous offset we've
     // committed.
     bool suppress = true;
+    const kafka::offset resume_from = last_committed;
+    kafka::offset latest_offset = last_committed;
+    // The next batch is popped and built (and compressed) while the previous
+    // one is being written, so the round trip to the output partition
+    // overlaps with batching. Only one write is in flight at a time to keep
+    // the output ordered.
+    std::optional<ss::future<>> inflight;
+    std::exception_ptr ex;
     while (!_as.abort_requested()) {
-        auto popped = co_await queue->pop_all(&_as);
-        if (popped.empty()) {
-            continue;
-        }
-        kafka::offset latest_offset = last_committed;
-        ss::chunked_fifo<model::transformed_data> records;
-        for (auto& entry : popped) {
-            ss::visit(
-              entry.data,
-              [&records, &suppress](model::transformed_data& d) {
-                  if (suppress) {
-                      return;
-                  }
-                  records.push_back(std::move(d));
-              },
-              [&latest_offset, &suppress, last_committed](
-                kafka::offset offset) {
-                  // Stop supressing new records when we see new records from
-                  // the last commit.
-                  // This can happen if other sinks are behind this one and we
-                  // have to replay history.
-                  suppress = last_committed > offset;
-                  latest_offset = offset;
-              });
+        auto staged = co_await ss::coroutine::as_future(
+          stage_output(index, queue, resume_from, latest_offset, &suppress));
+        if (staged.failed()) {
+            ex = staged.get_exception();
+            break;
         }
-        if (!records.empty()) {
-            // TODO(rockwood): Limit batch sizes so we don't overshoot
-            // max batch size limits.
-            auto batch = model::transformed_data::make_batch(
-              model::timestamp::now(), std::move(records));
-            if (_meta.compression_mode != model::compression::none) {
-                batch = co_await storage::internal::compress_batch(
-                  _meta.compression_mode, std::move(batch));
+        auto output = staged.get();
+        latest_offset = output.offset;
+        report_buffer_usage();
+        if (inflight) {
+            auto written = co_await ss::coroutine::as_future(
+              std::exchange(inflight, std::nullopt).value());
+            if (written.failed()) {
+                ex = written.get_exception();
+                break;
             }
-            _probe->increment_write_bytes(index, batch.size_bytes());
-            ss::chunked_fifo<model::record_batch> batches;
-            batches.push_back(std::move(batch));
-            co_await sink->write(std::move(batches));
         }
-        if (latest_offset > last_committed) {
-            vlog(
-              _logger.trace,
-              "committing progress {} for output topic {}",
-              latest_offset,
-              index);
-            co_await _offset_tracker->commit_offset(index, latest_offset);
-            report_lag(index, _source->latest_offset() - latest_offset);
-            last_committed = latest_offset;
+        inflight = write_output(
+          index, sink, std::move(output), &last_committed);
+    }
+    if (inflight) {
+        auto written = co_await ss::coroutine::as_future(
+          std::exchange(inflight, std::nullopt).value());
+        if (written.failed() && !ex) {
+            ex = written.get_exception();
+        } else if (written.failed()) {
+            written.ignore_ready_future();
         }
     }
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+ss::future<processor::staged_output> processor::stage_output(
+  model::output_topic_index index,
+  transfer_queue<transformed_output>* queue,
+  kafka::offset resume_from,
+  kafka::offset latest_offset,
+  bool* suppress) {
+    ss::chunked_fifo<model::transformed_data> records;
+    auto popped = co_await queue->pop_all(&_as);
+    for (auto& entry : popped) {
+        ss::visit(
+          entry.data,
+          [&records, suppress](model::transformed_data& d) {
+              if (*suppress) {
+                  return;
+              }
+              records.push_back(std::move(d));
+          },
+          [&latest_offset, suppress, resume_from](kafka::offset offset) {
+              // Stop supressing new records when we see new records from
+              // the last commit.
+              // This can happen if other sinks are behind this one and we
+              // have to replay history.
+              *suppress = resume_from > offset;
+              latest_offset = offset;
+          });
+    }
+    staged_output output{.offset = latest_offset};
+    if (!records.empty()) {
+        // TODO(rockwood): Limit batch sizes so we don't overshoot
+        // max batch size limits.
+        auto batch = model::transformed_data::make_batch(
+          model::timestamp::now(), std::move(records));
+        if (_meta.compression_mode != model::compression::none) {
+            batch = co_await storage::internal::compress_batch(
+              _meta.compression_mode, std::move(batch));
+        }
+        _probe->increment_write_bytes(index, batch.size_bytes());
+        output.batch = std::move(batch);
+    }
+    co_return output;
+}
+
+ss::future<> processor::write_output(
+  model::output_topic_index index,
+  sink* sink,
+  staged_output output,
+  kafka::offset* last_committed) {
+    if (output.batch) {
+        ss::chunked_fifo<model::record_batch> batches;
+        batches.push_back(*std::move(output.batch));
+        co_await sink->write(std::move(batches));
+    }
+    if (output.offset > *last_committed) {
+        vlog(
+          _logger.trace,
+          "committing progress {} for output topic {}",
+          output.offset,
+          index);
+        co_await _offset_tracker->commit_offset(index, output.offset);
+        report_lag(index, _source->latest_offset() - output.offset);
+        *last_committed = output.offset;
+    }
 }
 
 template<typename... T>
@@ -439,6 +532,18 @@ void processor::report_lag(model::output_topic_index idx, int64_t lag) {
     _last_reported_lag[idx()] = lag;
 }
 
+void processor::report_buffer_usage() {
+    auto usage = static_cast<int64_t>(_consumer_transform_pipe.memory_usage());
+    _probe->report_read_buffer_usage(usage - _last_reported_read_buffer_usage);
+    _last_reported_read_buffer_usage = usage;
+    for (const auto& [_, output] : _outputs) {
+        auto& last = _last_reported_write_buffer_usage[output.index()];
+        usage = static_cast<int64_t>(output.queue.memory_usage());
+        _probe->report_write_buffer_usage(output.index, usage - last);
+        last = usage;
+    }
+}
+
 model::transform_id processor::id() const { return _id; }
 const model::ntp& processor::ntp() const { return _ntp; }
 const model::transform_metadata& processor::meta() const { return _meta; }
@@ -53,9 +53,26 @@ struct memory_limits {
     };
     explicit memory_limits(config cfg)
       : read_buffer_semaphore(cfg.read)
-      , write_buffer_semaphore(cfg.write) {}
+      , write_buffer_semaphore(cfg.write)
+      , _base(cfg) {}
+
+    /**
+     * Shift a slice of the buffer budget toward whichever side has fibers
+     * blocked waiting for memory, i.e. the side in front of the bottleneck
+     * stage. When neither (or both) sides are blocked the budgets drift back
+     * to their configured sizes.
+     *
+     * Only memory that is not in use is moved, and each side always keeps at
+     * least half of its configured size. This is expected to be called
+     * periodically.
+     */
+    void rebalance();
+
     memory_limiter read_buffer_semaphore;
     memory_limiter write_buffer_semaphore;
+
+private:
+    config _base;
 };
 
 /**
@@ -116,10 +133,21 @@ private:
       transfer_queue<transformed_output>*,
       sink*,
       kafka::offset);
+    struct staged_output;
+    ss::future<staged_output> stage_output(
+      model::output_topic_index,
+      transfer_queue<transformed_output>*,
+      kafka::offset resume_from,
+      kafka::offset latest_offset,
+      bool* suppress);
+    ss::future<> write_output(
+      model::output_topic_index, sink*, staged_output, kafka::offset*);
     ss::future<> poll_sleep();
     ss::future<absl::flat_hash_map<model::output_topic_index, kafka::offset>>
     load_latest_committed();
     void report_lag(model::output_topic_index, int64_t);
+    // Report the current occupancy of this processor's buffers to the probe.
+    void report_buffer_usage();
 
     template<typename... Future>
     ss::future<> when_all_shutdown(Future&&...);
@@ -152,5 +180,7 @@ private:
     prefix_logger _logger;
 
     std::vector<int64_t> _last_reported_lag;
+    int64_t _last_reported_read_buffer_usage = 0;
+    std::vector<int64_t> _last_reported_write_buffer_usage;
 };
 } // namespace transform
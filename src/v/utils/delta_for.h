@@ -705,11 +705,8 @@ public:
       , _decoder(std::move(decoder))
       , _pos(pos)
       , _size(size)
-      , _frame_initial(frame_initial_value) {
-        if (!_decoder->read(_read_buf)) {
-            _read_buf = _head;
-        }
-    }
+      , _frame_initial(frame_initial_value)
+      , _needs_read(true) {}
 
     /// Create iterator that points to the end
     deltafor_frame_const_iterator() = default;
@@ -719,12 +716,26 @@ public:
     value_t get_frame_initial_value() const noexcept { return _frame_initial; }
 
 private:
+    // The first row is decoded on first access. Column iterators hold an
+    // iterator for every frame after the one they point to, most of them
+    // are never used by point lookups.
+    void maybe_read_first_row() const {
+        if (_needs_read) {
+            _needs_read = false;
+            if (!_decoder->read(_read_buf)) {
+                _read_buf = _head;
+            }
+        }
+    }
+
     const value_t& dereference() const {
+        maybe_read_first_row();
         auto ix = _pos & index_mask;
         return _read_buf.at(ix);
     }
 
     void increment() {
+        maybe_read_first_row();
         _pos++;
         if ((_pos & index_mask) == 0) {
             // Read next buffer from the decoder
@@ -745,12 +756,13 @@ private:
         return other._pos == _pos && other._size == _size;
     }
 
-    std::array<value_t, buffer_depth> _read_buf{};
+    mutable std::array<value_t, buffer_depth> _read_buf{};
     std::array<value_t, buffer_depth> _head{};
-    std::optional<decoder_t> _decoder{std::nullopt};
+    mutable std::optional<decoder_t> _decoder{std::nullopt};
     uint32_t _pos{0};
     uint32_t _size{0};
     value_t _frame_initial;
+    mutable bool _needs_read{false};
 };
 
 struct share_frame_t {};
@@ -1540,9 +1552,16 @@ public:
     using delta_alg = details::delta_delta<value_t>;
     using base_t::base_t;
     using typename base_t::const_iterator;
+    using typename base_t::hint_t;
 
+    /// Find first value that matches the predicate. Only the frame that
+    /// contains it is decoded, starting from the row of `hint` if the hint
+    /// belongs to that frame. The row of the hint has to start with a value
+    /// lower or equal to `value`.
     const_iterator pred_search(
-      value_t value, std::regular_invocable<value_t, value_t> auto pred) const {
+      value_t value,
+      std::regular_invocable<value_t, value_t> auto pred,
+      const std::optional<hint_t>& hint = std::nullopt) const {
         auto it = this->_frames.begin();
         size_t index = 0;
         for (; it != this->_frames.end(); ++it) {
@@ -1555,7 +1574,14 @@ public:
             index += it->size();
         }
         if (it != this->_frames.end()) {
-            auto start = const_iterator(it, this->_frames.end(), 0, index);
+            auto start = [&] {
+                if (hint.has_value() && it->is_applicable(*hint)) {
+                    auto row_ix = hint->num_rows * details::FOR_buffer_depth;
+                    return const_iterator(
+                      it, this->_frames.end(), row_ix, *hint, index + row_ix);
+                }
+                return const_iterator(it, this->_frames.end(), 0, index);
+            }();
             for (; start != this->end(); ++start) {
                 if (pred(*start, value)) {
                     return start;
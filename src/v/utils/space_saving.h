@@ -0,0 +1,112 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/vassert.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+ * Approximate heavy hitters of a stream of weighted keys in bounded memory,
+ * using the Space-Saving algorithm (Metwally et al.).
+ *
+ * At most `capacity` keys are counted at a time. A key that isn't counted
+ * yet takes the place of the key with the smallest count and inherits that
+ * count as its error. The count of a key is therefore never underestimated
+ * and overestimated by at most its error, and every key whose true count is
+ * above total / capacity is guaranteed to be counted.
+ */
+template<
+  typename Key,
+  typename Hash = absl::Hash<Key>,
+  typename Eq = std::equal_to<Key>>
+class space_saving {
+public:
+    struct counter {
+        Key key;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    explicit space_saving(size_t capacity)
+      : _capacity(capacity) {
+        vassert(capacity > 0, "space_saving needs room for at least one key");
+        _counters.reserve(capacity);
+    }
+
+    template<typename K>
+    void add(const K& key, uint64_t weight) {
+        if (auto it = _counters.find(key); it != _counters.end()) {
+            it->second.count += weight;
+            return;
+        }
+        uint64_t floor = 0;
+        if (_counters.size() >= _capacity) {
+            auto min = std::min_element(
+              _counters.begin(),
+              _counters.end(),
+              [](const auto& a, const auto& b) {
+                  return a.second.count < b.second.count;
+              });
+            floor = min->second.count;
+            _counters.erase(min);
+        }
+        _counters.emplace(
+          Key(key), entry{.count = floor + weight, .error = floor});
+    }
+
+    /*
+     * The `n` keys with the largest counts, largest first.
+     */
+    std::vector<counter> top(size_t n) const {
+        std::vector<counter> result;
+        result.reserve(_counters.size());
+        for (const auto& [key, e] : _counters) {
+            result.push_back(
+              counter{.key = key, .count = e.count, .error = e.error});
+        }
+        n = std::min(n, result.size());
+        std::partial_sort(
+          result.begin(),
+          result.begin() + n,
+          result.end(),
+          [](const counter& a, const counter& b) { return a.count > b.count; });
+        result.resize(n);
+        return result;
+    }
+
+    /*
+     * The count of `key`, or zero if it isn't counted at the moment.
+     */
+    template<typename K>
+    uint64_t count(const K& key) const {
+        auto it = _counters.find(key);
+        return it == _counters.end() ? 0 : it->second.count;
+    }
+
+    size_t size() const { return _counters.size(); }
+    void clear() { _counters.clear(); }
+
+private:
+    struct entry {
+        uint64_t count;
+        uint64_t error;
+    };
+
+    size_t _capacity;
+    absl::flat_hash_map<Key, entry, Hash, Eq> _counters;
+};
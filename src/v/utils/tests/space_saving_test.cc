@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "utils/space_saving.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+BOOST_AUTO_TEST_CASE(test_space_saving_exact_below_capacity) {
+    space_saving<std::string> s(3);
+    s.add(std::string("a"), 5);
+    s.add(std::string("b"), 1);
+    s.add(std::string("a"), 2);
+    s.add(std::string("c"), 3);
+
+    auto top = s.top(10);
+    BOOST_REQUIRE_EQUAL(top.size(), 3);
+    BOOST_REQUIRE_EQUAL(top[0].key, "a");
+    BOOST_REQUIRE_EQUAL(top[0].count, 7);
+    BOOST_REQUIRE_EQUAL(top[1].key, "c");
+    BOOST_REQUIRE_EQUAL(top[2].key, "b");
+    for (const auto& c : top) {
+        BOOST_REQUIRE_EQUAL(c.error, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_space_saving_replaces_smallest) {
+    space_saving<std::string> s(2);
+    s.add(std::string("a"), 10);
+    s.add(std::string("b"), 2);
+    s.add(std::string("c"), 1);
+    BOOST_REQUIRE_EQUAL(s.size(), 2);
+
+    auto top = s.top(2);
+    BOOST_REQUIRE_EQUAL(top[0].key, "a");
+    BOOST_REQUIRE_EQUAL(top[0].count, 10);
+    // c took the place of b and inherited its count as the error bound
+    BOOST_REQUIRE_EQUAL(top[1].key, "c");
+    BOOST_REQUIRE_EQUAL(top[1].count, 3);
+    BOOST_REQUIRE_EQUAL(top[1].error, 2);
+
+    BOOST_REQUIRE_EQUAL(s.count(std::string("b")), 0);
+    BOOST_REQUIRE_EQUAL(s.count(std::string("c")), 3);
+    BOOST_REQUIRE_EQUAL(s.top(1).size(), 1);
+    s.clear();
+    BOOST_REQUIRE_EQUAL(s.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_space_saving_keeps_heavy_hitters) {
+    space_saving<int> s(4);
+    for (int i = 0; i < 1000; ++i) {
+        s.add(i % 2 == 0 ? -1 : i, 1);
+    }
+    // -1 is half the stream, far above total / capacity
+    auto top = s.top(1);
+    BOOST_REQUIRE_EQUAL(top[0].key, -1);
+    BOOST_REQUIRE_GE(top[0].count, 500);
+    BOOST_REQUIRE_LE(top[0].count - top[0].error, 500);
+}
@@ -24,6 +24,7 @@
 
 #include <sys/mman.h>
 
+#include <tuple>
 #include <unistd.h>
 
 namespace wasm {
@@ -32,8 +33,16 @@ heap_allocator::heap_allocator(config c)
   : _memset_chunk_size(c.memset_chunk_size) {
     size_t page_size = ::getpagesize();
     _size = ss::align_up(c.heap_memory_size, page_size);
+    size_t alignment = c.huge_pages ? huge_page_size : page_size;
     for (size_t i = 0; i < c.num_heaps; ++i) {
-        auto buffer = ss::allocate_aligned_buffer<uint8_t>(_size, page_size);
+        auto buffer = ss::allocate_aligned_buffer<uint8_t>(_size, alignment);
+        if (c.huge_pages) {
+            // This must happen before the memory is first touched below, the
+            // kernel only backs pages faulted in afterwards with huge pages.
+            // Failing is fine, e.g. the memory could already be backed by
+            // hugetlbfs or THP could be disabled.
+            std::ignore = ::madvise(buffer.get(), _size, MADV_HUGEPAGE);
+        }
         _memory_pool.push_back(
           async_zero_memory({std::move(buffer), _size}, _size));
     }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/units.h"
 
 #include <seastar/core/aligned_buffer.hh>
 #include <seastar/core/chunked_fifo.hh>
@@ -46,6 +47,12 @@ struct heap_memory {
 // Currently the allocation model requires a fixed sized heap at startup and
 // then those are handed out and reused as VM instances spin up and down.
 //
+// Every heap is zero-filled once at startup, which also faults in all of its
+// pages, and afterwards only the part an instance used is zero-filled in place
+// when it is returned. So instances never take page faults on first touch.
+// Optionally heaps are backed by transparent huge pages, which saves the TLB
+// misses of a guest touching memory all over its heap in a hot loop.
+//
 // Future work may allow variable sized heaps for VMs, but then we must deal
 // with memory fragmentation and support spinning down VMs to defragment our
 // pool of memory.
@@ -60,8 +67,14 @@ public:
         size_t num_heaps;
         // The amount of memory we zero out at once.
         size_t memset_chunk_size;
+        // If true, align heaps to the huge page size and ask the kernel to
+        // back them with transparent huge pages.
+        bool huge_pages = false;
     };
 
+    // The huge page size we align heaps to when `huge_pages` is enabled.
+    static constexpr size_t huge_page_size = 2_MiB;
+
     explicit heap_allocator(config);
 
     /**
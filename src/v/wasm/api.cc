@@ -15,9 +15,11 @@
 #include "wasmtime.h"
 
 namespace wasm {
-std::unique_ptr<runtime>
-runtime::create_default(pandaproxy::schema_registry::api* schema_reg) {
+std::unique_ptr<runtime> runtime::create_default(
+  pandaproxy::schema_registry::api* schema_reg,
+  std::optional<std::filesystem::path> compilation_cache_dir) {
     return wasmtime::create_runtime(
-      wasm::schema_registry::make_default(schema_reg));
+      wasm::schema_registry::make_default(schema_reg),
+      std::move(compilation_cache_dir));
 }
 } // namespace wasm
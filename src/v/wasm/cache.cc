@@ -13,10 +13,13 @@
 
 #include "logger.h"
 #include "model/transform.h"
+#include "ssx/future-util.h"
 
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
 #include <seastar/core/weak_ptr.hh>
 #include <seastar/core/when_all.hh>
 #include <seastar/coroutine/as_future.hh>
@@ -24,6 +27,8 @@
 
 #include <absl/container/btree_set.h>
 
+#include <vector>
+
 namespace wasm {
 
 namespace {
@@ -33,6 +38,11 @@ namespace {
  */
 constexpr auto default_gc_interval = std::chrono::minutes(10);
 
+/**
+ * How long an engine is kept running after its last user stopped it.
+ */
+constexpr auto default_engine_idle_timeout = std::chrono::seconds(30);
+
 template<typename Key, typename Value>
 ss::future<int64_t>
 gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
@@ -62,6 +72,10 @@ gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
 /**
  * Allows sharing an engine between multiple uses.
  *
+ * With a non-zero idle timeout the underlying engine keeps running when the
+ * last user stops, holding a reference to itself so it stays in the cache,
+ * and is only stopped if nobody started it again within the timeout.
+ *
  * Must live on a single core.
  */
 class shared_engine
@@ -69,11 +83,18 @@ class shared_engine
   , public ss::enable_shared_from_this<shared_engine>
   , public ss::weakly_referencable<shared_engine> {
 public:
-    explicit shared_engine(
+    shared_engine(
       ss::shared_ptr<engine> underlying,
-      ss::foreign_ptr<ss::shared_ptr<factory>> f)
+      ss::foreign_ptr<ss::shared_ptr<factory>> f,
+      ss::lowres_clock::duration idle_timeout,
+      ss::gate* gate)
       : _underlying(std::move(underlying))
-      , _factory(std::move(f)) {}
+      , _factory(std::move(f))
+      , _idle_timeout(idle_timeout)
+      , _gate(gate)
+      , _idle_timer([this] {
+          ssx::spawn_with_gate(*_gate, [this] { return stop_idle(); });
+      }) {}
 
     ss::future<> transform(
       model::record_batch batch,
@@ -100,17 +121,55 @@ public:
 
     ss::future<> start() override {
         auto u = co_await _mu.get_units();
-        if (_ref_count++ == 0) {
-            co_await _underlying->start();
+        if (_ref_count++ > 0) {
+            co_return;
         }
+        if (_idle_self) {
+            // Still running since the last user stopped, the caller holds a
+            // reference so dropping ours cannot destroy this engine.
+            _idle_timer.cancel();
+            _idle_self = nullptr;
+            co_return;
+        }
+        co_await _underlying->start();
     }
     ss::future<> stop() override {
         vassert(
           _ref_count > 0, "expected a call to start before a call to stop");
         auto u = co_await _mu.get_units();
-        if (--_ref_count == 0) {
+        if (--_ref_count > 0) {
+            co_return;
+        }
+        if (_idle_timeout > ss::lowres_clock::duration::zero()) {
+            _idle_self = shared_from_this();
+            _idle_timer.arm(_idle_timeout);
+            co_return;
+        }
+        co_await _underlying->stop();
+    }
+
+    /**
+     * Stop the underlying engine if it is only running because of the idle
+     * timeout.
+     */
+    ss::future<> stop_idle() {
+        // The last reference may be the one we drop here, so keep this alive
+        // until the lock is released.
+        auto self = shared_from_this();
+        auto u = co_await _mu.get_units();
+        if (!_idle_self) {
+            co_return;
+        }
+        _idle_timer.cancel();
+        try {
             co_await _underlying->stop();
+        } catch (...) {
+            vlog(
+              wasm_log.warn,
+              "failed to stop idle wasm engine: {}",
+              std::current_exception());
         }
+        _idle_self = nullptr;
     }
 
     ~shared_engine() override {
@@ -124,6 +183,11 @@ private:
     ss::shared_ptr<engine> _underlying;
     // This factory reference is here to keep the cache entry alive.
     ss::foreign_ptr<ss::shared_ptr<factory>> _factory;
+    ss::lowres_clock::duration _idle_timeout;
+    ss::gate* _gate;
+    ss::timer<ss::lowres_clock> _idle_timer;
+    // Set while the underlying engine runs without any users.
+    ss::shared_ptr<shared_engine> _idle_self;
 };
 
 /**
@@ -189,6 +253,22 @@ private:
 /** A cache for engines on a particular core. */
 class engine_cache {
 public:
+    explicit engine_cache(ss::lowres_clock::duration idle_timeout)
+      : _idle_timeout(idle_timeout) {}
+
+    ss::future<> stop() {
+        std::vector<ss::shared_ptr<shared_engine>> engines;
+        for (const auto& [_, engine] : _cache) {
+            if (engine) {
+                engines.push_back(engine->shared_from_this());
+            }
+        }
+        for (const auto& engine : engines) {
+            co_await engine->stop_idle();
+        }
+        co_await _gate.close();
+    }
+
     void
     put(model::offset offset, const ss::shared_ptr<shared_engine>& engine) {
         _cache.insert_or_assign(offset, engine->weak_from_this());
@@ -206,7 +286,12 @@ public:
 
     ss::future<int64_t> gc() { return gc_btree_map(&_cache); }
 
+    ss::lowres_clock::duration idle_timeout() const { return _idle_timeout; }
+    ss::gate* gate() { return &_gate; }
+
 private:
+    ss::lowres_clock::duration _idle_timeout;
+    ss::gate _gate;
     mutex _mu{"wasm_engine_cache"};
     absl::btree_map<model::offset, ss::weak_ptr<shared_engine>> _cache;
 };
@@ -253,7 +338,9 @@ public:
         auto foreign_this = co_await foreign_from_this();
         auto created = ss::make_shared<shared_engine>(
           co_await _underlying->make_engine(std::move(logger)),
-          std::move(foreign_this));
+          std::move(foreign_this),
+          _engine_cache->local().idle_timeout(),
+          _engine_cache->local().gate());
         _engine_cache->local().put(_offset, created);
         co_return created;
     }
@@ -272,12 +359,16 @@ private:
 };
 
 caching_runtime::caching_runtime(std::unique_ptr<runtime> u)
-  : caching_runtime(std::move(u), default_gc_interval) {}
+  : caching_runtime(
+      std::move(u), default_gc_interval, default_engine_idle_timeout) {}
 
 caching_runtime::caching_runtime(
-  std::unique_ptr<runtime> u, ss::lowres_clock::duration gc_interval)
+  std::unique_ptr<runtime> u,
+  ss::lowres_clock::duration gc_interval,
+  ss::lowres_clock::duration engine_idle_timeout)
   : _underlying(std::move(u))
   , _gc_interval(gc_interval)
+  , _engine_idle_timeout(engine_idle_timeout)
   , _gc_timer([this]() {
       ssx::spawn_with_gate(_gate, [this] { return do_gc().discard_result(); });
   }) {}
@@ -286,7 +377,7 @@ caching_runtime::~caching_runtime() = default;
 
 ss::future<> caching_runtime::start(runtime::config c) {
     co_await _underlying->start(c);
-    co_await _engine_caches.start();
+    co_await _engine_caches.start(_engine_idle_timeout);
     _gc_timer.arm(_gc_interval);
 }
 
@@ -366,4 +457,8 @@ ss::future<> caching_runtime::validate(model::wasm_binary_iobuf buf) {
     return _underlying->validate(std::move(buf));
 }
 
+ss::future<> caching_runtime::precompile(model::wasm_binary_iobuf buf) {
+    return _underlying->precompile(std::move(buf));
+}
+
 } // namespace wasm
@@ -22,7 +22,9 @@
 #include <seastar/util/noncopyable_function.hh>
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace wasm {
 
@@ -91,9 +93,14 @@ class runtime {
 public:
     /**
      * Create the default runtime.
+     *
+     * If `compilation_cache_dir` is set, compiled modules are persisted in
+     * that directory and reused across restarts.
      */
-    static std::unique_ptr<runtime>
-    create_default(pandaproxy::schema_registry::api*);
+    static std::unique_ptr<runtime> create_default(
+      pandaproxy::schema_registry::api*,
+      std::optional<std::filesystem::path> compilation_cache_dir
+      = std::nullopt);
 
     runtime() = default;
     runtime(const runtime&) = delete;
@@ -107,6 +114,8 @@ public:
             size_t per_core_pool_size_bytes;
             // per engine the max amount of memory
             size_t per_engine_memory_limit;
+            // back engine memory with transparent huge pages
+            bool huge_pages = false;
         };
         heap_memory heap_memory;
         struct stack_memory {
@@ -150,6 +159,14 @@ public:
      */
     virtual ss::future<> validate(model::wasm_binary_iobuf) = 0;
 
+    /**
+     * Compile a WebAssembly module ahead of time, so that later calls to
+     * `make_factory` with the same module don't need to compile it.
+     *
+     * This is a noop for runtimes that don't persist compiled modules.
+     */
+    virtual ss::future<> precompile(model::wasm_binary_iobuf) = 0;
+
     virtual ~runtime() = default;
 };
 
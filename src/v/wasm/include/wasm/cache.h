@@ -39,12 +39,20 @@ class cached_factory;
  * single shard. Ramifications of this is that failures to a single engine cause
  * the engine to be restarted and all users of a given engine must wait until
  * it's restarted to use the engine.
+ *
+ * Once the last user of a shared engine stops it, the engine is kept running
+ * for an idle timeout before it is stopped. Users that come back within the
+ * timeout (e.g. when partition leadership moves back and forth between
+ * brokers) reuse the already initialized instance instead of paying for a
+ * fresh instantiation and guest initialization.
  */
 class caching_runtime : public runtime {
 public:
     explicit caching_runtime(std::unique_ptr<runtime>);
     caching_runtime(
-      std::unique_ptr<runtime>, ss::lowres_clock::duration gc_interval);
+      std::unique_ptr<runtime>,
+      ss::lowres_clock::duration gc_interval,
+      ss::lowres_clock::duration engine_idle_timeout = {});
     caching_runtime(const caching_runtime&) = delete;
     caching_runtime(caching_runtime&&) = delete;
     caching_runtime& operator=(const caching_runtime&) = delete;
@@ -68,6 +76,8 @@ public:
 
     ss::future<> validate(model::wasm_binary_iobuf) override;
 
+    ss::future<> precompile(model::wasm_binary_iobuf) override;
+
 private:
     friend class WasmCacheTest;
 
@@ -92,6 +102,7 @@ private:
     absl::btree_map<model::offset, ss::weak_ptr<cached_factory>> _factory_cache;
     ss::sharded<engine_cache> _engine_caches;
     ss::lowres_clock::duration _gc_interval;
+    ss::lowres_clock::duration _engine_idle_timeout;
     ss::timer<ss::lowres_clock> _gc_timer;
     ss::gate _gate;
 };
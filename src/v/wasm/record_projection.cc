@@ -0,0 +1,263 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "record_projection.h"
+
+#include "base/seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <avro/Node.hh>
+#include <avro/NodeImpl.hh>
+#include <avro/Types.hh>
+
+#include <algorithm>
+
+namespace wasm {
+
+namespace {
+
+// Host functions run on the VM's stack, which has limited space, so bound the
+// recursion into nested values (recursive schemas can nest arbitrarily deep).
+constexpr int max_nesting_depth = 32;
+
+class cursor {
+public:
+    explicit cursor(bytes_view buf)
+      : _buf(buf) {}
+
+    size_t position() const { return _pos; }
+
+    uint64_t read_varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = next();
+            value |= uint64_t(b & 0x7FU) << shift;
+            if ((b & 0x80U) == 0) {
+                return value;
+            }
+        }
+        throw malformed_record_exception("varint is too long");
+    }
+
+    // Avro encodes ints and longs as zigzag varints.
+    int64_t read_long() {
+        uint64_t v = read_varint();
+        return static_cast<int64_t>((v >> 1U) ^ -(v & 1U));
+    }
+
+    void skip(uint64_t n) {
+        if (n > _buf.size() - _pos) {
+            throw malformed_record_exception(ss::format(
+              "unexpected end of record: skipping {} bytes at {} of {}",
+              n,
+              _pos,
+              _buf.size()));
+        }
+        _pos += n;
+    }
+
+private:
+    uint8_t next() {
+        if (_pos >= _buf.size()) {
+            throw malformed_record_exception("unexpected end of record");
+        }
+        return _buf[_pos++];
+    }
+
+    bytes_view _buf;
+    size_t _pos = 0;
+};
+
+int64_t read_avro_length(cursor* c) {
+    int64_t len = c->read_long();
+    if (len < 0) {
+        throw malformed_record_exception(
+          ss::format("invalid negative length: {}", len));
+    }
+    return len;
+}
+
+void skip_avro_value(const avro::NodePtr& node, cursor* c, int depth);
+
+// Arrays and maps are encoded as a series of blocks, each one prefixed with the
+// number of items in the block. A negative count is followed by the size of the
+// block in bytes, which allows skipping the block without looking at the items.
+template<typename Func>
+void skip_avro_blocks(cursor* c, Func skip_item) {
+    for (int64_t count = c->read_long(); count != 0; count = c->read_long()) {
+        if (count < 0) {
+            c->skip(read_avro_length(c));
+            continue;
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            skip_item();
+        }
+    }
+}
+
+void skip_avro_value(const avro::NodePtr& node, cursor* c, int depth) {
+    if (depth > max_nesting_depth) {
+        throw malformed_record_exception("record is nested too deeply");
+    }
+    switch (node->type()) {
+    case avro::AVRO_NULL:
+        return;
+    case avro::AVRO_BOOL:
+        c->skip(1);
+        return;
+    case avro::AVRO_INT:
+    case avro::AVRO_LONG:
+    case avro::AVRO_ENUM:
+        c->read_long();
+        return;
+    case avro::AVRO_FLOAT:
+        c->skip(sizeof(float));
+        return;
+    case avro::AVRO_DOUBLE:
+        c->skip(sizeof(double));
+        return;
+    case avro::AVRO_STRING:
+    case avro::AVRO_BYTES:
+        c->skip(read_avro_length(c));
+        return;
+    case avro::AVRO_FIXED:
+        c->skip(node->fixedSize());
+        return;
+    case avro::AVRO_RECORD:
+        for (size_t i = 0; i < node->leaves(); ++i) {
+            skip_avro_value(node->leafAt(i), c, depth + 1);
+        }
+        return;
+    case avro::AVRO_ARRAY:
+        skip_avro_blocks(
+          c, [&] { skip_avro_value(node->leafAt(0), c, depth + 1); });
+        return;
+    case avro::AVRO_MAP:
+        skip_avro_blocks(c, [&] {
+            c->skip(read_avro_length(c));
+            skip_avro_value(node->leafAt(1), c, depth + 1);
+        });
+        return;
+    case avro::AVRO_UNION: {
+        int64_t branch = c->read_long();
+        if (branch < 0 || static_cast<size_t>(branch) >= node->leaves()) {
+            throw malformed_record_exception(
+              ss::format("invalid union branch: {}", branch));
+        }
+        skip_avro_value(node->leafAt(branch), c, depth + 1);
+        return;
+    }
+    case avro::AVRO_SYMBOLIC:
+        skip_avro_value(avro::resolveSymbol(node), c, depth + 1);
+        return;
+    default:
+        throw malformed_record_exception(
+          ss::format("unsupported avro type: {}", int(node->type())));
+    }
+}
+
+// https://protobuf.dev/programming-guides/encoding/#structure
+enum class wire_type : uint8_t {
+    varint = 0,
+    i64 = 1,
+    len = 2,
+    i32 = 5,
+};
+
+} // namespace
+
+avro_projection::avro_projection(avro::ValidSchema schema)
+  : _schema(std::move(schema)) {
+    if (_schema.root()->type() != avro::AVRO_RECORD) {
+        throw std::invalid_argument(ss::format(
+          "avro projections require a record schema, got type: {}",
+          int(_schema.root()->type())));
+    }
+}
+
+void avro_projection::project(
+  bytes_view datum,
+  std::span<const uint32_t> fields,
+  field_span_callback cb) const {
+    const auto& root = _schema.root();
+    if (fields.empty()) {
+        return;
+    }
+    uint32_t last = *std::max_element(fields.begin(), fields.end());
+    if (last >= root->leaves()) {
+        throw malformed_record_exception(ss::format(
+          "field index {} out of range for record with {} fields",
+          last,
+          root->leaves()));
+    }
+    cursor c(datum);
+    for (uint32_t i = 0; i <= last; ++i) {
+        size_t start = c.position();
+        skip_avro_value(root->leafAt(i), &c, 1);
+        field_span span{
+          .offset = static_cast<uint32_t>(start),
+          .size = static_cast<uint32_t>(c.position() - start)};
+        for (size_t j = 0; j < fields.size(); ++j) {
+            if (fields[j] == i) {
+                cb(j, span);
+            }
+        }
+    }
+}
+
+void project_protobuf_fields(
+  bytes_view message,
+  std::span<const uint32_t> field_numbers,
+  field_span_callback cb) {
+    if (field_numbers.empty()) {
+        return;
+    }
+    cursor c(message);
+    while (c.position() < message.size()) {
+        constexpr unsigned wire_type_bits = 3;
+        constexpr uint64_t wire_type_mask = (1U << wire_type_bits) - 1;
+        uint64_t tag = c.read_varint();
+        uint64_t field_number = tag >> wire_type_bits;
+        uint64_t type = tag & wire_type_mask;
+        size_t start = c.position();
+        switch (static_cast<wire_type>(type)) {
+        case wire_type::varint:
+            c.read_varint();
+            break;
+        case wire_type::i64:
+            c.skip(sizeof(uint64_t));
+            break;
+        case wire_type::len:
+            c.skip(c.read_varint());
+            break;
+        case wire_type::i32:
+            c.skip(sizeof(uint32_t));
+            break;
+        default:
+            // This includes the deprecated group encoding.
+            throw malformed_record_exception(ss::format(
+              "unsupported protobuf wire type for field {}: {}",
+              field_number,
+              type));
+        }
+        field_span span{
+          .offset = static_cast<uint32_t>(start),
+          .size = static_cast<uint32_t>(c.position() - start)};
+        for (size_t j = 0; j < field_numbers.size(); ++j) {
+            if (field_numbers[j] == field_number) {
+                cb(j, span);
+            }
+        }
+    }
+}
+
+} // namespace wasm
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/bytes.h"
+
+#include <absl/functional/function_ref.h>
+#include <avro/ValidSchema.hh>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+namespace wasm {
+
+/**
+ * The location of a field's encoded value within a serialized record.
+ *
+ * Projections hand these back to guests instead of decoded values, so that a
+ * transform that only needs a few fields of a record doesn't have to
+ * deserialize (or copy) the whole record.
+ */
+struct field_span {
+    // The offset of a field that is not present in the record.
+    static constexpr uint32_t missing = std::numeric_limits<uint32_t>::max();
+
+    uint32_t offset = missing;
+    uint32_t size = 0;
+
+    bool operator==(const field_span&) const = default;
+};
+
+using field_span_callback = absl::FunctionRef<void(size_t, field_span)>;
+
+/**
+ * Thrown when a record cannot be projected because it's malformed.
+ */
+class malformed_record_exception : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Locates top level fields of Avro binary encoded records.
+ *
+ * Fields before the last requested field are skipped over without decoding
+ * them, and nothing after the last requested field is looked at.
+ */
+class avro_projection {
+public:
+    /**
+     * @throws std::invalid_argument if the schema is not a record.
+     */
+    explicit avro_projection(avro::ValidSchema);
+
+    /**
+     * Locate the fields with indexes `fields` in `datum`, `cb` is invoked for
+     * each requested field with its position in `fields`. The spans of
+     * strings and bytes include their length prefix.
+     *
+     * @throws malformed_record_exception if the datum doesn't match the schema
+     * or a field index is out of range.
+     */
+    void project(
+      bytes_view datum,
+      std::span<const uint32_t> fields,
+      field_span_callback cb) const;
+
+private:
+    avro::ValidSchema _schema;
+};
+
+/**
+ * Locate the top level fields with numbers `field_numbers` in a protobuf
+ * encoded message, `cb` is invoked for each occurrence of a requested field
+ * with its position in `field_numbers`.
+ *
+ * Fields can occur any number of times in a message, so `cb` is not invoked
+ * for fields that are missing and may be invoked multiple times for the same
+ * field, in which case the last occurrence wins for singular fields. The spans
+ * of length delimited fields include their length prefix.
+ *
+ * @throws malformed_record_exception if the message is malformed.
+ */
+void project_protobuf_fields(
+  bytes_view message,
+  std::span<const uint32_t> field_numbers,
+  field_span_callback cb);
+
+} // namespace wasm
@@ -12,12 +12,16 @@
 #include "schema_registry_module.h"
 
 #include "base/vassert.h"
+#include "bytes/streambuf.h"
 #include "ffi.h"
 #include "logger.h"
 #include "pandaproxy/schema_registry/seq_writer.h"
 #include "pandaproxy/schema_registry/types.h"
 #include "utils/named_type.h"
 
+#include <avro/Compiler.hh>
+#include <avro/Stream.hh>
+
 namespace wasm {
 
 namespace {
@@ -99,6 +103,33 @@ void write_encoded_schema_subject(
 constexpr int32_t SUCCESS = 0;
 constexpr int32_t SCHEMA_REGISTRY_NOT_ENABLED = -1;
 constexpr int32_t SCHEMA_REGISTRY_ERROR = -2;
+constexpr int32_t INVALID_ARGUMENT = -3;
+constexpr int32_t MALFORMED_RECORD = -4;
+
+// Each engine only needs a handful of schemas, so keep the cache small.
+constexpr size_t max_cached_projections = 16;
+
+template<typename Func>
+int32_t project_fields(
+  ffi::array<uint32_t> fields, ffi::array<uint32_t> spans, Func project) {
+    if (spans.size() != fields.size() * 2) {
+        return INVALID_ARGUMENT;
+    }
+    for (size_t i = 0; i < fields.size(); ++i) {
+        spans[i * 2] = field_span::missing;
+        spans[(i * 2) + 1] = 0;
+    }
+    try {
+        project([spans](size_t i, field_span span) {
+            spans[i * 2] = span.offset;
+            spans[(i * 2) + 1] = span.size;
+        });
+    } catch (const malformed_record_exception& ex) {
+        vlog(wasm_log.debug, "unable to project record: {}", ex);
+        return MALFORMED_RECORD;
+    }
+    return SUCCESS;
+}
 
 } // namespace
 
@@ -107,6 +138,8 @@ schema_registry_module::schema_registry_module(schema_registry* sr)
 
 void schema_registry_module::check_abi_version_0() {}
 
+void schema_registry_module::check_abi_version_1() {}
+
 ss::future<int32_t> schema_registry_module::get_schema_definition_len(
   pandaproxy::schema_registry::schema_id schema_id, uint32_t* size_out) {
     if (!_sr->is_enabled()) {
@@ -208,4 +241,64 @@ ss::future<int32_t> schema_registry_module::create_subject_schema(
     co_return SUCCESS;
 }
 
+ss::future<const avro_projection*> schema_registry_module::get_avro_projection(
+  pandaproxy::schema_registry::schema_id schema_id) {
+    auto it = _avro_projections.find(schema_id);
+    if (it != _avro_projections.end()) {
+        co_return it->second.get();
+    }
+    auto def = co_await _sr->get_schema_definition(schema_id);
+    if (def.type() != pandaproxy::schema_registry::schema_type::avro) {
+        throw std::invalid_argument(
+          ss::format("schema {} is not an avro schema", schema_id));
+    }
+    if (!def.refs().empty()) {
+        throw std::invalid_argument(ss::format(
+          "schema {} has references, which are not supported", schema_id));
+    }
+    iobuf_istream sis{def.shared_raw()()};
+    auto is = avro::istreamInputStream(sis.istream());
+    auto projection = std::make_unique<avro_projection>(
+      avro::compileJsonSchemaFromStream(*is));
+    if (_avro_projections.size() >= max_cached_projections) {
+        _avro_projections.clear();
+    }
+    auto [inserted, _] = _avro_projections.emplace(
+      schema_id, std::move(projection));
+    co_return inserted->second.get();
+}
+
+ss::future<int32_t> schema_registry_module::project_avro_fields(
+  pandaproxy::schema_registry::schema_id schema_id,
+  ffi::array<uint8_t> datum,
+  ffi::array<uint32_t> fields,
+  ffi::array<uint32_t> spans) {
+    if (!_sr->is_enabled()) {
+        co_return SCHEMA_REGISTRY_NOT_ENABLED;
+    }
+    const avro_projection* projection = nullptr;
+    try {
+        projection = co_await get_avro_projection(schema_id);
+    } catch (const std::invalid_argument& ex) {
+        vlog(wasm_log.warn, "unable to project avro record: {}", ex);
+        co_return INVALID_ARGUMENT;
+    } catch (const std::exception& ex) {
+        vlog(wasm_log.warn, "error fetching schema {}: {}", schema_id, ex);
+        co_return SCHEMA_REGISTRY_ERROR;
+    }
+    co_return project_fields(fields, spans, [&](field_span_callback cb) {
+        projection->project(bytes_view(datum.data(), datum.size()), fields, cb);
+    });
+}
+
+int32_t schema_registry_module::project_protobuf_fields(
+  ffi::array<uint8_t> message,
+  ffi::array<uint32_t> field_numbers,
+  ffi::array<uint32_t> spans) {
+    return project_fields(field_numbers, spans, [&](field_span_callback cb) {
+        wasm::project_protobuf_fields(
+          bytes_view(message.data(), message.size()), field_numbers, cb);
+    });
+}
+
 } // namespace wasm
@@ -13,8 +13,11 @@
 
 #include "ffi.h"
 #include "pandaproxy/schema_registry/types.h"
+#include "record_projection.h"
 #include "schema_registry.h"
 
+#include <absl/container/flat_hash_map.h>
+
 namespace wasm {
 
 /**
@@ -36,6 +39,9 @@ public:
     // Start ABI exports
     void check_abi_version_0();
 
+    // Version 1 adds record projections.
+    void check_abi_version_1();
+
     ss::future<int32_t> get_schema_definition_len(
       pandaproxy::schema_registry::schema_id, uint32_t*);
 
@@ -57,9 +63,41 @@ public:
       ffi::array<uint8_t>,
       pandaproxy::schema_registry::schema_id*);
 
+    /**
+     * Locate top level fields of an Avro encoded record (without the schema
+     * registry wire format header) with the given schema.
+     *
+     * `spans` must have two entries per requested field index, which are set
+     * to the offset and size of the field's encoded value within `datum`.
+     */
+    ss::future<int32_t> project_avro_fields(
+      pandaproxy::schema_registry::schema_id,
+      ffi::array<uint8_t> datum,
+      ffi::array<uint32_t> fields,
+      ffi::array<uint32_t> spans);
+
+    /**
+     * Locate top level fields of a protobuf encoded message by field number.
+     *
+     * `spans` must have two entries per requested field number, which are set
+     * to the offset and size of the field's encoded value within `message`.
+     * The offset of missing fields is set to UINT32_MAX.
+     */
+    int32_t project_protobuf_fields(
+      ffi::array<uint8_t> message,
+      ffi::array<uint32_t> field_numbers,
+      ffi::array<uint32_t> spans);
+
     // End ABI exports
 
 private:
+    ss::future<const avro_projection*>
+      get_avro_projection(pandaproxy::schema_registry::schema_id);
+
     schema_registry* _sr;
+    absl::flat_hash_map<
+      pandaproxy::schema_registry::schema_id,
+      std::unique_ptr<avro_projection>>
+      _avro_projections;
 };
 } // namespace wasm
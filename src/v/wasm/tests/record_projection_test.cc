@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "bytes/bytes.h"
+#include "wasm/record_projection.h"
+
+#include <avro/Compiler.hh>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace wasm {
+namespace {
+
+// NOLINTBEGIN(*-magic-*)
+
+constexpr std::string_view test_schema = R"({
+  "type": "record",
+  "name": "test",
+  "fields": [
+    {"name": "a", "type": "int"},
+    {"name": "b", "type": "string"},
+    {"name": "c", "type": {"type": "array", "items": "long"}},
+    {"name": "d", "type": ["null", "string"]},
+    {"name": "e", "type": "double"}
+  ]
+})";
+
+avro_projection make_projection() {
+    return avro_projection(
+      avro::compileJsonSchemaFromString(std::string(test_schema)));
+}
+
+bytes make_datum(bytes_view array_encoding) {
+    bytes datum;
+    // a = 5
+    datum.append(bytes{0x0A}.data(), 1);
+    // b = "hi"
+    datum.append(bytes{0x04, 'h', 'i'}.data(), 3);
+    // c
+    datum.append(array_encoding.data(), array_encoding.size());
+    // d = "x" (union branch 1)
+    datum.append(bytes{0x02, 0x02, 'x'}.data(), 3);
+    // e = 0.0
+    datum.append(bytes(8, 0).data(), 8);
+    return datum;
+}
+
+// c = [1, 2] as a single block
+const bytes counted_array = {0x04, 0x02, 0x04, 0x00};
+
+std::vector<field_span>
+project(const avro_projection& p, bytes_view datum, std::vector<uint32_t> f) {
+    std::vector<field_span> spans(f.size());
+    p.project(datum, f, [&spans](size_t i, field_span span) {
+        spans[i] = span;
+    });
+    return spans;
+}
+
+TEST(AvroProjection, LocatesFields) {
+    auto p = make_projection();
+    auto datum = make_datum(counted_array);
+    EXPECT_EQ(
+      project(p, datum, {3, 0, 1}),
+      (std::vector<field_span>{{8, 3}, {0, 1}, {1, 3}}));
+    EXPECT_EQ(
+      project(p, datum, {4, 2}),
+      (std::vector<field_span>{{11, 8}, {4, 4}}));
+}
+
+TEST(AvroProjection, SkipsSizedBlocks) {
+    auto p = make_projection();
+    // c = [1, 2] as a block with a negative count, followed by its size
+    auto datum = make_datum(bytes{0x03, 0x04, 0x02, 0x04, 0x00});
+    EXPECT_EQ(
+      project(p, datum, {2, 4}),
+      (std::vector<field_span>{{4, 5}, {12, 8}}));
+}
+
+TEST(AvroProjection, OnlyReadsRequiredPrefix) {
+    auto p = make_projection();
+    auto datum = make_datum(counted_array);
+    // Everything after the first field is garbage now.
+    std::fill(datum.begin() + 1, datum.end(), 0xFF);
+    EXPECT_EQ(project(p, datum, {0}), (std::vector<field_span>{{0, 1}}));
+    EXPECT_THROW(project(p, datum, {1}), malformed_record_exception);
+}
+
+TEST(AvroProjection, RejectsMalformedRecords) {
+    auto p = make_projection();
+    auto datum = make_datum(counted_array);
+    EXPECT_THROW(
+      project(p, bytes_view(datum.data(), 12), {4}),
+      malformed_record_exception);
+    EXPECT_THROW(project(p, datum, {5}), malformed_record_exception);
+    // An invalid union branch
+    datum[8] = 0x06;
+    EXPECT_THROW(project(p, datum, {3}), malformed_record_exception);
+}
+
+TEST(AvroProjection, RequiresRecordSchema) {
+    EXPECT_THROW(
+      avro_projection(avro::compileJsonSchemaFromString("\"string\"")),
+      std::invalid_argument);
+}
+
+TEST(ProtobufProjection, LocatesLastOccurrence) {
+    const bytes message = {
+      // field 1 = 150
+      0x08,
+      0x96,
+      0x01,
+      // field 2 = "ab"
+      0x12,
+      0x02,
+      'a',
+      'b',
+      // field 1 = 1
+      0x08,
+      0x01,
+    };
+    std::vector<uint32_t> fields = {2, 1, 7};
+    std::vector<field_span> spans(fields.size());
+    project_protobuf_fields(message, fields, [&spans](size_t i, field_span s) {
+        spans[i] = s;
+    });
+    EXPECT_EQ(spans, (std::vector<field_span>{{4, 3}, {8, 1}, {}}));
+}
+
+TEST(ProtobufProjection, RejectsMalformedMessages) {
+    std::vector<uint32_t> fields = {1};
+    auto noop = [](size_t, field_span) {};
+    // A length delimited field that is longer than the message
+    EXPECT_THROW(
+      project_protobuf_fields(bytes{0x0A, 0x05, 'a'}, fields, noop),
+      malformed_record_exception);
+    // A group
+    EXPECT_THROW(
+      project_protobuf_fields(bytes{0x0B, 0x0C}, fields, noop),
+      malformed_record_exception);
+}
+
+// NOLINTEND(*-magic-*)
+
+} // namespace
+} // namespace wasm
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "model/tests/random_batch.h"
+#include "model/transform.h"
+#include "test_utils/test.h"
+#include "wasm/ffi.h"
+#include "wasm/logger.h"
+#include "wasm/tests/wasm_logger.h"
+#include "wasm/transform_module.h"
+#include "wasm/wasi.h"
+
+#include <seastar/core/future.hh>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace wasm {
+namespace {
+
+class recording_callback final : public record_callback {
+public:
+    void pre_record() final { ++single_reads; }
+    void pre_records(size_t count) final { bulk_reads.push_back(count); }
+    ss::future<write_success>
+    emit(std::optional<model::topic_view>, model::transformed_data d) final {
+        emitted.push_back(std::move(d));
+        return ss::make_ready_future<write_success>(write_success::yes);
+    }
+    void post_record() final {}
+
+    size_t single_reads = 0;
+    std::vector<size_t> bulk_reads;
+    std::vector<model::transformed_data> emitted;
+};
+
+ss::future<int32_t> read_batch_header(transform_module* m) {
+    int64_t i64 = 0;
+    int32_t i32 = 0;
+    int16_t i16 = 0;
+    return m->read_batch_header(
+      &i64, &i32, &i32, &i16, &i32, &i64, &i64, &i64, &i16, &i32);
+}
+
+// An identity transform using the bulk ABI, reading records through a buffer
+// of buf_size bytes.
+ss::future<>
+identity_guest(transform_module* m, size_t buf_size, size_t* transitions) {
+    co_await read_batch_header(m);
+    std::vector<uint8_t> buf(buf_size);
+    while (true) {
+        ++*transitions;
+        auto n = co_await m->read_records(buf);
+        if (n <= 0) {
+            EXPECT_EQ(n, 0);
+            break;
+        }
+        ffi::reader r(ffi::array<uint8_t>(buf.data(), n));
+        ffi::sizer s;
+        std::vector<iobuf> payloads;
+        while (r.remaining_bytes() > 0) {
+            r.read_byte();
+            r.read_varint();
+            r.read_varint();
+            payloads.push_back(r.read_sized_iobuf());
+            s.append_with_length(payloads.back());
+            s.append_with_length(std::string_view{});
+        }
+        std::vector<uint8_t> out(s.total());
+        ffi::writer w(out);
+        for (const auto& payload : payloads) {
+            w.append_with_length(payload);
+            w.append_with_length(std::string_view{});
+        }
+        ++*transitions;
+        auto written = co_await m->write_records(out);
+        EXPECT_EQ(written, static_cast<int32_t>(payloads.size()));
+    }
+    // hands the batch back to the host and waits for the next one
+    co_await read_batch_header(m);
+}
+
+void run_identity(size_t buf_size, size_t records, size_t max_transitions) {
+    wasm_logger logger("test", &wasm_log);
+    wasi::preview1_module wasi({}, {}, &logger);
+    transform_module m(&wasi);
+    m.start();
+
+    auto ready = m.await_ready();
+    size_t transitions = 0;
+    auto guest = identity_guest(&m, buf_size, &transitions);
+    ready.get();
+
+    auto batch = model::test::make_random_batch(model::test::record_batch_spec{
+      .allow_compression = false,
+      .count = static_cast<int>(records),
+      // a key of 100 bytes, with the value and headers ~300 bytes per record
+      .record_sizes = std::vector<size_t>(records, 100),
+    });
+    std::vector<model::transformed_data> expected;
+    for (auto& r : batch.copy_records()) {
+        expected.push_back(model::transformed_data::from_record(std::move(r)));
+    }
+    recording_callback cb;
+    m.for_each_record_async(std::move(batch), &cb).get();
+    m.stop(std::make_exception_ptr(std::runtime_error("shutdown")));
+    std::move(guest).handle_exception([](const std::exception_ptr&) {}).get();
+
+    EXPECT_EQ(cb.emitted, expected);
+    EXPECT_EQ(cb.single_reads, 0U);
+    size_t surfaced = 0;
+    for (auto n : cb.bulk_reads) {
+        surfaced += n;
+    }
+    EXPECT_EQ(surfaced, records);
+    EXPECT_LE(transitions, max_transitions);
+}
+
+} // namespace
+
+TEST(TransformModuleTest, BulkReadWholeBatch) {
+    // one read and one write for the whole batch, then the empty read
+    run_identity(1_MiB, 100, 3);
+}
+
+TEST(TransformModuleTest, BulkReadInChunks) {
+    // ~15 records fit per read, a per record ABI needs 201 transitions
+    run_identity(4_KiB, 100, 40);
+}
+
+TEST(TransformModuleTest, BulkReadBufferTooSmall) {
+    wasm_logger logger("test", &wasm_log);
+    wasi::preview1_module wasi({}, {}, &logger);
+    transform_module m(&wasi);
+    m.start();
+
+    auto ready = m.await_ready();
+    auto guest = [](transform_module* m) -> ss::future<> {
+        co_await read_batch_header(m);
+        std::vector<uint8_t> buf(1);
+        auto n = co_await m->read_records(buf);
+        EXPECT_LT(n, 0);
+        co_await read_batch_header(m);
+    }(&m);
+    ready.get();
+
+    recording_callback cb;
+    m.for_each_record_async(
+       model::test::make_random_batch(model::test::record_batch_spec{
+         .allow_compression = false,
+         .count = 1,
+       }),
+       &cb)
+      .get();
+    m.stop(std::make_exception_ptr(std::runtime_error("shutdown")));
+    std::move(guest).handle_exception([](const std::exception_ptr&) {}).get();
+    EXPECT_TRUE(cb.bulk_reads.empty());
+}
+
+TEST(TransformModuleTest, BulkWriteRejectsInvalidBuffer) {
+    wasm_logger logger("test", &wasm_log);
+    wasi::preview1_module wasi({}, {}, &logger);
+    transform_module m(&wasi);
+    m.start();
+
+    auto ready = m.await_ready();
+    auto guest = [](transform_module* m) -> ss::future<> {
+        co_await read_batch_header(m);
+        // a length prefix larger than the buffer
+        ffi::sizer s;
+        s.append(int32_t(100));
+        std::vector<uint8_t> out(s.total());
+        ffi::writer w(out);
+        w.append(int32_t(100));
+        auto written = co_await m->write_records(out);
+        EXPECT_LT(written, 0);
+        co_await read_batch_header(m);
+    }(&m);
+    ready.get();
+
+    recording_callback cb;
+    m.for_each_record_async(
+       model::test::make_random_batch(model::test::record_batch_spec{
+         .allow_compression = false,
+         .count = 1,
+       }),
+       &cb)
+      .get();
+    m.stop(std::make_exception_ptr(std::runtime_error("shutdown")));
+    std::move(guest).handle_exception([](const std::exception_ptr&) {}).get();
+    EXPECT_TRUE(cb.emitted.empty());
+}
+
+} // namespace wasm
@@ -211,6 +211,25 @@ TEST(HeapAllocatorTest, MemoryIsZeroFilled) {
     EXPECT_THAT(allocated, Optional(HeapIsZeroed()));
 }
 
+TEST(HeapAllocatorTest, HugePagesAreAligned) {
+    size_t page_size = ::getpagesize();
+    heap_allocator allocator(heap_allocator::config{
+      .heap_memory_size = page_size * 3,
+      .num_heaps = 2,
+      .memset_chunk_size = default_memset_chunk_size,
+      .huge_pages = true,
+    });
+    heap_allocator::request req{.minimum = 0, .maximum = page_size * 3};
+    for (int i = 0; i < 2; ++i) {
+        auto allocated = allocator.allocate(req).get();
+        ASSERT_TRUE(allocated.has_value());
+        EXPECT_EQ(allocated->size, page_size * 3);
+        auto address = reinterpret_cast<uintptr_t>(allocated->data.get());
+        EXPECT_EQ(address % heap_allocator::huge_page_size, 0);
+        EXPECT_THAT(allocated, Optional(HeapIsZeroed()));
+    }
+}
+
 TEST(StackAllocatorParamsTest, TrackingCanBeEnabled) {
     stack_allocator allocator(stack_allocator::config{
       .tracking_enabled = true,
@@ -15,6 +15,8 @@
 #include "model/tests/randoms.h"
 #include "model/transform.h"
 #include "random/generators.h"
+#include "test_utils/async.h"
+#include "test_utils/test.h"
 #include "wasm/api.h"
 #include "wasm/cache.h"
 
@@ -129,6 +131,8 @@ public:
 
     ss::future<> validate(model::wasm_binary_iobuf) override { co_return; }
 
+    ss::future<> precompile(model::wasm_binary_iobuf) override { co_return; }
+
 private:
     state _state;
 };
@@ -150,8 +154,25 @@ public:
         _caching_runtime->start({}).get();
     }
 
-    void TearDown() override {
+    // Recreates the runtime with idle engines kept running for the timeout.
+    void restart_with_engine_idle_timeout(ss::lowres_clock::duration timeout) {
+        TearDown();
+        auto fr = std::make_unique<fake_runtime>();
+        _fake_runtime = fr.get();
+        _caching_runtime = std::make_unique<caching_runtime>(
+          std::move(fr), /*gc_interval=*/std::chrono::hours(1), timeout);
+        _caching_runtime->start({}).get();
+    }
+    void stop_runtime() {
         _caching_runtime->stop().get();
+        _stopped = true;
+    }
+
+    void TearDown() override {
+        if (!_stopped) {
+            _caching_runtime->stop().get();
+        }
+        _stopped = false;
         _fake_runtime = nullptr;
         _caching_runtime = nullptr;
     }
@@ -197,6 +218,7 @@ private:
     model::offset _offset = model::offset(0);
     fake_runtime* _fake_runtime;
     std::unique_ptr<caching_runtime> _caching_runtime;
+    bool _stopped = false;
 };
 
 void PrintTo(const ss::shared_ptr<factory>& f, std::ostream* os) {
@@ -336,4 +358,43 @@ TEST_F(WasmCacheTest, EngineReplacementBeforeGC) {
     EXPECT_EQ(state()->engines, 1);
 }
 
+TEST_F(WasmCacheTest, ReusesIdleEngines) {
+    restart_with_engine_idle_timeout(std::chrono::hours(1));
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine(std::make_unique<fake_logger>()).get();
+    engine->start().get();
+    engine->stop().get();
+    // The engine is still running without users
+    EXPECT_EQ(state()->running_engines, 1);
+    engine = nullptr;
+    EXPECT_EQ(state()->engines, 1);
+    engine = factory->make_engine(std::make_unique<fake_logger>()).get();
+    EXPECT_EQ(state()->engines, 1);
+    engine->start().get();
+    EXPECT_EQ(state()->running_engines, 1);
+    EXPECT_EQ(state()->engine_restarts, 0);
+    engine->stop().get();
+    engine = nullptr;
+    factory = nullptr;
+    // Stopping the runtime stops the idle engines
+    stop_runtime();
+    EXPECT_EQ(state()->running_engines, 0);
+    EXPECT_EQ(state()->engines, 0);
+}
+
+TEST_F(WasmCacheTest, StopsIdleEnginesAfterTimeout) {
+    restart_with_engine_idle_timeout(std::chrono::milliseconds(10));
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine(std::make_unique<fake_logger>()).get();
+    engine->start().get();
+    engine->stop().get();
+    engine = nullptr;
+    EXPECT_EQ(state()->running_engines, 1);
+    RPTEST_REQUIRE_EVENTUALLY(
+      std::chrono::seconds(10), [this] { return state()->engines == 0; });
+    EXPECT_EQ(state()->running_engines, 0);
+}
+
 } // namespace wasm
@@ -137,9 +137,22 @@ void WasmTestFixture::SetUpTestSuite() {
 
 void WasmTestFixture::SetUp() {
     _probe = std::make_unique<wasm::transform_probe>();
+    start_runtime(std::nullopt);
+    _meta = {
+      .name = model::transform_name(ss::sstring("test_wasm_transform")),
+      .input_topic = model::random_topic_namespace(),
+      .output_topics = {model::random_topic_namespace()},
+      .environment = {},
+      .source_ptr = model::offset(0),
+    };
+}
+
+void WasmTestFixture::start_runtime(
+  std::optional<std::filesystem::path> cache_dir) {
     auto sr = std::make_unique<fake_schema_registry>();
     _sr = sr.get();
-    _runtime = wasm::wasmtime::create_runtime(std::move(sr));
+    _runtime = wasm::wasmtime::create_runtime(
+      std::move(sr), std::move(cache_dir));
     // Support creating up to 4 instances in a test
     constexpr wasm::runtime::config wasm_runtime_config {
         .heap_memory = {
@@ -163,15 +176,9 @@ void WasmTestFixture::SetUp() {
         },
     };
     _runtime->start(wasm_runtime_config).get();
-    _meta = {
-      .name = model::transform_name(ss::sstring("test_wasm_transform")),
-      .input_topic = model::random_topic_namespace(),
-      .output_topics = {model::random_topic_namespace()},
-      .environment = {},
-      .source_ptr = model::offset(0),
-    };
 }
-void WasmTestFixture::TearDown() {
+
+void WasmTestFixture::stop_runtime() {
     if (_engine) {
         _engine->stop().get();
         _log_lines.clear();
@@ -180,9 +187,19 @@ void WasmTestFixture::TearDown() {
     _factory = nullptr;
     _runtime->stop().get();
     _runtime = nullptr;
+}
+
+void WasmTestFixture::TearDown() {
+    stop_runtime();
     _probe = nullptr;
 }
 
+void WasmTestFixture::restart_with_compilation_cache(
+  std::filesystem::path dir) {
+    stop_runtime();
+    start_runtime(std::move(dir));
+}
+
 void WasmTestFixture::load_wasm(const std::string& path) {
     auto wasm_file = ss::util::read_entire_file(path).get0();
     auto buf = model::wasm_binary_iobuf(std::make_unique<iobuf>());
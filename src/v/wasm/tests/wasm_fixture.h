@@ -22,7 +22,9 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <memory>
+#include <optional>
 #include <vector>
 
 class fake_schema_registry;
@@ -38,6 +40,8 @@ public:
     void TearDown() override;
 
     void load_wasm(const std::string& path);
+    // Recreate the runtime so that it persists compiled modules in `dir`.
+    void restart_with_compilation_cache(std::filesystem::path dir);
     model::record_batch make_tiny_batch();
     model::record_batch make_tiny_batch(iobuf record_value);
     model::record_batch transform(const model::record_batch&);
@@ -66,6 +70,9 @@ public:
     std::vector<ss::sstring> log_lines() const { return _log_lines; }
 
 private:
+    void start_runtime(std::optional<std::filesystem::path> cache_dir);
+    void stop_runtime();
+
     std::unique_ptr<wasm::runtime> _runtime;
     ss::shared_ptr<wasm::factory> _factory;
     ss::shared_ptr<wasm::engine> _engine;
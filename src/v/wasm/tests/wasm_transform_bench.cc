@@ -56,6 +56,7 @@ public:
                 .heap_memory = {
                   .per_core_pool_size_bytes = 20_MiB,
                   .per_engine_memory_limit = 20_MiB,
+                  .huge_pages = true,
                 },
                 .stack_memory = {
                   .debug_host_stack_usage = false,
@@ -17,6 +17,7 @@
 
 #include <seastar/core/internal/cpu_profiler.hh>
 #include <seastar/core/reactor.hh>
+#include <seastar/util/defer.hh>
 
 #include <absl/strings/str_cat.h>
 #include <avro/Compiler.hh>
@@ -29,6 +30,9 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <unistd.h>
+
 using namespace std::chrono_literals;
 
 TEST_F(WasmTestFixture, IdentityFunction) {
@@ -38,6 +42,38 @@ TEST_F(WasmTestFixture, IdentityFunction) {
     ASSERT_EQ(transformed.copy_records(), batch.copy_records());
 }
 
+TEST_F(WasmTestFixture, PersistsCompiledModules) {
+    auto dir = std::filesystem::temp_directory_path()
+               / ss::format("wasm_cache_{}", ::getpid());
+    auto cleanup = ss::defer([&dir] { std::filesystem::remove_all(dir); });
+    auto cached_modules = [&dir] {
+        std::vector<std::filesystem::path> paths;
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            paths.push_back(entry.path());
+        }
+        return paths;
+    };
+    auto batch = make_tiny_batch();
+    restart_with_compilation_cache(dir);
+    load_wasm("identity.wasm");
+    ASSERT_EQ(transform(batch).copy_records(), batch.copy_records());
+    auto modules = cached_modules();
+    ASSERT_EQ(modules.size(), 1);
+    auto size = std::filesystem::file_size(modules.front());
+    // After a restart the module is loaded from the cache.
+    restart_with_compilation_cache(dir);
+    load_wasm("identity.wasm");
+    ASSERT_EQ(transform(batch).copy_records(), batch.copy_records());
+    ASSERT_EQ(cached_modules(), modules);
+    // A corrupted module is discarded and the module is compiled again.
+    std::filesystem::resize_file(modules.front(), size / 2);
+    restart_with_compilation_cache(dir);
+    load_wasm("identity.wasm");
+    ASSERT_EQ(transform(batch).copy_records(), batch.copy_records());
+    ASSERT_EQ(cached_modules(), modules);
+    ASSERT_EQ(std::filesystem::file_size(modules.front()), size);
+}
+
 TEST_F(WasmTestFixture, CanRestartEngine) {
     load_wasm("identity.wasm");
     engine()->stop().get();
@@ -58,6 +58,52 @@ struct write_options {
     }
 };
 
+// The metadata preceding each record's payload for read_records
+template<typename T>
+void encode_record_metadata(const record_metadata& record, T* out) {
+    out->append_byte(record.attributes.value());
+    out->append(record.timestamp());
+    out->append(record.offset());
+    out->append(uint32_t(record.payload_size));
+}
+
+struct output_record {
+    std::optional<model::topic_view> topic;
+    model::transformed_data data;
+};
+
+/**
+ * Parses the records given to write_records, a sequence of
+ * <length prefixed record><length prefixed write options>. Nothing is parsed
+ * unless the whole buffer is valid.
+ */
+std::optional<ss::chunked_fifo<output_record>>
+parse_output_records(ffi::array<uint8_t> buffer) {
+    ss::chunked_fifo<output_record> records;
+    try {
+        ffi::reader r(buffer);
+        while (r.remaining_bytes() > 0) {
+            auto data = model::transformed_data::create_validated(
+              r.read_sized_iobuf());
+            auto options_size = r.read_varint();
+            auto options_offset = buffer.size() - r.remaining_bytes();
+            // bounds checks the options before slicing them
+            r.read_string_view(options_size);
+            auto options = write_options::parse(
+              buffer.subspan(options_offset, options_size));
+            if (!data || !options) {
+                return std::nullopt;
+            }
+            records.push_back(
+              {.topic = options->topic, .data = *std::move(data)});
+        }
+    } catch (const std::out_of_range& ex) {
+        vlog(wasm_log.debug, "write_records invalid buffer: {}", ex.what());
+        return std::nullopt;
+    }
+    return records;
+}
+
 } // namespace
 
 transform_module::transform_module(wasi::preview1_module* m)
@@ -122,6 +168,11 @@ void transform_module::check_abi_version_2() {
     // static analysis of the module to determine which ABI version to use.
 }
 
+void transform_module::check_abi_version_3() {
+    // This function does nothing at runtime, it's only an opportunity for
+    // static analysis of the module to determine which ABI version to use.
+}
+
 // NOLINTBEGIN(bugprone-easily-swappable-parameters)
 ss::future<int32_t> transform_module::read_batch_header(
   int64_t* base_offset,
@@ -260,6 +311,82 @@ ss::future<int32_t> transform_module::write_record_with_options(
                                            : INVALID_WRITE;
 }
 
+ss::future<int32_t> transform_module::read_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    if (_call_ctx->records.empty()) {
+        co_return 0;
+    }
+
+    // Callback that we finished processing the previously read records, if
+    // there are any.
+    if (
+      _call_ctx->records.size()
+      != size_t(_call_ctx->batch_header.record_count)) {
+        _call_ctx->callback->post_record();
+    }
+
+    co_await ss::coroutine::maybe_yield();
+
+    // Copy out as many whole records as fit, the guest calls again for the
+    // rest.
+    ffi::writer w(buf);
+    size_t count = 0;
+    model::timestamp latest;
+    while (!_call_ctx->records.empty()) {
+        const auto& record = _call_ctx->records.front();
+        ffi::sizer s;
+        encode_record_metadata(record, &s);
+        if (s.total() + record.payload_size > buf.size() - w.total()) {
+            break;
+        }
+        encode_record_metadata(record, &w);
+        // Drop the metadata we already parsed
+        _call_ctx->batch_data.trim_front(record.metadata_size);
+        w.append(_call_ctx->batch_data.share(0, record.payload_size));
+        _call_ctx->batch_data.trim_front(record.payload_size);
+        latest = record.timestamp;
+        _call_ctx->records.pop_front();
+        ++count;
+    }
+    if (count == 0) {
+        vlog(
+          wasm_log.debug,
+          "read_records invalid buffer size: {} < {}",
+          buf.size(),
+          _call_ctx->records.front().payload_size);
+        co_return INVALID_BUFFER;
+    }
+
+    _wasi_module->set_walltime(latest);
+
+    // Call back so we can refuel for all the records at once.
+    _call_ctx->callback->pre_records(count);
+
+    co_return int32_t(w.total());
+}
+
+ss::future<int32_t> transform_module::write_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    auto records = parse_output_records(buf);
+    if (!records) {
+        co_return INVALID_BUFFER;
+    }
+    int32_t count = 0;
+    for (auto& record : *records) {
+        auto result = co_await _call_ctx->callback->emit(
+          record.topic, std::move(record.data));
+        if (result != write_success::yes) {
+            co_return INVALID_WRITE;
+        }
+        ++count;
+    }
+    co_return count;
+}
+
 void transform_module::start() {
     _guest_cond_var.emplace();
     _host_cond_var.emplace();
@@ -68,6 +68,9 @@ public:
 
     // Called before surfacing a record to the VM.
     virtual void pre_record() = 0;
+    // Called before surfacing several records to the VM at once, in place of
+    // pre_record.
+    virtual void pre_records(size_t) { pre_record(); }
     // Called for each record output from the VM.
     virtual ss::future<write_success>
       emit(std::optional<model::topic_view>, model::transformed_data) = 0;
@@ -133,6 +136,7 @@ public:
 
     void check_abi_version_1();
     void check_abi_version_2();
+    void check_abi_version_3();
 
     ss::future<int32_t> read_batch_header(
       int64_t* base_offset,
@@ -157,6 +161,12 @@ public:
     ss::future<int32_t>
       write_record_with_options(ffi::array<uint8_t>, ffi::array<uint8_t>);
 
+    // ABI version 3 exchanges many records per call, see the README.
+
+    ss::future<int32_t> read_records(ffi::array<uint8_t>);
+
+    ss::future<int32_t> write_records(ffi::array<uint8_t>);
+
     // End ABI exports
 
 private:
@@ -16,6 +16,8 @@
 #include "base/vlog.h"
 #include "engine_probe.h"
 #include "ffi.h"
+#include "hashing/crc32c.h"
+#include "hashing/secure.h"
 #include "logger.h"
 #include "metrics/metrics.h"
 #include "metrics/prometheus_sanitize.h"
@@ -55,7 +57,10 @@
 
 #include <alloca.h>
 #include <csignal>
+#include <cstring>
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -86,6 +91,17 @@ constexpr size_t max_host_function_stack_usage = vm_stack_size
 // infinite loop workload on x86_64.
 constexpr uint64_t millisecond_fuel_amount = 2'000'000;
 
+// Part of the key for precompiled modules in the compilation cache, bump this
+// when changing the engine configuration in the runtime's constructor.
+//
+// wasmtime also refuses to load modules compiled by a different version or
+// with an incompatible configuration, so this is only so we don't attempt it.
+constexpr std::string_view compilation_cache_version = "v1";
+constexpr std::string_view compilation_cache_extension = ".cwasm";
+// Precompiled modules that haven't been loaded in this long are removed from
+// the compilation cache when the runtime starts.
+constexpr auto compilation_cache_retention = std::chrono::days(7);
+
 // The reserved memory for an instance of a WebAssembly VM.
 //
 // The wasmtime memory APIs don't allow us to pass information into an
@@ -149,7 +165,9 @@ private:
 
 class wasmtime_runtime : public runtime {
 public:
-    explicit wasmtime_runtime(std::unique_ptr<schema_registry> sr);
+    wasmtime_runtime(
+      std::unique_ptr<schema_registry> sr,
+      std::optional<std::filesystem::path> compilation_cache_dir);
 
     ss::future<> start(runtime::config c) override;
 
@@ -160,6 +178,8 @@ public:
 
     ss::future<> validate(model::wasm_binary_iobuf buf) override;
 
+    ss::future<> precompile(model::wasm_binary_iobuf buf) override;
+
     wasm_engine_t* engine() const;
 
     heap_allocator* heap_allocator();
@@ -171,6 +191,22 @@ public:
 private:
     void register_metrics();
 
+    using module_handle = handle<wasmtime_module_t, wasmtime_module_delete>;
+
+    // The path of a module's entry in the compilation cache.
+    ss::future<std::filesystem::path> precompiled_module_path(const iobuf&);
+
+    // These must only be called on the alien thread.
+    module_handle load_or_compile_module(
+      const model::transform_metadata&,
+      bytes_view,
+      const std::optional<std::filesystem::path>& cache_path);
+    module_handle compile_module(bytes_view);
+    module_handle load_precompiled_module(const std::filesystem::path&);
+    void
+    store_precompiled_module(wasmtime_module_t*, const std::filesystem::path&);
+    void prune_compilation_cache();
+
     static wasmtime_error_t* allocate_stack_memory(
       void* env, size_t size, wasmtime_stack_memory_t* memory_ret);
 
@@ -194,6 +230,7 @@ private:
 
     handle<wasm_engine_t, &wasm_engine_delete> _engine;
     std::unique_ptr<schema_registry> _sr;
+    std::optional<std::filesystem::path> _compilation_cache_dir;
     ssx::singleton_thread_worker _alien_thread;
     ss::sharded<wasm::heap_allocator> _heap_allocator;
     ss::sharded<stack_allocator> _stack_allocator;
@@ -823,6 +860,13 @@ private:
                 return _cb(topic, std::move(data));
             }
 
+            void pre_records(size_t count) final {
+                handle<wasmtime_error_t, wasmtime_error_delete> error(
+                  wasmtime_context_set_fuel(_context, _fuel_amt * count));
+                check_error(error.get());
+                _measurement = _probe->latency_measurement();
+            }
+
             void post_record() final { _measurement = nullptr; }
 
         private:
@@ -1256,10 +1300,13 @@ void register_transform_module(
     host_function<&transform_module::name>::reg(linker, #name, ssc)
     REG_HOST_FN(check_abi_version_1);
     REG_HOST_FN(check_abi_version_2);
+    REG_HOST_FN(check_abi_version_3);
     REG_HOST_FN(read_batch_header);
     REG_HOST_FN(read_next_record);
     REG_HOST_FN(write_record);
     REG_HOST_FN(write_record_with_options);
+    REG_HOST_FN(read_records);
+    REG_HOST_FN(write_records);
 #undef REG_HOST_FN
 }
 
@@ -1269,11 +1316,14 @@ void register_sr_module(
 #define REG_HOST_FN(name)                                                      \
     host_function<&schema_registry_module::name>::reg(linker, #name, ssc)
     REG_HOST_FN(check_abi_version_0);
+    REG_HOST_FN(check_abi_version_1);
     REG_HOST_FN(get_schema_definition);
     REG_HOST_FN(get_schema_definition_len);
     REG_HOST_FN(get_subject_schema);
     REG_HOST_FN(get_subject_schema_len);
     REG_HOST_FN(create_subject_schema);
+    REG_HOST_FN(project_avro_fields);
+    REG_HOST_FN(project_protobuf_fields);
 #undef REG_HOST_FN
 }
 
@@ -1305,8 +1355,11 @@ private:
     schema_registry* _sr;
 };
 
-wasmtime_runtime::wasmtime_runtime(std::unique_ptr<schema_registry> sr)
-  : _sr(std::move(sr)) {
+wasmtime_runtime::wasmtime_runtime(
+  std::unique_ptr<schema_registry> sr,
+  std::optional<std::filesystem::path> compilation_cache_dir)
+  : _sr(std::move(sr))
+  , _compilation_cache_dir(std::move(compilation_cache_dir)) {
     wasm_config_t* config = wasm_config_new();
 
     // Spend more time compiling so that we can have faster code.
@@ -1402,11 +1455,15 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
       .heap_memory_size = aligned_instance_limit,
       .num_heaps = num_heaps,
       .memset_chunk_size = memset_chunk_size,
+      .huge_pages = c.heap_memory.huge_pages,
     });
     co_await _stack_allocator.start(stack_allocator::config{
       .tracking_enabled = c.stack_memory.debug_host_stack_usage,
     });
     co_await _alien_thread.start({.name = "wasm"});
+    if (_compilation_cache_dir) {
+        co_await _alien_thread.submit([this] { prune_compilation_cache(); });
+    }
     co_await ss::smp::invoke_on_all([] {
         // wasmtime needs some signals for it's handling, make sure we
         // unblock them.
@@ -1455,20 +1512,16 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
                      ? &_stack_allocator
                      : nullptr,
     };
+    std::optional<std::filesystem::path> cache_path;
+    if (_compilation_cache_dir) {
+        cache_path = co_await precompiled_module_path(*buf());
+    }
     size_t memory_usage_size = co_await _alien_thread.submit(
-      [this, &meta, buf = buf().get(), &preinitialized, &ssc] {
-          vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+      [this, &meta, buf = buf().get(), &preinitialized, &ssc, &cache_path] {
           // This can be a large contiguous allocation, however it happens
           // on an alien thread so it bypasses the seastar allocator.
           bytes b = iobuf_to_bytes(*buf);
-          wasmtime_module_t* user_module_ptr = nullptr;
-          handle<wasmtime_error_t, wasmtime_error_delete> error{
-            wasmtime_module_new(
-              _engine.get(), b.data(), b.size(), &user_module_ptr)};
-          check_error(error.get());
-          handle<wasmtime_module_t, wasmtime_module_delete> user_module{
-            user_module_ptr};
-          wasm_log.info("Finished compiling wasm module {}", meta.name);
+          auto user_module = load_or_compile_module(meta, b, cache_path);
 
           handle<wasmtime_linker_t, wasmtime_linker_delete> linker{
             wasmtime_linker_new(_engine.get())};
@@ -1477,10 +1530,11 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
           register_sr_module(linker.get(), ssc);
           register_wasi_module(linker.get(), ssc);
 
-          error.reset(wasmtime_linker_instantiate_pre(
+          handle<wasmtime_error_t, wasmtime_error_delete> error{
+            wasmtime_linker_instantiate_pre(
             linker.get(),
             user_module.get(),
-            out_handle(preinitialized->_underlying)));
+            out_handle(preinitialized->_underlying))};
           preinitialized->_memory_limits = lookup_memory_limits(
             user_module.get());
           check_error(error.get());
@@ -1505,6 +1559,189 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
       _sr.get());
 }
 
+ss::future<std::filesystem::path>
+wasmtime_runtime::precompiled_module_path(const iobuf& buf) {
+    hash_sha256 h;
+    h.update(compilation_cache_version);
+    for (const auto& frag : buf) {
+        h.update(std::string_view(frag.get(), frag.size()));
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return *_compilation_cache_dir
+      / ss::format("{}{}", to_hex(h.reset()), compilation_cache_extension);
+}
+
+wasmtime_runtime::module_handle wasmtime_runtime::load_or_compile_module(
+  const model::transform_metadata& meta,
+  bytes_view b,
+  const std::optional<std::filesystem::path>& cache_path) {
+    if (cache_path) {
+        auto user_module = load_precompiled_module(*cache_path);
+        if (user_module) {
+            wasm_log.info("Loaded precompiled wasm module {}", meta.name);
+            return user_module;
+        }
+    }
+    vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+    auto user_module = compile_module(b);
+    wasm_log.info("Finished compiling wasm module {}", meta.name);
+    if (cache_path) {
+        store_precompiled_module(user_module.get(), *cache_path);
+    }
+    return user_module;
+}
+
+wasmtime_runtime::module_handle
+wasmtime_runtime::compile_module(bytes_view b) {
+    module_handle user_module;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{wasmtime_module_new(
+      _engine.get(), b.data(), b.size(), out_handle(user_module))};
+    check_error(error.get());
+    return user_module;
+}
+
+// Precompiled modules are stored as a crc32c of the serialized module followed
+// by the serialized module. wasmtime trusts the contents of serialized modules,
+// so the checksum protects against loading a torn or corrupted file.
+wasmtime_runtime::module_handle wasmtime_runtime::load_precompiled_module(
+  const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+    std::vector<char> contents(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    auto discard = [&path](std::string_view reason) {
+        vlog(
+          wasm_log.warn,
+          "discarding precompiled wasm module {}: {}",
+          path.string(),
+          reason);
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return module_handle(nullptr);
+    };
+    uint32_t checksum = 0;
+    if (contents.size() <= sizeof(checksum)) {
+        return discard("file is truncated");
+    }
+    std::memcpy(&checksum, contents.data(), sizeof(checksum));
+    std::string_view serialized(
+      contents.data() + sizeof(checksum), contents.size() - sizeof(checksum));
+    crc::crc32c crc;
+    crc.extend(serialized.data(), serialized.size());
+    if (crc.value() != checksum) {
+        return discard("checksum mismatch");
+    }
+    module_handle user_module;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{
+      wasmtime_module_deserialize(
+        _engine.get(),
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        reinterpret_cast<const uint8_t*>(serialized.data()),
+        serialized.size(),
+        out_handle(user_module))};
+    try {
+        check_error(error.get());
+    } catch (const wasm_exception& ex) {
+        return discard(ex.what());
+    }
+    // Loading a module refreshes its modification time, which is used to
+    // prune modules that are no longer used.
+    std::error_code ec;
+    std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), ec);
+    return user_module;
+}
+
+void wasmtime_runtime::store_precompiled_module(
+  wasmtime_module_t* user_module, const std::filesystem::path& path) {
+    wasm_byte_vec_t serialized{.size = 0, .data = nullptr};
+    handle<wasmtime_error_t, wasmtime_error_delete> error{
+      wasmtime_module_serialize(user_module, &serialized)};
+    auto cleanup = ss::defer(
+      [&serialized]() noexcept { wasm_byte_vec_delete(&serialized); });
+    try {
+        check_error(error.get());
+    } catch (const wasm_exception& ex) {
+        vlog(wasm_log.warn, "unable to serialize wasm module: {}", ex);
+        return;
+    }
+    crc::crc32c crc;
+    crc.extend(serialized.data, serialized.size);
+    uint32_t checksum = crc.value();
+    // Write to a temporary file and move it into place, so that readers never
+    // observe a partially written module.
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    std::error_code ec;
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        file.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+        file.write(
+          serialized.data, static_cast<std::streamsize>(serialized.size));
+        if (!file) {
+            ec = std::make_error_code(std::errc::io_error);
+        }
+    }
+    if (!ec) {
+        std::filesystem::rename(tmp_path, path, ec);
+    }
+    if (ec) {
+        vlog(
+          wasm_log.warn,
+          "unable to write precompiled wasm module {}: {}",
+          path.string(),
+          ec.message());
+        std::filesystem::remove(tmp_path, ec);
+    }
+}
+
+void wasmtime_runtime::prune_compilation_cache() {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::create_directories(*_compilation_cache_dir, ec);
+    if (ec) {
+        vlog(
+          wasm_log.warn,
+          "unable to create wasm compilation cache directory {}: {}",
+          _compilation_cache_dir->string(),
+          ec.message());
+        return;
+    }
+    auto cutoff = fs::file_time_type::clock::now()
+                  - compilation_cache_retention;
+    for (const auto& entry : fs::directory_iterator(
+           *_compilation_cache_dir, ec)) {
+        // This also cleans up temporary files from interrupted writes.
+        bool stale = entry.path().extension() != compilation_cache_extension
+                     || entry.last_write_time(ec) < cutoff;
+        if (stale) {
+            vlog(
+              wasm_log.debug, "pruning wasm module {}", entry.path().string());
+            fs::remove(entry.path(), ec);
+        }
+    }
+}
+
+ss::future<> wasmtime_runtime::precompile(model::wasm_binary_iobuf buf) {
+    if (!_compilation_cache_dir) {
+        co_return;
+    }
+    auto path = co_await precompiled_module_path(*buf());
+    co_await _alien_thread.submit([this, &path, buf = buf().get()] {
+        if (std::filesystem::exists(path)) {
+            return;
+        }
+        bytes b = iobuf_to_bytes(*buf);
+        auto user_module = compile_module(b);
+        store_precompiled_module(user_module.get(), path);
+        vlog(wasm_log.info, "Precompiled wasm module {}", path.string());
+    });
+}
+
 wasm_engine_t* wasmtime_runtime::engine() const { return _engine.get(); }
 heap_allocator* wasmtime_runtime::heap_allocator() {
     return &_heap_allocator.local();
@@ -1648,7 +1885,7 @@ bool is_exported_memory(const parser::module_export& mod_export) {
 }
 
 bool is_transform_abi_check_fn(const parser::module_import& mod_import) {
-    constexpr std::array version = {1, 2};
+    constexpr std::array version = {1, 2, 3};
     return absl::c_any_of(version, [&mod_import](int version) {
         return mod_import
                == parser::module_import{
@@ -1672,7 +1909,8 @@ bool is_invalid_sr_abi_check_fn(const parser::module_import& mod_import) {
     if (mod_import.description != void_fn) {
         return true;
     }
-    return mod_import.item_name != "check_abi_version_0";
+    return mod_import.item_name != "check_abi_version_0"
+           && mod_import.item_name != "check_abi_version_1";
 }
 
 ss::future<> wasmtime_runtime::validate(model::wasm_binary_iobuf buf) {
@@ -1739,8 +1977,11 @@ ss::future<> wasmtime_runtime::validate(model::wasm_binary_iobuf buf) {
 
 } // namespace
 
-std::unique_ptr<runtime> create_runtime(std::unique_ptr<schema_registry> sr) {
-    return std::make_unique<wasmtime_runtime>(std::move(sr));
+std::unique_ptr<runtime> create_runtime(
+  std::unique_ptr<schema_registry> sr,
+  std::optional<std::filesystem::path> compilation_cache_dir) {
+    return std::make_unique<wasmtime_runtime>(
+      std::move(sr), std::move(compilation_cache_dir));
 }
 
 } // namespace wasm::wasmtime
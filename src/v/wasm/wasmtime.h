@@ -15,6 +15,11 @@
 
 #include <seastar/core/future.hh>
 
+#include <filesystem>
+#include <optional>
+
 namespace wasm::wasmtime {
-std::unique_ptr<runtime> create_runtime(std::unique_ptr<schema_registry>);
+std::unique_ptr<runtime> create_runtime(
+  std::unique_ptr<schema_registry>,
+  std::optional<std::filesystem::path> compilation_cache_dir = std::nullopt);
 }